@@ -47,6 +47,11 @@ typedef struct dwg_field_name_type_offset
   const unsigned short is_malloc : 1;
   const unsigned short is_string : 1;
   const short dxf;
+  const unsigned short dtype : 8;
+  const unsigned short is_vector : 1;
+  const unsigned short is_handle : 1;
+  const unsigned short is_float : 1;
+  const unsigned short is_angle : 1;
 } Dwg_DYNAPI_field;
 
 EXPORT bool is_dwg_entity (const char *name);
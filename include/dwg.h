@@ -11381,6 +11381,24 @@ typedef struct _dwg_secondheader
   BITCODE_RLL junk_r14; /*!< r14-r2000 */
 } Dwg_SecondHeader;
 
+/**
+ Predicate pushdown for reading r13+ DWGs, set as dwg->filter before
+ dwg_read_file or dwg_read_data. Only the objects passing all given
+ conditions are decoded, the others are kept as placeholders with only their
+ type, handle, address and size, as with DWG_OPTS_LAZY, and are decoded on
+ demand. An empty list passes all.
+ */
+typedef struct _dwg_filter
+{
+  const Dwg_Object_Type *types; /*!< fixed types or classes to decode */
+  BITCODE_BL num_types;
+  const BITCODE_RLL *layers;    /*!< entities on one of these layer handles */
+  BITCODE_BL num_layers;
+  const BITCODE_RLL *owners;    /*!< entities owned by one of these handles,
+                                     e.g. the *Model_Space block header */
+  BITCODE_BL num_owners;
+} Dwg_Filter;
+
 /**
  Main DWG struct
  */
@@ -11400,8 +11418,8 @@ typedef struct _dwg_struct
   BITCODE_RS last_viewport_id;   /*!< auto-incremented VIEWPORT id for DXF */
   Dwg_Object_Ref **object_ref;   /*!< array of most handles */
   struct _inthash *object_map;   /*!< map of all handles */
-  int dirty_refs;                /* 1 if we added an object, and invalidated all
-                                    the internal ref->obj's */
+  int dirty_refs;                /* unused, always 0. The ref->obj's are
+                                    rebased when the objects are moved. */
   unsigned int opts;             /* See DWG_OPTS_* below */
 
   Dwg_Header_Variables header_vars;
@@ -11445,6 +11463,17 @@ typedef struct _dwg_struct
   // for speedup dwg_add_handleref
   Dwg_Object_Ref **object_ordered_ref; /*! list of all ordered objects refs */
   BITCODE_BL num_object_ordered_refs;  /*! number of ordered objects refs */
+
+  Dwg_Chain lazy_dat; /*!< the kept objects stream with DWG_OPTS_LAZY */
+  size_t lazy_mapped; /*!< lazy_dat is the mmap'ed file of this size */
+  unsigned char lazy_borrowed; /*!< lazy_dat is the caller's input */
+  unsigned int num_threads; /*!< r2004+ DWG: decode the objects in threads */
+  unsigned int compress_level; /*!< r2004+ DWG writing: DWG_COMPRESS_* */
+  const Dwg_Filter *filter; /*!< r13+ DWG: decode only the matching objects */
+  struct _dwg_arena *ref_pool; /*!< with DWG_OPTS_REF_POOL: the global refs */
+  struct _dwg_table_index *table_index; /*!< name index per table, see
+                                           dwg_find_tablehandle */
+  BITCODE_BL num_table_index;
 } Dwg_Data;
 
 #define DWG_OPTS_LOGLEVEL 0xf
@@ -11455,6 +11484,29 @@ typedef struct _dwg_struct
 #define DWG_OPTS_INDXF    0x40
 #define DWG_OPTS_INJSON   0x80
 #define DWG_OPTS_IN       (DWG_OPTS_INDXF | DWG_OPTS_INJSON)
+/* only in dwg->opts, not in dat->opts: */
+/* Map regular input files into memory, instead of reading a copy. */
+#define DWG_OPTS_MMAP     0x100
+/* r13+ DWG: Keep the objects stream, and decode objects only on demand. */
+#define DWG_OPTS_LAZY     0x200
+/* r13+ DWG: Read only the header, the classes and the metadata sections,
+   like SummaryInfo, Preview, AppInfo and FileDepList. No objects, unless
+   with a dwg->filter or DWG_OPTS_TABLES. */
+#define DWG_OPTS_HEADER   0x400
+/* r13+ DWG: Without a dwg->filter decode only the control objects and the
+   table records. */
+#define DWG_OPTS_TABLES   0x800
+/* Allocate the global object refs from a per-drawing pool, which is
+   released at once by dwg_free. All other allocations stay as they are. */
+#define DWG_OPTS_REF_POOL 0x1000
+
+/* r2004+ DWG writing, dwg->compress_level: the strength of the LZ77
+   compression of the section pages. With NONE the data pages are stored
+   uncompressed, the others compress them also. */
+#define DWG_COMPRESS_NONE   0
+#define DWG_COMPRESS_FAST   1
+#define DWG_COMPRESS_NORMAL 2
+#define DWG_COMPRESS_HIGH   3
 
 typedef enum RESBUF_VALUE_TYPE
 {
@@ -11484,6 +11536,34 @@ EXPORT int dxf_read_file (const char *restrict filename,
 EXPORT int dwg_write_file (const char *restrict filename,
                            const Dwg_Data *restrict dwg);
 
+/* Decode from a caller-owned memory buffer. dwg_read_data does not copy
+   nor change the DWG data, the text formats work on a private copy. */
+EXPORT int dwg_read_data (const unsigned char *restrict data,
+                          const size_t size, Dwg_Data *restrict dwg);
+EXPORT int dxf_read_data (const unsigned char *restrict data,
+                          const size_t size, Dwg_Data *restrict dwg);
+EXPORT int json_read_data (const unsigned char *restrict data,
+                           const size_t size, Dwg_Data *restrict dwg);
+
+/* Returns the number of bytes read into buf, at most size.
+   0 for the end of input. */
+typedef size_t (*Dwg_Reader_Callback) (void *restrict ctx,
+                                       unsigned char *restrict buf,
+                                       const size_t size);
+/* Reads all from the callback, and decodes the detected format:
+   DWG, DXF, binary DXF or JSON. */
+EXPORT int dwg_read_from_reader (Dwg_Reader_Callback reader,
+                                 void *restrict ctx, Dwg_Data *restrict dwg);
+
+/* With DWG_OPTS_LAZY only the type, handle, address and size of the objects
+   are read, their tio is NULL until decoded. dwg_resolve_handle,
+   dwg_ref_object and dwg_get_object decode them on demand, which changes
+   the dwg. r13-r2000 objects are decoded from the input, which must be kept
+   for dwg_read_data. */
+EXPORT int dwg_decode_lazy_object (Dwg_Object *restrict obj);
+/* Decode all remaining objects, as needed before any output or write. */
+EXPORT int dwg_decode_lazy_objects (Dwg_Data *restrict dwg);
+
 /* Supports multiple preview picture types.
    Currently 3 types: BMP 2, WMF 3 and PNG as type 6.
    Returns the size of the image.
@@ -11508,7 +11588,7 @@ EXPORT BITCODE_H
 dwg_ctrl_table (Dwg_Data *restrict dwg, const char *restrict table);
 
 /* Search for the name in the associated table, and return its handle. Search
- * is case-insensitive.
+ * is case-insensitive, via a lazy name index per table.
  * Both name and table are ascii.
  */
 EXPORT BITCODE_H dwg_find_tablehandle (Dwg_Data *restrict dwg,
@@ -11713,7 +11793,8 @@ EXPORT BITCODE_BS dwg_find_color_index (BITCODE_BL rgb);
 
 /** Add the empty object to the DWG.
     Returns DWG_ERR_OUTOFMEM, -1 for realloced or 0 if not.
-    objects are allocated in bulk, and all old obj pointers may become invalid.
+    objects are allocated in bulk, and all old local obj pointers may become
+    invalid. The ref->obj pointers are kept valid.
     The new object is at &dwg->object[dwg->num_objects - 1].
 */
 EXPORT int dwg_add_object (Dwg_Data *restrict dwg);
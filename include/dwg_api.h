@@ -87,6 +87,56 @@ extern "C"
   // static bool g_add_to_mspace = true;
 
   /** dynapi */
+  /* The Dwg_DYNAPI_field.type as integer, without a vector *, for
+     switch dispatch. Structs and subclasses are DWG_DT_OTHER. */
+  typedef enum DWG_DYNAPI_TYPE
+  {
+    DWG_DT_OTHER = 0,
+    DWG_DT_B,
+    DWG_DT_BB,
+    DWG_DT_BT,
+    DWG_DT_4BITS,
+    DWG_DT_RC,
+    DWG_DT_RCd,
+    DWG_DT_RS,
+    DWG_DT_RSd,
+    DWG_DT_BS,
+    DWG_DT_BSd,
+    DWG_DT_RL,
+    DWG_DT_RLd,
+    DWG_DT_RLx,
+    DWG_DT_BL,
+    DWG_DT_BLd,
+    DWG_DT_BLx,
+    DWG_DT_RLL,
+    DWG_DT_RLLd,
+    DWG_DT_BLL,
+    DWG_DT_RD,
+    DWG_DT_BD,
+    DWG_DT_2RD,
+    DWG_DT_2BD,
+    DWG_DT_2BD_1,
+    DWG_DT_2DPOINT,
+    DWG_DT_3RD,
+    DWG_DT_3BD,
+    DWG_DT_3BD_1,
+    DWG_DT_3DPOINT,
+    DWG_DT_BE,
+    DWG_DT_CMC,
+    DWG_DT_H,
+    DWG_DT_T,
+    DWG_DT_TV,
+    DWG_DT_TU,
+    DWG_DT_TF,
+    DWG_DT_TFv,
+    DWG_DT_TFF,
+    DWG_DT_T16,
+    DWG_DT_T32,
+    DWG_DT_D2T,
+    DWG_DT_TIMEBLL,
+    DWG_DT_TIMERLL
+  } Dwg_DYNAPI_type;
+
   typedef struct dwg_field_name_type_offset
   {
     const char *const name;    /* field name */
@@ -100,6 +150,11 @@ extern "C"
     const unsigned short is_string : 1; // for null-terminated strings, use
                                         // strcpy/wcscpy. not memcpy
     const short dxf;
+    const unsigned short dtype : 8;     // Dwg_DYNAPI_type of type
+    const unsigned short is_vector : 1; // dynamic array, like BD* or H*
+    const unsigned short is_handle : 1; // H or H*
+    const unsigned short is_float : 1;  // a single BD or RD
+    const unsigned short is_angle : 1;  // DXF 50-59
   } Dwg_DYNAPI_field;
 
   /** Check if the name is a valid ENTITY name, not an OBJECT.
@@ -267,6 +322,62 @@ extern "C"
   EXPORT int dwg_dynapi_fields_size (const char *restrict name)
       __nonnull ((1));
 
+  /** A field resolved once by its object and field name, to get and set its
+      value repeatedly without any name lookup. The members are private.
+   */
+  typedef enum DWG_DYNAPI_SCOPE
+  {
+    DWG_DYNAPI_ENTITY = 1, /* the fields of the object specific struct */
+    DWG_DYNAPI_COMMON,     /* the common entity or object fields */
+    DWG_DYNAPI_HEADER,
+    DWG_DYNAPI_SUBCLASS
+  } Dwg_DYNAPI_scope;
+
+  typedef struct dwg_dynapi_fieldhandle
+  {
+    const Dwg_DYNAPI_field *field;
+    int type; /* the fixedtype of the entity or object, or the supertype */
+    Dwg_DYNAPI_scope scope;
+  } Dwg_DYNAPI_fieldhandle;
+
+  /** Resolve the field into handle. Returns false if there's no such field.
+   */
+  EXPORT bool
+  dwg_dynapi_entity_fieldhandle (const char *restrict name,
+                                 const char *restrict fieldname,
+                                 Dwg_DYNAPI_fieldhandle *restrict handle)
+      __nonnull ((1, 2, 3));
+  EXPORT bool
+  dwg_dynapi_common_fieldhandle (const Dwg_Object_Supertype supertype,
+                                 const char *restrict fieldname,
+                                 Dwg_DYNAPI_fieldhandle *restrict handle)
+      __nonnull ((2, 3));
+  EXPORT bool
+  dwg_dynapi_header_fieldhandle (const char *restrict fieldname,
+                                 Dwg_DYNAPI_fieldhandle *restrict handle)
+      __nonnull ((1, 2));
+  EXPORT bool
+  dwg_dynapi_subclass_fieldhandle (const char *restrict subclass,
+                                   const char *restrict fieldname,
+                                   Dwg_DYNAPI_fieldhandle *restrict handle)
+      __nonnull ((1, 2, 3));
+
+  /** Get and set the value of the resolved field, as with the
+      dwg_dynapi_*_value and dwg_dynapi_*_set_value functions of its scope.
+      ptr is the object specific struct, also for the common fields, the
+      Dwg_Data for the header fields, and the subclass struct for subclass
+      fields. dwg is only needed to set subclass fields, and may be NULL
+      otherwise.
+   */
+  EXPORT bool
+  dwg_dynapi_fieldhandle_value (const void *restrict ptr,
+                                const Dwg_DYNAPI_fieldhandle *restrict handle,
+                                void *restrict out) __nonnull ((1, 2, 3));
+  EXPORT bool dwg_dynapi_fieldhandle_set_value (
+      const Dwg_Data *dwg, void *restrict ptr,
+      const Dwg_DYNAPI_fieldhandle *restrict handle,
+      const void *restrict value, const bool is_utf8) __nonnull ((2, 3, 4));
+
   /* static api */
   typedef struct dwg_point_3d
   {
@@ -117,7 +117,7 @@ get_bmp (char *dwgfile, char *bmpfile, bool must_free)
   const char *typename;
 
   memset (&dwg, 0, sizeof (Dwg_Data));
-  dwg.opts = opts;
+  dwg.opts = opts | DWG_OPTS_HEADER; // only the preview
   /* Read dwg data */
   error = dwg_read_file (dwgfile, &dwg);
   if (error >= DWG_ERR_CRITICAL)
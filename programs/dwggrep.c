@@ -1878,6 +1878,13 @@ main (int argc, char *argv[])
 #endif
   int count = 0;
   int c;
+  // with --tables decode only the table records
+  static const Dwg_Object_Type table_types[]
+      = { DWG_TYPE_BLOCK_HEADER, DWG_TYPE_LAYER, DWG_TYPE_LTYPE,
+          DWG_TYPE_STYLE,        DWG_TYPE_VIEW,  DWG_TYPE_VPORT,
+          DWG_TYPE_DIMSTYLE,     DWG_TYPE_UCS,   DWG_TYPE_VX_TABLE_RECORD };
+  Dwg_Filter tables_filter
+      = { table_types, ARRAY_SIZE (table_types), NULL, 0, NULL, 0 };
 #ifdef HAVE_GETOPT_LONG
   int option_index = 0;
   static struct option long_options[]
@@ -2036,6 +2043,8 @@ main (int argc, char *argv[])
       filename = argv[j];
       memset (&dwg, 0, sizeof (Dwg_Data));
       dwg.opts = 0;
+      if (opt_tables)
+        dwg.filter = &tables_filter;
       error = dwg_read_file (filename, &dwg);
       if (error > DWG_ERR_CRITICAL)
         {
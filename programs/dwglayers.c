@@ -86,6 +86,10 @@ main (int argc, char *argv[])
   Dwg_Object *obj;
   Dwg_Object_LAYER *layer;
   Dwg_Object_LAYER_CONTROL *_ctrl;
+  // decode only the layers
+  static const Dwg_Object_Type layer_types[]
+      = { DWG_TYPE_LAYER_CONTROL, DWG_TYPE_LAYER };
+  Dwg_Filter filter = { layer_types, 2, NULL, 0, NULL, 0 };
   int c;
 #ifdef HAVE_GETOPT_LONG
   int option_index = 0;
@@ -143,6 +147,8 @@ main (int argc, char *argv[])
 
   filename_in = argv[i];
   memset (&dwg, 0, sizeof (Dwg_Data));
+  dwg.filter = &filter;
+  dwg.opts |= DWG_OPTS_HEADER; // and the filtered tables
   error = dwg_read_file (filename_in, &dwg);
   if (error >= DWG_ERR_CRITICAL)
     {
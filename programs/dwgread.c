@@ -86,6 +86,9 @@ help (void)
   printf ("  -o outfile                also defines the output fmt. Default: "
           "stdout\n");
 #  endif
+  printf ("           --mmap           map the input file, do not copy it\n");
+  printf ("           --threads N      decode the r2004+ objects with N "
+          "threads\n");
   printf ("           --help           display this help and exit\n");
   printf ("           --version        output version information and exit\n"
           "\n");
@@ -120,6 +123,8 @@ main (int argc, char *argv[])
   const char *outfile = NULL;
   int has_v = 0;
   int force_free = 0;
+  int use_mmap = 0;
+  unsigned num_threads = 0;
   int c;
 #ifdef HAVE_GETOPT_LONG
   int option_index = 0;
@@ -127,7 +132,8 @@ main (int argc, char *argv[])
       = { { "verbose", 1, &opts, 1 }, // optional
           { "format", 1, NULL, 'O' },   { "file", 1, NULL, 'o' },
           { "help", 0, NULL, 0 },       { "version", 0, NULL, 0 },
-          { "force-free", 0, NULL, 0 }, { NULL, 0, NULL, 0 } };
+          { "force-free", 0, NULL, 0 }, { "mmap", 0, NULL, 0 },
+          { "threads", 1, NULL, 0 },    { NULL, 0, NULL, 0 } };
 #endif
 
   if (argc < 2)
@@ -178,6 +184,15 @@ main (int argc, char *argv[])
             return help ();
           if (!strcmp (long_options[option_index].name, "force-free"))
             force_free = 1;
+          if (!strcmp (long_options[option_index].name, "mmap"))
+            use_mmap = 1;
+          if (!strcmp (long_options[option_index].name, "threads"))
+            {
+              const long n = strtol (optarg, NULL, 10);
+              if (n < 0 || n > 1024)
+                return usage ();
+              num_threads = (unsigned)n;
+            }
           break;
 #else
         case 'i':
@@ -259,6 +274,9 @@ main (int argc, char *argv[])
   memset (&dwg, 0, sizeof (Dwg_Data));
   if (has_v || !fmt)
     dwg.opts = opts;
+  if (use_mmap)
+    dwg.opts |= DWG_OPTS_MMAP;
+  dwg.num_threads = num_threads;
 #if defined(USE_TRACING) && defined(HAVE_SETENV)
   if (!has_v)
     setenv ("LIBREDWG_TRACE", "1", 0);
@@ -69,6 +69,10 @@ help (void)
   printf ("           Planned versions:\n");
   printf ("             r2007, r2010, r2013, r2018\n");
   printf ("  -o dwgfile, --file        \n");
+  printf ("           --threads N      read and write the objects with N "
+          "threads\n");
+  printf ("           --compress N     LZ77 compress the r2004+ data pages\n"
+          "                            level 0 none (default) to 3 high\n");
   printf ("           --help           display this help and exit\n");
   printf ("           --version        output version information and exit\n"
           "\n");
@@ -162,13 +166,16 @@ main (int argc, char *argv[])
   int free_fnout = 0;
   Dwg_Version_Type dwg_version;
   BITCODE_BL num_objects;
+  unsigned num_threads = 0;
+  unsigned compress_level = DWG_COMPRESS_NONE;
   int c;
 #ifdef HAVE_GETOPT_LONG
   int option_index = 0;
   static struct option long_options[]
       = { { "verbose", 1, &opts, 1 }, // optional
           { "file", 1, 0, 'o' },      { "as", 1, 0, 'a' }, { "help", 0, 0, 0 },
-          { "version", 0, 0, 0 },     { NULL, 0, NULL, 0 } };
+          { "version", 0, 0, 0 },     { "threads", 1, 0, 0 },
+          { "compress", 1, 0, 0 },    { NULL, 0, NULL, 0 } };
 #endif
 #ifdef __AFL_HAVE_MANUAL_CONTROL
   __AFL_INIT ();
@@ -220,6 +227,20 @@ main (int argc, char *argv[])
             return opt_version ();
           if (!strcmp (long_options[option_index].name, "help"))
             return help ();
+          if (!strcmp (long_options[option_index].name, "threads"))
+            {
+              const long n = strtol (optarg, NULL, 10);
+              if (n < 0 || n > 1024)
+                return usage ();
+              num_threads = (unsigned)n;
+            }
+          if (!strcmp (long_options[option_index].name, "compress"))
+            {
+              const long n = strtol (optarg, NULL, 10);
+              if (n < DWG_COMPRESS_NONE || n > DWG_COMPRESS_HIGH)
+                return usage ();
+              compress_level = (unsigned)n;
+            }
           break;
 #else
         case 'i':
@@ -268,6 +289,8 @@ main (int argc, char *argv[])
 
   memset (&dwg, 0, sizeof (Dwg_Data));
   dwg.opts = opts & 0xf;
+  dwg.num_threads = num_threads;
+  dwg.compress_level = compress_level;
 
 #ifdef __AFL_HAVE_MANUAL_CONTROL
   while (__AFL_LOOP (1000))
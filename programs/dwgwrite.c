@@ -86,6 +86,9 @@ help (void)
   printf ("           Planned input formats: GeoJSON, YAML, XML/OGR, GPX\n");
   printf ("  -o dwgfile, --file        \n");
   printf ("  -y, --overwrite           overwrite existing files\n");
+  printf ("           --threads N      encode the objects with N threads\n");
+  printf ("           --compress N     LZ77 compress the r2004+ data pages\n"
+          "                            level 0 none (default) to 3 high\n");
   printf ("           --help           display this help and exit\n");
   printf ("           --version        output version information and exit\n"
           "\n");
@@ -193,6 +196,8 @@ main (int argc, char *argv[])
   int c;
   int force_free = 0;
   int free_outfile = 0;
+  unsigned num_threads = 0;
+  unsigned compress_level = DWG_COMPRESS_NONE;
 #ifdef HAVE_GETOPT_LONG
   int option_index = 0;
   static struct option long_options[]
@@ -200,7 +205,8 @@ main (int argc, char *argv[])
           { "format", 1, NULL, 'I' },    { "file", 1, NULL, 'o' },
           { "as", 1, NULL, 'a' },        { "help", 0, NULL, 'h' },
           { "overwrite", 0, NULL, 'y' }, { "version", 0, NULL, 0 },
-          { "force-free", 0, NULL, 0 },  { NULL, 0, NULL, 0 } };
+          { "force-free", 0, NULL, 0 },  { "threads", 1, NULL, 0 },
+          { "compress", 1, NULL, 0 },    { NULL, 0, NULL, 0 } };
 #endif
 
   if (argc < 2)
@@ -247,6 +253,20 @@ main (int argc, char *argv[])
             return opt_version ();
           if (!strcmp (long_options[option_index].name, "force-free"))
             force_free = 1;
+          if (!strcmp (long_options[option_index].name, "threads"))
+            {
+              const long n = strtol (optarg, NULL, 10);
+              if (n < 0 || n > 1024)
+                return usage ();
+              num_threads = (unsigned)n;
+            }
+          if (!strcmp (long_options[option_index].name, "compress"))
+            {
+              const long n = strtol (optarg, NULL, 10);
+              if (n < DWG_COMPRESS_NONE || n > DWG_COMPRESS_HIGH)
+                return usage ();
+              compress_level = (unsigned)n;
+            }
           break;
 #else
         case 'i':
@@ -358,8 +378,7 @@ main (int argc, char *argv[])
       if (opts > 1)
         fprintf (stderr, "Reading JSON file %s\n",
                  infile ? infile : "from stdin");
-      if (infile)
-        dat_read_file (&dat, dat.fh, infile);
+      // streamed from dat.fh
       error = dwg_read_json (&dat, &dwg);
     }
   else
@@ -420,6 +439,8 @@ main (int argc, char *argv[])
   if (dwg.header.from_version == R_INVALID)
     fprintf (stderr, "Unknown DWG header.from_version\n");
   dat.version = dwg.header.version = dwg_version;
+  dwg.num_threads = num_threads;
+  dwg.compress_level = compress_level;
 
   if (!outfile)
     {
@@ -83,6 +83,9 @@ help (void)
   printf ("             r9, r10, r11, r2007, r2010, r2013, r2018\n");
   printf ("  -o outfile, --file        optional, only valid with one single "
           "DXFFILE\n");
+  printf ("       --threads N          encode the objects with N threads\n");
+  printf ("       --compress N         LZ77 compress the r2004+ data pages\n"
+          "                            level 0 none (default) to 3 high\n");
   printf ("       --help               display this help and exit\n");
   printf ("       --version            output version information and exit\n"
           "\n");
@@ -186,6 +189,8 @@ main (int argc, char *argv[])
   Dwg_Version_Type dwg_version = R_2000;
   int do_free = 0;
   int need_free = 0;
+  unsigned num_threads = 0;
+  unsigned compress_level = DWG_COMPRESS_NONE;
   int c;
 #ifdef HAVE_GETOPT_LONG
   int option_index = 0;
@@ -194,6 +199,7 @@ main (int argc, char *argv[])
           { "file", 1, 0, 'o' },      { "as", 1, 0, 'a' },
           { "overwrite", 0, 0, 'y' }, { "help", 0, 0, 0 },
           { "force-free", 0, 0, 0 },  { "version", 0, 0, 0 },
+          { "threads", 1, 0, 0 },     { "compress", 1, 0, 0 },
           { NULL, 0, NULL, 0 } };
 #endif
 
@@ -244,6 +250,20 @@ main (int argc, char *argv[])
             return help ();
           if (!strcmp (long_options[option_index].name, "force-free"))
             do_free = 1;
+          if (!strcmp (long_options[option_index].name, "threads"))
+            {
+              const long n = strtol (optarg, NULL, 10);
+              if (n < 0 || n > 1024)
+                return usage ();
+              num_threads = (unsigned)n;
+            }
+          if (!strcmp (long_options[option_index].name, "compress"))
+            {
+              const long n = strtol (optarg, NULL, 10);
+              if (n < DWG_COMPRESS_NONE || n > DWG_COMPRESS_HIGH)
+                return usage ();
+              compress_level = (unsigned)n;
+            }
           break;
 #else
         case 'i':
@@ -339,6 +359,8 @@ main (int argc, char *argv[])
         }
 
       dwg.opts |= opts;
+      dwg.num_threads = num_threads;
+      dwg.compress_level = compress_level;
       printf ("Writing DWG file %s", filename_out);
       if (version)
         {
@@ -0,0 +1,89 @@
+/*****************************************************************************/
+/*  LibreDWG - free implementation of the DWG file format                    */
+/*                                                                           */
+/*  Copyright (C) 2026 Free Software Foundation, Inc.                        */
+/*                                                                           */
+/*  This library is free software, licensed under the terms of the GNU       */
+/*  General Public License as published by the Free Software Foundation,     */
+/*  either version 3 of the License, or (at your option) any later version.  */
+/*  You should have received a copy of the GNU General Public License        */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.    */
+/*****************************************************************************/
+
+/*
+ * arena.c: per-drawing bump allocator. The chunks are calloc'ed, so every
+ *          allocation is already zeroed. Chunks grow by doubling.
+ */
+
+#include "arena.h"
+#include <stdlib.h>
+
+#define ARENA_HEADER                                                          \
+  ((sizeof (Dwg_Arena_Chunk) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+static Dwg_Arena_Chunk *
+arena_chunk_new (Dwg_Arena *arena, size_t size)
+{
+  Dwg_Arena_Chunk *chunk
+      = (Dwg_Arena_Chunk *)calloc (1, ARENA_HEADER + size);
+  if (!chunk)
+    return NULL;
+  chunk->size = size;
+  chunk->next = arena->chunk;
+  arena->chunk = chunk;
+  arena->num_chunks++;
+  arena->total += size;
+  return chunk;
+}
+
+Dwg_Arena *
+arena_new (size_t size)
+{
+  Dwg_Arena *arena = (Dwg_Arena *)calloc (1, sizeof (Dwg_Arena));
+  if (!arena)
+    return NULL;
+  arena->next_size = ARENA_MIN_CHUNK;
+  while (arena->next_size < size && arena->next_size < ARENA_MAX_CHUNK)
+    arena->next_size <<= 1U;
+  return arena;
+}
+
+void *
+arena_calloc (Dwg_Arena *arena, size_t size)
+{
+  Dwg_Arena_Chunk *chunk = arena->chunk;
+  unsigned char *p;
+  size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+  if (!chunk || chunk->used + size > chunk->size)
+    {
+      size_t chunk_size = arena->next_size;
+      while (chunk_size < size)
+        chunk_size <<= 1U;
+      if (arena->next_size < ARENA_MAX_CHUNK)
+        arena->next_size <<= 1U;
+      // the rest of the old chunk is wasted
+      chunk = arena_chunk_new (arena, chunk_size);
+      if (!chunk)
+        return NULL;
+    }
+  p = (unsigned char *)chunk + ARENA_HEADER + chunk->used;
+  chunk->used += size;
+  arena->num_allocs++;
+  return p;
+}
+
+void
+arena_free (Dwg_Arena *arena)
+{
+  Dwg_Arena_Chunk *chunk;
+  if (!arena)
+    return;
+  chunk = arena->chunk;
+  while (chunk)
+    {
+      Dwg_Arena_Chunk *next = chunk->next;
+      free (chunk);
+      chunk = next;
+    }
+  free (arena);
+}
@@ -0,0 +1,52 @@
+/*****************************************************************************/
+/*  LibreDWG - free implementation of the DWG file format                    */
+/*                                                                           */
+/*  Copyright (C) 2026 Free Software Foundation, Inc.                        */
+/*                                                                           */
+/*  This library is free software, licensed under the terms of the GNU       */
+/*  General Public License as published by the Free Software Foundation,     */
+/*  either version 3 of the License, or (at your option) any later version.  */
+/*  You should have received a copy of the GNU General Public License        */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>.    */
+/*****************************************************************************/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+/*
+ * arena.h: per-drawing bump allocator for many small, zeroed allocations
+ *          which live as long as the Dwg_Data, like the global refs.
+ *          Nothing is freed individually, all chunks are released at once.
+ */
+
+#include "config.h"
+#include <stddef.h>
+
+#define ARENA_MIN_CHUNK 0x10000   // 64KB
+#define ARENA_MAX_CHUNK 0x1000000 // 16MB
+#define ARENA_ALIGN 16
+
+typedef struct _dwg_arena_chunk
+{
+  struct _dwg_arena_chunk *next;
+  size_t size; // of data
+  size_t used;
+  // then the data, aligned
+} Dwg_Arena_Chunk;
+
+typedef struct _dwg_arena
+{
+  Dwg_Arena_Chunk *chunk; // the current, with the older ones as next
+  size_t next_size;       // of the next chunk, doubled up to the max
+  size_t num_allocs;      // the saved mallocs
+  size_t num_chunks;
+  size_t total; // bytes allocated
+} Dwg_Arena;
+
+// size is the expected total, or 0
+Dwg_Arena *arena_new (size_t size);
+// zeroed memory
+void *arena_calloc (Dwg_Arena *arena, size_t size);
+void arena_free (Dwg_Arena *arena);
+
+#endif
@@ -37,9 +37,12 @@
 #ifdef HAVE_ICONV_H
 #  include <iconv.h>
 #endif
+#ifdef HAVE_PTHREAD_H
+#  include <pthread.h>
+#endif
 
 #ifdef DWG_ABORT
-static unsigned int errors = 0;
+static THREAD_LOCAL unsigned int errors = 0;
 #  ifndef DWG_ABORT_LIMIT
 #    define DWG_ABORT_LIMIT 200
 #  endif
@@ -126,8 +129,8 @@ bit_reset_chain (Bit_Chain *dat)
         || (dat->bit ? ((dat->byte * 8) + dat->bit >= dat->size * 8)          \
                      : (dat->byte >= dat->size)))                             \
       {                                                                       \
-        static size_t _last_pos = 0;                                          \
-        static int _same_pos_count = 0;                                       \
+        static THREAD_LOCAL size_t _last_pos = 0;                             \
+        static THREAD_LOCAL int _same_pos_count = 0;                          \
         loglevel = dat->opts & DWG_OPTS_LOGLEVEL;                             \
         LOG_ERROR ("%s buffer overflow at %" PRIuSIZE ".%u >= %" PRIuSIZE,    \
                    func, dat->byte, dat->bit, dat->size);                     \
@@ -3365,7 +3368,7 @@ bit_utf8_to_TV (char *restrict dest, const unsigned char *restrict src,
                   && (wc1 = dwg_codepage_wc ((Dwg_Codepage)codepage, wc)))
                 {
                   if (wc1 > 0xFF)
-                    *dest++ = wc1 >> 4;
+                    *dest++ = wc1 >> 8;
                   *dest++ = wc1 & 0xff;
                 }
               // is representable as byte
@@ -3411,7 +3414,8 @@ bit_utf8_to_TV (char *restrict dest, const unsigned char *restrict src,
               if (is_asian_cp
                   && (wc1 = dwg_codepage_wc ((Dwg_Codepage)codepage, wc)))
                 {
-                  *dest++ = wc1 >> 4;
+                  if (wc1 > 0xFF)
+                    *dest++ = wc1 >> 8;
                   *dest++ = wc1 & 0xff;
                 }
               else if (!is_asian_cp
@@ -3548,7 +3552,8 @@ bit_TV_to_utf8_codepage (const char *restrict src, const BITCODE_RS codepage)
 {
   const bool is_asian_cp = dwg_codepage_isasian ((const Dwg_Codepage)codepage);
   const size_t srclen = strlen (src);
-  size_t destlen = is_asian_cp ? srclen * 3 : trunc (srclen * 1.5);
+  // at most 3 UTF-8 bytes per char, so no EXTEND_SIZE below
+  size_t destlen = srclen * 3;
   size_t i = 0;
   char *str = (char *)calloc (destlen + 1, 1);
   unsigned char *tmp = (unsigned char *)src;
@@ -3588,6 +3593,8 @@ bit_TV_to_utf8_codepage (const char *restrict src, const BITCODE_RS codepage)
           if (c < 0x80) // stayed below
             str[i++] = c & 0xFF;
         }
+      else // not in the codepage, ignored as with iconv
+        continue;
       if (c >= 0x80 && c < 0x800)
         {
           EXTEND_SIZE (str, i + 1, destlen);
@@ -3612,6 +3619,53 @@ bit_TV_to_utf8_codepage (const char *restrict src, const BITCODE_RS codepage)
   return (char *)bit_u_expand (str);
 }
 
+#ifdef HAVE_ICONV
+/* One cached iconv descriptor to UTF-8 per codepage, instead of
+   iconv_open/iconv_close for every string. A converting thread takes it out
+   of the cache, so that concurrent threads open their own. */
+static iconv_t iconv_cache[CP_ANSI_1258 + 1];
+#  ifdef HAVE_PTHREAD_H
+static pthread_mutex_t iconv_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+#  endif
+
+static iconv_t
+iconv_cache_get (const BITCODE_RS codepage, const char *restrict tocode,
+                 const char *restrict fromcode)
+{
+  iconv_t cd;
+#  ifdef HAVE_PTHREAD_H
+  pthread_mutex_lock (&iconv_cache_mutex);
+#  endif
+  cd = iconv_cache[codepage];
+  iconv_cache[codepage] = NULL;
+#  ifdef HAVE_PTHREAD_H
+  pthread_mutex_unlock (&iconv_cache_mutex);
+#  endif
+  if (cd)
+    return cd;
+  return iconv_open (tocode, fromcode);
+}
+
+static void
+iconv_cache_put (const BITCODE_RS codepage, iconv_t cd)
+{
+  iconv (cd, NULL, NULL, NULL, NULL); // reset the conversion state
+#  ifdef HAVE_PTHREAD_H
+  pthread_mutex_lock (&iconv_cache_mutex);
+#  endif
+  if (!iconv_cache[codepage])
+    {
+      iconv_cache[codepage] = cd;
+      cd = NULL;
+    }
+#  ifdef HAVE_PTHREAD_H
+  pthread_mutex_unlock (&iconv_cache_mutex);
+#  endif
+  if (cd)
+    iconv_close (cd);
+}
+#endif
+
 /** converts old codepage'd strings to UTF-8.
     convert \U+XXXX or \MnXXXX also if representable.
     returns NULL on errors, or the unchanged src string, or a copy.
@@ -3644,6 +3698,16 @@ bit_TV_to_utf8 (const char *restrict src, const BITCODE_RS codepage)
     }
   else if (!src)
     return NULL;
+  else if (dwg_codepage_is_simple ((Dwg_Codepage)codepage))
+    {
+      // ASCII fast path, else by our table without iconv
+      const unsigned char *s = (const unsigned char *)src;
+      while (*s && *s < 0x80)
+        s++;
+      if (!*s && !bit_is_U_expand (src) && !bit_is_M_expand (src))
+        return (char *)src;
+      return bit_TV_to_utf8_codepage (src, codepage);
+    }
   {
 #ifdef HAVE_ICONV
     const bool is_asian_cp
@@ -3668,7 +3732,7 @@ bit_TV_to_utf8 (const char *restrict src, const BITCODE_RS codepage)
           free (odest);
         return NULL;
       }
-    cd = iconv_open (utf8_cs, charset);
+    cd = iconv_cache_get (codepage, utf8_cs, charset);
     if (cd == (iconv_t)-1)
       {
         if (errno != 22)
@@ -3700,7 +3764,7 @@ bit_TV_to_utf8 (const char *restrict src, const BITCODE_RS codepage)
                     LOG_ERROR ("bit_TV_to_utf8: overlarge destlen %" PRIuSIZE
                                " for %s",
                                odestlen, src);
-                    iconv_close (cd);
+                    iconv_cache_put (codepage, cd);
                     if (odest)
                       free (odest);
                     return NULL;
@@ -3716,7 +3780,7 @@ bit_TV_to_utf8 (const char *restrict src, const BITCODE_RS codepage)
                   {
                     loglevel |= 1;
                     LOG_ERROR ("Out of memory");
-                    iconv_close (cd);
+                    iconv_cache_put (codepage, cd);
                     if (odest)
                       free (odest);
                     return NULL;
@@ -3726,7 +3790,7 @@ bit_TV_to_utf8 (const char *restrict src, const BITCODE_RS codepage)
               {
                 loglevel |= 1;
                 LOG_ERROR ("iconv \"%s\" failed with errno %d", src, errno);
-                iconv_close (cd);
+                iconv_cache_put (codepage, cd);
                 if (odest)
                   free (odest);
                 return bit_TV_to_utf8_codepage (osrc, codepage);
@@ -3741,13 +3805,13 @@ bit_TV_to_utf8 (const char *restrict src, const BITCODE_RS codepage)
         && (uintptr_t)dest <= (uintptr_t)odest + odestlen)
       {
         *dest = '\0';
-        iconv_close (cd);
+        iconv_cache_put (codepage, cd);
         // always gets shorter, so inplace
         return (char *)bit_u_expand (odest);
       }
     else
       {
-        iconv_close (cd);
+        iconv_cache_put (codepage, cd);
         if (odest)
           free (odest);
         return bit_TV_to_utf8_codepage (osrc, codepage);
@@ -4262,9 +4326,33 @@ bit_chain_init_dat (Bit_Chain *restrict dat, const size_t size,
   bit_chain_set_version (dat, from_dat);
 }
 
+#define CHAIN_BLOCK 4096
+// max. geometric growth of a big chain, beyond it grows linearly
+#define CHAIN_MAX_GROW 0x4000000
+
+/* Statistics of the grown chains, per thread: the number of reallocs, and
+   the bytes copied by them (at most). Reset and logged by dwg_encode. */
+static THREAD_LOCAL size_t chain_num_reallocs = 0;
+static THREAD_LOCAL size_t chain_copied = 0;
+
+void
+bit_chain_stats (size_t *restrict num_reallocs, size_t *restrict copied)
+{
+  *num_reallocs = chain_num_reallocs;
+  *copied = chain_copied;
+}
+
+void
+bit_chain_stats_reset (void)
+{
+  chain_num_reallocs = 0;
+  chain_copied = 0;
+}
+
 /*
- * Allocates or adds more memory space for bit_chain
- * adds a 1kB page.
+ * Allocates or adds more memory space for bit_chain, at least size bytes.
+ * Grows geometrically by its current size, up to CHAIN_MAX_GROW, so that
+ * writing a big DWG does not realloc and copy for every new page.
  */
 void
 bit_chain_alloc_size (Bit_Chain *dat, const size_t size)
@@ -4276,6 +4364,7 @@ bit_chain_alloc_size (Bit_Chain *dat, const size_t size)
   else
     {
       unsigned char *tmp;
+      size_t grow = dat->size < CHAIN_MAX_GROW ? dat->size : CHAIN_MAX_GROW;
       if (dat->size + size > MAX_MEM_ALLOC || dat->byte > MAX_MEM_ALLOC
           || size >= MAX_MEM_ALLOC)
         {
@@ -4287,7 +4376,9 @@ bit_chain_alloc_size (Bit_Chain *dat, const size_t size)
           return;
 #endif
         }
-      tmp = (unsigned char *)realloc (dat->chain, dat->size + size);
+      if (grow < size || dat->size + grow > MAX_MEM_ALLOC)
+        grow = size;
+      tmp = (unsigned char *)realloc (dat->chain, dat->size + grow);
       if (tmp)
         dat->chain = tmp;
       else
@@ -4300,18 +4391,27 @@ bit_chain_alloc_size (Bit_Chain *dat, const size_t size)
           return;
 #endif
         }
-      memset (&dat->chain[dat->size], 0, size);
-      dat->size += size;
+      chain_num_reallocs++;
+      chain_copied += dat->size;
+      memset (&dat->chain[dat->size], 0, grow);
+      dat->size += grow;
     }
 }
 
-#define CHAIN_BLOCK 4096
 void
 bit_chain_alloc (Bit_Chain *dat)
 {
   bit_chain_alloc_size (dat, CHAIN_BLOCK);
 }
 
+/* Ensures room for size more bytes after dat->byte. */
+void
+bit_chain_reserve (Bit_Chain *dat, const size_t size)
+{
+  if (dat->byte + size + 1 > dat->size) // +1 for the current partial byte
+    bit_chain_alloc_size (dat, dat->byte + size + 1 - dat->size);
+}
+
 void
 bit_chain_free (Bit_Chain *dat)
 {
@@ -4608,8 +4708,7 @@ bit_copy_chain (Bit_Chain *restrict dat, Bit_Chain *restrict tmp_dat)
       LOG_ERROR ("bit_copy_chain: dat->chain == tmp_dat->chain");
       return;
     }
-  if (dat->byte + size > dat->size)
-    bit_chain_alloc (dat);
+  bit_chain_reserve (dat, size);
   if (dat->byte + size > dat->size)
     return;
   // check if both dat's are byte aligned (handles are)
@@ -349,7 +349,11 @@ void bit_chain_init_dat (Bit_Chain *restrict dat, const size_t size,
                          const Bit_Chain *restrict from_dat);
 void bit_chain_alloc (Bit_Chain *dat);
 void bit_chain_alloc_size (Bit_Chain *dat, const size_t size);
+void bit_chain_reserve (Bit_Chain *dat, const size_t size);
 void bit_chain_free (Bit_Chain *dat);
+// realloc statistics of the grown chains in this thread
+void bit_chain_stats (size_t *restrict num_reallocs, size_t *restrict copied);
+void bit_chain_stats_reset (void);
 // after bit_chain_init
 #define bit_chain_set_version(to, from)                                       \
   (to)->opts = (from)->opts;                                                  \
@@ -382,4 +386,214 @@ size_t in_hex2bin (unsigned char *restrict dest, char *restrict src,
 // if there's a high char (> 0x7f)
 bool bit_TF_contains_high (char *s, size_t len);
 
+/* Inlined fast paths of the most frequent readers, for the decoder hot path
+   (see dec_macros.h). They take the next 64 bits at once into a window and
+   consume the bit codes from it, without the per-byte bit arithmetic and
+   bounds checks. Only with at least BIT_FAST_BYTES left, else and on invalid
+   codes they fall back to the functions above, with their overflow checks
+   and error logging. The results and positions are the same, and as the
+   Bit_Chain is the only state, they can be mixed with all other readers. */
+
+// A window at +1 byte may touch 9 more bytes, e.g. BD and H
+#define BIT_FAST_BYTES 10
+#define bit_fast_p(dat) ((dat)->byte + BIT_FAST_BYTES <= (dat)->size)
+
+static inline uint16_t
+bit_swap16 (const uint16_t x)
+{
+  return (uint16_t)((x >> 8) | (x << 8));
+}
+static inline uint32_t
+bit_swap32 (const uint32_t x)
+{
+  return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+}
+static inline uint64_t
+bit_swap64 (const uint64_t x)
+{
+  return ((uint64_t)bit_swap32 ((uint32_t)x) << 32)
+         | bit_swap32 ((uint32_t)(x >> 32));
+}
+
+/* The next 64 bits, the next bit in the highest bit. Needs 9 bytes. */
+static inline uint64_t
+bit_window (const Bit_Chain *dat)
+{
+  uint64_t w;
+  memcpy (&w, &dat->chain[dat->byte], 8);
+  w = be64toh (w);
+  if (dat->bit)
+    w = (w << dat->bit) | (dat->chain[dat->byte + 8] >> (8 - dat->bit));
+  return w;
+}
+
+static inline void
+bit_consume (Bit_Chain *dat, const unsigned bits)
+{
+  const unsigned pos = dat->bit + bits;
+  dat->byte += pos >> 3;
+  dat->bit = pos & 7;
+}
+
+static inline BITCODE_B
+bit_read_B_fast (Bit_Chain *dat)
+{
+  BITCODE_B b;
+  if (!bit_fast_p (dat))
+    return bit_read_B (dat);
+  b = (dat->chain[dat->byte] >> (7 - dat->bit)) & 1;
+  bit_consume (dat, 1);
+  return b;
+}
+
+static inline BITCODE_BB
+bit_read_BB_fast (Bit_Chain *dat)
+{
+  uint64_t w;
+  if (!bit_fast_p (dat))
+    return bit_read_BB (dat);
+  w = bit_window (dat);
+  bit_consume (dat, 2);
+  return (BITCODE_BB)(w >> 62);
+}
+
+static inline BITCODE_RC
+bit_read_RC_fast (Bit_Chain *dat)
+{
+  BITCODE_RC c;
+  if (!bit_fast_p (dat))
+    return bit_read_RC (dat);
+  c = dat->chain[dat->byte++];
+  if (dat->bit)
+    c = (BITCODE_RC)((c << dat->bit)
+                     | (dat->chain[dat->byte] >> (8 - dat->bit)));
+  return c;
+}
+
+static inline BITCODE_BS
+bit_read_BS_fast (Bit_Chain *dat)
+{
+  uint64_t w;
+  if (!bit_fast_p (dat))
+    return bit_read_BS (dat);
+  w = bit_window (dat);
+  switch (w >> 62)
+    {
+    case 0:
+      bit_consume (dat, 18);
+      return bit_swap16 ((uint16_t)(w >> 46));
+    case 1:
+      bit_consume (dat, 10);
+      return (BITCODE_BS)((w >> 54) & 0xff);
+    case 2:
+      bit_consume (dat, 2);
+      return 0;
+    default:
+      bit_consume (dat, 2);
+      return 256;
+    }
+}
+
+static inline BITCODE_BL
+bit_read_BL_fast (Bit_Chain *dat)
+{
+  uint64_t w;
+  if (!bit_fast_p (dat))
+    return bit_read_BL (dat);
+  w = bit_window (dat);
+  switch (w >> 62)
+    {
+    case 0:
+      bit_consume (dat, 34);
+      return bit_swap32 ((uint32_t)(w >> 30));
+    case 1:
+      bit_consume (dat, 10);
+      return (BITCODE_BL)((w >> 54) & 0xff);
+    case 2:
+      bit_consume (dat, 2);
+      return 0;
+    default: // invalid
+      return bit_read_BL (dat);
+    }
+}
+
+static inline BITCODE_BD
+bit_read_BD_fast (Bit_Chain *dat)
+{
+  union
+  {
+    uint64_t u;
+    double d;
+  } u;
+  if (!bit_fast_p (dat))
+    return bit_read_BD (dat);
+  u.u = bit_window (dat);
+  switch (u.u >> 62)
+    {
+    case 0:
+      bit_consume (dat, 2);
+      u.u = bit_swap64 (bit_window (dat));
+      bit_consume (dat, 64);
+      return u.d;
+    case 1:
+      bit_consume (dat, 2);
+      return 1.0;
+    case 2:
+      bit_consume (dat, 2);
+      return 0.0;
+    default: // invalid
+      return bit_read_BD (dat);
+    }
+}
+
+static inline BITCODE_MC
+bit_read_MC_fast (Bit_Chain *dat)
+{
+  uint64_t w;
+  BITCODE_UMC result = 0;
+  if (!bit_fast_p (dat))
+    return bit_read_MC (dat);
+  w = bit_window (dat);
+  for (unsigned i = 0; i < 5; i++)
+    {
+      BITCODE_RC byte = (BITCODE_RC)(w >> (56 - 8 * i));
+      if (!(byte & 0x80))
+        {
+          const bool negative = byte & 0x40;
+          result |= ((BITCODE_UMC)(byte & 0xbf)) << (7 * i);
+          if (result > (BITCODE_UMC)INT32_MAX)
+            break;
+          bit_consume (dat, 8 * (i + 1));
+          return negative ? -(BITCODE_MC)result : (BITCODE_MC)result;
+        }
+      result |= ((BITCODE_UMC)(byte & 0x7f)) << (7 * i);
+    }
+  return bit_read_MC (dat); // invalid
+}
+
+static inline int
+bit_read_H_fast (Bit_Chain *restrict dat, Dwg_Handle *restrict handle)
+{
+  BITCODE_RC c;
+  if (!bit_fast_p (dat) || dat->from_version < R_13b1)
+    return bit_read_H (dat, handle);
+  c = dat->bit ? (BITCODE_RC)(bit_window (dat) >> 56)
+               : dat->chain[dat->byte];
+  if ((c & 0xf) > sizeof (BITCODE_RC *) || (c >> 4) > 14)
+    return bit_read_H (dat, handle); // invalid
+  handle->code = c >> 4;
+  handle->size = c & 0xf;
+  handle->is_global = 0;
+  bit_consume (dat, 8);
+  if (handle->size)
+    {
+      const uint64_t w = bit_window (dat);
+      bit_consume (dat, 8 * handle->size);
+      handle->value = htole64 (w >> (64 - 8 * handle->size));
+    }
+  else
+    handle->value = 0;
+  return 0;
+}
+
 #endif // BITS_H
@@ -124,6 +124,56 @@ static const uint16_t *cp_fntbl[] = { NULL, // UTF8
                                       cptbl_windows_1258,
                                       NULL };
 
+/* sorted reverse tables: unicode to the charset, generated by txt2h.pl */
+static const uint16_t *cp_revtbl[] = {
+  NULL, // UTF8
+  NULL, // US-ASCII
+  NULL, // ISO-8859-1
+  cptbl_rev_iso_8859_2,
+  cptbl_rev_iso_8859_3,
+  cptbl_rev_iso_8859_4,
+  cptbl_rev_iso_8859_5,
+  cptbl_rev_iso_8859_6,
+  cptbl_rev_iso_8859_7,
+  cptbl_rev_iso_8859_8,
+  cptbl_rev_iso_8859_9,
+  cptbl_rev_cp437,
+  cptbl_rev_cp850,
+  cptbl_rev_cp852,
+  cptbl_rev_cp855,
+  cptbl_rev_cp857,
+  cptbl_rev_cp860,
+  cptbl_rev_cp861,
+  cptbl_rev_cp863,
+  cptbl_rev_cp864,
+  cptbl_rev_cp865,
+  cptbl_rev_cp869,
+  cptbl_rev_cp932, /* original shiftjis */
+  cptbl_rev_macintosh,
+  cptbl_rev_big5,
+  cptbl_rev_cp949, /* 25 */
+  cptbl_rev_johab, /* 26 */
+  cptbl_rev_cp866,
+  cptbl_rev_windows_1250,
+  cptbl_rev_windows_1251, /* 29 */
+  cptbl_rev_windows_1252, /* 30 */
+  cptbl_rev_gb2312,
+  cptbl_rev_windows_1253,
+  cptbl_rev_windows_1254,
+  cptbl_rev_windows_1255,
+  cptbl_rev_windows_1256,
+  cptbl_rev_windows_1257,
+  cptbl_rev_windows_874,
+  cptbl_rev_windows_932, /* windows-31j */
+  cptbl_rev_windows_936,
+  cptbl_rev_windows_949,
+  cptbl_rev_windows_950,
+  cptbl_rev_windows_1361, /* 42 */
+  NULL, /* 43 UTF16 */
+  cptbl_rev_windows_1258,
+  NULL,
+};
+
 static const uint8_t *cp_alnumtbl[]
     = { NULL, // UTF8
         NULL, // US-ASCII
@@ -296,6 +346,14 @@ dwg_codepage_int (const char *s)
   return CP_UNDEFINED;
 }
 
+static int
+rev_cmp (const void *a, const void *b)
+{
+  return *(uint16_t *)a < *(uint16_t *)b   ? -1
+         : *(uint16_t *)a > *(uint16_t *)b ? 1
+                                           : 0;
+}
+
 /* helper to check if a codepoint exists in the codepage,
    and convert it to/from unicode.
    dir = 1: from unicode wc to charset
@@ -309,25 +367,25 @@ codepage_helper (const Dwg_Codepage codepage, const wchar_t wc, const int dir,
   uint16_t maxc;
   assert (codepage != CP_UTF8 && codepage != CP_UTF16
           && codepage != CP_US_ASCII && codepage != CP_ISO_8859_1);
-  fntbl = cp_fntbl[codepage];
-  maxc = fntbl[0];
-  assert (maxc);
   if (dir) // from unicode to charset.
-    {      // reverse lookup. unsorted rhs values so we cannot bsearch.
-      for (uint16_t i = 0x80; i < maxc; i++)
-        {
-          if (wc == fntbl[i])
-            return i;
-        }
-      return 0;
-    }
-  else
-    {
-      if (wc < maxc)
-        return fntbl[wc];
-      else
+    {      // bsearch the pairs of the reverse table.
+      const uint16_t *revtbl = cp_revtbl[codepage];
+      const uint16_t key = (uint16_t)wc;
+      const uint16_t *found;
+      assert (revtbl);
+      if (wc > 0xFFFF)
         return 0;
+      found = (const uint16_t *)bsearch (&key, &revtbl[1], revtbl[0],
+                                         2 * sizeof (uint16_t), rev_cmp);
+      return found ? found[1] : 0;
     }
+  fntbl = cp_fntbl[codepage];
+  maxc = fntbl[0]; // the last index
+  assert (maxc);
+  if (wc <= maxc)
+    return fntbl[wc];
+  else
+    return 0;
 }
 
 // returns the matching unicode codepoint,
@@ -405,6 +463,20 @@ dwg_codepage_isasian (const Dwg_Codepage cp)
     return false;
 }
 
+/* single-byte codepages with ASCII as is, converted by our tables as
+   iconv does. Not CP864 and CP932 with exceptions below 0x80 and
+   single-byte katakana, and not MACINTOSH with an older table. */
+bool
+dwg_codepage_is_simple (const Dwg_Codepage cp)
+{
+  if (cp == CP_US_ASCII || cp == CP_ISO_8859_1)
+    return true;
+  if (cp > CP_ANSI_1258 || !cp_fntbl[cp] || cp == CP_CP864
+      || cp == CP_CP932 || cp == CP_MACINTOSH)
+    return false;
+  return !dwg_codepage_isasian (cp);
+}
+
 static int
 b8_cmp (const void *a, const void *b)
 {
@@ -110,12 +110,15 @@ EXPORT wchar_t dwg_codepage_uwc (Dwg_Codepage cp, uint16_t c);
 // these old codepages use 2-byte chars for some 0x8* bytes, all others only
 // one byte.
 EXPORT bool dwg_codepage_isasian (const Dwg_Codepage cp);
+// single-byte codepages with ASCII as is, converted without iconv.
+EXPORT bool dwg_codepage_is_simple (const Dwg_Codepage cp);
 EXPORT bool dwg_codepage_is_twobyte (const Dwg_Codepage cp,
                                      const unsigned char c);
 EXPORT bool dwg_codepage_isalnum (const Dwg_Codepage cp, const wchar_t wc);
 #else
 extern wchar_t dwg_codepage_uwc (Dwg_Codepage cp, uint16_t c);
 extern bool dwg_codepage_isasian (const Dwg_Codepage cp);
+extern bool dwg_codepage_is_simple (const Dwg_Codepage cp);
 extern bool dwg_codepage_is_twobyte (const Dwg_Codepage cp,
                                      const unsigned char c);
 extern bool dwg_codepage_isalnum (const Dwg_Codepage cp, const wchar_t wc);
@@ -350,6 +350,139 @@ static const uint8_t cptbl_alnum_cp852[] = {
   0xfc,	// LATIN CAPITAL LETTER R WITH CARON
   0xfd,	// LATIN SMALL LETTER R WITH CARON
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_cp852[] = {
+  128,		// number of pairs
+  0x00a0, 0xff,
+  0x00a4, 0xcf,
+  0x00a7, 0xf5,
+  0x00a8, 0xf9,
+  0x00ab, 0xae,
+  0x00ac, 0xaa,
+  0x00ad, 0xf0,
+  0x00b0, 0xf8,
+  0x00b4, 0xef,
+  0x00b8, 0xf7,
+  0x00bb, 0xaf,
+  0x00c1, 0xb5,
+  0x00c2, 0xb6,
+  0x00c4, 0x8e,
+  0x00c7, 0x80,
+  0x00c9, 0x90,
+  0x00cb, 0xd3,
+  0x00cd, 0xd6,
+  0x00ce, 0xd7,
+  0x00d3, 0xe0,
+  0x00d4, 0xe2,
+  0x00d6, 0x99,
+  0x00d7, 0x9e,
+  0x00da, 0xe9,
+  0x00dc, 0x9a,
+  0x00dd, 0xed,
+  0x00df, 0xe1,
+  0x00e1, 0xa0,
+  0x00e2, 0x83,
+  0x00e4, 0x84,
+  0x00e7, 0x87,
+  0x00e9, 0x82,
+  0x00eb, 0x89,
+  0x00ed, 0xa1,
+  0x00ee, 0x8c,
+  0x00f3, 0xa2,
+  0x00f4, 0x93,
+  0x00f6, 0x94,
+  0x00f7, 0xf6,
+  0x00fa, 0xa3,
+  0x00fc, 0x81,
+  0x00fd, 0xec,
+  0x0102, 0xc6,
+  0x0103, 0xc7,
+  0x0104, 0xa4,
+  0x0105, 0xa5,
+  0x0106, 0x8f,
+  0x0107, 0x86,
+  0x010c, 0xac,
+  0x010d, 0x9f,
+  0x010e, 0xd2,
+  0x010f, 0xd4,
+  0x0110, 0xd1,
+  0x0111, 0xd0,
+  0x0118, 0xa8,
+  0x0119, 0xa9,
+  0x011a, 0xb7,
+  0x011b, 0xd8,
+  0x0139, 0x91,
+  0x013a, 0x92,
+  0x013d, 0x95,
+  0x013e, 0x96,
+  0x0141, 0x9d,
+  0x0142, 0x88,
+  0x0143, 0xe3,
+  0x0144, 0xe4,
+  0x0147, 0xd5,
+  0x0148, 0xe5,
+  0x0150, 0x8a,
+  0x0151, 0x8b,
+  0x0154, 0xe8,
+  0x0155, 0xea,
+  0x0158, 0xfc,
+  0x0159, 0xfd,
+  0x015a, 0x97,
+  0x015b, 0x98,
+  0x015e, 0xb8,
+  0x015f, 0xad,
+  0x0160, 0xe6,
+  0x0161, 0xe7,
+  0x0162, 0xdd,
+  0x0163, 0xee,
+  0x0164, 0x9b,
+  0x0165, 0x9c,
+  0x016e, 0xde,
+  0x016f, 0x85,
+  0x0170, 0xeb,
+  0x0171, 0xfb,
+  0x0179, 0x8d,
+  0x017a, 0xab,
+  0x017b, 0xbd,
+  0x017c, 0xbe,
+  0x017d, 0xa6,
+  0x017e, 0xa7,
+  0x02c7, 0xf3,
+  0x02d8, 0xf4,
+  0x02d9, 0xfa,
+  0x02db, 0xf2,
+  0x02dd, 0xf1,
+  0x2500, 0xc4,
+  0x2502, 0xb3,
+  0x250c, 0xda,
+  0x2510, 0xbf,
+  0x2514, 0xc0,
+  0x2518, 0xd9,
+  0x251c, 0xc3,
+  0x2524, 0xb4,
+  0x252c, 0xc2,
+  0x2534, 0xc1,
+  0x253c, 0xc5,
+  0x2550, 0xcd,
+  0x2551, 0xba,
+  0x2554, 0xc9,
+  0x2557, 0xbb,
+  0x255a, 0xc8,
+  0x255d, 0xbc,
+  0x2560, 0xcc,
+  0x2563, 0xb9,
+  0x2566, 0xcb,
+  0x2569, 0xca,
+  0x256c, 0xce,
+  0x2580, 0xdf,
+  0x2584, 0xdc,
+  0x2588, 0xdb,
+  0x2591, 0xb0,
+  0x2592, 0xb1,
+  0x2593, 0xb2,
+  0x25a0, 0xfe,
+};
 #define MIN_CP852	0
 #define MAX_CP852	255
 #define MIN_CP852_UC	0
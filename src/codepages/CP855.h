@@ -361,6 +361,139 @@ static const uint8_t cptbl_alnum_cp855[] = {
   0xfb,	// CYRILLIC SMALL LETTER CHE
   0xfc,	// CYRILLIC CAPITAL LETTER CHE
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_cp855[] = {
+  128,		// number of pairs
+  0x00a0, 0xff,
+  0x00a4, 0xcf,
+  0x00a7, 0xfd,
+  0x00ab, 0xae,
+  0x00ad, 0xf0,
+  0x00bb, 0xaf,
+  0x0401, 0x85,
+  0x0402, 0x81,
+  0x0403, 0x83,
+  0x0404, 0x87,
+  0x0405, 0x89,
+  0x0406, 0x8b,
+  0x0407, 0x8d,
+  0x0408, 0x8f,
+  0x0409, 0x91,
+  0x040a, 0x93,
+  0x040b, 0x95,
+  0x040c, 0x97,
+  0x040e, 0x99,
+  0x040f, 0x9b,
+  0x0410, 0xa1,
+  0x0411, 0xa3,
+  0x0412, 0xec,
+  0x0413, 0xad,
+  0x0414, 0xa7,
+  0x0415, 0xa9,
+  0x0416, 0xea,
+  0x0417, 0xf4,
+  0x0418, 0xb8,
+  0x0419, 0xbe,
+  0x041a, 0xc7,
+  0x041b, 0xd1,
+  0x041c, 0xd3,
+  0x041d, 0xd5,
+  0x041e, 0xd7,
+  0x041f, 0xdd,
+  0x0420, 0xe2,
+  0x0421, 0xe4,
+  0x0422, 0xe6,
+  0x0423, 0xe8,
+  0x0424, 0xab,
+  0x0425, 0xb6,
+  0x0426, 0xa5,
+  0x0427, 0xfc,
+  0x0428, 0xf6,
+  0x0429, 0xfa,
+  0x042a, 0x9f,
+  0x042b, 0xf2,
+  0x042c, 0xee,
+  0x042d, 0xf8,
+  0x042e, 0x9d,
+  0x042f, 0xe0,
+  0x0430, 0xa0,
+  0x0431, 0xa2,
+  0x0432, 0xeb,
+  0x0433, 0xac,
+  0x0434, 0xa6,
+  0x0435, 0xa8,
+  0x0436, 0xe9,
+  0x0437, 0xf3,
+  0x0438, 0xb7,
+  0x0439, 0xbd,
+  0x043a, 0xc6,
+  0x043b, 0xd0,
+  0x043c, 0xd2,
+  0x043d, 0xd4,
+  0x043e, 0xd6,
+  0x043f, 0xd8,
+  0x0440, 0xe1,
+  0x0441, 0xe3,
+  0x0442, 0xe5,
+  0x0443, 0xe7,
+  0x0444, 0xaa,
+  0x0445, 0xb5,
+  0x0446, 0xa4,
+  0x0447, 0xfb,
+  0x0448, 0xf5,
+  0x0449, 0xf9,
+  0x044a, 0x9e,
+  0x044b, 0xf1,
+  0x044c, 0xed,
+  0x044d, 0xf7,
+  0x044e, 0x9c,
+  0x044f, 0xde,
+  0x0451, 0x84,
+  0x0452, 0x80,
+  0x0453, 0x82,
+  0x0454, 0x86,
+  0x0455, 0x88,
+  0x0456, 0x8a,
+  0x0457, 0x8c,
+  0x0458, 0x8e,
+  0x0459, 0x90,
+  0x045a, 0x92,
+  0x045b, 0x94,
+  0x045c, 0x96,
+  0x045e, 0x98,
+  0x045f, 0x9a,
+  0x2116, 0xef,
+  0x2500, 0xc4,
+  0x2502, 0xb3,
+  0x250c, 0xda,
+  0x2510, 0xbf,
+  0x2514, 0xc0,
+  0x2518, 0xd9,
+  0x251c, 0xc3,
+  0x2524, 0xb4,
+  0x252c, 0xc2,
+  0x2534, 0xc1,
+  0x253c, 0xc5,
+  0x2550, 0xcd,
+  0x2551, 0xba,
+  0x2554, 0xc9,
+  0x2557, 0xbb,
+  0x255a, 0xc8,
+  0x255d, 0xbc,
+  0x2560, 0xcc,
+  0x2563, 0xb9,
+  0x2566, 0xcb,
+  0x2569, 0xca,
+  0x256c, 0xce,
+  0x2580, 0xdf,
+  0x2584, 0xdc,
+  0x2588, 0xdb,
+  0x2591, 0xb0,
+  0x2592, 0xb1,
+  0x2593, 0xb2,
+  0x25a0, 0xfe,
+};
 #define MIN_CP855	0
 #define MAX_CP855	255
 #define MIN_CP855_UC	0
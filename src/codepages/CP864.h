@@ -343,6 +343,133 @@ static const uint8_t cptbl_alnum_cp864[] = {
   0xfc,	// ARABIC LETTER KAF ISOLATED FORM
   0xfd,	// ARABIC LETTER YEH ISOLATED FORM
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_cp864[] = {
+  122,		// number of pairs
+  0x00a0, 0xa0,
+  0x00a2, 0xc0,
+  0x00a3, 0xa3,
+  0x00a4, 0xa4,
+  0x00a6, 0xdb,
+  0x00ab, 0x97,
+  0x00ac, 0xdc,
+  0x00ad, 0xa1,
+  0x00b0, 0x80,
+  0x00b1, 0x93,
+  0x00b7, 0x81,
+  0x00bb, 0x98,
+  0x00bc, 0x95,
+  0x00bd, 0x94,
+  0x00d7, 0xde,
+  0x00f7, 0xdd,
+  0x03b2, 0x90,
+  0x03c6, 0x92,
+  0x060c, 0xac,
+  0x061b, 0xbb,
+  0x061f, 0xbf,
+  0x0640, 0xe0,
+  0x0651, 0xf1,
+  0x0660, 0xb0,
+  0x0661, 0xb1,
+  0x0662, 0xb2,
+  0x0663, 0xb3,
+  0x0664, 0xb4,
+  0x0665, 0xb5,
+  0x0666, 0xb6,
+  0x0667, 0xb7,
+  0x0668, 0xb8,
+  0x0669, 0xb9,
+  0x2219, 0x82,
+  0x221a, 0x83,
+  0x221e, 0x91,
+  0x2248, 0x96,
+  0x2500, 0x85,
+  0x2502, 0x86,
+  0x250c, 0x8d,
+  0x2510, 0x8c,
+  0x2514, 0x8e,
+  0x2518, 0x8f,
+  0x251c, 0x8a,
+  0x2524, 0x88,
+  0x252c, 0x89,
+  0x2534, 0x8b,
+  0x253c, 0x87,
+  0x2592, 0x84,
+  0x25a0, 0xfe,
+  0xfe7d, 0xf0,
+  0xfe80, 0xc1,
+  0xfe81, 0xc2,
+  0xfe82, 0xa2,
+  0xfe83, 0xc3,
+  0xfe84, 0xa5,
+  0xfe85, 0xc4,
+  0xfe8b, 0xc6,
+  0xfe8d, 0xc7,
+  0xfe8e, 0xa8,
+  0xfe8f, 0xa9,
+  0xfe91, 0xc8,
+  0xfe93, 0xc9,
+  0xfe95, 0xaa,
+  0xfe97, 0xca,
+  0xfe99, 0xab,
+  0xfe9b, 0xcb,
+  0xfe9d, 0xad,
+  0xfe9f, 0xcc,
+  0xfea1, 0xae,
+  0xfea3, 0xcd,
+  0xfea5, 0xaf,
+  0xfea7, 0xce,
+  0xfea9, 0xcf,
+  0xfeab, 0xd0,
+  0xfead, 0xd1,
+  0xfeaf, 0xd2,
+  0xfeb1, 0xbc,
+  0xfeb3, 0xd3,
+  0xfeb5, 0xbd,
+  0xfeb7, 0xd4,
+  0xfeb9, 0xbe,
+  0xfebb, 0xd5,
+  0xfebd, 0xeb,
+  0xfebf, 0xd6,
+  0xfec1, 0xd7,
+  0xfec5, 0xd8,
+  0xfec9, 0xdf,
+  0xfeca, 0xc5,
+  0xfecb, 0xd9,
+  0xfecc, 0xec,
+  0xfecd, 0xee,
+  0xfece, 0xed,
+  0xfecf, 0xda,
+  0xfed0, 0xf7,
+  0xfed1, 0xba,
+  0xfed3, 0xe1,
+  0xfed5, 0xf8,
+  0xfed7, 0xe2,
+  0xfed9, 0xfc,
+  0xfedb, 0xe3,
+  0xfedd, 0xfb,
+  0xfedf, 0xe4,
+  0xfee1, 0xef,
+  0xfee3, 0xe5,
+  0xfee5, 0xf2,
+  0xfee7, 0xe6,
+  0xfee9, 0xf3,
+  0xfeeb, 0xe7,
+  0xfeec, 0xf4,
+  0xfeed, 0xe8,
+  0xfeef, 0xe9,
+  0xfef0, 0xf5,
+  0xfef1, 0xfd,
+  0xfef2, 0xf6,
+  0xfef3, 0xea,
+  0xfef5, 0xf9,
+  0xfef6, 0xfa,
+  0xfef7, 0x99,
+  0xfef8, 0x9a,
+  0xfefb, 0x9d,
+  0xfefc, 0x9e,
+};
 #define MIN_CP864	0
 #define MAX_CP864	254
 #define MIN_CP864_UC	0
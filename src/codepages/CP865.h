@@ -317,6 +317,139 @@ static const uint8_t cptbl_alnum_cp865[] = {
   0xee,	// GREEK SMALL LETTER EPSILON
   0xfc,	// SUPERSCRIPT LATIN SMALL LETTER N
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_cp865[] = {
+  128,		// number of pairs
+  0x00a0, 0xff,
+  0x00a1, 0xad,
+  0x00a3, 0x9c,
+  0x00a4, 0xaf,
+  0x00aa, 0xa6,
+  0x00ab, 0xae,
+  0x00ac, 0xaa,
+  0x00b0, 0xf8,
+  0x00b1, 0xf1,
+  0x00b2, 0xfd,
+  0x00b5, 0xe6,
+  0x00b7, 0xfa,
+  0x00ba, 0xa7,
+  0x00bc, 0xac,
+  0x00bd, 0xab,
+  0x00bf, 0xa8,
+  0x00c4, 0x8e,
+  0x00c5, 0x8f,
+  0x00c6, 0x92,
+  0x00c7, 0x80,
+  0x00c9, 0x90,
+  0x00d1, 0xa5,
+  0x00d6, 0x99,
+  0x00d8, 0x9d,
+  0x00dc, 0x9a,
+  0x00df, 0xe1,
+  0x00e0, 0x85,
+  0x00e1, 0xa0,
+  0x00e2, 0x83,
+  0x00e4, 0x84,
+  0x00e5, 0x86,
+  0x00e6, 0x91,
+  0x00e7, 0x87,
+  0x00e8, 0x8a,
+  0x00e9, 0x82,
+  0x00ea, 0x88,
+  0x00eb, 0x89,
+  0x00ec, 0x8d,
+  0x00ed, 0xa1,
+  0x00ee, 0x8c,
+  0x00ef, 0x8b,
+  0x00f1, 0xa4,
+  0x00f2, 0x95,
+  0x00f3, 0xa2,
+  0x00f4, 0x93,
+  0x00f6, 0x94,
+  0x00f7, 0xf6,
+  0x00f8, 0x9b,
+  0x00f9, 0x97,
+  0x00fa, 0xa3,
+  0x00fb, 0x96,
+  0x00fc, 0x81,
+  0x00ff, 0x98,
+  0x0192, 0x9f,
+  0x0393, 0xe2,
+  0x0398, 0xe9,
+  0x03a3, 0xe4,
+  0x03a6, 0xe8,
+  0x03a9, 0xea,
+  0x03b1, 0xe0,
+  0x03b4, 0xeb,
+  0x03b5, 0xee,
+  0x03c0, 0xe3,
+  0x03c3, 0xe5,
+  0x03c4, 0xe7,
+  0x03c6, 0xed,
+  0x207f, 0xfc,
+  0x20a7, 0x9e,
+  0x2219, 0xf9,
+  0x221a, 0xfb,
+  0x221e, 0xec,
+  0x2229, 0xef,
+  0x2248, 0xf7,
+  0x2261, 0xf0,
+  0x2264, 0xf3,
+  0x2265, 0xf2,
+  0x2310, 0xa9,
+  0x2320, 0xf4,
+  0x2321, 0xf5,
+  0x2500, 0xc4,
+  0x2502, 0xb3,
+  0x250c, 0xda,
+  0x2510, 0xbf,
+  0x2514, 0xc0,
+  0x2518, 0xd9,
+  0x251c, 0xc3,
+  0x2524, 0xb4,
+  0x252c, 0xc2,
+  0x2534, 0xc1,
+  0x253c, 0xc5,
+  0x2550, 0xcd,
+  0x2551, 0xba,
+  0x2552, 0xd5,
+  0x2553, 0xd6,
+  0x2554, 0xc9,
+  0x2555, 0xb8,
+  0x2556, 0xb7,
+  0x2557, 0xbb,
+  0x2558, 0xd4,
+  0x2559, 0xd3,
+  0x255a, 0xc8,
+  0x255b, 0xbe,
+  0x255c, 0xbd,
+  0x255d, 0xbc,
+  0x255e, 0xc6,
+  0x255f, 0xc7,
+  0x2560, 0xcc,
+  0x2561, 0xb5,
+  0x2562, 0xb6,
+  0x2563, 0xb9,
+  0x2564, 0xd1,
+  0x2565, 0xd2,
+  0x2566, 0xcb,
+  0x2567, 0xcf,
+  0x2568, 0xd0,
+  0x2569, 0xca,
+  0x256a, 0xd8,
+  0x256b, 0xd7,
+  0x256c, 0xce,
+  0x2580, 0xdf,
+  0x2584, 0xdc,
+  0x2588, 0xdb,
+  0x258c, 0xdd,
+  0x2590, 0xde,
+  0x2591, 0xb0,
+  0x2592, 0xb1,
+  0x2593, 0xb2,
+  0x25a0, 0xfe,
+};
 #define MIN_CP865	0
 #define MAX_CP865	255
 #define MIN_CP865_UC	0
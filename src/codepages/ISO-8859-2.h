@@ -350,6 +350,139 @@ static const uint8_t cptbl_alnum_iso_8859_2[] = {
   0xFD,	// 	LATIN SMALL LETTER Y WITH ACUTE
   0xFE,	// 	LATIN SMALL LETTER T WITH CEDILLA
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_iso_8859_2[] = {
+  128,		// number of pairs
+  0x0080, 0x80,
+  0x0081, 0x81,
+  0x0082, 0x82,
+  0x0083, 0x83,
+  0x0084, 0x84,
+  0x0085, 0x85,
+  0x0086, 0x86,
+  0x0087, 0x87,
+  0x0088, 0x88,
+  0x0089, 0x89,
+  0x008a, 0x8a,
+  0x008b, 0x8b,
+  0x008c, 0x8c,
+  0x008d, 0x8d,
+  0x008e, 0x8e,
+  0x008f, 0x8f,
+  0x0090, 0x90,
+  0x0091, 0x91,
+  0x0092, 0x92,
+  0x0093, 0x93,
+  0x0094, 0x94,
+  0x0095, 0x95,
+  0x0096, 0x96,
+  0x0097, 0x97,
+  0x0098, 0x98,
+  0x0099, 0x99,
+  0x009a, 0x9a,
+  0x009b, 0x9b,
+  0x009c, 0x9c,
+  0x009d, 0x9d,
+  0x009e, 0x9e,
+  0x009f, 0x9f,
+  0x00a0, 0xa0,
+  0x00a4, 0xa4,
+  0x00a7, 0xa7,
+  0x00a8, 0xa8,
+  0x00ad, 0xad,
+  0x00b0, 0xb0,
+  0x00b4, 0xb4,
+  0x00b8, 0xb8,
+  0x00c1, 0xc1,
+  0x00c2, 0xc2,
+  0x00c4, 0xc4,
+  0x00c7, 0xc7,
+  0x00c9, 0xc9,
+  0x00cb, 0xcb,
+  0x00cd, 0xcd,
+  0x00ce, 0xce,
+  0x00d3, 0xd3,
+  0x00d4, 0xd4,
+  0x00d6, 0xd6,
+  0x00d7, 0xd7,
+  0x00da, 0xda,
+  0x00dc, 0xdc,
+  0x00dd, 0xdd,
+  0x00df, 0xdf,
+  0x00e1, 0xe1,
+  0x00e2, 0xe2,
+  0x00e4, 0xe4,
+  0x00e7, 0xe7,
+  0x00e9, 0xe9,
+  0x00eb, 0xeb,
+  0x00ed, 0xed,
+  0x00ee, 0xee,
+  0x00f3, 0xf3,
+  0x00f4, 0xf4,
+  0x00f6, 0xf6,
+  0x00f7, 0xf7,
+  0x00fa, 0xfa,
+  0x00fc, 0xfc,
+  0x00fd, 0xfd,
+  0x0102, 0xc3,
+  0x0103, 0xe3,
+  0x0104, 0xa1,
+  0x0105, 0xb1,
+  0x0106, 0xc6,
+  0x0107, 0xe6,
+  0x010c, 0xc8,
+  0x010d, 0xe8,
+  0x010e, 0xcf,
+  0x010f, 0xef,
+  0x0110, 0xd0,
+  0x0111, 0xf0,
+  0x0118, 0xca,
+  0x0119, 0xea,
+  0x011a, 0xcc,
+  0x011b, 0xec,
+  0x0139, 0xc5,
+  0x013a, 0xe5,
+  0x013d, 0xa5,
+  0x013e, 0xb5,
+  0x0141, 0xa3,
+  0x0142, 0xb3,
+  0x0143, 0xd1,
+  0x0144, 0xf1,
+  0x0147, 0xd2,
+  0x0148, 0xf2,
+  0x0150, 0xd5,
+  0x0151, 0xf5,
+  0x0154, 0xc0,
+  0x0155, 0xe0,
+  0x0158, 0xd8,
+  0x0159, 0xf8,
+  0x015a, 0xa6,
+  0x015b, 0xb6,
+  0x015e, 0xaa,
+  0x015f, 0xba,
+  0x0160, 0xa9,
+  0x0161, 0xb9,
+  0x0162, 0xde,
+  0x0163, 0xfe,
+  0x0164, 0xab,
+  0x0165, 0xbb,
+  0x016e, 0xd9,
+  0x016f, 0xf9,
+  0x0170, 0xdb,
+  0x0171, 0xfb,
+  0x0179, 0xac,
+  0x017a, 0xbc,
+  0x017b, 0xaf,
+  0x017c, 0xbf,
+  0x017d, 0xae,
+  0x017e, 0xbe,
+  0x02c7, 0xb7,
+  0x02d8, 0xa2,
+  0x02d9, 0xff,
+  0x02db, 0xb2,
+  0x02dd, 0xbd,
+};
 #define MIN_ISO_8859_2	0
 #define MAX_ISO_8859_2	255
 #define MIN_ISO_8859_2_UC	0
@@ -361,6 +361,139 @@ static const uint8_t cptbl_alnum_iso_8859_5[] = {
   0xFE,	// 	CYRILLIC SMALL LETTER SHORT U
   0xFF,	// 	CYRILLIC SMALL LETTER DZHE
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_iso_8859_5[] = {
+  128,		// number of pairs
+  0x0080, 0x80,
+  0x0081, 0x81,
+  0x0082, 0x82,
+  0x0083, 0x83,
+  0x0084, 0x84,
+  0x0085, 0x85,
+  0x0086, 0x86,
+  0x0087, 0x87,
+  0x0088, 0x88,
+  0x0089, 0x89,
+  0x008a, 0x8a,
+  0x008b, 0x8b,
+  0x008c, 0x8c,
+  0x008d, 0x8d,
+  0x008e, 0x8e,
+  0x008f, 0x8f,
+  0x0090, 0x90,
+  0x0091, 0x91,
+  0x0092, 0x92,
+  0x0093, 0x93,
+  0x0094, 0x94,
+  0x0095, 0x95,
+  0x0096, 0x96,
+  0x0097, 0x97,
+  0x0098, 0x98,
+  0x0099, 0x99,
+  0x009a, 0x9a,
+  0x009b, 0x9b,
+  0x009c, 0x9c,
+  0x009d, 0x9d,
+  0x009e, 0x9e,
+  0x009f, 0x9f,
+  0x00a0, 0xa0,
+  0x00a7, 0xfd,
+  0x00ad, 0xad,
+  0x0401, 0xa1,
+  0x0402, 0xa2,
+  0x0403, 0xa3,
+  0x0404, 0xa4,
+  0x0405, 0xa5,
+  0x0406, 0xa6,
+  0x0407, 0xa7,
+  0x0408, 0xa8,
+  0x0409, 0xa9,
+  0x040a, 0xaa,
+  0x040b, 0xab,
+  0x040c, 0xac,
+  0x040e, 0xae,
+  0x040f, 0xaf,
+  0x0410, 0xb0,
+  0x0411, 0xb1,
+  0x0412, 0xb2,
+  0x0413, 0xb3,
+  0x0414, 0xb4,
+  0x0415, 0xb5,
+  0x0416, 0xb6,
+  0x0417, 0xb7,
+  0x0418, 0xb8,
+  0x0419, 0xb9,
+  0x041a, 0xba,
+  0x041b, 0xbb,
+  0x041c, 0xbc,
+  0x041d, 0xbd,
+  0x041e, 0xbe,
+  0x041f, 0xbf,
+  0x0420, 0xc0,
+  0x0421, 0xc1,
+  0x0422, 0xc2,
+  0x0423, 0xc3,
+  0x0424, 0xc4,
+  0x0425, 0xc5,
+  0x0426, 0xc6,
+  0x0427, 0xc7,
+  0x0428, 0xc8,
+  0x0429, 0xc9,
+  0x042a, 0xca,
+  0x042b, 0xcb,
+  0x042c, 0xcc,
+  0x042d, 0xcd,
+  0x042e, 0xce,
+  0x042f, 0xcf,
+  0x0430, 0xd0,
+  0x0431, 0xd1,
+  0x0432, 0xd2,
+  0x0433, 0xd3,
+  0x0434, 0xd4,
+  0x0435, 0xd5,
+  0x0436, 0xd6,
+  0x0437, 0xd7,
+  0x0438, 0xd8,
+  0x0439, 0xd9,
+  0x043a, 0xda,
+  0x043b, 0xdb,
+  0x043c, 0xdc,
+  0x043d, 0xdd,
+  0x043e, 0xde,
+  0x043f, 0xdf,
+  0x0440, 0xe0,
+  0x0441, 0xe1,
+  0x0442, 0xe2,
+  0x0443, 0xe3,
+  0x0444, 0xe4,
+  0x0445, 0xe5,
+  0x0446, 0xe6,
+  0x0447, 0xe7,
+  0x0448, 0xe8,
+  0x0449, 0xe9,
+  0x044a, 0xea,
+  0x044b, 0xeb,
+  0x044c, 0xec,
+  0x044d, 0xed,
+  0x044e, 0xee,
+  0x044f, 0xef,
+  0x0451, 0xf1,
+  0x0452, 0xf2,
+  0x0453, 0xf3,
+  0x0454, 0xf4,
+  0x0455, 0xf5,
+  0x0456, 0xf6,
+  0x0457, 0xf7,
+  0x0458, 0xf8,
+  0x0459, 0xf9,
+  0x045a, 0xfa,
+  0x045b, 0xfb,
+  0x045c, 0xfc,
+  0x045e, 0xfe,
+  0x045f, 0xff,
+  0x2116, 0xf0,
+};
 #define MIN_ISO_8859_5	0
 #define MAX_ISO_8859_5	255
 #define MIN_ISO_8859_5_UC	0
@@ -292,6 +292,94 @@ static const uint8_t cptbl_alnum_iso_8859_6[] = {
   0xE9,	// 	ARABIC LETTER ALEF MAKSURA
   0xEA,	// 	ARABIC LETTER YEH
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_iso_8859_6[] = {
+  83,		// number of pairs
+  0x0080, 0x80,
+  0x0081, 0x81,
+  0x0082, 0x82,
+  0x0083, 0x83,
+  0x0084, 0x84,
+  0x0085, 0x85,
+  0x0086, 0x86,
+  0x0087, 0x87,
+  0x0088, 0x88,
+  0x0089, 0x89,
+  0x008a, 0x8a,
+  0x008b, 0x8b,
+  0x008c, 0x8c,
+  0x008d, 0x8d,
+  0x008e, 0x8e,
+  0x008f, 0x8f,
+  0x0090, 0x90,
+  0x0091, 0x91,
+  0x0092, 0x92,
+  0x0093, 0x93,
+  0x0094, 0x94,
+  0x0095, 0x95,
+  0x0096, 0x96,
+  0x0097, 0x97,
+  0x0098, 0x98,
+  0x0099, 0x99,
+  0x009a, 0x9a,
+  0x009b, 0x9b,
+  0x009c, 0x9c,
+  0x009d, 0x9d,
+  0x009e, 0x9e,
+  0x009f, 0x9f,
+  0x00a0, 0xa0,
+  0x00a4, 0xa4,
+  0x00ad, 0xad,
+  0x060c, 0xac,
+  0x061b, 0xbb,
+  0x061f, 0xbf,
+  0x0621, 0xc1,
+  0x0622, 0xc2,
+  0x0623, 0xc3,
+  0x0624, 0xc4,
+  0x0625, 0xc5,
+  0x0626, 0xc6,
+  0x0627, 0xc7,
+  0x0628, 0xc8,
+  0x0629, 0xc9,
+  0x062a, 0xca,
+  0x062b, 0xcb,
+  0x062c, 0xcc,
+  0x062d, 0xcd,
+  0x062e, 0xce,
+  0x062f, 0xcf,
+  0x0630, 0xd0,
+  0x0631, 0xd1,
+  0x0632, 0xd2,
+  0x0633, 0xd3,
+  0x0634, 0xd4,
+  0x0635, 0xd5,
+  0x0636, 0xd6,
+  0x0637, 0xd7,
+  0x0638, 0xd8,
+  0x0639, 0xd9,
+  0x063a, 0xda,
+  0x0640, 0xe0,
+  0x0641, 0xe1,
+  0x0642, 0xe2,
+  0x0643, 0xe3,
+  0x0644, 0xe4,
+  0x0645, 0xe5,
+  0x0646, 0xe6,
+  0x0647, 0xe7,
+  0x0648, 0xe8,
+  0x0649, 0xe9,
+  0x064a, 0xea,
+  0x064b, 0xeb,
+  0x064c, 0xec,
+  0x064d, 0xed,
+  0x064e, 0xee,
+  0x064f, 0xef,
+  0x0650, 0xf0,
+  0x0651, 0xf1,
+  0x0652, 0xf2,
+};
 #define MIN_ISO_8859_6	0
 #define MAX_ISO_8859_6	242
 #define MIN_ISO_8859_6_UC	0
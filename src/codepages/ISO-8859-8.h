@@ -295,6 +295,103 @@ static const uint8_t cptbl_alnum_iso_8859_8[] = {
   0xF9,	// 	HEBREW LETTER SHIN
   0xFA,	// 	HEBREW LETTER TAV
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_iso_8859_8[] = {
+  92,		// number of pairs
+  0x0080, 0x80,
+  0x0081, 0x81,
+  0x0082, 0x82,
+  0x0083, 0x83,
+  0x0084, 0x84,
+  0x0085, 0x85,
+  0x0086, 0x86,
+  0x0087, 0x87,
+  0x0088, 0x88,
+  0x0089, 0x89,
+  0x008a, 0x8a,
+  0x008b, 0x8b,
+  0x008c, 0x8c,
+  0x008d, 0x8d,
+  0x008e, 0x8e,
+  0x008f, 0x8f,
+  0x0090, 0x90,
+  0x0091, 0x91,
+  0x0092, 0x92,
+  0x0093, 0x93,
+  0x0094, 0x94,
+  0x0095, 0x95,
+  0x0096, 0x96,
+  0x0097, 0x97,
+  0x0098, 0x98,
+  0x0099, 0x99,
+  0x009a, 0x9a,
+  0x009b, 0x9b,
+  0x009c, 0x9c,
+  0x009d, 0x9d,
+  0x009e, 0x9e,
+  0x009f, 0x9f,
+  0x00a0, 0xa0,
+  0x00a2, 0xa2,
+  0x00a3, 0xa3,
+  0x00a4, 0xa4,
+  0x00a5, 0xa5,
+  0x00a6, 0xa6,
+  0x00a7, 0xa7,
+  0x00a8, 0xa8,
+  0x00a9, 0xa9,
+  0x00ab, 0xab,
+  0x00ac, 0xac,
+  0x00ad, 0xad,
+  0x00ae, 0xae,
+  0x00af, 0xaf,
+  0x00b0, 0xb0,
+  0x00b1, 0xb1,
+  0x00b2, 0xb2,
+  0x00b3, 0xb3,
+  0x00b4, 0xb4,
+  0x00b5, 0xb5,
+  0x00b6, 0xb6,
+  0x00b7, 0xb7,
+  0x00b8, 0xb8,
+  0x00b9, 0xb9,
+  0x00bb, 0xbb,
+  0x00bc, 0xbc,
+  0x00bd, 0xbd,
+  0x00be, 0xbe,
+  0x00d7, 0xaa,
+  0x00f7, 0xba,
+  0x05d0, 0xe0,
+  0x05d1, 0xe1,
+  0x05d2, 0xe2,
+  0x05d3, 0xe3,
+  0x05d4, 0xe4,
+  0x05d5, 0xe5,
+  0x05d6, 0xe6,
+  0x05d7, 0xe7,
+  0x05d8, 0xe8,
+  0x05d9, 0xe9,
+  0x05da, 0xea,
+  0x05db, 0xeb,
+  0x05dc, 0xec,
+  0x05dd, 0xed,
+  0x05de, 0xee,
+  0x05df, 0xef,
+  0x05e0, 0xf0,
+  0x05e1, 0xf1,
+  0x05e2, 0xf2,
+  0x05e3, 0xf3,
+  0x05e4, 0xf4,
+  0x05e5, 0xf5,
+  0x05e6, 0xf6,
+  0x05e7, 0xf7,
+  0x05e8, 0xf8,
+  0x05e9, 0xf9,
+  0x05ea, 0xfa,
+  0x200e, 0xfd,
+  0x200f, 0xfe,
+  0x2017, 0xdf,
+};
 #define MIN_ISO_8859_8	0
 #define MAX_ISO_8859_8	254
 #define MIN_ISO_8859_8_UC	0
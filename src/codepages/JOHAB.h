@@ -64543,6 +64543,17057 @@ static const uint16_t cptbl_alnum_johab[] = {
   0xDEF0,	//   # CYRILLIC SMALL LETTER YU
   0xDEF1,	//   # CYRILLIC SMALL LETTER YA
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_johab[] = {
+  17046,		// number of pairs
+  0x00a1, 0xd9ae,
+  0x00a4, 0xd9b4,
+  0x00a7, 0xd967,
+  0x00a8, 0xd937,
+  0x00aa, 0xdca3,
+  0x00ad, 0xd939,
+  0x00b0, 0xd956,
+  0x00b1, 0xd94e,
+  0x00b2, 0xdd99,
+  0x00b3, 0xdd9a,
+  0x00b4, 0xd9a5,
+  0x00b6, 0xd9d2,
+  0x00b7, 0xd934,
+  0x00b8, 0xd9ac,
+  0x00b9, 0xdd98,
+  0x00ba, 0xdcac,
+  0x00bc, 0xdcf9,
+  0x00bd, 0xdcf6,
+  0x00be, 0xdcfa,
+  0x00bf, 0xd9af,
+  0x00c6, 0xdca1,
+  0x00d0, 0xdca2,
+  0x00d7, 0xd94f,
+  0x00d8, 0xdcaa,
+  0x00de, 0xdcad,
+  0x00df, 0xdd3c,
+  0x00e6, 0xdd31,
+  0x00f0, 0xdd33,
+  0x00f7, 0xd950,
+  0x00f8, 0xdd3a,
+  0x00fe, 0xdd3d,
+  0x0111, 0xdd32,
+  0x0126, 0xdca4,
+  0x0127, 0xdd34,
+  0x0131, 0xdd35,
+  0x0132, 0xdca6,
+  0x0133, 0xdd36,
+  0x0138, 0xdd37,
+  0x013f, 0xdca8,
+  0x0140, 0xdd38,
+  0x0141, 0xdca9,
+  0x0142, 0xdd39,
+  0x0149, 0xdd40,
+  0x014a, 0xdcaf,
+  0x014b, 0xdd3f,
+  0x0152, 0xdcab,
+  0x0153, 0xdd3b,
+  0x0166, 0xdcae,
+  0x0167, 0xdd3e,
+  0x02c7, 0xd9a7,
+  0x02d0, 0xd9b0,
+  0x02d8, 0xd9a8,
+  0x02d9, 0xd9ab,
+  0x02da, 0xd9aa,
+  0x02db, 0xd9ad,
+  0x02dd, 0xd9a9,
+  0x0391, 0xdb51,
+  0x0392, 0xdb52,
+  0x0393, 0xdb53,
+  0x0394, 0xdb54,
+  0x0395, 0xdb55,
+  0x0396, 0xdb56,
+  0x0397, 0xdb57,
+  0x0398, 0xdb58,
+  0x0399, 0xdb59,
+  0x039a, 0xdb5a,
+  0x039b, 0xdb5b,
+  0x039c, 0xdb5c,
+  0x039d, 0xdb5d,
+  0x039e, 0xdb5e,
+  0x039f, 0xdb5f,
+  0x03a0, 0xdb60,
+  0x03a1, 0xdb61,
+  0x03a3, 0xdb62,
+  0x03a4, 0xdb63,
+  0x03a5, 0xdb64,
+  0x03a6, 0xdb65,
+  0x03a7, 0xdb66,
+  0x03a8, 0xdb67,
+  0x03a9, 0xdb68,
+  0x03b1, 0xdb71,
+  0x03b2, 0xdb72,
+  0x03b3, 0xdb73,
+  0x03b4, 0xdb74,
+  0x03b5, 0xdb75,
+  0x03b6, 0xdb76,
+  0x03b7, 0xdb77,
+  0x03b8, 0xdb78,
+  0x03b9, 0xdb79,
+  0x03ba, 0xdb7a,
+  0x03bb, 0xdb7b,
+  0x03bc, 0xdb7c,
+  0x03bd, 0xdb7d,
+  0x03be, 0xdb7e,
+  0x03bf, 0xdb91,
+  0x03c0, 0xdb92,
+  0x03c1, 0xdb93,
+  0x03c3, 0xdb94,
+  0x03c4, 0xdb95,
+  0x03c5, 0xdb96,
+  0x03c6, 0xdb97,
+  0x03c7, 0xdb98,
+  0x03c8, 0xdb99,
+  0x03c9, 0xdb9a,
+  0x0401, 0xdea7,
+  0x0410, 0xdea1,
+  0x0411, 0xdea2,
+  0x0412, 0xdea3,
+  0x0413, 0xdea4,
+  0x0414, 0xdea5,
+  0x0415, 0xdea6,
+  0x0416, 0xdea8,
+  0x0417, 0xdea9,
+  0x0418, 0xdeaa,
+  0x0419, 0xdeab,
+  0x041a, 0xdeac,
+  0x041b, 0xdead,
+  0x041c, 0xdeae,
+  0x041d, 0xdeaf,
+  0x041e, 0xdeb0,
+  0x041f, 0xdeb1,
+  0x0420, 0xdeb2,
+  0x0421, 0xdeb3,
+  0x0422, 0xdeb4,
+  0x0423, 0xdeb5,
+  0x0424, 0xdeb6,
+  0x0425, 0xdeb7,
+  0x0426, 0xdeb8,
+  0x0427, 0xdeb9,
+  0x0428, 0xdeba,
+  0x0429, 0xdebb,
+  0x042a, 0xdebc,
+  0x042b, 0xdebd,
+  0x042c, 0xdebe,
+  0x042d, 0xdebf,
+  0x042e, 0xdec0,
+  0x042f, 0xdec1,
+  0x0430, 0xded1,
+  0x0431, 0xded2,
+  0x0432, 0xded3,
+  0x0433, 0xded4,
+  0x0434, 0xded5,
+  0x0435, 0xded6,
+  0x0436, 0xded8,
+  0x0437, 0xded9,
+  0x0438, 0xdeda,
+  0x0439, 0xdedb,
+  0x043a, 0xdedc,
+  0x043b, 0xdedd,
+  0x043c, 0xdede,
+  0x043d, 0xdedf,
+  0x043e, 0xdee0,
+  0x043f, 0xdee1,
+  0x0440, 0xdee2,
+  0x0441, 0xdee3,
+  0x0442, 0xdee4,
+  0x0443, 0xdee5,
+  0x0444, 0xdee6,
+  0x0445, 0xdee7,
+  0x0446, 0xdee8,
+  0x0447, 0xdee9,
+  0x0448, 0xdeea,
+  0x0449, 0xdeeb,
+  0x044a, 0xdeec,
+  0x044b, 0xdeed,
+  0x044c, 0xdeee,
+  0x044d, 0xdeef,
+  0x044e, 0xdef0,
+  0x044f, 0xdef1,
+  0x0451, 0xded7,
+  0x2015, 0xd93a,
+  0x2018, 0xd93e,
+  0x2019, 0xd93f,
+  0x201c, 0xd940,
+  0x201d, 0xd941,
+  0x2020, 0xd9d3,
+  0x2021, 0xd9d4,
+  0x2025, 0xd935,
+  0x2026, 0xd936,
+  0x2030, 0xd9b6,
+  0x2032, 0xd957,
+  0x2033, 0xd958,
+  0x203b, 0xd968,
+  0x2074, 0xdd9b,
+  0x207f, 0xdd9c,
+  0x2081, 0xdd9d,
+  0x2082, 0xdd9e,
+  0x2083, 0xdd9f,
+  0x2084, 0xdda0,
+  0x2103, 0xd959,
+  0x2109, 0xd9b5,
+  0x2113, 0xdc34,
+  0x2116, 0xd9e0,
+  0x2121, 0xd9e5,
+  0x2122, 0xd9e2,
+  0x2126, 0xdc69,
+  0x212b, 0xd95a,
+  0x2153, 0xdcf7,
+  0x2154, 0xdcf8,
+  0x215b, 0xdcfb,
+  0x215c, 0xdcfc,
+  0x215d, 0xdcfd,
+  0x215e, 0xdcfe,
+  0x2160, 0xdb40,
+  0x2161, 0xdb41,
+  0x2162, 0xdb42,
+  0x2163, 0xdb43,
+  0x2164, 0xdb44,
+  0x2165, 0xdb45,
+  0x2166, 0xdb46,
+  0x2167, 0xdb47,
+  0x2168, 0xdb48,
+  0x2169, 0xdb49,
+  0x2170, 0xdb31,
+  0x2171, 0xdb32,
+  0x2172, 0xdb33,
+  0x2173, 0xdb34,
+  0x2174, 0xdb35,
+  0x2175, 0xdb36,
+  0x2176, 0xdb37,
+  0x2177, 0xdb38,
+  0x2178, 0xdb39,
+  0x2179, 0xdb3a,
+  0x2190, 0xd977,
+  0x2191, 0xd978,
+  0x2192, 0xd976,
+  0x2193, 0xd979,
+  0x2194, 0xd97a,
+  0x2195, 0xd9d5,
+  0x2196, 0xd9d8,
+  0x2197, 0xd9d6,
+  0x2198, 0xd9d9,
+  0x2199, 0xd9d7,
+  0x21d2, 0xd9a1,
+  0x21d4, 0xd9a2,
+  0x2200, 0xd9a3,
+  0x2202, 0xd963,
+  0x2203, 0xd9a4,
+  0x2207, 0xd964,
+  0x2208, 0xd996,
+  0x220b, 0xd997,
+  0x220f, 0xd9b3,
+  0x2211, 0xd9b2,
+  0x221a, 0xd97e,
+  0x221d, 0xd992,
+  0x221e, 0xd954,
+  0x2220, 0xd960,
+  0x2225, 0xd93b,
+  0x2227, 0xd99e,
+  0x2228, 0xd99f,
+  0x2229, 0xd99d,
+  0x222a, 0xd99c,
+  0x222b, 0xd994,
+  0x222c, 0xd995,
+  0x222e, 0xd9b1,
+  0x2234, 0xd955,
+  0x2235, 0xd993,
+  0x223c, 0xd93d,
+  0x223d, 0xd991,
+  0x2252, 0xd966,
+  0x2260, 0xd951,
+  0x2261, 0xd965,
+  0x2264, 0xd952,
+  0x2265, 0xd953,
+  0x226a, 0xd97c,
+  0x226b, 0xd97d,
+  0x2282, 0xd99a,
+  0x2283, 0xd99b,
+  0x2286, 0xd998,
+  0x2287, 0xd999,
+  0x2299, 0xd9c1,
+  0x22a5, 0xd961,
+  0x2312, 0xd962,
+  0x2460, 0xdce7,
+  0x2461, 0xdce8,
+  0x2462, 0xdce9,
+  0x2463, 0xdcea,
+  0x2464, 0xdceb,
+  0x2465, 0xdcec,
+  0x2466, 0xdced,
+  0x2467, 0xdcee,
+  0x2468, 0xdcef,
+  0x2469, 0xdcf0,
+  0x246a, 0xdcf1,
+  0x246b, 0xdcf2,
+  0x246c, 0xdcf3,
+  0x246d, 0xdcf4,
+  0x246e, 0xdcf5,
+  0x2474, 0xdd77,
+  0x2475, 0xdd78,
+  0x2476, 0xdd79,
+  0x2477, 0xdd7a,
+  0x2478, 0xdd7b,
+  0x2479, 0xdd7c,
+  0x247a, 0xdd7d,
+  0x247b, 0xdd7e,
+  0x247c, 0xdd91,
+  0x247d, 0xdd92,
+  0x247e, 0xdd93,
+  0x247f, 0xdd94,
+  0x2480, 0xdd95,
+  0x2481, 0xdd96,
+  0x2482, 0xdd97,
+  0x249c, 0xdd5d,
+  0x249d, 0xdd5e,
+  0x249e, 0xdd5f,
+  0x249f, 0xdd60,
+  0x24a0, 0xdd61,
+  0x24a1, 0xdd62,
+  0x24a2, 0xdd63,
+  0x24a3, 0xdd64,
+  0x24a4, 0xdd65,
+  0x24a5, 0xdd66,
+  0x24a6, 0xdd67,
+  0x24a7, 0xdd68,
+  0x24a8, 0xdd69,
+  0x24a9, 0xdd6a,
+  0x24aa, 0xdd6b,
+  0x24ab, 0xdd6c,
+  0x24ac, 0xdd6d,
+  0x24ad, 0xdd6e,
+  0x24ae, 0xdd6f,
+  0x24af, 0xdd70,
+  0x24b0, 0xdd71,
+  0x24b1, 0xdd72,
+  0x24b2, 0xdd73,
+  0x24b3, 0xdd74,
+  0x24b4, 0xdd75,
+  0x24b5, 0xdd76,
+  0x24d0, 0xdccd,
+  0x24d1, 0xdcce,
+  0x24d2, 0xdccf,
+  0x24d3, 0xdcd0,
+  0x24d4, 0xdcd1,
+  0x24d5, 0xdcd2,
+  0x24d6, 0xdcd3,
+  0x24d7, 0xdcd4,
+  0x24d8, 0xdcd5,
+  0x24d9, 0xdcd6,
+  0x24da, 0xdcd7,
+  0x24db, 0xdcd8,
+  0x24dc, 0xdcd9,
+  0x24dd, 0xdcda,
+  0x24de, 0xdcdb,
+  0x24df, 0xdcdc,
+  0x24e0, 0xdcdd,
+  0x24e1, 0xdcde,
+  0x24e2, 0xdcdf,
+  0x24e3, 0xdce0,
+  0x24e4, 0xdce1,
+  0x24e5, 0xdce2,
+  0x24e6, 0xdce3,
+  0x24e7, 0xdce4,
+  0x24e8, 0xdce5,
+  0x24e9, 0xdce6,
+  0x2500, 0xdba1,
+  0x2501, 0xdbac,
+  0x2502, 0xdba2,
+  0x2503, 0xdbad,
+  0x250c, 0xdba3,
+  0x250d, 0xdbc8,
+  0x250e, 0xdbc7,
+  0x250f, 0xdbae,
+  0x2510, 0xdba4,
+  0x2511, 0xdbc2,
+  0x2512, 0xdbc1,
+  0x2513, 0xdbaf,
+  0x2514, 0xdba6,
+  0x2515, 0xdbc6,
+  0x2516, 0xdbc5,
+  0x2517, 0xdbb1,
+  0x2518, 0xdba5,
+  0x2519, 0xdbc4,
+  0x251a, 0xdbc3,
+  0x251b, 0xdbb0,
+  0x251c, 0xdba7,
+  0x251d, 0xdbbc,
+  0x251e, 0xdbc9,
+  0x251f, 0xdbca,
+  0x2520, 0xdbb7,
+  0x2521, 0xdbcb,
+  0x2522, 0xdbcc,
+  0x2523, 0xdbb2,
+  0x2524, 0xdba9,
+  0x2525, 0xdbbe,
+  0x2526, 0xdbcd,
+  0x2527, 0xdbce,
+  0x2528, 0xdbb9,
+  0x2529, 0xdbcf,
+  0x252a, 0xdbd0,
+  0x252b, 0xdbb4,
+  0x252c, 0xdba8,
+  0x252d, 0xdbd1,
+  0x252e, 0xdbd2,
+  0x252f, 0xdbb8,
+  0x2530, 0xdbbd,
+  0x2531, 0xdbd3,
+  0x2532, 0xdbd4,
+  0x2533, 0xdbb3,
+  0x2534, 0xdbaa,
+  0x2535, 0xdbd5,
+  0x2536, 0xdbd6,
+  0x2537, 0xdbba,
+  0x2538, 0xdbbf,
+  0x2539, 0xdbd7,
+  0x253a, 0xdbd8,
+  0x253b, 0xdbb5,
+  0x253c, 0xdbab,
+  0x253d, 0xdbd9,
+  0x253e, 0xdbda,
+  0x253f, 0xdbbb,
+  0x2540, 0xdbdb,
+  0x2541, 0xdbdc,
+  0x2542, 0xdbc0,
+  0x2543, 0xdbdd,
+  0x2544, 0xdbde,
+  0x2545, 0xdbdf,
+  0x2546, 0xdbe0,
+  0x2547, 0xdbe1,
+  0x2548, 0xdbe2,
+  0x2549, 0xdbe3,
+  0x254a, 0xdbe4,
+  0x254b, 0xdbb6,
+  0x2592, 0xd9c6,
+  0x25a0, 0xd971,
+  0x25a1, 0xd970,
+  0x25a3, 0xd9c3,
+  0x25a4, 0xd9c7,
+  0x25a5, 0xd9c8,
+  0x25a6, 0xd9cb,
+  0x25a7, 0xd9ca,
+  0x25a8, 0xd9c9,
+  0x25a9, 0xd9cc,
+  0x25b2, 0xd973,
+  0x25b3, 0xd972,
+  0x25b6, 0xd9ba,
+  0x25b7, 0xd9b9,
+  0x25bc, 0xd975,
+  0x25bd, 0xd974,
+  0x25c0, 0xd9b8,
+  0x25c1, 0xd9b7,
+  0x25c6, 0xd96f,
+  0x25c7, 0xd96e,
+  0x25c8, 0xd9c2,
+  0x25cb, 0xd96b,
+  0x25ce, 0xd96d,
+  0x25cf, 0xd96c,
+  0x25d0, 0xd9c4,
+  0x25d1, 0xd9c5,
+  0x2605, 0xd96a,
+  0x2606, 0xd969,
+  0x260e, 0xd9cf,
+  0x260f, 0xd9ce,
+  0x261c, 0xd9d0,
+  0x261e, 0xd9d1,
+  0x2640, 0xd95f,
+  0x2642, 0xd95e,
+  0x2660, 0xd9bc,
+  0x2661, 0xd9bd,
+  0x2663, 0xd9c0,
+  0x2664, 0xd9bb,
+  0x2665, 0xd9be,
+  0x2667, 0xd9bf,
+  0x2668, 0xd9cd,
+  0x2669, 0xd9db,
+  0x266a, 0xd9dc,
+  0x266c, 0xd9dd,
+  0x266d, 0xd9da,
+  0x3000, 0xd931,
+  0x3001, 0xd932,
+  0x3002, 0xd933,
+  0x3003, 0xd938,
+  0x3008, 0xd944,
+  0x3009, 0xd945,
+  0x300a, 0xd946,
+  0x300b, 0xd947,
+  0x300c, 0xd948,
+  0x300d, 0xd949,
+  0x300e, 0xd94a,
+  0x300f, 0xd94b,
+  0x3010, 0xd94c,
+  0x3011, 0xd94d,
+  0x3013, 0xd97b,
+  0x3014, 0xd942,
+  0x3015, 0xd943,
+  0x3041, 0xdda1,
+  0x3042, 0xdda2,
+  0x3043, 0xdda3,
+  0x3044, 0xdda4,
+  0x3045, 0xdda5,
+  0x3046, 0xdda6,
+  0x3047, 0xdda7,
+  0x3048, 0xdda8,
+  0x3049, 0xdda9,
+  0x304a, 0xddaa,
+  0x304b, 0xddab,
+  0x304c, 0xddac,
+  0x304d, 0xddad,
+  0x304e, 0xddae,
+  0x304f, 0xddaf,
+  0x3050, 0xddb0,
+  0x3051, 0xddb1,
+  0x3052, 0xddb2,
+  0x3053, 0xddb3,
+  0x3054, 0xddb4,
+  0x3055, 0xddb5,
+  0x3056, 0xddb6,
+  0x3057, 0xddb7,
+  0x3058, 0xddb8,
+  0x3059, 0xddb9,
+  0x305a, 0xddba,
+  0x305b, 0xddbb,
+  0x305c, 0xddbc,
+  0x305d, 0xddbd,
+  0x305e, 0xddbe,
+  0x305f, 0xddbf,
+  0x3060, 0xddc0,
+  0x3061, 0xddc1,
+  0x3062, 0xddc2,
+  0x3063, 0xddc3,
+  0x3064, 0xddc4,
+  0x3065, 0xddc5,
+  0x3066, 0xddc6,
+  0x3067, 0xddc7,
+  0x3068, 0xddc8,
+  0x3069, 0xddc9,
+  0x306a, 0xddca,
+  0x306b, 0xddcb,
+  0x306c, 0xddcc,
+  0x306d, 0xddcd,
+  0x306e, 0xddce,
+  0x306f, 0xddcf,
+  0x3070, 0xddd0,
+  0x3071, 0xddd1,
+  0x3072, 0xddd2,
+  0x3073, 0xddd3,
+  0x3074, 0xddd4,
+  0x3075, 0xddd5,
+  0x3076, 0xddd6,
+  0x3077, 0xddd7,
+  0x3078, 0xddd8,
+  0x3079, 0xddd9,
+  0x307a, 0xddda,
+  0x307b, 0xdddb,
+  0x307c, 0xdddc,
+  0x307d, 0xdddd,
+  0x307e, 0xddde,
+  0x307f, 0xdddf,
+  0x3080, 0xdde0,
+  0x3081, 0xdde1,
+  0x3082, 0xdde2,
+  0x3083, 0xdde3,
+  0x3084, 0xdde4,
+  0x3085, 0xdde5,
+  0x3086, 0xdde6,
+  0x3087, 0xdde7,
+  0x3088, 0xdde8,
+  0x3089, 0xdde9,
+  0x308a, 0xddea,
+  0x308b, 0xddeb,
+  0x308c, 0xddec,
+  0x308d, 0xdded,
+  0x308e, 0xddee,
+  0x308f, 0xddef,
+  0x3090, 0xddf0,
+  0x3091, 0xddf1,
+  0x3092, 0xddf2,
+  0x3093, 0xddf3,
+  0x30a1, 0xde31,
+  0x30a2, 0xde32,
+  0x30a3, 0xde33,
+  0x30a4, 0xde34,
+  0x30a5, 0xde35,
+  0x30a6, 0xde36,
+  0x30a7, 0xde37,
+  0x30a8, 0xde38,
+  0x30a9, 0xde39,
+  0x30aa, 0xde3a,
+  0x30ab, 0xde3b,
+  0x30ac, 0xde3c,
+  0x30ad, 0xde3d,
+  0x30ae, 0xde3e,
+  0x30af, 0xde3f,
+  0x30b0, 0xde40,
+  0x30b1, 0xde41,
+  0x30b2, 0xde42,
+  0x30b3, 0xde43,
+  0x30b4, 0xde44,
+  0x30b5, 0xde45,
+  0x30b6, 0xde46,
+  0x30b7, 0xde47,
+  0x30b8, 0xde48,
+  0x30b9, 0xde49,
+  0x30ba, 0xde4a,
+  0x30bb, 0xde4b,
+  0x30bc, 0xde4c,
+  0x30bd, 0xde4d,
+  0x30be, 0xde4e,
+  0x30bf, 0xde4f,
+  0x30c0, 0xde50,
+  0x30c1, 0xde51,
+  0x30c2, 0xde52,
+  0x30c3, 0xde53,
+  0x30c4, 0xde54,
+  0x30c5, 0xde55,
+  0x30c6, 0xde56,
+  0x30c7, 0xde57,
+  0x30c8, 0xde58,
+  0x30c9, 0xde59,
+  0x30ca, 0xde5a,
+  0x30cb, 0xde5b,
+  0x30cc, 0xde5c,
+  0x30cd, 0xde5d,
+  0x30ce, 0xde5e,
+  0x30cf, 0xde5f,
+  0x30d0, 0xde60,
+  0x30d1, 0xde61,
+  0x30d2, 0xde62,
+  0x30d3, 0xde63,
+  0x30d4, 0xde64,
+  0x30d5, 0xde65,
+  0x30d6, 0xde66,
+  0x30d7, 0xde67,
+  0x30d8, 0xde68,
+  0x30d9, 0xde69,
+  0x30da, 0xde6a,
+  0x30db, 0xde6b,
+  0x30dc, 0xde6c,
+  0x30dd, 0xde6d,
+  0x30de, 0xde6e,
+  0x30df, 0xde6f,
+  0x30e0, 0xde70,
+  0x30e1, 0xde71,
+  0x30e2, 0xde72,
+  0x30e3, 0xde73,
+  0x30e4, 0xde74,
+  0x30e5, 0xde75,
+  0x30e6, 0xde76,
+  0x30e7, 0xde77,
+  0x30e8, 0xde78,
+  0x30e9, 0xde79,
+  0x30ea, 0xde7a,
+  0x30eb, 0xde7b,
+  0x30ec, 0xde7c,
+  0x30ed, 0xde7d,
+  0x30ee, 0xde7e,
+  0x30ef, 0xde91,
+  0x30f0, 0xde92,
+  0x30f1, 0xde93,
+  0x30f2, 0xde94,
+  0x30f3, 0xde95,
+  0x30f4, 0xde96,
+  0x30f5, 0xde97,
+  0x30f6, 0xde98,
+  0x3131, 0x8841,
+  0x3132, 0x8c41,
+  0x3133, 0x8444,
+  0x3134, 0x9041,
+  0x3135, 0x8446,
+  0x3136, 0x8447,
+  0x3137, 0x9441,
+  0x3138, 0x9841,
+  0x3139, 0x9c41,
+  0x313a, 0x844a,
+  0x313b, 0x844b,
+  0x313c, 0x844c,
+  0x313d, 0x844d,
+  0x313e, 0x844e,
+  0x313f, 0x844f,
+  0x3140, 0x8450,
+  0x3141, 0xa041,
+  0x3142, 0xa441,
+  0x3143, 0xa841,
+  0x3144, 0x8454,
+  0x3145, 0xac41,
+  0x3146, 0xb041,
+  0x3147, 0xb441,
+  0x3148, 0xb841,
+  0x3149, 0xbc41,
+  0x314a, 0xc041,
+  0x314b, 0xc441,
+  0x314c, 0xc841,
+  0x314d, 0xcc41,
+  0x314e, 0xd041,
+  0x314f, 0x8461,
+  0x3150, 0x8481,
+  0x3151, 0x84a1,
+  0x3152, 0x84c1,
+  0x3153, 0x84e1,
+  0x3154, 0x8541,
+  0x3155, 0x8561,
+  0x3156, 0x8581,
+  0x3157, 0x85a1,
+  0x3158, 0x85c1,
+  0x3159, 0x85e1,
+  0x315a, 0x8641,
+  0x315b, 0x8661,
+  0x315c, 0x8681,
+  0x315d, 0x86a1,
+  0x315e, 0x86c1,
+  0x315f, 0x86e1,
+  0x3160, 0x8741,
+  0x3161, 0x8761,
+  0x3162, 0x8781,
+  0x3163, 0x87a1,
+  0x3164, 0xdad4,
+  0x3165, 0xdad5,
+  0x3166, 0xdad6,
+  0x3167, 0xdad7,
+  0x3168, 0xdad8,
+  0x3169, 0xdad9,
+  0x316a, 0xdada,
+  0x316b, 0xdadb,
+  0x316c, 0xdadc,
+  0x316d, 0xdadd,
+  0x316e, 0xdade,
+  0x316f, 0xdadf,
+  0x3170, 0xdae0,
+  0x3171, 0xdae1,
+  0x3172, 0xdae2,
+  0x3173, 0xdae3,
+  0x3174, 0xdae4,
+  0x3175, 0xdae5,
+  0x3176, 0xdae6,
+  0x3177, 0xdae7,
+  0x3178, 0xdae8,
+  0x3179, 0xdae9,
+  0x317a, 0xdaea,
+  0x317b, 0xdaeb,
+  0x317c, 0xdaec,
+  0x317d, 0xdaed,
+  0x317e, 0xdaee,
+  0x317f, 0xdaef,
+  0x3180, 0xdaf0,
+  0x3181, 0xdaf1,
+  0x3182, 0xdaf2,
+  0x3183, 0xdaf3,
+  0x3184, 0xdaf4,
+  0x3185, 0xdaf5,
+  0x3186, 0xdaf6,
+  0x3187, 0xdaf7,
+  0x3188, 0xdaf8,
+  0x3189, 0xdaf9,
+  0x318a, 0xdafa,
+  0x318b, 0xdafb,
+  0x318c, 0xdafc,
+  0x318d, 0xdafd,
+  0x318e, 0xdafe,
+  0x3200, 0xdd41,
+  0x3201, 0xdd42,
+  0x3202, 0xdd43,
+  0x3203, 0xdd44,
+  0x3204, 0xdd45,
+  0x3205, 0xdd46,
+  0x3206, 0xdd47,
+  0x3207, 0xdd48,
+  0x3208, 0xdd49,
+  0x3209, 0xdd4a,
+  0x320a, 0xdd4b,
+  0x320b, 0xdd4c,
+  0x320c, 0xdd4d,
+  0x320d, 0xdd4e,
+  0x320e, 0xdd4f,
+  0x320f, 0xdd50,
+  0x3210, 0xdd51,
+  0x3211, 0xdd52,
+  0x3212, 0xdd53,
+  0x3213, 0xdd54,
+  0x3214, 0xdd55,
+  0x3215, 0xdd56,
+  0x3216, 0xdd57,
+  0x3217, 0xdd58,
+  0x3218, 0xdd59,
+  0x3219, 0xdd5a,
+  0x321a, 0xdd5b,
+  0x321b, 0xdd5c,
+  0x321c, 0xd9df,
+  0x3260, 0xdcb1,
+  0x3261, 0xdcb2,
+  0x3262, 0xdcb3,
+  0x3263, 0xdcb4,
+  0x3264, 0xdcb5,
+  0x3265, 0xdcb6,
+  0x3266, 0xdcb7,
+  0x3267, 0xdcb8,
+  0x3268, 0xdcb9,
+  0x3269, 0xdcba,
+  0x326a, 0xdcbb,
+  0x326b, 0xdcbc,
+  0x326c, 0xdcbd,
+  0x326d, 0xdcbe,
+  0x326e, 0xdcbf,
+  0x326f, 0xdcc0,
+  0x3270, 0xdcc1,
+  0x3271, 0xdcc2,
+  0x3272, 0xdcc3,
+  0x3273, 0xdcc4,
+  0x3274, 0xdcc5,
+  0x3275, 0xdcc6,
+  0x3276, 0xdcc7,
+  0x3277, 0xdcc8,
+  0x3278, 0xdcc9,
+  0x3279, 0xdcca,
+  0x327a, 0xdccb,
+  0x327b, 0xdccc,
+  0x327f, 0xd9de,
+  0x3380, 0xdc59,
+  0x3381, 0xdc5a,
+  0x3382, 0xdc5b,
+  0x3383, 0xdc5c,
+  0x3384, 0xdc5d,
+  0x3388, 0xdc4a,
+  0x3389, 0xdc4b,
+  0x338a, 0xdc6c,
+  0x338b, 0xdc6d,
+  0x338c, 0xdc6e,
+  0x338d, 0xdc46,
+  0x338e, 0xdc47,
+  0x338f, 0xdc48,
+  0x3390, 0xdc64,
+  0x3391, 0xdc65,
+  0x3392, 0xdc66,
+  0x3393, 0xdc67,
+  0x3394, 0xdc68,
+  0x3395, 0xdc31,
+  0x3396, 0xdc32,
+  0x3397, 0xdc33,
+  0x3398, 0xdc35,
+  0x3399, 0xdc3b,
+  0x339a, 0xdc3c,
+  0x339b, 0xdc3d,
+  0x339c, 0xdc3e,
+  0x339d, 0xdc3f,
+  0x339e, 0xdc40,
+  0x339f, 0xdc41,
+  0x33a0, 0xdc42,
+  0x33a1, 0xdc43,
+  0x33a2, 0xdc44,
+  0x33a3, 0xdc37,
+  0x33a4, 0xdc38,
+  0x33a5, 0xdc39,
+  0x33a6, 0xdc3a,
+  0x33a7, 0xdc4d,
+  0x33a8, 0xdc4e,
+  0x33a9, 0xdc75,
+  0x33aa, 0xdc76,
+  0x33ab, 0xdc77,
+  0x33ac, 0xdc78,
+  0x33ad, 0xdc71,
+  0x33ae, 0xdc72,
+  0x33af, 0xdc73,
+  0x33b0, 0xdc4f,
+  0x33b1, 0xdc50,
+  0x33b2, 0xdc51,
+  0x33b3, 0xdc52,
+  0x33b4, 0xdc53,
+  0x33b5, 0xdc54,
+  0x33b6, 0xdc55,
+  0x33b7, 0xdc56,
+  0x33b8, 0xdc57,
+  0x33b9, 0xdc58,
+  0x33ba, 0xdc5e,
+  0x33bb, 0xdc5f,
+  0x33bc, 0xdc60,
+  0x33bd, 0xdc61,
+  0x33be, 0xdc62,
+  0x33bf, 0xdc63,
+  0x33c0, 0xdc6a,
+  0x33c1, 0xdc6b,
+  0x33c2, 0xd9e3,
+  0x33c3, 0xdc7c,
+  0x33c4, 0xdc36,
+  0x33c5, 0xdc70,
+  0x33c6, 0xdc91,
+  0x33c7, 0xd9e1,
+  0x33c8, 0xdc4c,
+  0x33c9, 0xdc7d,
+  0x33ca, 0xdc45,
+  0x33cf, 0xdc49,
+  0x33d0, 0xdc7a,
+  0x33d3, 0xdc7b,
+  0x33d6, 0xdc6f,
+  0x33d8, 0xd9e4,
+  0x33db, 0xdc74,
+  0x33dc, 0xdc7e,
+  0x33dd, 0xdc79,
+  0x4e00, 0xf179,
+  0x4e01, 0xf2cb,
+  0x4e03, 0xf662,
+  0x4e07, 0xe742,
+  0x4e08, 0xf1db,
+  0x4e09, 0xeab2,
+  0x4e0a, 0xeabe,
+  0x4e0b, 0xf7bb,
+  0x4e0d, 0xe996,
+  0x4e11, 0xf5e4,
+  0x4e14, 0xf4a6,
+  0x4e15, 0xe9e0,
+  0x4e16, 0xeba6,
+  0x4e18, 0xe29a,
+  0x4e19, 0xe940,
+  0x4e1e, 0xecaa,
+  0x4e2d, 0xf3e9,
+  0x4e32, 0xe1fa,
+  0x4e38, 0xf93f,
+  0x4e39, 0xe4a1,
+  0x4e3b, 0xf3ab,
+  0x4e42, 0xeed1,
+  0x4e43, 0xe43c,
+  0x4e45, 0xe29b,
+  0x4e4b, 0xf3fd,
+  0x4e4d, 0xea4f,
+  0x4e4e, 0xf8ba,
+  0x4e4f, 0xf7b9,
+  0x4e56, 0xe262,
+  0x4e58, 0xecab,
+  0x4e59, 0xf0e0,
+  0x4e5d, 0xe29c,
+  0x4e5e, 0xe0f7,
+  0x4e5f, 0xeda5,
+  0x4e6b, 0xe071,
+  0x4e6d, 0xe55c,
+  0x4e73, 0xf071,
+  0x4e76, 0xe973,
+  0x4e77, 0xeaad,
+  0x4e7e, 0xe0eb,
+  0x4e82, 0xe5af,
+  0x4e86, 0xe697,
+  0x4e88, 0xedf8,
+  0x4e8b, 0xea50,
+  0x4e8c, 0xf133,
+  0x4e8e, 0xefcd,
+  0x4e90, 0xf037,
+  0x4e91, 0xeff6,
+  0x4e92, 0xf8bb,
+  0x4e94, 0xeee9,
+  0x4e95, 0xf2cc,
+  0x4e98, 0xe376,
+  0x4e9b, 0xea51,
+  0x4e9e, 0xed3c,
+  0x4ea1, 0xe75c,
+  0x4ea2, 0xf7f1,
+  0x4ea4, 0xe26f,
+  0x4ea5, 0xf834,
+  0x4ea6, 0xee42,
+  0x4ea8, 0xf89d,
+  0x4eab, 0xf84d,
+  0x4eac, 0xe158,
+  0x4ead, 0xf2cd,
+  0x4eae, 0xe5d5,
+  0x4eb6, 0xe4a2,
+  0x4eba, 0xf161,
+  0x4ec0, 0xed37,
+  0x4ec1, 0xf162,
+  0x4ec4, 0xf641,
+  0x4ec7, 0xe29d,
+  0x4eca, 0xe361,
+  0x4ecb, 0xe0bf,
+  0x4ecd, 0xf1a4,
+  0x4ed4, 0xf1a8,
+  0x4ed5, 0xea52,
+  0x4ed6, 0xf672,
+  0x4ed7, 0xf1dc,
+  0x4ed8, 0xe997,
+  0x4ed9, 0xeb49,
+  0x4edd, 0xe55e,
+  0x4edf, 0xf545,
+  0x4ee3, 0xe4db,
+  0x4ee4, 0xe645,
+  0x4ee5, 0xf134,
+  0x4ef0, 0xed76,
+  0x4ef2, 0xf3ea,
+  0x4ef6, 0xe0ec,
+  0x4ef7, 0xe0c0,
+  0x4efb, 0xf194,
+  0x4f01, 0xe37a,
+  0x4f09, 0xf7f2,
+  0x4f0a, 0xf135,
+  0x4f0b, 0xe36f,
+  0x4f0d, 0xeeea,
+  0x4f0e, 0xe37b,
+  0x4f0f, 0xe961,
+  0x4f10, 0xe8e9,
+  0x4f11, 0xf9cc,
+  0x4f2f, 0xe8d7,
+  0x4f34, 0xe871,
+  0x4f36, 0xe646,
+  0x4f38, 0xecdf,
+  0x4f3a, 0xea53,
+  0x4f3c, 0xea54,
+  0x4f3d, 0xe031,
+  0x4f43, 0xf27c,
+  0x4f46, 0xe4a3,
+  0x4f47, 0xf247,
+  0x4f48, 0xf75f,
+  0x4f4d, 0xf058,
+  0x4f4e, 0xf248,
+  0x4f4f, 0xf3ac,
+  0x4f50, 0xf3a5,
+  0x4f51, 0xefce,
+  0x4f55, 0xf7bc,
+  0x4f59, 0xedf9,
+  0x4f5a, 0xf17a,
+  0x4f5b, 0xe9d6,
+  0x4f5c, 0xf1c2,
+  0x4f69, 0xf735,
+  0x4f6f, 0xedba,
+  0x4f70, 0xe8d8,
+  0x4f73, 0xe032,
+  0x4f76, 0xe3cd,
+  0x4f7a, 0xf27d,
+  0x4f7e, 0xf17b,
+  0x4f7f, 0xea55,
+  0x4f81, 0xece0,
+  0x4f83, 0xe059,
+  0x4f84, 0xf479,
+  0x4f86, 0xe5ce,
+  0x4f88, 0xf646,
+  0x4f8a, 0xe252,
+  0x4f8b, 0xe657,
+  0x4f8d, 0xecb4,
+  0x4f8f, 0xf3ad,
+  0x4f91, 0xf072,
+  0x4f96, 0xe6c2,
+  0x4f98, 0xf4a7,
+  0x4f9b, 0xe1ea,
+  0x4f9d, 0xf0ee,
+  0x4fae, 0xe7b2,
+  0x4faf, 0xf9a5,
+  0x4fb5, 0xf665,
+  0x4fb6, 0xe5e2,
+  0x4fbf, 0xf745,
+  0x4fc2, 0xe197,
+  0x4fc3, 0xf5b5,
+  0x4fc4, 0xed3d,
+  0x4fc9, 0xeeeb,
+  0x4fca, 0xf3d5,
+  0x4fce, 0xf34b,
+  0x4fd1, 0xefb5,
+  0x4fd3, 0xe159,
+  0x4fd4, 0xf865,
+  0x4fd7, 0xebd4,
+  0x4fda, 0xe6d6,
+  0x4fdd, 0xe951,
+  0x4fdf, 0xea56,
+  0x4fe0, 0xf891,
+  0x4fe1, 0xece1,
+  0x4fee, 0xebf3,
+  0x4fef, 0xe998,
+  0x4ff1, 0xe29e,
+  0x4ff3, 0xe8c4,
+  0x4ff5, 0xf793,
+  0x4ff8, 0xe974,
+  0x4ffa, 0xedef,
+  0x5002, 0xe941,
+  0x5006, 0xe5d6,
+  0x5009, 0xf4da,
+  0x500b, 0xe0c1,
+  0x500d, 0xe8c3,
+  0x5011, 0xe7fa,
+  0x5012, 0xe4ee,
+  0x5016, 0xf848,
+  0x5019, 0xf9a6,
+  0x501a, 0xf0ef,
+  0x501c, 0xf536,
+  0x501e, 0xe15a,
+  0x501f, 0xf4a8,
+  0x5021, 0xf4db,
+  0x5023, 0xe8a7,
+  0x5024, 0xf647,
+  0x5026, 0xe2e6,
+  0x5027, 0xf394,
+  0x5028, 0xe0da,
+  0x502a, 0xeed2,
+  0x502b, 0xe6c3,
+  0x502c, 0xf692,
+  0x502d, 0xef6e,
+  0x503b, 0xeda6,
+  0x5043, 0xede7,
+  0x5047, 0xe033,
+  0x5048, 0xe137,
+  0x5049, 0xf059,
+  0x504f, 0xf746,
+  0x5055, 0xf835,
+  0x505a, 0xf3ae,
+  0x505c, 0xf2ce,
+  0x5065, 0xe0ed,
+  0x5074, 0xf640,
+  0x5075, 0xf2cf,
+  0x5076, 0xefcf,
+  0x5078, 0xf6de,
+  0x5080, 0xe263,
+  0x5085, 0xe999,
+  0x508d, 0xe8a8,
+  0x5091, 0xe0f8,
+  0x5098, 0xeaa1,
+  0x5099, 0xe9e1,
+  0x50ac, 0xf5ca,
+  0x50ad, 0xefb6,
+  0x50b2, 0xeeec,
+  0x50b3, 0xf27e,
+  0x50b5, 0xf4f0,
+  0x50b7, 0xeabf,
+  0x50be, 0xe15b,
+  0x50c5, 0xe351,
+  0x50c9, 0xf562,
+  0x50ca, 0xeb4a,
+  0x50cf, 0xeac0,
+  0x50d1, 0xe270,
+  0x50d5, 0xe962,
+  0x50d6, 0xf9ea,
+  0x50da, 0xe698,
+  0x50de, 0xf05a,
+  0x50e5, 0xef79,
+  0x50e7, 0xecac,
+  0x50ed, 0xf4d0,
+  0x50f9, 0xe034,
+  0x50fb, 0xe8f8,
+  0x50ff, 0xea57,
+  0x5100, 0xf0f0,
+  0x5101, 0xf3d6,
+  0x5104, 0xede2,
+  0x5106, 0xe15c,
+  0x5109, 0xe0fb,
+  0x5112, 0xf073,
+  0x511f, 0xeac1,
+  0x5121, 0xe67d,
+  0x512a, 0xefd0,
+  0x5132, 0xf249,
+  0x5137, 0xe5e3,
+  0x513a, 0xe3d3,
+  0x513c, 0xedf0,
+  0x5140, 0xef44,
+  0x5141, 0xf0c3,
+  0x5143, 0xf03a,
+  0x5144, 0xf89e,
+  0x5145, 0xf5f6,
+  0x5146, 0xf34c,
+  0x5147, 0xf9d4,
+  0x5148, 0xeb4b,
+  0x5149, 0xe253,
+  0x514b, 0xe34a,
+  0x514c, 0xf6ba,
+  0x514d, 0xe795,
+  0x514e, 0xf6cd,
+  0x5152, 0xed3e,
+  0x515c, 0xe56f,
+  0x5162, 0xe377,
+  0x5165, 0xf19f,
+  0x5167, 0xe43e,
+  0x5168, 0xf291,
+  0x5169, 0xe5d7,
+  0x516a, 0xf074,
+  0x516b, 0xf732,
+  0x516c, 0xe1eb,
+  0x516d, 0xe6bf,
+  0x516e, 0xf8b1,
+  0x5171, 0xe1ec,
+  0x5175, 0xe942,
+  0x5176, 0xe37c,
+  0x5177, 0xe29f,
+  0x5178, 0xf292,
+  0x517c, 0xe152,
+  0x5180, 0xe37d,
+  0x5186, 0xedf7,
+  0x518a, 0xf4fc,
+  0x518d, 0xf232,
+  0x5192, 0xe7b3,
+  0x5195, 0xe796,
+  0x5197, 0xefb7,
+  0x51a0, 0xe23e,
+  0x51a5, 0xe7a2,
+  0x51aa, 0xe793,
+  0x51ac, 0xe55f,
+  0x51b6, 0xeda7,
+  0x51b7, 0xe5d2,
+  0x51bd, 0xe639,
+  0x51c4, 0xf532,
+  0x51c6, 0xf3d7,
+  0x51c9, 0xe5d8,
+  0x51cb, 0xf34d,
+  0x51cc, 0xe6d0,
+  0x51cd, 0xe560,
+  0x51dc, 0xe6cf,
+  0x51dd, 0xf0ea,
+  0x51de, 0xf9eb,
+  0x51e1, 0xe8ed,
+  0x51f0, 0xf955,
+  0x51f1, 0xe0c2,
+  0x51f6, 0xf9d5,
+  0x51f8, 0xf558,
+  0x51f9, 0xef7a,
+  0x51fa, 0xf5f3,
+  0x51fd, 0xf7de,
+  0x5200, 0xe4ef,
+  0x5203, 0xf163,
+  0x5206, 0xe9c2,
+  0x5207, 0xf2b7,
+  0x5208, 0xeed4,
+  0x520a, 0xe05a,
+  0x520e, 0xe7fb,
+  0x5211, 0xf89f,
+  0x5217, 0xe63a,
+  0x521d, 0xf59a,
+  0x5224, 0xf6f7,
+  0x5225, 0xe93c,
+  0x5229, 0xe6d7,
+  0x522a, 0xeaa2,
+  0x522e, 0xe24e,
+  0x5230, 0xe4f0,
+  0x5236, 0xf334,
+  0x5237, 0xebec,
+  0x5238, 0xe2e7,
+  0x5239, 0xf4cb,
+  0x523a, 0xf1a9,
+  0x523b, 0xe04e,
+  0x5243, 0xf591,
+  0x5247, 0xf65e,
+  0x524a, 0xea9d,
+  0x524b, 0xe34b,
+  0x524c, 0xe5b7,
+  0x524d, 0xf293,
+  0x5254, 0xf538,
+  0x5256, 0xe99a,
+  0x525b, 0xe0a7,
+  0x525d, 0xe85e,
+  0x5261, 0xeb76,
+  0x5269, 0xf1a5,
+  0x526a, 0xf294,
+  0x526f, 0xe99b,
+  0x5272, 0xf7dc,
+  0x5275, 0xf4dc,
+  0x527d, 0xf794,
+  0x527f, 0xf59b,
+  0x5283, 0xf993,
+  0x5287, 0xe34c,
+  0x5288, 0xe8f9,
+  0x5289, 0xe6b1,
+  0x528d, 0xe0fc,
+  0x5291, 0xf335,
+  0x5292, 0xe0fd,
+  0x529b, 0xe5f4,
+  0x529f, 0xe1ed,
+  0x52a0, 0xe035,
+  0x52a3, 0xe63b,
+  0x52a4, 0xe352,
+  0x52a9, 0xf34e,
+  0x52aa, 0xe44d,
+  0x52ab, 0xe134,
+  0x52be, 0xf846,
+  0x52c1, 0xe15d,
+  0x52c3, 0xe89c,
+  0x52c5, 0xf65f,
+  0x52c7, 0xefb8,
+  0x52c9, 0xe797,
+  0x52cd, 0xe15e,
+  0x52d2, 0xe6cd,
+  0x52d5, 0xe561,
+  0x52d6, 0xefed,
+  0x52d8, 0xe07b,
+  0x52d9, 0xe7e2,
+  0x52db, 0xf9b2,
+  0x52dd, 0xecad,
+  0x52de, 0xe65c,
+  0x52df, 0xe7b4,
+  0x52e2, 0xeba7,
+  0x52e3, 0xf263,
+  0x52e4, 0xe353,
+  0x52f3, 0xf9b3,
+  0x52f5, 0xe5e4,
+  0x52f8, 0xe2e8,
+  0x52fa, 0xf1c3,
+  0x52fb, 0xe342,
+  0x52fe, 0xe2a0,
+  0x52ff, 0xe838,
+  0x5305, 0xf760,
+  0x5308, 0xf9d6,
+  0x530d, 0xf761,
+  0x530f, 0xf762,
+  0x5310, 0xe963,
+  0x5315, 0xe9e2,
+  0x5316, 0xf8f9,
+  0x5317, 0xe9c1,
+  0x5319, 0xecb5,
+  0x5320, 0xf1dd,
+  0x5321, 0xe254,
+  0x5323, 0xe0a1,
+  0x532a, 0xe9e3,
+  0x532f, 0xf96d,
+  0x5339, 0xf7af,
+  0x533f, 0xe49d,
+  0x5340, 0xe2a1,
+  0x5341, 0xed38,
+  0x5343, 0xf546,
+  0x5344, 0xf1a0,
+  0x5347, 0xecae,
+  0x5348, 0xeeed,
+  0x5349, 0xf9c1,
+  0x534a, 0xe872,
+  0x534d, 0xe743,
+  0x5351, 0xe9e4,
+  0x5352, 0xf391,
+  0x5353, 0xf693,
+  0x5354, 0xf892,
+  0x5357, 0xe3f5,
+  0x535a, 0xe85f,
+  0x535c, 0xe964,
+  0x535e, 0xe936,
+  0x5360, 0xf2bf,
+  0x5366, 0xe25f,
+  0x5368, 0xeb69,
+  0x536f, 0xe7d6,
+  0x5370, 0xf164,
+  0x5371, 0xf05b,
+  0x5374, 0xe04f,
+  0x5375, 0xe5b0,
+  0x5377, 0xe2e9,
+  0x537d, 0xf3ed,
+  0x537f, 0xe15f,
+  0x5384, 0xed9a,
+  0x5393, 0xed7d,
+  0x5398, 0xe6d8,
+  0x539a, 0xf9a7,
+  0x539f, 0xf03b,
+  0x53a0, 0xf642,
+  0x53a5, 0xe2f0,
+  0x53a6, 0xf7bd,
+  0x53ad, 0xee96,
+  0x53bb, 0xe0db,
+  0x53c3, 0xf4d1,
+  0x53c8, 0xefd1,
+  0x53c9, 0xf4a9,
+  0x53ca, 0xe370,
+  0x53cb, 0xefd2,
+  0x53cd, 0xe873,
+  0x53d4, 0xec62,
+  0x53d6, 0xf632,
+  0x53d7, 0xebf4,
+  0x53db, 0xe874,
+  0x53e1, 0xeed5,
+  0x53e2, 0xf5bf,
+  0x53e3, 0xe2a2,
+  0x53e4, 0xe1af,
+  0x53e5, 0xe2a3,
+  0x53e9, 0xe1b0,
+  0x53ea, 0xf3fe,
+  0x53eb, 0xe333,
+  0x53ec, 0xebaf,
+  0x53ed, 0xf733,
+  0x53ef, 0xe036,
+  0x53f0, 0xf6bb,
+  0x53f1, 0xf47a,
+  0x53f2, 0xea58,
+  0x53f3, 0xefd3,
+  0x53f8, 0xea59,
+  0x5403, 0xf9de,
+  0x5404, 0xe050,
+  0x5408, 0xf7ea,
+  0x5409, 0xe3ce,
+  0x540a, 0xf264,
+  0x540c, 0xe562,
+  0x540d, 0xe7a3,
+  0x540e, 0xf9a8,
+  0x540f, 0xe6d9,
+  0x5410, 0xf6ce,
+  0x5411, 0xf84e,
+  0x541b, 0xe2d6,
+  0x541d, 0xe6f0,
+  0x541f, 0xf0e1,
+  0x5420, 0xf755,
+  0x5426, 0xe99c,
+  0x5429, 0xe9c3,
+  0x542b, 0xf7df,
+  0x5433, 0xeeef,
+  0x5438, 0xf9e5,
+  0x5439, 0xf633,
+  0x543b, 0xe7fc,
+  0x543c, 0xf9a9,
+  0x543e, 0xeeee,
+  0x5442, 0xe5e5,
+  0x5448, 0xf2d0,
+  0x544a, 0xe1b1,
+  0x5451, 0xf6a2,
+  0x5468, 0xf3b2,
+  0x546a, 0xf3b1,
+  0x5471, 0xe1b2,
+  0x5473, 0xe83b,
+  0x5475, 0xe037,
+  0x547b, 0xece2,
+  0x547c, 0xf8bc,
+  0x547d, 0xe7a4,
+  0x5480, 0xf24a,
+  0x5486, 0xf763,
+  0x548c, 0xf8fa,
+  0x548e, 0xe2a4,
+  0x5490, 0xe99d,
+  0x54a4, 0xf673,
+  0x54a8, 0xf1aa,
+  0x54ab, 0xf431,
+  0x54ac, 0xe271,
+  0x54b3, 0xf836,
+  0x54b8, 0xf7e0,
+  0x54bd, 0xf166,
+  0x54c0, 0xed7e,
+  0x54c1, 0xf7a1,
+  0x54c4, 0xf8ef,
+  0x54c8, 0xf7eb,
+  0x54c9, 0xf233,
+  0x54e1, 0xf03c,
+  0x54e5, 0xe038,
+  0x54e8, 0xf59c,
+  0x54ed, 0xe1d6,
+  0x54ee, 0xf998,
+  0x54f2, 0xf559,
+  0x54fa, 0xf764,
+  0x5504, 0xf736,
+  0x5506, 0xea5a,
+  0x5507, 0xf456,
+  0x550e, 0xe6da,
+  0x5510, 0xe4d0,
+  0x551c, 0xe755,
+  0x552f, 0xf076,
+  0x5531, 0xf4dd,
+  0x5535, 0xed6a,
+  0x553e, 0xf674,
+  0x5544, 0xf694,
+  0x5546, 0xeac2,
+  0x554f, 0xe7fd,
+  0x5553, 0xe198,
+  0x5556, 0xe4ba,
+  0x555e, 0xed3f,
+  0x5563, 0xf7e1,
+  0x557c, 0xf336,
+  0x5580, 0xe0d3,
+  0x5584, 0xeb4c,
+  0x5586, 0xf55a,
+  0x5587, 0xe59c,
+  0x5589, 0xf9aa,
+  0x558a, 0xf7e2,
+  0x5598, 0xf547,
+  0x5599, 0xf9c2,
+  0x559a, 0xf940,
+  0x559c, 0xf9ec,
+  0x559d, 0xe072,
+  0x55a7, 0xf9bd,
+  0x55a9, 0xf077,
+  0x55aa, 0xeac3,
+  0x55ab, 0xe3d2,
+  0x55ac, 0xe272,
+  0x55ae, 0xe4a4,
+  0x55c5, 0xf9ab,
+  0x55c7, 0xeae0,
+  0x55d4, 0xf457,
+  0x55da, 0xeef0,
+  0x55dc, 0xe37e,
+  0x55df, 0xf4aa,
+  0x55e3, 0xea5b,
+  0x55e4, 0xf648,
+  0x55fd, 0xebf5,
+  0x55fe, 0xf3b3,
+  0x5606, 0xf6a3,
+  0x5609, 0xe039,
+  0x5614, 0xe2a5,
+  0x5617, 0xeac4,
+  0x562f, 0xebb0,
+  0x5632, 0xf34f,
+  0x5634, 0xf634,
+  0x5636, 0xecb6,
+  0x5653, 0xf856,
+  0x5668, 0xe391,
+  0x566b, 0xf9ed,
+  0x5674, 0xe9c4,
+  0x5686, 0xf999,
+  0x56a5, 0xee4f,
+  0x56ac, 0xea3d,
+  0x56ae, 0xf84f,
+  0x56b4, 0xedf1,
+  0x56bc, 0xf1c4,
+  0x56ca, 0xe435,
+  0x56cd, 0xf9ee,
+  0x56d1, 0xf5b6,
+  0x56da, 0xebf6,
+  0x56db, 0xea5c,
+  0x56de, 0xf96e,
+  0x56e0, 0xf167,
+  0x56f0, 0xe1dd,
+  0x56f9, 0xe647,
+  0x56fa, 0xe1b3,
+  0x5703, 0xf765,
+  0x5704, 0xedd8,
+  0x5708, 0xe2ea,
+  0x570b, 0xe2d0,
+  0x570d, 0xf05c,
+  0x5712, 0xf03e,
+  0x5713, 0xf03d,
+  0x5716, 0xe4f1,
+  0x5718, 0xe4a5,
+  0x571f, 0xf6cf,
+  0x5728, 0xf234,
+  0x572d, 0xe334,
+  0x5730, 0xf432,
+  0x573b, 0xe392,
+  0x5740, 0xf433,
+  0x5742, 0xf6f8,
+  0x5747, 0xe343,
+  0x574a, 0xe8a9,
+  0x574d, 0xe4bb,
+  0x574e, 0xe07c,
+  0x5750, 0xf3a6,
+  0x5751, 0xe0d5,
+  0x5761, 0xf6e7,
+  0x5764, 0xe1de,
+  0x5766, 0xf6a4,
+  0x576a, 0xf750,
+  0x576e, 0xe4dd,
+  0x5770, 0xe160,
+  0x5775, 0xe2a6,
+  0x577c, 0xf695,
+  0x5782, 0xebf7,
+  0x5788, 0xe4dc,
+  0x578b, 0xf8a0,
+  0x5793, 0xf837,
+  0x57a0, 0xf0d9,
+  0x57a2, 0xe2a7,
+  0x57a3, 0xf03f,
+  0x57c3, 0xed91,
+  0x57c7, 0xefb9,
+  0x57c8, 0xf3d8,
+  0x57cb, 0xe768,
+  0x57ce, 0xeb94,
+  0x57df, 0xee44,
+  0x57e0, 0xe99e,
+  0x57f0, 0xf4f1,
+  0x57f4, 0xecd0,
+  0x57f7, 0xf49d,
+  0x57f9, 0xe8c6,
+  0x57fa, 0xe393,
+  0x57fc, 0xe394,
+  0x5800, 0xe2dc,
+  0x5802, 0xe4d1,
+  0x5805, 0xe141,
+  0x5806, 0xf6d8,
+  0x5808, 0xe0a8,
+  0x5809, 0xf0bc,
+  0x580a, 0xed4e,
+  0x581e, 0xf56c,
+  0x5821, 0xe952,
+  0x5824, 0xf337,
+  0x5827, 0xee50,
+  0x582a, 0xe07d,
+  0x582f, 0xef7b,
+  0x5830, 0xede8,
+  0x5831, 0xe953,
+  0x5834, 0xf1de,
+  0x5835, 0xe4f2,
+  0x583a, 0xe199,
+  0x584a, 0xe264,
+  0x584b, 0xeeab,
+  0x584f, 0xe0c3,
+  0x5851, 0xebb1,
+  0x5854, 0xf6b2,
+  0x5857, 0xe4f3,
+  0x5858, 0xe4d2,
+  0x585a, 0xf5c0,
+  0x585e, 0xeadd,
+  0x5861, 0xf295,
+  0x5862, 0xeef1,
+  0x5864, 0xf9b4,
+  0x5875, 0xf458,
+  0x5879, 0xf4d2,
+  0x587c, 0xf296,
+  0x587e, 0xec63,
+  0x5883, 0xe161,
+  0x5885, 0xeaea,
+  0x5889, 0xefba,
+  0x5893, 0xe7d7,
+  0x589c, 0xf5cd,
+  0x589e, 0xf3f2,
+  0x589f, 0xf857,
+  0x58a8, 0xe7f8,
+  0x58a9, 0xe552,
+  0x58ae, 0xf675,
+  0x58b3, 0xe9c5,
+  0x58ba, 0xeef2,
+  0x58bb, 0xf1df,
+  0x58be, 0xe05b,
+  0x58c1, 0xe8fa,
+  0x58c5, 0xef45,
+  0x58c7, 0xe4a6,
+  0x58ce, 0xf9b5,
+  0x58d1, 0xf7c9,
+  0x58d3, 0xed72,
+  0x58d5, 0xf8bd,
+  0x58d8, 0xe6a4,
+  0x58d9, 0xe255,
+  0x58de, 0xe265,
+  0x58df, 0xe676,
+  0x58e4, 0xedbd,
+  0x58eb, 0xea5d,
+  0x58ec, 0xf195,
+  0x58ef, 0xf1e0,
+  0x58f9, 0xf17c,
+  0x58fa, 0xf8be,
+  0x58fb, 0xeaeb,
+  0x58fd, 0xebf8,
+  0x590f, 0xf7be,
+  0x5914, 0xe395,
+  0x5915, 0xeb3a,
+  0x5916, 0xef72,
+  0x5919, 0xec64,
+  0x591a, 0xe49f,
+  0x591c, 0xeda8,
+  0x5922, 0xe7d3,
+  0x5927, 0xe4de,
+  0x5929, 0xf548,
+  0x592a, 0xf6bc,
+  0x592b, 0xe99f,
+  0x592d, 0xef7c,
+  0x592e, 0xed77,
+  0x5931, 0xecf7,
+  0x5937, 0xf138,
+  0x593e, 0xf893,
+  0x5944, 0xedf2,
+  0x5947, 0xe396,
+  0x5948, 0xe43f,
+  0x5949, 0xe975,
+  0x594e, 0xe335,
+  0x594f, 0xf3b4,
+  0x5950, 0xf941,
+  0x5951, 0xe19a,
+  0x5954, 0xe9c6,
+  0x5955, 0xf861,
+  0x5957, 0xf6df,
+  0x595a, 0xf838,
+  0x5960, 0xf297,
+  0x5962, 0xea5e,
+  0x5967, 0xeef3,
+  0x596a, 0xf6ac,
+  0x596b, 0xf0c4,
+  0x596c, 0xf1e1,
+  0x596d, 0xeb3b,
+  0x596e, 0xe9c7,
+  0x5973, 0xe443,
+  0x5974, 0xe44f,
+  0x5978, 0xe05c,
+  0x597d, 0xf8bf,
+  0x5982, 0xedfd,
+  0x5983, 0xe9e5,
+  0x5984, 0xe75d,
+  0x598a, 0xf196,
+  0x5993, 0xe397,
+  0x5996, 0xef7d,
+  0x5997, 0xe362,
+  0x5999, 0xe7d8,
+  0x59a5, 0xf676,
+  0x59a8, 0xe8aa,
+  0x59ac, 0xf6e0,
+  0x59b9, 0xe769,
+  0x59bb, 0xf533,
+  0x59be, 0xf56d,
+  0x59c3, 0xf2d1,
+  0x59c6, 0xe7b5,
+  0x59c9, 0xf1ab,
+  0x59cb, 0xecb7,
+  0x59d0, 0xf24b,
+  0x59d1, 0xe1b4,
+  0x59d3, 0xeb95,
+  0x59d4, 0xf05d,
+  0x59d9, 0xf197,
+  0x59da, 0xef7e,
+  0x59dc, 0xe0a9,
+  0x59dd, 0xf3af,
+  0x59e6, 0xe05d,
+  0x59e8, 0xf139,
+  0x59ea, 0xf47b,
+  0x59ec, 0xf9ef,
+  0x59ee, 0xf7f3,
+  0x59f8, 0xee51,
+  0x59fb, 0xf168,
+  0x59ff, 0xf1ac,
+  0x5a01, 0xf05e,
+  0x5a03, 0xef6f,
+  0x5a11, 0xea5f,
+  0x5a18, 0xe436,
+  0x5a1b, 0xeef4,
+  0x5a1c, 0xe3d6,
+  0x5a1f, 0xee52,
+  0x5a20, 0xece3,
+  0x5a25, 0xed40,
+  0x5a29, 0xe744,
+  0x5a36, 0xf635,
+  0x5a3c, 0xf4de,
+  0x5a41, 0xe6a5,
+  0x5a46, 0xf6e8,
+  0x5a49, 0xef56,
+  0x5a5a, 0xf8e6,
+  0x5a62, 0xe9e6,
+  0x5a66, 0xe9a0,
+  0x5a92, 0xe76a,
+  0x5a9a, 0xe83c,
+  0x5a9b, 0xf040,
+  0x5aa4, 0xecb8,
+  0x5ac1, 0xe03a,
+  0x5ac2, 0xebf9,
+  0x5ac4, 0xf041,
+  0x5ac9, 0xf47c,
+  0x5acc, 0xf87e,
+  0x5ae1, 0xf265,
+  0x5ae6, 0xf7f4,
+  0x5ae9, 0xe47c,
+  0x5b05, 0xf8fb,
+  0x5b09, 0xf9f0,
+  0x5b0b, 0xeb4d,
+  0x5b0c, 0xe273,
+  0x5b16, 0xf756,
+  0x5b2a, 0xea3e,
+  0x5b40, 0xeac5,
+  0x5b43, 0xedbe,
+  0x5b50, 0xf1ad,
+  0x5b51, 0xf87a,
+  0x5b54, 0xe1ee,
+  0x5b55, 0xf1a6,
+  0x5b57, 0xf1ae,
+  0x5b58, 0xf37d,
+  0x5b5a, 0xe9a1,
+  0x5b5c, 0xf1af,
+  0x5b5d, 0xf99a,
+  0x5b5f, 0xe77b,
+  0x5b63, 0xe19b,
+  0x5b64, 0xe1b5,
+  0x5b69, 0xf839,
+  0x5b6b, 0xebdd,
+  0x5b70, 0xec65,
+  0x5b71, 0xf1cf,
+  0x5b75, 0xe9a2,
+  0x5b78, 0xf7ca,
+  0x5b7a, 0xf078,
+  0x5b7c, 0xeded,
+  0x5b85, 0xe4eb,
+  0x5b87, 0xefd4,
+  0x5b88, 0xebfa,
+  0x5b89, 0xed5c,
+  0x5b8b, 0xebe4,
+  0x5b8c, 0xef57,
+  0x5b8f, 0xe26b,
+  0x5b93, 0xe965,
+  0x5b95, 0xf6b5,
+  0x5b96, 0xf995,
+  0x5b97, 0xf395,
+  0x5b98, 0xe23f,
+  0x5b99, 0xf3b5,
+  0x5b9a, 0xf2d2,
+  0x5b9b, 0xef58,
+  0x5b9c, 0xf0f1,
+  0x5ba2, 0xe0d4,
+  0x5ba3, 0xeb4e,
+  0x5ba4, 0xecf8,
+  0x5ba5, 0xf079,
+  0x5ba6, 0xf942,
+  0x5bac, 0xeb96,
+  0x5bae, 0xe2e0,
+  0x5bb0, 0xf235,
+  0x5bb3, 0xf83a,
+  0x5bb4, 0xee53,
+  0x5bb5, 0xebb2,
+  0x5bb6, 0xe03b,
+  0x5bb8, 0xece4,
+  0x5bb9, 0xefbb,
+  0x5bbf, 0xec66,
+  0x5bc0, 0xf4f2,
+  0x5bc2, 0xf266,
+  0x5bc3, 0xf042,
+  0x5bc4, 0xe398,
+  0x5bc5, 0xf169,
+  0x5bc6, 0xe85b,
+  0x5bc7, 0xe2a8,
+  0x5bcc, 0xe9a3,
+  0x5bd0, 0xe76b,
+  0x5bd2, 0xf7ce,
+  0x5bd3, 0xefd5,
+  0x5bd4, 0xecd1,
+  0x5bd7, 0xe44c,
+  0x5bde, 0xe73c,
+  0x5bdf, 0xf4cc,
+  0x5be1, 0xe1fb,
+  0x5be2, 0xf666,
+  0x5be4, 0xeef5,
+  0x5be5, 0xef91,
+  0x5be6, 0xecf9,
+  0x5be7, 0xe44b,
+  0x5be8, 0xf4f3,
+  0x5be9, 0xecfb,
+  0x5beb, 0xea60,
+  0x5bec, 0xe240,
+  0x5bee, 0xe699,
+  0x5bef, 0xf3d9,
+  0x5bf5, 0xf5c1,
+  0x5bf6, 0xe954,
+  0x5bf8, 0xf5bb,
+  0x5bfa, 0xea61,
+  0x5c01, 0xe976,
+  0x5c04, 0xea62,
+  0x5c07, 0xf1e2,
+  0x5c08, 0xf298,
+  0x5c09, 0xf05f,
+  0x5c0a, 0xf37e,
+  0x5c0b, 0xecfc,
+  0x5c0d, 0xe4df,
+  0x5c0e, 0xe4f4,
+  0x5c0f, 0xebb3,
+  0x5c11, 0xebb4,
+  0x5c16, 0xf563,
+  0x5c19, 0xeac6,
+  0x5c24, 0xefd6,
+  0x5c28, 0xe8ab,
+  0x5c31, 0xf636,
+  0x5c38, 0xecb9,
+  0x5c39, 0xf0c5,
+  0x5c3a, 0xf539,
+  0x5c3b, 0xe1b6,
+  0x5c3c, 0xe49b,
+  0x5c3e, 0xe83d,
+  0x5c3f, 0xe473,
+  0x5c40, 0xe2d1,
+  0x5c45, 0xe0dc,
+  0x5c46, 0xe19c,
+  0x5c48, 0xe2dd,
+  0x5c4b, 0xef39,
+  0x5c4d, 0xecbb,
+  0x5c4e, 0xecba,
+  0x5c51, 0xeb6a,
+  0x5c55, 0xf299,
+  0x5c5b, 0xe943,
+  0x5c60, 0xe4f5,
+  0x5c62, 0xe6a6,
+  0x5c64, 0xf645,
+  0x5c65, 0xe6db,
+  0x5c6c, 0xebd5,
+  0x5c6f, 0xe57a,
+  0x5c71, 0xeaa3,
+  0x5c79, 0xf9df,
+  0x5c90, 0xe399,
+  0x5c91, 0xf1d4,
+  0x5ca1, 0xe0aa,
+  0x5ca9, 0xed6b,
+  0x5cab, 0xebfb,
+  0x5cac, 0xe0a2,
+  0x5cb1, 0xe4e0,
+  0x5cb3, 0xed4f,
+  0x5cb5, 0xf8c0,
+  0x5cb7, 0xe84e,
+  0x5cb8, 0xed5d,
+  0x5cba, 0xe649,
+  0x5cbe, 0xf2c0,
+  0x5cc0, 0xebfc,
+  0x5cd9, 0xf649,
+  0x5ce0, 0xeac7,
+  0x5ce8, 0xed41,
+  0x5cef, 0xe977,
+  0x5cf0, 0xe978,
+  0x5cf4, 0xf866,
+  0x5cf6, 0xe4f6,
+  0x5cfb, 0xf3da,
+  0x5cfd, 0xf894,
+  0x5d07, 0xec9f,
+  0x5d0d, 0xe5cf,
+  0x5d0e, 0xe39a,
+  0x5d11, 0xe1df,
+  0x5d14, 0xf5cb,
+  0x5d16, 0xed92,
+  0x5d17, 0xe0ab,
+  0x5d19, 0xe6c4,
+  0x5d27, 0xeca0,
+  0x5d29, 0xe9da,
+  0x5d4b, 0xe83e,
+  0x5d4c, 0xe07e,
+  0x5d50, 0xe5b9,
+  0x5d69, 0xeca1,
+  0x5d6c, 0xef73,
+  0x5d6f, 0xf4ab,
+  0x5d87, 0xe2a9,
+  0x5d8b, 0xe4f7,
+  0x5d9d, 0xe593,
+  0x5da0, 0xe274,
+  0x5da2, 0xef94,
+  0x5daa, 0xedf5,
+  0x5db8, 0xeeae,
+  0x5dba, 0xe64a,
+  0x5dbc, 0xeaec,
+  0x5dbd, 0xed50,
+  0x5dcd, 0xef74,
+  0x5dd2, 0xe745,
+  0x5dd6, 0xed6c,
+  0x5ddd, 0xf549,
+  0x5dde, 0xf3b6,
+  0x5de1, 0xec6e,
+  0x5de2, 0xebb5,
+  0x5de5, 0xe1ef,
+  0x5de6, 0xf3a7,
+  0x5de7, 0xe275,
+  0x5de8, 0xe0dd,
+  0x5deb, 0xe7e3,
+  0x5dee, 0xf4ac,
+  0x5df1, 0xe39b,
+  0x5df2, 0xf13b,
+  0x5df3, 0xea63,
+  0x5df4, 0xf6e9,
+  0x5df7, 0xf7f5,
+  0x5dfd, 0xebde,
+  0x5dfe, 0xe0ee,
+  0x5e02, 0xecbc,
+  0x5e03, 0xf766,
+  0x5e06, 0xe8ee,
+  0x5e0c, 0xf9f1,
+  0x5e11, 0xf6b6,
+  0x5e16, 0xf56e,
+  0x5e19, 0xf47d,
+  0x5e1b, 0xe8d9,
+  0x5e1d, 0xf338,
+  0x5e25, 0xebfd,
+  0x5e2b, 0xea64,
+  0x5e2d, 0xeb3c,
+  0x5e33, 0xf1e3,
+  0x5e36, 0xe4e1,
+  0x5e38, 0xeac8,
+  0x5e3d, 0xe7b6,
+  0x5e3f, 0xf9ac,
+  0x5e40, 0xf2d3,
+  0x5e44, 0xed51,
+  0x5e45, 0xf77b,
+  0x5e47, 0xe8ac,
+  0x5e4c, 0xf956,
+  0x5e55, 0xe73d,
+  0x5e5f, 0xf64a,
+  0x5e61, 0xe8df,
+  0x5e62, 0xe4d3,
+  0x5e63, 0xf757,
+  0x5e72, 0xe05e,
+  0x5e73, 0xf751,
+  0x5e74, 0xe444,
+  0x5e77, 0xe944,
+  0x5e78, 0xf849,
+  0x5e79, 0xe05f,
+  0x5e7b, 0xf943,
+  0x5e7c, 0xf07a,
+  0x5e7d, 0xf07b,
+  0x5e7e, 0xe39c,
+  0x5e84, 0xf1e4,
+  0x5e87, 0xe9e7,
+  0x5e8a, 0xeac9,
+  0x5e8f, 0xeaed,
+  0x5e95, 0xf24c,
+  0x5e97, 0xf2c1,
+  0x5e9a, 0xe162,
+  0x5e9c, 0xe9a4,
+  0x5ea0, 0xeaca,
+  0x5ea6, 0xe4f8,
+  0x5ea7, 0xf3a8,
+  0x5eab, 0xe1b7,
+  0x5ead, 0xf2d4,
+  0x5eb5, 0xed6d,
+  0x5eb6, 0xeaee,
+  0x5eb7, 0xe0ac,
+  0x5eb8, 0xefbc,
+  0x5ebe, 0xf07c,
+  0x5ec2, 0xeacb,
+  0x5ec8, 0xf7bf,
+  0x5ec9, 0xe63f,
+  0x5eca, 0xe5c6,
+  0x5ed0, 0xe2aa,
+  0x5ed3, 0xe239,
+  0x5ed6, 0xe69a,
+  0x5eda, 0xf3b7,
+  0x5edb, 0xf29a,
+  0x5edf, 0xe7d9,
+  0x5ee0, 0xf4df,
+  0x5ee2, 0xf758,
+  0x5ee3, 0xe256,
+  0x5eec, 0xe5e6,
+  0x5ef3, 0xf576,
+  0x5ef6, 0xee55,
+  0x5ef7, 0xf2d5,
+  0x5efa, 0xe0ef,
+  0x5efb, 0xf96f,
+  0x5f01, 0xe937,
+  0x5f04, 0xe677,
+  0x5f0a, 0xf759,
+  0x5f0f, 0xecd2,
+  0x5f11, 0xecbd,
+  0x5f13, 0xe2e1,
+  0x5f14, 0xf350,
+  0x5f15, 0xf16a,
+  0x5f17, 0xe9d7,
+  0x5f18, 0xf8f0,
+  0x5f1b, 0xf13c,
+  0x5f1f, 0xf339,
+  0x5f26, 0xf867,
+  0x5f27, 0xf8c1,
+  0x5f29, 0xe450,
+  0x5f31, 0xedb0,
+  0x5f35, 0xf1e5,
+  0x5f3a, 0xe0ad,
+  0x5f3c, 0xf7b0,
+  0x5f48, 0xf6a5,
+  0x5f4a, 0xe0ae,
+  0x5f4c, 0xe83f,
+  0x5f4e, 0xe746,
+  0x5f56, 0xe4a7,
+  0x5f57, 0xf8b2,
+  0x5f59, 0xf9c4,
+  0x5f5b, 0xf13d,
+  0x5f62, 0xf8a1,
+  0x5f66, 0xede9,
+  0x5f67, 0xefee,
+  0x5f69, 0xf4f4,
+  0x5f6a, 0xf795,
+  0x5f6b, 0xf351,
+  0x5f6c, 0xea3f,
+  0x5f6d, 0xf740,
+  0x5f70, 0xf4e0,
+  0x5f71, 0xeeaf,
+  0x5f77, 0xe8ad,
+  0x5f79, 0xee45,
+  0x5f7c, 0xf7a8,
+  0x5f7f, 0xe9d8,
+  0x5f80, 0xef69,
+  0x5f81, 0xf2d6,
+  0x5f85, 0xe4e2,
+  0x5f87, 0xec6f,
+  0x5f8a, 0xf970,
+  0x5f8b, 0xe6c8,
+  0x5f8c, 0xf9ad,
+  0x5f90, 0xeaef,
+  0x5f91, 0xe163,
+  0x5f92, 0xe4f9,
+  0x5f97, 0xe592,
+  0x5f98, 0xe8c7,
+  0x5f99, 0xea65,
+  0x5f9e, 0xf396,
+  0x5fa0, 0xe5d0,
+  0x5fa1, 0xedd9,
+  0x5fa8, 0xf957,
+  0x5fa9, 0xe966,
+  0x5faa, 0xec70,
+  0x5fae, 0xe840,
+  0x5fb5, 0xf4a3,
+  0x5fb7, 0xe4ec,
+  0x5fb9, 0xf55b,
+  0x5fbd, 0xf9c5,
+  0x5fc3, 0xecfd,
+  0x5fc5, 0xf7b1,
+  0x5fcc, 0xe39d,
+  0x5fcd, 0xf16b,
+  0x5fd6, 0xf5bc,
+  0x5fd7, 0xf434,
+  0x5fd8, 0xe75e,
+  0x5fd9, 0xe75f,
+  0x5fe0, 0xf5f7,
+  0x5feb, 0xf671,
+  0x5ff5, 0xe447,
+  0x5ffd, 0xf8ec,
+  0x5fff, 0xe9c8,
+  0x600f, 0xed78,
+  0x6012, 0xe451,
+  0x6016, 0xf767,
+  0x601c, 0xe64b,
+  0x601d, 0xea66,
+  0x6020, 0xf6bd,
+  0x6021, 0xf13e,
+  0x6025, 0xe371,
+  0x6027, 0xeb97,
+  0x6028, 0xf043,
+  0x602a, 0xe266,
+  0x602f, 0xe135,
+  0x6041, 0xf198,
+  0x6042, 0xec71,
+  0x6043, 0xecbe,
+  0x604d, 0xf958,
+  0x6050, 0xe1f0,
+  0x6052, 0xf7f6,
+  0x6055, 0xeaf0,
+  0x6059, 0xedbf,
+  0x605d, 0xe24f,
+  0x6062, 0xf971,
+  0x6063, 0xf1b0,
+  0x6064, 0xf9d1,
+  0x6065, 0xf64b,
+  0x6068, 0xf7cf,
+  0x6069, 0xf0da,
+  0x606a, 0xe051,
+  0x606c, 0xe448,
+  0x606d, 0xe1f1,
+  0x606f, 0xecd3,
+  0x6070, 0xf9e6,
+  0x6085, 0xee7d,
+  0x6089, 0xecfa,
+  0x608c, 0xf33a,
+  0x608d, 0xf7d0,
+  0x6094, 0xf972,
+  0x6096, 0xf737,
+  0x609a, 0xebe5,
+  0x609b, 0xf29b,
+  0x609f, 0xeef6,
+  0x60a0, 0xf07d,
+  0x60a3, 0xf944,
+  0x60a4, 0xf5c2,
+  0x60a7, 0xe6dc,
+  0x60b0, 0xf397,
+  0x60b2, 0xe9e8,
+  0x60b3, 0xe4ed,
+  0x60b4, 0xf5fc,
+  0x60b6, 0xe84f,
+  0x60b8, 0xe19d,
+  0x60bc, 0xe4fa,
+  0x60bd, 0xf534,
+  0x60c5, 0xf2d7,
+  0x60c7, 0xe553,
+  0x60d1, 0xf8e3,
+  0x60da, 0xf8ed,
+  0x60dc, 0xeb3d,
+  0x60df, 0xf07e,
+  0x60e0, 0xf8b3,
+  0x60e1, 0xed52,
+  0x60f0, 0xf677,
+  0x60f1, 0xe46d,
+  0x60f3, 0xeacc,
+  0x60f6, 0xf959,
+  0x60f9, 0xeda9,
+  0x60fa, 0xeb98,
+  0x60fb, 0xf643,
+  0x6101, 0xebfe,
+  0x6106, 0xe0f0,
+  0x6108, 0xf091,
+  0x6109, 0xf092,
+  0x610d, 0xe850,
+  0x610e, 0xf744,
+  0x610f, 0xf0f2,
+  0x6115, 0xed53,
+  0x611a, 0xefd7,
+  0x611b, 0xed93,
+  0x611f, 0xe091,
+  0x6127, 0xe267,
+  0x6130, 0xf95a,
+  0x6134, 0xf4e1,
+  0x6137, 0xe0c4,
+  0x613c, 0xece5,
+  0x613e, 0xe0c5,
+  0x613f, 0xf044,
+  0x6142, 0xefbd,
+  0x6144, 0xe6c9,
+  0x6147, 0xf0db,
+  0x6148, 0xf1b1,
+  0x614a, 0xe153,
+  0x614b, 0xf6be,
+  0x614c, 0xf95b,
+  0x6153, 0xf796,
+  0x6155, 0xe7b7,
+  0x6158, 0xf4d3,
+  0x6159, 0xf4d4,
+  0x615d, 0xf6e4,
+  0x615f, 0xf6d1,
+  0x6162, 0xe747,
+  0x6163, 0xe241,
+  0x6164, 0xe052,
+  0x6167, 0xf8b4,
+  0x6168, 0xe0c6,
+  0x616b, 0xf398,
+  0x616e, 0xe5e7,
+  0x6170, 0xf060,
+  0x6176, 0xe164,
+  0x6177, 0xe0af,
+  0x617d, 0xf53a,
+  0x617e, 0xefaf,
+  0x6181, 0xf5c3,
+  0x6182, 0xefd8,
+  0x618a, 0xe9e9,
+  0x618e, 0xf3f3,
+  0x6190, 0xe5fb,
+  0x6191, 0xea4b,
+  0x6194, 0xf59d,
+  0x6198, 0xf9f3,
+  0x6199, 0xf9f2,
+  0x619a, 0xf6a6,
+  0x61a4, 0xe9c9,
+  0x61a7, 0xe563,
+  0x61a9, 0xe138,
+  0x61ab, 0xe851,
+  0x61ac, 0xe165,
+  0x61ae, 0xe7e4,
+  0x61b2, 0xf85a,
+  0x61b6, 0xede3,
+  0x61ba, 0xe4bc,
+  0x61be, 0xe092,
+  0x61c3, 0xe354,
+  0x61c7, 0xe060,
+  0x61c8, 0xf83b,
+  0x61c9, 0xf0eb,
+  0x61ca, 0xeef8,
+  0x61cb, 0xe7e5,
+  0x61e6, 0xe3d7,
+  0x61f2, 0xf4a4,
+  0x61f6, 0xe59d,
+  0x61f7, 0xf973,
+  0x61f8, 0xf868,
+  0x61fa, 0xf4d5,
+  0x61fc, 0xe2ab,
+  0x61ff, 0xf0f3,
+  0x6200, 0xe5fc,
+  0x6207, 0xe4d4,
+  0x6208, 0xe1fc,
+  0x620a, 0xe7e6,
+  0x620c, 0xec9b,
+  0x620d, 0xec31,
+  0x620e, 0xf0d4,
+  0x6210, 0xeb99,
+  0x6211, 0xed42,
+  0x6212, 0xe19e,
+  0x6216, 0xf8e4,
+  0x621a, 0xf53b,
+  0x621f, 0xe34d,
+  0x6221, 0xe093,
+  0x622a, 0xf2b8,
+  0x622e, 0xe6c0,
+  0x6230, 0xf29c,
+  0x6231, 0xf9f4,
+  0x6234, 0xe4e3,
+  0x6236, 0xf8c2,
+  0x623e, 0xe5e8,
+  0x623f, 0xe8ae,
+  0x6240, 0xebb6,
+  0x6241, 0xf747,
+  0x6247, 0xeb4f,
+  0x6248, 0xf8c3,
+  0x6249, 0xe9ea,
+  0x624b, 0xec32,
+  0x624d, 0xf236,
+  0x6253, 0xf678,
+  0x6258, 0xf697,
+  0x626e, 0xe9ca,
+  0x6271, 0xe372,
+  0x6276, 0xe9a6,
+  0x6279, 0xe9eb,
+  0x627c, 0xed9b,
+  0x627f, 0xecaf,
+  0x6280, 0xe39e,
+  0x6284, 0xf59e,
+  0x6289, 0xe14c,
+  0x628a, 0xf6ea,
+  0x6291, 0xede4,
+  0x6292, 0xeaf1,
+  0x6295, 0xf6e1,
+  0x6297, 0xf7f7,
+  0x6298, 0xf2b9,
+  0x629b, 0xf768,
+  0x62ab, 0xf7a9,
+  0x62b1, 0xf769,
+  0x62b5, 0xf24d,
+  0x62b9, 0xe756,
+  0x62bc, 0xed73,
+  0x62bd, 0xf5ce,
+  0x62c2, 0xe9d9,
+  0x62c7, 0xe7e7,
+  0x62c8, 0xe449,
+  0x62c9, 0xe5c3,
+  0x62cc, 0xe875,
+  0x62cd, 0xe860,
+  0x62cf, 0xe3d9,
+  0x62d0, 0xe268,
+  0x62d2, 0xe0de,
+  0x62d3, 0xf53c,
+  0x62d4, 0xe89d,
+  0x62d6, 0xf679,
+  0x62d7, 0xef95,
+  0x62d8, 0xe2ac,
+  0x62d9, 0xf392,
+  0x62db, 0xf59f,
+  0x62dc, 0xe8c8,
+  0x62ec, 0xe250,
+  0x62ed, 0xecd4,
+  0x62ee, 0xe3cf,
+  0x62ef, 0xf3f5,
+  0x62f1, 0xe1f2,
+  0x62f3, 0xe2eb,
+  0x62f7, 0xe1b8,
+  0x62fe, 0xeca6,
+  0x62ff, 0xe3da,
+  0x6301, 0xf435,
+  0x6307, 0xf436,
+  0x6309, 0xed5e,
+  0x6311, 0xe4fb,
+  0x632b, 0xf3a9,
+  0x632f, 0xf459,
+  0x633a, 0xf2d8,
+  0x633b, 0xee59,
+  0x633d, 0xe748,
+  0x633e, 0xf895,
+  0x6349, 0xf4b5,
+  0x634c, 0xf734,
+  0x634f, 0xe3f3,
+  0x6350, 0xee58,
+  0x6355, 0xf76a,
+  0x6367, 0xe979,
+  0x6368, 0xea67,
+  0x636e, 0xe0df,
+  0x6372, 0xe2ec,
+  0x6377, 0xf56f,
+  0x637a, 0xe3f4,
+  0x637b, 0xe44a,
+  0x637f, 0xeaf2,
+  0x6383, 0xebb7,
+  0x6388, 0xec33,
+  0x6389, 0xe4fc,
+  0x638c, 0xf1e6,
+  0x6392, 0xe8c9,
+  0x6396, 0xed9c,
+  0x6398, 0xe2de,
+  0x639b, 0xe260,
+  0x63a0, 0xe5d3,
+  0x63a1, 0xf4f5,
+  0x63a2, 0xf6ae,
+  0x63a5, 0xf2c8,
+  0x63a7, 0xe1f3,
+  0x63a8, 0xf5cf,
+  0x63a9, 0xedf3,
+  0x63aa, 0xf352,
+  0x63c0, 0xe061,
+  0x63c4, 0xf093,
+  0x63c6, 0xe336,
+  0x63cf, 0xe7da,
+  0x63d0, 0xf33b,
+  0x63d6, 0xf0e7,
+  0x63da, 0xedc0,
+  0x63db, 0xf945,
+  0x63e1, 0xed54,
+  0x63ed, 0xe139,
+  0x63ee, 0xf9c6,
+  0x63f4, 0xf045,
+  0x63f6, 0xedaa,
+  0x63f7, 0xeaba,
+  0x640d, 0xebdf,
+  0x640f, 0xe861,
+  0x6414, 0xebb8,
+  0x6416, 0xef96,
+  0x6417, 0xe4fd,
+  0x641c, 0xec34,
+  0x6422, 0xf45a,
+  0x642c, 0xe876,
+  0x642d, 0xf6b3,
+  0x643a, 0xf9cd,
+  0x643e, 0xf4b6,
+  0x6458, 0xf267,
+  0x6460, 0xf5c4,
+  0x6469, 0xe734,
+  0x646f, 0xf437,
+  0x6478, 0xe7b8,
+  0x6479, 0xe7b9,
+  0x647a, 0xf2c9,
+  0x6488, 0xe65e,
+  0x6491, 0xf6cb,
+  0x6492, 0xeaae,
+  0x6493, 0xef97,
+  0x649a, 0xe445,
+  0x649e, 0xe4d5,
+  0x64a4, 0xf55c,
+  0x64a5, 0xe89e,
+  0x64ab, 0xe7e8,
+  0x64ad, 0xf6eb,
+  0x64ae, 0xf5c9,
+  0x64b0, 0xf4bc,
+  0x64b2, 0xe862,
+  0x64bb, 0xe4b5,
+  0x64c1, 0xef46,
+  0x64c4, 0xe65f,
+  0x64c5, 0xf54a,
+  0x64c7, 0xf6c9,
+  0x64ca, 0xe13a,
+  0x64cd, 0xf353,
+  0x64ce, 0xe166,
+  0x64d2, 0xe363,
+  0x64d4, 0xe4bd,
+  0x64d8, 0xe8fb,
+  0x64da, 0xe0e0,
+  0x64e1, 0xe4e4,
+  0x64e2, 0xf699,
+  0x64e5, 0xe5ba,
+  0x64e6, 0xf4cd,
+  0x64e7, 0xe0e1,
+  0x64ec, 0xf0f4,
+  0x64f2, 0xf53d,
+  0x64f4, 0xf93a,
+  0x64fa, 0xf6ec,
+  0x64fe, 0xef98,
+  0x6500, 0xe877,
+  0x6504, 0xf6cc,
+  0x6518, 0xedc1,
+  0x651d, 0xeb7e,
+  0x6523, 0xe5fd,
+  0x652a, 0xe276,
+  0x652b, 0xf93b,
+  0x652c, 0xe5bb,
+  0x652f, 0xf438,
+  0x6536, 0xec35,
+  0x6537, 0xe1b9,
+  0x6538, 0xf094,
+  0x6539, 0xe0c7,
+  0x653b, 0xe1f4,
+  0x653e, 0xe8af,
+  0x653f, 0xf2d9,
+  0x6545, 0xe1ba,
+  0x6548, 0xf99b,
+  0x654d, 0xeaf3,
+  0x654e, 0xe277,
+  0x654f, 0xe852,
+  0x6551, 0xe2ad,
+  0x6556, 0xeef9,
+  0x6557, 0xf738,
+  0x655e, 0xf4e2,
+  0x6562, 0xe094,
+  0x6563, 0xeaa4,
+  0x6566, 0xe554,
+  0x656c, 0xe167,
+  0x656d, 0xedc2,
+  0x6572, 0xe1bb,
+  0x6574, 0xf2da,
+  0x6575, 0xf268,
+  0x6577, 0xe9a7,
+  0x6578, 0xec36,
+  0x657e, 0xeb50,
+  0x6582, 0xe640,
+  0x6583, 0xf75a,
+  0x6585, 0xf99c,
+  0x6587, 0xe7fe,
+  0x658c, 0xea40,
+  0x6590, 0xe9ec,
+  0x6591, 0xe878,
+  0x6597, 0xe570,
+  0x6599, 0xe69b,
+  0x659b, 0xe1d7,
+  0x659c, 0xea68,
+  0x659f, 0xf49a,
+  0x65a1, 0xed66,
+  0x65a4, 0xe355,
+  0x65a5, 0xf53e,
+  0x65a7, 0xe9a8,
+  0x65ab, 0xf1c5,
+  0x65ac, 0xf4d6,
+  0x65af, 0xea69,
+  0x65b0, 0xece6,
+  0x65b7, 0xe4a8,
+  0x65b9, 0xe8b0,
+  0x65bc, 0xedda,
+  0x65bd, 0xecbf,
+  0x65c1, 0xe8b1,
+  0x65c5, 0xe5e9,
+  0x65cb, 0xeb51,
+  0x65cc, 0xf2db,
+  0x65cf, 0xf379,
+  0x65d2, 0xe6b2,
+  0x65d7, 0xe39f,
+  0x65e0, 0xe7e9,
+  0x65e3, 0xe3a0,
+  0x65e5, 0xf17d,
+  0x65e6, 0xe4a9,
+  0x65e8, 0xf439,
+  0x65e9, 0xf354,
+  0x65ec, 0xec72,
+  0x65ed, 0xefef,
+  0x65f1, 0xf7d1,
+  0x65f4, 0xefd9,
+  0x65fa, 0xef6a,
+  0x65fb, 0xe853,
+  0x65fc, 0xe854,
+  0x65fd, 0xe555,
+  0x65ff, 0xeefa,
+  0x6606, 0xe1e0,
+  0x6607, 0xecb0,
+  0x6609, 0xe8b2,
+  0x660a, 0xf8c4,
+  0x660c, 0xf4e3,
+  0x660e, 0xe7a5,
+  0x660f, 0xf8e7,
+  0x6610, 0xe9cb,
+  0x6611, 0xe364,
+  0x6613, 0xee46,
+  0x6614, 0xeb3e,
+  0x6615, 0xf9da,
+  0x661e, 0xe945,
+  0x661f, 0xeb9a,
+  0x6620, 0xeeb1,
+  0x6625, 0xf5f0,
+  0x6627, 0xe76c,
+  0x6628, 0xf1c6,
+  0x662d, 0xebb9,
+  0x662f, 0xecc0,
+  0x6630, 0xf7c0,
+  0x6631, 0xeff0,
+  0x6634, 0xe7db,
+  0x6636, 0xf4e4,
+  0x663a, 0xe946,
+  0x663b, 0xed79,
+  0x6641, 0xf355,
+  0x6642, 0xecc1,
+  0x6643, 0xf95c,
+  0x6644, 0xf95d,
+  0x6649, 0xf45b,
+  0x664b, 0xf45c,
+  0x664f, 0xed5f,
+  0x6659, 0xf3db,
+  0x665b, 0xf869,
+  0x665d, 0xf3b8,
+  0x665e, 0xf9f5,
+  0x665f, 0xeb9b,
+  0x6664, 0xeefb,
+  0x6665, 0xf947,
+  0x6666, 0xf974,
+  0x6667, 0xf8c5,
+  0x6668, 0xece7,
+  0x6669, 0xe749,
+  0x666b, 0xf69a,
+  0x666e, 0xe955,
+  0x666f, 0xe168,
+  0x6673, 0xeb3f,
+  0x6674, 0xf577,
+  0x6676, 0xf2dc,
+  0x6677, 0xe2fc,
+  0x6678, 0xf2dd,
+  0x667a, 0xf43a,
+  0x6684, 0xf9be,
+  0x6687, 0xe03c,
+  0x6688, 0xf9bb,
+  0x6689, 0xf9c7,
+  0x668e, 0xeeb2,
+  0x6690, 0xf061,
+  0x6691, 0xeaf4,
+  0x6696, 0xe3ec,
+  0x6697, 0xed6e,
+  0x6698, 0xedc3,
+  0x669d, 0xe7a6,
+  0x66a0, 0xe1bc,
+  0x66a2, 0xf4e5,
+  0x66ab, 0xf1d5,
+  0x66ae, 0xe7ba,
+  0x66b2, 0xf1e7,
+  0x66b3, 0xf8b5,
+  0x66b4, 0xf77c,
+  0x66b9, 0xeb77,
+  0x66bb, 0xe169,
+  0x66be, 0xe556,
+  0x66c4, 0xeea5,
+  0x66c6, 0xe5f5,
+  0x66c7, 0xe4be,
+  0x66c9, 0xf99d,
+  0x66d6, 0xed94,
+  0x66d9, 0xeaf5,
+  0x66dc, 0xef9a,
+  0x66dd, 0xf77d,
+  0x66e0, 0xe257,
+  0x66e6, 0xf9f6,
+  0x66f0, 0xef68,
+  0x66f2, 0xe1d8,
+  0x66f3, 0xeed6,
+  0x66f4, 0xe16a,
+  0x66f7, 0xe073,
+  0x66f8, 0xeaf6,
+  0x66f9, 0xf357,
+  0x66fa, 0xf356,
+  0x66fc, 0xe74a,
+  0x66fe, 0xf3f4,
+  0x66ff, 0xf592,
+  0x6700, 0xf5cc,
+  0x6703, 0xf975,
+  0x6708, 0xf055,
+  0x6709, 0xf095,
+  0x670b, 0xe9db,
+  0x670d, 0xe967,
+  0x6714, 0xea9f,
+  0x6715, 0xf49b,
+  0x6717, 0xe5c7,
+  0x671b, 0xe760,
+  0x671d, 0xf358,
+  0x671e, 0xe3a1,
+  0x671f, 0xe3a2,
+  0x6726, 0xe7d4,
+  0x6727, 0xe678,
+  0x6728, 0xe7ca,
+  0x672a, 0xe841,
+  0x672b, 0xe757,
+  0x672c, 0xe972,
+  0x672d, 0xf4ce,
+  0x672e, 0xf5f4,
+  0x6731, 0xf3b9,
+  0x6734, 0xe863,
+  0x6736, 0xf67a,
+  0x673a, 0xe2f5,
+  0x673d, 0xf9ae,
+  0x6746, 0xe062,
+  0x6749, 0xeab4,
+  0x674e, 0xe6dd,
+  0x674f, 0xf84a,
+  0x6750, 0xf237,
+  0x6751, 0xf5bd,
+  0x6753, 0xf797,
+  0x6756, 0xf1e8,
+  0x675c, 0xe571,
+  0x675e, 0xe3a3,
+  0x675f, 0xebd6,
+  0x676d, 0xf7f8,
+  0x676f, 0xe8ca,
+  0x6770, 0xe0f9,
+  0x6771, 0xe564,
+  0x6773, 0xe7dc,
+  0x6775, 0xf24e,
+  0x6777, 0xf6ed,
+  0x677b, 0xe47e,
+  0x677e, 0xebe6,
+  0x677f, 0xf6f9,
+  0x6787, 0xe9ed,
+  0x6789, 0xef6b,
+  0x678b, 0xe8b3,
+  0x678f, 0xe3f7,
+  0x6790, 0xeb40,
+  0x6793, 0xe572,
+  0x6795, 0xf667,
+  0x6797, 0xe6f9,
+  0x679a, 0xe76d,
+  0x679c, 0xe1fd,
+  0x679d, 0xf43b,
+  0x67af, 0xe1bd,
+  0x67b0, 0xf752,
+  0x67b3, 0xf43c,
+  0x67b6, 0xe03d,
+  0x67b7, 0xe03e,
+  0x67b8, 0xe2ae,
+  0x67be, 0xecc2,
+  0x67c4, 0xe947,
+  0x67cf, 0xe8da,
+  0x67d0, 0xe7bb,
+  0x67d1, 0xe095,
+  0x67d2, 0xf663,
+  0x67d3, 0xee9a,
+  0x67d4, 0xf097,
+  0x67da, 0xf098,
+  0x67dd, 0xf69b,
+  0x67e9, 0xe2af,
+  0x67ec, 0xe063,
+  0x67ef, 0xe03f,
+  0x67f0, 0xe440,
+  0x67f1, 0xf3ba,
+  0x67f3, 0xe6b3,
+  0x67f4, 0xecc3,
+  0x67f5, 0xf4fd,
+  0x67f6, 0xea6a,
+  0x67fb, 0xea6b,
+  0x67fe, 0xf2de,
+  0x6812, 0xec73,
+  0x6813, 0xf29d,
+  0x6816, 0xeaf7,
+  0x6817, 0xe6ca,
+  0x6821, 0xe278,
+  0x6822, 0xe8db,
+  0x682a, 0xf3bb,
+  0x682f, 0xeff1,
+  0x6838, 0xf847,
+  0x6839, 0xe356,
+  0x683c, 0xe13b,
+  0x683d, 0xf238,
+  0x6840, 0xe0fa,
+  0x6841, 0xf7f9,
+  0x6842, 0xe19f,
+  0x6843, 0xe4fe,
+  0x6848, 0xed60,
+  0x684e, 0xf47e,
+  0x6850, 0xe565,
+  0x6851, 0xeacd,
+  0x6853, 0xf948,
+  0x6854, 0xe3d0,
+  0x686d, 0xf45d,
+  0x6876, 0xf6d2,
+  0x687f, 0xe064,
+  0x6881, 0xe5d9,
+  0x6885, 0xe76e,
+  0x688f, 0xe1d9,
+  0x6893, 0xf239,
+  0x6894, 0xf64c,
+  0x6897, 0xe16b,
+  0x689d, 0xf359,
+  0x689f, 0xf99e,
+  0x68a1, 0xef59,
+  0x68a2, 0xf5a0,
+  0x68a7, 0xeefc,
+  0x68a8, 0xe6de,
+  0x68ad, 0xea6c,
+  0x68af, 0xf33c,
+  0x68b0, 0xe1a0,
+  0x68b1, 0xe1e1,
+  0x68b3, 0xebba,
+  0x68b5, 0xe8ef,
+  0x68b6, 0xe842,
+  0x68c4, 0xe3a5,
+  0x68c5, 0xe948,
+  0x68c9, 0xe798,
+  0x68cb, 0xe3a4,
+  0x68cd, 0xe1e2,
+  0x68d2, 0xe97a,
+  0x68d5, 0xf399,
+  0x68d7, 0xf35a,
+  0x68d8, 0xe34e,
+  0x68da, 0xe9dc,
+  0x68df, 0xe566,
+  0x68e0, 0xe4d6,
+  0x68e7, 0xf1d0,
+  0x68e8, 0xe1a1,
+  0x68ee, 0xeab5,
+  0x68f2, 0xeaf8,
+  0x68f9, 0xe531,
+  0x68fa, 0xe242,
+  0x6900, 0xef5a,
+  0x6905, 0xf0f5,
+  0x690d, 0xecd5,
+  0x690e, 0xf5d0,
+  0x6912, 0xf5a1,
+  0x6927, 0xe7a7,
+  0x6930, 0xedab,
+  0x693d, 0xee5b,
+  0x693f, 0xf5f1,
+  0x694a, 0xedc5,
+  0x6953, 0xf7a3,
+  0x6954, 0xeb6b,
+  0x6955, 0xf67b,
+  0x6957, 0xe0f1,
+  0x6959, 0xe7ea,
+  0x695a, 0xf5a2,
+  0x695e, 0xe6d1,
+  0x6960, 0xe3f8,
+  0x6961, 0xf09a,
+  0x6962, 0xf09b,
+  0x6963, 0xe843,
+  0x6968, 0xf2df,
+  0x696b, 0xf3ef,
+  0x696d, 0xedf6,
+  0x696e, 0xf24f,
+  0x696f, 0xec74,
+  0x6975, 0xe34f,
+  0x6977, 0xf83c,
+  0x6978, 0xf5d1,
+  0x6979, 0xeeb3,
+  0x6995, 0xefbe,
+  0x699b, 0xf45e,
+  0x699c, 0xe8b4,
+  0x69a5, 0xf95e,
+  0x69a7, 0xe9ee,
+  0x69ae, 0xeeb4,
+  0x69b4, 0xe6b4,
+  0x69bb, 0xf6b4,
+  0x69c1, 0xe1be,
+  0x69c3, 0xe879,
+  0x69cb, 0xe2b0,
+  0x69cc, 0xf6d9,
+  0x69cd, 0xf4e6,
+  0x69d0, 0xe269,
+  0x69e8, 0xe23a,
+  0x69ea, 0xe0c8,
+  0x69fb, 0xe337,
+  0x69fd, 0xf35b,
+  0x69ff, 0xe357,
+  0x6a02, 0xed55,
+  0x6a0a, 0xe8e0,
+  0x6a11, 0xe5da,
+  0x6a13, 0xe6a7,
+  0x6a17, 0xf250,
+  0x6a19, 0xf798,
+  0x6a1e, 0xf5d2,
+  0x6a1f, 0xf1e9,
+  0x6a21, 0xe7bc,
+  0x6a23, 0xedc6,
+  0x6a35, 0xf5a3,
+  0x6a38, 0xe864,
+  0x6a39, 0xec37,
+  0x6a3a, 0xf8fc,
+  0x6a3d, 0xf3dc,
+  0x6a44, 0xe096,
+  0x6a48, 0xef9c,
+  0x6a4b, 0xe279,
+  0x6a52, 0xeff8,
+  0x6a53, 0xec75,
+  0x6a58, 0xe349,
+  0x6a59, 0xe594,
+  0x6a5f, 0xe3a6,
+  0x6a61, 0xeace,
+  0x6a6b, 0xf996,
+  0x6a80, 0xe4aa,
+  0x6a84, 0xe13c,
+  0x6a89, 0xf2e0,
+  0x6a8d, 0xede5,
+  0x6a8e, 0xe365,
+  0x6a97, 0xe8fc,
+  0x6a9c, 0xf976,
+  0x6aa2, 0xe0fe,
+  0x6aa3, 0xf1ea,
+  0x6ab3, 0xea41,
+  0x6abb, 0xf7e3,
+  0x6ac2, 0xe532,
+  0x6ac3, 0xe2f6,
+  0x6ad3, 0xe660,
+  0x6ada, 0xe5ea,
+  0x6adb, 0xf3ee,
+  0x6af6, 0xf85b,
+  0x6afb, 0xeda1,
+  0x6b04, 0xe5b1,
+  0x6b0a, 0xe2ed,
+  0x6b0c, 0xf1eb,
+  0x6b12, 0xe5b2,
+  0x6b16, 0xe5bc,
+  0x6b20, 0xf9e2,
+  0x6b21, 0xf4ad,
+  0x6b23, 0xf9db,
+  0x6b32, 0xefb0,
+  0x6b3a, 0xe3a7,
+  0x6b3d, 0xf9e3,
+  0x6b3e, 0xe243,
+  0x6b46, 0xf9e4,
+  0x6b47, 0xf85e,
+  0x6b4c, 0xe040,
+  0x6b4e, 0xf6a7,
+  0x6b50, 0xe2b1,
+  0x6b5f, 0xee32,
+  0x6b61, 0xf946,
+  0x6b62, 0xf43d,
+  0x6b63, 0xf2e1,
+  0x6b64, 0xf4ae,
+  0x6b65, 0xe956,
+  0x6b66, 0xe7eb,
+  0x6b6a, 0xef70,
+  0x6b72, 0xeba8,
+  0x6b77, 0xe5f6,
+  0x6b78, 0xe2fd,
+  0x6b7b, 0xea6d,
+  0x6b7f, 0xe7d1,
+  0x6b83, 0xed7a,
+  0x6b84, 0xf45f,
+  0x6b86, 0xf6bf,
+  0x6b89, 0xec76,
+  0x6b8a, 0xec38,
+  0x6b96, 0xecd6,
+  0x6b98, 0xf1d1,
+  0x6b9e, 0xeff9,
+  0x6bae, 0xe641,
+  0x6baf, 0xea42,
+  0x6bb2, 0xeb78,
+  0x6bb5, 0xe4ab,
+  0x6bb7, 0xf0dc,
+  0x6bba, 0xeaaf,
+  0x6bbc, 0xe053,
+  0x6bbf, 0xf29e,
+  0x6bc1, 0xf9c3,
+  0x6bc5, 0xf0f6,
+  0x6bc6, 0xe2b2,
+  0x6bcb, 0xe7ec,
+  0x6bcd, 0xe7bd,
+  0x6bcf, 0xe76f,
+  0x6bd2, 0xe548,
+  0x6bd3, 0xf0be,
+  0x6bd4, 0xe9ef,
+  0x6bd6, 0xe9f0,
+  0x6bd7, 0xe9f1,
+  0x6bd8, 0xe9f2,
+  0x6bdb, 0xe7be,
+  0x6beb, 0xf8c6,
+  0x6bec, 0xe2b3,
+  0x6c08, 0xf29f,
+  0x6c0f, 0xed3b,
+  0x6c11, 0xe855,
+  0x6c13, 0xe77c,
+  0x6c23, 0xe3a8,
+  0x6c34, 0xec39,
+  0x6c37, 0xea4c,
+  0x6c38, 0xeeb5,
+  0x6c3e, 0xe8f0,
+  0x6c40, 0xf2e2,
+  0x6c41, 0xf3f0,
+  0x6c42, 0xe2b4,
+  0x6c4e, 0xe8f1,
+  0x6c50, 0xeb41,
+  0x6c55, 0xeaa5,
+  0x6c57, 0xf7d2,
+  0x6c5a, 0xeefd,
+  0x6c5d, 0xee33,
+  0x6c5e, 0xf8f1,
+  0x6c5f, 0xe0b0,
+  0x6c60, 0xf43e,
+  0x6c68, 0xe1e7,
+  0x6c6a, 0xef6c,
+  0x6c6d, 0xeed7,
+  0x6c70, 0xf6c0,
+  0x6c72, 0xe373,
+  0x6c76, 0xe831,
+  0x6c7a, 0xe14d,
+  0x6c7d, 0xe3a9,
+  0x6c7e, 0xe9cc,
+  0x6c81, 0xecfe,
+  0x6c82, 0xe3aa,
+  0x6c83, 0xef3a,
+  0x6c85, 0xf046,
+  0x6c86, 0xf7fa,
+  0x6c87, 0xee5c,
+  0x6c88, 0xf668,
+  0x6c8c, 0xe557,
+  0x6c90, 0xe7cb,
+  0x6c92, 0xe7d2,
+  0x6c93, 0xe4cb,
+  0x6c94, 0xe799,
+  0x6c95, 0xe839,
+  0x6c96, 0xf5f8,
+  0x6c99, 0xea6e,
+  0x6c9a, 0xf43f,
+  0x6c9b, 0xf739,
+  0x6cab, 0xe758,
+  0x6cae, 0xf251,
+  0x6cb3, 0xf7c1,
+  0x6cb8, 0xe9f3,
+  0x6cb9, 0xf09c,
+  0x6cbb, 0xf64d,
+  0x6cbc, 0xebbb,
+  0x6cbd, 0xe1bf,
+  0x6cbe, 0xf564,
+  0x6cbf, 0xee5d,
+  0x6cc1, 0xf95f,
+  0x6cc2, 0xf8a2,
+  0x6cc4, 0xeb6c,
+  0x6cc9, 0xf54b,
+  0x6cca, 0xe865,
+  0x6ccc, 0xf7b2,
+  0x6cd3, 0xf8f2,
+  0x6cd5, 0xe8f6,
+  0x6cd7, 0xea6f,
+  0x6cdb, 0xe8f2,
+  0x6ce1, 0xf76c,
+  0x6ce2, 0xf6ee,
+  0x6ce3, 0xf0e8,
+  0x6ce5, 0xe49c,
+  0x6ce8, 0xf3bc,
+  0x6ceb, 0xf86a,
+  0x6cee, 0xe87a,
+  0x6cef, 0xe856,
+  0x6cf0, 0xf6c1,
+  0x6cf3, 0xeeb6,
+  0x6d0b, 0xedc7,
+  0x6d0c, 0xe63c,
+  0x6d11, 0xe957,
+  0x6d17, 0xeba9,
+  0x6d19, 0xec3a,
+  0x6d1b, 0xe5a6,
+  0x6d1e, 0xe567,
+  0x6d25, 0xf460,
+  0x6d27, 0xf09d,
+  0x6d29, 0xeb6d,
+  0x6d2a, 0xf8f3,
+  0x6d32, 0xf3bd,
+  0x6d35, 0xec77,
+  0x6d36, 0xf9d7,
+  0x6d38, 0xe258,
+  0x6d39, 0xf047,
+  0x6d3b, 0xf950,
+  0x6d3d, 0xf9e7,
+  0x6d3e, 0xf6ef,
+  0x6d41, 0xe6b5,
+  0x6d59, 0xf2ba,
+  0x6d5a, 0xf3dd,
+  0x6d5c, 0xea43,
+  0x6d63, 0xef5b,
+  0x6d66, 0xf76d,
+  0x6d69, 0xf8c7,
+  0x6d6a, 0xe5c8,
+  0x6d6c, 0xe6df,
+  0x6d6e, 0xe9a9,
+  0x6d74, 0xefb1,
+  0x6d77, 0xf83d,
+  0x6d78, 0xf669,
+  0x6d79, 0xf896,
+  0x6d7f, 0xf73a,
+  0x6d85, 0xee7e,
+  0x6d87, 0xe16c,
+  0x6d88, 0xebbc,
+  0x6d89, 0xeb91,
+  0x6d8c, 0xefbf,
+  0x6d8d, 0xf99f,
+  0x6d8e, 0xee5e,
+  0x6d91, 0xebd7,
+  0x6d93, 0xee5f,
+  0x6d95, 0xf593,
+  0x6daf, 0xed95,
+  0x6db2, 0xed9d,
+  0x6db5, 0xf7e4,
+  0x6dc0, 0xf2e3,
+  0x6dc3, 0xe2ee,
+  0x6dc4, 0xf64e,
+  0x6dc5, 0xeb42,
+  0x6dc6, 0xf9a0,
+  0x6dc7, 0xe3ab,
+  0x6dcb, 0xe6fa,
+  0x6dcf, 0xf8c8,
+  0x6dd1, 0xec67,
+  0x6dd8, 0xe533,
+  0x6dd9, 0xf39a,
+  0x6dda, 0xe6a8,
+  0x6dde, 0xebe7,
+  0x6de1, 0xe4bf,
+  0x6de8, 0xf2e4,
+  0x6dea, 0xe6c5,
+  0x6deb, 0xf0e2,
+  0x6dee, 0xf977,
+  0x6df1, 0xed32,
+  0x6df3, 0xec78,
+  0x6df5, 0xee60,
+  0x6df7, 0xf8e8,
+  0x6df8, 0xf578,
+  0x6df9, 0xedf4,
+  0x6dfa, 0xf54c,
+  0x6dfb, 0xf565,
+  0x6e17, 0xeab6,
+  0x6e19, 0xf949,
+  0x6e1a, 0xf252,
+  0x6e1b, 0xe097,
+  0x6e1f, 0xf2e5,
+  0x6e20, 0xe0e2,
+  0x6e21, 0xe534,
+  0x6e23, 0xea70,
+  0x6e24, 0xe89f,
+  0x6e25, 0xed56,
+  0x6e26, 0xef4e,
+  0x6e2b, 0xeb6e,
+  0x6e2c, 0xf644,
+  0x6e2d, 0xf062,
+  0x6e2f, 0xf7fb,
+  0x6e32, 0xeb52,
+  0x6e34, 0xe074,
+  0x6e36, 0xeeb7,
+  0x6e38, 0xf09f,
+  0x6e3a, 0xe7dd,
+  0x6e3c, 0xe844,
+  0x6e3d, 0xf23a,
+  0x6e3e, 0xf8e9,
+  0x6e43, 0xe8cb,
+  0x6e44, 0xe845,
+  0x6e4a, 0xf3be,
+  0x6e4d, 0xe4ac,
+  0x6e56, 0xf8c9,
+  0x6e58, 0xeacf,
+  0x6e5b, 0xe4c0,
+  0x6e5c, 0xecd7,
+  0x6e5e, 0xf2e6,
+  0x6e5f, 0xf960,
+  0x6e67, 0xefc0,
+  0x6e6b, 0xf5d3,
+  0x6e6e, 0xf16c,
+  0x6e6f, 0xf6b7,
+  0x6e72, 0xf048,
+  0x6e73, 0xe3f9,
+  0x6e7a, 0xe958,
+  0x6e90, 0xf049,
+  0x6e96, 0xf3de,
+  0x6e9c, 0xe6b6,
+  0x6e9d, 0xe2b5,
+  0x6e9f, 0xe7a8,
+  0x6ea2, 0xf17e,
+  0x6ea5, 0xe9aa,
+  0x6eaa, 0xe1a2,
+  0x6eab, 0xef3e,
+  0x6eaf, 0xebbd,
+  0x6eb1, 0xf461,
+  0x6eb6, 0xefc1,
+  0x6eba, 0xe49e,
+  0x6ec2, 0xe8b5,
+  0x6ec4, 0xf4e7,
+  0x6ec5, 0xe7a0,
+  0x6ec9, 0xf961,
+  0x6ecb, 0xf1b2,
+  0x6ecc, 0xf53f,
+  0x6ece, 0xf8a3,
+  0x6ed1, 0xf951,
+  0x6ed3, 0xf23b,
+  0x6ed4, 0xe535,
+  0x6eef, 0xf594,
+  0x6ef4, 0xf269,
+  0x6ef8, 0xf8ca,
+  0x6efe, 0xe1e3,
+  0x6eff, 0xe74b,
+  0x6f01, 0xeddb,
+  0x6f02, 0xf799,
+  0x6f06, 0xf664,
+  0x6f0f, 0xe6a9,
+  0x6f11, 0xe0c9,
+  0x6f14, 0xee61,
+  0x6f15, 0xf35c,
+  0x6f20, 0xe73e,
+  0x6f22, 0xf7d3,
+  0x6f23, 0xe5fe,
+  0x6f2b, 0xe74c,
+  0x6f2c, 0xf440,
+  0x6f31, 0xec3b,
+  0x6f32, 0xf4e8,
+  0x6f38, 0xf2c2,
+  0x6f3f, 0xf1ec,
+  0x6f41, 0xeeb8,
+  0x6f51, 0xe8a0,
+  0x6f54, 0xe14e,
+  0x6f57, 0xf49e,
+  0x6f58, 0xe87b,
+  0x6f5a, 0xec68,
+  0x6f5b, 0xf1d6,
+  0x6f5e, 0xe661,
+  0x6f5f, 0xeb43,
+  0x6f62, 0xf962,
+  0x6f64, 0xf0c8,
+  0x6f6d, 0xe4c1,
+  0x6f6e, 0xf35d,
+  0x6f70, 0xe2f7,
+  0x6f7a, 0xf1d2,
+  0x6f7c, 0xe568,
+  0x6f7d, 0xe959,
+  0x6f7e, 0xe6f1,
+  0x6f81, 0xeabb,
+  0x6f84, 0xf4a5,
+  0x6f88, 0xf55d,
+  0x6f8d, 0xf3bf,
+  0x6f8e, 0xf741,
+  0x6f90, 0xeffa,
+  0x6f94, 0xf8cb,
+  0x6f97, 0xe065,
+  0x6fa3, 0xf7d4,
+  0x6fa4, 0xf6ca,
+  0x6fa7, 0xe658,
+  0x6fae, 0xf978,
+  0x6faf, 0xf4bd,
+  0x6fb1, 0xf2a0,
+  0x6fb3, 0xeefe,
+  0x6fb9, 0xe4c2,
+  0x6fbe, 0xe4b6,
+  0x6fc0, 0xe13d,
+  0x6fc1, 0xf69c,
+  0x6fc2, 0xe642,
+  0x6fc3, 0xe468,
+  0x6fca, 0xeed8,
+  0x6fd5, 0xeca5,
+  0x6fda, 0xeeb9,
+  0x6fdf, 0xf33d,
+  0x6fe0, 0xf8cc,
+  0x6fe1, 0xf0a1,
+  0x6fe4, 0xe536,
+  0x6fe9, 0xf8cd,
+  0x6feb, 0xe5bd,
+  0x6fec, 0xf3df,
+  0x6fef, 0xf69d,
+  0x6ff1, 0xea44,
+  0x6ffe, 0xe5eb,
+  0x7001, 0xedc8,
+  0x7005, 0xf8a4,
+  0x7006, 0xe549,
+  0x7009, 0xea71,
+  0x700b, 0xed33,
+  0x700f, 0xe6b7,
+  0x7011, 0xf77e,
+  0x7015, 0xea45,
+  0x7018, 0xe662,
+  0x701a, 0xf7d5,
+  0x701b, 0xeeba,
+  0x701c, 0xf0d5,
+  0x701d, 0xe5f7,
+  0x701e, 0xf2e7,
+  0x701f, 0xebbe,
+  0x7023, 0xf83e,
+  0x7027, 0xe679,
+  0x7028, 0xe67e,
+  0x702f, 0xeebb,
+  0x7037, 0xf15b,
+  0x703e, 0xe5b3,
+  0x704c, 0xe244,
+  0x7050, 0xf8a5,
+  0x7051, 0xebee,
+  0x7058, 0xf6a8,
+  0x705d, 0xf8ce,
+  0x7063, 0xe74d,
+  0x706b, 0xf8fd,
+  0x7070, 0xf979,
+  0x7078, 0xe2b6,
+  0x707c, 0xf1c7,
+  0x707d, 0xf23c,
+  0x7085, 0xe16d,
+  0x708a, 0xf637,
+  0x708e, 0xee9c,
+  0x7092, 0xf5a4,
+  0x7098, 0xf9dc,
+  0x7099, 0xf1b3,
+  0x709a, 0xe259,
+  0x70a1, 0xf2e8,
+  0x70a4, 0xebbf,
+  0x70ab, 0xf86b,
+  0x70ac, 0xe0e3,
+  0x70ad, 0xf6a9,
+  0x70af, 0xf8a6,
+  0x70b3, 0xe949,
+  0x70b7, 0xf3c0,
+  0x70b8, 0xf1c8,
+  0x70b9, 0xf2c3,
+  0x70c8, 0xe63d,
+  0x70cb, 0xf9ce,
+  0x70cf, 0xef31,
+  0x70d8, 0xf8f4,
+  0x70d9, 0xe5a7,
+  0x70dd, 0xf3f6,
+  0x70df, 0xee63,
+  0x70f1, 0xe16e,
+  0x70f9, 0xf742,
+  0x70fd, 0xe97b,
+  0x7104, 0xf9b6,
+  0x7109, 0xedea,
+  0x710c, 0xf3e0,
+  0x7119, 0xe8cc,
+  0x711a, 0xe9cd,
+  0x711e, 0xe558,
+  0x7121, 0xe7ed,
+  0x7126, 0xf5a5,
+  0x7130, 0xee9d,
+  0x7136, 0xee64,
+  0x7147, 0xf9c8,
+  0x7149, 0xe631,
+  0x714a, 0xf9bf,
+  0x714c, 0xf963,
+  0x714e, 0xf2a1,
+  0x7150, 0xeebc,
+  0x7156, 0xe3ee,
+  0x7159, 0xee65,
+  0x715c, 0xeff2,
+  0x715e, 0xeab0,
+  0x7164, 0xe770,
+  0x7165, 0xf94a,
+  0x7166, 0xf9af,
+  0x7167, 0xf35e,
+  0x7169, 0xe8e1,
+  0x716c, 0xedc9,
+  0x716e, 0xf1b4,
+  0x717d, 0xeb53,
+  0x7184, 0xecd8,
+  0x7189, 0xeffb,
+  0x718a, 0xf038,
+  0x718f, 0xf9b7,
+  0x7192, 0xf8a7,
+  0x7194, 0xefc2,
+  0x7199, 0xf9f7,
+  0x719f, 0xec69,
+  0x71a2, 0xe97c,
+  0x71ac, 0xef32,
+  0x71b1, 0xee92,
+  0x71b9, 0xf9f8,
+  0x71ba, 0xf9f9,
+  0x71be, 0xf64f,
+  0x71c1, 0xeea7,
+  0x71c3, 0xee67,
+  0x71c8, 0xe595,
+  0x71c9, 0xe559,
+  0x71ce, 0xe69c,
+  0x71d0, 0xe6f2,
+  0x71d2, 0xebc0,
+  0x71d4, 0xe8e2,
+  0x71d5, 0xee68,
+  0x71df, 0xeebd,
+  0x71e5, 0xf35f,
+  0x71e6, 0xf4be,
+  0x71e7, 0xec3c,
+  0x71ed, 0xf5b7,
+  0x71ee, 0xeb92,
+  0x71fb, 0xf9b8,
+  0x71fc, 0xece8,
+  0x71fe, 0xe537,
+  0x71ff, 0xef9e,
+  0x7200, 0xf862,
+  0x7206, 0xf791,
+  0x7210, 0xe663,
+  0x721b, 0xe5b4,
+  0x722a, 0xf360,
+  0x722c, 0xf6f0,
+  0x722d, 0xf243,
+  0x7230, 0xf04a,
+  0x7232, 0xf063,
+  0x7235, 0xf1c9,
+  0x7236, 0xe9ab,
+  0x723a, 0xedac,
+  0x723b, 0xf9a1,
+  0x723d, 0xead0,
+  0x723e, 0xf143,
+  0x7240, 0xead1,
+  0x7246, 0xf1ed,
+  0x7247, 0xf748,
+  0x7248, 0xf6fa,
+  0x724c, 0xf73b,
+  0x7252, 0xf570,
+  0x7258, 0xe54a,
+  0x7259, 0xed43,
+  0x725b, 0xefda,
+  0x725d, 0xea46,
+  0x725f, 0xe7bf,
+  0x7261, 0xe7c0,
+  0x7262, 0xe691,
+  0x7267, 0xe7cc,
+  0x7269, 0xe83a,
+  0x7272, 0xeae5,
+  0x7279, 0xf6e5,
+  0x727d, 0xe142,
+  0x7280, 0xeaf9,
+  0x7281, 0xe6e0,
+  0x72a2, 0xe54b,
+  0x72a7, 0xf9fa,
+  0x72ac, 0xe143,
+  0x72af, 0xe8f3,
+  0x72c0, 0xead2,
+  0x72c2, 0xe25a,
+  0x72c4, 0xf26a,
+  0x72ce, 0xed74,
+  0x72d0, 0xf8cf,
+  0x72d7, 0xe2b7,
+  0x72d9, 0xf253,
+  0x72e1, 0xe27a,
+  0x72e9, 0xec3d,
+  0x72f8, 0xe6e1,
+  0x72f9, 0xf897,
+  0x72fc, 0xe5c9,
+  0x72fd, 0xf73c,
+  0x730a, 0xeed9,
+  0x7316, 0xf4e9,
+  0x731b, 0xe77d,
+  0x731c, 0xecc4,
+  0x731d, 0xf393,
+  0x7325, 0xef75,
+  0x7329, 0xeb9c,
+  0x732a, 0xf254,
+  0x732b, 0xe7de,
+  0x7336, 0xf0a2,
+  0x7337, 0xf0a3,
+  0x733e, 0xf952,
+  0x733f, 0xf04b,
+  0x7344, 0xef3b,
+  0x7345, 0xea72,
+  0x7350, 0xf1ef,
+  0x7352, 0xef33,
+  0x7357, 0xe2f1,
+  0x7368, 0xe54c,
+  0x736a, 0xf97a,
+  0x7370, 0xeebe,
+  0x7372, 0xf994,
+  0x7375, 0xe644,
+  0x7378, 0xec3e,
+  0x737a, 0xe4b7,
+  0x737b, 0xf85c,
+  0x7384, 0xf86c,
+  0x7386, 0xf1b5,
+  0x7387, 0xebe3,
+  0x7389, 0xef3c,
+  0x738b, 0xef6d,
+  0x738e, 0xf2e9,
+  0x7394, 0xf54d,
+  0x7396, 0xe2b8,
+  0x7397, 0xefdb,
+  0x7398, 0xe3ac,
+  0x739f, 0xe857,
+  0x73a7, 0xf0c9,
+  0x73a9, 0xef5c,
+  0x73ad, 0xea47,
+  0x73b2, 0xe64c,
+  0x73b3, 0xe4e5,
+  0x73b9, 0xf86d,
+  0x73c0, 0xe866,
+  0x73c2, 0xe041,
+  0x73c9, 0xe858,
+  0x73ca, 0xeaa6,
+  0x73cc, 0xf7b3,
+  0x73cd, 0xf462,
+  0x73cf, 0xe054,
+  0x73d6, 0xe25b,
+  0x73d9, 0xe1f5,
+  0x73dd, 0xf9b0,
+  0x73de, 0xe5a8,
+  0x73e0, 0xf3c1,
+  0x73e3, 0xec79,
+  0x73e4, 0xe95a,
+  0x73e5, 0xf144,
+  0x73e6, 0xf850,
+  0x73e9, 0xf8a8,
+  0x73ea, 0xe338,
+  0x73ed, 0xe87c,
+  0x73f7, 0xe7ee,
+  0x73f9, 0xeb9d,
+  0x73fd, 0xf2ea,
+  0x73fe, 0xf86e,
+  0x7401, 0xeb54,
+  0x7403, 0xe2b9,
+  0x7405, 0xe5ca,
+  0x7406, 0xe6e2,
+  0x7407, 0xec3f,
+  0x7409, 0xe6b8,
+  0x7413, 0xef5d,
+  0x741b, 0xf66a,
+  0x7420, 0xf2a2,
+  0x7421, 0xec6a,
+  0x7422, 0xf69e,
+  0x7425, 0xf8d0,
+  0x7426, 0xe3ad,
+  0x7428, 0xe1e4,
+  0x742a, 0xe3ae,
+  0x742b, 0xe97d,
+  0x742c, 0xef5e,
+  0x742e, 0xf39b,
+  0x742f, 0xe245,
+  0x7430, 0xee9e,
+  0x7433, 0xe6fb,
+  0x7434, 0xe366,
+  0x7435, 0xe9f5,
+  0x7436, 0xf6f1,
+  0x7438, 0xf69f,
+  0x743a, 0xe8f7,
+  0x743f, 0xf8ea,
+  0x7440, 0xefdc,
+  0x7441, 0xe7c1,
+  0x7443, 0xf5f2,
+  0x7444, 0xeb55,
+  0x744b, 0xf064,
+  0x7455, 0xf7c2,
+  0x7457, 0xf04c,
+  0x7459, 0xe455,
+  0x745a, 0xf8d1,
+  0x745b, 0xeec0,
+  0x745c, 0xf0a5,
+  0x745e, 0xeafa,
+  0x745f, 0xeca2,
+  0x7460, 0xe6b9,
+  0x7462, 0xefc3,
+  0x7464, 0xef9f,
+  0x7465, 0xef3f,
+  0x7468, 0xf463,
+  0x7469, 0xf8a9,
+  0x746a, 0xe735,
+  0x746f, 0xe5cb,
+  0x747e, 0xe358,
+  0x7482, 0xe3af,
+  0x7483, 0xe6e3,
+  0x7487, 0xeb56,
+  0x7489, 0xe632,
+  0x748b, 0xf1f0,
+  0x7498, 0xe6f3,
+  0x749c, 0xf964,
+  0x749e, 0xe867,
+  0x749f, 0xe16f,
+  0x74a1, 0xf464,
+  0x74a3, 0xe3b0,
+  0x74a5, 0xe170,
+  0x74a7, 0xe8fd,
+  0x74a8, 0xf4bf,
+  0x74aa, 0xf361,
+  0x74b0, 0xf94b,
+  0x74b2, 0xec40,
+  0x74b5, 0xee35,
+  0x74b9, 0xec6b,
+  0x74bd, 0xeade,
+  0x74bf, 0xeb57,
+  0x74c6, 0xf491,
+  0x74ca, 0xe171,
+  0x74cf, 0xe67a,
+  0x74d4, 0xeec2,
+  0x74d8, 0xe246,
+  0x74da, 0xf4c0,
+  0x74dc, 0xe1fe,
+  0x74e0, 0xf8d2,
+  0x74e2, 0xf79a,
+  0x74e3, 0xf6fb,
+  0x74e6, 0xef4f,
+  0x74ee, 0xef47,
+  0x74f7, 0xf1b6,
+  0x7501, 0xe94a,
+  0x7504, 0xe144,
+  0x7511, 0xf3f7,
+  0x7515, 0xef48,
+  0x7518, 0xe098,
+  0x751a, 0xed34,
+  0x751b, 0xf566,
+  0x751f, 0xeae6,
+  0x7523, 0xeaa7,
+  0x7525, 0xeae7,
+  0x7526, 0xebc1,
+  0x7528, 0xefc4,
+  0x752b, 0xe95b,
+  0x752c, 0xefc5,
+  0x7530, 0xf2a3,
+  0x7531, 0xf0a6,
+  0x7532, 0xe0a3,
+  0x7533, 0xece9,
+  0x7537, 0xe3fb,
+  0x7538, 0xf2a4,
+  0x753a, 0xf2eb,
+  0x7547, 0xe344,
+  0x754c, 0xe1a3,
+  0x754f, 0xef76,
+  0x7551, 0xf2a5,
+  0x7553, 0xe4cc,
+  0x7554, 0xe87d,
+  0x7559, 0xe6ba,
+  0x755b, 0xf465,
+  0x755c, 0xf5e5,
+  0x755d, 0xe7ef,
+  0x7562, 0xf7b4,
+  0x7565, 0xe5d4,
+  0x7566, 0xf9cf,
+  0x756a, 0xe8e3,
+  0x756f, 0xf3e1,
+  0x7570, 0xf146,
+  0x7575, 0xf8fe,
+  0x7576, 0xe4d7,
+  0x7578, 0xe3b1,
+  0x757a, 0xe0b1,
+  0x757f, 0xe3b2,
+  0x7586, 0xe0b2,
+  0x7587, 0xf3c2,
+  0x758a, 0xf571,
+  0x758b, 0xf7b5,
+  0x758e, 0xebc3,
+  0x758f, 0xebc2,
+  0x7591, 0xf0f7,
+  0x759d, 0xeaa8,
+  0x75a5, 0xe0ca,
+  0x75ab, 0xee49,
+  0x75b1, 0xf76e,
+  0x75b2, 0xf7aa,
+  0x75b3, 0xe099,
+  0x75b5, 0xf1b7,
+  0x75b8, 0xe4b8,
+  0x75b9, 0xf466,
+  0x75bc, 0xe569,
+  0x75bd, 0xf255,
+  0x75be, 0xf492,
+  0x75c2, 0xe042,
+  0x75c5, 0xe94b,
+  0x75c7, 0xf3f8,
+  0x75cd, 0xf147,
+  0x75d2, 0xedca,
+  0x75d4, 0xf650,
+  0x75d5, 0xf9dd,
+  0x75d8, 0xe573,
+  0x75d9, 0xe172,
+  0x75db, 0xf6d4,
+  0x75e2, 0xe6e5,
+  0x75f0, 0xe4c3,
+  0x75f2, 0xe736,
+  0x75f4, 0xf651,
+  0x75fa, 0xe9f6,
+  0x75fc, 0xe1c0,
+  0x7600, 0xeddc,
+  0x760d, 0xedcb,
+  0x7619, 0xebc4,
+  0x761f, 0xef40,
+  0x7620, 0xf540,
+  0x7621, 0xf4ea,
+  0x7622, 0xe87e,
+  0x7624, 0xe6bb,
+  0x7626, 0xec41,
+  0x763b, 0xe6aa,
+  0x7642, 0xe69d,
+  0x764c, 0xed6f,
+  0x764e, 0xe066,
+  0x7652, 0xf0a8,
+  0x7656, 0xe8fe,
+  0x7661, 0xf652,
+  0x7664, 0xf2bb,
+  0x7669, 0xe59f,
+  0x766c, 0xeb58,
+  0x7670, 0xef49,
+  0x7672, 0xf2a6,
+  0x7678, 0xe1a4,
+  0x767b, 0xe596,
+  0x767c, 0xe8a1,
+  0x767d, 0xe8dc,
+  0x767e, 0xe8dd,
+  0x7684, 0xf26c,
+  0x7686, 0xe0cb,
+  0x7687, 0xf965,
+  0x768e, 0xe27b,
+  0x7690, 0xe1c1,
+  0x7693, 0xf8d3,
+  0x76ae, 0xf7ab,
+  0x76ba, 0xf5d4,
+  0x76bf, 0xe7a9,
+  0x76c2, 0xefdd,
+  0x76c3, 0xe8cd,
+  0x76c6, 0xe9ce,
+  0x76c8, 0xeec3,
+  0x76ca, 0xf15c,
+  0x76d2, 0xf7ec,
+  0x76d6, 0xe0cc,
+  0x76db, 0xeb9e,
+  0x76dc, 0xe538,
+  0x76de, 0xf1d3,
+  0x76df, 0xe791,
+  0x76e1, 0xf467,
+  0x76e3, 0xe09a,
+  0x76e4, 0xe891,
+  0x76e7, 0xe664,
+  0x76ee, 0xe7cd,
+  0x76f2, 0xe77e,
+  0x76f4, 0xf451,
+  0x76f8, 0xead3,
+  0x76fc, 0xe892,
+  0x76fe, 0xec7a,
+  0x7701, 0xeb9f,
+  0x7704, 0xe79a,
+  0x7708, 0xf6af,
+  0x7709, 0xe846,
+  0x770b, 0xe067,
+  0x771e, 0xf468,
+  0x7720, 0xe79b,
+  0x7729, 0xf86f,
+  0x7737, 0xe2ef,
+  0x7738, 0xe7c2,
+  0x773a, 0xf362,
+  0x773c, 0xed61,
+  0x7740, 0xf4b7,
+  0x774d, 0xf870,
+  0x775b, 0xf2ec,
+  0x7761, 0xec42,
+  0x7763, 0xe54d,
+  0x7766, 0xe7ce,
+  0x776b, 0xf572,
+  0x7779, 0xe539,
+  0x777e, 0xe1c2,
+  0x777f, 0xeeda,
+  0x778b, 0xf469,
+  0x7791, 0xe7aa,
+  0x779e, 0xe74e,
+  0x77a5, 0xe93d,
+  0x77ac, 0xec7b,
+  0x77ad, 0xe69e,
+  0x77b0, 0xe09b,
+  0x77b3, 0xe56a,
+  0x77bb, 0xf567,
+  0x77bc, 0xe131,
+  0x77bf, 0xe2ba,
+  0x77d7, 0xf5b8,
+  0x77db, 0xe7c3,
+  0x77dc, 0xe378,
+  0x77e2, 0xecc5,
+  0x77e3, 0xf0f8,
+  0x77e5, 0xf441,
+  0x77e9, 0xe2bb,
+  0x77ed, 0xe4ad,
+  0x77ee, 0xef71,
+  0x77ef, 0xe27c,
+  0x77f3, 0xeb44,
+  0x7802, 0xea73,
+  0x7812, 0xe9f7,
+  0x7825, 0xf442,
+  0x7826, 0xf4f6,
+  0x7827, 0xf66b,
+  0x782c, 0xe6fe,
+  0x7832, 0xf76f,
+  0x7834, 0xf6f2,
+  0x7845, 0xe339,
+  0x784f, 0xee6a,
+  0x785d, 0xf5a6,
+  0x786b, 0xe6bc,
+  0x786c, 0xe173,
+  0x786f, 0xee6b,
+  0x787c, 0xe9dd,
+  0x7881, 0xe3b3,
+  0x7887, 0xf2ed,
+  0x788c, 0xe66e,
+  0x788d, 0xed96,
+  0x788e, 0xebef,
+  0x7891, 0xe9f8,
+  0x7897, 0xef5f,
+  0x78a3, 0xe075,
+  0x78a7, 0xe931,
+  0x78a9, 0xeb45,
+  0x78ba, 0xf93c,
+  0x78bb, 0xf93d,
+  0x78bc, 0xe737,
+  0x78c1, 0xf1b8,
+  0x78c5, 0xe8b6,
+  0x78ca, 0xe692,
+  0x78cb, 0xf4af,
+  0x78ce, 0xe1a5,
+  0x78d0, 0xe893,
+  0x78e8, 0xe738,
+  0x78ec, 0xe174,
+  0x78ef, 0xe3b4,
+  0x78f5, 0xe068,
+  0x78fb, 0xe894,
+  0x7901, 0xf5a7,
+  0x790e, 0xf5a8,
+  0x7916, 0xee36,
+  0x792a, 0xe5ec,
+  0x792b, 0xe5f8,
+  0x792c, 0xe895,
+  0x793a, 0xecc6,
+  0x793e, 0xea74,
+  0x7940, 0xea75,
+  0x7941, 0xe3b5,
+  0x7947, 0xe3b6,
+  0x7948, 0xe3b7,
+  0x7949, 0xf443,
+  0x7950, 0xefde,
+  0x7956, 0xf363,
+  0x7957, 0xf444,
+  0x795a, 0xf364,
+  0x795b, 0xe0e4,
+  0x795c, 0xf8d4,
+  0x795d, 0xf5e6,
+  0x795e, 0xecea,
+  0x7960, 0xea76,
+  0x7965, 0xead4,
+  0x7968, 0xf79b,
+  0x796d, 0xf33e,
+  0x797a, 0xe3b8,
+  0x797f, 0xe66f,
+  0x7981, 0xe367,
+  0x798d, 0xf931,
+  0x798e, 0xf2ee,
+  0x798f, 0xe968,
+  0x7991, 0xefdf,
+  0x79a6, 0xeddd,
+  0x79a7, 0xf9fb,
+  0x79aa, 0xeb59,
+  0x79ae, 0xe659,
+  0x79b1, 0xe53a,
+  0x79b3, 0xedcc,
+  0x79b9, 0xefe0,
+  0x79bd, 0xe368,
+  0x79be, 0xf932,
+  0x79bf, 0xe54e,
+  0x79c0, 0xec43,
+  0x79c1, 0xea77,
+  0x79c9, 0xe94c,
+  0x79ca, 0xe446,
+  0x79cb, 0xf5d5,
+  0x79d1, 0xe231,
+  0x79d2, 0xf5a9,
+  0x79d5, 0xe9f9,
+  0x79d8, 0xe9fa,
+  0x79df, 0xf365,
+  0x79e4, 0xf66f,
+  0x79e6, 0xf46a,
+  0x79e7, 0xed7b,
+  0x79e9, 0xf493,
+  0x79fb, 0xf149,
+  0x7a00, 0xf9fc,
+  0x7a05, 0xebaa,
+  0x7a08, 0xe069,
+  0x7a0b, 0xf2ef,
+  0x7a0d, 0xf5aa,
+  0x7a14, 0xf19b,
+  0x7a17, 0xf73d,
+  0x7a19, 0xf452,
+  0x7a1a, 0xf653,
+  0x7a1c, 0xe6d2,
+  0x7a1f, 0xf7a2,
+  0x7a20, 0xf366,
+  0x7a2e, 0xf39c,
+  0x7a31, 0xf670,
+  0x7a36, 0xeff3,
+  0x7a37, 0xf453,
+  0x7a3b, 0xe53b,
+  0x7a3c, 0xe043,
+  0x7a3d, 0xe1a6,
+  0x7a3f, 0xe1c3,
+  0x7a40, 0xe1da,
+  0x7a46, 0xe7cf,
+  0x7a49, 0xf654,
+  0x7a4d, 0xf26d,
+  0x7a4e, 0xeec4,
+  0x7a57, 0xec44,
+  0x7a61, 0xeae2,
+  0x7a62, 0xeedb,
+  0x7a69, 0xef41,
+  0x7a6b, 0xf93e,
+  0x7a70, 0xedcd,
+  0x7a74, 0xf87b,
+  0x7a76, 0xe2bc,
+  0x7a79, 0xe2e2,
+  0x7a7a, 0xe1f6,
+  0x7a7d, 0xf2f0,
+  0x7a7f, 0xf54e,
+  0x7a81, 0xe55d,
+  0x7a84, 0xf4b8,
+  0x7a88, 0xefa1,
+  0x7a92, 0xf494,
+  0x7a93, 0xf4eb,
+  0x7a95, 0xf367,
+  0x7a98, 0xe2d7,
+  0x7a9f, 0xe2df,
+  0x7aa9, 0xef50,
+  0x7aaa, 0xef51,
+  0x7aae, 0xe2e3,
+  0x7aaf, 0xefa2,
+  0x7aba, 0xe33a,
+  0x7ac4, 0xf4c1,
+  0x7ac5, 0xe33b,
+  0x7ac7, 0xe574,
+  0x7aca, 0xf2bc,
+  0x7acb, 0xe731,
+  0x7ad7, 0xe7df,
+  0x7ad9, 0xf4d7,
+  0x7add, 0xe94d,
+  0x7adf, 0xe175,
+  0x7ae0, 0xf1f1,
+  0x7ae3, 0xf3e2,
+  0x7ae5, 0xe56b,
+  0x7aea, 0xec45,
+  0x7aed, 0xe076,
+  0x7aef, 0xe4ae,
+  0x7af6, 0xe176,
+  0x7af9, 0xf3d3,
+  0x7afa, 0xf5e7,
+  0x7aff, 0xe06a,
+  0x7b0f, 0xf8ee,
+  0x7b11, 0xebc5,
+  0x7b19, 0xeae9,
+  0x7b1b, 0xf26e,
+  0x7b1e, 0xf6c2,
+  0x7b20, 0xe732,
+  0x7b26, 0xe9ac,
+  0x7b2c, 0xf33f,
+  0x7b2d, 0xe64d,
+  0x7b39, 0xebab,
+  0x7b46, 0xf7b6,
+  0x7b49, 0xe597,
+  0x7b4b, 0xe359,
+  0x7b4c, 0xf2a7,
+  0x7b4d, 0xec7c,
+  0x7b4f, 0xe8ea,
+  0x7b50, 0xe25c,
+  0x7b51, 0xf5e8,
+  0x7b52, 0xf6d5,
+  0x7b54, 0xe4cd,
+  0x7b56, 0xf4fe,
+  0x7b60, 0xe345,
+  0x7b6c, 0xeba0,
+  0x7b6e, 0xeafb,
+  0x7b75, 0xee6d,
+  0x7b7d, 0xef34,
+  0x7b87, 0xe0cd,
+  0x7b8b, 0xf2a8,
+  0x7b8f, 0xf244,
+  0x7b94, 0xe868,
+  0x7b95, 0xe3b9,
+  0x7b97, 0xeaa9,
+  0x7b9a, 0xf4b0,
+  0x7b9d, 0xe154,
+  0x7ba1, 0xe247,
+  0x7bad, 0xf2a9,
+  0x7bb1, 0xead5,
+  0x7bb4, 0xf1d7,
+  0x7bb8, 0xf256,
+  0x7bc0, 0xf2bd,
+  0x7bc1, 0xf966,
+  0x7bc4, 0xe8f4,
+  0x7bc6, 0xf2aa,
+  0x7bc7, 0xf749,
+  0x7bc9, 0xf5e9,
+  0x7bd2, 0xecd9,
+  0x7be0, 0xebc6,
+  0x7be4, 0xe54f,
+  0x7be9, 0xea78,
+  0x7c07, 0xf37a,
+  0x7c12, 0xf4c2,
+  0x7c1e, 0xe4af,
+  0x7c21, 0xe06b,
+  0x7c27, 0xf967,
+  0x7c2a, 0xf1d8,
+  0x7c2b, 0xebc7,
+  0x7c3d, 0xf568,
+  0x7c3e, 0xe643,
+  0x7c3f, 0xe9ad,
+  0x7c43, 0xe5be,
+  0x7c4c, 0xf3c3,
+  0x7c4d, 0xf26f,
+  0x7c60, 0xe67b,
+  0x7c64, 0xf569,
+  0x7c6c, 0xe6e6,
+  0x7c73, 0xe847,
+  0x7c83, 0xe9fb,
+  0x7c89, 0xe9cf,
+  0x7c92, 0xe733,
+  0x7c95, 0xe869,
+  0x7c97, 0xf368,
+  0x7c98, 0xf2c4,
+  0x7c9f, 0xebd8,
+  0x7ca5, 0xf3d4,
+  0x7ca7, 0xf1f2,
+  0x7cae, 0xe5db,
+  0x7cb1, 0xe5dc,
+  0x7cb2, 0xf4c4,
+  0x7cb3, 0xe0d7,
+  0x7cb9, 0xec46,
+  0x7cbe, 0xf2f1,
+  0x7cca, 0xf8d5,
+  0x7cd6, 0xe4d8,
+  0x7cde, 0xe9d0,
+  0x7cdf, 0xf369,
+  0x7ce0, 0xe0b3,
+  0x7ce7, 0xe5dd,
+  0x7cfb, 0xe1a7,
+  0x7cfe, 0xe33c,
+  0x7d00, 0xe3ba,
+  0x7d02, 0xf3c4,
+  0x7d04, 0xedb3,
+  0x7d05, 0xf8f5,
+  0x7d06, 0xefe1,
+  0x7d07, 0xf9e0,
+  0x7d08, 0xf94c,
+  0x7d0a, 0xe832,
+  0x7d0b, 0xe833,
+  0x7d0d, 0xe431,
+  0x7d10, 0xe491,
+  0x7d14, 0xec7d,
+  0x7d17, 0xea79,
+  0x7d18, 0xe26c,
+  0x7d19, 0xf445,
+  0x7d1a, 0xe374,
+  0x7d1b, 0xe9d1,
+  0x7d20, 0xebc8,
+  0x7d21, 0xe8b7,
+  0x7d22, 0xeae3,
+  0x7d2b, 0xf1b9,
+  0x7d2c, 0xf3c5,
+  0x7d2e, 0xf4cf,
+  0x7d2f, 0xe6ab,
+  0x7d30, 0xebac,
+  0x7d33, 0xeceb,
+  0x7d35, 0xf257,
+  0x7d39, 0xebc9,
+  0x7d3a, 0xe09c,
+  0x7d42, 0xf39d,
+  0x7d43, 0xf871,
+  0x7d44, 0xf36a,
+  0x7d45, 0xe177,
+  0x7d46, 0xe896,
+  0x7d50, 0xe14f,
+  0x7d5e, 0xe27d,
+  0x7d61, 0xe5a9,
+  0x7d62, 0xf872,
+  0x7d66, 0xe375,
+  0x7d68, 0xf0d6,
+  0x7d6a, 0xf16f,
+  0x7d6e, 0xeafc,
+  0x7d71, 0xf6d6,
+  0x7d72, 0xea7a,
+  0x7d73, 0xe0b4,
+  0x7d76, 0xf2be,
+  0x7d79, 0xe145,
+  0x7d7f, 0xe2bd,
+  0x7d8e, 0xf2f2,
+  0x7d8f, 0xec47,
+  0x7d93, 0xe178,
+  0x7d9c, 0xf39e,
+  0x7da0, 0xe670,
+  0x7da2, 0xf3c6,
+  0x7dac, 0xec48,
+  0x7dad, 0xf0ab,
+  0x7db1, 0xe0b5,
+  0x7db2, 0xe761,
+  0x7db4, 0xf55e,
+  0x7db5, 0xf4f7,
+  0x7db8, 0xe6c6,
+  0x7dba, 0xe3bb,
+  0x7dbb, 0xf6aa,
+  0x7dbd, 0xf1ca,
+  0x7dbe, 0xe6d3,
+  0x7dbf, 0xe79c,
+  0x7dc7, 0xf655,
+  0x7dca, 0xe3cc,
+  0x7dcb, 0xe9fc,
+  0x7dd6, 0xeafd,
+  0x7dd8, 0xf7e5,
+  0x7dda, 0xeb5a,
+  0x7ddd, 0xf49f,
+  0x7dde, 0xe4b0,
+  0x7de0, 0xf595,
+  0x7de1, 0xe859,
+  0x7de3, 0xee6e,
+  0x7de8, 0xf74a,
+  0x7de9, 0xef60,
+  0x7dec, 0xe79d,
+  0x7def, 0xf065,
+  0x7df4, 0xe633,
+  0x7dfb, 0xf656,
+  0x7e09, 0xf46b,
+  0x7e0a, 0xed9e,
+  0x7e15, 0xef42,
+  0x7e1b, 0xe86a,
+  0x7e1d, 0xf46c,
+  0x7e1e, 0xf8d6,
+  0x7e1f, 0xefb2,
+  0x7e21, 0xf23d,
+  0x7e23, 0xf873,
+  0x7e2b, 0xe97e,
+  0x7e2e, 0xf5ea,
+  0x7e2f, 0xee70,
+  0x7e31, 0xf39f,
+  0x7e37, 0xe6ac,
+  0x7e3d, 0xf5c5,
+  0x7e3e, 0xf270,
+  0x7e41, 0xe8e5,
+  0x7e43, 0xe9de,
+  0x7e46, 0xe7f0,
+  0x7e47, 0xefa3,
+  0x7e52, 0xf3f9,
+  0x7e54, 0xf454,
+  0x7e55, 0xeb5b,
+  0x7e5e, 0xefa4,
+  0x7e61, 0xec49,
+  0x7e69, 0xecb1,
+  0x7e6a, 0xf97b,
+  0x7e6b, 0xe1a8,
+  0x7e6d, 0xe146,
+  0x7e70, 0xf36b,
+  0x7e79, 0xee4a,
+  0x7e7c, 0xe1a9,
+  0x7e82, 0xf4c3,
+  0x7e8c, 0xebd9,
+  0x7e8f, 0xf2ab,
+  0x7e93, 0xeec5,
+  0x7e96, 0xeb79,
+  0x7e98, 0xf4c5,
+  0x7e9b, 0xe550,
+  0x7e9c, 0xe5bf,
+  0x7f36, 0xe9ae,
+  0x7f38, 0xf7fc,
+  0x7f3a, 0xe150,
+  0x7f4c, 0xeda2,
+  0x7f50, 0xe248,
+  0x7f54, 0xe762,
+  0x7f55, 0xf7d6,
+  0x7f6a, 0xf3aa,
+  0x7f6b, 0xe261,
+  0x7f6e, 0xf657,
+  0x7f70, 0xe8eb,
+  0x7f72, 0xeafe,
+  0x7f75, 0xe771,
+  0x7f77, 0xf6f3,
+  0x7f79, 0xe6e7,
+  0x7f85, 0xe5a0,
+  0x7f88, 0xe3bc,
+  0x7f8a, 0xedcf,
+  0x7f8c, 0xe0b6,
+  0x7f8e, 0xe848,
+  0x7f94, 0xe1c4,
+  0x7f9a, 0xe64e,
+  0x7f9e, 0xec4a,
+  0x7fa4, 0xe2d8,
+  0x7fa8, 0xeb5c,
+  0x7fa9, 0xf0f9,
+  0x7fb2, 0xf9fd,
+  0x7fb8, 0xe6e8,
+  0x7fb9, 0xe0d8,
+  0x7fbd, 0xefe2,
+  0x7fc1, 0xef4a,
+  0x7fc5, 0xecc7,
+  0x7fca, 0xf15d,
+  0x7fcc, 0xf15e,
+  0x7fce, 0xe64f,
+  0x7fd2, 0xeca7,
+  0x7fd4, 0xead6,
+  0x7fd5, 0xf9e8,
+  0x7fdf, 0xf271,
+  0x7fe0, 0xf638,
+  0x7fe1, 0xe9fd,
+  0x7fe9, 0xf74b,
+  0x7feb, 0xef61,
+  0x7ff0, 0xf7d7,
+  0x7ff9, 0xe27e,
+  0x7ffc, 0xf15f,
+  0x8000, 0xefa5,
+  0x8001, 0xe665,
+  0x8003, 0xe1c5,
+  0x8005, 0xf1ba,
+  0x8006, 0xe3bd,
+  0x8009, 0xe2be,
+  0x800c, 0xf14b,
+  0x8010, 0xe441,
+  0x8015, 0xe179,
+  0x8017, 0xe7c4,
+  0x8018, 0xeffc,
+  0x802d, 0xe3be,
+  0x8033, 0xf14c,
+  0x8036, 0xedad,
+  0x803d, 0xf6b0,
+  0x803f, 0xe17a,
+  0x8043, 0xe4c4,
+  0x8046, 0xe650,
+  0x804a, 0xe69f,
+  0x8056, 0xeba1,
+  0x8058, 0xea4d,
+  0x805a, 0xf639,
+  0x805e, 0xe834,
+  0x806f, 0xe634,
+  0x8070, 0xf5c6,
+  0x8072, 0xeba2,
+  0x8073, 0xefc6,
+  0x8077, 0xf455,
+  0x807d, 0xf579,
+  0x807e, 0xe67c,
+  0x807f, 0xf0d3,
+  0x8084, 0xf14d,
+  0x8085, 0xec6c,
+  0x8086, 0xea7b,
+  0x8087, 0xf36c,
+  0x8089, 0xf0bf,
+  0x808b, 0xe6ce,
+  0x808c, 0xe3bf,
+  0x8096, 0xf5ab,
+  0x809b, 0xf7fd,
+  0x809d, 0xe06c,
+  0x80a1, 0xe1c6,
+  0x80a2, 0xf446,
+  0x80a5, 0xe9fe,
+  0x80a9, 0xe147,
+  0x80aa, 0xe8b8,
+  0x80af, 0xe379,
+  0x80b1, 0xe26d,
+  0x80b2, 0xf0c0,
+  0x80b4, 0xf9a2,
+  0x80ba, 0xf75b,
+  0x80c3, 0xf066,
+  0x80c4, 0xf3b0,
+  0x80cc, 0xe8ce,
+  0x80ce, 0xf6c3,
+  0x80da, 0xe8cf,
+  0x80db, 0xe0a4,
+  0x80de, 0xf770,
+  0x80e1, 0xf8d7,
+  0x80e4, 0xf0ca,
+  0x80e5, 0xeb31,
+  0x80f1, 0xe25d,
+  0x80f4, 0xe56c,
+  0x80f8, 0xf9d8,
+  0x80fd, 0xe498,
+  0x8102, 0xf447,
+  0x8105, 0xf898,
+  0x8106, 0xf63a,
+  0x8107, 0xf899,
+  0x8108, 0xe776,
+  0x810a, 0xf541,
+  0x8118, 0xef62,
+  0x811a, 0xe055,
+  0x811b, 0xe17b,
+  0x8123, 0xec7e,
+  0x8129, 0xec4b,
+  0x812b, 0xf6ad,
+  0x812f, 0xf771,
+  0x8139, 0xf4ec,
+  0x813e, 0xea31,
+  0x814b, 0xed9f,
+  0x814e, 0xecec,
+  0x8150, 0xe9af,
+  0x8151, 0xe9b0,
+  0x8154, 0xe0b7,
+  0x8155, 0xef63,
+  0x8165, 0xeba3,
+  0x8166, 0xe470,
+  0x816b, 0xf3a0,
+  0x8170, 0xefa6,
+  0x8171, 0xe0f2,
+  0x8178, 0xf1f3,
+  0x8179, 0xe969,
+  0x817a, 0xeb5d,
+  0x817f, 0xf6da,
+  0x8180, 0xe8b9,
+  0x8188, 0xe13e,
+  0x818a, 0xe86b,
+  0x818f, 0xe1c7,
+  0x819a, 0xe9b1,
+  0x819c, 0xe73f,
+  0x819d, 0xeca3,
+  0x81a0, 0xe291,
+  0x81a3, 0xf495,
+  0x81a8, 0xf743,
+  0x81b3, 0xeb5e,
+  0x81b5, 0xf5fd,
+  0x81ba, 0xf0ec,
+  0x81bd, 0xe4c5,
+  0x81be, 0xf97c,
+  0x81bf, 0xe46b,
+  0x81c0, 0xe57b,
+  0x81c2, 0xea32,
+  0x81c6, 0xede6,
+  0x81cd, 0xf340,
+  0x81d8, 0xe5c4,
+  0x81df, 0xf1f4,
+  0x81e3, 0xeced,
+  0x81e5, 0xef52,
+  0x81e7, 0xf1f5,
+  0x81e8, 0xe6fc,
+  0x81ea, 0xf1bb,
+  0x81ed, 0xf63b,
+  0x81f3, 0xf448,
+  0x81f4, 0xf658,
+  0x81fa, 0xe4e6,
+  0x81fb, 0xf46d,
+  0x81fc, 0xe2bf,
+  0x81fe, 0xf0ac,
+  0x8205, 0xe2c0,
+  0x8207, 0xee38,
+  0x8208, 0xf9e9,
+  0x820a, 0xe2c1,
+  0x820c, 0xeb6f,
+  0x820d, 0xea7c,
+  0x8212, 0xeb32,
+  0x821b, 0xf54f,
+  0x821c, 0xec91,
+  0x821e, 0xe7f1,
+  0x821f, 0xf3c7,
+  0x8221, 0xe0b8,
+  0x822a, 0xf7fe,
+  0x822b, 0xe8ba,
+  0x822c, 0xe897,
+  0x8235, 0xf67c,
+  0x8236, 0xe86c,
+  0x8237, 0xf874,
+  0x8239, 0xeb5f,
+  0x8240, 0xe9b2,
+  0x8245, 0xee39,
+  0x8247, 0xf2f3,
+  0x8259, 0xf4ed,
+  0x8264, 0xf0fa,
+  0x8266, 0xf7e6,
+  0x826e, 0xe06d,
+  0x826f, 0xe5de,
+  0x8271, 0xe06e,
+  0x8272, 0xeae4,
+  0x8276, 0xee9f,
+  0x8278, 0xf5ac,
+  0x827e, 0xed97,
+  0x828b, 0xefe3,
+  0x828d, 0xf1cb,
+  0x828e, 0xe2e4,
+  0x8292, 0xe763,
+  0x8299, 0xe9b3,
+  0x829a, 0xe57c,
+  0x829d, 0xf449,
+  0x829f, 0xeab7,
+  0x82a5, 0xe0ce,
+  0x82a6, 0xf8d8,
+  0x82a9, 0xe369,
+  0x82ac, 0xe9d2,
+  0x82ad, 0xf6f4,
+  0x82ae, 0xeedc,
+  0x82af, 0xed35,
+  0x82b1, 0xf933,
+  0x82b3, 0xe8bb,
+  0x82b7, 0xf44a,
+  0x82b8, 0xeffd,
+  0x82b9, 0xe35a,
+  0x82bb, 0xf5d6,
+  0x82bc, 0xe7c5,
+  0x82bd, 0xed44,
+  0x82bf, 0xf1a7,
+  0x82d1, 0xf04d,
+  0x82d2, 0xeea0,
+  0x82d4, 0xf6c4,
+  0x82d5, 0xf5ad,
+  0x82d7, 0xe7e0,
+  0x82db, 0xe044,
+  0x82de, 0xf772,
+  0x82df, 0xe2c2,
+  0x82e1, 0xf14e,
+  0x82e5, 0xedb4,
+  0x82e6, 0xe1c8,
+  0x82e7, 0xf258,
+  0x82f1, 0xeec8,
+  0x82fd, 0xe1c9,
+  0x82fe, 0xf7b7,
+  0x8301, 0xf3e8,
+  0x8302, 0xe7f2,
+  0x8303, 0xe8f5,
+  0x8304, 0xe045,
+  0x8305, 0xe7c6,
+  0x8309, 0xe759,
+  0x8317, 0xe7ab,
+  0x8328, 0xf1bc,
+  0x832b, 0xe764,
+  0x832f, 0xe96a,
+  0x8331, 0xec4c,
+  0x8334, 0xf97d,
+  0x8335, 0xf170,
+  0x8336, 0xe4a0,
+  0x8338, 0xefc7,
+  0x8339, 0xee3a,
+  0x8340, 0xec92,
+  0x8347, 0xf84b,
+  0x8349, 0xf5ae,
+  0x834a, 0xf8aa,
+  0x834f, 0xf19d,
+  0x8351, 0xf14f,
+  0x8352, 0xf968,
+  0x8373, 0xe575,
+  0x8377, 0xf7c3,
+  0x837b, 0xf272,
+  0x8389, 0xe6e9,
+  0x838a, 0xf1f6,
+  0x838e, 0xea7d,
+  0x8396, 0xe17c,
+  0x8398, 0xecee,
+  0x839e, 0xef64,
+  0x83a2, 0xf89a,
+  0x83a9, 0xe9b4,
+  0x83aa, 0xed45,
+  0x83ab, 0xe740,
+  0x83bd, 0xe765,
+  0x83c1, 0xf57a,
+  0x83c5, 0xe249,
+  0x83c9, 0xe671,
+  0x83ca, 0xe2d2,
+  0x83cc, 0xe346,
+  0x83d3, 0xe232,
+  0x83d6, 0xf4ee,
+  0x83dc, 0xf4f8,
+  0x83e9, 0xe95c,
+  0x83eb, 0xe35b,
+  0x83ef, 0xf934,
+  0x83f0, 0xe1ca,
+  0x83f1, 0xe6d4,
+  0x83f2, 0xea33,
+  0x83f4, 0xed70,
+  0x83f9, 0xf259,
+  0x83fd, 0xec6d,
+  0x8403, 0xf5fe,
+  0x8404, 0xe53c,
+  0x840a, 0xe5d1,
+  0x840c, 0xe792,
+  0x840d, 0xf753,
+  0x840e, 0xf067,
+  0x8429, 0xf5d7,
+  0x842c, 0xe74f,
+  0x8431, 0xf9c0,
+  0x8438, 0xf0ad,
+  0x843d, 0xe5aa,
+  0x8449, 0xeea8,
+  0x8457, 0xf25a,
+  0x845b, 0xe077,
+  0x8461, 0xf773,
+  0x8463, 0xe56d,
+  0x8466, 0xf068,
+  0x846b, 0xf8d9,
+  0x846c, 0xf1f7,
+  0x846f, 0xedb5,
+  0x8475, 0xe33d,
+  0x847a, 0xf3f1,
+  0x8490, 0xec4d,
+  0x8494, 0xecc8,
+  0x8499, 0xe7d5,
+  0x849c, 0xeaaa,
+  0x84a1, 0xe8bc,
+  0x84b2, 0xf774,
+  0x84b8, 0xf3fa,
+  0x84bb, 0xedb6,
+  0x84bc, 0xf4ef,
+  0x84bf, 0xf8da,
+  0x84c0, 0xebe0,
+  0x84c2, 0xe7ac,
+  0x84c4, 0xf5eb,
+  0x84c6, 0xeb46,
+  0x84c9, 0xefc8,
+  0x84cb, 0xe0cf,
+  0x84cd, 0xecc9,
+  0x84d1, 0xea7e,
+  0x84da, 0xec4e,
+  0x84ec, 0xe991,
+  0x84ee, 0xe635,
+  0x84f4, 0xec93,
+  0x84fc, 0xe6a0,
+  0x8511, 0xe7a1,
+  0x8513, 0xe750,
+  0x8514, 0xe96b,
+  0x8517, 0xf1bd,
+  0x8518, 0xeab8,
+  0x851a, 0xf035,
+  0x851e, 0xe6ad,
+  0x8521, 0xf4f9,
+  0x8523, 0xf1f8,
+  0x8525, 0xf5c7,
+  0x852c, 0xebca,
+  0x852d, 0xf0e3,
+  0x852f, 0xf46e,
+  0x853d, 0xf75c,
+  0x853f, 0xf069,
+  0x8541, 0xe4c6,
+  0x8543, 0xe8e6,
+  0x8549, 0xf5af,
+  0x854e, 0xe292,
+  0x8553, 0xeffe,
+  0x8559, 0xf8b6,
+  0x8563, 0xec94,
+  0x8568, 0xe2f2,
+  0x8569, 0xf6b9,
+  0x856a, 0xe7f3,
+  0x856d, 0xebcb,
+  0x8584, 0xe86d,
+  0x8587, 0xe849,
+  0x858f, 0xf0fb,
+  0x8591, 0xe0b9,
+  0x8594, 0xf1f9,
+  0x859b, 0xeb70,
+  0x85a6, 0xf550,
+  0x85a8, 0xf9bc,
+  0x85a9, 0xeab1,
+  0x85aa, 0xecef,
+  0x85af, 0xeb33,
+  0x85b0, 0xf9b9,
+  0x85ba, 0xf341,
+  0x85c1, 0xe1cb,
+  0x85c9, 0xf1be,
+  0x85cd, 0xe5c0,
+  0x85ce, 0xecf0,
+  0x85cf, 0xf1fa,
+  0x85d5, 0xefe4,
+  0x85dc, 0xe5ed,
+  0x85dd, 0xeedd,
+  0x85e4, 0xe598,
+  0x85e5, 0xedb7,
+  0x85e9, 0xe8e7,
+  0x85ea, 0xec4f,
+  0x85f7, 0xf25b,
+  0x85fa, 0xe6f4,
+  0x85fb, 0xf36d,
+  0x85ff, 0xe23b,
+  0x8602, 0xeede,
+  0x8606, 0xe666,
+  0x8607, 0xebcc,
+  0x860a, 0xef43,
+  0x8616, 0xedee,
+  0x8617, 0xe932,
+  0x861a, 0xeb60,
+  0x862d, 0xe5b5,
+  0x863f, 0xe5a1,
+  0x864e, 0xf8db,
+  0x8650, 0xf7cb,
+  0x8654, 0xe0f3,
+  0x8655, 0xf535,
+  0x865b, 0xf858,
+  0x865c, 0xe667,
+  0x865e, 0xefe5,
+  0x865f, 0xf8dc,
+  0x8667, 0xf9d0,
+  0x8679, 0xf8f6,
+  0x868a, 0xe835,
+  0x868c, 0xe8bd,
+  0x8693, 0xf172,
+  0x86a3, 0xe1f7,
+  0x86a4, 0xf36e,
+  0x86a9, 0xf659,
+  0x86c7, 0xea91,
+  0x86cb, 0xe4b1,
+  0x86d4, 0xf97e,
+  0x86d9, 0xef53,
+  0x86db, 0xf3c8,
+  0x86df, 0xe293,
+  0x86e4, 0xf7ed,
+  0x86ed, 0xf496,
+  0x86fe, 0xed46,
+  0x8700, 0xf5b9,
+  0x8702, 0xe992,
+  0x8703, 0xecf1,
+  0x8708, 0xef35,
+  0x8718, 0xf44b,
+  0x871a, 0xea34,
+  0x871c, 0xe85c,
+  0x874e, 0xe079,
+  0x8755, 0xecda,
+  0x8757, 0xf969,
+  0x875f, 0xf06a,
+  0x8766, 0xf7c4,
+  0x8768, 0xeca4,
+  0x8774, 0xf8dd,
+  0x8776, 0xf2ca,
+  0x8778, 0xef54,
+  0x8782, 0xe5cc,
+  0x878d, 0xf0d7,
+  0x879f, 0xe7ad,
+  0x87a2, 0xf8ab,
+  0x87b3, 0xe4d9,
+  0x87ba, 0xe5a2,
+  0x87c4, 0xf66e,
+  0x87e0, 0xe898,
+  0x87ec, 0xeb61,
+  0x87ef, 0xefa8,
+  0x87f2, 0xf5f9,
+  0x87f9, 0xf83f,
+  0x87fb, 0xf0fc,
+  0x87fe, 0xeb7a,
+  0x8805, 0xecb2,
+  0x881f, 0xe5c5,
+  0x8822, 0xf3e3,
+  0x8823, 0xe5ee,
+  0x8831, 0xe1cc,
+  0x8836, 0xf1d9,
+  0x883b, 0xe751,
+  0x8840, 0xf87c,
+  0x8846, 0xf3eb,
+  0x884c, 0xf84c,
+  0x884d, 0xee72,
+  0x8852, 0xf875,
+  0x8853, 0xec9c,
+  0x8857, 0xe046,
+  0x8859, 0xed47,
+  0x885b, 0xf06b,
+  0x885d, 0xf5fa,
+  0x8861, 0xf8ac,
+  0x8862, 0xe2c3,
+  0x8863, 0xf0fd,
+  0x8868, 0xf79c,
+  0x886b, 0xeab9,
+  0x8870, 0xebf1,
+  0x8872, 0xe434,
+  0x8877, 0xf5fb,
+  0x887e, 0xe36a,
+  0x887f, 0xe36b,
+  0x8881, 0xf04e,
+  0x8882, 0xe7b1,
+  0x8888, 0xe047,
+  0x888b, 0xe4e7,
+  0x888d, 0xf775,
+  0x8892, 0xe4b2,
+  0x8896, 0xec50,
+  0x8897, 0xf46f,
+  0x889e, 0xe1e5,
+  0x88ab, 0xf7ac,
+  0x88b4, 0xe1cd,
+  0x88c1, 0xf23e,
+  0x88c2, 0xe63e,
+  0x88cf, 0xe6ea,
+  0x88d4, 0xeee0,
+  0x88d5, 0xf0ae,
+  0x88d9, 0xe2d9,
+  0x88dc, 0xe95d,
+  0x88dd, 0xf1fb,
+  0x88df, 0xea92,
+  0x88e1, 0xe6eb,
+  0x88e8, 0xea35,
+  0x88f3, 0xead7,
+  0x88f4, 0xe8d0,
+  0x88f5, 0xe8d1,
+  0x88f8, 0xe5a3,
+  0x88fd, 0xf342,
+  0x8907, 0xe96c,
+  0x8910, 0xe078,
+  0x8912, 0xf776,
+  0x8913, 0xe95e,
+  0x8918, 0xf06c,
+  0x8919, 0xe8d2,
+  0x8925, 0xefb3,
+  0x892a, 0xf6db,
+  0x8936, 0xeca8,
+  0x8938, 0xe6ae,
+  0x893b, 0xeb71,
+  0x8941, 0xe0ba,
+  0x8944, 0xedd1,
+  0x895f, 0xe36c,
+  0x8964, 0xe5c1,
+  0x896a, 0xe75a,
+  0x8972, 0xeca9,
+  0x897f, 0xeb34,
+  0x8981, 0xefa9,
+  0x8983, 0xe4c7,
+  0x8986, 0xe96d,
+  0x8987, 0xf73e,
+  0x898b, 0xe148,
+  0x898f, 0xe33e,
+  0x8993, 0xe794,
+  0x8996, 0xecca,
+  0x89a1, 0xe13f,
+  0x89a9, 0xe53d,
+  0x89aa, 0xf661,
+  0x89b2, 0xe35c,
+  0x89ba, 0xe056,
+  0x89bd, 0xe5c2,
+  0x89c0, 0xe24a,
+  0x89d2, 0xe057,
+  0x89e3, 0xf840,
+  0x89f4, 0xead8,
+  0x89f8, 0xf5ba,
+  0x8a00, 0xedeb,
+  0x8a02, 0xf2f4,
+  0x8a03, 0xe9b5,
+  0x8a08, 0xe1aa,
+  0x8a0a, 0xecf2,
+  0x8a0c, 0xf8f7,
+  0x8a0e, 0xf6d0,
+  0x8a13, 0xf9ba,
+  0x8a16, 0xf9e1,
+  0x8a17, 0xf6a0,
+  0x8a18, 0xe3c0,
+  0x8a1b, 0xef55,
+  0x8a1d, 0xed48,
+  0x8a1f, 0xebe8,
+  0x8a23, 0xe151,
+  0x8a25, 0xe47d,
+  0x8a2a, 0xe8be,
+  0x8a2d, 0xeb72,
+  0x8a31, 0xf859,
+  0x8a34, 0xebcd,
+  0x8a36, 0xe048,
+  0x8a3a, 0xf470,
+  0x8a3b, 0xf3c9,
+  0x8a50, 0xea93,
+  0x8a54, 0xf36f,
+  0x8a55, 0xf754,
+  0x8a5b, 0xf25c,
+  0x8a5e, 0xea94,
+  0x8a60, 0xeec9,
+  0x8a62, 0xec95,
+  0x8a63, 0xeee1,
+  0x8a66, 0xeccb,
+  0x8a69, 0xeccc,
+  0x8a6d, 0xe2f8,
+  0x8a6e, 0xf2ac,
+  0x8a70, 0xf9fe,
+  0x8a71, 0xf935,
+  0x8a72, 0xf841,
+  0x8a73, 0xead9,
+  0x8a75, 0xeb62,
+  0x8a79, 0xf56a,
+  0x8a85, 0xf3ca,
+  0x8a87, 0xe233,
+  0x8a8c, 0xf44c,
+  0x8a8d, 0xf173,
+  0x8a93, 0xeb35,
+  0x8a95, 0xf6ab,
+  0x8a98, 0xf0af,
+  0x8a9e, 0xedde,
+  0x8aa0, 0xeba4,
+  0x8aa1, 0xe1ab,
+  0x8aa3, 0xe7f4,
+  0x8aa4, 0xef36,
+  0x8aa5, 0xe1ce,
+  0x8aa6, 0xebe9,
+  0x8aa8, 0xf991,
+  0x8aaa, 0xeb73,
+  0x8ab0, 0xec51,
+  0x8ab2, 0xe234,
+  0x8ab9, 0xea36,
+  0x8abc, 0xf0fe,
+  0x8abe, 0xf0dd,
+  0x8abf, 0xf370,
+  0x8ac2, 0xf56b,
+  0x8ac4, 0xec96,
+  0x8ac7, 0xe4c8,
+  0x8acb, 0xf57b,
+  0x8acd, 0xf245,
+  0x8acf, 0xf5d8,
+  0x8ad2, 0xe5df,
+  0x8ad6, 0xe675,
+  0x8adb, 0xf0b0,
+  0x8adc, 0xf573,
+  0x8ae1, 0xeccd,
+  0x8ae6, 0xf596,
+  0x8ae7, 0xf842,
+  0x8aea, 0xf2f5,
+  0x8aeb, 0xe06f,
+  0x8aed, 0xf0b1,
+  0x8aee, 0xf1bf,
+  0x8af1, 0xf9c9,
+  0x8af6, 0xed36,
+  0x8af7, 0xf7a4,
+  0x8af8, 0xf343,
+  0x8afa, 0xedec,
+  0x8afe, 0xe3e7,
+  0x8b00, 0xe7c7,
+  0x8b01, 0xed67,
+  0x8b02, 0xf06d,
+  0x8b04, 0xe599,
+  0x8b0e, 0xe84a,
+  0x8b10, 0xe85d,
+  0x8b14, 0xf7cc,
+  0x8b16, 0xebda,
+  0x8b17, 0xe8bf,
+  0x8b19, 0xe155,
+  0x8b1a, 0xf160,
+  0x8b1b, 0xe0bb,
+  0x8b1d, 0xea95,
+  0x8b20, 0xefaa,
+  0x8b28, 0xe7c8,
+  0x8b2b, 0xf273,
+  0x8b2c, 0xe6bd,
+  0x8b33, 0xe2c4,
+  0x8b39, 0xe35d,
+  0x8b41, 0xf936,
+  0x8b49, 0xf3fb,
+  0x8b4e, 0xf9d2,
+  0x8b4f, 0xe3c1,
+  0x8b58, 0xecdb,
+  0x8b5a, 0xe4c9,
+  0x8b5c, 0xe95f,
+  0x8b66, 0xe17d,
+  0x8b6c, 0xea37,
+  0x8b6f, 0xee4b,
+  0x8b70, 0xf131,
+  0x8b74, 0xe149,
+  0x8b77, 0xf8de,
+  0x8b7d, 0xeee2,
+  0x8b80, 0xe551,
+  0x8b8a, 0xe938,
+  0x8b90, 0xec52,
+  0x8b92, 0xf4d8,
+  0x8b93, 0xedd3,
+  0x8b96, 0xf4d9,
+  0x8b9a, 0xf4c6,
+  0x8c37, 0xe1db,
+  0x8c3f, 0xe1ac,
+  0x8c41, 0xf953,
+  0x8c46, 0xe577,
+  0x8c48, 0xe3c2,
+  0x8c4a, 0xf7a5,
+  0x8c4c, 0xef65,
+  0x8c55, 0xecce,
+  0x8c5a, 0xe55a,
+  0x8c61, 0xeada,
+  0x8c6a, 0xf8df,
+  0x8c6b, 0xeee3,
+  0x8c79, 0xf79d,
+  0x8c7a, 0xeccf,
+  0x8c82, 0xf5b0,
+  0x8c8a, 0xe777,
+  0x8c8c, 0xe7c9,
+  0x8c9d, 0xf73f,
+  0x8c9e, 0xf2f6,
+  0x8ca0, 0xe9b6,
+  0x8ca1, 0xf23f,
+  0x8ca2, 0xe1f8,
+  0x8ca7, 0xea48,
+  0x8ca8, 0xf937,
+  0x8ca9, 0xf6fc,
+  0x8caa, 0xf6b1,
+  0x8cab, 0xe24b,
+  0x8cac, 0xf531,
+  0x8caf, 0xf25d,
+  0x8cb0, 0xebae,
+  0x8cb3, 0xf153,
+  0x8cb4, 0xe2fe,
+  0x8cb6, 0xf74f,
+  0x8cb7, 0xe772,
+  0x8cb8, 0xe4e8,
+  0x8cbb, 0xea38,
+  0x8cbc, 0xf574,
+  0x8cbd, 0xf152,
+  0x8cbf, 0xe7f5,
+  0x8cc0, 0xf7c5,
+  0x8cc1, 0xe9d3,
+  0x8cc2, 0xe693,
+  0x8cc3, 0xf19e,
+  0x8cc4, 0xf992,
+  0x8cc7, 0xf1c0,
+  0x8cc8, 0xe049,
+  0x8cca, 0xf274,
+  0x8cd1, 0xf471,
+  0x8cd3, 0xea49,
+  0x8cda, 0xe694,
+  0x8cdc, 0xea96,
+  0x8cde, 0xeadb,
+  0x8ce0, 0xe8d3,
+  0x8ce2, 0xf877,
+  0x8ce3, 0xe773,
+  0x8ce4, 0xf551,
+  0x8ce6, 0xe9b7,
+  0x8cea, 0xf497,
+  0x8ced, 0xe53e,
+  0x8cf4, 0xe695,
+  0x8cfb, 0xe9b8,
+  0x8cfc, 0xe2c5,
+  0x8cfd, 0xeadf,
+  0x8d04, 0xf44e,
+  0x8d05, 0xf631,
+  0x8d07, 0xf0cb,
+  0x8d08, 0xf3fc,
+  0x8d0a, 0xf4c7,
+  0x8d0d, 0xeb7b,
+  0x8d13, 0xf1fc,
+  0x8d16, 0xebdb,
+  0x8d64, 0xf275,
+  0x8d66, 0xea97,
+  0x8d6b, 0xf863,
+  0x8d70, 0xf3cb,
+  0x8d73, 0xe33f,
+  0x8d74, 0xe9b9,
+  0x8d77, 0xe3c3,
+  0x8d85, 0xf5b1,
+  0x8d8a, 0xf056,
+  0x8d99, 0xf371,
+  0x8da3, 0xf63c,
+  0x8da8, 0xf5d9,
+  0x8db3, 0xf37b,
+  0x8dba, 0xe9ba,
+  0x8dbe, 0xf44f,
+  0x8dc6, 0xf6c5,
+  0x8dcb, 0xe8a2,
+  0x8dcc, 0xf498,
+  0x8dcf, 0xe04a,
+  0x8ddb, 0xf6f5,
+  0x8ddd, 0xe0e5,
+  0x8de1, 0xf276,
+  0x8de3, 0xeb63,
+  0x8de8, 0xe235,
+  0x8def, 0xe668,
+  0x8df3, 0xe53f,
+  0x8e0a, 0xefc9,
+  0x8e0f, 0xe4ce,
+  0x8e10, 0xf552,
+  0x8e1e, 0xe0e6,
+  0x8e2a, 0xf3a1,
+  0x8e30, 0xf0b2,
+  0x8e35, 0xf3a2,
+  0x8e42, 0xf0b3,
+  0x8e44, 0xf344,
+  0x8e47, 0xe0f4,
+  0x8e48, 0xe540,
+  0x8e49, 0xf4b2,
+  0x8e4a, 0xf8b7,
+  0x8e59, 0xf5ec,
+  0x8e5f, 0xf277,
+  0x8e60, 0xf542,
+  0x8e74, 0xf5ed,
+  0x8e76, 0xe2f3,
+  0x8e81, 0xf372,
+  0x8e87, 0xf25e,
+  0x8e8a, 0xf3cc,
+  0x8e8d, 0xedb8,
+  0x8eaa, 0xe6f5,
+  0x8eab, 0xecf3,
+  0x8eac, 0xe2e5,
+  0x8ec0, 0xe2c6,
+  0x8eca, 0xf4b3,
+  0x8ecb, 0xed68,
+  0x8ecc, 0xe2f9,
+  0x8ecd, 0xe2da,
+  0x8ed2, 0xf85d,
+  0x8edf, 0xee73,
+  0x8eeb, 0xf472,
+  0x8ef8, 0xf5ee,
+  0x8efb, 0xe04b,
+  0x8efe, 0xecdc,
+  0x8f03, 0xe294,
+  0x8f05, 0xe669,
+  0x8f09, 0xf240,
+  0x8f12, 0xf575,
+  0x8f13, 0xe752,
+  0x8f14, 0xe960,
+  0x8f15, 0xe17e,
+  0x8f1b, 0xe5e0,
+  0x8f1c, 0xf65a,
+  0x8f1d, 0xf9ca,
+  0x8f1e, 0xe766,
+  0x8f1f, 0xf55f,
+  0x8f26, 0xe636,
+  0x8f27, 0xe94e,
+  0x8f29, 0xe8d4,
+  0x8f2a, 0xe6c7,
+  0x8f2f, 0xf4a0,
+  0x8f33, 0xf3cd,
+  0x8f38, 0xec53,
+  0x8f39, 0xe96e,
+  0x8f3b, 0xe96f,
+  0x8f3e, 0xf2ad,
+  0x8f3f, 0xee3b,
+  0x8f44, 0xf7dd,
+  0x8f45, 0xf04f,
+  0x8f49, 0xf2ae,
+  0x8f4d, 0xf560,
+  0x8f4e, 0xe295,
+  0x8f5d, 0xee3c,
+  0x8f5f, 0xe26e,
+  0x8f62, 0xe5f9,
+  0x8f9b, 0xecf4,
+  0x8f9c, 0xe1d0,
+  0x8fa3, 0xe5b8,
+  0x8fa6, 0xf6fd,
+  0x8fa8, 0xe939,
+  0x8fad, 0xea98,
+  0x8faf, 0xe93a,
+  0x8fb0, 0xf473,
+  0x8fb1, 0xefb4,
+  0x8fb2, 0xe46c,
+  0x8fc2, 0xefe6,
+  0x8fc5, 0xecf6,
+  0x8fce, 0xeeca,
+  0x8fd1, 0xe35e,
+  0x8fd4, 0xe899,
+  0x8fe6, 0xe04c,
+  0x8fea, 0xf278,
+  0x8feb, 0xe86e,
+  0x8fed, 0xf499,
+  0x8ff0, 0xec9d,
+  0x8ff2, 0xe136,
+  0x8ff7, 0xe84b,
+  0x8ff9, 0xf279,
+  0x8ffd, 0xf5da,
+  0x9000, 0xf6dc,
+  0x9001, 0xebea,
+  0x9002, 0xe251,
+  0x9003, 0xe541,
+  0x9005, 0xf9b1,
+  0x9006, 0xee4d,
+  0x9008, 0xf8ad,
+  0x900b, 0xf777,
+  0x900d, 0xebce,
+  0x900f, 0xf6e2,
+  0x9010, 0xf5ef,
+  0x9011, 0xe2c7,
+  0x9014, 0xe542,
+  0x9015, 0xe191,
+  0x9017, 0xe578,
+  0x9019, 0xf25f,
+  0x901a, 0xf6d7,
+  0x901d, 0xeb36,
+  0x901e, 0xe651,
+  0x901f, 0xebdc,
+  0x9020, 0xf373,
+  0x9021, 0xf3e4,
+  0x9022, 0xe993,
+  0x9023, 0xe637,
+  0x902e, 0xf597,
+  0x9031, 0xf3ce,
+  0x9032, 0xf474,
+  0x9035, 0xe340,
+  0x9038, 0xf191,
+  0x903c, 0xf7ba,
+  0x903e, 0xf0b5,
+  0x9041, 0xe57d,
+  0x9042, 0xec54,
+  0x9047, 0xefe7,
+  0x904a, 0xf0b4,
+  0x904b, 0xf031,
+  0x904d, 0xf74c,
+  0x904e, 0xe236,
+  0x9050, 0xf7c6,
+  0x9051, 0xf96a,
+  0x9053, 0xe543,
+  0x9054, 0xe4b9,
+  0x9055, 0xf06e,
+  0x9059, 0xefab,
+  0x905c, 0xebe1,
+  0x905d, 0xe4cf,
+  0x905e, 0xf598,
+  0x9060, 0xf050,
+  0x9061, 0xebcf,
+  0x9063, 0xe14a,
+  0x9069, 0xf27a,
+  0x906d, 0xf374,
+  0x906e, 0xf4b4,
+  0x906f, 0xe57e,
+  0x9072, 0xf450,
+  0x9075, 0xf3e5,
+  0x9077, 0xf553,
+  0x9078, 0xeb64,
+  0x907a, 0xf0b6,
+  0x907c, 0xe6a1,
+  0x907d, 0xe0e8,
+  0x907f, 0xf7ad,
+  0x9080, 0xefad,
+  0x9081, 0xe774,
+  0x9082, 0xf843,
+  0x9083, 0xec55,
+  0x9084, 0xf94d,
+  0x9087, 0xf154,
+  0x9088, 0xe741,
+  0x908a, 0xe93b,
+  0x908f, 0xe5a4,
+  0x9091, 0xf0e9,
+  0x9095, 0xef4b,
+  0x9099, 0xe767,
+  0x90a2, 0xf8ae,
+  0x90a3, 0xe3e1,
+  0x90a6, 0xe8c0,
+  0x90a8, 0xf5be,
+  0x90aa, 0xea99,
+  0x90af, 0xe09d,
+  0x90b0, 0xf6c6,
+  0x90b1, 0xe2c8,
+  0x90b5, 0xebd0,
+  0x90b8, 0xf260,
+  0x90c1, 0xeff4,
+  0x90ca, 0xe296,
+  0x90de, 0xe5cd,
+  0x90e1, 0xe2db,
+  0x90e8, 0xe9bb,
+  0x90ed, 0xe23c,
+  0x90f5, 0xefe8,
+  0x90fd, 0xe544,
+  0x9102, 0xed57,
+  0x9112, 0xf5db,
+  0x9115, 0xf851,
+  0x9119, 0xea39,
+  0x9127, 0xe59a,
+  0x912d, 0xf2f7,
+  0x9132, 0xe4b3,
+  0x9149, 0xf0b7,
+  0x914a, 0xf2f8,
+  0x914b, 0xf5dc,
+  0x914c, 0xf1cc,
+  0x914d, 0xe8d5,
+  0x914e, 0xf3cf,
+  0x9152, 0xf3d0,
+  0x9162, 0xf5b2,
+  0x9169, 0xe7ae,
+  0x916a, 0xe5ac,
+  0x916c, 0xec56,
+  0x9175, 0xf9a3,
+  0x9177, 0xf8e5,
+  0x9178, 0xeaab,
+  0x9187, 0xec97,
+  0x9189, 0xf63d,
+  0x918b, 0xf5b3,
+  0x918d, 0xf345,
+  0x9192, 0xeba5,
+  0x919c, 0xf5dd,
+  0x91ab, 0xf132,
+  0x91ac, 0xf1fd,
+  0x91ae, 0xf5b4,
+  0x91af, 0xf8b8,
+  0x91b1, 0xe8a3,
+  0x91b4, 0xe65a,
+  0x91b5, 0xe0d9,
+  0x91c0, 0xedd4,
+  0x91c7, 0xf4fa,
+  0x91c9, 0xf0b8,
+  0x91cb, 0xeb47,
+  0x91cc, 0xe6ec,
+  0x91cd, 0xf3ec,
+  0x91ce, 0xedaf,
+  0x91cf, 0xe5e1,
+  0x91d0, 0xe6ed,
+  0x91d1, 0xe3d1,
+  0x91d7, 0xebf2,
+  0x91d8, 0xf2f9,
+  0x91dc, 0xe9bc,
+  0x91dd, 0xf66c,
+  0x91e3, 0xf375,
+  0x91e7, 0xf554,
+  0x91ea, 0xefe9,
+  0x91f5, 0xf4fb,
+  0x920d, 0xe591,
+  0x9210, 0xe132,
+  0x9211, 0xf6fe,
+  0x9212, 0xeabc,
+  0x9217, 0xf0cd,
+  0x921e, 0xe347,
+  0x9234, 0xe652,
+  0x923a, 0xef3d,
+  0x923f, 0xf2af,
+  0x9240, 0xe0a5,
+  0x9245, 0xe0e9,
+  0x9249, 0xf878,
+  0x9257, 0xe156,
+  0x925b, 0xee77,
+  0x925e, 0xf057,
+  0x9262, 0xe8a4,
+  0x9264, 0xe2c9,
+  0x9265, 0xec9e,
+  0x9266, 0xf2fa,
+  0x9280, 0xf0de,
+  0x9283, 0xf5c8,
+  0x9285, 0xe56e,
+  0x9291, 0xeb65,
+  0x9293, 0xf2b0,
+  0x9296, 0xec57,
+  0x9298, 0xe7af,
+  0x929c, 0xf7e7,
+  0x92b3, 0xeee5,
+  0x92b6, 0xe2ca,
+  0x92b7, 0xebd1,
+  0x92b9, 0xec58,
+  0x92cc, 0xf2fb,
+  0x92cf, 0xf89b,
+  0x92d2, 0xe994,
+  0x92e4, 0xeb37,
+  0x92ea, 0xf778,
+  0x92f8, 0xe0ea,
+  0x92fc, 0xe0bc,
+  0x9304, 0xe672,
+  0x9310, 0xf5de,
+  0x9318, 0xf5df,
+  0x931a, 0xf246,
+  0x931e, 0xec98,
+  0x931f, 0xe4ca,
+  0x9320, 0xf2fc,
+  0x9321, 0xe3c4,
+  0x9322, 0xf2b1,
+  0x9324, 0xe3c5,
+  0x9326, 0xe36e,
+  0x9328, 0xe7e1,
+  0x932b, 0xeb48,
+  0x932e, 0xe1d1,
+  0x932f, 0xf4b9,
+  0x9348, 0xeecc,
+  0x934a, 0xe638,
+  0x934b, 0xe237,
+  0x934d, 0xe545,
+  0x9354, 0xed58,
+  0x935b, 0xe4b4,
+  0x936e, 0xf0b9,
+  0x9375, 0xe0f5,
+  0x937c, 0xf66d,
+  0x937e, 0xf3a3,
+  0x938c, 0xe157,
+  0x9394, 0xefca,
+  0x9396, 0xebf0,
+  0x939a, 0xf5e0,
+  0x93a3, 0xf8af,
+  0x93a7, 0xe0d1,
+  0x93ac, 0xf8e0,
+  0x93ad, 0xf475,
+  0x93b0, 0xf192,
+  0x93c3, 0xf37c,
+  0x93d1, 0xf27b,
+  0x93de, 0xefcb,
+  0x93e1, 0xe192,
+  0x93e4, 0xe6af,
+  0x93f6, 0xf4a1,
+  0x9404, 0xf997,
+  0x9418, 0xf3a4,
+  0x9425, 0xeb66,
+  0x942b, 0xf2b2,
+  0x9435, 0xf561,
+  0x9438, 0xf6a1,
+  0x9444, 0xf3d1,
+  0x9451, 0xe09e,
+  0x9452, 0xe09f,
+  0x945b, 0xe25e,
+  0x947d, 0xf4c8,
+  0x947f, 0xf4ba,
+  0x9577, 0xf1fe,
+  0x9580, 0xe836,
+  0x9583, 0xeb7c,
+  0x9589, 0xf75d,
+  0x958b, 0xe0d2,
+  0x958f, 0xf0ce,
+  0x9591, 0xf7d8,
+  0x9592, 0xf7d9,
+  0x9593, 0xe070,
+  0x9594, 0xe85a,
+  0x9598, 0xe0a6,
+  0x95a3, 0xe058,
+  0x95a4, 0xf7ee,
+  0x95a5, 0xe8ec,
+  0x95a8, 0xe341,
+  0x95ad, 0xe5ef,
+  0x95b1, 0xee95,
+  0x95bb, 0xeea2,
+  0x95bc, 0xed69,
+  0x95c7, 0xed71,
+  0x95ca, 0xf954,
+  0x95d4, 0xf7ef,
+  0x95d5, 0xe2f4,
+  0x95d6, 0xf6e6,
+  0x95dc, 0xe24c,
+  0x95e1, 0xf555,
+  0x95e2, 0xe933,
+  0x961c, 0xe9bd,
+  0x9621, 0xf556,
+  0x962a, 0xf731,
+  0x962e, 0xef66,
+  0x9632, 0xe8c1,
+  0x963b, 0xf376,
+  0x963f, 0xed49,
+  0x9640, 0xf67d,
+  0x9642, 0xf7ae,
+  0x9644, 0xe9be,
+  0x964b, 0xe6b0,
+  0x964c, 0xe778,
+  0x964d, 0xe0bd,
+  0x9650, 0xf7da,
+  0x965b, 0xf75e,
+  0x965c, 0xf7f0,
+  0x965d, 0xeb7d,
+  0x965e, 0xecb3,
+  0x965f, 0xf543,
+  0x9662, 0xf052,
+  0x9663, 0xf476,
+  0x9664, 0xf346,
+  0x966a, 0xe8d6,
+  0x9670, 0xf0e4,
+  0x9673, 0xf477,
+  0x9675, 0xe6d5,
+  0x9676, 0xe546,
+  0x9677, 0xf7e8,
+  0x9678, 0xe6c1,
+  0x967d, 0xedd5,
+  0x9685, 0xefea,
+  0x9686, 0xe6cc,
+  0x968a, 0xe4e9,
+  0x968b, 0xec59,
+  0x968d, 0xf96b,
+  0x968e, 0xe1ad,
+  0x9694, 0xe140,
+  0x9695, 0xf032,
+  0x9698, 0xed98,
+  0x9699, 0xe350,
+  0x969b, 0xf347,
+  0x969c, 0xf231,
+  0x96a3, 0xe6f6,
+  0x96a7, 0xec5a,
+  0x96a8, 0xec5b,
+  0x96aa, 0xf85f,
+  0x96b1, 0xf0df,
+  0x96b7, 0xe65b,
+  0x96bb, 0xf544,
+  0x96c0, 0xf1cd,
+  0x96c1, 0xed62,
+  0x96c4, 0xf039,
+  0x96c5, 0xed4a,
+  0x96c6, 0xf4a2,
+  0x96c7, 0xe1d2,
+  0x96c9, 0xf65b,
+  0x96cb, 0xf3e6,
+  0x96cc, 0xf1c1,
+  0x96cd, 0xef4c,
+  0x96ce, 0xf261,
+  0x96d5, 0xf377,
+  0x96d6, 0xec5c,
+  0x96d9, 0xed3a,
+  0x96db, 0xf5e1,
+  0x96dc, 0xf1da,
+  0x96e2, 0xe6ee,
+  0x96e3, 0xe3f1,
+  0x96e8, 0xefeb,
+  0x96e9, 0xefec,
+  0x96ea, 0xeb74,
+  0x96ef, 0xe837,
+  0x96f0, 0xe9d4,
+  0x96f2, 0xf033,
+  0x96f6, 0xe653,
+  0x96f7, 0xe696,
+  0x96f9, 0xe86f,
+  0x96fb, 0xf2b3,
+  0x9700, 0xec5d,
+  0x9706, 0xf2fd,
+  0x9707, 0xf478,
+  0x9711, 0xf2c5,
+  0x9713, 0xeee7,
+  0x9716, 0xe6fd,
+  0x9719, 0xeece,
+  0x971c, 0xeadc,
+  0x971e, 0xf7c7,
+  0x9727, 0xe7f6,
+  0x9730, 0xeaac,
+  0x9732, 0xe66a,
+  0x9739, 0xe934,
+  0x973d, 0xf348,
+  0x9742, 0xe5fa,
+  0x9744, 0xed99,
+  0x9748, 0xe654,
+  0x9751, 0xf57c,
+  0x9756, 0xf2fe,
+  0x975c, 0xf331,
+  0x975e, 0xea3a,
+  0x9761, 0xe84c,
+  0x9762, 0xe79e,
+  0x9769, 0xf864,
+  0x976d, 0xf175,
+  0x9774, 0xf938,
+  0x9777, 0xf176,
+  0x977a, 0xe75b,
+  0x978b, 0xf8b9,
+  0x978d, 0xed63,
+  0x978f, 0xe1f9,
+  0x97a0, 0xe2d3,
+  0x97a8, 0xe07a,
+  0x97ab, 0xe2d4,
+  0x97ad, 0xf74d,
+  0x97c6, 0xf557,
+  0x97cb, 0xf06f,
+  0x97d3, 0xf7db,
+  0x97dc, 0xe547,
+  0x97f3, 0xf0e5,
+  0x97f6, 0xebd2,
+  0x97fb, 0xf034,
+  0x97ff, 0xf852,
+  0x9800, 0xf8e1,
+  0x9801, 0xf87d,
+  0x9802, 0xf332,
+  0x9803, 0xe193,
+  0x9805, 0xf833,
+  0x9806, 0xec99,
+  0x9808, 0xec5e,
+  0x980a, 0xeff5,
+  0x980c, 0xebeb,
+  0x9810, 0xeee8,
+  0x9811, 0xef67,
+  0x9812, 0xe89a,
+  0x9813, 0xe55b,
+  0x9817, 0xf6f6,
+  0x9818, 0xe655,
+  0x982d, 0xe579,
+  0x9830, 0xf89c,
+  0x9838, 0xe194,
+  0x9839, 0xf6dd,
+  0x983b, 0xea4a,
+  0x9846, 0xe238,
+  0x984c, 0xf349,
+  0x984d, 0xeda0,
+  0x984e, 0xed59,
+  0x9854, 0xed64,
+  0x9858, 0xf053,
+  0x985a, 0xf2b4,
+  0x985e, 0xe6be,
+  0x9865, 0xf8e2,
+  0x9867, 0xe1d3,
+  0x986b, 0xf2b5,
+  0x986f, 0xf879,
+  0x98a8, 0xf7a6,
+  0x98af, 0xeabd,
+  0x98b1, 0xf6c7,
+  0x98c4, 0xf79f,
+  0x98c7, 0xf79e,
+  0x98db, 0xea3b,
+  0x98dc, 0xe8e8,
+  0x98df, 0xecdd,
+  0x98e1, 0xebe2,
+  0x98e2, 0xe3c6,
+  0x98ed, 0xf660,
+  0x98ee, 0xf0e6,
+  0x98ef, 0xe89b,
+  0x98f4, 0xf157,
+  0x98fc, 0xea9a,
+  0x98fd, 0xf779,
+  0x98fe, 0xecde,
+  0x9903, 0xe297,
+  0x9909, 0xf853,
+  0x990a, 0xedd7,
+  0x990c, 0xf158,
+  0x9910, 0xf4c9,
+  0x9913, 0xed4b,
+  0x9918, 0xee3e,
+  0x991e, 0xf2b6,
+  0x9920, 0xe94f,
+  0x9928, 0xe24d,
+  0x9945, 0xe753,
+  0x9949, 0xe35f,
+  0x994b, 0xe2fa,
+  0x994c, 0xf4ca,
+  0x994d, 0xeb67,
+  0x9951, 0xe3c7,
+  0x9952, 0xefae,
+  0x9954, 0xef4d,
+  0x9957, 0xf854,
+  0x9996, 0xec5f,
+  0x9999, 0xf855,
+  0x999d, 0xf7b8,
+  0x99a5, 0xe970,
+  0x99a8, 0xf8b0,
+  0x99ac, 0xe739,
+  0x99ad, 0xeddf,
+  0x99ae, 0xf7a7,
+  0x99b1, 0xf67e,
+  0x99b3, 0xf65c,
+  0x99b4, 0xec9a,
+  0x99b9, 0xf193,
+  0x99c1, 0xe870,
+  0x99d0, 0xf3d2,
+  0x99d1, 0xe45c,
+  0x99d2, 0xe2cb,
+  0x99d5, 0xe04d,
+  0x99d9, 0xe9bf,
+  0x99dd, 0xf691,
+  0x99df, 0xea9b,
+  0x99ed, 0xf844,
+  0x99f1, 0xe5ad,
+  0x99ff, 0xf3e7,
+  0x9a01, 0xea4e,
+  0x9a08, 0xe950,
+  0x9a0e, 0xe3c8,
+  0x9a0f, 0xe3c9,
+  0x9a19, 0xf74e,
+  0x9a2b, 0xe0f6,
+  0x9a30, 0xe59b,
+  0x9a36, 0xf5e2,
+  0x9a37, 0xebd3,
+  0x9a40, 0xe779,
+  0x9a43, 0xf7a0,
+  0x9a45, 0xe2cc,
+  0x9a4d, 0xf9a4,
+  0x9a55, 0xe298,
+  0x9a57, 0xf860,
+  0x9a5a, 0xe195,
+  0x9a5b, 0xee4e,
+  0x9a5f, 0xf63e,
+  0x9a62, 0xe5f0,
+  0x9a65, 0xe3ca,
+  0x9a69, 0xf94e,
+  0x9a6a, 0xe5f1,
+  0x9aa8, 0xe1e9,
+  0x9ab8, 0xf845,
+  0x9ad3, 0xec60,
+  0x9ad4, 0xf599,
+  0x9ad8, 0xe1d4,
+  0x9ae5, 0xeea3,
+  0x9aee, 0xe8a5,
+  0x9b1a, 0xec61,
+  0x9b27, 0xe6a2,
+  0x9b2a, 0xf6e3,
+  0x9b31, 0xf036,
+  0x9b3c, 0xe331,
+  0x9b41, 0xe26a,
+  0x9b42, 0xf8eb,
+  0x9b43, 0xe8a6,
+  0x9b44, 0xe8de,
+  0x9b45, 0xe775,
+  0x9b4f, 0xf070,
+  0x9b54, 0xe73a,
+  0x9b5a, 0xede0,
+  0x9b6f, 0xe66b,
+  0x9b8e, 0xf2c6,
+  0x9b91, 0xf77a,
+  0x9b9f, 0xed65,
+  0x9bab, 0xe299,
+  0x9bae, 0xeb68,
+  0x9bc9, 0xe6ef,
+  0x9bd6, 0xf57d,
+  0x9be4, 0xe1e6,
+  0x9be8, 0xe196,
+  0x9c0d, 0xf5e3,
+  0x9c10, 0xed5a,
+  0x9c12, 0xe971,
+  0x9c15, 0xf7c8,
+  0x9c25, 0xf94f,
+  0x9c32, 0xef37,
+  0x9c3b, 0xe754,
+  0x9c47, 0xe0be,
+  0x9c49, 0xe93e,
+  0x9c57, 0xe6f7,
+  0x9ce5, 0xf378,
+  0x9ce7, 0xe9c0,
+  0x9ce9, 0xe2cd,
+  0x9cf3, 0xe995,
+  0x9cf4, 0xe7b0,
+  0x9cf6, 0xee79,
+  0x9d09, 0xed4c,
+  0x9d1b, 0xf054,
+  0x9d26, 0xed7c,
+  0x9d28, 0xed75,
+  0x9d3b, 0xf8f8,
+  0x9d51, 0xe14b,
+  0x9d5d, 0xed4d,
+  0x9d60, 0xe1dc,
+  0x9d61, 0xe7f7,
+  0x9d6c, 0xe9df,
+  0x9d72, 0xf1ce,
+  0x9da9, 0xe7d0,
+  0x9daf, 0xeda3,
+  0x9db4, 0xf7cd,
+  0x9dc4, 0xe1ae,
+  0x9dd7, 0xe2ce,
+  0x9df2, 0xf63f,
+  0x9df8, 0xf9d3,
+  0x9df9, 0xf0ed,
+  0x9dfa, 0xe66c,
+  0x9e1a, 0xeda4,
+  0x9e1e, 0xe5b6,
+  0x9e75, 0xe66d,
+  0x9e79, 0xf7e9,
+  0x9e7d, 0xeea4,
+  0x9e7f, 0xe673,
+  0x9e92, 0xe3cb,
+  0x9e93, 0xe674,
+  0x9e97, 0xe5f2,
+  0x9e9d, 0xea9c,
+  0x9e9f, 0xe6f8,
+  0x9ea5, 0xe77a,
+  0x9eb4, 0xe2d5,
+  0x9eb5, 0xe79f,
+  0x9ebb, 0xe73b,
+  0x9ebe, 0xf9cb,
+  0x9ec3, 0xf96c,
+  0x9ecd, 0xeb38,
+  0x9ece, 0xe5f3,
+  0x9ed1, 0xf9d9,
+  0x9ed4, 0xe133,
+  0x9ed8, 0xe7f9,
+  0x9edb, 0xe4ea,
+  0x9edc, 0xf5f5,
+  0x9ede, 0xf2c7,
+  0x9ee8, 0xe4da,
+  0x9ef4, 0xe84d,
+  0x9f07, 0xef38,
+  0x9f08, 0xe93f,
+  0x9f0e, 0xf333,
+  0x9f13, 0xe1d5,
+  0x9f20, 0xeb39,
+  0x9f3b, 0xea3c,
+  0x9f4a, 0xf34a,
+  0x9f4b, 0xf241,
+  0x9f4e, 0xf242,
+  0x9f52, 0xf65d,
+  0x9f5f, 0xf262,
+  0x9f61, 0xe656,
+  0x9f67, 0xeb75,
+  0x9f6a, 0xf4bb,
+  0x9f6c, 0xede1,
+  0x9f77, 0xed5b,
+  0x9f8d, 0xe6a3,
+  0x9f90, 0xe8c2,
+  0x9f95, 0xe0a0,
+  0x9f9c, 0xe2cf,
+  0xac00, 0x8861,
+  0xac01, 0x8862,
+  0xac02, 0x8863,
+  0xac03, 0x8864,
+  0xac04, 0x8865,
+  0xac05, 0x8866,
+  0xac06, 0x8867,
+  0xac07, 0x8868,
+  0xac08, 0x8869,
+  0xac09, 0x886a,
+  0xac0a, 0x886b,
+  0xac0b, 0x886c,
+  0xac0c, 0x886d,
+  0xac0d, 0x886e,
+  0xac0e, 0x886f,
+  0xac0f, 0x8870,
+  0xac10, 0x8871,
+  0xac11, 0x8873,
+  0xac12, 0x8874,
+  0xac13, 0x8875,
+  0xac14, 0x8876,
+  0xac15, 0x8877,
+  0xac16, 0x8878,
+  0xac17, 0x8879,
+  0xac18, 0x887a,
+  0xac19, 0x887b,
+  0xac1a, 0x887c,
+  0xac1b, 0x887d,
+  0xac1c, 0x8881,
+  0xac1d, 0x8882,
+  0xac1e, 0x8883,
+  0xac1f, 0x8884,
+  0xac20, 0x8885,
+  0xac21, 0x8886,
+  0xac22, 0x8887,
+  0xac23, 0x8888,
+  0xac24, 0x8889,
+  0xac25, 0x888a,
+  0xac26, 0x888b,
+  0xac27, 0x888c,
+  0xac28, 0x888d,
+  0xac29, 0x888e,
+  0xac2a, 0x888f,
+  0xac2b, 0x8890,
+  0xac2c, 0x8891,
+  0xac2d, 0x8893,
+  0xac2e, 0x8894,
+  0xac2f, 0x8895,
+  0xac30, 0x8896,
+  0xac31, 0x8897,
+  0xac32, 0x8898,
+  0xac33, 0x8899,
+  0xac34, 0x889a,
+  0xac35, 0x889b,
+  0xac36, 0x889c,
+  0xac37, 0x889d,
+  0xac38, 0x88a1,
+  0xac39, 0x88a2,
+  0xac3a, 0x88a3,
+  0xac3b, 0x88a4,
+  0xac3c, 0x88a5,
+  0xac3d, 0x88a6,
+  0xac3e, 0x88a7,
+  0xac3f, 0x88a8,
+  0xac40, 0x88a9,
+  0xac41, 0x88aa,
+  0xac42, 0x88ab,
+  0xac43, 0x88ac,
+  0xac44, 0x88ad,
+  0xac45, 0x88ae,
+  0xac46, 0x88af,
+  0xac47, 0x88b0,
+  0xac48, 0x88b1,
+  0xac49, 0x88b3,
+  0xac4a, 0x88b4,
+  0xac4b, 0x88b5,
+  0xac4c, 0x88b6,
+  0xac4d, 0x88b7,
+  0xac4e, 0x88b8,
+  0xac4f, 0x88b9,
+  0xac50, 0x88ba,
+  0xac51, 0x88bb,
+  0xac52, 0x88bc,
+  0xac53, 0x88bd,
+  0xac54, 0x88c1,
+  0xac55, 0x88c2,
+  0xac56, 0x88c3,
+  0xac57, 0x88c4,
+  0xac58, 0x88c5,
+  0xac59, 0x88c6,
+  0xac5a, 0x88c7,
+  0xac5b, 0x88c8,
+  0xac5c, 0x88c9,
+  0xac5d, 0x88ca,
+  0xac5e, 0x88cb,
+  0xac5f, 0x88cc,
+  0xac60, 0x88cd,
+  0xac61, 0x88ce,
+  0xac62, 0x88cf,
+  0xac63, 0x88d0,
+  0xac64, 0x88d1,
+  0xac65, 0x88d3,
+  0xac66, 0x88d4,
+  0xac67, 0x88d5,
+  0xac68, 0x88d6,
+  0xac69, 0x88d7,
+  0xac6a, 0x88d8,
+  0xac6b, 0x88d9,
+  0xac6c, 0x88da,
+  0xac6d, 0x88db,
+  0xac6e, 0x88dc,
+  0xac6f, 0x88dd,
+  0xac70, 0x88e1,
+  0xac71, 0x88e2,
+  0xac72, 0x88e3,
+  0xac73, 0x88e4,
+  0xac74, 0x88e5,
+  0xac75, 0x88e6,
+  0xac76, 0x88e7,
+  0xac77, 0x88e8,
+  0xac78, 0x88e9,
+  0xac79, 0x88ea,
+  0xac7a, 0x88eb,
+  0xac7b, 0x88ec,
+  0xac7c, 0x88ed,
+  0xac7d, 0x88ee,
+  0xac7e, 0x88ef,
+  0xac7f, 0x88f0,
+  0xac80, 0x88f1,
+  0xac81, 0x88f3,
+  0xac82, 0x88f4,
+  0xac83, 0x88f5,
+  0xac84, 0x88f6,
+  0xac85, 0x88f7,
+  0xac86, 0x88f8,
+  0xac87, 0x88f9,
+  0xac88, 0x88fa,
+  0xac89, 0x88fb,
+  0xac8a, 0x88fc,
+  0xac8b, 0x88fd,
+  0xac8c, 0x8941,
+  0xac8d, 0x8942,
+  0xac8e, 0x8943,
+  0xac8f, 0x8944,
+  0xac90, 0x8945,
+  0xac91, 0x8946,
+  0xac92, 0x8947,
+  0xac93, 0x8948,
+  0xac94, 0x8949,
+  0xac95, 0x894a,
+  0xac96, 0x894b,
+  0xac97, 0x894c,
+  0xac98, 0x894d,
+  0xac99, 0x894e,
+  0xac9a, 0x894f,
+  0xac9b, 0x8950,
+  0xac9c, 0x8951,
+  0xac9d, 0x8953,
+  0xac9e, 0x8954,
+  0xac9f, 0x8955,
+  0xaca0, 0x8956,
+  0xaca1, 0x8957,
+  0xaca2, 0x8958,
+  0xaca3, 0x8959,
+  0xaca4, 0x895a,
+  0xaca5, 0x895b,
+  0xaca6, 0x895c,
+  0xaca7, 0x895d,
+  0xaca8, 0x8961,
+  0xaca9, 0x8962,
+  0xacaa, 0x8963,
+  0xacab, 0x8964,
+  0xacac, 0x8965,
+  0xacad, 0x8966,
+  0xacae, 0x8967,
+  0xacaf, 0x8968,
+  0xacb0, 0x8969,
+  0xacb1, 0x896a,
+  0xacb2, 0x896b,
+  0xacb3, 0x896c,
+  0xacb4, 0x896d,
+  0xacb5, 0x896e,
+  0xacb6, 0x896f,
+  0xacb7, 0x8970,
+  0xacb8, 0x8971,
+  0xacb9, 0x8973,
+  0xacba, 0x8974,
+  0xacbb, 0x8975,
+  0xacbc, 0x8976,
+  0xacbd, 0x8977,
+  0xacbe, 0x8978,
+  0xacbf, 0x8979,
+  0xacc0, 0x897a,
+  0xacc1, 0x897b,
+  0xacc2, 0x897c,
+  0xacc3, 0x897d,
+  0xacc4, 0x8981,
+  0xacc5, 0x8982,
+  0xacc6, 0x8983,
+  0xacc7, 0x8984,
+  0xacc8, 0x8985,
+  0xacc9, 0x8986,
+  0xacca, 0x8987,
+  0xaccb, 0x8988,
+  0xaccc, 0x8989,
+  0xaccd, 0x898a,
+  0xacce, 0x898b,
+  0xaccf, 0x898c,
+  0xacd0, 0x898d,
+  0xacd1, 0x898e,
+  0xacd2, 0x898f,
+  0xacd3, 0x8990,
+  0xacd4, 0x8991,
+  0xacd5, 0x8993,
+  0xacd6, 0x8994,
+  0xacd7, 0x8995,
+  0xacd8, 0x8996,
+  0xacd9, 0x8997,
+  0xacda, 0x8998,
+  0xacdb, 0x8999,
+  0xacdc, 0x899a,
+  0xacdd, 0x899b,
+  0xacde, 0x899c,
+  0xacdf, 0x899d,
+  0xace0, 0x89a1,
+  0xace1, 0x89a2,
+  0xace2, 0x89a3,
+  0xace3, 0x89a4,
+  0xace4, 0x89a5,
+  0xace5, 0x89a6,
+  0xace6, 0x89a7,
+  0xace7, 0x89a8,
+  0xace8, 0x89a9,
+  0xace9, 0x89aa,
+  0xacea, 0x89ab,
+  0xaceb, 0x89ac,
+  0xacec, 0x89ad,
+  0xaced, 0x89ae,
+  0xacee, 0x89af,
+  0xacef, 0x89b0,
+  0xacf0, 0x89b1,
+  0xacf1, 0x89b3,
+  0xacf2, 0x89b4,
+  0xacf3, 0x89b5,
+  0xacf4, 0x89b6,
+  0xacf5, 0x89b7,
+  0xacf6, 0x89b8,
+  0xacf7, 0x89b9,
+  0xacf8, 0x89ba,
+  0xacf9, 0x89bb,
+  0xacfa, 0x89bc,
+  0xacfb, 0x89bd,
+  0xacfc, 0x89c1,
+  0xacfd, 0x89c2,
+  0xacfe, 0x89c3,
+  0xacff, 0x89c4,
+  0xad00, 0x89c5,
+  0xad01, 0x89c6,
+  0xad02, 0x89c7,
+  0xad03, 0x89c8,
+  0xad04, 0x89c9,
+  0xad05, 0x89ca,
+  0xad06, 0x89cb,
+  0xad07, 0x89cc,
+  0xad08, 0x89cd,
+  0xad09, 0x89ce,
+  0xad0a, 0x89cf,
+  0xad0b, 0x89d0,
+  0xad0c, 0x89d1,
+  0xad0d, 0x89d3,
+  0xad0e, 0x89d4,
+  0xad0f, 0x89d5,
+  0xad10, 0x89d6,
+  0xad11, 0x89d7,
+  0xad12, 0x89d8,
+  0xad13, 0x89d9,
+  0xad14, 0x89da,
+  0xad15, 0x89db,
+  0xad16, 0x89dc,
+  0xad17, 0x89dd,
+  0xad18, 0x89e1,
+  0xad19, 0x89e2,
+  0xad1a, 0x89e3,
+  0xad1b, 0x89e4,
+  0xad1c, 0x89e5,
+  0xad1d, 0x89e6,
+  0xad1e, 0x89e7,
+  0xad1f, 0x89e8,
+  0xad20, 0x89e9,
+  0xad21, 0x89ea,
+  0xad22, 0x89eb,
+  0xad23, 0x89ec,
+  0xad24, 0x89ed,
+  0xad25, 0x89ee,
+  0xad26, 0x89ef,
+  0xad27, 0x89f0,
+  0xad28, 0x89f1,
+  0xad29, 0x89f3,
+  0xad2a, 0x89f4,
+  0xad2b, 0x89f5,
+  0xad2c, 0x89f6,
+  0xad2d, 0x89f7,
+  0xad2e, 0x89f8,
+  0xad2f, 0x89f9,
+  0xad30, 0x89fa,
+  0xad31, 0x89fb,
+  0xad32, 0x89fc,
+  0xad33, 0x89fd,
+  0xad34, 0x8a41,
+  0xad35, 0x8a42,
+  0xad36, 0x8a43,
+  0xad37, 0x8a44,
+  0xad38, 0x8a45,
+  0xad39, 0x8a46,
+  0xad3a, 0x8a47,
+  0xad3b, 0x8a48,
+  0xad3c, 0x8a49,
+  0xad3d, 0x8a4a,
+  0xad3e, 0x8a4b,
+  0xad3f, 0x8a4c,
+  0xad40, 0x8a4d,
+  0xad41, 0x8a4e,
+  0xad42, 0x8a4f,
+  0xad43, 0x8a50,
+  0xad44, 0x8a51,
+  0xad45, 0x8a53,
+  0xad46, 0x8a54,
+  0xad47, 0x8a55,
+  0xad48, 0x8a56,
+  0xad49, 0x8a57,
+  0xad4a, 0x8a58,
+  0xad4b, 0x8a59,
+  0xad4c, 0x8a5a,
+  0xad4d, 0x8a5b,
+  0xad4e, 0x8a5c,
+  0xad4f, 0x8a5d,
+  0xad50, 0x8a61,
+  0xad51, 0x8a62,
+  0xad52, 0x8a63,
+  0xad53, 0x8a64,
+  0xad54, 0x8a65,
+  0xad55, 0x8a66,
+  0xad56, 0x8a67,
+  0xad57, 0x8a68,
+  0xad58, 0x8a69,
+  0xad59, 0x8a6a,
+  0xad5a, 0x8a6b,
+  0xad5b, 0x8a6c,
+  0xad5c, 0x8a6d,
+  0xad5d, 0x8a6e,
+  0xad5e, 0x8a6f,
+  0xad5f, 0x8a70,
+  0xad60, 0x8a71,
+  0xad61, 0x8a73,
+  0xad62, 0x8a74,
+  0xad63, 0x8a75,
+  0xad64, 0x8a76,
+  0xad65, 0x8a77,
+  0xad66, 0x8a78,
+  0xad67, 0x8a79,
+  0xad68, 0x8a7a,
+  0xad69, 0x8a7b,
+  0xad6a, 0x8a7c,
+  0xad6b, 0x8a7d,
+  0xad6c, 0x8a81,
+  0xad6d, 0x8a82,
+  0xad6e, 0x8a83,
+  0xad6f, 0x8a84,
+  0xad70, 0x8a85,
+  0xad71, 0x8a86,
+  0xad72, 0x8a87,
+  0xad73, 0x8a88,
+  0xad74, 0x8a89,
+  0xad75, 0x8a8a,
+  0xad76, 0x8a8b,
+  0xad77, 0x8a8c,
+  0xad78, 0x8a8d,
+  0xad79, 0x8a8e,
+  0xad7a, 0x8a8f,
+  0xad7b, 0x8a90,
+  0xad7c, 0x8a91,
+  0xad7d, 0x8a93,
+  0xad7e, 0x8a94,
+  0xad7f, 0x8a95,
+  0xad80, 0x8a96,
+  0xad81, 0x8a97,
+  0xad82, 0x8a98,
+  0xad83, 0x8a99,
+  0xad84, 0x8a9a,
+  0xad85, 0x8a9b,
+  0xad86, 0x8a9c,
+  0xad87, 0x8a9d,
+  0xad88, 0x8aa1,
+  0xad89, 0x8aa2,
+  0xad8a, 0x8aa3,
+  0xad8b, 0x8aa4,
+  0xad8c, 0x8aa5,
+  0xad8d, 0x8aa6,
+  0xad8e, 0x8aa7,
+  0xad8f, 0x8aa8,
+  0xad90, 0x8aa9,
+  0xad91, 0x8aaa,
+  0xad92, 0x8aab,
+  0xad93, 0x8aac,
+  0xad94, 0x8aad,
+  0xad95, 0x8aae,
+  0xad96, 0x8aaf,
+  0xad97, 0x8ab0,
+  0xad98, 0x8ab1,
+  0xad99, 0x8ab3,
+  0xad9a, 0x8ab4,
+  0xad9b, 0x8ab5,
+  0xad9c, 0x8ab6,
+  0xad9d, 0x8ab7,
+  0xad9e, 0x8ab8,
+  0xad9f, 0x8ab9,
+  0xada0, 0x8aba,
+  0xada1, 0x8abb,
+  0xada2, 0x8abc,
+  0xada3, 0x8abd,
+  0xada4, 0x8ac1,
+  0xada5, 0x8ac2,
+  0xada6, 0x8ac3,
+  0xada7, 0x8ac4,
+  0xada8, 0x8ac5,
+  0xada9, 0x8ac6,
+  0xadaa, 0x8ac7,
+  0xadab, 0x8ac8,
+  0xadac, 0x8ac9,
+  0xadad, 0x8aca,
+  0xadae, 0x8acb,
+  0xadaf, 0x8acc,
+  0xadb0, 0x8acd,
+  0xadb1, 0x8ace,
+  0xadb2, 0x8acf,
+  0xadb3, 0x8ad0,
+  0xadb4, 0x8ad1,
+  0xadb5, 0x8ad3,
+  0xadb6, 0x8ad4,
+  0xadb7, 0x8ad5,
+  0xadb8, 0x8ad6,
+  0xadb9, 0x8ad7,
+  0xadba, 0x8ad8,
+  0xadbb, 0x8ad9,
+  0xadbc, 0x8ada,
+  0xadbd, 0x8adb,
+  0xadbe, 0x8adc,
+  0xadbf, 0x8add,
+  0xadc0, 0x8ae1,
+  0xadc1, 0x8ae2,
+  0xadc2, 0x8ae3,
+  0xadc3, 0x8ae4,
+  0xadc4, 0x8ae5,
+  0xadc5, 0x8ae6,
+  0xadc6, 0x8ae7,
+  0xadc7, 0x8ae8,
+  0xadc8, 0x8ae9,
+  0xadc9, 0x8aea,
+  0xadca, 0x8aeb,
+  0xadcb, 0x8aec,
+  0xadcc, 0x8aed,
+  0xadcd, 0x8aee,
+  0xadce, 0x8aef,
+  0xadcf, 0x8af0,
+  0xadd0, 0x8af1,
+  0xadd1, 0x8af3,
+  0xadd2, 0x8af4,
+  0xadd3, 0x8af5,
+  0xadd4, 0x8af6,
+  0xadd5, 0x8af7,
+  0xadd6, 0x8af8,
+  0xadd7, 0x8af9,
+  0xadd8, 0x8afa,
+  0xadd9, 0x8afb,
+  0xadda, 0x8afc,
+  0xaddb, 0x8afd,
+  0xaddc, 0x8b41,
+  0xaddd, 0x8b42,
+  0xadde, 0x8b43,
+  0xaddf, 0x8b44,
+  0xade0, 0x8b45,
+  0xade1, 0x8b46,
+  0xade2, 0x8b47,
+  0xade3, 0x8b48,
+  0xade4, 0x8b49,
+  0xade5, 0x8b4a,
+  0xade6, 0x8b4b,
+  0xade7, 0x8b4c,
+  0xade8, 0x8b4d,
+  0xade9, 0x8b4e,
+  0xadea, 0x8b4f,
+  0xadeb, 0x8b50,
+  0xadec, 0x8b51,
+  0xaded, 0x8b53,
+  0xadee, 0x8b54,
+  0xadef, 0x8b55,
+  0xadf0, 0x8b56,
+  0xadf1, 0x8b57,
+  0xadf2, 0x8b58,
+  0xadf3, 0x8b59,
+  0xadf4, 0x8b5a,
+  0xadf5, 0x8b5b,
+  0xadf6, 0x8b5c,
+  0xadf7, 0x8b5d,
+  0xadf8, 0x8b61,
+  0xadf9, 0x8b62,
+  0xadfa, 0x8b63,
+  0xadfb, 0x8b64,
+  0xadfc, 0x8b65,
+  0xadfd, 0x8b66,
+  0xadfe, 0x8b67,
+  0xadff, 0x8b68,
+  0xae00, 0x8b69,
+  0xae01, 0x8b6a,
+  0xae02, 0x8b6b,
+  0xae03, 0x8b6c,
+  0xae04, 0x8b6d,
+  0xae05, 0x8b6e,
+  0xae06, 0x8b6f,
+  0xae07, 0x8b70,
+  0xae08, 0x8b71,
+  0xae09, 0x8b73,
+  0xae0a, 0x8b74,
+  0xae0b, 0x8b75,
+  0xae0c, 0x8b76,
+  0xae0d, 0x8b77,
+  0xae0e, 0x8b78,
+  0xae0f, 0x8b79,
+  0xae10, 0x8b7a,
+  0xae11, 0x8b7b,
+  0xae12, 0x8b7c,
+  0xae13, 0x8b7d,
+  0xae14, 0x8b81,
+  0xae15, 0x8b82,
+  0xae16, 0x8b83,
+  0xae17, 0x8b84,
+  0xae18, 0x8b85,
+  0xae19, 0x8b86,
+  0xae1a, 0x8b87,
+  0xae1b, 0x8b88,
+  0xae1c, 0x8b89,
+  0xae1d, 0x8b8a,
+  0xae1e, 0x8b8b,
+  0xae1f, 0x8b8c,
+  0xae20, 0x8b8d,
+  0xae21, 0x8b8e,
+  0xae22, 0x8b8f,
+  0xae23, 0x8b90,
+  0xae24, 0x8b91,
+  0xae25, 0x8b93,
+  0xae26, 0x8b94,
+  0xae27, 0x8b95,
+  0xae28, 0x8b96,
+  0xae29, 0x8b97,
+  0xae2a, 0x8b98,
+  0xae2b, 0x8b99,
+  0xae2c, 0x8b9a,
+  0xae2d, 0x8b9b,
+  0xae2e, 0x8b9c,
+  0xae2f, 0x8b9d,
+  0xae30, 0x8ba1,
+  0xae31, 0x8ba2,
+  0xae32, 0x8ba3,
+  0xae33, 0x8ba4,
+  0xae34, 0x8ba5,
+  0xae35, 0x8ba6,
+  0xae36, 0x8ba7,
+  0xae37, 0x8ba8,
+  0xae38, 0x8ba9,
+  0xae39, 0x8baa,
+  0xae3a, 0x8bab,
+  0xae3b, 0x8bac,
+  0xae3c, 0x8bad,
+  0xae3d, 0x8bae,
+  0xae3e, 0x8baf,
+  0xae3f, 0x8bb0,
+  0xae40, 0x8bb1,
+  0xae41, 0x8bb3,
+  0xae42, 0x8bb4,
+  0xae43, 0x8bb5,
+  0xae44, 0x8bb6,
+  0xae45, 0x8bb7,
+  0xae46, 0x8bb8,
+  0xae47, 0x8bb9,
+  0xae48, 0x8bba,
+  0xae49, 0x8bbb,
+  0xae4a, 0x8bbc,
+  0xae4b, 0x8bbd,
+  0xae4c, 0x8c61,
+  0xae4d, 0x8c62,
+  0xae4e, 0x8c63,
+  0xae4f, 0x8c64,
+  0xae50, 0x8c65,
+  0xae51, 0x8c66,
+  0xae52, 0x8c67,
+  0xae53, 0x8c68,
+  0xae54, 0x8c69,
+  0xae55, 0x8c6a,
+  0xae56, 0x8c6b,
+  0xae57, 0x8c6c,
+  0xae58, 0x8c6d,
+  0xae59, 0x8c6e,
+  0xae5a, 0x8c6f,
+  0xae5b, 0x8c70,
+  0xae5c, 0x8c71,
+  0xae5d, 0x8c73,
+  0xae5e, 0x8c74,
+  0xae5f, 0x8c75,
+  0xae60, 0x8c76,
+  0xae61, 0x8c77,
+  0xae62, 0x8c78,
+  0xae63, 0x8c79,
+  0xae64, 0x8c7a,
+  0xae65, 0x8c7b,
+  0xae66, 0x8c7c,
+  0xae67, 0x8c7d,
+  0xae68, 0x8c81,
+  0xae69, 0x8c82,
+  0xae6a, 0x8c83,
+  0xae6b, 0x8c84,
+  0xae6c, 0x8c85,
+  0xae6d, 0x8c86,
+  0xae6e, 0x8c87,
+  0xae6f, 0x8c88,
+  0xae70, 0x8c89,
+  0xae71, 0x8c8a,
+  0xae72, 0x8c8b,
+  0xae73, 0x8c8c,
+  0xae74, 0x8c8d,
+  0xae75, 0x8c8e,
+  0xae76, 0x8c8f,
+  0xae77, 0x8c90,
+  0xae78, 0x8c91,
+  0xae79, 0x8c93,
+  0xae7a, 0x8c94,
+  0xae7b, 0x8c95,
+  0xae7c, 0x8c96,
+  0xae7d, 0x8c97,
+  0xae7e, 0x8c98,
+  0xae7f, 0x8c99,
+  0xae80, 0x8c9a,
+  0xae81, 0x8c9b,
+  0xae82, 0x8c9c,
+  0xae83, 0x8c9d,
+  0xae84, 0x8ca1,
+  0xae85, 0x8ca2,
+  0xae86, 0x8ca3,
+  0xae87, 0x8ca4,
+  0xae88, 0x8ca5,
+  0xae89, 0x8ca6,
+  0xae8a, 0x8ca7,
+  0xae8b, 0x8ca8,
+  0xae8c, 0x8ca9,
+  0xae8d, 0x8caa,
+  0xae8e, 0x8cab,
+  0xae8f, 0x8cac,
+  0xae90, 0x8cad,
+  0xae91, 0x8cae,
+  0xae92, 0x8caf,
+  0xae93, 0x8cb0,
+  0xae94, 0x8cb1,
+  0xae95, 0x8cb3,
+  0xae96, 0x8cb4,
+  0xae97, 0x8cb5,
+  0xae98, 0x8cb6,
+  0xae99, 0x8cb7,
+  0xae9a, 0x8cb8,
+  0xae9b, 0x8cb9,
+  0xae9c, 0x8cba,
+  0xae9d, 0x8cbb,
+  0xae9e, 0x8cbc,
+  0xae9f, 0x8cbd,
+  0xaea0, 0x8cc1,
+  0xaea1, 0x8cc2,
+  0xaea2, 0x8cc3,
+  0xaea3, 0x8cc4,
+  0xaea4, 0x8cc5,
+  0xaea5, 0x8cc6,
+  0xaea6, 0x8cc7,
+  0xaea7, 0x8cc8,
+  0xaea8, 0x8cc9,
+  0xaea9, 0x8cca,
+  0xaeaa, 0x8ccb,
+  0xaeab, 0x8ccc,
+  0xaeac, 0x8ccd,
+  0xaead, 0x8cce,
+  0xaeae, 0x8ccf,
+  0xaeaf, 0x8cd0,
+  0xaeb0, 0x8cd1,
+  0xaeb1, 0x8cd3,
+  0xaeb2, 0x8cd4,
+  0xaeb3, 0x8cd5,
+  0xaeb4, 0x8cd6,
+  0xaeb5, 0x8cd7,
+  0xaeb6, 0x8cd8,
+  0xaeb7, 0x8cd9,
+  0xaeb8, 0x8cda,
+  0xaeb9, 0x8cdb,
+  0xaeba, 0x8cdc,
+  0xaebb, 0x8cdd,
+  0xaebc, 0x8ce1,
+  0xaebd, 0x8ce2,
+  0xaebe, 0x8ce3,
+  0xaebf, 0x8ce4,
+  0xaec0, 0x8ce5,
+  0xaec1, 0x8ce6,
+  0xaec2, 0x8ce7,
+  0xaec3, 0x8ce8,
+  0xaec4, 0x8ce9,
+  0xaec5, 0x8cea,
+  0xaec6, 0x8ceb,
+  0xaec7, 0x8cec,
+  0xaec8, 0x8ced,
+  0xaec9, 0x8cee,
+  0xaeca, 0x8cef,
+  0xaecb, 0x8cf0,
+  0xaecc, 0x8cf1,
+  0xaecd, 0x8cf3,
+  0xaece, 0x8cf4,
+  0xaecf, 0x8cf5,
+  0xaed0, 0x8cf6,
+  0xaed1, 0x8cf7,
+  0xaed2, 0x8cf8,
+  0xaed3, 0x8cf9,
+  0xaed4, 0x8cfa,
+  0xaed5, 0x8cfb,
+  0xaed6, 0x8cfc,
+  0xaed7, 0x8cfd,
+  0xaed8, 0x8d41,
+  0xaed9, 0x8d42,
+  0xaeda, 0x8d43,
+  0xaedb, 0x8d44,
+  0xaedc, 0x8d45,
+  0xaedd, 0x8d46,
+  0xaede, 0x8d47,
+  0xaedf, 0x8d48,
+  0xaee0, 0x8d49,
+  0xaee1, 0x8d4a,
+  0xaee2, 0x8d4b,
+  0xaee3, 0x8d4c,
+  0xaee4, 0x8d4d,
+  0xaee5, 0x8d4e,
+  0xaee6, 0x8d4f,
+  0xaee7, 0x8d50,
+  0xaee8, 0x8d51,
+  0xaee9, 0x8d53,
+  0xaeea, 0x8d54,
+  0xaeeb, 0x8d55,
+  0xaeec, 0x8d56,
+  0xaeed, 0x8d57,
+  0xaeee, 0x8d58,
+  0xaeef, 0x8d59,
+  0xaef0, 0x8d5a,
+  0xaef1, 0x8d5b,
+  0xaef2, 0x8d5c,
+  0xaef3, 0x8d5d,
+  0xaef4, 0x8d61,
+  0xaef5, 0x8d62,
+  0xaef6, 0x8d63,
+  0xaef7, 0x8d64,
+  0xaef8, 0x8d65,
+  0xaef9, 0x8d66,
+  0xaefa, 0x8d67,
+  0xaefb, 0x8d68,
+  0xaefc, 0x8d69,
+  0xaefd, 0x8d6a,
+  0xaefe, 0x8d6b,
+  0xaeff, 0x8d6c,
+  0xaf00, 0x8d6d,
+  0xaf01, 0x8d6e,
+  0xaf02, 0x8d6f,
+  0xaf03, 0x8d70,
+  0xaf04, 0x8d71,
+  0xaf05, 0x8d73,
+  0xaf06, 0x8d74,
+  0xaf07, 0x8d75,
+  0xaf08, 0x8d76,
+  0xaf09, 0x8d77,
+  0xaf0a, 0x8d78,
+  0xaf0b, 0x8d79,
+  0xaf0c, 0x8d7a,
+  0xaf0d, 0x8d7b,
+  0xaf0e, 0x8d7c,
+  0xaf0f, 0x8d7d,
+  0xaf10, 0x8d81,
+  0xaf11, 0x8d82,
+  0xaf12, 0x8d83,
+  0xaf13, 0x8d84,
+  0xaf14, 0x8d85,
+  0xaf15, 0x8d86,
+  0xaf16, 0x8d87,
+  0xaf17, 0x8d88,
+  0xaf18, 0x8d89,
+  0xaf19, 0x8d8a,
+  0xaf1a, 0x8d8b,
+  0xaf1b, 0x8d8c,
+  0xaf1c, 0x8d8d,
+  0xaf1d, 0x8d8e,
+  0xaf1e, 0x8d8f,
+  0xaf1f, 0x8d90,
+  0xaf20, 0x8d91,
+  0xaf21, 0x8d93,
+  0xaf22, 0x8d94,
+  0xaf23, 0x8d95,
+  0xaf24, 0x8d96,
+  0xaf25, 0x8d97,
+  0xaf26, 0x8d98,
+  0xaf27, 0x8d99,
+  0xaf28, 0x8d9a,
+  0xaf29, 0x8d9b,
+  0xaf2a, 0x8d9c,
+  0xaf2b, 0x8d9d,
+  0xaf2c, 0x8da1,
+  0xaf2d, 0x8da2,
+  0xaf2e, 0x8da3,
+  0xaf2f, 0x8da4,
+  0xaf30, 0x8da5,
+  0xaf31, 0x8da6,
+  0xaf32, 0x8da7,
+  0xaf33, 0x8da8,
+  0xaf34, 0x8da9,
+  0xaf35, 0x8daa,
+  0xaf36, 0x8dab,
+  0xaf37, 0x8dac,
+  0xaf38, 0x8dad,
+  0xaf39, 0x8dae,
+  0xaf3a, 0x8daf,
+  0xaf3b, 0x8db0,
+  0xaf3c, 0x8db1,
+  0xaf3d, 0x8db3,
+  0xaf3e, 0x8db4,
+  0xaf3f, 0x8db5,
+  0xaf40, 0x8db6,
+  0xaf41, 0x8db7,
+  0xaf42, 0x8db8,
+  0xaf43, 0x8db9,
+  0xaf44, 0x8dba,
+  0xaf45, 0x8dbb,
+  0xaf46, 0x8dbc,
+  0xaf47, 0x8dbd,
+  0xaf48, 0x8dc1,
+  0xaf49, 0x8dc2,
+  0xaf4a, 0x8dc3,
+  0xaf4b, 0x8dc4,
+  0xaf4c, 0x8dc5,
+  0xaf4d, 0x8dc6,
+  0xaf4e, 0x8dc7,
+  0xaf4f, 0x8dc8,
+  0xaf50, 0x8dc9,
+  0xaf51, 0x8dca,
+  0xaf52, 0x8dcb,
+  0xaf53, 0x8dcc,
+  0xaf54, 0x8dcd,
+  0xaf55, 0x8dce,
+  0xaf56, 0x8dcf,
+  0xaf57, 0x8dd0,
+  0xaf58, 0x8dd1,
+  0xaf59, 0x8dd3,
+  0xaf5a, 0x8dd4,
+  0xaf5b, 0x8dd5,
+  0xaf5c, 0x8dd6,
+  0xaf5d, 0x8dd7,
+  0xaf5e, 0x8dd8,
+  0xaf5f, 0x8dd9,
+  0xaf60, 0x8dda,
+  0xaf61, 0x8ddb,
+  0xaf62, 0x8ddc,
+  0xaf63, 0x8ddd,
+  0xaf64, 0x8de1,
+  0xaf65, 0x8de2,
+  0xaf66, 0x8de3,
+  0xaf67, 0x8de4,
+  0xaf68, 0x8de5,
+  0xaf69, 0x8de6,
+  0xaf6a, 0x8de7,
+  0xaf6b, 0x8de8,
+  0xaf6c, 0x8de9,
+  0xaf6d, 0x8dea,
+  0xaf6e, 0x8deb,
+  0xaf6f, 0x8dec,
+  0xaf70, 0x8ded,
+  0xaf71, 0x8dee,
+  0xaf72, 0x8def,
+  0xaf73, 0x8df0,
+  0xaf74, 0x8df1,
+  0xaf75, 0x8df3,
+  0xaf76, 0x8df4,
+  0xaf77, 0x8df5,
+  0xaf78, 0x8df6,
+  0xaf79, 0x8df7,
+  0xaf7a, 0x8df8,
+  0xaf7b, 0x8df9,
+  0xaf7c, 0x8dfa,
+  0xaf7d, 0x8dfb,
+  0xaf7e, 0x8dfc,
+  0xaf7f, 0x8dfd,
+  0xaf80, 0x8e41,
+  0xaf81, 0x8e42,
+  0xaf82, 0x8e43,
+  0xaf83, 0x8e44,
+  0xaf84, 0x8e45,
+  0xaf85, 0x8e46,
+  0xaf86, 0x8e47,
+  0xaf87, 0x8e48,
+  0xaf88, 0x8e49,
+  0xaf89, 0x8e4a,
+  0xaf8a, 0x8e4b,
+  0xaf8b, 0x8e4c,
+  0xaf8c, 0x8e4d,
+  0xaf8d, 0x8e4e,
+  0xaf8e, 0x8e4f,
+  0xaf8f, 0x8e50,
+  0xaf90, 0x8e51,
+  0xaf91, 0x8e53,
+  0xaf92, 0x8e54,
+  0xaf93, 0x8e55,
+  0xaf94, 0x8e56,
+  0xaf95, 0x8e57,
+  0xaf96, 0x8e58,
+  0xaf97, 0x8e59,
+  0xaf98, 0x8e5a,
+  0xaf99, 0x8e5b,
+  0xaf9a, 0x8e5c,
+  0xaf9b, 0x8e5d,
+  0xaf9c, 0x8e61,
+  0xaf9d, 0x8e62,
+  0xaf9e, 0x8e63,
+  0xaf9f, 0x8e64,
+  0xafa0, 0x8e65,
+  0xafa1, 0x8e66,
+  0xafa2, 0x8e67,
+  0xafa3, 0x8e68,
+  0xafa4, 0x8e69,
+  0xafa5, 0x8e6a,
+  0xafa6, 0x8e6b,
+  0xafa7, 0x8e6c,
+  0xafa8, 0x8e6d,
+  0xafa9, 0x8e6e,
+  0xafaa, 0x8e6f,
+  0xafab, 0x8e70,
+  0xafac, 0x8e71,
+  0xafad, 0x8e73,
+  0xafae, 0x8e74,
+  0xafaf, 0x8e75,
+  0xafb0, 0x8e76,
+  0xafb1, 0x8e77,
+  0xafb2, 0x8e78,
+  0xafb3, 0x8e79,
+  0xafb4, 0x8e7a,
+  0xafb5, 0x8e7b,
+  0xafb6, 0x8e7c,
+  0xafb7, 0x8e7d,
+  0xafb8, 0x8e81,
+  0xafb9, 0x8e82,
+  0xafba, 0x8e83,
+  0xafbb, 0x8e84,
+  0xafbc, 0x8e85,
+  0xafbd, 0x8e86,
+  0xafbe, 0x8e87,
+  0xafbf, 0x8e88,
+  0xafc0, 0x8e89,
+  0xafc1, 0x8e8a,
+  0xafc2, 0x8e8b,
+  0xafc3, 0x8e8c,
+  0xafc4, 0x8e8d,
+  0xafc5, 0x8e8e,
+  0xafc6, 0x8e8f,
+  0xafc7, 0x8e90,
+  0xafc8, 0x8e91,
+  0xafc9, 0x8e93,
+  0xafca, 0x8e94,
+  0xafcb, 0x8e95,
+  0xafcc, 0x8e96,
+  0xafcd, 0x8e97,
+  0xafce, 0x8e98,
+  0xafcf, 0x8e99,
+  0xafd0, 0x8e9a,
+  0xafd1, 0x8e9b,
+  0xafd2, 0x8e9c,
+  0xafd3, 0x8e9d,
+  0xafd4, 0x8ea1,
+  0xafd5, 0x8ea2,
+  0xafd6, 0x8ea3,
+  0xafd7, 0x8ea4,
+  0xafd8, 0x8ea5,
+  0xafd9, 0x8ea6,
+  0xafda, 0x8ea7,
+  0xafdb, 0x8ea8,
+  0xafdc, 0x8ea9,
+  0xafdd, 0x8eaa,
+  0xafde, 0x8eab,
+  0xafdf, 0x8eac,
+  0xafe0, 0x8ead,
+  0xafe1, 0x8eae,
+  0xafe2, 0x8eaf,
+  0xafe3, 0x8eb0,
+  0xafe4, 0x8eb1,
+  0xafe5, 0x8eb3,
+  0xafe6, 0x8eb4,
+  0xafe7, 0x8eb5,
+  0xafe8, 0x8eb6,
+  0xafe9, 0x8eb7,
+  0xafea, 0x8eb8,
+  0xafeb, 0x8eb9,
+  0xafec, 0x8eba,
+  0xafed, 0x8ebb,
+  0xafee, 0x8ebc,
+  0xafef, 0x8ebd,
+  0xaff0, 0x8ec1,
+  0xaff1, 0x8ec2,
+  0xaff2, 0x8ec3,
+  0xaff3, 0x8ec4,
+  0xaff4, 0x8ec5,
+  0xaff5, 0x8ec6,
+  0xaff6, 0x8ec7,
+  0xaff7, 0x8ec8,
+  0xaff8, 0x8ec9,
+  0xaff9, 0x8eca,
+  0xaffa, 0x8ecb,
+  0xaffb, 0x8ecc,
+  0xaffc, 0x8ecd,
+  0xaffd, 0x8ece,
+  0xaffe, 0x8ecf,
+  0xafff, 0x8ed0,
+  0xb000, 0x8ed1,
+  0xb001, 0x8ed3,
+  0xb002, 0x8ed4,
+  0xb003, 0x8ed5,
+  0xb004, 0x8ed6,
+  0xb005, 0x8ed7,
+  0xb006, 0x8ed8,
+  0xb007, 0x8ed9,
+  0xb008, 0x8eda,
+  0xb009, 0x8edb,
+  0xb00a, 0x8edc,
+  0xb00b, 0x8edd,
+  0xb00c, 0x8ee1,
+  0xb00d, 0x8ee2,
+  0xb00e, 0x8ee3,
+  0xb00f, 0x8ee4,
+  0xb010, 0x8ee5,
+  0xb011, 0x8ee6,
+  0xb012, 0x8ee7,
+  0xb013, 0x8ee8,
+  0xb014, 0x8ee9,
+  0xb015, 0x8eea,
+  0xb016, 0x8eeb,
+  0xb017, 0x8eec,
+  0xb018, 0x8eed,
+  0xb019, 0x8eee,
+  0xb01a, 0x8eef,
+  0xb01b, 0x8ef0,
+  0xb01c, 0x8ef1,
+  0xb01d, 0x8ef3,
+  0xb01e, 0x8ef4,
+  0xb01f, 0x8ef5,
+  0xb020, 0x8ef6,
+  0xb021, 0x8ef7,
+  0xb022, 0x8ef8,
+  0xb023, 0x8ef9,
+  0xb024, 0x8efa,
+  0xb025, 0x8efb,
+  0xb026, 0x8efc,
+  0xb027, 0x8efd,
+  0xb028, 0x8f41,
+  0xb029, 0x8f42,
+  0xb02a, 0x8f43,
+  0xb02b, 0x8f44,
+  0xb02c, 0x8f45,
+  0xb02d, 0x8f46,
+  0xb02e, 0x8f47,
+  0xb02f, 0x8f48,
+  0xb030, 0x8f49,
+  0xb031, 0x8f4a,
+  0xb032, 0x8f4b,
+  0xb033, 0x8f4c,
+  0xb034, 0x8f4d,
+  0xb035, 0x8f4e,
+  0xb036, 0x8f4f,
+  0xb037, 0x8f50,
+  0xb038, 0x8f51,
+  0xb039, 0x8f53,
+  0xb03a, 0x8f54,
+  0xb03b, 0x8f55,
+  0xb03c, 0x8f56,
+  0xb03d, 0x8f57,
+  0xb03e, 0x8f58,
+  0xb03f, 0x8f59,
+  0xb040, 0x8f5a,
+  0xb041, 0x8f5b,
+  0xb042, 0x8f5c,
+  0xb043, 0x8f5d,
+  0xb044, 0x8f61,
+  0xb045, 0x8f62,
+  0xb046, 0x8f63,
+  0xb047, 0x8f64,
+  0xb048, 0x8f65,
+  0xb049, 0x8f66,
+  0xb04a, 0x8f67,
+  0xb04b, 0x8f68,
+  0xb04c, 0x8f69,
+  0xb04d, 0x8f6a,
+  0xb04e, 0x8f6b,
+  0xb04f, 0x8f6c,
+  0xb050, 0x8f6d,
+  0xb051, 0x8f6e,
+  0xb052, 0x8f6f,
+  0xb053, 0x8f70,
+  0xb054, 0x8f71,
+  0xb055, 0x8f73,
+  0xb056, 0x8f74,
+  0xb057, 0x8f75,
+  0xb058, 0x8f76,
+  0xb059, 0x8f77,
+  0xb05a, 0x8f78,
+  0xb05b, 0x8f79,
+  0xb05c, 0x8f7a,
+  0xb05d, 0x8f7b,
+  0xb05e, 0x8f7c,
+  0xb05f, 0x8f7d,
+  0xb060, 0x8f81,
+  0xb061, 0x8f82,
+  0xb062, 0x8f83,
+  0xb063, 0x8f84,
+  0xb064, 0x8f85,
+  0xb065, 0x8f86,
+  0xb066, 0x8f87,
+  0xb067, 0x8f88,
+  0xb068, 0x8f89,
+  0xb069, 0x8f8a,
+  0xb06a, 0x8f8b,
+  0xb06b, 0x8f8c,
+  0xb06c, 0x8f8d,
+  0xb06d, 0x8f8e,
+  0xb06e, 0x8f8f,
+  0xb06f, 0x8f90,
+  0xb070, 0x8f91,
+  0xb071, 0x8f93,
+  0xb072, 0x8f94,
+  0xb073, 0x8f95,
+  0xb074, 0x8f96,
+  0xb075, 0x8f97,
+  0xb076, 0x8f98,
+  0xb077, 0x8f99,
+  0xb078, 0x8f9a,
+  0xb079, 0x8f9b,
+  0xb07a, 0x8f9c,
+  0xb07b, 0x8f9d,
+  0xb07c, 0x8fa1,
+  0xb07d, 0x8fa2,
+  0xb07e, 0x8fa3,
+  0xb07f, 0x8fa4,
+  0xb080, 0x8fa5,
+  0xb081, 0x8fa6,
+  0xb082, 0x8fa7,
+  0xb083, 0x8fa8,
+  0xb084, 0x8fa9,
+  0xb085, 0x8faa,
+  0xb086, 0x8fab,
+  0xb087, 0x8fac,
+  0xb088, 0x8fad,
+  0xb089, 0x8fae,
+  0xb08a, 0x8faf,
+  0xb08b, 0x8fb0,
+  0xb08c, 0x8fb1,
+  0xb08d, 0x8fb3,
+  0xb08e, 0x8fb4,
+  0xb08f, 0x8fb5,
+  0xb090, 0x8fb6,
+  0xb091, 0x8fb7,
+  0xb092, 0x8fb8,
+  0xb093, 0x8fb9,
+  0xb094, 0x8fba,
+  0xb095, 0x8fbb,
+  0xb096, 0x8fbc,
+  0xb097, 0x8fbd,
+  0xb098, 0x9061,
+  0xb099, 0x9062,
+  0xb09a, 0x9063,
+  0xb09b, 0x9064,
+  0xb09c, 0x9065,
+  0xb09d, 0x9066,
+  0xb09e, 0x9067,
+  0xb09f, 0x9068,
+  0xb0a0, 0x9069,
+  0xb0a1, 0x906a,
+  0xb0a2, 0x906b,
+  0xb0a3, 0x906c,
+  0xb0a4, 0x906d,
+  0xb0a5, 0x906e,
+  0xb0a6, 0x906f,
+  0xb0a7, 0x9070,
+  0xb0a8, 0x9071,
+  0xb0a9, 0x9073,
+  0xb0aa, 0x9074,
+  0xb0ab, 0x9075,
+  0xb0ac, 0x9076,
+  0xb0ad, 0x9077,
+  0xb0ae, 0x9078,
+  0xb0af, 0x9079,
+  0xb0b0, 0x907a,
+  0xb0b1, 0x907b,
+  0xb0b2, 0x907c,
+  0xb0b3, 0x907d,
+  0xb0b4, 0x9081,
+  0xb0b5, 0x9082,
+  0xb0b6, 0x9083,
+  0xb0b7, 0x9084,
+  0xb0b8, 0x9085,
+  0xb0b9, 0x9086,
+  0xb0ba, 0x9087,
+  0xb0bb, 0x9088,
+  0xb0bc, 0x9089,
+  0xb0bd, 0x908a,
+  0xb0be, 0x908b,
+  0xb0bf, 0x908c,
+  0xb0c0, 0x908d,
+  0xb0c1, 0x908e,
+  0xb0c2, 0x908f,
+  0xb0c3, 0x9090,
+  0xb0c4, 0x9091,
+  0xb0c5, 0x9093,
+  0xb0c6, 0x9094,
+  0xb0c7, 0x9095,
+  0xb0c8, 0x9096,
+  0xb0c9, 0x9097,
+  0xb0ca, 0x9098,
+  0xb0cb, 0x9099,
+  0xb0cc, 0x909a,
+  0xb0cd, 0x909b,
+  0xb0ce, 0x909c,
+  0xb0cf, 0x909d,
+  0xb0d0, 0x90a1,
+  0xb0d1, 0x90a2,
+  0xb0d2, 0x90a3,
+  0xb0d3, 0x90a4,
+  0xb0d4, 0x90a5,
+  0xb0d5, 0x90a6,
+  0xb0d6, 0x90a7,
+  0xb0d7, 0x90a8,
+  0xb0d8, 0x90a9,
+  0xb0d9, 0x90aa,
+  0xb0da, 0x90ab,
+  0xb0db, 0x90ac,
+  0xb0dc, 0x90ad,
+  0xb0dd, 0x90ae,
+  0xb0de, 0x90af,
+  0xb0df, 0x90b0,
+  0xb0e0, 0x90b1,
+  0xb0e1, 0x90b3,
+  0xb0e2, 0x90b4,
+  0xb0e3, 0x90b5,
+  0xb0e4, 0x90b6,
+  0xb0e5, 0x90b7,
+  0xb0e6, 0x90b8,
+  0xb0e7, 0x90b9,
+  0xb0e8, 0x90ba,
+  0xb0e9, 0x90bb,
+  0xb0ea, 0x90bc,
+  0xb0eb, 0x90bd,
+  0xb0ec, 0x90c1,
+  0xb0ed, 0x90c2,
+  0xb0ee, 0x90c3,
+  0xb0ef, 0x90c4,
+  0xb0f0, 0x90c5,
+  0xb0f1, 0x90c6,
+  0xb0f2, 0x90c7,
+  0xb0f3, 0x90c8,
+  0xb0f4, 0x90c9,
+  0xb0f5, 0x90ca,
+  0xb0f6, 0x90cb,
+  0xb0f7, 0x90cc,
+  0xb0f8, 0x90cd,
+  0xb0f9, 0x90ce,
+  0xb0fa, 0x90cf,
+  0xb0fb, 0x90d0,
+  0xb0fc, 0x90d1,
+  0xb0fd, 0x90d3,
+  0xb0fe, 0x90d4,
+  0xb0ff, 0x90d5,
+  0xb100, 0x90d6,
+  0xb101, 0x90d7,
+  0xb102, 0x90d8,
+  0xb103, 0x90d9,
+  0xb104, 0x90da,
+  0xb105, 0x90db,
+  0xb106, 0x90dc,
+  0xb107, 0x90dd,
+  0xb108, 0x90e1,
+  0xb109, 0x90e2,
+  0xb10a, 0x90e3,
+  0xb10b, 0x90e4,
+  0xb10c, 0x90e5,
+  0xb10d, 0x90e6,
+  0xb10e, 0x90e7,
+  0xb10f, 0x90e8,
+  0xb110, 0x90e9,
+  0xb111, 0x90ea,
+  0xb112, 0x90eb,
+  0xb113, 0x90ec,
+  0xb114, 0x90ed,
+  0xb115, 0x90ee,
+  0xb116, 0x90ef,
+  0xb117, 0x90f0,
+  0xb118, 0x90f1,
+  0xb119, 0x90f3,
+  0xb11a, 0x90f4,
+  0xb11b, 0x90f5,
+  0xb11c, 0x90f6,
+  0xb11d, 0x90f7,
+  0xb11e, 0x90f8,
+  0xb11f, 0x90f9,
+  0xb120, 0x90fa,
+  0xb121, 0x90fb,
+  0xb122, 0x90fc,
+  0xb123, 0x90fd,
+  0xb124, 0x9141,
+  0xb125, 0x9142,
+  0xb126, 0x9143,
+  0xb127, 0x9144,
+  0xb128, 0x9145,
+  0xb129, 0x9146,
+  0xb12a, 0x9147,
+  0xb12b, 0x9148,
+  0xb12c, 0x9149,
+  0xb12d, 0x914a,
+  0xb12e, 0x914b,
+  0xb12f, 0x914c,
+  0xb130, 0x914d,
+  0xb131, 0x914e,
+  0xb132, 0x914f,
+  0xb133, 0x9150,
+  0xb134, 0x9151,
+  0xb135, 0x9153,
+  0xb136, 0x9154,
+  0xb137, 0x9155,
+  0xb138, 0x9156,
+  0xb139, 0x9157,
+  0xb13a, 0x9158,
+  0xb13b, 0x9159,
+  0xb13c, 0x915a,
+  0xb13d, 0x915b,
+  0xb13e, 0x915c,
+  0xb13f, 0x915d,
+  0xb140, 0x9161,
+  0xb141, 0x9162,
+  0xb142, 0x9163,
+  0xb143, 0x9164,
+  0xb144, 0x9165,
+  0xb145, 0x9166,
+  0xb146, 0x9167,
+  0xb147, 0x9168,
+  0xb148, 0x9169,
+  0xb149, 0x916a,
+  0xb14a, 0x916b,
+  0xb14b, 0x916c,
+  0xb14c, 0x916d,
+  0xb14d, 0x916e,
+  0xb14e, 0x916f,
+  0xb14f, 0x9170,
+  0xb150, 0x9171,
+  0xb151, 0x9173,
+  0xb152, 0x9174,
+  0xb153, 0x9175,
+  0xb154, 0x9176,
+  0xb155, 0x9177,
+  0xb156, 0x9178,
+  0xb157, 0x9179,
+  0xb158, 0x917a,
+  0xb159, 0x917b,
+  0xb15a, 0x917c,
+  0xb15b, 0x917d,
+  0xb15c, 0x9181,
+  0xb15d, 0x9182,
+  0xb15e, 0x9183,
+  0xb15f, 0x9184,
+  0xb160, 0x9185,
+  0xb161, 0x9186,
+  0xb162, 0x9187,
+  0xb163, 0x9188,
+  0xb164, 0x9189,
+  0xb165, 0x918a,
+  0xb166, 0x918b,
+  0xb167, 0x918c,
+  0xb168, 0x918d,
+  0xb169, 0x918e,
+  0xb16a, 0x918f,
+  0xb16b, 0x9190,
+  0xb16c, 0x9191,
+  0xb16d, 0x9193,
+  0xb16e, 0x9194,
+  0xb16f, 0x9195,
+  0xb170, 0x9196,
+  0xb171, 0x9197,
+  0xb172, 0x9198,
+  0xb173, 0x9199,
+  0xb174, 0x919a,
+  0xb175, 0x919b,
+  0xb176, 0x919c,
+  0xb177, 0x919d,
+  0xb178, 0x91a1,
+  0xb179, 0x91a2,
+  0xb17a, 0x91a3,
+  0xb17b, 0x91a4,
+  0xb17c, 0x91a5,
+  0xb17d, 0x91a6,
+  0xb17e, 0x91a7,
+  0xb17f, 0x91a8,
+  0xb180, 0x91a9,
+  0xb181, 0x91aa,
+  0xb182, 0x91ab,
+  0xb183, 0x91ac,
+  0xb184, 0x91ad,
+  0xb185, 0x91ae,
+  0xb186, 0x91af,
+  0xb187, 0x91b0,
+  0xb188, 0x91b1,
+  0xb189, 0x91b3,
+  0xb18a, 0x91b4,
+  0xb18b, 0x91b5,
+  0xb18c, 0x91b6,
+  0xb18d, 0x91b7,
+  0xb18e, 0x91b8,
+  0xb18f, 0x91b9,
+  0xb190, 0x91ba,
+  0xb191, 0x91bb,
+  0xb192, 0x91bc,
+  0xb193, 0x91bd,
+  0xb194, 0x91c1,
+  0xb195, 0x91c2,
+  0xb196, 0x91c3,
+  0xb197, 0x91c4,
+  0xb198, 0x91c5,
+  0xb199, 0x91c6,
+  0xb19a, 0x91c7,
+  0xb19b, 0x91c8,
+  0xb19c, 0x91c9,
+  0xb19d, 0x91ca,
+  0xb19e, 0x91cb,
+  0xb19f, 0x91cc,
+  0xb1a0, 0x91cd,
+  0xb1a1, 0x91ce,
+  0xb1a2, 0x91cf,
+  0xb1a3, 0x91d0,
+  0xb1a4, 0x91d1,
+  0xb1a5, 0x91d3,
+  0xb1a6, 0x91d4,
+  0xb1a7, 0x91d5,
+  0xb1a8, 0x91d6,
+  0xb1a9, 0x91d7,
+  0xb1aa, 0x91d8,
+  0xb1ab, 0x91d9,
+  0xb1ac, 0x91da,
+  0xb1ad, 0x91db,
+  0xb1ae, 0x91dc,
+  0xb1af, 0x91dd,
+  0xb1b0, 0x91e1,
+  0xb1b1, 0x91e2,
+  0xb1b2, 0x91e3,
+  0xb1b3, 0x91e4,
+  0xb1b4, 0x91e5,
+  0xb1b5, 0x91e6,
+  0xb1b6, 0x91e7,
+  0xb1b7, 0x91e8,
+  0xb1b8, 0x91e9,
+  0xb1b9, 0x91ea,
+  0xb1ba, 0x91eb,
+  0xb1bb, 0x91ec,
+  0xb1bc, 0x91ed,
+  0xb1bd, 0x91ee,
+  0xb1be, 0x91ef,
+  0xb1bf, 0x91f0,
+  0xb1c0, 0x91f1,
+  0xb1c1, 0x91f3,
+  0xb1c2, 0x91f4,
+  0xb1c3, 0x91f5,
+  0xb1c4, 0x91f6,
+  0xb1c5, 0x91f7,
+  0xb1c6, 0x91f8,
+  0xb1c7, 0x91f9,
+  0xb1c8, 0x91fa,
+  0xb1c9, 0x91fb,
+  0xb1ca, 0x91fc,
+  0xb1cb, 0x91fd,
+  0xb1cc, 0x9241,
+  0xb1cd, 0x9242,
+  0xb1ce, 0x9243,
+  0xb1cf, 0x9244,
+  0xb1d0, 0x9245,
+  0xb1d1, 0x9246,
+  0xb1d2, 0x9247,
+  0xb1d3, 0x9248,
+  0xb1d4, 0x9249,
+  0xb1d5, 0x924a,
+  0xb1d6, 0x924b,
+  0xb1d7, 0x924c,
+  0xb1d8, 0x924d,
+  0xb1d9, 0x924e,
+  0xb1da, 0x924f,
+  0xb1db, 0x9250,
+  0xb1dc, 0x9251,
+  0xb1dd, 0x9253,
+  0xb1de, 0x9254,
+  0xb1df, 0x9255,
+  0xb1e0, 0x9256,
+  0xb1e1, 0x9257,
+  0xb1e2, 0x9258,
+  0xb1e3, 0x9259,
+  0xb1e4, 0x925a,
+  0xb1e5, 0x925b,
+  0xb1e6, 0x925c,
+  0xb1e7, 0x925d,
+  0xb1e8, 0x9261,
+  0xb1e9, 0x9262,
+  0xb1ea, 0x9263,
+  0xb1eb, 0x9264,
+  0xb1ec, 0x9265,
+  0xb1ed, 0x9266,
+  0xb1ee, 0x9267,
+  0xb1ef, 0x9268,
+  0xb1f0, 0x9269,
+  0xb1f1, 0x926a,
+  0xb1f2, 0x926b,
+  0xb1f3, 0x926c,
+  0xb1f4, 0x926d,
+  0xb1f5, 0x926e,
+  0xb1f6, 0x926f,
+  0xb1f7, 0x9270,
+  0xb1f8, 0x9271,
+  0xb1f9, 0x9273,
+  0xb1fa, 0x9274,
+  0xb1fb, 0x9275,
+  0xb1fc, 0x9276,
+  0xb1fd, 0x9277,
+  0xb1fe, 0x9278,
+  0xb1ff, 0x9279,
+  0xb200, 0x927a,
+  0xb201, 0x927b,
+  0xb202, 0x927c,
+  0xb203, 0x927d,
+  0xb204, 0x9281,
+  0xb205, 0x9282,
+  0xb206, 0x9283,
+  0xb207, 0x9284,
+  0xb208, 0x9285,
+  0xb209, 0x9286,
+  0xb20a, 0x9287,
+  0xb20b, 0x9288,
+  0xb20c, 0x9289,
+  0xb20d, 0x928a,
+  0xb20e, 0x928b,
+  0xb20f, 0x928c,
+  0xb210, 0x928d,
+  0xb211, 0x928e,
+  0xb212, 0x928f,
+  0xb213, 0x9290,
+  0xb214, 0x9291,
+  0xb215, 0x9293,
+  0xb216, 0x9294,
+  0xb217, 0x9295,
+  0xb218, 0x9296,
+  0xb219, 0x9297,
+  0xb21a, 0x9298,
+  0xb21b, 0x9299,
+  0xb21c, 0x929a,
+  0xb21d, 0x929b,
+  0xb21e, 0x929c,
+  0xb21f, 0x929d,
+  0xb220, 0x92a1,
+  0xb221, 0x92a2,
+  0xb222, 0x92a3,
+  0xb223, 0x92a4,
+  0xb224, 0x92a5,
+  0xb225, 0x92a6,
+  0xb226, 0x92a7,
+  0xb227, 0x92a8,
+  0xb228, 0x92a9,
+  0xb229, 0x92aa,
+  0xb22a, 0x92ab,
+  0xb22b, 0x92ac,
+  0xb22c, 0x92ad,
+  0xb22d, 0x92ae,
+  0xb22e, 0x92af,
+  0xb22f, 0x92b0,
+  0xb230, 0x92b1,
+  0xb231, 0x92b3,
+  0xb232, 0x92b4,
+  0xb233, 0x92b5,
+  0xb234, 0x92b6,
+  0xb235, 0x92b7,
+  0xb236, 0x92b8,
+  0xb237, 0x92b9,
+  0xb238, 0x92ba,
+  0xb239, 0x92bb,
+  0xb23a, 0x92bc,
+  0xb23b, 0x92bd,
+  0xb23c, 0x92c1,
+  0xb23d, 0x92c2,
+  0xb23e, 0x92c3,
+  0xb23f, 0x92c4,
+  0xb240, 0x92c5,
+  0xb241, 0x92c6,
+  0xb242, 0x92c7,
+  0xb243, 0x92c8,
+  0xb244, 0x92c9,
+  0xb245, 0x92ca,
+  0xb246, 0x92cb,
+  0xb247, 0x92cc,
+  0xb248, 0x92cd,
+  0xb249, 0x92ce,
+  0xb24a, 0x92cf,
+  0xb24b, 0x92d0,
+  0xb24c, 0x92d1,
+  0xb24d, 0x92d3,
+  0xb24e, 0x92d4,
+  0xb24f, 0x92d5,
+  0xb250, 0x92d6,
+  0xb251, 0x92d7,
+  0xb252, 0x92d8,
+  0xb253, 0x92d9,
+  0xb254, 0x92da,
+  0xb255, 0x92db,
+  0xb256, 0x92dc,
+  0xb257, 0x92dd,
+  0xb258, 0x92e1,
+  0xb259, 0x92e2,
+  0xb25a, 0x92e3,
+  0xb25b, 0x92e4,
+  0xb25c, 0x92e5,
+  0xb25d, 0x92e6,
+  0xb25e, 0x92e7,
+  0xb25f, 0x92e8,
+  0xb260, 0x92e9,
+  0xb261, 0x92ea,
+  0xb262, 0x92eb,
+  0xb263, 0x92ec,
+  0xb264, 0x92ed,
+  0xb265, 0x92ee,
+  0xb266, 0x92ef,
+  0xb267, 0x92f0,
+  0xb268, 0x92f1,
+  0xb269, 0x92f3,
+  0xb26a, 0x92f4,
+  0xb26b, 0x92f5,
+  0xb26c, 0x92f6,
+  0xb26d, 0x92f7,
+  0xb26e, 0x92f8,
+  0xb26f, 0x92f9,
+  0xb270, 0x92fa,
+  0xb271, 0x92fb,
+  0xb272, 0x92fc,
+  0xb273, 0x92fd,
+  0xb274, 0x9341,
+  0xb275, 0x9342,
+  0xb276, 0x9343,
+  0xb277, 0x9344,
+  0xb278, 0x9345,
+  0xb279, 0x9346,
+  0xb27a, 0x9347,
+  0xb27b, 0x9348,
+  0xb27c, 0x9349,
+  0xb27d, 0x934a,
+  0xb27e, 0x934b,
+  0xb27f, 0x934c,
+  0xb280, 0x934d,
+  0xb281, 0x934e,
+  0xb282, 0x934f,
+  0xb283, 0x9350,
+  0xb284, 0x9351,
+  0xb285, 0x9353,
+  0xb286, 0x9354,
+  0xb287, 0x9355,
+  0xb288, 0x9356,
+  0xb289, 0x9357,
+  0xb28a, 0x9358,
+  0xb28b, 0x9359,
+  0xb28c, 0x935a,
+  0xb28d, 0x935b,
+  0xb28e, 0x935c,
+  0xb28f, 0x935d,
+  0xb290, 0x9361,
+  0xb291, 0x9362,
+  0xb292, 0x9363,
+  0xb293, 0x9364,
+  0xb294, 0x9365,
+  0xb295, 0x9366,
+  0xb296, 0x9367,
+  0xb297, 0x9368,
+  0xb298, 0x9369,
+  0xb299, 0x936a,
+  0xb29a, 0x936b,
+  0xb29b, 0x936c,
+  0xb29c, 0x936d,
+  0xb29d, 0x936e,
+  0xb29e, 0x936f,
+  0xb29f, 0x9370,
+  0xb2a0, 0x9371,
+  0xb2a1, 0x9373,
+  0xb2a2, 0x9374,
+  0xb2a3, 0x9375,
+  0xb2a4, 0x9376,
+  0xb2a5, 0x9377,
+  0xb2a6, 0x9378,
+  0xb2a7, 0x9379,
+  0xb2a8, 0x937a,
+  0xb2a9, 0x937b,
+  0xb2aa, 0x937c,
+  0xb2ab, 0x937d,
+  0xb2ac, 0x9381,
+  0xb2ad, 0x9382,
+  0xb2ae, 0x9383,
+  0xb2af, 0x9384,
+  0xb2b0, 0x9385,
+  0xb2b1, 0x9386,
+  0xb2b2, 0x9387,
+  0xb2b3, 0x9388,
+  0xb2b4, 0x9389,
+  0xb2b5, 0x938a,
+  0xb2b6, 0x938b,
+  0xb2b7, 0x938c,
+  0xb2b8, 0x938d,
+  0xb2b9, 0x938e,
+  0xb2ba, 0x938f,
+  0xb2bb, 0x9390,
+  0xb2bc, 0x9391,
+  0xb2bd, 0x9393,
+  0xb2be, 0x9394,
+  0xb2bf, 0x9395,
+  0xb2c0, 0x9396,
+  0xb2c1, 0x9397,
+  0xb2c2, 0x9398,
+  0xb2c3, 0x9399,
+  0xb2c4, 0x939a,
+  0xb2c5, 0x939b,
+  0xb2c6, 0x939c,
+  0xb2c7, 0x939d,
+  0xb2c8, 0x93a1,
+  0xb2c9, 0x93a2,
+  0xb2ca, 0x93a3,
+  0xb2cb, 0x93a4,
+  0xb2cc, 0x93a5,
+  0xb2cd, 0x93a6,
+  0xb2ce, 0x93a7,
+  0xb2cf, 0x93a8,
+  0xb2d0, 0x93a9,
+  0xb2d1, 0x93aa,
+  0xb2d2, 0x93ab,
+  0xb2d3, 0x93ac,
+  0xb2d4, 0x93ad,
+  0xb2d5, 0x93ae,
+  0xb2d6, 0x93af,
+  0xb2d7, 0x93b0,
+  0xb2d8, 0x93b1,
+  0xb2d9, 0x93b3,
+  0xb2da, 0x93b4,
+  0xb2db, 0x93b5,
+  0xb2dc, 0x93b6,
+  0xb2dd, 0x93b7,
+  0xb2de, 0x93b8,
+  0xb2df, 0x93b9,
+  0xb2e0, 0x93ba,
+  0xb2e1, 0x93bb,
+  0xb2e2, 0x93bc,
+  0xb2e3, 0x93bd,
+  0xb2e4, 0x9461,
+  0xb2e5, 0x9462,
+  0xb2e6, 0x9463,
+  0xb2e7, 0x9464,
+  0xb2e8, 0x9465,
+  0xb2e9, 0x9466,
+  0xb2ea, 0x9467,
+  0xb2eb, 0x9468,
+  0xb2ec, 0x9469,
+  0xb2ed, 0x946a,
+  0xb2ee, 0x946b,
+  0xb2ef, 0x946c,
+  0xb2f0, 0x946d,
+  0xb2f1, 0x946e,
+  0xb2f2, 0x946f,
+  0xb2f3, 0x9470,
+  0xb2f4, 0x9471,
+  0xb2f5, 0x9473,
+  0xb2f6, 0x9474,
+  0xb2f7, 0x9475,
+  0xb2f8, 0x9476,
+  0xb2f9, 0x9477,
+  0xb2fa, 0x9478,
+  0xb2fb, 0x9479,
+  0xb2fc, 0x947a,
+  0xb2fd, 0x947b,
+  0xb2fe, 0x947c,
+  0xb2ff, 0x947d,
+  0xb300, 0x9481,
+  0xb301, 0x9482,
+  0xb302, 0x9483,
+  0xb303, 0x9484,
+  0xb304, 0x9485,
+  0xb305, 0x9486,
+  0xb306, 0x9487,
+  0xb307, 0x9488,
+  0xb308, 0x9489,
+  0xb309, 0x948a,
+  0xb30a, 0x948b,
+  0xb30b, 0x948c,
+  0xb30c, 0x948d,
+  0xb30d, 0x948e,
+  0xb30e, 0x948f,
+  0xb30f, 0x9490,
+  0xb310, 0x9491,
+  0xb311, 0x9493,
+  0xb312, 0x9494,
+  0xb313, 0x9495,
+  0xb314, 0x9496,
+  0xb315, 0x9497,
+  0xb316, 0x9498,
+  0xb317, 0x9499,
+  0xb318, 0x949a,
+  0xb319, 0x949b,
+  0xb31a, 0x949c,
+  0xb31b, 0x949d,
+  0xb31c, 0x94a1,
+  0xb31d, 0x94a2,
+  0xb31e, 0x94a3,
+  0xb31f, 0x94a4,
+  0xb320, 0x94a5,
+  0xb321, 0x94a6,
+  0xb322, 0x94a7,
+  0xb323, 0x94a8,
+  0xb324, 0x94a9,
+  0xb325, 0x94aa,
+  0xb326, 0x94ab,
+  0xb327, 0x94ac,
+  0xb328, 0x94ad,
+  0xb329, 0x94ae,
+  0xb32a, 0x94af,
+  0xb32b, 0x94b0,
+  0xb32c, 0x94b1,
+  0xb32d, 0x94b3,
+  0xb32e, 0x94b4,
+  0xb32f, 0x94b5,
+  0xb330, 0x94b6,
+  0xb331, 0x94b7,
+  0xb332, 0x94b8,
+  0xb333, 0x94b9,
+  0xb334, 0x94ba,
+  0xb335, 0x94bb,
+  0xb336, 0x94bc,
+  0xb337, 0x94bd,
+  0xb338, 0x94c1,
+  0xb339, 0x94c2,
+  0xb33a, 0x94c3,
+  0xb33b, 0x94c4,
+  0xb33c, 0x94c5,
+  0xb33d, 0x94c6,
+  0xb33e, 0x94c7,
+  0xb33f, 0x94c8,
+  0xb340, 0x94c9,
+  0xb341, 0x94ca,
+  0xb342, 0x94cb,
+  0xb343, 0x94cc,
+  0xb344, 0x94cd,
+  0xb345, 0x94ce,
+  0xb346, 0x94cf,
+  0xb347, 0x94d0,
+  0xb348, 0x94d1,
+  0xb349, 0x94d3,
+  0xb34a, 0x94d4,
+  0xb34b, 0x94d5,
+  0xb34c, 0x94d6,
+  0xb34d, 0x94d7,
+  0xb34e, 0x94d8,
+  0xb34f, 0x94d9,
+  0xb350, 0x94da,
+  0xb351, 0x94db,
+  0xb352, 0x94dc,
+  0xb353, 0x94dd,
+  0xb354, 0x94e1,
+  0xb355, 0x94e2,
+  0xb356, 0x94e3,
+  0xb357, 0x94e4,
+  0xb358, 0x94e5,
+  0xb359, 0x94e6,
+  0xb35a, 0x94e7,
+  0xb35b, 0x94e8,
+  0xb35c, 0x94e9,
+  0xb35d, 0x94ea,
+  0xb35e, 0x94eb,
+  0xb35f, 0x94ec,
+  0xb360, 0x94ed,
+  0xb361, 0x94ee,
+  0xb362, 0x94ef,
+  0xb363, 0x94f0,
+  0xb364, 0x94f1,
+  0xb365, 0x94f3,
+  0xb366, 0x94f4,
+  0xb367, 0x94f5,
+  0xb368, 0x94f6,
+  0xb369, 0x94f7,
+  0xb36a, 0x94f8,
+  0xb36b, 0x94f9,
+  0xb36c, 0x94fa,
+  0xb36d, 0x94fb,
+  0xb36e, 0x94fc,
+  0xb36f, 0x94fd,
+  0xb370, 0x9541,
+  0xb371, 0x9542,
+  0xb372, 0x9543,
+  0xb373, 0x9544,
+  0xb374, 0x9545,
+  0xb375, 0x9546,
+  0xb376, 0x9547,
+  0xb377, 0x9548,
+  0xb378, 0x9549,
+  0xb379, 0x954a,
+  0xb37a, 0x954b,
+  0xb37b, 0x954c,
+  0xb37c, 0x954d,
+  0xb37d, 0x954e,
+  0xb37e, 0x954f,
+  0xb37f, 0x9550,
+  0xb380, 0x9551,
+  0xb381, 0x9553,
+  0xb382, 0x9554,
+  0xb383, 0x9555,
+  0xb384, 0x9556,
+  0xb385, 0x9557,
+  0xb386, 0x9558,
+  0xb387, 0x9559,
+  0xb388, 0x955a,
+  0xb389, 0x955b,
+  0xb38a, 0x955c,
+  0xb38b, 0x955d,
+  0xb38c, 0x9561,
+  0xb38d, 0x9562,
+  0xb38e, 0x9563,
+  0xb38f, 0x9564,
+  0xb390, 0x9565,
+  0xb391, 0x9566,
+  0xb392, 0x9567,
+  0xb393, 0x9568,
+  0xb394, 0x9569,
+  0xb395, 0x956a,
+  0xb396, 0x956b,
+  0xb397, 0x956c,
+  0xb398, 0x956d,
+  0xb399, 0x956e,
+  0xb39a, 0x956f,
+  0xb39b, 0x9570,
+  0xb39c, 0x9571,
+  0xb39d, 0x9573,
+  0xb39e, 0x9574,
+  0xb39f, 0x9575,
+  0xb3a0, 0x9576,
+  0xb3a1, 0x9577,
+  0xb3a2, 0x9578,
+  0xb3a3, 0x9579,
+  0xb3a4, 0x957a,
+  0xb3a5, 0x957b,
+  0xb3a6, 0x957c,
+  0xb3a7, 0x957d,
+  0xb3a8, 0x9581,
+  0xb3a9, 0x9582,
+  0xb3aa, 0x9583,
+  0xb3ab, 0x9584,
+  0xb3ac, 0x9585,
+  0xb3ad, 0x9586,
+  0xb3ae, 0x9587,
+  0xb3af, 0x9588,
+  0xb3b0, 0x9589,
+  0xb3b1, 0x958a,
+  0xb3b2, 0x958b,
+  0xb3b3, 0x958c,
+  0xb3b4, 0x958d,
+  0xb3b5, 0x958e,
+  0xb3b6, 0x958f,
+  0xb3b7, 0x9590,
+  0xb3b8, 0x9591,
+  0xb3b9, 0x9593,
+  0xb3ba, 0x9594,
+  0xb3bb, 0x9595,
+  0xb3bc, 0x9596,
+  0xb3bd, 0x9597,
+  0xb3be, 0x9598,
+  0xb3bf, 0x9599,
+  0xb3c0, 0x959a,
+  0xb3c1, 0x959b,
+  0xb3c2, 0x959c,
+  0xb3c3, 0x959d,
+  0xb3c4, 0x95a1,
+  0xb3c5, 0x95a2,
+  0xb3c6, 0x95a3,
+  0xb3c7, 0x95a4,
+  0xb3c8, 0x95a5,
+  0xb3c9, 0x95a6,
+  0xb3ca, 0x95a7,
+  0xb3cb, 0x95a8,
+  0xb3cc, 0x95a9,
+  0xb3cd, 0x95aa,
+  0xb3ce, 0x95ab,
+  0xb3cf, 0x95ac,
+  0xb3d0, 0x95ad,
+  0xb3d1, 0x95ae,
+  0xb3d2, 0x95af,
+  0xb3d3, 0x95b0,
+  0xb3d4, 0x95b1,
+  0xb3d5, 0x95b3,
+  0xb3d6, 0x95b4,
+  0xb3d7, 0x95b5,
+  0xb3d8, 0x95b6,
+  0xb3d9, 0x95b7,
+  0xb3da, 0x95b8,
+  0xb3db, 0x95b9,
+  0xb3dc, 0x95ba,
+  0xb3dd, 0x95bb,
+  0xb3de, 0x95bc,
+  0xb3df, 0x95bd,
+  0xb3e0, 0x95c1,
+  0xb3e1, 0x95c2,
+  0xb3e2, 0x95c3,
+  0xb3e3, 0x95c4,
+  0xb3e4, 0x95c5,
+  0xb3e5, 0x95c6,
+  0xb3e6, 0x95c7,
+  0xb3e7, 0x95c8,
+  0xb3e8, 0x95c9,
+  0xb3e9, 0x95ca,
+  0xb3ea, 0x95cb,
+  0xb3eb, 0x95cc,
+  0xb3ec, 0x95cd,
+  0xb3ed, 0x95ce,
+  0xb3ee, 0x95cf,
+  0xb3ef, 0x95d0,
+  0xb3f0, 0x95d1,
+  0xb3f1, 0x95d3,
+  0xb3f2, 0x95d4,
+  0xb3f3, 0x95d5,
+  0xb3f4, 0x95d6,
+  0xb3f5, 0x95d7,
+  0xb3f6, 0x95d8,
+  0xb3f7, 0x95d9,
+  0xb3f8, 0x95da,
+  0xb3f9, 0x95db,
+  0xb3fa, 0x95dc,
+  0xb3fb, 0x95dd,
+  0xb3fc, 0x95e1,
+  0xb3fd, 0x95e2,
+  0xb3fe, 0x95e3,
+  0xb3ff, 0x95e4,
+  0xb400, 0x95e5,
+  0xb401, 0x95e6,
+  0xb402, 0x95e7,
+  0xb403, 0x95e8,
+  0xb404, 0x95e9,
+  0xb405, 0x95ea,
+  0xb406, 0x95eb,
+  0xb407, 0x95ec,
+  0xb408, 0x95ed,
+  0xb409, 0x95ee,
+  0xb40a, 0x95ef,
+  0xb40b, 0x95f0,
+  0xb40c, 0x95f1,
+  0xb40d, 0x95f3,
+  0xb40e, 0x95f4,
+  0xb40f, 0x95f5,
+  0xb410, 0x95f6,
+  0xb411, 0x95f7,
+  0xb412, 0x95f8,
+  0xb413, 0x95f9,
+  0xb414, 0x95fa,
+  0xb415, 0x95fb,
+  0xb416, 0x95fc,
+  0xb417, 0x95fd,
+  0xb418, 0x9641,
+  0xb419, 0x9642,
+  0xb41a, 0x9643,
+  0xb41b, 0x9644,
+  0xb41c, 0x9645,
+  0xb41d, 0x9646,
+  0xb41e, 0x9647,
+  0xb41f, 0x9648,
+  0xb420, 0x9649,
+  0xb421, 0x964a,
+  0xb422, 0x964b,
+  0xb423, 0x964c,
+  0xb424, 0x964d,
+  0xb425, 0x964e,
+  0xb426, 0x964f,
+  0xb427, 0x9650,
+  0xb428, 0x9651,
+  0xb429, 0x9653,
+  0xb42a, 0x9654,
+  0xb42b, 0x9655,
+  0xb42c, 0x9656,
+  0xb42d, 0x9657,
+  0xb42e, 0x9658,
+  0xb42f, 0x9659,
+  0xb430, 0x965a,
+  0xb431, 0x965b,
+  0xb432, 0x965c,
+  0xb433, 0x965d,
+  0xb434, 0x9661,
+  0xb435, 0x9662,
+  0xb436, 0x9663,
+  0xb437, 0x9664,
+  0xb438, 0x9665,
+  0xb439, 0x9666,
+  0xb43a, 0x9667,
+  0xb43b, 0x9668,
+  0xb43c, 0x9669,
+  0xb43d, 0x966a,
+  0xb43e, 0x966b,
+  0xb43f, 0x966c,
+  0xb440, 0x966d,
+  0xb441, 0x966e,
+  0xb442, 0x966f,
+  0xb443, 0x9670,
+  0xb444, 0x9671,
+  0xb445, 0x9673,
+  0xb446, 0x9674,
+  0xb447, 0x9675,
+  0xb448, 0x9676,
+  0xb449, 0x9677,
+  0xb44a, 0x9678,
+  0xb44b, 0x9679,
+  0xb44c, 0x967a,
+  0xb44d, 0x967b,
+  0xb44e, 0x967c,
+  0xb44f, 0x967d,
+  0xb450, 0x9681,
+  0xb451, 0x9682,
+  0xb452, 0x9683,
+  0xb453, 0x9684,
+  0xb454, 0x9685,
+  0xb455, 0x9686,
+  0xb456, 0x9687,
+  0xb457, 0x9688,
+  0xb458, 0x9689,
+  0xb459, 0x968a,
+  0xb45a, 0x968b,
+  0xb45b, 0x968c,
+  0xb45c, 0x968d,
+  0xb45d, 0x968e,
+  0xb45e, 0x968f,
+  0xb45f, 0x9690,
+  0xb460, 0x9691,
+  0xb461, 0x9693,
+  0xb462, 0x9694,
+  0xb463, 0x9695,
+  0xb464, 0x9696,
+  0xb465, 0x9697,
+  0xb466, 0x9698,
+  0xb467, 0x9699,
+  0xb468, 0x969a,
+  0xb469, 0x969b,
+  0xb46a, 0x969c,
+  0xb46b, 0x969d,
+  0xb46c, 0x96a1,
+  0xb46d, 0x96a2,
+  0xb46e, 0x96a3,
+  0xb46f, 0x96a4,
+  0xb470, 0x96a5,
+  0xb471, 0x96a6,
+  0xb472, 0x96a7,
+  0xb473, 0x96a8,
+  0xb474, 0x96a9,
+  0xb475, 0x96aa,
+  0xb476, 0x96ab,
+  0xb477, 0x96ac,
+  0xb478, 0x96ad,
+  0xb479, 0x96ae,
+  0xb47a, 0x96af,
+  0xb47b, 0x96b0,
+  0xb47c, 0x96b1,
+  0xb47d, 0x96b3,
+  0xb47e, 0x96b4,
+  0xb47f, 0x96b5,
+  0xb480, 0x96b6,
+  0xb481, 0x96b7,
+  0xb482, 0x96b8,
+  0xb483, 0x96b9,
+  0xb484, 0x96ba,
+  0xb485, 0x96bb,
+  0xb486, 0x96bc,
+  0xb487, 0x96bd,
+  0xb488, 0x96c1,
+  0xb489, 0x96c2,
+  0xb48a, 0x96c3,
+  0xb48b, 0x96c4,
+  0xb48c, 0x96c5,
+  0xb48d, 0x96c6,
+  0xb48e, 0x96c7,
+  0xb48f, 0x96c8,
+  0xb490, 0x96c9,
+  0xb491, 0x96ca,
+  0xb492, 0x96cb,
+  0xb493, 0x96cc,
+  0xb494, 0x96cd,
+  0xb495, 0x96ce,
+  0xb496, 0x96cf,
+  0xb497, 0x96d0,
+  0xb498, 0x96d1,
+  0xb499, 0x96d3,
+  0xb49a, 0x96d4,
+  0xb49b, 0x96d5,
+  0xb49c, 0x96d6,
+  0xb49d, 0x96d7,
+  0xb49e, 0x96d8,
+  0xb49f, 0x96d9,
+  0xb4a0, 0x96da,
+  0xb4a1, 0x96db,
+  0xb4a2, 0x96dc,
+  0xb4a3, 0x96dd,
+  0xb4a4, 0x96e1,
+  0xb4a5, 0x96e2,
+  0xb4a6, 0x96e3,
+  0xb4a7, 0x96e4,
+  0xb4a8, 0x96e5,
+  0xb4a9, 0x96e6,
+  0xb4aa, 0x96e7,
+  0xb4ab, 0x96e8,
+  0xb4ac, 0x96e9,
+  0xb4ad, 0x96ea,
+  0xb4ae, 0x96eb,
+  0xb4af, 0x96ec,
+  0xb4b0, 0x96ed,
+  0xb4b1, 0x96ee,
+  0xb4b2, 0x96ef,
+  0xb4b3, 0x96f0,
+  0xb4b4, 0x96f1,
+  0xb4b5, 0x96f3,
+  0xb4b6, 0x96f4,
+  0xb4b7, 0x96f5,
+  0xb4b8, 0x96f6,
+  0xb4b9, 0x96f7,
+  0xb4ba, 0x96f8,
+  0xb4bb, 0x96f9,
+  0xb4bc, 0x96fa,
+  0xb4bd, 0x96fb,
+  0xb4be, 0x96fc,
+  0xb4bf, 0x96fd,
+  0xb4c0, 0x9741,
+  0xb4c1, 0x9742,
+  0xb4c2, 0x9743,
+  0xb4c3, 0x9744,
+  0xb4c4, 0x9745,
+  0xb4c5, 0x9746,
+  0xb4c6, 0x9747,
+  0xb4c7, 0x9748,
+  0xb4c8, 0x9749,
+  0xb4c9, 0x974a,
+  0xb4ca, 0x974b,
+  0xb4cb, 0x974c,
+  0xb4cc, 0x974d,
+  0xb4cd, 0x974e,
+  0xb4ce, 0x974f,
+  0xb4cf, 0x9750,
+  0xb4d0, 0x9751,
+  0xb4d1, 0x9753,
+  0xb4d2, 0x9754,
+  0xb4d3, 0x9755,
+  0xb4d4, 0x9756,
+  0xb4d5, 0x9757,
+  0xb4d6, 0x9758,
+  0xb4d7, 0x9759,
+  0xb4d8, 0x975a,
+  0xb4d9, 0x975b,
+  0xb4da, 0x975c,
+  0xb4db, 0x975d,
+  0xb4dc, 0x9761,
+  0xb4dd, 0x9762,
+  0xb4de, 0x9763,
+  0xb4df, 0x9764,
+  0xb4e0, 0x9765,
+  0xb4e1, 0x9766,
+  0xb4e2, 0x9767,
+  0xb4e3, 0x9768,
+  0xb4e4, 0x9769,
+  0xb4e5, 0x976a,
+  0xb4e6, 0x976b,
+  0xb4e7, 0x976c,
+  0xb4e8, 0x976d,
+  0xb4e9, 0x976e,
+  0xb4ea, 0x976f,
+  0xb4eb, 0x9770,
+  0xb4ec, 0x9771,
+  0xb4ed, 0x9773,
+  0xb4ee, 0x9774,
+  0xb4ef, 0x9775,
+  0xb4f0, 0x9776,
+  0xb4f1, 0x9777,
+  0xb4f2, 0x9778,
+  0xb4f3, 0x9779,
+  0xb4f4, 0x977a,
+  0xb4f5, 0x977b,
+  0xb4f6, 0x977c,
+  0xb4f7, 0x977d,
+  0xb4f8, 0x9781,
+  0xb4f9, 0x9782,
+  0xb4fa, 0x9783,
+  0xb4fb, 0x9784,
+  0xb4fc, 0x9785,
+  0xb4fd, 0x9786,
+  0xb4fe, 0x9787,
+  0xb4ff, 0x9788,
+  0xb500, 0x9789,
+  0xb501, 0x978a,
+  0xb502, 0x978b,
+  0xb503, 0x978c,
+  0xb504, 0x978d,
+  0xb505, 0x978e,
+  0xb506, 0x978f,
+  0xb507, 0x9790,
+  0xb508, 0x9791,
+  0xb509, 0x9793,
+  0xb50a, 0x9794,
+  0xb50b, 0x9795,
+  0xb50c, 0x9796,
+  0xb50d, 0x9797,
+  0xb50e, 0x9798,
+  0xb50f, 0x9799,
+  0xb510, 0x979a,
+  0xb511, 0x979b,
+  0xb512, 0x979c,
+  0xb513, 0x979d,
+  0xb514, 0x97a1,
+  0xb515, 0x97a2,
+  0xb516, 0x97a3,
+  0xb517, 0x97a4,
+  0xb518, 0x97a5,
+  0xb519, 0x97a6,
+  0xb51a, 0x97a7,
+  0xb51b, 0x97a8,
+  0xb51c, 0x97a9,
+  0xb51d, 0x97aa,
+  0xb51e, 0x97ab,
+  0xb51f, 0x97ac,
+  0xb520, 0x97ad,
+  0xb521, 0x97ae,
+  0xb522, 0x97af,
+  0xb523, 0x97b0,
+  0xb524, 0x97b1,
+  0xb525, 0x97b3,
+  0xb526, 0x97b4,
+  0xb527, 0x97b5,
+  0xb528, 0x97b6,
+  0xb529, 0x97b7,
+  0xb52a, 0x97b8,
+  0xb52b, 0x97b9,
+  0xb52c, 0x97ba,
+  0xb52d, 0x97bb,
+  0xb52e, 0x97bc,
+  0xb52f, 0x97bd,
+  0xb530, 0x9861,
+  0xb531, 0x9862,
+  0xb532, 0x9863,
+  0xb533, 0x9864,
+  0xb534, 0x9865,
+  0xb535, 0x9866,
+  0xb536, 0x9867,
+  0xb537, 0x9868,
+  0xb538, 0x9869,
+  0xb539, 0x986a,
+  0xb53a, 0x986b,
+  0xb53b, 0x986c,
+  0xb53c, 0x986d,
+  0xb53d, 0x986e,
+  0xb53e, 0x986f,
+  0xb53f, 0x9870,
+  0xb540, 0x9871,
+  0xb541, 0x9873,
+  0xb542, 0x9874,
+  0xb543, 0x9875,
+  0xb544, 0x9876,
+  0xb545, 0x9877,
+  0xb546, 0x9878,
+  0xb547, 0x9879,
+  0xb548, 0x987a,
+  0xb549, 0x987b,
+  0xb54a, 0x987c,
+  0xb54b, 0x987d,
+  0xb54c, 0x9881,
+  0xb54d, 0x9882,
+  0xb54e, 0x9883,
+  0xb54f, 0x9884,
+  0xb550, 0x9885,
+  0xb551, 0x9886,
+  0xb552, 0x9887,
+  0xb553, 0x9888,
+  0xb554, 0x9889,
+  0xb555, 0x988a,
+  0xb556, 0x988b,
+  0xb557, 0x988c,
+  0xb558, 0x988d,
+  0xb559, 0x988e,
+  0xb55a, 0x988f,
+  0xb55b, 0x9890,
+  0xb55c, 0x9891,
+  0xb55d, 0x9893,
+  0xb55e, 0x9894,
+  0xb55f, 0x9895,
+  0xb560, 0x9896,
+  0xb561, 0x9897,
+  0xb562, 0x9898,
+  0xb563, 0x9899,
+  0xb564, 0x989a,
+  0xb565, 0x989b,
+  0xb566, 0x989c,
+  0xb567, 0x989d,
+  0xb568, 0x98a1,
+  0xb569, 0x98a2,
+  0xb56a, 0x98a3,
+  0xb56b, 0x98a4,
+  0xb56c, 0x98a5,
+  0xb56d, 0x98a6,
+  0xb56e, 0x98a7,
+  0xb56f, 0x98a8,
+  0xb570, 0x98a9,
+  0xb571, 0x98aa,
+  0xb572, 0x98ab,
+  0xb573, 0x98ac,
+  0xb574, 0x98ad,
+  0xb575, 0x98ae,
+  0xb576, 0x98af,
+  0xb577, 0x98b0,
+  0xb578, 0x98b1,
+  0xb579, 0x98b3,
+  0xb57a, 0x98b4,
+  0xb57b, 0x98b5,
+  0xb57c, 0x98b6,
+  0xb57d, 0x98b7,
+  0xb57e, 0x98b8,
+  0xb57f, 0x98b9,
+  0xb580, 0x98ba,
+  0xb581, 0x98bb,
+  0xb582, 0x98bc,
+  0xb583, 0x98bd,
+  0xb584, 0x98c1,
+  0xb585, 0x98c2,
+  0xb586, 0x98c3,
+  0xb587, 0x98c4,
+  0xb588, 0x98c5,
+  0xb589, 0x98c6,
+  0xb58a, 0x98c7,
+  0xb58b, 0x98c8,
+  0xb58c, 0x98c9,
+  0xb58d, 0x98ca,
+  0xb58e, 0x98cb,
+  0xb58f, 0x98cc,
+  0xb590, 0x98cd,
+  0xb591, 0x98ce,
+  0xb592, 0x98cf,
+  0xb593, 0x98d0,
+  0xb594, 0x98d1,
+  0xb595, 0x98d3,
+  0xb596, 0x98d4,
+  0xb597, 0x98d5,
+  0xb598, 0x98d6,
+  0xb599, 0x98d7,
+  0xb59a, 0x98d8,
+  0xb59b, 0x98d9,
+  0xb59c, 0x98da,
+  0xb59d, 0x98db,
+  0xb59e, 0x98dc,
+  0xb59f, 0x98dd,
+  0xb5a0, 0x98e1,
+  0xb5a1, 0x98e2,
+  0xb5a2, 0x98e3,
+  0xb5a3, 0x98e4,
+  0xb5a4, 0x98e5,
+  0xb5a5, 0x98e6,
+  0xb5a6, 0x98e7,
+  0xb5a7, 0x98e8,
+  0xb5a8, 0x98e9,
+  0xb5a9, 0x98ea,
+  0xb5aa, 0x98eb,
+  0xb5ab, 0x98ec,
+  0xb5ac, 0x98ed,
+  0xb5ad, 0x98ee,
+  0xb5ae, 0x98ef,
+  0xb5af, 0x98f0,
+  0xb5b0, 0x98f1,
+  0xb5b1, 0x98f3,
+  0xb5b2, 0x98f4,
+  0xb5b3, 0x98f5,
+  0xb5b4, 0x98f6,
+  0xb5b5, 0x98f7,
+  0xb5b6, 0x98f8,
+  0xb5b7, 0x98f9,
+  0xb5b8, 0x98fa,
+  0xb5b9, 0x98fb,
+  0xb5ba, 0x98fc,
+  0xb5bb, 0x98fd,
+  0xb5bc, 0x9941,
+  0xb5bd, 0x9942,
+  0xb5be, 0x9943,
+  0xb5bf, 0x9944,
+  0xb5c0, 0x9945,
+  0xb5c1, 0x9946,
+  0xb5c2, 0x9947,
+  0xb5c3, 0x9948,
+  0xb5c4, 0x9949,
+  0xb5c5, 0x994a,
+  0xb5c6, 0x994b,
+  0xb5c7, 0x994c,
+  0xb5c8, 0x994d,
+  0xb5c9, 0x994e,
+  0xb5ca, 0x994f,
+  0xb5cb, 0x9950,
+  0xb5cc, 0x9951,
+  0xb5cd, 0x9953,
+  0xb5ce, 0x9954,
+  0xb5cf, 0x9955,
+  0xb5d0, 0x9956,
+  0xb5d1, 0x9957,
+  0xb5d2, 0x9958,
+  0xb5d3, 0x9959,
+  0xb5d4, 0x995a,
+  0xb5d5, 0x995b,
+  0xb5d6, 0x995c,
+  0xb5d7, 0x995d,
+  0xb5d8, 0x9961,
+  0xb5d9, 0x9962,
+  0xb5da, 0x9963,
+  0xb5db, 0x9964,
+  0xb5dc, 0x9965,
+  0xb5dd, 0x9966,
+  0xb5de, 0x9967,
+  0xb5df, 0x9968,
+  0xb5e0, 0x9969,
+  0xb5e1, 0x996a,
+  0xb5e2, 0x996b,
+  0xb5e3, 0x996c,
+  0xb5e4, 0x996d,
+  0xb5e5, 0x996e,
+  0xb5e6, 0x996f,
+  0xb5e7, 0x9970,
+  0xb5e8, 0x9971,
+  0xb5e9, 0x9973,
+  0xb5ea, 0x9974,
+  0xb5eb, 0x9975,
+  0xb5ec, 0x9976,
+  0xb5ed, 0x9977,
+  0xb5ee, 0x9978,
+  0xb5ef, 0x9979,
+  0xb5f0, 0x997a,
+  0xb5f1, 0x997b,
+  0xb5f2, 0x997c,
+  0xb5f3, 0x997d,
+  0xb5f4, 0x9981,
+  0xb5f5, 0x9982,
+  0xb5f6, 0x9983,
+  0xb5f7, 0x9984,
+  0xb5f8, 0x9985,
+  0xb5f9, 0x9986,
+  0xb5fa, 0x9987,
+  0xb5fb, 0x9988,
+  0xb5fc, 0x9989,
+  0xb5fd, 0x998a,
+  0xb5fe, 0x998b,
+  0xb5ff, 0x998c,
+  0xb600, 0x998d,
+  0xb601, 0x998e,
+  0xb602, 0x998f,
+  0xb603, 0x9990,
+  0xb604, 0x9991,
+  0xb605, 0x9993,
+  0xb606, 0x9994,
+  0xb607, 0x9995,
+  0xb608, 0x9996,
+  0xb609, 0x9997,
+  0xb60a, 0x9998,
+  0xb60b, 0x9999,
+  0xb60c, 0x999a,
+  0xb60d, 0x999b,
+  0xb60e, 0x999c,
+  0xb60f, 0x999d,
+  0xb610, 0x99a1,
+  0xb611, 0x99a2,
+  0xb612, 0x99a3,
+  0xb613, 0x99a4,
+  0xb614, 0x99a5,
+  0xb615, 0x99a6,
+  0xb616, 0x99a7,
+  0xb617, 0x99a8,
+  0xb618, 0x99a9,
+  0xb619, 0x99aa,
+  0xb61a, 0x99ab,
+  0xb61b, 0x99ac,
+  0xb61c, 0x99ad,
+  0xb61d, 0x99ae,
+  0xb61e, 0x99af,
+  0xb61f, 0x99b0,
+  0xb620, 0x99b1,
+  0xb621, 0x99b3,
+  0xb622, 0x99b4,
+  0xb623, 0x99b5,
+  0xb624, 0x99b6,
+  0xb625, 0x99b7,
+  0xb626, 0x99b8,
+  0xb627, 0x99b9,
+  0xb628, 0x99ba,
+  0xb629, 0x99bb,
+  0xb62a, 0x99bc,
+  0xb62b, 0x99bd,
+  0xb62c, 0x99c1,
+  0xb62d, 0x99c2,
+  0xb62e, 0x99c3,
+  0xb62f, 0x99c4,
+  0xb630, 0x99c5,
+  0xb631, 0x99c6,
+  0xb632, 0x99c7,
+  0xb633, 0x99c8,
+  0xb634, 0x99c9,
+  0xb635, 0x99ca,
+  0xb636, 0x99cb,
+  0xb637, 0x99cc,
+  0xb638, 0x99cd,
+  0xb639, 0x99ce,
+  0xb63a, 0x99cf,
+  0xb63b, 0x99d0,
+  0xb63c, 0x99d1,
+  0xb63d, 0x99d3,
+  0xb63e, 0x99d4,
+  0xb63f, 0x99d5,
+  0xb640, 0x99d6,
+  0xb641, 0x99d7,
+  0xb642, 0x99d8,
+  0xb643, 0x99d9,
+  0xb644, 0x99da,
+  0xb645, 0x99db,
+  0xb646, 0x99dc,
+  0xb647, 0x99dd,
+  0xb648, 0x99e1,
+  0xb649, 0x99e2,
+  0xb64a, 0x99e3,
+  0xb64b, 0x99e4,
+  0xb64c, 0x99e5,
+  0xb64d, 0x99e6,
+  0xb64e, 0x99e7,
+  0xb64f, 0x99e8,
+  0xb650, 0x99e9,
+  0xb651, 0x99ea,
+  0xb652, 0x99eb,
+  0xb653, 0x99ec,
+  0xb654, 0x99ed,
+  0xb655, 0x99ee,
+  0xb656, 0x99ef,
+  0xb657, 0x99f0,
+  0xb658, 0x99f1,
+  0xb659, 0x99f3,
+  0xb65a, 0x99f4,
+  0xb65b, 0x99f5,
+  0xb65c, 0x99f6,
+  0xb65d, 0x99f7,
+  0xb65e, 0x99f8,
+  0xb65f, 0x99f9,
+  0xb660, 0x99fa,
+  0xb661, 0x99fb,
+  0xb662, 0x99fc,
+  0xb663, 0x99fd,
+  0xb664, 0x9a41,
+  0xb665, 0x9a42,
+  0xb666, 0x9a43,
+  0xb667, 0x9a44,
+  0xb668, 0x9a45,
+  0xb669, 0x9a46,
+  0xb66a, 0x9a47,
+  0xb66b, 0x9a48,
+  0xb66c, 0x9a49,
+  0xb66d, 0x9a4a,
+  0xb66e, 0x9a4b,
+  0xb66f, 0x9a4c,
+  0xb670, 0x9a4d,
+  0xb671, 0x9a4e,
+  0xb672, 0x9a4f,
+  0xb673, 0x9a50,
+  0xb674, 0x9a51,
+  0xb675, 0x9a53,
+  0xb676, 0x9a54,
+  0xb677, 0x9a55,
+  0xb678, 0x9a56,
+  0xb679, 0x9a57,
+  0xb67a, 0x9a58,
+  0xb67b, 0x9a59,
+  0xb67c, 0x9a5a,
+  0xb67d, 0x9a5b,
+  0xb67e, 0x9a5c,
+  0xb67f, 0x9a5d,
+  0xb680, 0x9a61,
+  0xb681, 0x9a62,
+  0xb682, 0x9a63,
+  0xb683, 0x9a64,
+  0xb684, 0x9a65,
+  0xb685, 0x9a66,
+  0xb686, 0x9a67,
+  0xb687, 0x9a68,
+  0xb688, 0x9a69,
+  0xb689, 0x9a6a,
+  0xb68a, 0x9a6b,
+  0xb68b, 0x9a6c,
+  0xb68c, 0x9a6d,
+  0xb68d, 0x9a6e,
+  0xb68e, 0x9a6f,
+  0xb68f, 0x9a70,
+  0xb690, 0x9a71,
+  0xb691, 0x9a73,
+  0xb692, 0x9a74,
+  0xb693, 0x9a75,
+  0xb694, 0x9a76,
+  0xb695, 0x9a77,
+  0xb696, 0x9a78,
+  0xb697, 0x9a79,
+  0xb698, 0x9a7a,
+  0xb699, 0x9a7b,
+  0xb69a, 0x9a7c,
+  0xb69b, 0x9a7d,
+  0xb69c, 0x9a81,
+  0xb69d, 0x9a82,
+  0xb69e, 0x9a83,
+  0xb69f, 0x9a84,
+  0xb6a0, 0x9a85,
+  0xb6a1, 0x9a86,
+  0xb6a2, 0x9a87,
+  0xb6a3, 0x9a88,
+  0xb6a4, 0x9a89,
+  0xb6a5, 0x9a8a,
+  0xb6a6, 0x9a8b,
+  0xb6a7, 0x9a8c,
+  0xb6a8, 0x9a8d,
+  0xb6a9, 0x9a8e,
+  0xb6aa, 0x9a8f,
+  0xb6ab, 0x9a90,
+  0xb6ac, 0x9a91,
+  0xb6ad, 0x9a93,
+  0xb6ae, 0x9a94,
+  0xb6af, 0x9a95,
+  0xb6b0, 0x9a96,
+  0xb6b1, 0x9a97,
+  0xb6b2, 0x9a98,
+  0xb6b3, 0x9a99,
+  0xb6b4, 0x9a9a,
+  0xb6b5, 0x9a9b,
+  0xb6b6, 0x9a9c,
+  0xb6b7, 0x9a9d,
+  0xb6b8, 0x9aa1,
+  0xb6b9, 0x9aa2,
+  0xb6ba, 0x9aa3,
+  0xb6bb, 0x9aa4,
+  0xb6bc, 0x9aa5,
+  0xb6bd, 0x9aa6,
+  0xb6be, 0x9aa7,
+  0xb6bf, 0x9aa8,
+  0xb6c0, 0x9aa9,
+  0xb6c1, 0x9aaa,
+  0xb6c2, 0x9aab,
+  0xb6c3, 0x9aac,
+  0xb6c4, 0x9aad,
+  0xb6c5, 0x9aae,
+  0xb6c6, 0x9aaf,
+  0xb6c7, 0x9ab0,
+  0xb6c8, 0x9ab1,
+  0xb6c9, 0x9ab3,
+  0xb6ca, 0x9ab4,
+  0xb6cb, 0x9ab5,
+  0xb6cc, 0x9ab6,
+  0xb6cd, 0x9ab7,
+  0xb6ce, 0x9ab8,
+  0xb6cf, 0x9ab9,
+  0xb6d0, 0x9aba,
+  0xb6d1, 0x9abb,
+  0xb6d2, 0x9abc,
+  0xb6d3, 0x9abd,
+  0xb6d4, 0x9ac1,
+  0xb6d5, 0x9ac2,
+  0xb6d6, 0x9ac3,
+  0xb6d7, 0x9ac4,
+  0xb6d8, 0x9ac5,
+  0xb6d9, 0x9ac6,
+  0xb6da, 0x9ac7,
+  0xb6db, 0x9ac8,
+  0xb6dc, 0x9ac9,
+  0xb6dd, 0x9aca,
+  0xb6de, 0x9acb,
+  0xb6df, 0x9acc,
+  0xb6e0, 0x9acd,
+  0xb6e1, 0x9ace,
+  0xb6e2, 0x9acf,
+  0xb6e3, 0x9ad0,
+  0xb6e4, 0x9ad1,
+  0xb6e5, 0x9ad3,
+  0xb6e6, 0x9ad4,
+  0xb6e7, 0x9ad5,
+  0xb6e8, 0x9ad6,
+  0xb6e9, 0x9ad7,
+  0xb6ea, 0x9ad8,
+  0xb6eb, 0x9ad9,
+  0xb6ec, 0x9ada,
+  0xb6ed, 0x9adb,
+  0xb6ee, 0x9adc,
+  0xb6ef, 0x9add,
+  0xb6f0, 0x9ae1,
+  0xb6f1, 0x9ae2,
+  0xb6f2, 0x9ae3,
+  0xb6f3, 0x9ae4,
+  0xb6f4, 0x9ae5,
+  0xb6f5, 0x9ae6,
+  0xb6f6, 0x9ae7,
+  0xb6f7, 0x9ae8,
+  0xb6f8, 0x9ae9,
+  0xb6f9, 0x9aea,
+  0xb6fa, 0x9aeb,
+  0xb6fb, 0x9aec,
+  0xb6fc, 0x9aed,
+  0xb6fd, 0x9aee,
+  0xb6fe, 0x9aef,
+  0xb6ff, 0x9af0,
+  0xb700, 0x9af1,
+  0xb701, 0x9af3,
+  0xb702, 0x9af4,
+  0xb703, 0x9af5,
+  0xb704, 0x9af6,
+  0xb705, 0x9af7,
+  0xb706, 0x9af8,
+  0xb707, 0x9af9,
+  0xb708, 0x9afa,
+  0xb709, 0x9afb,
+  0xb70a, 0x9afc,
+  0xb70b, 0x9afd,
+  0xb70c, 0x9b41,
+  0xb70d, 0x9b42,
+  0xb70e, 0x9b43,
+  0xb70f, 0x9b44,
+  0xb710, 0x9b45,
+  0xb711, 0x9b46,
+  0xb712, 0x9b47,
+  0xb713, 0x9b48,
+  0xb714, 0x9b49,
+  0xb715, 0x9b4a,
+  0xb716, 0x9b4b,
+  0xb717, 0x9b4c,
+  0xb718, 0x9b4d,
+  0xb719, 0x9b4e,
+  0xb71a, 0x9b4f,
+  0xb71b, 0x9b50,
+  0xb71c, 0x9b51,
+  0xb71d, 0x9b53,
+  0xb71e, 0x9b54,
+  0xb71f, 0x9b55,
+  0xb720, 0x9b56,
+  0xb721, 0x9b57,
+  0xb722, 0x9b58,
+  0xb723, 0x9b59,
+  0xb724, 0x9b5a,
+  0xb725, 0x9b5b,
+  0xb726, 0x9b5c,
+  0xb727, 0x9b5d,
+  0xb728, 0x9b61,
+  0xb729, 0x9b62,
+  0xb72a, 0x9b63,
+  0xb72b, 0x9b64,
+  0xb72c, 0x9b65,
+  0xb72d, 0x9b66,
+  0xb72e, 0x9b67,
+  0xb72f, 0x9b68,
+  0xb730, 0x9b69,
+  0xb731, 0x9b6a,
+  0xb732, 0x9b6b,
+  0xb733, 0x9b6c,
+  0xb734, 0x9b6d,
+  0xb735, 0x9b6e,
+  0xb736, 0x9b6f,
+  0xb737, 0x9b70,
+  0xb738, 0x9b71,
+  0xb739, 0x9b73,
+  0xb73a, 0x9b74,
+  0xb73b, 0x9b75,
+  0xb73c, 0x9b76,
+  0xb73d, 0x9b77,
+  0xb73e, 0x9b78,
+  0xb73f, 0x9b79,
+  0xb740, 0x9b7a,
+  0xb741, 0x9b7b,
+  0xb742, 0x9b7c,
+  0xb743, 0x9b7d,
+  0xb744, 0x9b81,
+  0xb745, 0x9b82,
+  0xb746, 0x9b83,
+  0xb747, 0x9b84,
+  0xb748, 0x9b85,
+  0xb749, 0x9b86,
+  0xb74a, 0x9b87,
+  0xb74b, 0x9b88,
+  0xb74c, 0x9b89,
+  0xb74d, 0x9b8a,
+  0xb74e, 0x9b8b,
+  0xb74f, 0x9b8c,
+  0xb750, 0x9b8d,
+  0xb751, 0x9b8e,
+  0xb752, 0x9b8f,
+  0xb753, 0x9b90,
+  0xb754, 0x9b91,
+  0xb755, 0x9b93,
+  0xb756, 0x9b94,
+  0xb757, 0x9b95,
+  0xb758, 0x9b96,
+  0xb759, 0x9b97,
+  0xb75a, 0x9b98,
+  0xb75b, 0x9b99,
+  0xb75c, 0x9b9a,
+  0xb75d, 0x9b9b,
+  0xb75e, 0x9b9c,
+  0xb75f, 0x9b9d,
+  0xb760, 0x9ba1,
+  0xb761, 0x9ba2,
+  0xb762, 0x9ba3,
+  0xb763, 0x9ba4,
+  0xb764, 0x9ba5,
+  0xb765, 0x9ba6,
+  0xb766, 0x9ba7,
+  0xb767, 0x9ba8,
+  0xb768, 0x9ba9,
+  0xb769, 0x9baa,
+  0xb76a, 0x9bab,
+  0xb76b, 0x9bac,
+  0xb76c, 0x9bad,
+  0xb76d, 0x9bae,
+  0xb76e, 0x9baf,
+  0xb76f, 0x9bb0,
+  0xb770, 0x9bb1,
+  0xb771, 0x9bb3,
+  0xb772, 0x9bb4,
+  0xb773, 0x9bb5,
+  0xb774, 0x9bb6,
+  0xb775, 0x9bb7,
+  0xb776, 0x9bb8,
+  0xb777, 0x9bb9,
+  0xb778, 0x9bba,
+  0xb779, 0x9bbb,
+  0xb77a, 0x9bbc,
+  0xb77b, 0x9bbd,
+  0xb77c, 0x9c61,
+  0xb77d, 0x9c62,
+  0xb77e, 0x9c63,
+  0xb77f, 0x9c64,
+  0xb780, 0x9c65,
+  0xb781, 0x9c66,
+  0xb782, 0x9c67,
+  0xb783, 0x9c68,
+  0xb784, 0x9c69,
+  0xb785, 0x9c6a,
+  0xb786, 0x9c6b,
+  0xb787, 0x9c6c,
+  0xb788, 0x9c6d,
+  0xb789, 0x9c6e,
+  0xb78a, 0x9c6f,
+  0xb78b, 0x9c70,
+  0xb78c, 0x9c71,
+  0xb78d, 0x9c73,
+  0xb78e, 0x9c74,
+  0xb78f, 0x9c75,
+  0xb790, 0x9c76,
+  0xb791, 0x9c77,
+  0xb792, 0x9c78,
+  0xb793, 0x9c79,
+  0xb794, 0x9c7a,
+  0xb795, 0x9c7b,
+  0xb796, 0x9c7c,
+  0xb797, 0x9c7d,
+  0xb798, 0x9c81,
+  0xb799, 0x9c82,
+  0xb79a, 0x9c83,
+  0xb79b, 0x9c84,
+  0xb79c, 0x9c85,
+  0xb79d, 0x9c86,
+  0xb79e, 0x9c87,
+  0xb79f, 0x9c88,
+  0xb7a0, 0x9c89,
+  0xb7a1, 0x9c8a,
+  0xb7a2, 0x9c8b,
+  0xb7a3, 0x9c8c,
+  0xb7a4, 0x9c8d,
+  0xb7a5, 0x9c8e,
+  0xb7a6, 0x9c8f,
+  0xb7a7, 0x9c90,
+  0xb7a8, 0x9c91,
+  0xb7a9, 0x9c93,
+  0xb7aa, 0x9c94,
+  0xb7ab, 0x9c95,
+  0xb7ac, 0x9c96,
+  0xb7ad, 0x9c97,
+  0xb7ae, 0x9c98,
+  0xb7af, 0x9c99,
+  0xb7b0, 0x9c9a,
+  0xb7b1, 0x9c9b,
+  0xb7b2, 0x9c9c,
+  0xb7b3, 0x9c9d,
+  0xb7b4, 0x9ca1,
+  0xb7b5, 0x9ca2,
+  0xb7b6, 0x9ca3,
+  0xb7b7, 0x9ca4,
+  0xb7b8, 0x9ca5,
+  0xb7b9, 0x9ca6,
+  0xb7ba, 0x9ca7,
+  0xb7bb, 0x9ca8,
+  0xb7bc, 0x9ca9,
+  0xb7bd, 0x9caa,
+  0xb7be, 0x9cab,
+  0xb7bf, 0x9cac,
+  0xb7c0, 0x9cad,
+  0xb7c1, 0x9cae,
+  0xb7c2, 0x9caf,
+  0xb7c3, 0x9cb0,
+  0xb7c4, 0x9cb1,
+  0xb7c5, 0x9cb3,
+  0xb7c6, 0x9cb4,
+  0xb7c7, 0x9cb5,
+  0xb7c8, 0x9cb6,
+  0xb7c9, 0x9cb7,
+  0xb7ca, 0x9cb8,
+  0xb7cb, 0x9cb9,
+  0xb7cc, 0x9cba,
+  0xb7cd, 0x9cbb,
+  0xb7ce, 0x9cbc,
+  0xb7cf, 0x9cbd,
+  0xb7d0, 0x9cc1,
+  0xb7d1, 0x9cc2,
+  0xb7d2, 0x9cc3,
+  0xb7d3, 0x9cc4,
+  0xb7d4, 0x9cc5,
+  0xb7d5, 0x9cc6,
+  0xb7d6, 0x9cc7,
+  0xb7d7, 0x9cc8,
+  0xb7d8, 0x9cc9,
+  0xb7d9, 0x9cca,
+  0xb7da, 0x9ccb,
+  0xb7db, 0x9ccc,
+  0xb7dc, 0x9ccd,
+  0xb7dd, 0x9cce,
+  0xb7de, 0x9ccf,
+  0xb7df, 0x9cd0,
+  0xb7e0, 0x9cd1,
+  0xb7e1, 0x9cd3,
+  0xb7e2, 0x9cd4,
+  0xb7e3, 0x9cd5,
+  0xb7e4, 0x9cd6,
+  0xb7e5, 0x9cd7,
+  0xb7e6, 0x9cd8,
+  0xb7e7, 0x9cd9,
+  0xb7e8, 0x9cda,
+  0xb7e9, 0x9cdb,
+  0xb7ea, 0x9cdc,
+  0xb7eb, 0x9cdd,
+  0xb7ec, 0x9ce1,
+  0xb7ed, 0x9ce2,
+  0xb7ee, 0x9ce3,
+  0xb7ef, 0x9ce4,
+  0xb7f0, 0x9ce5,
+  0xb7f1, 0x9ce6,
+  0xb7f2, 0x9ce7,
+  0xb7f3, 0x9ce8,
+  0xb7f4, 0x9ce9,
+  0xb7f5, 0x9cea,
+  0xb7f6, 0x9ceb,
+  0xb7f7, 0x9cec,
+  0xb7f8, 0x9ced,
+  0xb7f9, 0x9cee,
+  0xb7fa, 0x9cef,
+  0xb7fb, 0x9cf0,
+  0xb7fc, 0x9cf1,
+  0xb7fd, 0x9cf3,
+  0xb7fe, 0x9cf4,
+  0xb7ff, 0x9cf5,
+  0xb800, 0x9cf6,
+  0xb801, 0x9cf7,
+  0xb802, 0x9cf8,
+  0xb803, 0x9cf9,
+  0xb804, 0x9cfa,
+  0xb805, 0x9cfb,
+  0xb806, 0x9cfc,
+  0xb807, 0x9cfd,
+  0xb808, 0x9d41,
+  0xb809, 0x9d42,
+  0xb80a, 0x9d43,
+  0xb80b, 0x9d44,
+  0xb80c, 0x9d45,
+  0xb80d, 0x9d46,
+  0xb80e, 0x9d47,
+  0xb80f, 0x9d48,
+  0xb810, 0x9d49,
+  0xb811, 0x9d4a,
+  0xb812, 0x9d4b,
+  0xb813, 0x9d4c,
+  0xb814, 0x9d4d,
+  0xb815, 0x9d4e,
+  0xb816, 0x9d4f,
+  0xb817, 0x9d50,
+  0xb818, 0x9d51,
+  0xb819, 0x9d53,
+  0xb81a, 0x9d54,
+  0xb81b, 0x9d55,
+  0xb81c, 0x9d56,
+  0xb81d, 0x9d57,
+  0xb81e, 0x9d58,
+  0xb81f, 0x9d59,
+  0xb820, 0x9d5a,
+  0xb821, 0x9d5b,
+  0xb822, 0x9d5c,
+  0xb823, 0x9d5d,
+  0xb824, 0x9d61,
+  0xb825, 0x9d62,
+  0xb826, 0x9d63,
+  0xb827, 0x9d64,
+  0xb828, 0x9d65,
+  0xb829, 0x9d66,
+  0xb82a, 0x9d67,
+  0xb82b, 0x9d68,
+  0xb82c, 0x9d69,
+  0xb82d, 0x9d6a,
+  0xb82e, 0x9d6b,
+  0xb82f, 0x9d6c,
+  0xb830, 0x9d6d,
+  0xb831, 0x9d6e,
+  0xb832, 0x9d6f,
+  0xb833, 0x9d70,
+  0xb834, 0x9d71,
+  0xb835, 0x9d73,
+  0xb836, 0x9d74,
+  0xb837, 0x9d75,
+  0xb838, 0x9d76,
+  0xb839, 0x9d77,
+  0xb83a, 0x9d78,
+  0xb83b, 0x9d79,
+  0xb83c, 0x9d7a,
+  0xb83d, 0x9d7b,
+  0xb83e, 0x9d7c,
+  0xb83f, 0x9d7d,
+  0xb840, 0x9d81,
+  0xb841, 0x9d82,
+  0xb842, 0x9d83,
+  0xb843, 0x9d84,
+  0xb844, 0x9d85,
+  0xb845, 0x9d86,
+  0xb846, 0x9d87,
+  0xb847, 0x9d88,
+  0xb848, 0x9d89,
+  0xb849, 0x9d8a,
+  0xb84a, 0x9d8b,
+  0xb84b, 0x9d8c,
+  0xb84c, 0x9d8d,
+  0xb84d, 0x9d8e,
+  0xb84e, 0x9d8f,
+  0xb84f, 0x9d90,
+  0xb850, 0x9d91,
+  0xb851, 0x9d93,
+  0xb852, 0x9d94,
+  0xb853, 0x9d95,
+  0xb854, 0x9d96,
+  0xb855, 0x9d97,
+  0xb856, 0x9d98,
+  0xb857, 0x9d99,
+  0xb858, 0x9d9a,
+  0xb859, 0x9d9b,
+  0xb85a, 0x9d9c,
+  0xb85b, 0x9d9d,
+  0xb85c, 0x9da1,
+  0xb85d, 0x9da2,
+  0xb85e, 0x9da3,
+  0xb85f, 0x9da4,
+  0xb860, 0x9da5,
+  0xb861, 0x9da6,
+  0xb862, 0x9da7,
+  0xb863, 0x9da8,
+  0xb864, 0x9da9,
+  0xb865, 0x9daa,
+  0xb866, 0x9dab,
+  0xb867, 0x9dac,
+  0xb868, 0x9dad,
+  0xb869, 0x9dae,
+  0xb86a, 0x9daf,
+  0xb86b, 0x9db0,
+  0xb86c, 0x9db1,
+  0xb86d, 0x9db3,
+  0xb86e, 0x9db4,
+  0xb86f, 0x9db5,
+  0xb870, 0x9db6,
+  0xb871, 0x9db7,
+  0xb872, 0x9db8,
+  0xb873, 0x9db9,
+  0xb874, 0x9dba,
+  0xb875, 0x9dbb,
+  0xb876, 0x9dbc,
+  0xb877, 0x9dbd,
+  0xb878, 0x9dc1,
+  0xb879, 0x9dc2,
+  0xb87a, 0x9dc3,
+  0xb87b, 0x9dc4,
+  0xb87c, 0x9dc5,
+  0xb87d, 0x9dc6,
+  0xb87e, 0x9dc7,
+  0xb87f, 0x9dc8,
+  0xb880, 0x9dc9,
+  0xb881, 0x9dca,
+  0xb882, 0x9dcb,
+  0xb883, 0x9dcc,
+  0xb884, 0x9dcd,
+  0xb885, 0x9dce,
+  0xb886, 0x9dcf,
+  0xb887, 0x9dd0,
+  0xb888, 0x9dd1,
+  0xb889, 0x9dd3,
+  0xb88a, 0x9dd4,
+  0xb88b, 0x9dd5,
+  0xb88c, 0x9dd6,
+  0xb88d, 0x9dd7,
+  0xb88e, 0x9dd8,
+  0xb88f, 0x9dd9,
+  0xb890, 0x9dda,
+  0xb891, 0x9ddb,
+  0xb892, 0x9ddc,
+  0xb893, 0x9ddd,
+  0xb894, 0x9de1,
+  0xb895, 0x9de2,
+  0xb896, 0x9de3,
+  0xb897, 0x9de4,
+  0xb898, 0x9de5,
+  0xb899, 0x9de6,
+  0xb89a, 0x9de7,
+  0xb89b, 0x9de8,
+  0xb89c, 0x9de9,
+  0xb89d, 0x9dea,
+  0xb89e, 0x9deb,
+  0xb89f, 0x9dec,
+  0xb8a0, 0x9ded,
+  0xb8a1, 0x9dee,
+  0xb8a2, 0x9def,
+  0xb8a3, 0x9df0,
+  0xb8a4, 0x9df1,
+  0xb8a5, 0x9df3,
+  0xb8a6, 0x9df4,
+  0xb8a7, 0x9df5,
+  0xb8a8, 0x9df6,
+  0xb8a9, 0x9df7,
+  0xb8aa, 0x9df8,
+  0xb8ab, 0x9df9,
+  0xb8ac, 0x9dfa,
+  0xb8ad, 0x9dfb,
+  0xb8ae, 0x9dfc,
+  0xb8af, 0x9dfd,
+  0xb8b0, 0x9e41,
+  0xb8b1, 0x9e42,
+  0xb8b2, 0x9e43,
+  0xb8b3, 0x9e44,
+  0xb8b4, 0x9e45,
+  0xb8b5, 0x9e46,
+  0xb8b6, 0x9e47,
+  0xb8b7, 0x9e48,
+  0xb8b8, 0x9e49,
+  0xb8b9, 0x9e4a,
+  0xb8ba, 0x9e4b,
+  0xb8bb, 0x9e4c,
+  0xb8bc, 0x9e4d,
+  0xb8bd, 0x9e4e,
+  0xb8be, 0x9e4f,
+  0xb8bf, 0x9e50,
+  0xb8c0, 0x9e51,
+  0xb8c1, 0x9e53,
+  0xb8c2, 0x9e54,
+  0xb8c3, 0x9e55,
+  0xb8c4, 0x9e56,
+  0xb8c5, 0x9e57,
+  0xb8c6, 0x9e58,
+  0xb8c7, 0x9e59,
+  0xb8c8, 0x9e5a,
+  0xb8c9, 0x9e5b,
+  0xb8ca, 0x9e5c,
+  0xb8cb, 0x9e5d,
+  0xb8cc, 0x9e61,
+  0xb8cd, 0x9e62,
+  0xb8ce, 0x9e63,
+  0xb8cf, 0x9e64,
+  0xb8d0, 0x9e65,
+  0xb8d1, 0x9e66,
+  0xb8d2, 0x9e67,
+  0xb8d3, 0x9e68,
+  0xb8d4, 0x9e69,
+  0xb8d5, 0x9e6a,
+  0xb8d6, 0x9e6b,
+  0xb8d7, 0x9e6c,
+  0xb8d8, 0x9e6d,
+  0xb8d9, 0x9e6e,
+  0xb8da, 0x9e6f,
+  0xb8db, 0x9e70,
+  0xb8dc, 0x9e71,
+  0xb8dd, 0x9e73,
+  0xb8de, 0x9e74,
+  0xb8df, 0x9e75,
+  0xb8e0, 0x9e76,
+  0xb8e1, 0x9e77,
+  0xb8e2, 0x9e78,
+  0xb8e3, 0x9e79,
+  0xb8e4, 0x9e7a,
+  0xb8e5, 0x9e7b,
+  0xb8e6, 0x9e7c,
+  0xb8e7, 0x9e7d,
+  0xb8e8, 0x9e81,
+  0xb8e9, 0x9e82,
+  0xb8ea, 0x9e83,
+  0xb8eb, 0x9e84,
+  0xb8ec, 0x9e85,
+  0xb8ed, 0x9e86,
+  0xb8ee, 0x9e87,
+  0xb8ef, 0x9e88,
+  0xb8f0, 0x9e89,
+  0xb8f1, 0x9e8a,
+  0xb8f2, 0x9e8b,
+  0xb8f3, 0x9e8c,
+  0xb8f4, 0x9e8d,
+  0xb8f5, 0x9e8e,
+  0xb8f6, 0x9e8f,
+  0xb8f7, 0x9e90,
+  0xb8f8, 0x9e91,
+  0xb8f9, 0x9e93,
+  0xb8fa, 0x9e94,
+  0xb8fb, 0x9e95,
+  0xb8fc, 0x9e96,
+  0xb8fd, 0x9e97,
+  0xb8fe, 0x9e98,
+  0xb8ff, 0x9e99,
+  0xb900, 0x9e9a,
+  0xb901, 0x9e9b,
+  0xb902, 0x9e9c,
+  0xb903, 0x9e9d,
+  0xb904, 0x9ea1,
+  0xb905, 0x9ea2,
+  0xb906, 0x9ea3,
+  0xb907, 0x9ea4,
+  0xb908, 0x9ea5,
+  0xb909, 0x9ea6,
+  0xb90a, 0x9ea7,
+  0xb90b, 0x9ea8,
+  0xb90c, 0x9ea9,
+  0xb90d, 0x9eaa,
+  0xb90e, 0x9eab,
+  0xb90f, 0x9eac,
+  0xb910, 0x9ead,
+  0xb911, 0x9eae,
+  0xb912, 0x9eaf,
+  0xb913, 0x9eb0,
+  0xb914, 0x9eb1,
+  0xb915, 0x9eb3,
+  0xb916, 0x9eb4,
+  0xb917, 0x9eb5,
+  0xb918, 0x9eb6,
+  0xb919, 0x9eb7,
+  0xb91a, 0x9eb8,
+  0xb91b, 0x9eb9,
+  0xb91c, 0x9eba,
+  0xb91d, 0x9ebb,
+  0xb91e, 0x9ebc,
+  0xb91f, 0x9ebd,
+  0xb920, 0x9ec1,
+  0xb921, 0x9ec2,
+  0xb922, 0x9ec3,
+  0xb923, 0x9ec4,
+  0xb924, 0x9ec5,
+  0xb925, 0x9ec6,
+  0xb926, 0x9ec7,
+  0xb927, 0x9ec8,
+  0xb928, 0x9ec9,
+  0xb929, 0x9eca,
+  0xb92a, 0x9ecb,
+  0xb92b, 0x9ecc,
+  0xb92c, 0x9ecd,
+  0xb92d, 0x9ece,
+  0xb92e, 0x9ecf,
+  0xb92f, 0x9ed0,
+  0xb930, 0x9ed1,
+  0xb931, 0x9ed3,
+  0xb932, 0x9ed4,
+  0xb933, 0x9ed5,
+  0xb934, 0x9ed6,
+  0xb935, 0x9ed7,
+  0xb936, 0x9ed8,
+  0xb937, 0x9ed9,
+  0xb938, 0x9eda,
+  0xb939, 0x9edb,
+  0xb93a, 0x9edc,
+  0xb93b, 0x9edd,
+  0xb93c, 0x9ee1,
+  0xb93d, 0x9ee2,
+  0xb93e, 0x9ee3,
+  0xb93f, 0x9ee4,
+  0xb940, 0x9ee5,
+  0xb941, 0x9ee6,
+  0xb942, 0x9ee7,
+  0xb943, 0x9ee8,
+  0xb944, 0x9ee9,
+  0xb945, 0x9eea,
+  0xb946, 0x9eeb,
+  0xb947, 0x9eec,
+  0xb948, 0x9eed,
+  0xb949, 0x9eee,
+  0xb94a, 0x9eef,
+  0xb94b, 0x9ef0,
+  0xb94c, 0x9ef1,
+  0xb94d, 0x9ef3,
+  0xb94e, 0x9ef4,
+  0xb94f, 0x9ef5,
+  0xb950, 0x9ef6,
+  0xb951, 0x9ef7,
+  0xb952, 0x9ef8,
+  0xb953, 0x9ef9,
+  0xb954, 0x9efa,
+  0xb955, 0x9efb,
+  0xb956, 0x9efc,
+  0xb957, 0x9efd,
+  0xb958, 0x9f41,
+  0xb959, 0x9f42,
+  0xb95a, 0x9f43,
+  0xb95b, 0x9f44,
+  0xb95c, 0x9f45,
+  0xb95d, 0x9f46,
+  0xb95e, 0x9f47,
+  0xb95f, 0x9f48,
+  0xb960, 0x9f49,
+  0xb961, 0x9f4a,
+  0xb962, 0x9f4b,
+  0xb963, 0x9f4c,
+  0xb964, 0x9f4d,
+  0xb965, 0x9f4e,
+  0xb966, 0x9f4f,
+  0xb967, 0x9f50,
+  0xb968, 0x9f51,
+  0xb969, 0x9f53,
+  0xb96a, 0x9f54,
+  0xb96b, 0x9f55,
+  0xb96c, 0x9f56,
+  0xb96d, 0x9f57,
+  0xb96e, 0x9f58,
+  0xb96f, 0x9f59,
+  0xb970, 0x9f5a,
+  0xb971, 0x9f5b,
+  0xb972, 0x9f5c,
+  0xb973, 0x9f5d,
+  0xb974, 0x9f61,
+  0xb975, 0x9f62,
+  0xb976, 0x9f63,
+  0xb977, 0x9f64,
+  0xb978, 0x9f65,
+  0xb979, 0x9f66,
+  0xb97a, 0x9f67,
+  0xb97b, 0x9f68,
+  0xb97c, 0x9f69,
+  0xb97d, 0x9f6a,
+  0xb97e, 0x9f6b,
+  0xb97f, 0x9f6c,
+  0xb980, 0x9f6d,
+  0xb981, 0x9f6e,
+  0xb982, 0x9f6f,
+  0xb983, 0x9f70,
+  0xb984, 0x9f71,
+  0xb985, 0x9f73,
+  0xb986, 0x9f74,
+  0xb987, 0x9f75,
+  0xb988, 0x9f76,
+  0xb989, 0x9f77,
+  0xb98a, 0x9f78,
+  0xb98b, 0x9f79,
+  0xb98c, 0x9f7a,
+  0xb98d, 0x9f7b,
+  0xb98e, 0x9f7c,
+  0xb98f, 0x9f7d,
+  0xb990, 0x9f81,
+  0xb991, 0x9f82,
+  0xb992, 0x9f83,
+  0xb993, 0x9f84,
+  0xb994, 0x9f85,
+  0xb995, 0x9f86,
+  0xb996, 0x9f87,
+  0xb997, 0x9f88,
+  0xb998, 0x9f89,
+  0xb999, 0x9f8a,
+  0xb99a, 0x9f8b,
+  0xb99b, 0x9f8c,
+  0xb99c, 0x9f8d,
+  0xb99d, 0x9f8e,
+  0xb99e, 0x9f8f,
+  0xb99f, 0x9f90,
+  0xb9a0, 0x9f91,
+  0xb9a1, 0x9f93,
+  0xb9a2, 0x9f94,
+  0xb9a3, 0x9f95,
+  0xb9a4, 0x9f96,
+  0xb9a5, 0x9f97,
+  0xb9a6, 0x9f98,
+  0xb9a7, 0x9f99,
+  0xb9a8, 0x9f9a,
+  0xb9a9, 0x9f9b,
+  0xb9aa, 0x9f9c,
+  0xb9ab, 0x9f9d,
+  0xb9ac, 0x9fa1,
+  0xb9ad, 0x9fa2,
+  0xb9ae, 0x9fa3,
+  0xb9af, 0x9fa4,
+  0xb9b0, 0x9fa5,
+  0xb9b1, 0x9fa6,
+  0xb9b2, 0x9fa7,
+  0xb9b3, 0x9fa8,
+  0xb9b4, 0x9fa9,
+  0xb9b5, 0x9faa,
+  0xb9b6, 0x9fab,
+  0xb9b7, 0x9fac,
+  0xb9b8, 0x9fad,
+  0xb9b9, 0x9fae,
+  0xb9ba, 0x9faf,
+  0xb9bb, 0x9fb0,
+  0xb9bc, 0x9fb1,
+  0xb9bd, 0x9fb3,
+  0xb9be, 0x9fb4,
+  0xb9bf, 0x9fb5,
+  0xb9c0, 0x9fb6,
+  0xb9c1, 0x9fb7,
+  0xb9c2, 0x9fb8,
+  0xb9c3, 0x9fb9,
+  0xb9c4, 0x9fba,
+  0xb9c5, 0x9fbb,
+  0xb9c6, 0x9fbc,
+  0xb9c7, 0x9fbd,
+  0xb9c8, 0xa061,
+  0xb9c9, 0xa062,
+  0xb9ca, 0xa063,
+  0xb9cb, 0xa064,
+  0xb9cc, 0xa065,
+  0xb9cd, 0xa066,
+  0xb9ce, 0xa067,
+  0xb9cf, 0xa068,
+  0xb9d0, 0xa069,
+  0xb9d1, 0xa06a,
+  0xb9d2, 0xa06b,
+  0xb9d3, 0xa06c,
+  0xb9d4, 0xa06d,
+  0xb9d5, 0xa06e,
+  0xb9d6, 0xa06f,
+  0xb9d7, 0xa070,
+  0xb9d8, 0xa071,
+  0xb9d9, 0xa073,
+  0xb9da, 0xa074,
+  0xb9db, 0xa075,
+  0xb9dc, 0xa076,
+  0xb9dd, 0xa077,
+  0xb9de, 0xa078,
+  0xb9df, 0xa079,
+  0xb9e0, 0xa07a,
+  0xb9e1, 0xa07b,
+  0xb9e2, 0xa07c,
+  0xb9e3, 0xa07d,
+  0xb9e4, 0xa081,
+  0xb9e5, 0xa082,
+  0xb9e6, 0xa083,
+  0xb9e7, 0xa084,
+  0xb9e8, 0xa085,
+  0xb9e9, 0xa086,
+  0xb9ea, 0xa087,
+  0xb9eb, 0xa088,
+  0xb9ec, 0xa089,
+  0xb9ed, 0xa08a,
+  0xb9ee, 0xa08b,
+  0xb9ef, 0xa08c,
+  0xb9f0, 0xa08d,
+  0xb9f1, 0xa08e,
+  0xb9f2, 0xa08f,
+  0xb9f3, 0xa090,
+  0xb9f4, 0xa091,
+  0xb9f5, 0xa093,
+  0xb9f6, 0xa094,
+  0xb9f7, 0xa095,
+  0xb9f8, 0xa096,
+  0xb9f9, 0xa097,
+  0xb9fa, 0xa098,
+  0xb9fb, 0xa099,
+  0xb9fc, 0xa09a,
+  0xb9fd, 0xa09b,
+  0xb9fe, 0xa09c,
+  0xb9ff, 0xa09d,
+  0xba00, 0xa0a1,
+  0xba01, 0xa0a2,
+  0xba02, 0xa0a3,
+  0xba03, 0xa0a4,
+  0xba04, 0xa0a5,
+  0xba05, 0xa0a6,
+  0xba06, 0xa0a7,
+  0xba07, 0xa0a8,
+  0xba08, 0xa0a9,
+  0xba09, 0xa0aa,
+  0xba0a, 0xa0ab,
+  0xba0b, 0xa0ac,
+  0xba0c, 0xa0ad,
+  0xba0d, 0xa0ae,
+  0xba0e, 0xa0af,
+  0xba0f, 0xa0b0,
+  0xba10, 0xa0b1,
+  0xba11, 0xa0b3,
+  0xba12, 0xa0b4,
+  0xba13, 0xa0b5,
+  0xba14, 0xa0b6,
+  0xba15, 0xa0b7,
+  0xba16, 0xa0b8,
+  0xba17, 0xa0b9,
+  0xba18, 0xa0ba,
+  0xba19, 0xa0bb,
+  0xba1a, 0xa0bc,
+  0xba1b, 0xa0bd,
+  0xba1c, 0xa0c1,
+  0xba1d, 0xa0c2,
+  0xba1e, 0xa0c3,
+  0xba1f, 0xa0c4,
+  0xba20, 0xa0c5,
+  0xba21, 0xa0c6,
+  0xba22, 0xa0c7,
+  0xba23, 0xa0c8,
+  0xba24, 0xa0c9,
+  0xba25, 0xa0ca,
+  0xba26, 0xa0cb,
+  0xba27, 0xa0cc,
+  0xba28, 0xa0cd,
+  0xba29, 0xa0ce,
+  0xba2a, 0xa0cf,
+  0xba2b, 0xa0d0,
+  0xba2c, 0xa0d1,
+  0xba2d, 0xa0d3,
+  0xba2e, 0xa0d4,
+  0xba2f, 0xa0d5,
+  0xba30, 0xa0d6,
+  0xba31, 0xa0d7,
+  0xba32, 0xa0d8,
+  0xba33, 0xa0d9,
+  0xba34, 0xa0da,
+  0xba35, 0xa0db,
+  0xba36, 0xa0dc,
+  0xba37, 0xa0dd,
+  0xba38, 0xa0e1,
+  0xba39, 0xa0e2,
+  0xba3a, 0xa0e3,
+  0xba3b, 0xa0e4,
+  0xba3c, 0xa0e5,
+  0xba3d, 0xa0e6,
+  0xba3e, 0xa0e7,
+  0xba3f, 0xa0e8,
+  0xba40, 0xa0e9,
+  0xba41, 0xa0ea,
+  0xba42, 0xa0eb,
+  0xba43, 0xa0ec,
+  0xba44, 0xa0ed,
+  0xba45, 0xa0ee,
+  0xba46, 0xa0ef,
+  0xba47, 0xa0f0,
+  0xba48, 0xa0f1,
+  0xba49, 0xa0f3,
+  0xba4a, 0xa0f4,
+  0xba4b, 0xa0f5,
+  0xba4c, 0xa0f6,
+  0xba4d, 0xa0f7,
+  0xba4e, 0xa0f8,
+  0xba4f, 0xa0f9,
+  0xba50, 0xa0fa,
+  0xba51, 0xa0fb,
+  0xba52, 0xa0fc,
+  0xba53, 0xa0fd,
+  0xba54, 0xa141,
+  0xba55, 0xa142,
+  0xba56, 0xa143,
+  0xba57, 0xa144,
+  0xba58, 0xa145,
+  0xba59, 0xa146,
+  0xba5a, 0xa147,
+  0xba5b, 0xa148,
+  0xba5c, 0xa149,
+  0xba5d, 0xa14a,
+  0xba5e, 0xa14b,
+  0xba5f, 0xa14c,
+  0xba60, 0xa14d,
+  0xba61, 0xa14e,
+  0xba62, 0xa14f,
+  0xba63, 0xa150,
+  0xba64, 0xa151,
+  0xba65, 0xa153,
+  0xba66, 0xa154,
+  0xba67, 0xa155,
+  0xba68, 0xa156,
+  0xba69, 0xa157,
+  0xba6a, 0xa158,
+  0xba6b, 0xa159,
+  0xba6c, 0xa15a,
+  0xba6d, 0xa15b,
+  0xba6e, 0xa15c,
+  0xba6f, 0xa15d,
+  0xba70, 0xa161,
+  0xba71, 0xa162,
+  0xba72, 0xa163,
+  0xba73, 0xa164,
+  0xba74, 0xa165,
+  0xba75, 0xa166,
+  0xba76, 0xa167,
+  0xba77, 0xa168,
+  0xba78, 0xa169,
+  0xba79, 0xa16a,
+  0xba7a, 0xa16b,
+  0xba7b, 0xa16c,
+  0xba7c, 0xa16d,
+  0xba7d, 0xa16e,
+  0xba7e, 0xa16f,
+  0xba7f, 0xa170,
+  0xba80, 0xa171,
+  0xba81, 0xa173,
+  0xba82, 0xa174,
+  0xba83, 0xa175,
+  0xba84, 0xa176,
+  0xba85, 0xa177,
+  0xba86, 0xa178,
+  0xba87, 0xa179,
+  0xba88, 0xa17a,
+  0xba89, 0xa17b,
+  0xba8a, 0xa17c,
+  0xba8b, 0xa17d,
+  0xba8c, 0xa181,
+  0xba8d, 0xa182,
+  0xba8e, 0xa183,
+  0xba8f, 0xa184,
+  0xba90, 0xa185,
+  0xba91, 0xa186,
+  0xba92, 0xa187,
+  0xba93, 0xa188,
+  0xba94, 0xa189,
+  0xba95, 0xa18a,
+  0xba96, 0xa18b,
+  0xba97, 0xa18c,
+  0xba98, 0xa18d,
+  0xba99, 0xa18e,
+  0xba9a, 0xa18f,
+  0xba9b, 0xa190,
+  0xba9c, 0xa191,
+  0xba9d, 0xa193,
+  0xba9e, 0xa194,
+  0xba9f, 0xa195,
+  0xbaa0, 0xa196,
+  0xbaa1, 0xa197,
+  0xbaa2, 0xa198,
+  0xbaa3, 0xa199,
+  0xbaa4, 0xa19a,
+  0xbaa5, 0xa19b,
+  0xbaa6, 0xa19c,
+  0xbaa7, 0xa19d,
+  0xbaa8, 0xa1a1,
+  0xbaa9, 0xa1a2,
+  0xbaaa, 0xa1a3,
+  0xbaab, 0xa1a4,
+  0xbaac, 0xa1a5,
+  0xbaad, 0xa1a6,
+  0xbaae, 0xa1a7,
+  0xbaaf, 0xa1a8,
+  0xbab0, 0xa1a9,
+  0xbab1, 0xa1aa,
+  0xbab2, 0xa1ab,
+  0xbab3, 0xa1ac,
+  0xbab4, 0xa1ad,
+  0xbab5, 0xa1ae,
+  0xbab6, 0xa1af,
+  0xbab7, 0xa1b0,
+  0xbab8, 0xa1b1,
+  0xbab9, 0xa1b3,
+  0xbaba, 0xa1b4,
+  0xbabb, 0xa1b5,
+  0xbabc, 0xa1b6,
+  0xbabd, 0xa1b7,
+  0xbabe, 0xa1b8,
+  0xbabf, 0xa1b9,
+  0xbac0, 0xa1ba,
+  0xbac1, 0xa1bb,
+  0xbac2, 0xa1bc,
+  0xbac3, 0xa1bd,
+  0xbac4, 0xa1c1,
+  0xbac5, 0xa1c2,
+  0xbac6, 0xa1c3,
+  0xbac7, 0xa1c4,
+  0xbac8, 0xa1c5,
+  0xbac9, 0xa1c6,
+  0xbaca, 0xa1c7,
+  0xbacb, 0xa1c8,
+  0xbacc, 0xa1c9,
+  0xbacd, 0xa1ca,
+  0xbace, 0xa1cb,
+  0xbacf, 0xa1cc,
+  0xbad0, 0xa1cd,
+  0xbad1, 0xa1ce,
+  0xbad2, 0xa1cf,
+  0xbad3, 0xa1d0,
+  0xbad4, 0xa1d1,
+  0xbad5, 0xa1d3,
+  0xbad6, 0xa1d4,
+  0xbad7, 0xa1d5,
+  0xbad8, 0xa1d6,
+  0xbad9, 0xa1d7,
+  0xbada, 0xa1d8,
+  0xbadb, 0xa1d9,
+  0xbadc, 0xa1da,
+  0xbadd, 0xa1db,
+  0xbade, 0xa1dc,
+  0xbadf, 0xa1dd,
+  0xbae0, 0xa1e1,
+  0xbae1, 0xa1e2,
+  0xbae2, 0xa1e3,
+  0xbae3, 0xa1e4,
+  0xbae4, 0xa1e5,
+  0xbae5, 0xa1e6,
+  0xbae6, 0xa1e7,
+  0xbae7, 0xa1e8,
+  0xbae8, 0xa1e9,
+  0xbae9, 0xa1ea,
+  0xbaea, 0xa1eb,
+  0xbaeb, 0xa1ec,
+  0xbaec, 0xa1ed,
+  0xbaed, 0xa1ee,
+  0xbaee, 0xa1ef,
+  0xbaef, 0xa1f0,
+  0xbaf0, 0xa1f1,
+  0xbaf1, 0xa1f3,
+  0xbaf2, 0xa1f4,
+  0xbaf3, 0xa1f5,
+  0xbaf4, 0xa1f6,
+  0xbaf5, 0xa1f7,
+  0xbaf6, 0xa1f8,
+  0xbaf7, 0xa1f9,
+  0xbaf8, 0xa1fa,
+  0xbaf9, 0xa1fb,
+  0xbafa, 0xa1fc,
+  0xbafb, 0xa1fd,
+  0xbafc, 0xa241,
+  0xbafd, 0xa242,
+  0xbafe, 0xa243,
+  0xbaff, 0xa244,
+  0xbb00, 0xa245,
+  0xbb01, 0xa246,
+  0xbb02, 0xa247,
+  0xbb03, 0xa248,
+  0xbb04, 0xa249,
+  0xbb05, 0xa24a,
+  0xbb06, 0xa24b,
+  0xbb07, 0xa24c,
+  0xbb08, 0xa24d,
+  0xbb09, 0xa24e,
+  0xbb0a, 0xa24f,
+  0xbb0b, 0xa250,
+  0xbb0c, 0xa251,
+  0xbb0d, 0xa253,
+  0xbb0e, 0xa254,
+  0xbb0f, 0xa255,
+  0xbb10, 0xa256,
+  0xbb11, 0xa257,
+  0xbb12, 0xa258,
+  0xbb13, 0xa259,
+  0xbb14, 0xa25a,
+  0xbb15, 0xa25b,
+  0xbb16, 0xa25c,
+  0xbb17, 0xa25d,
+  0xbb18, 0xa261,
+  0xbb19, 0xa262,
+  0xbb1a, 0xa263,
+  0xbb1b, 0xa264,
+  0xbb1c, 0xa265,
+  0xbb1d, 0xa266,
+  0xbb1e, 0xa267,
+  0xbb1f, 0xa268,
+  0xbb20, 0xa269,
+  0xbb21, 0xa26a,
+  0xbb22, 0xa26b,
+  0xbb23, 0xa26c,
+  0xbb24, 0xa26d,
+  0xbb25, 0xa26e,
+  0xbb26, 0xa26f,
+  0xbb27, 0xa270,
+  0xbb28, 0xa271,
+  0xbb29, 0xa273,
+  0xbb2a, 0xa274,
+  0xbb2b, 0xa275,
+  0xbb2c, 0xa276,
+  0xbb2d, 0xa277,
+  0xbb2e, 0xa278,
+  0xbb2f, 0xa279,
+  0xbb30, 0xa27a,
+  0xbb31, 0xa27b,
+  0xbb32, 0xa27c,
+  0xbb33, 0xa27d,
+  0xbb34, 0xa281,
+  0xbb35, 0xa282,
+  0xbb36, 0xa283,
+  0xbb37, 0xa284,
+  0xbb38, 0xa285,
+  0xbb39, 0xa286,
+  0xbb3a, 0xa287,
+  0xbb3b, 0xa288,
+  0xbb3c, 0xa289,
+  0xbb3d, 0xa28a,
+  0xbb3e, 0xa28b,
+  0xbb3f, 0xa28c,
+  0xbb40, 0xa28d,
+  0xbb41, 0xa28e,
+  0xbb42, 0xa28f,
+  0xbb43, 0xa290,
+  0xbb44, 0xa291,
+  0xbb45, 0xa293,
+  0xbb46, 0xa294,
+  0xbb47, 0xa295,
+  0xbb48, 0xa296,
+  0xbb49, 0xa297,
+  0xbb4a, 0xa298,
+  0xbb4b, 0xa299,
+  0xbb4c, 0xa29a,
+  0xbb4d, 0xa29b,
+  0xbb4e, 0xa29c,
+  0xbb4f, 0xa29d,
+  0xbb50, 0xa2a1,
+  0xbb51, 0xa2a2,
+  0xbb52, 0xa2a3,
+  0xbb53, 0xa2a4,
+  0xbb54, 0xa2a5,
+  0xbb55, 0xa2a6,
+  0xbb56, 0xa2a7,
+  0xbb57, 0xa2a8,
+  0xbb58, 0xa2a9,
+  0xbb59, 0xa2aa,
+  0xbb5a, 0xa2ab,
+  0xbb5b, 0xa2ac,
+  0xbb5c, 0xa2ad,
+  0xbb5d, 0xa2ae,
+  0xbb5e, 0xa2af,
+  0xbb5f, 0xa2b0,
+  0xbb60, 0xa2b1,
+  0xbb61, 0xa2b3,
+  0xbb62, 0xa2b4,
+  0xbb63, 0xa2b5,
+  0xbb64, 0xa2b6,
+  0xbb65, 0xa2b7,
+  0xbb66, 0xa2b8,
+  0xbb67, 0xa2b9,
+  0xbb68, 0xa2ba,
+  0xbb69, 0xa2bb,
+  0xbb6a, 0xa2bc,
+  0xbb6b, 0xa2bd,
+  0xbb6c, 0xa2c1,
+  0xbb6d, 0xa2c2,
+  0xbb6e, 0xa2c3,
+  0xbb6f, 0xa2c4,
+  0xbb70, 0xa2c5,
+  0xbb71, 0xa2c6,
+  0xbb72, 0xa2c7,
+  0xbb73, 0xa2c8,
+  0xbb74, 0xa2c9,
+  0xbb75, 0xa2ca,
+  0xbb76, 0xa2cb,
+  0xbb77, 0xa2cc,
+  0xbb78, 0xa2cd,
+  0xbb79, 0xa2ce,
+  0xbb7a, 0xa2cf,
+  0xbb7b, 0xa2d0,
+  0xbb7c, 0xa2d1,
+  0xbb7d, 0xa2d3,
+  0xbb7e, 0xa2d4,
+  0xbb7f, 0xa2d5,
+  0xbb80, 0xa2d6,
+  0xbb81, 0xa2d7,
+  0xbb82, 0xa2d8,
+  0xbb83, 0xa2d9,
+  0xbb84, 0xa2da,
+  0xbb85, 0xa2db,
+  0xbb86, 0xa2dc,
+  0xbb87, 0xa2dd,
+  0xbb88, 0xa2e1,
+  0xbb89, 0xa2e2,
+  0xbb8a, 0xa2e3,
+  0xbb8b, 0xa2e4,
+  0xbb8c, 0xa2e5,
+  0xbb8d, 0xa2e6,
+  0xbb8e, 0xa2e7,
+  0xbb8f, 0xa2e8,
+  0xbb90, 0xa2e9,
+  0xbb91, 0xa2ea,
+  0xbb92, 0xa2eb,
+  0xbb93, 0xa2ec,
+  0xbb94, 0xa2ed,
+  0xbb95, 0xa2ee,
+  0xbb96, 0xa2ef,
+  0xbb97, 0xa2f0,
+  0xbb98, 0xa2f1,
+  0xbb99, 0xa2f3,
+  0xbb9a, 0xa2f4,
+  0xbb9b, 0xa2f5,
+  0xbb9c, 0xa2f6,
+  0xbb9d, 0xa2f7,
+  0xbb9e, 0xa2f8,
+  0xbb9f, 0xa2f9,
+  0xbba0, 0xa2fa,
+  0xbba1, 0xa2fb,
+  0xbba2, 0xa2fc,
+  0xbba3, 0xa2fd,
+  0xbba4, 0xa341,
+  0xbba5, 0xa342,
+  0xbba6, 0xa343,
+  0xbba7, 0xa344,
+  0xbba8, 0xa345,
+  0xbba9, 0xa346,
+  0xbbaa, 0xa347,
+  0xbbab, 0xa348,
+  0xbbac, 0xa349,
+  0xbbad, 0xa34a,
+  0xbbae, 0xa34b,
+  0xbbaf, 0xa34c,
+  0xbbb0, 0xa34d,
+  0xbbb1, 0xa34e,
+  0xbbb2, 0xa34f,
+  0xbbb3, 0xa350,
+  0xbbb4, 0xa351,
+  0xbbb5, 0xa353,
+  0xbbb6, 0xa354,
+  0xbbb7, 0xa355,
+  0xbbb8, 0xa356,
+  0xbbb9, 0xa357,
+  0xbbba, 0xa358,
+  0xbbbb, 0xa359,
+  0xbbbc, 0xa35a,
+  0xbbbd, 0xa35b,
+  0xbbbe, 0xa35c,
+  0xbbbf, 0xa35d,
+  0xbbc0, 0xa361,
+  0xbbc1, 0xa362,
+  0xbbc2, 0xa363,
+  0xbbc3, 0xa364,
+  0xbbc4, 0xa365,
+  0xbbc5, 0xa366,
+  0xbbc6, 0xa367,
+  0xbbc7, 0xa368,
+  0xbbc8, 0xa369,
+  0xbbc9, 0xa36a,
+  0xbbca, 0xa36b,
+  0xbbcb, 0xa36c,
+  0xbbcc, 0xa36d,
+  0xbbcd, 0xa36e,
+  0xbbce, 0xa36f,
+  0xbbcf, 0xa370,
+  0xbbd0, 0xa371,
+  0xbbd1, 0xa373,
+  0xbbd2, 0xa374,
+  0xbbd3, 0xa375,
+  0xbbd4, 0xa376,
+  0xbbd5, 0xa377,
+  0xbbd6, 0xa378,
+  0xbbd7, 0xa379,
+  0xbbd8, 0xa37a,
+  0xbbd9, 0xa37b,
+  0xbbda, 0xa37c,
+  0xbbdb, 0xa37d,
+  0xbbdc, 0xa381,
+  0xbbdd, 0xa382,
+  0xbbde, 0xa383,
+  0xbbdf, 0xa384,
+  0xbbe0, 0xa385,
+  0xbbe1, 0xa386,
+  0xbbe2, 0xa387,
+  0xbbe3, 0xa388,
+  0xbbe4, 0xa389,
+  0xbbe5, 0xa38a,
+  0xbbe6, 0xa38b,
+  0xbbe7, 0xa38c,
+  0xbbe8, 0xa38d,
+  0xbbe9, 0xa38e,
+  0xbbea, 0xa38f,
+  0xbbeb, 0xa390,
+  0xbbec, 0xa391,
+  0xbbed, 0xa393,
+  0xbbee, 0xa394,
+  0xbbef, 0xa395,
+  0xbbf0, 0xa396,
+  0xbbf1, 0xa397,
+  0xbbf2, 0xa398,
+  0xbbf3, 0xa399,
+  0xbbf4, 0xa39a,
+  0xbbf5, 0xa39b,
+  0xbbf6, 0xa39c,
+  0xbbf7, 0xa39d,
+  0xbbf8, 0xa3a1,
+  0xbbf9, 0xa3a2,
+  0xbbfa, 0xa3a3,
+  0xbbfb, 0xa3a4,
+  0xbbfc, 0xa3a5,
+  0xbbfd, 0xa3a6,
+  0xbbfe, 0xa3a7,
+  0xbbff, 0xa3a8,
+  0xbc00, 0xa3a9,
+  0xbc01, 0xa3aa,
+  0xbc02, 0xa3ab,
+  0xbc03, 0xa3ac,
+  0xbc04, 0xa3ad,
+  0xbc05, 0xa3ae,
+  0xbc06, 0xa3af,
+  0xbc07, 0xa3b0,
+  0xbc08, 0xa3b1,
+  0xbc09, 0xa3b3,
+  0xbc0a, 0xa3b4,
+  0xbc0b, 0xa3b5,
+  0xbc0c, 0xa3b6,
+  0xbc0d, 0xa3b7,
+  0xbc0e, 0xa3b8,
+  0xbc0f, 0xa3b9,
+  0xbc10, 0xa3ba,
+  0xbc11, 0xa3bb,
+  0xbc12, 0xa3bc,
+  0xbc13, 0xa3bd,
+  0xbc14, 0xa461,
+  0xbc15, 0xa462,
+  0xbc16, 0xa463,
+  0xbc17, 0xa464,
+  0xbc18, 0xa465,
+  0xbc19, 0xa466,
+  0xbc1a, 0xa467,
+  0xbc1b, 0xa468,
+  0xbc1c, 0xa469,
+  0xbc1d, 0xa46a,
+  0xbc1e, 0xa46b,
+  0xbc1f, 0xa46c,
+  0xbc20, 0xa46d,
+  0xbc21, 0xa46e,
+  0xbc22, 0xa46f,
+  0xbc23, 0xa470,
+  0xbc24, 0xa471,
+  0xbc25, 0xa473,
+  0xbc26, 0xa474,
+  0xbc27, 0xa475,
+  0xbc28, 0xa476,
+  0xbc29, 0xa477,
+  0xbc2a, 0xa478,
+  0xbc2b, 0xa479,
+  0xbc2c, 0xa47a,
+  0xbc2d, 0xa47b,
+  0xbc2e, 0xa47c,
+  0xbc2f, 0xa47d,
+  0xbc30, 0xa481,
+  0xbc31, 0xa482,
+  0xbc32, 0xa483,
+  0xbc33, 0xa484,
+  0xbc34, 0xa485,
+  0xbc35, 0xa486,
+  0xbc36, 0xa487,
+  0xbc37, 0xa488,
+  0xbc38, 0xa489,
+  0xbc39, 0xa48a,
+  0xbc3a, 0xa48b,
+  0xbc3b, 0xa48c,
+  0xbc3c, 0xa48d,
+  0xbc3d, 0xa48e,
+  0xbc3e, 0xa48f,
+  0xbc3f, 0xa490,
+  0xbc40, 0xa491,
+  0xbc41, 0xa493,
+  0xbc42, 0xa494,
+  0xbc43, 0xa495,
+  0xbc44, 0xa496,
+  0xbc45, 0xa497,
+  0xbc46, 0xa498,
+  0xbc47, 0xa499,
+  0xbc48, 0xa49a,
+  0xbc49, 0xa49b,
+  0xbc4a, 0xa49c,
+  0xbc4b, 0xa49d,
+  0xbc4c, 0xa4a1,
+  0xbc4d, 0xa4a2,
+  0xbc4e, 0xa4a3,
+  0xbc4f, 0xa4a4,
+  0xbc50, 0xa4a5,
+  0xbc51, 0xa4a6,
+  0xbc52, 0xa4a7,
+  0xbc53, 0xa4a8,
+  0xbc54, 0xa4a9,
+  0xbc55, 0xa4aa,
+  0xbc56, 0xa4ab,
+  0xbc57, 0xa4ac,
+  0xbc58, 0xa4ad,
+  0xbc59, 0xa4ae,
+  0xbc5a, 0xa4af,
+  0xbc5b, 0xa4b0,
+  0xbc5c, 0xa4b1,
+  0xbc5d, 0xa4b3,
+  0xbc5e, 0xa4b4,
+  0xbc5f, 0xa4b5,
+  0xbc60, 0xa4b6,
+  0xbc61, 0xa4b7,
+  0xbc62, 0xa4b8,
+  0xbc63, 0xa4b9,
+  0xbc64, 0xa4ba,
+  0xbc65, 0xa4bb,
+  0xbc66, 0xa4bc,
+  0xbc67, 0xa4bd,
+  0xbc68, 0xa4c1,
+  0xbc69, 0xa4c2,
+  0xbc6a, 0xa4c3,
+  0xbc6b, 0xa4c4,
+  0xbc6c, 0xa4c5,
+  0xbc6d, 0xa4c6,
+  0xbc6e, 0xa4c7,
+  0xbc6f, 0xa4c8,
+  0xbc70, 0xa4c9,
+  0xbc71, 0xa4ca,
+  0xbc72, 0xa4cb,
+  0xbc73, 0xa4cc,
+  0xbc74, 0xa4cd,
+  0xbc75, 0xa4ce,
+  0xbc76, 0xa4cf,
+  0xbc77, 0xa4d0,
+  0xbc78, 0xa4d1,
+  0xbc79, 0xa4d3,
+  0xbc7a, 0xa4d4,
+  0xbc7b, 0xa4d5,
+  0xbc7c, 0xa4d6,
+  0xbc7d, 0xa4d7,
+  0xbc7e, 0xa4d8,
+  0xbc7f, 0xa4d9,
+  0xbc80, 0xa4da,
+  0xbc81, 0xa4db,
+  0xbc82, 0xa4dc,
+  0xbc83, 0xa4dd,
+  0xbc84, 0xa4e1,
+  0xbc85, 0xa4e2,
+  0xbc86, 0xa4e3,
+  0xbc87, 0xa4e4,
+  0xbc88, 0xa4e5,
+  0xbc89, 0xa4e6,
+  0xbc8a, 0xa4e7,
+  0xbc8b, 0xa4e8,
+  0xbc8c, 0xa4e9,
+  0xbc8d, 0xa4ea,
+  0xbc8e, 0xa4eb,
+  0xbc8f, 0xa4ec,
+  0xbc90, 0xa4ed,
+  0xbc91, 0xa4ee,
+  0xbc92, 0xa4ef,
+  0xbc93, 0xa4f0,
+  0xbc94, 0xa4f1,
+  0xbc95, 0xa4f3,
+  0xbc96, 0xa4f4,
+  0xbc97, 0xa4f5,
+  0xbc98, 0xa4f6,
+  0xbc99, 0xa4f7,
+  0xbc9a, 0xa4f8,
+  0xbc9b, 0xa4f9,
+  0xbc9c, 0xa4fa,
+  0xbc9d, 0xa4fb,
+  0xbc9e, 0xa4fc,
+  0xbc9f, 0xa4fd,
+  0xbca0, 0xa541,
+  0xbca1, 0xa542,
+  0xbca2, 0xa543,
+  0xbca3, 0xa544,
+  0xbca4, 0xa545,
+  0xbca5, 0xa546,
+  0xbca6, 0xa547,
+  0xbca7, 0xa548,
+  0xbca8, 0xa549,
+  0xbca9, 0xa54a,
+  0xbcaa, 0xa54b,
+  0xbcab, 0xa54c,
+  0xbcac, 0xa54d,
+  0xbcad, 0xa54e,
+  0xbcae, 0xa54f,
+  0xbcaf, 0xa550,
+  0xbcb0, 0xa551,
+  0xbcb1, 0xa553,
+  0xbcb2, 0xa554,
+  0xbcb3, 0xa555,
+  0xbcb4, 0xa556,
+  0xbcb5, 0xa557,
+  0xbcb6, 0xa558,
+  0xbcb7, 0xa559,
+  0xbcb8, 0xa55a,
+  0xbcb9, 0xa55b,
+  0xbcba, 0xa55c,
+  0xbcbb, 0xa55d,
+  0xbcbc, 0xa561,
+  0xbcbd, 0xa562,
+  0xbcbe, 0xa563,
+  0xbcbf, 0xa564,
+  0xbcc0, 0xa565,
+  0xbcc1, 0xa566,
+  0xbcc2, 0xa567,
+  0xbcc3, 0xa568,
+  0xbcc4, 0xa569,
+  0xbcc5, 0xa56a,
+  0xbcc6, 0xa56b,
+  0xbcc7, 0xa56c,
+  0xbcc8, 0xa56d,
+  0xbcc9, 0xa56e,
+  0xbcca, 0xa56f,
+  0xbccb, 0xa570,
+  0xbccc, 0xa571,
+  0xbccd, 0xa573,
+  0xbcce, 0xa574,
+  0xbccf, 0xa575,
+  0xbcd0, 0xa576,
+  0xbcd1, 0xa577,
+  0xbcd2, 0xa578,
+  0xbcd3, 0xa579,
+  0xbcd4, 0xa57a,
+  0xbcd5, 0xa57b,
+  0xbcd6, 0xa57c,
+  0xbcd7, 0xa57d,
+  0xbcd8, 0xa581,
+  0xbcd9, 0xa582,
+  0xbcda, 0xa583,
+  0xbcdb, 0xa584,
+  0xbcdc, 0xa585,
+  0xbcdd, 0xa586,
+  0xbcde, 0xa587,
+  0xbcdf, 0xa588,
+  0xbce0, 0xa589,
+  0xbce1, 0xa58a,
+  0xbce2, 0xa58b,
+  0xbce3, 0xa58c,
+  0xbce4, 0xa58d,
+  0xbce5, 0xa58e,
+  0xbce6, 0xa58f,
+  0xbce7, 0xa590,
+  0xbce8, 0xa591,
+  0xbce9, 0xa593,
+  0xbcea, 0xa594,
+  0xbceb, 0xa595,
+  0xbcec, 0xa596,
+  0xbced, 0xa597,
+  0xbcee, 0xa598,
+  0xbcef, 0xa599,
+  0xbcf0, 0xa59a,
+  0xbcf1, 0xa59b,
+  0xbcf2, 0xa59c,
+  0xbcf3, 0xa59d,
+  0xbcf4, 0xa5a1,
+  0xbcf5, 0xa5a2,
+  0xbcf6, 0xa5a3,
+  0xbcf7, 0xa5a4,
+  0xbcf8, 0xa5a5,
+  0xbcf9, 0xa5a6,
+  0xbcfa, 0xa5a7,
+  0xbcfb, 0xa5a8,
+  0xbcfc, 0xa5a9,
+  0xbcfd, 0xa5aa,
+  0xbcfe, 0xa5ab,
+  0xbcff, 0xa5ac,
+  0xbd00, 0xa5ad,
+  0xbd01, 0xa5ae,
+  0xbd02, 0xa5af,
+  0xbd03, 0xa5b0,
+  0xbd04, 0xa5b1,
+  0xbd05, 0xa5b3,
+  0xbd06, 0xa5b4,
+  0xbd07, 0xa5b5,
+  0xbd08, 0xa5b6,
+  0xbd09, 0xa5b7,
+  0xbd0a, 0xa5b8,
+  0xbd0b, 0xa5b9,
+  0xbd0c, 0xa5ba,
+  0xbd0d, 0xa5bb,
+  0xbd0e, 0xa5bc,
+  0xbd0f, 0xa5bd,
+  0xbd10, 0xa5c1,
+  0xbd11, 0xa5c2,
+  0xbd12, 0xa5c3,
+  0xbd13, 0xa5c4,
+  0xbd14, 0xa5c5,
+  0xbd15, 0xa5c6,
+  0xbd16, 0xa5c7,
+  0xbd17, 0xa5c8,
+  0xbd18, 0xa5c9,
+  0xbd19, 0xa5ca,
+  0xbd1a, 0xa5cb,
+  0xbd1b, 0xa5cc,
+  0xbd1c, 0xa5cd,
+  0xbd1d, 0xa5ce,
+  0xbd1e, 0xa5cf,
+  0xbd1f, 0xa5d0,
+  0xbd20, 0xa5d1,
+  0xbd21, 0xa5d3,
+  0xbd22, 0xa5d4,
+  0xbd23, 0xa5d5,
+  0xbd24, 0xa5d6,
+  0xbd25, 0xa5d7,
+  0xbd26, 0xa5d8,
+  0xbd27, 0xa5d9,
+  0xbd28, 0xa5da,
+  0xbd29, 0xa5db,
+  0xbd2a, 0xa5dc,
+  0xbd2b, 0xa5dd,
+  0xbd2c, 0xa5e1,
+  0xbd2d, 0xa5e2,
+  0xbd2e, 0xa5e3,
+  0xbd2f, 0xa5e4,
+  0xbd30, 0xa5e5,
+  0xbd31, 0xa5e6,
+  0xbd32, 0xa5e7,
+  0xbd33, 0xa5e8,
+  0xbd34, 0xa5e9,
+  0xbd35, 0xa5ea,
+  0xbd36, 0xa5eb,
+  0xbd37, 0xa5ec,
+  0xbd38, 0xa5ed,
+  0xbd39, 0xa5ee,
+  0xbd3a, 0xa5ef,
+  0xbd3b, 0xa5f0,
+  0xbd3c, 0xa5f1,
+  0xbd3d, 0xa5f3,
+  0xbd3e, 0xa5f4,
+  0xbd3f, 0xa5f5,
+  0xbd40, 0xa5f6,
+  0xbd41, 0xa5f7,
+  0xbd42, 0xa5f8,
+  0xbd43, 0xa5f9,
+  0xbd44, 0xa5fa,
+  0xbd45, 0xa5fb,
+  0xbd46, 0xa5fc,
+  0xbd47, 0xa5fd,
+  0xbd48, 0xa641,
+  0xbd49, 0xa642,
+  0xbd4a, 0xa643,
+  0xbd4b, 0xa644,
+  0xbd4c, 0xa645,
+  0xbd4d, 0xa646,
+  0xbd4e, 0xa647,
+  0xbd4f, 0xa648,
+  0xbd50, 0xa649,
+  0xbd51, 0xa64a,
+  0xbd52, 0xa64b,
+  0xbd53, 0xa64c,
+  0xbd54, 0xa64d,
+  0xbd55, 0xa64e,
+  0xbd56, 0xa64f,
+  0xbd57, 0xa650,
+  0xbd58, 0xa651,
+  0xbd59, 0xa653,
+  0xbd5a, 0xa654,
+  0xbd5b, 0xa655,
+  0xbd5c, 0xa656,
+  0xbd5d, 0xa657,
+  0xbd5e, 0xa658,
+  0xbd5f, 0xa659,
+  0xbd60, 0xa65a,
+  0xbd61, 0xa65b,
+  0xbd62, 0xa65c,
+  0xbd63, 0xa65d,
+  0xbd64, 0xa661,
+  0xbd65, 0xa662,
+  0xbd66, 0xa663,
+  0xbd67, 0xa664,
+  0xbd68, 0xa665,
+  0xbd69, 0xa666,
+  0xbd6a, 0xa667,
+  0xbd6b, 0xa668,
+  0xbd6c, 0xa669,
+  0xbd6d, 0xa66a,
+  0xbd6e, 0xa66b,
+  0xbd6f, 0xa66c,
+  0xbd70, 0xa66d,
+  0xbd71, 0xa66e,
+  0xbd72, 0xa66f,
+  0xbd73, 0xa670,
+  0xbd74, 0xa671,
+  0xbd75, 0xa673,
+  0xbd76, 0xa674,
+  0xbd77, 0xa675,
+  0xbd78, 0xa676,
+  0xbd79, 0xa677,
+  0xbd7a, 0xa678,
+  0xbd7b, 0xa679,
+  0xbd7c, 0xa67a,
+  0xbd7d, 0xa67b,
+  0xbd7e, 0xa67c,
+  0xbd7f, 0xa67d,
+  0xbd80, 0xa681,
+  0xbd81, 0xa682,
+  0xbd82, 0xa683,
+  0xbd83, 0xa684,
+  0xbd84, 0xa685,
+  0xbd85, 0xa686,
+  0xbd86, 0xa687,
+  0xbd87, 0xa688,
+  0xbd88, 0xa689,
+  0xbd89, 0xa68a,
+  0xbd8a, 0xa68b,
+  0xbd8b, 0xa68c,
+  0xbd8c, 0xa68d,
+  0xbd8d, 0xa68e,
+  0xbd8e, 0xa68f,
+  0xbd8f, 0xa690,
+  0xbd90, 0xa691,
+  0xbd91, 0xa693,
+  0xbd92, 0xa694,
+  0xbd93, 0xa695,
+  0xbd94, 0xa696,
+  0xbd95, 0xa697,
+  0xbd96, 0xa698,
+  0xbd97, 0xa699,
+  0xbd98, 0xa69a,
+  0xbd99, 0xa69b,
+  0xbd9a, 0xa69c,
+  0xbd9b, 0xa69d,
+  0xbd9c, 0xa6a1,
+  0xbd9d, 0xa6a2,
+  0xbd9e, 0xa6a3,
+  0xbd9f, 0xa6a4,
+  0xbda0, 0xa6a5,
+  0xbda1, 0xa6a6,
+  0xbda2, 0xa6a7,
+  0xbda3, 0xa6a8,
+  0xbda4, 0xa6a9,
+  0xbda5, 0xa6aa,
+  0xbda6, 0xa6ab,
+  0xbda7, 0xa6ac,
+  0xbda8, 0xa6ad,
+  0xbda9, 0xa6ae,
+  0xbdaa, 0xa6af,
+  0xbdab, 0xa6b0,
+  0xbdac, 0xa6b1,
+  0xbdad, 0xa6b3,
+  0xbdae, 0xa6b4,
+  0xbdaf, 0xa6b5,
+  0xbdb0, 0xa6b6,
+  0xbdb1, 0xa6b7,
+  0xbdb2, 0xa6b8,
+  0xbdb3, 0xa6b9,
+  0xbdb4, 0xa6ba,
+  0xbdb5, 0xa6bb,
+  0xbdb6, 0xa6bc,
+  0xbdb7, 0xa6bd,
+  0xbdb8, 0xa6c1,
+  0xbdb9, 0xa6c2,
+  0xbdba, 0xa6c3,
+  0xbdbb, 0xa6c4,
+  0xbdbc, 0xa6c5,
+  0xbdbd, 0xa6c6,
+  0xbdbe, 0xa6c7,
+  0xbdbf, 0xa6c8,
+  0xbdc0, 0xa6c9,
+  0xbdc1, 0xa6ca,
+  0xbdc2, 0xa6cb,
+  0xbdc3, 0xa6cc,
+  0xbdc4, 0xa6cd,
+  0xbdc5, 0xa6ce,
+  0xbdc6, 0xa6cf,
+  0xbdc7, 0xa6d0,
+  0xbdc8, 0xa6d1,
+  0xbdc9, 0xa6d3,
+  0xbdca, 0xa6d4,
+  0xbdcb, 0xa6d5,
+  0xbdcc, 0xa6d6,
+  0xbdcd, 0xa6d7,
+  0xbdce, 0xa6d8,
+  0xbdcf, 0xa6d9,
+  0xbdd0, 0xa6da,
+  0xbdd1, 0xa6db,
+  0xbdd2, 0xa6dc,
+  0xbdd3, 0xa6dd,
+  0xbdd4, 0xa6e1,
+  0xbdd5, 0xa6e2,
+  0xbdd6, 0xa6e3,
+  0xbdd7, 0xa6e4,
+  0xbdd8, 0xa6e5,
+  0xbdd9, 0xa6e6,
+  0xbdda, 0xa6e7,
+  0xbddb, 0xa6e8,
+  0xbddc, 0xa6e9,
+  0xbddd, 0xa6ea,
+  0xbdde, 0xa6eb,
+  0xbddf, 0xa6ec,
+  0xbde0, 0xa6ed,
+  0xbde1, 0xa6ee,
+  0xbde2, 0xa6ef,
+  0xbde3, 0xa6f0,
+  0xbde4, 0xa6f1,
+  0xbde5, 0xa6f3,
+  0xbde6, 0xa6f4,
+  0xbde7, 0xa6f5,
+  0xbde8, 0xa6f6,
+  0xbde9, 0xa6f7,
+  0xbdea, 0xa6f8,
+  0xbdeb, 0xa6f9,
+  0xbdec, 0xa6fa,
+  0xbded, 0xa6fb,
+  0xbdee, 0xa6fc,
+  0xbdef, 0xa6fd,
+  0xbdf0, 0xa741,
+  0xbdf1, 0xa742,
+  0xbdf2, 0xa743,
+  0xbdf3, 0xa744,
+  0xbdf4, 0xa745,
+  0xbdf5, 0xa746,
+  0xbdf6, 0xa747,
+  0xbdf7, 0xa748,
+  0xbdf8, 0xa749,
+  0xbdf9, 0xa74a,
+  0xbdfa, 0xa74b,
+  0xbdfb, 0xa74c,
+  0xbdfc, 0xa74d,
+  0xbdfd, 0xa74e,
+  0xbdfe, 0xa74f,
+  0xbdff, 0xa750,
+  0xbe00, 0xa751,
+  0xbe01, 0xa753,
+  0xbe02, 0xa754,
+  0xbe03, 0xa755,
+  0xbe04, 0xa756,
+  0xbe05, 0xa757,
+  0xbe06, 0xa758,
+  0xbe07, 0xa759,
+  0xbe08, 0xa75a,
+  0xbe09, 0xa75b,
+  0xbe0a, 0xa75c,
+  0xbe0b, 0xa75d,
+  0xbe0c, 0xa761,
+  0xbe0d, 0xa762,
+  0xbe0e, 0xa763,
+  0xbe0f, 0xa764,
+  0xbe10, 0xa765,
+  0xbe11, 0xa766,
+  0xbe12, 0xa767,
+  0xbe13, 0xa768,
+  0xbe14, 0xa769,
+  0xbe15, 0xa76a,
+  0xbe16, 0xa76b,
+  0xbe17, 0xa76c,
+  0xbe18, 0xa76d,
+  0xbe19, 0xa76e,
+  0xbe1a, 0xa76f,
+  0xbe1b, 0xa770,
+  0xbe1c, 0xa771,
+  0xbe1d, 0xa773,
+  0xbe1e, 0xa774,
+  0xbe1f, 0xa775,
+  0xbe20, 0xa776,
+  0xbe21, 0xa777,
+  0xbe22, 0xa778,
+  0xbe23, 0xa779,
+  0xbe24, 0xa77a,
+  0xbe25, 0xa77b,
+  0xbe26, 0xa77c,
+  0xbe27, 0xa77d,
+  0xbe28, 0xa781,
+  0xbe29, 0xa782,
+  0xbe2a, 0xa783,
+  0xbe2b, 0xa784,
+  0xbe2c, 0xa785,
+  0xbe2d, 0xa786,
+  0xbe2e, 0xa787,
+  0xbe2f, 0xa788,
+  0xbe30, 0xa789,
+  0xbe31, 0xa78a,
+  0xbe32, 0xa78b,
+  0xbe33, 0xa78c,
+  0xbe34, 0xa78d,
+  0xbe35, 0xa78e,
+  0xbe36, 0xa78f,
+  0xbe37, 0xa790,
+  0xbe38, 0xa791,
+  0xbe39, 0xa793,
+  0xbe3a, 0xa794,
+  0xbe3b, 0xa795,
+  0xbe3c, 0xa796,
+  0xbe3d, 0xa797,
+  0xbe3e, 0xa798,
+  0xbe3f, 0xa799,
+  0xbe40, 0xa79a,
+  0xbe41, 0xa79b,
+  0xbe42, 0xa79c,
+  0xbe43, 0xa79d,
+  0xbe44, 0xa7a1,
+  0xbe45, 0xa7a2,
+  0xbe46, 0xa7a3,
+  0xbe47, 0xa7a4,
+  0xbe48, 0xa7a5,
+  0xbe49, 0xa7a6,
+  0xbe4a, 0xa7a7,
+  0xbe4b, 0xa7a8,
+  0xbe4c, 0xa7a9,
+  0xbe4d, 0xa7aa,
+  0xbe4e, 0xa7ab,
+  0xbe4f, 0xa7ac,
+  0xbe50, 0xa7ad,
+  0xbe51, 0xa7ae,
+  0xbe52, 0xa7af,
+  0xbe53, 0xa7b0,
+  0xbe54, 0xa7b1,
+  0xbe55, 0xa7b3,
+  0xbe56, 0xa7b4,
+  0xbe57, 0xa7b5,
+  0xbe58, 0xa7b6,
+  0xbe59, 0xa7b7,
+  0xbe5a, 0xa7b8,
+  0xbe5b, 0xa7b9,
+  0xbe5c, 0xa7ba,
+  0xbe5d, 0xa7bb,
+  0xbe5e, 0xa7bc,
+  0xbe5f, 0xa7bd,
+  0xbe60, 0xa861,
+  0xbe61, 0xa862,
+  0xbe62, 0xa863,
+  0xbe63, 0xa864,
+  0xbe64, 0xa865,
+  0xbe65, 0xa866,
+  0xbe66, 0xa867,
+  0xbe67, 0xa868,
+  0xbe68, 0xa869,
+  0xbe69, 0xa86a,
+  0xbe6a, 0xa86b,
+  0xbe6b, 0xa86c,
+  0xbe6c, 0xa86d,
+  0xbe6d, 0xa86e,
+  0xbe6e, 0xa86f,
+  0xbe6f, 0xa870,
+  0xbe70, 0xa871,
+  0xbe71, 0xa873,
+  0xbe72, 0xa874,
+  0xbe73, 0xa875,
+  0xbe74, 0xa876,
+  0xbe75, 0xa877,
+  0xbe76, 0xa878,
+  0xbe77, 0xa879,
+  0xbe78, 0xa87a,
+  0xbe79, 0xa87b,
+  0xbe7a, 0xa87c,
+  0xbe7b, 0xa87d,
+  0xbe7c, 0xa881,
+  0xbe7d, 0xa882,
+  0xbe7e, 0xa883,
+  0xbe7f, 0xa884,
+  0xbe80, 0xa885,
+  0xbe81, 0xa886,
+  0xbe82, 0xa887,
+  0xbe83, 0xa888,
+  0xbe84, 0xa889,
+  0xbe85, 0xa88a,
+  0xbe86, 0xa88b,
+  0xbe87, 0xa88c,
+  0xbe88, 0xa88d,
+  0xbe89, 0xa88e,
+  0xbe8a, 0xa88f,
+  0xbe8b, 0xa890,
+  0xbe8c, 0xa891,
+  0xbe8d, 0xa893,
+  0xbe8e, 0xa894,
+  0xbe8f, 0xa895,
+  0xbe90, 0xa896,
+  0xbe91, 0xa897,
+  0xbe92, 0xa898,
+  0xbe93, 0xa899,
+  0xbe94, 0xa89a,
+  0xbe95, 0xa89b,
+  0xbe96, 0xa89c,
+  0xbe97, 0xa89d,
+  0xbe98, 0xa8a1,
+  0xbe99, 0xa8a2,
+  0xbe9a, 0xa8a3,
+  0xbe9b, 0xa8a4,
+  0xbe9c, 0xa8a5,
+  0xbe9d, 0xa8a6,
+  0xbe9e, 0xa8a7,
+  0xbe9f, 0xa8a8,
+  0xbea0, 0xa8a9,
+  0xbea1, 0xa8aa,
+  0xbea2, 0xa8ab,
+  0xbea3, 0xa8ac,
+  0xbea4, 0xa8ad,
+  0xbea5, 0xa8ae,
+  0xbea6, 0xa8af,
+  0xbea7, 0xa8b0,
+  0xbea8, 0xa8b1,
+  0xbea9, 0xa8b3,
+  0xbeaa, 0xa8b4,
+  0xbeab, 0xa8b5,
+  0xbeac, 0xa8b6,
+  0xbead, 0xa8b7,
+  0xbeae, 0xa8b8,
+  0xbeaf, 0xa8b9,
+  0xbeb0, 0xa8ba,
+  0xbeb1, 0xa8bb,
+  0xbeb2, 0xa8bc,
+  0xbeb3, 0xa8bd,
+  0xbeb4, 0xa8c1,
+  0xbeb5, 0xa8c2,
+  0xbeb6, 0xa8c3,
+  0xbeb7, 0xa8c4,
+  0xbeb8, 0xa8c5,
+  0xbeb9, 0xa8c6,
+  0xbeba, 0xa8c7,
+  0xbebb, 0xa8c8,
+  0xbebc, 0xa8c9,
+  0xbebd, 0xa8ca,
+  0xbebe, 0xa8cb,
+  0xbebf, 0xa8cc,
+  0xbec0, 0xa8cd,
+  0xbec1, 0xa8ce,
+  0xbec2, 0xa8cf,
+  0xbec3, 0xa8d0,
+  0xbec4, 0xa8d1,
+  0xbec5, 0xa8d3,
+  0xbec6, 0xa8d4,
+  0xbec7, 0xa8d5,
+  0xbec8, 0xa8d6,
+  0xbec9, 0xa8d7,
+  0xbeca, 0xa8d8,
+  0xbecb, 0xa8d9,
+  0xbecc, 0xa8da,
+  0xbecd, 0xa8db,
+  0xbece, 0xa8dc,
+  0xbecf, 0xa8dd,
+  0xbed0, 0xa8e1,
+  0xbed1, 0xa8e2,
+  0xbed2, 0xa8e3,
+  0xbed3, 0xa8e4,
+  0xbed4, 0xa8e5,
+  0xbed5, 0xa8e6,
+  0xbed6, 0xa8e7,
+  0xbed7, 0xa8e8,
+  0xbed8, 0xa8e9,
+  0xbed9, 0xa8ea,
+  0xbeda, 0xa8eb,
+  0xbedb, 0xa8ec,
+  0xbedc, 0xa8ed,
+  0xbedd, 0xa8ee,
+  0xbede, 0xa8ef,
+  0xbedf, 0xa8f0,
+  0xbee0, 0xa8f1,
+  0xbee1, 0xa8f3,
+  0xbee2, 0xa8f4,
+  0xbee3, 0xa8f5,
+  0xbee4, 0xa8f6,
+  0xbee5, 0xa8f7,
+  0xbee6, 0xa8f8,
+  0xbee7, 0xa8f9,
+  0xbee8, 0xa8fa,
+  0xbee9, 0xa8fb,
+  0xbeea, 0xa8fc,
+  0xbeeb, 0xa8fd,
+  0xbeec, 0xa941,
+  0xbeed, 0xa942,
+  0xbeee, 0xa943,
+  0xbeef, 0xa944,
+  0xbef0, 0xa945,
+  0xbef1, 0xa946,
+  0xbef2, 0xa947,
+  0xbef3, 0xa948,
+  0xbef4, 0xa949,
+  0xbef5, 0xa94a,
+  0xbef6, 0xa94b,
+  0xbef7, 0xa94c,
+  0xbef8, 0xa94d,
+  0xbef9, 0xa94e,
+  0xbefa, 0xa94f,
+  0xbefb, 0xa950,
+  0xbefc, 0xa951,
+  0xbefd, 0xa953,
+  0xbefe, 0xa954,
+  0xbeff, 0xa955,
+  0xbf00, 0xa956,
+  0xbf01, 0xa957,
+  0xbf02, 0xa958,
+  0xbf03, 0xa959,
+  0xbf04, 0xa95a,
+  0xbf05, 0xa95b,
+  0xbf06, 0xa95c,
+  0xbf07, 0xa95d,
+  0xbf08, 0xa961,
+  0xbf09, 0xa962,
+  0xbf0a, 0xa963,
+  0xbf0b, 0xa964,
+  0xbf0c, 0xa965,
+  0xbf0d, 0xa966,
+  0xbf0e, 0xa967,
+  0xbf0f, 0xa968,
+  0xbf10, 0xa969,
+  0xbf11, 0xa96a,
+  0xbf12, 0xa96b,
+  0xbf13, 0xa96c,
+  0xbf14, 0xa96d,
+  0xbf15, 0xa96e,
+  0xbf16, 0xa96f,
+  0xbf17, 0xa970,
+  0xbf18, 0xa971,
+  0xbf19, 0xa973,
+  0xbf1a, 0xa974,
+  0xbf1b, 0xa975,
+  0xbf1c, 0xa976,
+  0xbf1d, 0xa977,
+  0xbf1e, 0xa978,
+  0xbf1f, 0xa979,
+  0xbf20, 0xa97a,
+  0xbf21, 0xa97b,
+  0xbf22, 0xa97c,
+  0xbf23, 0xa97d,
+  0xbf24, 0xa981,
+  0xbf25, 0xa982,
+  0xbf26, 0xa983,
+  0xbf27, 0xa984,
+  0xbf28, 0xa985,
+  0xbf29, 0xa986,
+  0xbf2a, 0xa987,
+  0xbf2b, 0xa988,
+  0xbf2c, 0xa989,
+  0xbf2d, 0xa98a,
+  0xbf2e, 0xa98b,
+  0xbf2f, 0xa98c,
+  0xbf30, 0xa98d,
+  0xbf31, 0xa98e,
+  0xbf32, 0xa98f,
+  0xbf33, 0xa990,
+  0xbf34, 0xa991,
+  0xbf35, 0xa993,
+  0xbf36, 0xa994,
+  0xbf37, 0xa995,
+  0xbf38, 0xa996,
+  0xbf39, 0xa997,
+  0xbf3a, 0xa998,
+  0xbf3b, 0xa999,
+  0xbf3c, 0xa99a,
+  0xbf3d, 0xa99b,
+  0xbf3e, 0xa99c,
+  0xbf3f, 0xa99d,
+  0xbf40, 0xa9a1,
+  0xbf41, 0xa9a2,
+  0xbf42, 0xa9a3,
+  0xbf43, 0xa9a4,
+  0xbf44, 0xa9a5,
+  0xbf45, 0xa9a6,
+  0xbf46, 0xa9a7,
+  0xbf47, 0xa9a8,
+  0xbf48, 0xa9a9,
+  0xbf49, 0xa9aa,
+  0xbf4a, 0xa9ab,
+  0xbf4b, 0xa9ac,
+  0xbf4c, 0xa9ad,
+  0xbf4d, 0xa9ae,
+  0xbf4e, 0xa9af,
+  0xbf4f, 0xa9b0,
+  0xbf50, 0xa9b1,
+  0xbf51, 0xa9b3,
+  0xbf52, 0xa9b4,
+  0xbf53, 0xa9b5,
+  0xbf54, 0xa9b6,
+  0xbf55, 0xa9b7,
+  0xbf56, 0xa9b8,
+  0xbf57, 0xa9b9,
+  0xbf58, 0xa9ba,
+  0xbf59, 0xa9bb,
+  0xbf5a, 0xa9bc,
+  0xbf5b, 0xa9bd,
+  0xbf5c, 0xa9c1,
+  0xbf5d, 0xa9c2,
+  0xbf5e, 0xa9c3,
+  0xbf5f, 0xa9c4,
+  0xbf60, 0xa9c5,
+  0xbf61, 0xa9c6,
+  0xbf62, 0xa9c7,
+  0xbf63, 0xa9c8,
+  0xbf64, 0xa9c9,
+  0xbf65, 0xa9ca,
+  0xbf66, 0xa9cb,
+  0xbf67, 0xa9cc,
+  0xbf68, 0xa9cd,
+  0xbf69, 0xa9ce,
+  0xbf6a, 0xa9cf,
+  0xbf6b, 0xa9d0,
+  0xbf6c, 0xa9d1,
+  0xbf6d, 0xa9d3,
+  0xbf6e, 0xa9d4,
+  0xbf6f, 0xa9d5,
+  0xbf70, 0xa9d6,
+  0xbf71, 0xa9d7,
+  0xbf72, 0xa9d8,
+  0xbf73, 0xa9d9,
+  0xbf74, 0xa9da,
+  0xbf75, 0xa9db,
+  0xbf76, 0xa9dc,
+  0xbf77, 0xa9dd,
+  0xbf78, 0xa9e1,
+  0xbf79, 0xa9e2,
+  0xbf7a, 0xa9e3,
+  0xbf7b, 0xa9e4,
+  0xbf7c, 0xa9e5,
+  0xbf7d, 0xa9e6,
+  0xbf7e, 0xa9e7,
+  0xbf7f, 0xa9e8,
+  0xbf80, 0xa9e9,
+  0xbf81, 0xa9ea,
+  0xbf82, 0xa9eb,
+  0xbf83, 0xa9ec,
+  0xbf84, 0xa9ed,
+  0xbf85, 0xa9ee,
+  0xbf86, 0xa9ef,
+  0xbf87, 0xa9f0,
+  0xbf88, 0xa9f1,
+  0xbf89, 0xa9f3,
+  0xbf8a, 0xa9f4,
+  0xbf8b, 0xa9f5,
+  0xbf8c, 0xa9f6,
+  0xbf8d, 0xa9f7,
+  0xbf8e, 0xa9f8,
+  0xbf8f, 0xa9f9,
+  0xbf90, 0xa9fa,
+  0xbf91, 0xa9fb,
+  0xbf92, 0xa9fc,
+  0xbf93, 0xa9fd,
+  0xbf94, 0xaa41,
+  0xbf95, 0xaa42,
+  0xbf96, 0xaa43,
+  0xbf97, 0xaa44,
+  0xbf98, 0xaa45,
+  0xbf99, 0xaa46,
+  0xbf9a, 0xaa47,
+  0xbf9b, 0xaa48,
+  0xbf9c, 0xaa49,
+  0xbf9d, 0xaa4a,
+  0xbf9e, 0xaa4b,
+  0xbf9f, 0xaa4c,
+  0xbfa0, 0xaa4d,
+  0xbfa1, 0xaa4e,
+  0xbfa2, 0xaa4f,
+  0xbfa3, 0xaa50,
+  0xbfa4, 0xaa51,
+  0xbfa5, 0xaa53,
+  0xbfa6, 0xaa54,
+  0xbfa7, 0xaa55,
+  0xbfa8, 0xaa56,
+  0xbfa9, 0xaa57,
+  0xbfaa, 0xaa58,
+  0xbfab, 0xaa59,
+  0xbfac, 0xaa5a,
+  0xbfad, 0xaa5b,
+  0xbfae, 0xaa5c,
+  0xbfaf, 0xaa5d,
+  0xbfb0, 0xaa61,
+  0xbfb1, 0xaa62,
+  0xbfb2, 0xaa63,
+  0xbfb3, 0xaa64,
+  0xbfb4, 0xaa65,
+  0xbfb5, 0xaa66,
+  0xbfb6, 0xaa67,
+  0xbfb7, 0xaa68,
+  0xbfb8, 0xaa69,
+  0xbfb9, 0xaa6a,
+  0xbfba, 0xaa6b,
+  0xbfbb, 0xaa6c,
+  0xbfbc, 0xaa6d,
+  0xbfbd, 0xaa6e,
+  0xbfbe, 0xaa6f,
+  0xbfbf, 0xaa70,
+  0xbfc0, 0xaa71,
+  0xbfc1, 0xaa73,
+  0xbfc2, 0xaa74,
+  0xbfc3, 0xaa75,
+  0xbfc4, 0xaa76,
+  0xbfc5, 0xaa77,
+  0xbfc6, 0xaa78,
+  0xbfc7, 0xaa79,
+  0xbfc8, 0xaa7a,
+  0xbfc9, 0xaa7b,
+  0xbfca, 0xaa7c,
+  0xbfcb, 0xaa7d,
+  0xbfcc, 0xaa81,
+  0xbfcd, 0xaa82,
+  0xbfce, 0xaa83,
+  0xbfcf, 0xaa84,
+  0xbfd0, 0xaa85,
+  0xbfd1, 0xaa86,
+  0xbfd2, 0xaa87,
+  0xbfd3, 0xaa88,
+  0xbfd4, 0xaa89,
+  0xbfd5, 0xaa8a,
+  0xbfd6, 0xaa8b,
+  0xbfd7, 0xaa8c,
+  0xbfd8, 0xaa8d,
+  0xbfd9, 0xaa8e,
+  0xbfda, 0xaa8f,
+  0xbfdb, 0xaa90,
+  0xbfdc, 0xaa91,
+  0xbfdd, 0xaa93,
+  0xbfde, 0xaa94,
+  0xbfdf, 0xaa95,
+  0xbfe0, 0xaa96,
+  0xbfe1, 0xaa97,
+  0xbfe2, 0xaa98,
+  0xbfe3, 0xaa99,
+  0xbfe4, 0xaa9a,
+  0xbfe5, 0xaa9b,
+  0xbfe6, 0xaa9c,
+  0xbfe7, 0xaa9d,
+  0xbfe8, 0xaaa1,
+  0xbfe9, 0xaaa2,
+  0xbfea, 0xaaa3,
+  0xbfeb, 0xaaa4,
+  0xbfec, 0xaaa5,
+  0xbfed, 0xaaa6,
+  0xbfee, 0xaaa7,
+  0xbfef, 0xaaa8,
+  0xbff0, 0xaaa9,
+  0xbff1, 0xaaaa,
+  0xbff2, 0xaaab,
+  0xbff3, 0xaaac,
+  0xbff4, 0xaaad,
+  0xbff5, 0xaaae,
+  0xbff6, 0xaaaf,
+  0xbff7, 0xaab0,
+  0xbff8, 0xaab1,
+  0xbff9, 0xaab3,
+  0xbffa, 0xaab4,
+  0xbffb, 0xaab5,
+  0xbffc, 0xaab6,
+  0xbffd, 0xaab7,
+  0xbffe, 0xaab8,
+  0xbfff, 0xaab9,
+  0xc000, 0xaaba,
+  0xc001, 0xaabb,
+  0xc002, 0xaabc,
+  0xc003, 0xaabd,
+  0xc004, 0xaac1,
+  0xc005, 0xaac2,
+  0xc006, 0xaac3,
+  0xc007, 0xaac4,
+  0xc008, 0xaac5,
+  0xc009, 0xaac6,
+  0xc00a, 0xaac7,
+  0xc00b, 0xaac8,
+  0xc00c, 0xaac9,
+  0xc00d, 0xaaca,
+  0xc00e, 0xaacb,
+  0xc00f, 0xaacc,
+  0xc010, 0xaacd,
+  0xc011, 0xaace,
+  0xc012, 0xaacf,
+  0xc013, 0xaad0,
+  0xc014, 0xaad1,
+  0xc015, 0xaad3,
+  0xc016, 0xaad4,
+  0xc017, 0xaad5,
+  0xc018, 0xaad6,
+  0xc019, 0xaad7,
+  0xc01a, 0xaad8,
+  0xc01b, 0xaad9,
+  0xc01c, 0xaada,
+  0xc01d, 0xaadb,
+  0xc01e, 0xaadc,
+  0xc01f, 0xaadd,
+  0xc020, 0xaae1,
+  0xc021, 0xaae2,
+  0xc022, 0xaae3,
+  0xc023, 0xaae4,
+  0xc024, 0xaae5,
+  0xc025, 0xaae6,
+  0xc026, 0xaae7,
+  0xc027, 0xaae8,
+  0xc028, 0xaae9,
+  0xc029, 0xaaea,
+  0xc02a, 0xaaeb,
+  0xc02b, 0xaaec,
+  0xc02c, 0xaaed,
+  0xc02d, 0xaaee,
+  0xc02e, 0xaaef,
+  0xc02f, 0xaaf0,
+  0xc030, 0xaaf1,
+  0xc031, 0xaaf3,
+  0xc032, 0xaaf4,
+  0xc033, 0xaaf5,
+  0xc034, 0xaaf6,
+  0xc035, 0xaaf7,
+  0xc036, 0xaaf8,
+  0xc037, 0xaaf9,
+  0xc038, 0xaafa,
+  0xc039, 0xaafb,
+  0xc03a, 0xaafc,
+  0xc03b, 0xaafd,
+  0xc03c, 0xab41,
+  0xc03d, 0xab42,
+  0xc03e, 0xab43,
+  0xc03f, 0xab44,
+  0xc040, 0xab45,
+  0xc041, 0xab46,
+  0xc042, 0xab47,
+  0xc043, 0xab48,
+  0xc044, 0xab49,
+  0xc045, 0xab4a,
+  0xc046, 0xab4b,
+  0xc047, 0xab4c,
+  0xc048, 0xab4d,
+  0xc049, 0xab4e,
+  0xc04a, 0xab4f,
+  0xc04b, 0xab50,
+  0xc04c, 0xab51,
+  0xc04d, 0xab53,
+  0xc04e, 0xab54,
+  0xc04f, 0xab55,
+  0xc050, 0xab56,
+  0xc051, 0xab57,
+  0xc052, 0xab58,
+  0xc053, 0xab59,
+  0xc054, 0xab5a,
+  0xc055, 0xab5b,
+  0xc056, 0xab5c,
+  0xc057, 0xab5d,
+  0xc058, 0xab61,
+  0xc059, 0xab62,
+  0xc05a, 0xab63,
+  0xc05b, 0xab64,
+  0xc05c, 0xab65,
+  0xc05d, 0xab66,
+  0xc05e, 0xab67,
+  0xc05f, 0xab68,
+  0xc060, 0xab69,
+  0xc061, 0xab6a,
+  0xc062, 0xab6b,
+  0xc063, 0xab6c,
+  0xc064, 0xab6d,
+  0xc065, 0xab6e,
+  0xc066, 0xab6f,
+  0xc067, 0xab70,
+  0xc068, 0xab71,
+  0xc069, 0xab73,
+  0xc06a, 0xab74,
+  0xc06b, 0xab75,
+  0xc06c, 0xab76,
+  0xc06d, 0xab77,
+  0xc06e, 0xab78,
+  0xc06f, 0xab79,
+  0xc070, 0xab7a,
+  0xc071, 0xab7b,
+  0xc072, 0xab7c,
+  0xc073, 0xab7d,
+  0xc074, 0xab81,
+  0xc075, 0xab82,
+  0xc076, 0xab83,
+  0xc077, 0xab84,
+  0xc078, 0xab85,
+  0xc079, 0xab86,
+  0xc07a, 0xab87,
+  0xc07b, 0xab88,
+  0xc07c, 0xab89,
+  0xc07d, 0xab8a,
+  0xc07e, 0xab8b,
+  0xc07f, 0xab8c,
+  0xc080, 0xab8d,
+  0xc081, 0xab8e,
+  0xc082, 0xab8f,
+  0xc083, 0xab90,
+  0xc084, 0xab91,
+  0xc085, 0xab93,
+  0xc086, 0xab94,
+  0xc087, 0xab95,
+  0xc088, 0xab96,
+  0xc089, 0xab97,
+  0xc08a, 0xab98,
+  0xc08b, 0xab99,
+  0xc08c, 0xab9a,
+  0xc08d, 0xab9b,
+  0xc08e, 0xab9c,
+  0xc08f, 0xab9d,
+  0xc090, 0xaba1,
+  0xc091, 0xaba2,
+  0xc092, 0xaba3,
+  0xc093, 0xaba4,
+  0xc094, 0xaba5,
+  0xc095, 0xaba6,
+  0xc096, 0xaba7,
+  0xc097, 0xaba8,
+  0xc098, 0xaba9,
+  0xc099, 0xabaa,
+  0xc09a, 0xabab,
+  0xc09b, 0xabac,
+  0xc09c, 0xabad,
+  0xc09d, 0xabae,
+  0xc09e, 0xabaf,
+  0xc09f, 0xabb0,
+  0xc0a0, 0xabb1,
+  0xc0a1, 0xabb3,
+  0xc0a2, 0xabb4,
+  0xc0a3, 0xabb5,
+  0xc0a4, 0xabb6,
+  0xc0a5, 0xabb7,
+  0xc0a6, 0xabb8,
+  0xc0a7, 0xabb9,
+  0xc0a8, 0xabba,
+  0xc0a9, 0xabbb,
+  0xc0aa, 0xabbc,
+  0xc0ab, 0xabbd,
+  0xc0ac, 0xac61,
+  0xc0ad, 0xac62,
+  0xc0ae, 0xac63,
+  0xc0af, 0xac64,
+  0xc0b0, 0xac65,
+  0xc0b1, 0xac66,
+  0xc0b2, 0xac67,
+  0xc0b3, 0xac68,
+  0xc0b4, 0xac69,
+  0xc0b5, 0xac6a,
+  0xc0b6, 0xac6b,
+  0xc0b7, 0xac6c,
+  0xc0b8, 0xac6d,
+  0xc0b9, 0xac6e,
+  0xc0ba, 0xac6f,
+  0xc0bb, 0xac70,
+  0xc0bc, 0xac71,
+  0xc0bd, 0xac73,
+  0xc0be, 0xac74,
+  0xc0bf, 0xac75,
+  0xc0c0, 0xac76,
+  0xc0c1, 0xac77,
+  0xc0c2, 0xac78,
+  0xc0c3, 0xac79,
+  0xc0c4, 0xac7a,
+  0xc0c5, 0xac7b,
+  0xc0c6, 0xac7c,
+  0xc0c7, 0xac7d,
+  0xc0c8, 0xac81,
+  0xc0c9, 0xac82,
+  0xc0ca, 0xac83,
+  0xc0cb, 0xac84,
+  0xc0cc, 0xac85,
+  0xc0cd, 0xac86,
+  0xc0ce, 0xac87,
+  0xc0cf, 0xac88,
+  0xc0d0, 0xac89,
+  0xc0d1, 0xac8a,
+  0xc0d2, 0xac8b,
+  0xc0d3, 0xac8c,
+  0xc0d4, 0xac8d,
+  0xc0d5, 0xac8e,
+  0xc0d6, 0xac8f,
+  0xc0d7, 0xac90,
+  0xc0d8, 0xac91,
+  0xc0d9, 0xac93,
+  0xc0da, 0xac94,
+  0xc0db, 0xac95,
+  0xc0dc, 0xac96,
+  0xc0dd, 0xac97,
+  0xc0de, 0xac98,
+  0xc0df, 0xac99,
+  0xc0e0, 0xac9a,
+  0xc0e1, 0xac9b,
+  0xc0e2, 0xac9c,
+  0xc0e3, 0xac9d,
+  0xc0e4, 0xaca1,
+  0xc0e5, 0xaca2,
+  0xc0e6, 0xaca3,
+  0xc0e7, 0xaca4,
+  0xc0e8, 0xaca5,
+  0xc0e9, 0xaca6,
+  0xc0ea, 0xaca7,
+  0xc0eb, 0xaca8,
+  0xc0ec, 0xaca9,
+  0xc0ed, 0xacaa,
+  0xc0ee, 0xacab,
+  0xc0ef, 0xacac,
+  0xc0f0, 0xacad,
+  0xc0f1, 0xacae,
+  0xc0f2, 0xacaf,
+  0xc0f3, 0xacb0,
+  0xc0f4, 0xacb1,
+  0xc0f5, 0xacb3,
+  0xc0f6, 0xacb4,
+  0xc0f7, 0xacb5,
+  0xc0f8, 0xacb6,
+  0xc0f9, 0xacb7,
+  0xc0fa, 0xacb8,
+  0xc0fb, 0xacb9,
+  0xc0fc, 0xacba,
+  0xc0fd, 0xacbb,
+  0xc0fe, 0xacbc,
+  0xc0ff, 0xacbd,
+  0xc100, 0xacc1,
+  0xc101, 0xacc2,
+  0xc102, 0xacc3,
+  0xc103, 0xacc4,
+  0xc104, 0xacc5,
+  0xc105, 0xacc6,
+  0xc106, 0xacc7,
+  0xc107, 0xacc8,
+  0xc108, 0xacc9,
+  0xc109, 0xacca,
+  0xc10a, 0xaccb,
+  0xc10b, 0xaccc,
+  0xc10c, 0xaccd,
+  0xc10d, 0xacce,
+  0xc10e, 0xaccf,
+  0xc10f, 0xacd0,
+  0xc110, 0xacd1,
+  0xc111, 0xacd3,
+  0xc112, 0xacd4,
+  0xc113, 0xacd5,
+  0xc114, 0xacd6,
+  0xc115, 0xacd7,
+  0xc116, 0xacd8,
+  0xc117, 0xacd9,
+  0xc118, 0xacda,
+  0xc119, 0xacdb,
+  0xc11a, 0xacdc,
+  0xc11b, 0xacdd,
+  0xc11c, 0xace1,
+  0xc11d, 0xace2,
+  0xc11e, 0xace3,
+  0xc11f, 0xace4,
+  0xc120, 0xace5,
+  0xc121, 0xace6,
+  0xc122, 0xace7,
+  0xc123, 0xace8,
+  0xc124, 0xace9,
+  0xc125, 0xacea,
+  0xc126, 0xaceb,
+  0xc127, 0xacec,
+  0xc128, 0xaced,
+  0xc129, 0xacee,
+  0xc12a, 0xacef,
+  0xc12b, 0xacf0,
+  0xc12c, 0xacf1,
+  0xc12d, 0xacf3,
+  0xc12e, 0xacf4,
+  0xc12f, 0xacf5,
+  0xc130, 0xacf6,
+  0xc131, 0xacf7,
+  0xc132, 0xacf8,
+  0xc133, 0xacf9,
+  0xc134, 0xacfa,
+  0xc135, 0xacfb,
+  0xc136, 0xacfc,
+  0xc137, 0xacfd,
+  0xc138, 0xad41,
+  0xc139, 0xad42,
+  0xc13a, 0xad43,
+  0xc13b, 0xad44,
+  0xc13c, 0xad45,
+  0xc13d, 0xad46,
+  0xc13e, 0xad47,
+  0xc13f, 0xad48,
+  0xc140, 0xad49,
+  0xc141, 0xad4a,
+  0xc142, 0xad4b,
+  0xc143, 0xad4c,
+  0xc144, 0xad4d,
+  0xc145, 0xad4e,
+  0xc146, 0xad4f,
+  0xc147, 0xad50,
+  0xc148, 0xad51,
+  0xc149, 0xad53,
+  0xc14a, 0xad54,
+  0xc14b, 0xad55,
+  0xc14c, 0xad56,
+  0xc14d, 0xad57,
+  0xc14e, 0xad58,
+  0xc14f, 0xad59,
+  0xc150, 0xad5a,
+  0xc151, 0xad5b,
+  0xc152, 0xad5c,
+  0xc153, 0xad5d,
+  0xc154, 0xad61,
+  0xc155, 0xad62,
+  0xc156, 0xad63,
+  0xc157, 0xad64,
+  0xc158, 0xad65,
+  0xc159, 0xad66,
+  0xc15a, 0xad67,
+  0xc15b, 0xad68,
+  0xc15c, 0xad69,
+  0xc15d, 0xad6a,
+  0xc15e, 0xad6b,
+  0xc15f, 0xad6c,
+  0xc160, 0xad6d,
+  0xc161, 0xad6e,
+  0xc162, 0xad6f,
+  0xc163, 0xad70,
+  0xc164, 0xad71,
+  0xc165, 0xad73,
+  0xc166, 0xad74,
+  0xc167, 0xad75,
+  0xc168, 0xad76,
+  0xc169, 0xad77,
+  0xc16a, 0xad78,
+  0xc16b, 0xad79,
+  0xc16c, 0xad7a,
+  0xc16d, 0xad7b,
+  0xc16e, 0xad7c,
+  0xc16f, 0xad7d,
+  0xc170, 0xad81,
+  0xc171, 0xad82,
+  0xc172, 0xad83,
+  0xc173, 0xad84,
+  0xc174, 0xad85,
+  0xc175, 0xad86,
+  0xc176, 0xad87,
+  0xc177, 0xad88,
+  0xc178, 0xad89,
+  0xc179, 0xad8a,
+  0xc17a, 0xad8b,
+  0xc17b, 0xad8c,
+  0xc17c, 0xad8d,
+  0xc17d, 0xad8e,
+  0xc17e, 0xad8f,
+  0xc17f, 0xad90,
+  0xc180, 0xad91,
+  0xc181, 0xad93,
+  0xc182, 0xad94,
+  0xc183, 0xad95,
+  0xc184, 0xad96,
+  0xc185, 0xad97,
+  0xc186, 0xad98,
+  0xc187, 0xad99,
+  0xc188, 0xad9a,
+  0xc189, 0xad9b,
+  0xc18a, 0xad9c,
+  0xc18b, 0xad9d,
+  0xc18c, 0xada1,
+  0xc18d, 0xada2,
+  0xc18e, 0xada3,
+  0xc18f, 0xada4,
+  0xc190, 0xada5,
+  0xc191, 0xada6,
+  0xc192, 0xada7,
+  0xc193, 0xada8,
+  0xc194, 0xada9,
+  0xc195, 0xadaa,
+  0xc196, 0xadab,
+  0xc197, 0xadac,
+  0xc198, 0xadad,
+  0xc199, 0xadae,
+  0xc19a, 0xadaf,
+  0xc19b, 0xadb0,
+  0xc19c, 0xadb1,
+  0xc19d, 0xadb3,
+  0xc19e, 0xadb4,
+  0xc19f, 0xadb5,
+  0xc1a0, 0xadb6,
+  0xc1a1, 0xadb7,
+  0xc1a2, 0xadb8,
+  0xc1a3, 0xadb9,
+  0xc1a4, 0xadba,
+  0xc1a5, 0xadbb,
+  0xc1a6, 0xadbc,
+  0xc1a7, 0xadbd,
+  0xc1a8, 0xadc1,
+  0xc1a9, 0xadc2,
+  0xc1aa, 0xadc3,
+  0xc1ab, 0xadc4,
+  0xc1ac, 0xadc5,
+  0xc1ad, 0xadc6,
+  0xc1ae, 0xadc7,
+  0xc1af, 0xadc8,
+  0xc1b0, 0xadc9,
+  0xc1b1, 0xadca,
+  0xc1b2, 0xadcb,
+  0xc1b3, 0xadcc,
+  0xc1b4, 0xadcd,
+  0xc1b5, 0xadce,
+  0xc1b6, 0xadcf,
+  0xc1b7, 0xadd0,
+  0xc1b8, 0xadd1,
+  0xc1b9, 0xadd3,
+  0xc1ba, 0xadd4,
+  0xc1bb, 0xadd5,
+  0xc1bc, 0xadd6,
+  0xc1bd, 0xadd7,
+  0xc1be, 0xadd8,
+  0xc1bf, 0xadd9,
+  0xc1c0, 0xadda,
+  0xc1c1, 0xaddb,
+  0xc1c2, 0xaddc,
+  0xc1c3, 0xaddd,
+  0xc1c4, 0xade1,
+  0xc1c5, 0xade2,
+  0xc1c6, 0xade3,
+  0xc1c7, 0xade4,
+  0xc1c8, 0xade5,
+  0xc1c9, 0xade6,
+  0xc1ca, 0xade7,
+  0xc1cb, 0xade8,
+  0xc1cc, 0xade9,
+  0xc1cd, 0xadea,
+  0xc1ce, 0xadeb,
+  0xc1cf, 0xadec,
+  0xc1d0, 0xaded,
+  0xc1d1, 0xadee,
+  0xc1d2, 0xadef,
+  0xc1d3, 0xadf0,
+  0xc1d4, 0xadf1,
+  0xc1d5, 0xadf3,
+  0xc1d6, 0xadf4,
+  0xc1d7, 0xadf5,
+  0xc1d8, 0xadf6,
+  0xc1d9, 0xadf7,
+  0xc1da, 0xadf8,
+  0xc1db, 0xadf9,
+  0xc1dc, 0xadfa,
+  0xc1dd, 0xadfb,
+  0xc1de, 0xadfc,
+  0xc1df, 0xadfd,
+  0xc1e0, 0xae41,
+  0xc1e1, 0xae42,
+  0xc1e2, 0xae43,
+  0xc1e3, 0xae44,
+  0xc1e4, 0xae45,
+  0xc1e5, 0xae46,
+  0xc1e6, 0xae47,
+  0xc1e7, 0xae48,
+  0xc1e8, 0xae49,
+  0xc1e9, 0xae4a,
+  0xc1ea, 0xae4b,
+  0xc1eb, 0xae4c,
+  0xc1ec, 0xae4d,
+  0xc1ed, 0xae4e,
+  0xc1ee, 0xae4f,
+  0xc1ef, 0xae50,
+  0xc1f0, 0xae51,
+  0xc1f1, 0xae53,
+  0xc1f2, 0xae54,
+  0xc1f3, 0xae55,
+  0xc1f4, 0xae56,
+  0xc1f5, 0xae57,
+  0xc1f6, 0xae58,
+  0xc1f7, 0xae59,
+  0xc1f8, 0xae5a,
+  0xc1f9, 0xae5b,
+  0xc1fa, 0xae5c,
+  0xc1fb, 0xae5d,
+  0xc1fc, 0xae61,
+  0xc1fd, 0xae62,
+  0xc1fe, 0xae63,
+  0xc1ff, 0xae64,
+  0xc200, 0xae65,
+  0xc201, 0xae66,
+  0xc202, 0xae67,
+  0xc203, 0xae68,
+  0xc204, 0xae69,
+  0xc205, 0xae6a,
+  0xc206, 0xae6b,
+  0xc207, 0xae6c,
+  0xc208, 0xae6d,
+  0xc209, 0xae6e,
+  0xc20a, 0xae6f,
+  0xc20b, 0xae70,
+  0xc20c, 0xae71,
+  0xc20d, 0xae73,
+  0xc20e, 0xae74,
+  0xc20f, 0xae75,
+  0xc210, 0xae76,
+  0xc211, 0xae77,
+  0xc212, 0xae78,
+  0xc213, 0xae79,
+  0xc214, 0xae7a,
+  0xc215, 0xae7b,
+  0xc216, 0xae7c,
+  0xc217, 0xae7d,
+  0xc218, 0xae81,
+  0xc219, 0xae82,
+  0xc21a, 0xae83,
+  0xc21b, 0xae84,
+  0xc21c, 0xae85,
+  0xc21d, 0xae86,
+  0xc21e, 0xae87,
+  0xc21f, 0xae88,
+  0xc220, 0xae89,
+  0xc221, 0xae8a,
+  0xc222, 0xae8b,
+  0xc223, 0xae8c,
+  0xc224, 0xae8d,
+  0xc225, 0xae8e,
+  0xc226, 0xae8f,
+  0xc227, 0xae90,
+  0xc228, 0xae91,
+  0xc229, 0xae93,
+  0xc22a, 0xae94,
+  0xc22b, 0xae95,
+  0xc22c, 0xae96,
+  0xc22d, 0xae97,
+  0xc22e, 0xae98,
+  0xc22f, 0xae99,
+  0xc230, 0xae9a,
+  0xc231, 0xae9b,
+  0xc232, 0xae9c,
+  0xc233, 0xae9d,
+  0xc234, 0xaea1,
+  0xc235, 0xaea2,
+  0xc236, 0xaea3,
+  0xc237, 0xaea4,
+  0xc238, 0xaea5,
+  0xc239, 0xaea6,
+  0xc23a, 0xaea7,
+  0xc23b, 0xaea8,
+  0xc23c, 0xaea9,
+  0xc23d, 0xaeaa,
+  0xc23e, 0xaeab,
+  0xc23f, 0xaeac,
+  0xc240, 0xaead,
+  0xc241, 0xaeae,
+  0xc242, 0xaeaf,
+  0xc243, 0xaeb0,
+  0xc244, 0xaeb1,
+  0xc245, 0xaeb3,
+  0xc246, 0xaeb4,
+  0xc247, 0xaeb5,
+  0xc248, 0xaeb6,
+  0xc249, 0xaeb7,
+  0xc24a, 0xaeb8,
+  0xc24b, 0xaeb9,
+  0xc24c, 0xaeba,
+  0xc24d, 0xaebb,
+  0xc24e, 0xaebc,
+  0xc24f, 0xaebd,
+  0xc250, 0xaec1,
+  0xc251, 0xaec2,
+  0xc252, 0xaec3,
+  0xc253, 0xaec4,
+  0xc254, 0xaec5,
+  0xc255, 0xaec6,
+  0xc256, 0xaec7,
+  0xc257, 0xaec8,
+  0xc258, 0xaec9,
+  0xc259, 0xaeca,
+  0xc25a, 0xaecb,
+  0xc25b, 0xaecc,
+  0xc25c, 0xaecd,
+  0xc25d, 0xaece,
+  0xc25e, 0xaecf,
+  0xc25f, 0xaed0,
+  0xc260, 0xaed1,
+  0xc261, 0xaed3,
+  0xc262, 0xaed4,
+  0xc263, 0xaed5,
+  0xc264, 0xaed6,
+  0xc265, 0xaed7,
+  0xc266, 0xaed8,
+  0xc267, 0xaed9,
+  0xc268, 0xaeda,
+  0xc269, 0xaedb,
+  0xc26a, 0xaedc,
+  0xc26b, 0xaedd,
+  0xc26c, 0xaee1,
+  0xc26d, 0xaee2,
+  0xc26e, 0xaee3,
+  0xc26f, 0xaee4,
+  0xc270, 0xaee5,
+  0xc271, 0xaee6,
+  0xc272, 0xaee7,
+  0xc273, 0xaee8,
+  0xc274, 0xaee9,
+  0xc275, 0xaeea,
+  0xc276, 0xaeeb,
+  0xc277, 0xaeec,
+  0xc278, 0xaeed,
+  0xc279, 0xaeee,
+  0xc27a, 0xaeef,
+  0xc27b, 0xaef0,
+  0xc27c, 0xaef1,
+  0xc27d, 0xaef3,
+  0xc27e, 0xaef4,
+  0xc27f, 0xaef5,
+  0xc280, 0xaef6,
+  0xc281, 0xaef7,
+  0xc282, 0xaef8,
+  0xc283, 0xaef9,
+  0xc284, 0xaefa,
+  0xc285, 0xaefb,
+  0xc286, 0xaefc,
+  0xc287, 0xaefd,
+  0xc288, 0xaf41,
+  0xc289, 0xaf42,
+  0xc28a, 0xaf43,
+  0xc28b, 0xaf44,
+  0xc28c, 0xaf45,
+  0xc28d, 0xaf46,
+  0xc28e, 0xaf47,
+  0xc28f, 0xaf48,
+  0xc290, 0xaf49,
+  0xc291, 0xaf4a,
+  0xc292, 0xaf4b,
+  0xc293, 0xaf4c,
+  0xc294, 0xaf4d,
+  0xc295, 0xaf4e,
+  0xc296, 0xaf4f,
+  0xc297, 0xaf50,
+  0xc298, 0xaf51,
+  0xc299, 0xaf53,
+  0xc29a, 0xaf54,
+  0xc29b, 0xaf55,
+  0xc29c, 0xaf56,
+  0xc29d, 0xaf57,
+  0xc29e, 0xaf58,
+  0xc29f, 0xaf59,
+  0xc2a0, 0xaf5a,
+  0xc2a1, 0xaf5b,
+  0xc2a2, 0xaf5c,
+  0xc2a3, 0xaf5d,
+  0xc2a4, 0xaf61,
+  0xc2a5, 0xaf62,
+  0xc2a6, 0xaf63,
+  0xc2a7, 0xaf64,
+  0xc2a8, 0xaf65,
+  0xc2a9, 0xaf66,
+  0xc2aa, 0xaf67,
+  0xc2ab, 0xaf68,
+  0xc2ac, 0xaf69,
+  0xc2ad, 0xaf6a,
+  0xc2ae, 0xaf6b,
+  0xc2af, 0xaf6c,
+  0xc2b0, 0xaf6d,
+  0xc2b1, 0xaf6e,
+  0xc2b2, 0xaf6f,
+  0xc2b3, 0xaf70,
+  0xc2b4, 0xaf71,
+  0xc2b5, 0xaf73,
+  0xc2b6, 0xaf74,
+  0xc2b7, 0xaf75,
+  0xc2b8, 0xaf76,
+  0xc2b9, 0xaf77,
+  0xc2ba, 0xaf78,
+  0xc2bb, 0xaf79,
+  0xc2bc, 0xaf7a,
+  0xc2bd, 0xaf7b,
+  0xc2be, 0xaf7c,
+  0xc2bf, 0xaf7d,
+  0xc2c0, 0xaf81,
+  0xc2c1, 0xaf82,
+  0xc2c2, 0xaf83,
+  0xc2c3, 0xaf84,
+  0xc2c4, 0xaf85,
+  0xc2c5, 0xaf86,
+  0xc2c6, 0xaf87,
+  0xc2c7, 0xaf88,
+  0xc2c8, 0xaf89,
+  0xc2c9, 0xaf8a,
+  0xc2ca, 0xaf8b,
+  0xc2cb, 0xaf8c,
+  0xc2cc, 0xaf8d,
+  0xc2cd, 0xaf8e,
+  0xc2ce, 0xaf8f,
+  0xc2cf, 0xaf90,
+  0xc2d0, 0xaf91,
+  0xc2d1, 0xaf93,
+  0xc2d2, 0xaf94,
+  0xc2d3, 0xaf95,
+  0xc2d4, 0xaf96,
+  0xc2d5, 0xaf97,
+  0xc2d6, 0xaf98,
+  0xc2d7, 0xaf99,
+  0xc2d8, 0xaf9a,
+  0xc2d9, 0xaf9b,
+  0xc2da, 0xaf9c,
+  0xc2db, 0xaf9d,
+  0xc2dc, 0xafa1,
+  0xc2dd, 0xafa2,
+  0xc2de, 0xafa3,
+  0xc2df, 0xafa4,
+  0xc2e0, 0xafa5,
+  0xc2e1, 0xafa6,
+  0xc2e2, 0xafa7,
+  0xc2e3, 0xafa8,
+  0xc2e4, 0xafa9,
+  0xc2e5, 0xafaa,
+  0xc2e6, 0xafab,
+  0xc2e7, 0xafac,
+  0xc2e8, 0xafad,
+  0xc2e9, 0xafae,
+  0xc2ea, 0xafaf,
+  0xc2eb, 0xafb0,
+  0xc2ec, 0xafb1,
+  0xc2ed, 0xafb3,
+  0xc2ee, 0xafb4,
+  0xc2ef, 0xafb5,
+  0xc2f0, 0xafb6,
+  0xc2f1, 0xafb7,
+  0xc2f2, 0xafb8,
+  0xc2f3, 0xafb9,
+  0xc2f4, 0xafba,
+  0xc2f5, 0xafbb,
+  0xc2f6, 0xafbc,
+  0xc2f7, 0xafbd,
+  0xc2f8, 0xb061,
+  0xc2f9, 0xb062,
+  0xc2fa, 0xb063,
+  0xc2fb, 0xb064,
+  0xc2fc, 0xb065,
+  0xc2fd, 0xb066,
+  0xc2fe, 0xb067,
+  0xc2ff, 0xb068,
+  0xc300, 0xb069,
+  0xc301, 0xb06a,
+  0xc302, 0xb06b,
+  0xc303, 0xb06c,
+  0xc304, 0xb06d,
+  0xc305, 0xb06e,
+  0xc306, 0xb06f,
+  0xc307, 0xb070,
+  0xc308, 0xb071,
+  0xc309, 0xb073,
+  0xc30a, 0xb074,
+  0xc30b, 0xb075,
+  0xc30c, 0xb076,
+  0xc30d, 0xb077,
+  0xc30e, 0xb078,
+  0xc30f, 0xb079,
+  0xc310, 0xb07a,
+  0xc311, 0xb07b,
+  0xc312, 0xb07c,
+  0xc313, 0xb07d,
+  0xc314, 0xb081,
+  0xc315, 0xb082,
+  0xc316, 0xb083,
+  0xc317, 0xb084,
+  0xc318, 0xb085,
+  0xc319, 0xb086,
+  0xc31a, 0xb087,
+  0xc31b, 0xb088,
+  0xc31c, 0xb089,
+  0xc31d, 0xb08a,
+  0xc31e, 0xb08b,
+  0xc31f, 0xb08c,
+  0xc320, 0xb08d,
+  0xc321, 0xb08e,
+  0xc322, 0xb08f,
+  0xc323, 0xb090,
+  0xc324, 0xb091,
+  0xc325, 0xb093,
+  0xc326, 0xb094,
+  0xc327, 0xb095,
+  0xc328, 0xb096,
+  0xc329, 0xb097,
+  0xc32a, 0xb098,
+  0xc32b, 0xb099,
+  0xc32c, 0xb09a,
+  0xc32d, 0xb09b,
+  0xc32e, 0xb09c,
+  0xc32f, 0xb09d,
+  0xc330, 0xb0a1,
+  0xc331, 0xb0a2,
+  0xc332, 0xb0a3,
+  0xc333, 0xb0a4,
+  0xc334, 0xb0a5,
+  0xc335, 0xb0a6,
+  0xc336, 0xb0a7,
+  0xc337, 0xb0a8,
+  0xc338, 0xb0a9,
+  0xc339, 0xb0aa,
+  0xc33a, 0xb0ab,
+  0xc33b, 0xb0ac,
+  0xc33c, 0xb0ad,
+  0xc33d, 0xb0ae,
+  0xc33e, 0xb0af,
+  0xc33f, 0xb0b0,
+  0xc340, 0xb0b1,
+  0xc341, 0xb0b3,
+  0xc342, 0xb0b4,
+  0xc343, 0xb0b5,
+  0xc344, 0xb0b6,
+  0xc345, 0xb0b7,
+  0xc346, 0xb0b8,
+  0xc347, 0xb0b9,
+  0xc348, 0xb0ba,
+  0xc349, 0xb0bb,
+  0xc34a, 0xb0bc,
+  0xc34b, 0xb0bd,
+  0xc34c, 0xb0c1,
+  0xc34d, 0xb0c2,
+  0xc34e, 0xb0c3,
+  0xc34f, 0xb0c4,
+  0xc350, 0xb0c5,
+  0xc351, 0xb0c6,
+  0xc352, 0xb0c7,
+  0xc353, 0xb0c8,
+  0xc354, 0xb0c9,
+  0xc355, 0xb0ca,
+  0xc356, 0xb0cb,
+  0xc357, 0xb0cc,
+  0xc358, 0xb0cd,
+  0xc359, 0xb0ce,
+  0xc35a, 0xb0cf,
+  0xc35b, 0xb0d0,
+  0xc35c, 0xb0d1,
+  0xc35d, 0xb0d3,
+  0xc35e, 0xb0d4,
+  0xc35f, 0xb0d5,
+  0xc360, 0xb0d6,
+  0xc361, 0xb0d7,
+  0xc362, 0xb0d8,
+  0xc363, 0xb0d9,
+  0xc364, 0xb0da,
+  0xc365, 0xb0db,
+  0xc366, 0xb0dc,
+  0xc367, 0xb0dd,
+  0xc368, 0xb0e1,
+  0xc369, 0xb0e2,
+  0xc36a, 0xb0e3,
+  0xc36b, 0xb0e4,
+  0xc36c, 0xb0e5,
+  0xc36d, 0xb0e6,
+  0xc36e, 0xb0e7,
+  0xc36f, 0xb0e8,
+  0xc370, 0xb0e9,
+  0xc371, 0xb0ea,
+  0xc372, 0xb0eb,
+  0xc373, 0xb0ec,
+  0xc374, 0xb0ed,
+  0xc375, 0xb0ee,
+  0xc376, 0xb0ef,
+  0xc377, 0xb0f0,
+  0xc378, 0xb0f1,
+  0xc379, 0xb0f3,
+  0xc37a, 0xb0f4,
+  0xc37b, 0xb0f5,
+  0xc37c, 0xb0f6,
+  0xc37d, 0xb0f7,
+  0xc37e, 0xb0f8,
+  0xc37f, 0xb0f9,
+  0xc380, 0xb0fa,
+  0xc381, 0xb0fb,
+  0xc382, 0xb0fc,
+  0xc383, 0xb0fd,
+  0xc384, 0xb141,
+  0xc385, 0xb142,
+  0xc386, 0xb143,
+  0xc387, 0xb144,
+  0xc388, 0xb145,
+  0xc389, 0xb146,
+  0xc38a, 0xb147,
+  0xc38b, 0xb148,
+  0xc38c, 0xb149,
+  0xc38d, 0xb14a,
+  0xc38e, 0xb14b,
+  0xc38f, 0xb14c,
+  0xc390, 0xb14d,
+  0xc391, 0xb14e,
+  0xc392, 0xb14f,
+  0xc393, 0xb150,
+  0xc394, 0xb151,
+  0xc395, 0xb153,
+  0xc396, 0xb154,
+  0xc397, 0xb155,
+  0xc398, 0xb156,
+  0xc399, 0xb157,
+  0xc39a, 0xb158,
+  0xc39b, 0xb159,
+  0xc39c, 0xb15a,
+  0xc39d, 0xb15b,
+  0xc39e, 0xb15c,
+  0xc39f, 0xb15d,
+  0xc3a0, 0xb161,
+  0xc3a1, 0xb162,
+  0xc3a2, 0xb163,
+  0xc3a3, 0xb164,
+  0xc3a4, 0xb165,
+  0xc3a5, 0xb166,
+  0xc3a6, 0xb167,
+  0xc3a7, 0xb168,
+  0xc3a8, 0xb169,
+  0xc3a9, 0xb16a,
+  0xc3aa, 0xb16b,
+  0xc3ab, 0xb16c,
+  0xc3ac, 0xb16d,
+  0xc3ad, 0xb16e,
+  0xc3ae, 0xb16f,
+  0xc3af, 0xb170,
+  0xc3b0, 0xb171,
+  0xc3b1, 0xb173,
+  0xc3b2, 0xb174,
+  0xc3b3, 0xb175,
+  0xc3b4, 0xb176,
+  0xc3b5, 0xb177,
+  0xc3b6, 0xb178,
+  0xc3b7, 0xb179,
+  0xc3b8, 0xb17a,
+  0xc3b9, 0xb17b,
+  0xc3ba, 0xb17c,
+  0xc3bb, 0xb17d,
+  0xc3bc, 0xb181,
+  0xc3bd, 0xb182,
+  0xc3be, 0xb183,
+  0xc3bf, 0xb184,
+  0xc3c0, 0xb185,
+  0xc3c1, 0xb186,
+  0xc3c2, 0xb187,
+  0xc3c3, 0xb188,
+  0xc3c4, 0xb189,
+  0xc3c5, 0xb18a,
+  0xc3c6, 0xb18b,
+  0xc3c7, 0xb18c,
+  0xc3c8, 0xb18d,
+  0xc3c9, 0xb18e,
+  0xc3ca, 0xb18f,
+  0xc3cb, 0xb190,
+  0xc3cc, 0xb191,
+  0xc3cd, 0xb193,
+  0xc3ce, 0xb194,
+  0xc3cf, 0xb195,
+  0xc3d0, 0xb196,
+  0xc3d1, 0xb197,
+  0xc3d2, 0xb198,
+  0xc3d3, 0xb199,
+  0xc3d4, 0xb19a,
+  0xc3d5, 0xb19b,
+  0xc3d6, 0xb19c,
+  0xc3d7, 0xb19d,
+  0xc3d8, 0xb1a1,
+  0xc3d9, 0xb1a2,
+  0xc3da, 0xb1a3,
+  0xc3db, 0xb1a4,
+  0xc3dc, 0xb1a5,
+  0xc3dd, 0xb1a6,
+  0xc3de, 0xb1a7,
+  0xc3df, 0xb1a8,
+  0xc3e0, 0xb1a9,
+  0xc3e1, 0xb1aa,
+  0xc3e2, 0xb1ab,
+  0xc3e3, 0xb1ac,
+  0xc3e4, 0xb1ad,
+  0xc3e5, 0xb1ae,
+  0xc3e6, 0xb1af,
+  0xc3e7, 0xb1b0,
+  0xc3e8, 0xb1b1,
+  0xc3e9, 0xb1b3,
+  0xc3ea, 0xb1b4,
+  0xc3eb, 0xb1b5,
+  0xc3ec, 0xb1b6,
+  0xc3ed, 0xb1b7,
+  0xc3ee, 0xb1b8,
+  0xc3ef, 0xb1b9,
+  0xc3f0, 0xb1ba,
+  0xc3f1, 0xb1bb,
+  0xc3f2, 0xb1bc,
+  0xc3f3, 0xb1bd,
+  0xc3f4, 0xb1c1,
+  0xc3f5, 0xb1c2,
+  0xc3f6, 0xb1c3,
+  0xc3f7, 0xb1c4,
+  0xc3f8, 0xb1c5,
+  0xc3f9, 0xb1c6,
+  0xc3fa, 0xb1c7,
+  0xc3fb, 0xb1c8,
+  0xc3fc, 0xb1c9,
+  0xc3fd, 0xb1ca,
+  0xc3fe, 0xb1cb,
+  0xc3ff, 0xb1cc,
+  0xc400, 0xb1cd,
+  0xc401, 0xb1ce,
+  0xc402, 0xb1cf,
+  0xc403, 0xb1d0,
+  0xc404, 0xb1d1,
+  0xc405, 0xb1d3,
+  0xc406, 0xb1d4,
+  0xc407, 0xb1d5,
+  0xc408, 0xb1d6,
+  0xc409, 0xb1d7,
+  0xc40a, 0xb1d8,
+  0xc40b, 0xb1d9,
+  0xc40c, 0xb1da,
+  0xc40d, 0xb1db,
+  0xc40e, 0xb1dc,
+  0xc40f, 0xb1dd,
+  0xc410, 0xb1e1,
+  0xc411, 0xb1e2,
+  0xc412, 0xb1e3,
+  0xc413, 0xb1e4,
+  0xc414, 0xb1e5,
+  0xc415, 0xb1e6,
+  0xc416, 0xb1e7,
+  0xc417, 0xb1e8,
+  0xc418, 0xb1e9,
+  0xc419, 0xb1ea,
+  0xc41a, 0xb1eb,
+  0xc41b, 0xb1ec,
+  0xc41c, 0xb1ed,
+  0xc41d, 0xb1ee,
+  0xc41e, 0xb1ef,
+  0xc41f, 0xb1f0,
+  0xc420, 0xb1f1,
+  0xc421, 0xb1f3,
+  0xc422, 0xb1f4,
+  0xc423, 0xb1f5,
+  0xc424, 0xb1f6,
+  0xc425, 0xb1f7,
+  0xc426, 0xb1f8,
+  0xc427, 0xb1f9,
+  0xc428, 0xb1fa,
+  0xc429, 0xb1fb,
+  0xc42a, 0xb1fc,
+  0xc42b, 0xb1fd,
+  0xc42c, 0xb241,
+  0xc42d, 0xb242,
+  0xc42e, 0xb243,
+  0xc42f, 0xb244,
+  0xc430, 0xb245,
+  0xc431, 0xb246,
+  0xc432, 0xb247,
+  0xc433, 0xb248,
+  0xc434, 0xb249,
+  0xc435, 0xb24a,
+  0xc436, 0xb24b,
+  0xc437, 0xb24c,
+  0xc438, 0xb24d,
+  0xc439, 0xb24e,
+  0xc43a, 0xb24f,
+  0xc43b, 0xb250,
+  0xc43c, 0xb251,
+  0xc43d, 0xb253,
+  0xc43e, 0xb254,
+  0xc43f, 0xb255,
+  0xc440, 0xb256,
+  0xc441, 0xb257,
+  0xc442, 0xb258,
+  0xc443, 0xb259,
+  0xc444, 0xb25a,
+  0xc445, 0xb25b,
+  0xc446, 0xb25c,
+  0xc447, 0xb25d,
+  0xc448, 0xb261,
+  0xc449, 0xb262,
+  0xc44a, 0xb263,
+  0xc44b, 0xb264,
+  0xc44c, 0xb265,
+  0xc44d, 0xb266,
+  0xc44e, 0xb267,
+  0xc44f, 0xb268,
+  0xc450, 0xb269,
+  0xc451, 0xb26a,
+  0xc452, 0xb26b,
+  0xc453, 0xb26c,
+  0xc454, 0xb26d,
+  0xc455, 0xb26e,
+  0xc456, 0xb26f,
+  0xc457, 0xb270,
+  0xc458, 0xb271,
+  0xc459, 0xb273,
+  0xc45a, 0xb274,
+  0xc45b, 0xb275,
+  0xc45c, 0xb276,
+  0xc45d, 0xb277,
+  0xc45e, 0xb278,
+  0xc45f, 0xb279,
+  0xc460, 0xb27a,
+  0xc461, 0xb27b,
+  0xc462, 0xb27c,
+  0xc463, 0xb27d,
+  0xc464, 0xb281,
+  0xc465, 0xb282,
+  0xc466, 0xb283,
+  0xc467, 0xb284,
+  0xc468, 0xb285,
+  0xc469, 0xb286,
+  0xc46a, 0xb287,
+  0xc46b, 0xb288,
+  0xc46c, 0xb289,
+  0xc46d, 0xb28a,
+  0xc46e, 0xb28b,
+  0xc46f, 0xb28c,
+  0xc470, 0xb28d,
+  0xc471, 0xb28e,
+  0xc472, 0xb28f,
+  0xc473, 0xb290,
+  0xc474, 0xb291,
+  0xc475, 0xb293,
+  0xc476, 0xb294,
+  0xc477, 0xb295,
+  0xc478, 0xb296,
+  0xc479, 0xb297,
+  0xc47a, 0xb298,
+  0xc47b, 0xb299,
+  0xc47c, 0xb29a,
+  0xc47d, 0xb29b,
+  0xc47e, 0xb29c,
+  0xc47f, 0xb29d,
+  0xc480, 0xb2a1,
+  0xc481, 0xb2a2,
+  0xc482, 0xb2a3,
+  0xc483, 0xb2a4,
+  0xc484, 0xb2a5,
+  0xc485, 0xb2a6,
+  0xc486, 0xb2a7,
+  0xc487, 0xb2a8,
+  0xc488, 0xb2a9,
+  0xc489, 0xb2aa,
+  0xc48a, 0xb2ab,
+  0xc48b, 0xb2ac,
+  0xc48c, 0xb2ad,
+  0xc48d, 0xb2ae,
+  0xc48e, 0xb2af,
+  0xc48f, 0xb2b0,
+  0xc490, 0xb2b1,
+  0xc491, 0xb2b3,
+  0xc492, 0xb2b4,
+  0xc493, 0xb2b5,
+  0xc494, 0xb2b6,
+  0xc495, 0xb2b7,
+  0xc496, 0xb2b8,
+  0xc497, 0xb2b9,
+  0xc498, 0xb2ba,
+  0xc499, 0xb2bb,
+  0xc49a, 0xb2bc,
+  0xc49b, 0xb2bd,
+  0xc49c, 0xb2c1,
+  0xc49d, 0xb2c2,
+  0xc49e, 0xb2c3,
+  0xc49f, 0xb2c4,
+  0xc4a0, 0xb2c5,
+  0xc4a1, 0xb2c6,
+  0xc4a2, 0xb2c7,
+  0xc4a3, 0xb2c8,
+  0xc4a4, 0xb2c9,
+  0xc4a5, 0xb2ca,
+  0xc4a6, 0xb2cb,
+  0xc4a7, 0xb2cc,
+  0xc4a8, 0xb2cd,
+  0xc4a9, 0xb2ce,
+  0xc4aa, 0xb2cf,
+  0xc4ab, 0xb2d0,
+  0xc4ac, 0xb2d1,
+  0xc4ad, 0xb2d3,
+  0xc4ae, 0xb2d4,
+  0xc4af, 0xb2d5,
+  0xc4b0, 0xb2d6,
+  0xc4b1, 0xb2d7,
+  0xc4b2, 0xb2d8,
+  0xc4b3, 0xb2d9,
+  0xc4b4, 0xb2da,
+  0xc4b5, 0xb2db,
+  0xc4b6, 0xb2dc,
+  0xc4b7, 0xb2dd,
+  0xc4b8, 0xb2e1,
+  0xc4b9, 0xb2e2,
+  0xc4ba, 0xb2e3,
+  0xc4bb, 0xb2e4,
+  0xc4bc, 0xb2e5,
+  0xc4bd, 0xb2e6,
+  0xc4be, 0xb2e7,
+  0xc4bf, 0xb2e8,
+  0xc4c0, 0xb2e9,
+  0xc4c1, 0xb2ea,
+  0xc4c2, 0xb2eb,
+  0xc4c3, 0xb2ec,
+  0xc4c4, 0xb2ed,
+  0xc4c5, 0xb2ee,
+  0xc4c6, 0xb2ef,
+  0xc4c7, 0xb2f0,
+  0xc4c8, 0xb2f1,
+  0xc4c9, 0xb2f3,
+  0xc4ca, 0xb2f4,
+  0xc4cb, 0xb2f5,
+  0xc4cc, 0xb2f6,
+  0xc4cd, 0xb2f7,
+  0xc4ce, 0xb2f8,
+  0xc4cf, 0xb2f9,
+  0xc4d0, 0xb2fa,
+  0xc4d1, 0xb2fb,
+  0xc4d2, 0xb2fc,
+  0xc4d3, 0xb2fd,
+  0xc4d4, 0xb341,
+  0xc4d5, 0xb342,
+  0xc4d6, 0xb343,
+  0xc4d7, 0xb344,
+  0xc4d8, 0xb345,
+  0xc4d9, 0xb346,
+  0xc4da, 0xb347,
+  0xc4db, 0xb348,
+  0xc4dc, 0xb349,
+  0xc4dd, 0xb34a,
+  0xc4de, 0xb34b,
+  0xc4df, 0xb34c,
+  0xc4e0, 0xb34d,
+  0xc4e1, 0xb34e,
+  0xc4e2, 0xb34f,
+  0xc4e3, 0xb350,
+  0xc4e4, 0xb351,
+  0xc4e5, 0xb353,
+  0xc4e6, 0xb354,
+  0xc4e7, 0xb355,
+  0xc4e8, 0xb356,
+  0xc4e9, 0xb357,
+  0xc4ea, 0xb358,
+  0xc4eb, 0xb359,
+  0xc4ec, 0xb35a,
+  0xc4ed, 0xb35b,
+  0xc4ee, 0xb35c,
+  0xc4ef, 0xb35d,
+  0xc4f0, 0xb361,
+  0xc4f1, 0xb362,
+  0xc4f2, 0xb363,
+  0xc4f3, 0xb364,
+  0xc4f4, 0xb365,
+  0xc4f5, 0xb366,
+  0xc4f6, 0xb367,
+  0xc4f7, 0xb368,
+  0xc4f8, 0xb369,
+  0xc4f9, 0xb36a,
+  0xc4fa, 0xb36b,
+  0xc4fb, 0xb36c,
+  0xc4fc, 0xb36d,
+  0xc4fd, 0xb36e,
+  0xc4fe, 0xb36f,
+  0xc4ff, 0xb370,
+  0xc500, 0xb371,
+  0xc501, 0xb373,
+  0xc502, 0xb374,
+  0xc503, 0xb375,
+  0xc504, 0xb376,
+  0xc505, 0xb377,
+  0xc506, 0xb378,
+  0xc507, 0xb379,
+  0xc508, 0xb37a,
+  0xc509, 0xb37b,
+  0xc50a, 0xb37c,
+  0xc50b, 0xb37d,
+  0xc50c, 0xb381,
+  0xc50d, 0xb382,
+  0xc50e, 0xb383,
+  0xc50f, 0xb384,
+  0xc510, 0xb385,
+  0xc511, 0xb386,
+  0xc512, 0xb387,
+  0xc513, 0xb388,
+  0xc514, 0xb389,
+  0xc515, 0xb38a,
+  0xc516, 0xb38b,
+  0xc517, 0xb38c,
+  0xc518, 0xb38d,
+  0xc519, 0xb38e,
+  0xc51a, 0xb38f,
+  0xc51b, 0xb390,
+  0xc51c, 0xb391,
+  0xc51d, 0xb393,
+  0xc51e, 0xb394,
+  0xc51f, 0xb395,
+  0xc520, 0xb396,
+  0xc521, 0xb397,
+  0xc522, 0xb398,
+  0xc523, 0xb399,
+  0xc524, 0xb39a,
+  0xc525, 0xb39b,
+  0xc526, 0xb39c,
+  0xc527, 0xb39d,
+  0xc528, 0xb3a1,
+  0xc529, 0xb3a2,
+  0xc52a, 0xb3a3,
+  0xc52b, 0xb3a4,
+  0xc52c, 0xb3a5,
+  0xc52d, 0xb3a6,
+  0xc52e, 0xb3a7,
+  0xc52f, 0xb3a8,
+  0xc530, 0xb3a9,
+  0xc531, 0xb3aa,
+  0xc532, 0xb3ab,
+  0xc533, 0xb3ac,
+  0xc534, 0xb3ad,
+  0xc535, 0xb3ae,
+  0xc536, 0xb3af,
+  0xc537, 0xb3b0,
+  0xc538, 0xb3b1,
+  0xc539, 0xb3b3,
+  0xc53a, 0xb3b4,
+  0xc53b, 0xb3b5,
+  0xc53c, 0xb3b6,
+  0xc53d, 0xb3b7,
+  0xc53e, 0xb3b8,
+  0xc53f, 0xb3b9,
+  0xc540, 0xb3ba,
+  0xc541, 0xb3bb,
+  0xc542, 0xb3bc,
+  0xc543, 0xb3bd,
+  0xc544, 0xb461,
+  0xc545, 0xb462,
+  0xc546, 0xb463,
+  0xc547, 0xb464,
+  0xc548, 0xb465,
+  0xc549, 0xb466,
+  0xc54a, 0xb467,
+  0xc54b, 0xb468,
+  0xc54c, 0xb469,
+  0xc54d, 0xb46a,
+  0xc54e, 0xb46b,
+  0xc54f, 0xb46c,
+  0xc550, 0xb46d,
+  0xc551, 0xb46e,
+  0xc552, 0xb46f,
+  0xc553, 0xb470,
+  0xc554, 0xb471,
+  0xc555, 0xb473,
+  0xc556, 0xb474,
+  0xc557, 0xb475,
+  0xc558, 0xb476,
+  0xc559, 0xb477,
+  0xc55a, 0xb478,
+  0xc55b, 0xb479,
+  0xc55c, 0xb47a,
+  0xc55d, 0xb47b,
+  0xc55e, 0xb47c,
+  0xc55f, 0xb47d,
+  0xc560, 0xb481,
+  0xc561, 0xb482,
+  0xc562, 0xb483,
+  0xc563, 0xb484,
+  0xc564, 0xb485,
+  0xc565, 0xb486,
+  0xc566, 0xb487,
+  0xc567, 0xb488,
+  0xc568, 0xb489,
+  0xc569, 0xb48a,
+  0xc56a, 0xb48b,
+  0xc56b, 0xb48c,
+  0xc56c, 0xb48d,
+  0xc56d, 0xb48e,
+  0xc56e, 0xb48f,
+  0xc56f, 0xb490,
+  0xc570, 0xb491,
+  0xc571, 0xb493,
+  0xc572, 0xb494,
+  0xc573, 0xb495,
+  0xc574, 0xb496,
+  0xc575, 0xb497,
+  0xc576, 0xb498,
+  0xc577, 0xb499,
+  0xc578, 0xb49a,
+  0xc579, 0xb49b,
+  0xc57a, 0xb49c,
+  0xc57b, 0xb49d,
+  0xc57c, 0xb4a1,
+  0xc57d, 0xb4a2,
+  0xc57e, 0xb4a3,
+  0xc57f, 0xb4a4,
+  0xc580, 0xb4a5,
+  0xc581, 0xb4a6,
+  0xc582, 0xb4a7,
+  0xc583, 0xb4a8,
+  0xc584, 0xb4a9,
+  0xc585, 0xb4aa,
+  0xc586, 0xb4ab,
+  0xc587, 0xb4ac,
+  0xc588, 0xb4ad,
+  0xc589, 0xb4ae,
+  0xc58a, 0xb4af,
+  0xc58b, 0xb4b0,
+  0xc58c, 0xb4b1,
+  0xc58d, 0xb4b3,
+  0xc58e, 0xb4b4,
+  0xc58f, 0xb4b5,
+  0xc590, 0xb4b6,
+  0xc591, 0xb4b7,
+  0xc592, 0xb4b8,
+  0xc593, 0xb4b9,
+  0xc594, 0xb4ba,
+  0xc595, 0xb4bb,
+  0xc596, 0xb4bc,
+  0xc597, 0xb4bd,
+  0xc598, 0xb4c1,
+  0xc599, 0xb4c2,
+  0xc59a, 0xb4c3,
+  0xc59b, 0xb4c4,
+  0xc59c, 0xb4c5,
+  0xc59d, 0xb4c6,
+  0xc59e, 0xb4c7,
+  0xc59f, 0xb4c8,
+  0xc5a0, 0xb4c9,
+  0xc5a1, 0xb4ca,
+  0xc5a2, 0xb4cb,
+  0xc5a3, 0xb4cc,
+  0xc5a4, 0xb4cd,
+  0xc5a5, 0xb4ce,
+  0xc5a6, 0xb4cf,
+  0xc5a7, 0xb4d0,
+  0xc5a8, 0xb4d1,
+  0xc5a9, 0xb4d3,
+  0xc5aa, 0xb4d4,
+  0xc5ab, 0xb4d5,
+  0xc5ac, 0xb4d6,
+  0xc5ad, 0xb4d7,
+  0xc5ae, 0xb4d8,
+  0xc5af, 0xb4d9,
+  0xc5b0, 0xb4da,
+  0xc5b1, 0xb4db,
+  0xc5b2, 0xb4dc,
+  0xc5b3, 0xb4dd,
+  0xc5b4, 0xb4e1,
+  0xc5b5, 0xb4e2,
+  0xc5b6, 0xb4e3,
+  0xc5b7, 0xb4e4,
+  0xc5b8, 0xb4e5,
+  0xc5b9, 0xb4e6,
+  0xc5ba, 0xb4e7,
+  0xc5bb, 0xb4e8,
+  0xc5bc, 0xb4e9,
+  0xc5bd, 0xb4ea,
+  0xc5be, 0xb4eb,
+  0xc5bf, 0xb4ec,
+  0xc5c0, 0xb4ed,
+  0xc5c1, 0xb4ee,
+  0xc5c2, 0xb4ef,
+  0xc5c3, 0xb4f0,
+  0xc5c4, 0xb4f1,
+  0xc5c5, 0xb4f3,
+  0xc5c6, 0xb4f4,
+  0xc5c7, 0xb4f5,
+  0xc5c8, 0xb4f6,
+  0xc5c9, 0xb4f7,
+  0xc5ca, 0xb4f8,
+  0xc5cb, 0xb4f9,
+  0xc5cc, 0xb4fa,
+  0xc5cd, 0xb4fb,
+  0xc5ce, 0xb4fc,
+  0xc5cf, 0xb4fd,
+  0xc5d0, 0xb541,
+  0xc5d1, 0xb542,
+  0xc5d2, 0xb543,
+  0xc5d3, 0xb544,
+  0xc5d4, 0xb545,
+  0xc5d5, 0xb546,
+  0xc5d6, 0xb547,
+  0xc5d7, 0xb548,
+  0xc5d8, 0xb549,
+  0xc5d9, 0xb54a,
+  0xc5da, 0xb54b,
+  0xc5db, 0xb54c,
+  0xc5dc, 0xb54d,
+  0xc5dd, 0xb54e,
+  0xc5de, 0xb54f,
+  0xc5df, 0xb550,
+  0xc5e0, 0xb551,
+  0xc5e1, 0xb553,
+  0xc5e2, 0xb554,
+  0xc5e3, 0xb555,
+  0xc5e4, 0xb556,
+  0xc5e5, 0xb557,
+  0xc5e6, 0xb558,
+  0xc5e7, 0xb559,
+  0xc5e8, 0xb55a,
+  0xc5e9, 0xb55b,
+  0xc5ea, 0xb55c,
+  0xc5eb, 0xb55d,
+  0xc5ec, 0xb561,
+  0xc5ed, 0xb562,
+  0xc5ee, 0xb563,
+  0xc5ef, 0xb564,
+  0xc5f0, 0xb565,
+  0xc5f1, 0xb566,
+  0xc5f2, 0xb567,
+  0xc5f3, 0xb568,
+  0xc5f4, 0xb569,
+  0xc5f5, 0xb56a,
+  0xc5f6, 0xb56b,
+  0xc5f7, 0xb56c,
+  0xc5f8, 0xb56d,
+  0xc5f9, 0xb56e,
+  0xc5fa, 0xb56f,
+  0xc5fb, 0xb570,
+  0xc5fc, 0xb571,
+  0xc5fd, 0xb573,
+  0xc5fe, 0xb574,
+  0xc5ff, 0xb575,
+  0xc600, 0xb576,
+  0xc601, 0xb577,
+  0xc602, 0xb578,
+  0xc603, 0xb579,
+  0xc604, 0xb57a,
+  0xc605, 0xb57b,
+  0xc606, 0xb57c,
+  0xc607, 0xb57d,
+  0xc608, 0xb581,
+  0xc609, 0xb582,
+  0xc60a, 0xb583,
+  0xc60b, 0xb584,
+  0xc60c, 0xb585,
+  0xc60d, 0xb586,
+  0xc60e, 0xb587,
+  0xc60f, 0xb588,
+  0xc610, 0xb589,
+  0xc611, 0xb58a,
+  0xc612, 0xb58b,
+  0xc613, 0xb58c,
+  0xc614, 0xb58d,
+  0xc615, 0xb58e,
+  0xc616, 0xb58f,
+  0xc617, 0xb590,
+  0xc618, 0xb591,
+  0xc619, 0xb593,
+  0xc61a, 0xb594,
+  0xc61b, 0xb595,
+  0xc61c, 0xb596,
+  0xc61d, 0xb597,
+  0xc61e, 0xb598,
+  0xc61f, 0xb599,
+  0xc620, 0xb59a,
+  0xc621, 0xb59b,
+  0xc622, 0xb59c,
+  0xc623, 0xb59d,
+  0xc624, 0xb5a1,
+  0xc625, 0xb5a2,
+  0xc626, 0xb5a3,
+  0xc627, 0xb5a4,
+  0xc628, 0xb5a5,
+  0xc629, 0xb5a6,
+  0xc62a, 0xb5a7,
+  0xc62b, 0xb5a8,
+  0xc62c, 0xb5a9,
+  0xc62d, 0xb5aa,
+  0xc62e, 0xb5ab,
+  0xc62f, 0xb5ac,
+  0xc630, 0xb5ad,
+  0xc631, 0xb5ae,
+  0xc632, 0xb5af,
+  0xc633, 0xb5b0,
+  0xc634, 0xb5b1,
+  0xc635, 0xb5b3,
+  0xc636, 0xb5b4,
+  0xc637, 0xb5b5,
+  0xc638, 0xb5b6,
+  0xc639, 0xb5b7,
+  0xc63a, 0xb5b8,
+  0xc63b, 0xb5b9,
+  0xc63c, 0xb5ba,
+  0xc63d, 0xb5bb,
+  0xc63e, 0xb5bc,
+  0xc63f, 0xb5bd,
+  0xc640, 0xb5c1,
+  0xc641, 0xb5c2,
+  0xc642, 0xb5c3,
+  0xc643, 0xb5c4,
+  0xc644, 0xb5c5,
+  0xc645, 0xb5c6,
+  0xc646, 0xb5c7,
+  0xc647, 0xb5c8,
+  0xc648, 0xb5c9,
+  0xc649, 0xb5ca,
+  0xc64a, 0xb5cb,
+  0xc64b, 0xb5cc,
+  0xc64c, 0xb5cd,
+  0xc64d, 0xb5ce,
+  0xc64e, 0xb5cf,
+  0xc64f, 0xb5d0,
+  0xc650, 0xb5d1,
+  0xc651, 0xb5d3,
+  0xc652, 0xb5d4,
+  0xc653, 0xb5d5,
+  0xc654, 0xb5d6,
+  0xc655, 0xb5d7,
+  0xc656, 0xb5d8,
+  0xc657, 0xb5d9,
+  0xc658, 0xb5da,
+  0xc659, 0xb5db,
+  0xc65a, 0xb5dc,
+  0xc65b, 0xb5dd,
+  0xc65c, 0xb5e1,
+  0xc65d, 0xb5e2,
+  0xc65e, 0xb5e3,
+  0xc65f, 0xb5e4,
+  0xc660, 0xb5e5,
+  0xc661, 0xb5e6,
+  0xc662, 0xb5e7,
+  0xc663, 0xb5e8,
+  0xc664, 0xb5e9,
+  0xc665, 0xb5ea,
+  0xc666, 0xb5eb,
+  0xc667, 0xb5ec,
+  0xc668, 0xb5ed,
+  0xc669, 0xb5ee,
+  0xc66a, 0xb5ef,
+  0xc66b, 0xb5f0,
+  0xc66c, 0xb5f1,
+  0xc66d, 0xb5f3,
+  0xc66e, 0xb5f4,
+  0xc66f, 0xb5f5,
+  0xc670, 0xb5f6,
+  0xc671, 0xb5f7,
+  0xc672, 0xb5f8,
+  0xc673, 0xb5f9,
+  0xc674, 0xb5fa,
+  0xc675, 0xb5fb,
+  0xc676, 0xb5fc,
+  0xc677, 0xb5fd,
+  0xc678, 0xb641,
+  0xc679, 0xb642,
+  0xc67a, 0xb643,
+  0xc67b, 0xb644,
+  0xc67c, 0xb645,
+  0xc67d, 0xb646,
+  0xc67e, 0xb647,
+  0xc67f, 0xb648,
+  0xc680, 0xb649,
+  0xc681, 0xb64a,
+  0xc682, 0xb64b,
+  0xc683, 0xb64c,
+  0xc684, 0xb64d,
+  0xc685, 0xb64e,
+  0xc686, 0xb64f,
+  0xc687, 0xb650,
+  0xc688, 0xb651,
+  0xc689, 0xb653,
+  0xc68a, 0xb654,
+  0xc68b, 0xb655,
+  0xc68c, 0xb656,
+  0xc68d, 0xb657,
+  0xc68e, 0xb658,
+  0xc68f, 0xb659,
+  0xc690, 0xb65a,
+  0xc691, 0xb65b,
+  0xc692, 0xb65c,
+  0xc693, 0xb65d,
+  0xc694, 0xb661,
+  0xc695, 0xb662,
+  0xc696, 0xb663,
+  0xc697, 0xb664,
+  0xc698, 0xb665,
+  0xc699, 0xb666,
+  0xc69a, 0xb667,
+  0xc69b, 0xb668,
+  0xc69c, 0xb669,
+  0xc69d, 0xb66a,
+  0xc69e, 0xb66b,
+  0xc69f, 0xb66c,
+  0xc6a0, 0xb66d,
+  0xc6a1, 0xb66e,
+  0xc6a2, 0xb66f,
+  0xc6a3, 0xb670,
+  0xc6a4, 0xb671,
+  0xc6a5, 0xb673,
+  0xc6a6, 0xb674,
+  0xc6a7, 0xb675,
+  0xc6a8, 0xb676,
+  0xc6a9, 0xb677,
+  0xc6aa, 0xb678,
+  0xc6ab, 0xb679,
+  0xc6ac, 0xb67a,
+  0xc6ad, 0xb67b,
+  0xc6ae, 0xb67c,
+  0xc6af, 0xb67d,
+  0xc6b0, 0xb681,
+  0xc6b1, 0xb682,
+  0xc6b2, 0xb683,
+  0xc6b3, 0xb684,
+  0xc6b4, 0xb685,
+  0xc6b5, 0xb686,
+  0xc6b6, 0xb687,
+  0xc6b7, 0xb688,
+  0xc6b8, 0xb689,
+  0xc6b9, 0xb68a,
+  0xc6ba, 0xb68b,
+  0xc6bb, 0xb68c,
+  0xc6bc, 0xb68d,
+  0xc6bd, 0xb68e,
+  0xc6be, 0xb68f,
+  0xc6bf, 0xb690,
+  0xc6c0, 0xb691,
+  0xc6c1, 0xb693,
+  0xc6c2, 0xb694,
+  0xc6c3, 0xb695,
+  0xc6c4, 0xb696,
+  0xc6c5, 0xb697,
+  0xc6c6, 0xb698,
+  0xc6c7, 0xb699,
+  0xc6c8, 0xb69a,
+  0xc6c9, 0xb69b,
+  0xc6ca, 0xb69c,
+  0xc6cb, 0xb69d,
+  0xc6cc, 0xb6a1,
+  0xc6cd, 0xb6a2,
+  0xc6ce, 0xb6a3,
+  0xc6cf, 0xb6a4,
+  0xc6d0, 0xb6a5,
+  0xc6d1, 0xb6a6,
+  0xc6d2, 0xb6a7,
+  0xc6d3, 0xb6a8,
+  0xc6d4, 0xb6a9,
+  0xc6d5, 0xb6aa,
+  0xc6d6, 0xb6ab,
+  0xc6d7, 0xb6ac,
+  0xc6d8, 0xb6ad,
+  0xc6d9, 0xb6ae,
+  0xc6da, 0xb6af,
+  0xc6db, 0xb6b0,
+  0xc6dc, 0xb6b1,
+  0xc6dd, 0xb6b3,
+  0xc6de, 0xb6b4,
+  0xc6df, 0xb6b5,
+  0xc6e0, 0xb6b6,
+  0xc6e1, 0xb6b7,
+  0xc6e2, 0xb6b8,
+  0xc6e3, 0xb6b9,
+  0xc6e4, 0xb6ba,
+  0xc6e5, 0xb6bb,
+  0xc6e6, 0xb6bc,
+  0xc6e7, 0xb6bd,
+  0xc6e8, 0xb6c1,
+  0xc6e9, 0xb6c2,
+  0xc6ea, 0xb6c3,
+  0xc6eb, 0xb6c4,
+  0xc6ec, 0xb6c5,
+  0xc6ed, 0xb6c6,
+  0xc6ee, 0xb6c7,
+  0xc6ef, 0xb6c8,
+  0xc6f0, 0xb6c9,
+  0xc6f1, 0xb6ca,
+  0xc6f2, 0xb6cb,
+  0xc6f3, 0xb6cc,
+  0xc6f4, 0xb6cd,
+  0xc6f5, 0xb6ce,
+  0xc6f6, 0xb6cf,
+  0xc6f7, 0xb6d0,
+  0xc6f8, 0xb6d1,
+  0xc6f9, 0xb6d3,
+  0xc6fa, 0xb6d4,
+  0xc6fb, 0xb6d5,
+  0xc6fc, 0xb6d6,
+  0xc6fd, 0xb6d7,
+  0xc6fe, 0xb6d8,
+  0xc6ff, 0xb6d9,
+  0xc700, 0xb6da,
+  0xc701, 0xb6db,
+  0xc702, 0xb6dc,
+  0xc703, 0xb6dd,
+  0xc704, 0xb6e1,
+  0xc705, 0xb6e2,
+  0xc706, 0xb6e3,
+  0xc707, 0xb6e4,
+  0xc708, 0xb6e5,
+  0xc709, 0xb6e6,
+  0xc70a, 0xb6e7,
+  0xc70b, 0xb6e8,
+  0xc70c, 0xb6e9,
+  0xc70d, 0xb6ea,
+  0xc70e, 0xb6eb,
+  0xc70f, 0xb6ec,
+  0xc710, 0xb6ed,
+  0xc711, 0xb6ee,
+  0xc712, 0xb6ef,
+  0xc713, 0xb6f0,
+  0xc714, 0xb6f1,
+  0xc715, 0xb6f3,
+  0xc716, 0xb6f4,
+  0xc717, 0xb6f5,
+  0xc718, 0xb6f6,
+  0xc719, 0xb6f7,
+  0xc71a, 0xb6f8,
+  0xc71b, 0xb6f9,
+  0xc71c, 0xb6fa,
+  0xc71d, 0xb6fb,
+  0xc71e, 0xb6fc,
+  0xc71f, 0xb6fd,
+  0xc720, 0xb741,
+  0xc721, 0xb742,
+  0xc722, 0xb743,
+  0xc723, 0xb744,
+  0xc724, 0xb745,
+  0xc725, 0xb746,
+  0xc726, 0xb747,
+  0xc727, 0xb748,
+  0xc728, 0xb749,
+  0xc729, 0xb74a,
+  0xc72a, 0xb74b,
+  0xc72b, 0xb74c,
+  0xc72c, 0xb74d,
+  0xc72d, 0xb74e,
+  0xc72e, 0xb74f,
+  0xc72f, 0xb750,
+  0xc730, 0xb751,
+  0xc731, 0xb753,
+  0xc732, 0xb754,
+  0xc733, 0xb755,
+  0xc734, 0xb756,
+  0xc735, 0xb757,
+  0xc736, 0xb758,
+  0xc737, 0xb759,
+  0xc738, 0xb75a,
+  0xc739, 0xb75b,
+  0xc73a, 0xb75c,
+  0xc73b, 0xb75d,
+  0xc73c, 0xb761,
+  0xc73d, 0xb762,
+  0xc73e, 0xb763,
+  0xc73f, 0xb764,
+  0xc740, 0xb765,
+  0xc741, 0xb766,
+  0xc742, 0xb767,
+  0xc743, 0xb768,
+  0xc744, 0xb769,
+  0xc745, 0xb76a,
+  0xc746, 0xb76b,
+  0xc747, 0xb76c,
+  0xc748, 0xb76d,
+  0xc749, 0xb76e,
+  0xc74a, 0xb76f,
+  0xc74b, 0xb770,
+  0xc74c, 0xb771,
+  0xc74d, 0xb773,
+  0xc74e, 0xb774,
+  0xc74f, 0xb775,
+  0xc750, 0xb776,
+  0xc751, 0xb777,
+  0xc752, 0xb778,
+  0xc753, 0xb779,
+  0xc754, 0xb77a,
+  0xc755, 0xb77b,
+  0xc756, 0xb77c,
+  0xc757, 0xb77d,
+  0xc758, 0xb781,
+  0xc759, 0xb782,
+  0xc75a, 0xb783,
+  0xc75b, 0xb784,
+  0xc75c, 0xb785,
+  0xc75d, 0xb786,
+  0xc75e, 0xb787,
+  0xc75f, 0xb788,
+  0xc760, 0xb789,
+  0xc761, 0xb78a,
+  0xc762, 0xb78b,
+  0xc763, 0xb78c,
+  0xc764, 0xb78d,
+  0xc765, 0xb78e,
+  0xc766, 0xb78f,
+  0xc767, 0xb790,
+  0xc768, 0xb791,
+  0xc769, 0xb793,
+  0xc76a, 0xb794,
+  0xc76b, 0xb795,
+  0xc76c, 0xb796,
+  0xc76d, 0xb797,
+  0xc76e, 0xb798,
+  0xc76f, 0xb799,
+  0xc770, 0xb79a,
+  0xc771, 0xb79b,
+  0xc772, 0xb79c,
+  0xc773, 0xb79d,
+  0xc774, 0xb7a1,
+  0xc775, 0xb7a2,
+  0xc776, 0xb7a3,
+  0xc777, 0xb7a4,
+  0xc778, 0xb7a5,
+  0xc779, 0xb7a6,
+  0xc77a, 0xb7a7,
+  0xc77b, 0xb7a8,
+  0xc77c, 0xb7a9,
+  0xc77d, 0xb7aa,
+  0xc77e, 0xb7ab,
+  0xc77f, 0xb7ac,
+  0xc780, 0xb7ad,
+  0xc781, 0xb7ae,
+  0xc782, 0xb7af,
+  0xc783, 0xb7b0,
+  0xc784, 0xb7b1,
+  0xc785, 0xb7b3,
+  0xc786, 0xb7b4,
+  0xc787, 0xb7b5,
+  0xc788, 0xb7b6,
+  0xc789, 0xb7b7,
+  0xc78a, 0xb7b8,
+  0xc78b, 0xb7b9,
+  0xc78c, 0xb7ba,
+  0xc78d, 0xb7bb,
+  0xc78e, 0xb7bc,
+  0xc78f, 0xb7bd,
+  0xc790, 0xb861,
+  0xc791, 0xb862,
+  0xc792, 0xb863,
+  0xc793, 0xb864,
+  0xc794, 0xb865,
+  0xc795, 0xb866,
+  0xc796, 0xb867,
+  0xc797, 0xb868,
+  0xc798, 0xb869,
+  0xc799, 0xb86a,
+  0xc79a, 0xb86b,
+  0xc79b, 0xb86c,
+  0xc79c, 0xb86d,
+  0xc79d, 0xb86e,
+  0xc79e, 0xb86f,
+  0xc79f, 0xb870,
+  0xc7a0, 0xb871,
+  0xc7a1, 0xb873,
+  0xc7a2, 0xb874,
+  0xc7a3, 0xb875,
+  0xc7a4, 0xb876,
+  0xc7a5, 0xb877,
+  0xc7a6, 0xb878,
+  0xc7a7, 0xb879,
+  0xc7a8, 0xb87a,
+  0xc7a9, 0xb87b,
+  0xc7aa, 0xb87c,
+  0xc7ab, 0xb87d,
+  0xc7ac, 0xb881,
+  0xc7ad, 0xb882,
+  0xc7ae, 0xb883,
+  0xc7af, 0xb884,
+  0xc7b0, 0xb885,
+  0xc7b1, 0xb886,
+  0xc7b2, 0xb887,
+  0xc7b3, 0xb888,
+  0xc7b4, 0xb889,
+  0xc7b5, 0xb88a,
+  0xc7b6, 0xb88b,
+  0xc7b7, 0xb88c,
+  0xc7b8, 0xb88d,
+  0xc7b9, 0xb88e,
+  0xc7ba, 0xb88f,
+  0xc7bb, 0xb890,
+  0xc7bc, 0xb891,
+  0xc7bd, 0xb893,
+  0xc7be, 0xb894,
+  0xc7bf, 0xb895,
+  0xc7c0, 0xb896,
+  0xc7c1, 0xb897,
+  0xc7c2, 0xb898,
+  0xc7c3, 0xb899,
+  0xc7c4, 0xb89a,
+  0xc7c5, 0xb89b,
+  0xc7c6, 0xb89c,
+  0xc7c7, 0xb89d,
+  0xc7c8, 0xb8a1,
+  0xc7c9, 0xb8a2,
+  0xc7ca, 0xb8a3,
+  0xc7cb, 0xb8a4,
+  0xc7cc, 0xb8a5,
+  0xc7cd, 0xb8a6,
+  0xc7ce, 0xb8a7,
+  0xc7cf, 0xb8a8,
+  0xc7d0, 0xb8a9,
+  0xc7d1, 0xb8aa,
+  0xc7d2, 0xb8ab,
+  0xc7d3, 0xb8ac,
+  0xc7d4, 0xb8ad,
+  0xc7d5, 0xb8ae,
+  0xc7d6, 0xb8af,
+  0xc7d7, 0xb8b0,
+  0xc7d8, 0xb8b1,
+  0xc7d9, 0xb8b3,
+  0xc7da, 0xb8b4,
+  0xc7db, 0xb8b5,
+  0xc7dc, 0xb8b6,
+  0xc7dd, 0xb8b7,
+  0xc7de, 0xb8b8,
+  0xc7df, 0xb8b9,
+  0xc7e0, 0xb8ba,
+  0xc7e1, 0xb8bb,
+  0xc7e2, 0xb8bc,
+  0xc7e3, 0xb8bd,
+  0xc7e4, 0xb8c1,
+  0xc7e5, 0xb8c2,
+  0xc7e6, 0xb8c3,
+  0xc7e7, 0xb8c4,
+  0xc7e8, 0xb8c5,
+  0xc7e9, 0xb8c6,
+  0xc7ea, 0xb8c7,
+  0xc7eb, 0xb8c8,
+  0xc7ec, 0xb8c9,
+  0xc7ed, 0xb8ca,
+  0xc7ee, 0xb8cb,
+  0xc7ef, 0xb8cc,
+  0xc7f0, 0xb8cd,
+  0xc7f1, 0xb8ce,
+  0xc7f2, 0xb8cf,
+  0xc7f3, 0xb8d0,
+  0xc7f4, 0xb8d1,
+  0xc7f5, 0xb8d3,
+  0xc7f6, 0xb8d4,
+  0xc7f7, 0xb8d5,
+  0xc7f8, 0xb8d6,
+  0xc7f9, 0xb8d7,
+  0xc7fa, 0xb8d8,
+  0xc7fb, 0xb8d9,
+  0xc7fc, 0xb8da,
+  0xc7fd, 0xb8db,
+  0xc7fe, 0xb8dc,
+  0xc7ff, 0xb8dd,
+  0xc800, 0xb8e1,
+  0xc801, 0xb8e2,
+  0xc802, 0xb8e3,
+  0xc803, 0xb8e4,
+  0xc804, 0xb8e5,
+  0xc805, 0xb8e6,
+  0xc806, 0xb8e7,
+  0xc807, 0xb8e8,
+  0xc808, 0xb8e9,
+  0xc809, 0xb8ea,
+  0xc80a, 0xb8eb,
+  0xc80b, 0xb8ec,
+  0xc80c, 0xb8ed,
+  0xc80d, 0xb8ee,
+  0xc80e, 0xb8ef,
+  0xc80f, 0xb8f0,
+  0xc810, 0xb8f1,
+  0xc811, 0xb8f3,
+  0xc812, 0xb8f4,
+  0xc813, 0xb8f5,
+  0xc814, 0xb8f6,
+  0xc815, 0xb8f7,
+  0xc816, 0xb8f8,
+  0xc817, 0xb8f9,
+  0xc818, 0xb8fa,
+  0xc819, 0xb8fb,
+  0xc81a, 0xb8fc,
+  0xc81b, 0xb8fd,
+  0xc81c, 0xb941,
+  0xc81d, 0xb942,
+  0xc81e, 0xb943,
+  0xc81f, 0xb944,
+  0xc820, 0xb945,
+  0xc821, 0xb946,
+  0xc822, 0xb947,
+  0xc823, 0xb948,
+  0xc824, 0xb949,
+  0xc825, 0xb94a,
+  0xc826, 0xb94b,
+  0xc827, 0xb94c,
+  0xc828, 0xb94d,
+  0xc829, 0xb94e,
+  0xc82a, 0xb94f,
+  0xc82b, 0xb950,
+  0xc82c, 0xb951,
+  0xc82d, 0xb953,
+  0xc82e, 0xb954,
+  0xc82f, 0xb955,
+  0xc830, 0xb956,
+  0xc831, 0xb957,
+  0xc832, 0xb958,
+  0xc833, 0xb959,
+  0xc834, 0xb95a,
+  0xc835, 0xb95b,
+  0xc836, 0xb95c,
+  0xc837, 0xb95d,
+  0xc838, 0xb961,
+  0xc839, 0xb962,
+  0xc83a, 0xb963,
+  0xc83b, 0xb964,
+  0xc83c, 0xb965,
+  0xc83d, 0xb966,
+  0xc83e, 0xb967,
+  0xc83f, 0xb968,
+  0xc840, 0xb969,
+  0xc841, 0xb96a,
+  0xc842, 0xb96b,
+  0xc843, 0xb96c,
+  0xc844, 0xb96d,
+  0xc845, 0xb96e,
+  0xc846, 0xb96f,
+  0xc847, 0xb970,
+  0xc848, 0xb971,
+  0xc849, 0xb973,
+  0xc84a, 0xb974,
+  0xc84b, 0xb975,
+  0xc84c, 0xb976,
+  0xc84d, 0xb977,
+  0xc84e, 0xb978,
+  0xc84f, 0xb979,
+  0xc850, 0xb97a,
+  0xc851, 0xb97b,
+  0xc852, 0xb97c,
+  0xc853, 0xb97d,
+  0xc854, 0xb981,
+  0xc855, 0xb982,
+  0xc856, 0xb983,
+  0xc857, 0xb984,
+  0xc858, 0xb985,
+  0xc859, 0xb986,
+  0xc85a, 0xb987,
+  0xc85b, 0xb988,
+  0xc85c, 0xb989,
+  0xc85d, 0xb98a,
+  0xc85e, 0xb98b,
+  0xc85f, 0xb98c,
+  0xc860, 0xb98d,
+  0xc861, 0xb98e,
+  0xc862, 0xb98f,
+  0xc863, 0xb990,
+  0xc864, 0xb991,
+  0xc865, 0xb993,
+  0xc866, 0xb994,
+  0xc867, 0xb995,
+  0xc868, 0xb996,
+  0xc869, 0xb997,
+  0xc86a, 0xb998,
+  0xc86b, 0xb999,
+  0xc86c, 0xb99a,
+  0xc86d, 0xb99b,
+  0xc86e, 0xb99c,
+  0xc86f, 0xb99d,
+  0xc870, 0xb9a1,
+  0xc871, 0xb9a2,
+  0xc872, 0xb9a3,
+  0xc873, 0xb9a4,
+  0xc874, 0xb9a5,
+  0xc875, 0xb9a6,
+  0xc876, 0xb9a7,
+  0xc877, 0xb9a8,
+  0xc878, 0xb9a9,
+  0xc879, 0xb9aa,
+  0xc87a, 0xb9ab,
+  0xc87b, 0xb9ac,
+  0xc87c, 0xb9ad,
+  0xc87d, 0xb9ae,
+  0xc87e, 0xb9af,
+  0xc87f, 0xb9b0,
+  0xc880, 0xb9b1,
+  0xc881, 0xb9b3,
+  0xc882, 0xb9b4,
+  0xc883, 0xb9b5,
+  0xc884, 0xb9b6,
+  0xc885, 0xb9b7,
+  0xc886, 0xb9b8,
+  0xc887, 0xb9b9,
+  0xc888, 0xb9ba,
+  0xc889, 0xb9bb,
+  0xc88a, 0xb9bc,
+  0xc88b, 0xb9bd,
+  0xc88c, 0xb9c1,
+  0xc88d, 0xb9c2,
+  0xc88e, 0xb9c3,
+  0xc88f, 0xb9c4,
+  0xc890, 0xb9c5,
+  0xc891, 0xb9c6,
+  0xc892, 0xb9c7,
+  0xc893, 0xb9c8,
+  0xc894, 0xb9c9,
+  0xc895, 0xb9ca,
+  0xc896, 0xb9cb,
+  0xc897, 0xb9cc,
+  0xc898, 0xb9cd,
+  0xc899, 0xb9ce,
+  0xc89a, 0xb9cf,
+  0xc89b, 0xb9d0,
+  0xc89c, 0xb9d1,
+  0xc89d, 0xb9d3,
+  0xc89e, 0xb9d4,
+  0xc89f, 0xb9d5,
+  0xc8a0, 0xb9d6,
+  0xc8a1, 0xb9d7,
+  0xc8a2, 0xb9d8,
+  0xc8a3, 0xb9d9,
+  0xc8a4, 0xb9da,
+  0xc8a5, 0xb9db,
+  0xc8a6, 0xb9dc,
+  0xc8a7, 0xb9dd,
+  0xc8a8, 0xb9e1,
+  0xc8a9, 0xb9e2,
+  0xc8aa, 0xb9e3,
+  0xc8ab, 0xb9e4,
+  0xc8ac, 0xb9e5,
+  0xc8ad, 0xb9e6,
+  0xc8ae, 0xb9e7,
+  0xc8af, 0xb9e8,
+  0xc8b0, 0xb9e9,
+  0xc8b1, 0xb9ea,
+  0xc8b2, 0xb9eb,
+  0xc8b3, 0xb9ec,
+  0xc8b4, 0xb9ed,
+  0xc8b5, 0xb9ee,
+  0xc8b6, 0xb9ef,
+  0xc8b7, 0xb9f0,
+  0xc8b8, 0xb9f1,
+  0xc8b9, 0xb9f3,
+  0xc8ba, 0xb9f4,
+  0xc8bb, 0xb9f5,
+  0xc8bc, 0xb9f6,
+  0xc8bd, 0xb9f7,
+  0xc8be, 0xb9f8,
+  0xc8bf, 0xb9f9,
+  0xc8c0, 0xb9fa,
+  0xc8c1, 0xb9fb,
+  0xc8c2, 0xb9fc,
+  0xc8c3, 0xb9fd,
+  0xc8c4, 0xba41,
+  0xc8c5, 0xba42,
+  0xc8c6, 0xba43,
+  0xc8c7, 0xba44,
+  0xc8c8, 0xba45,
+  0xc8c9, 0xba46,
+  0xc8ca, 0xba47,
+  0xc8cb, 0xba48,
+  0xc8cc, 0xba49,
+  0xc8cd, 0xba4a,
+  0xc8ce, 0xba4b,
+  0xc8cf, 0xba4c,
+  0xc8d0, 0xba4d,
+  0xc8d1, 0xba4e,
+  0xc8d2, 0xba4f,
+  0xc8d3, 0xba50,
+  0xc8d4, 0xba51,
+  0xc8d5, 0xba53,
+  0xc8d6, 0xba54,
+  0xc8d7, 0xba55,
+  0xc8d8, 0xba56,
+  0xc8d9, 0xba57,
+  0xc8da, 0xba58,
+  0xc8db, 0xba59,
+  0xc8dc, 0xba5a,
+  0xc8dd, 0xba5b,
+  0xc8de, 0xba5c,
+  0xc8df, 0xba5d,
+  0xc8e0, 0xba61,
+  0xc8e1, 0xba62,
+  0xc8e2, 0xba63,
+  0xc8e3, 0xba64,
+  0xc8e4, 0xba65,
+  0xc8e5, 0xba66,
+  0xc8e6, 0xba67,
+  0xc8e7, 0xba68,
+  0xc8e8, 0xba69,
+  0xc8e9, 0xba6a,
+  0xc8ea, 0xba6b,
+  0xc8eb, 0xba6c,
+  0xc8ec, 0xba6d,
+  0xc8ed, 0xba6e,
+  0xc8ee, 0xba6f,
+  0xc8ef, 0xba70,
+  0xc8f0, 0xba71,
+  0xc8f1, 0xba73,
+  0xc8f2, 0xba74,
+  0xc8f3, 0xba75,
+  0xc8f4, 0xba76,
+  0xc8f5, 0xba77,
+  0xc8f6, 0xba78,
+  0xc8f7, 0xba79,
+  0xc8f8, 0xba7a,
+  0xc8f9, 0xba7b,
+  0xc8fa, 0xba7c,
+  0xc8fb, 0xba7d,
+  0xc8fc, 0xba81,
+  0xc8fd, 0xba82,
+  0xc8fe, 0xba83,
+  0xc8ff, 0xba84,
+  0xc900, 0xba85,
+  0xc901, 0xba86,
+  0xc902, 0xba87,
+  0xc903, 0xba88,
+  0xc904, 0xba89,
+  0xc905, 0xba8a,
+  0xc906, 0xba8b,
+  0xc907, 0xba8c,
+  0xc908, 0xba8d,
+  0xc909, 0xba8e,
+  0xc90a, 0xba8f,
+  0xc90b, 0xba90,
+  0xc90c, 0xba91,
+  0xc90d, 0xba93,
+  0xc90e, 0xba94,
+  0xc90f, 0xba95,
+  0xc910, 0xba96,
+  0xc911, 0xba97,
+  0xc912, 0xba98,
+  0xc913, 0xba99,
+  0xc914, 0xba9a,
+  0xc915, 0xba9b,
+  0xc916, 0xba9c,
+  0xc917, 0xba9d,
+  0xc918, 0xbaa1,
+  0xc919, 0xbaa2,
+  0xc91a, 0xbaa3,
+  0xc91b, 0xbaa4,
+  0xc91c, 0xbaa5,
+  0xc91d, 0xbaa6,
+  0xc91e, 0xbaa7,
+  0xc91f, 0xbaa8,
+  0xc920, 0xbaa9,
+  0xc921, 0xbaaa,
+  0xc922, 0xbaab,
+  0xc923, 0xbaac,
+  0xc924, 0xbaad,
+  0xc925, 0xbaae,
+  0xc926, 0xbaaf,
+  0xc927, 0xbab0,
+  0xc928, 0xbab1,
+  0xc929, 0xbab3,
+  0xc92a, 0xbab4,
+  0xc92b, 0xbab5,
+  0xc92c, 0xbab6,
+  0xc92d, 0xbab7,
+  0xc92e, 0xbab8,
+  0xc92f, 0xbab9,
+  0xc930, 0xbaba,
+  0xc931, 0xbabb,
+  0xc932, 0xbabc,
+  0xc933, 0xbabd,
+  0xc934, 0xbac1,
+  0xc935, 0xbac2,
+  0xc936, 0xbac3,
+  0xc937, 0xbac4,
+  0xc938, 0xbac5,
+  0xc939, 0xbac6,
+  0xc93a, 0xbac7,
+  0xc93b, 0xbac8,
+  0xc93c, 0xbac9,
+  0xc93d, 0xbaca,
+  0xc93e, 0xbacb,
+  0xc93f, 0xbacc,
+  0xc940, 0xbacd,
+  0xc941, 0xbace,
+  0xc942, 0xbacf,
+  0xc943, 0xbad0,
+  0xc944, 0xbad1,
+  0xc945, 0xbad3,
+  0xc946, 0xbad4,
+  0xc947, 0xbad5,
+  0xc948, 0xbad6,
+  0xc949, 0xbad7,
+  0xc94a, 0xbad8,
+  0xc94b, 0xbad9,
+  0xc94c, 0xbada,
+  0xc94d, 0xbadb,
+  0xc94e, 0xbadc,
+  0xc94f, 0xbadd,
+  0xc950, 0xbae1,
+  0xc951, 0xbae2,
+  0xc952, 0xbae3,
+  0xc953, 0xbae4,
+  0xc954, 0xbae5,
+  0xc955, 0xbae6,
+  0xc956, 0xbae7,
+  0xc957, 0xbae8,
+  0xc958, 0xbae9,
+  0xc959, 0xbaea,
+  0xc95a, 0xbaeb,
+  0xc95b, 0xbaec,
+  0xc95c, 0xbaed,
+  0xc95d, 0xbaee,
+  0xc95e, 0xbaef,
+  0xc95f, 0xbaf0,
+  0xc960, 0xbaf1,
+  0xc961, 0xbaf3,
+  0xc962, 0xbaf4,
+  0xc963, 0xbaf5,
+  0xc964, 0xbaf6,
+  0xc965, 0xbaf7,
+  0xc966, 0xbaf8,
+  0xc967, 0xbaf9,
+  0xc968, 0xbafa,
+  0xc969, 0xbafb,
+  0xc96a, 0xbafc,
+  0xc96b, 0xbafd,
+  0xc96c, 0xbb41,
+  0xc96d, 0xbb42,
+  0xc96e, 0xbb43,
+  0xc96f, 0xbb44,
+  0xc970, 0xbb45,
+  0xc971, 0xbb46,
+  0xc972, 0xbb47,
+  0xc973, 0xbb48,
+  0xc974, 0xbb49,
+  0xc975, 0xbb4a,
+  0xc976, 0xbb4b,
+  0xc977, 0xbb4c,
+  0xc978, 0xbb4d,
+  0xc979, 0xbb4e,
+  0xc97a, 0xbb4f,
+  0xc97b, 0xbb50,
+  0xc97c, 0xbb51,
+  0xc97d, 0xbb53,
+  0xc97e, 0xbb54,
+  0xc97f, 0xbb55,
+  0xc980, 0xbb56,
+  0xc981, 0xbb57,
+  0xc982, 0xbb58,
+  0xc983, 0xbb59,
+  0xc984, 0xbb5a,
+  0xc985, 0xbb5b,
+  0xc986, 0xbb5c,
+  0xc987, 0xbb5d,
+  0xc988, 0xbb61,
+  0xc989, 0xbb62,
+  0xc98a, 0xbb63,
+  0xc98b, 0xbb64,
+  0xc98c, 0xbb65,
+  0xc98d, 0xbb66,
+  0xc98e, 0xbb67,
+  0xc98f, 0xbb68,
+  0xc990, 0xbb69,
+  0xc991, 0xbb6a,
+  0xc992, 0xbb6b,
+  0xc993, 0xbb6c,
+  0xc994, 0xbb6d,
+  0xc995, 0xbb6e,
+  0xc996, 0xbb6f,
+  0xc997, 0xbb70,
+  0xc998, 0xbb71,
+  0xc999, 0xbb73,
+  0xc99a, 0xbb74,
+  0xc99b, 0xbb75,
+  0xc99c, 0xbb76,
+  0xc99d, 0xbb77,
+  0xc99e, 0xbb78,
+  0xc99f, 0xbb79,
+  0xc9a0, 0xbb7a,
+  0xc9a1, 0xbb7b,
+  0xc9a2, 0xbb7c,
+  0xc9a3, 0xbb7d,
+  0xc9a4, 0xbb81,
+  0xc9a5, 0xbb82,
+  0xc9a6, 0xbb83,
+  0xc9a7, 0xbb84,
+  0xc9a8, 0xbb85,
+  0xc9a9, 0xbb86,
+  0xc9aa, 0xbb87,
+  0xc9ab, 0xbb88,
+  0xc9ac, 0xbb89,
+  0xc9ad, 0xbb8a,
+  0xc9ae, 0xbb8b,
+  0xc9af, 0xbb8c,
+  0xc9b0, 0xbb8d,
+  0xc9b1, 0xbb8e,
+  0xc9b2, 0xbb8f,
+  0xc9b3, 0xbb90,
+  0xc9b4, 0xbb91,
+  0xc9b5, 0xbb93,
+  0xc9b6, 0xbb94,
+  0xc9b7, 0xbb95,
+  0xc9b8, 0xbb96,
+  0xc9b9, 0xbb97,
+  0xc9ba, 0xbb98,
+  0xc9bb, 0xbb99,
+  0xc9bc, 0xbb9a,
+  0xc9bd, 0xbb9b,
+  0xc9be, 0xbb9c,
+  0xc9bf, 0xbb9d,
+  0xc9c0, 0xbba1,
+  0xc9c1, 0xbba2,
+  0xc9c2, 0xbba3,
+  0xc9c3, 0xbba4,
+  0xc9c4, 0xbba5,
+  0xc9c5, 0xbba6,
+  0xc9c6, 0xbba7,
+  0xc9c7, 0xbba8,
+  0xc9c8, 0xbba9,
+  0xc9c9, 0xbbaa,
+  0xc9ca, 0xbbab,
+  0xc9cb, 0xbbac,
+  0xc9cc, 0xbbad,
+  0xc9cd, 0xbbae,
+  0xc9ce, 0xbbaf,
+  0xc9cf, 0xbbb0,
+  0xc9d0, 0xbbb1,
+  0xc9d1, 0xbbb3,
+  0xc9d2, 0xbbb4,
+  0xc9d3, 0xbbb5,
+  0xc9d4, 0xbbb6,
+  0xc9d5, 0xbbb7,
+  0xc9d6, 0xbbb8,
+  0xc9d7, 0xbbb9,
+  0xc9d8, 0xbbba,
+  0xc9d9, 0xbbbb,
+  0xc9da, 0xbbbc,
+  0xc9db, 0xbbbd,
+  0xc9dc, 0xbc61,
+  0xc9dd, 0xbc62,
+  0xc9de, 0xbc63,
+  0xc9df, 0xbc64,
+  0xc9e0, 0xbc65,
+  0xc9e1, 0xbc66,
+  0xc9e2, 0xbc67,
+  0xc9e3, 0xbc68,
+  0xc9e4, 0xbc69,
+  0xc9e5, 0xbc6a,
+  0xc9e6, 0xbc6b,
+  0xc9e7, 0xbc6c,
+  0xc9e8, 0xbc6d,
+  0xc9e9, 0xbc6e,
+  0xc9ea, 0xbc6f,
+  0xc9eb, 0xbc70,
+  0xc9ec, 0xbc71,
+  0xc9ed, 0xbc73,
+  0xc9ee, 0xbc74,
+  0xc9ef, 0xbc75,
+  0xc9f0, 0xbc76,
+  0xc9f1, 0xbc77,
+  0xc9f2, 0xbc78,
+  0xc9f3, 0xbc79,
+  0xc9f4, 0xbc7a,
+  0xc9f5, 0xbc7b,
+  0xc9f6, 0xbc7c,
+  0xc9f7, 0xbc7d,
+  0xc9f8, 0xbc81,
+  0xc9f9, 0xbc82,
+  0xc9fa, 0xbc83,
+  0xc9fb, 0xbc84,
+  0xc9fc, 0xbc85,
+  0xc9fd, 0xbc86,
+  0xc9fe, 0xbc87,
+  0xc9ff, 0xbc88,
+  0xca00, 0xbc89,
+  0xca01, 0xbc8a,
+  0xca02, 0xbc8b,
+  0xca03, 0xbc8c,
+  0xca04, 0xbc8d,
+  0xca05, 0xbc8e,
+  0xca06, 0xbc8f,
+  0xca07, 0xbc90,
+  0xca08, 0xbc91,
+  0xca09, 0xbc93,
+  0xca0a, 0xbc94,
+  0xca0b, 0xbc95,
+  0xca0c, 0xbc96,
+  0xca0d, 0xbc97,
+  0xca0e, 0xbc98,
+  0xca0f, 0xbc99,
+  0xca10, 0xbc9a,
+  0xca11, 0xbc9b,
+  0xca12, 0xbc9c,
+  0xca13, 0xbc9d,
+  0xca14, 0xbca1,
+  0xca15, 0xbca2,
+  0xca16, 0xbca3,
+  0xca17, 0xbca4,
+  0xca18, 0xbca5,
+  0xca19, 0xbca6,
+  0xca1a, 0xbca7,
+  0xca1b, 0xbca8,
+  0xca1c, 0xbca9,
+  0xca1d, 0xbcaa,
+  0xca1e, 0xbcab,
+  0xca1f, 0xbcac,
+  0xca20, 0xbcad,
+  0xca21, 0xbcae,
+  0xca22, 0xbcaf,
+  0xca23, 0xbcb0,
+  0xca24, 0xbcb1,
+  0xca25, 0xbcb3,
+  0xca26, 0xbcb4,
+  0xca27, 0xbcb5,
+  0xca28, 0xbcb6,
+  0xca29, 0xbcb7,
+  0xca2a, 0xbcb8,
+  0xca2b, 0xbcb9,
+  0xca2c, 0xbcba,
+  0xca2d, 0xbcbb,
+  0xca2e, 0xbcbc,
+  0xca2f, 0xbcbd,
+  0xca30, 0xbcc1,
+  0xca31, 0xbcc2,
+  0xca32, 0xbcc3,
+  0xca33, 0xbcc4,
+  0xca34, 0xbcc5,
+  0xca35, 0xbcc6,
+  0xca36, 0xbcc7,
+  0xca37, 0xbcc8,
+  0xca38, 0xbcc9,
+  0xca39, 0xbcca,
+  0xca3a, 0xbccb,
+  0xca3b, 0xbccc,
+  0xca3c, 0xbccd,
+  0xca3d, 0xbcce,
+  0xca3e, 0xbccf,
+  0xca3f, 0xbcd0,
+  0xca40, 0xbcd1,
+  0xca41, 0xbcd3,
+  0xca42, 0xbcd4,
+  0xca43, 0xbcd5,
+  0xca44, 0xbcd6,
+  0xca45, 0xbcd7,
+  0xca46, 0xbcd8,
+  0xca47, 0xbcd9,
+  0xca48, 0xbcda,
+  0xca49, 0xbcdb,
+  0xca4a, 0xbcdc,
+  0xca4b, 0xbcdd,
+  0xca4c, 0xbce1,
+  0xca4d, 0xbce2,
+  0xca4e, 0xbce3,
+  0xca4f, 0xbce4,
+  0xca50, 0xbce5,
+  0xca51, 0xbce6,
+  0xca52, 0xbce7,
+  0xca53, 0xbce8,
+  0xca54, 0xbce9,
+  0xca55, 0xbcea,
+  0xca56, 0xbceb,
+  0xca57, 0xbcec,
+  0xca58, 0xbced,
+  0xca59, 0xbcee,
+  0xca5a, 0xbcef,
+  0xca5b, 0xbcf0,
+  0xca5c, 0xbcf1,
+  0xca5d, 0xbcf3,
+  0xca5e, 0xbcf4,
+  0xca5f, 0xbcf5,
+  0xca60, 0xbcf6,
+  0xca61, 0xbcf7,
+  0xca62, 0xbcf8,
+  0xca63, 0xbcf9,
+  0xca64, 0xbcfa,
+  0xca65, 0xbcfb,
+  0xca66, 0xbcfc,
+  0xca67, 0xbcfd,
+  0xca68, 0xbd41,
+  0xca69, 0xbd42,
+  0xca6a, 0xbd43,
+  0xca6b, 0xbd44,
+  0xca6c, 0xbd45,
+  0xca6d, 0xbd46,
+  0xca6e, 0xbd47,
+  0xca6f, 0xbd48,
+  0xca70, 0xbd49,
+  0xca71, 0xbd4a,
+  0xca72, 0xbd4b,
+  0xca73, 0xbd4c,
+  0xca74, 0xbd4d,
+  0xca75, 0xbd4e,
+  0xca76, 0xbd4f,
+  0xca77, 0xbd50,
+  0xca78, 0xbd51,
+  0xca79, 0xbd53,
+  0xca7a, 0xbd54,
+  0xca7b, 0xbd55,
+  0xca7c, 0xbd56,
+  0xca7d, 0xbd57,
+  0xca7e, 0xbd58,
+  0xca7f, 0xbd59,
+  0xca80, 0xbd5a,
+  0xca81, 0xbd5b,
+  0xca82, 0xbd5c,
+  0xca83, 0xbd5d,
+  0xca84, 0xbd61,
+  0xca85, 0xbd62,
+  0xca86, 0xbd63,
+  0xca87, 0xbd64,
+  0xca88, 0xbd65,
+  0xca89, 0xbd66,
+  0xca8a, 0xbd67,
+  0xca8b, 0xbd68,
+  0xca8c, 0xbd69,
+  0xca8d, 0xbd6a,
+  0xca8e, 0xbd6b,
+  0xca8f, 0xbd6c,
+  0xca90, 0xbd6d,
+  0xca91, 0xbd6e,
+  0xca92, 0xbd6f,
+  0xca93, 0xbd70,
+  0xca94, 0xbd71,
+  0xca95, 0xbd73,
+  0xca96, 0xbd74,
+  0xca97, 0xbd75,
+  0xca98, 0xbd76,
+  0xca99, 0xbd77,
+  0xca9a, 0xbd78,
+  0xca9b, 0xbd79,
+  0xca9c, 0xbd7a,
+  0xca9d, 0xbd7b,
+  0xca9e, 0xbd7c,
+  0xca9f, 0xbd7d,
+  0xcaa0, 0xbd81,
+  0xcaa1, 0xbd82,
+  0xcaa2, 0xbd83,
+  0xcaa3, 0xbd84,
+  0xcaa4, 0xbd85,
+  0xcaa5, 0xbd86,
+  0xcaa6, 0xbd87,
+  0xcaa7, 0xbd88,
+  0xcaa8, 0xbd89,
+  0xcaa9, 0xbd8a,
+  0xcaaa, 0xbd8b,
+  0xcaab, 0xbd8c,
+  0xcaac, 0xbd8d,
+  0xcaad, 0xbd8e,
+  0xcaae, 0xbd8f,
+  0xcaaf, 0xbd90,
+  0xcab0, 0xbd91,
+  0xcab1, 0xbd93,
+  0xcab2, 0xbd94,
+  0xcab3, 0xbd95,
+  0xcab4, 0xbd96,
+  0xcab5, 0xbd97,
+  0xcab6, 0xbd98,
+  0xcab7, 0xbd99,
+  0xcab8, 0xbd9a,
+  0xcab9, 0xbd9b,
+  0xcaba, 0xbd9c,
+  0xcabb, 0xbd9d,
+  0xcabc, 0xbda1,
+  0xcabd, 0xbda2,
+  0xcabe, 0xbda3,
+  0xcabf, 0xbda4,
+  0xcac0, 0xbda5,
+  0xcac1, 0xbda6,
+  0xcac2, 0xbda7,
+  0xcac3, 0xbda8,
+  0xcac4, 0xbda9,
+  0xcac5, 0xbdaa,
+  0xcac6, 0xbdab,
+  0xcac7, 0xbdac,
+  0xcac8, 0xbdad,
+  0xcac9, 0xbdae,
+  0xcaca, 0xbdaf,
+  0xcacb, 0xbdb0,
+  0xcacc, 0xbdb1,
+  0xcacd, 0xbdb3,
+  0xcace, 0xbdb4,
+  0xcacf, 0xbdb5,
+  0xcad0, 0xbdb6,
+  0xcad1, 0xbdb7,
+  0xcad2, 0xbdb8,
+  0xcad3, 0xbdb9,
+  0xcad4, 0xbdba,
+  0xcad5, 0xbdbb,
+  0xcad6, 0xbdbc,
+  0xcad7, 0xbdbd,
+  0xcad8, 0xbdc1,
+  0xcad9, 0xbdc2,
+  0xcada, 0xbdc3,
+  0xcadb, 0xbdc4,
+  0xcadc, 0xbdc5,
+  0xcadd, 0xbdc6,
+  0xcade, 0xbdc7,
+  0xcadf, 0xbdc8,
+  0xcae0, 0xbdc9,
+  0xcae1, 0xbdca,
+  0xcae2, 0xbdcb,
+  0xcae3, 0xbdcc,
+  0xcae4, 0xbdcd,
+  0xcae5, 0xbdce,
+  0xcae6, 0xbdcf,
+  0xcae7, 0xbdd0,
+  0xcae8, 0xbdd1,
+  0xcae9, 0xbdd3,
+  0xcaea, 0xbdd4,
+  0xcaeb, 0xbdd5,
+  0xcaec, 0xbdd6,
+  0xcaed, 0xbdd7,
+  0xcaee, 0xbdd8,
+  0xcaef, 0xbdd9,
+  0xcaf0, 0xbdda,
+  0xcaf1, 0xbddb,
+  0xcaf2, 0xbddc,
+  0xcaf3, 0xbddd,
+  0xcaf4, 0xbde1,
+  0xcaf5, 0xbde2,
+  0xcaf6, 0xbde3,
+  0xcaf7, 0xbde4,
+  0xcaf8, 0xbde5,
+  0xcaf9, 0xbde6,
+  0xcafa, 0xbde7,
+  0xcafb, 0xbde8,
+  0xcafc, 0xbde9,
+  0xcafd, 0xbdea,
+  0xcafe, 0xbdeb,
+  0xcaff, 0xbdec,
+  0xcb00, 0xbded,
+  0xcb01, 0xbdee,
+  0xcb02, 0xbdef,
+  0xcb03, 0xbdf0,
+  0xcb04, 0xbdf1,
+  0xcb05, 0xbdf3,
+  0xcb06, 0xbdf4,
+  0xcb07, 0xbdf5,
+  0xcb08, 0xbdf6,
+  0xcb09, 0xbdf7,
+  0xcb0a, 0xbdf8,
+  0xcb0b, 0xbdf9,
+  0xcb0c, 0xbdfa,
+  0xcb0d, 0xbdfb,
+  0xcb0e, 0xbdfc,
+  0xcb0f, 0xbdfd,
+  0xcb10, 0xbe41,
+  0xcb11, 0xbe42,
+  0xcb12, 0xbe43,
+  0xcb13, 0xbe44,
+  0xcb14, 0xbe45,
+  0xcb15, 0xbe46,
+  0xcb16, 0xbe47,
+  0xcb17, 0xbe48,
+  0xcb18, 0xbe49,
+  0xcb19, 0xbe4a,
+  0xcb1a, 0xbe4b,
+  0xcb1b, 0xbe4c,
+  0xcb1c, 0xbe4d,
+  0xcb1d, 0xbe4e,
+  0xcb1e, 0xbe4f,
+  0xcb1f, 0xbe50,
+  0xcb20, 0xbe51,
+  0xcb21, 0xbe53,
+  0xcb22, 0xbe54,
+  0xcb23, 0xbe55,
+  0xcb24, 0xbe56,
+  0xcb25, 0xbe57,
+  0xcb26, 0xbe58,
+  0xcb27, 0xbe59,
+  0xcb28, 0xbe5a,
+  0xcb29, 0xbe5b,
+  0xcb2a, 0xbe5c,
+  0xcb2b, 0xbe5d,
+  0xcb2c, 0xbe61,
+  0xcb2d, 0xbe62,
+  0xcb2e, 0xbe63,
+  0xcb2f, 0xbe64,
+  0xcb30, 0xbe65,
+  0xcb31, 0xbe66,
+  0xcb32, 0xbe67,
+  0xcb33, 0xbe68,
+  0xcb34, 0xbe69,
+  0xcb35, 0xbe6a,
+  0xcb36, 0xbe6b,
+  0xcb37, 0xbe6c,
+  0xcb38, 0xbe6d,
+  0xcb39, 0xbe6e,
+  0xcb3a, 0xbe6f,
+  0xcb3b, 0xbe70,
+  0xcb3c, 0xbe71,
+  0xcb3d, 0xbe73,
+  0xcb3e, 0xbe74,
+  0xcb3f, 0xbe75,
+  0xcb40, 0xbe76,
+  0xcb41, 0xbe77,
+  0xcb42, 0xbe78,
+  0xcb43, 0xbe79,
+  0xcb44, 0xbe7a,
+  0xcb45, 0xbe7b,
+  0xcb46, 0xbe7c,
+  0xcb47, 0xbe7d,
+  0xcb48, 0xbe81,
+  0xcb49, 0xbe82,
+  0xcb4a, 0xbe83,
+  0xcb4b, 0xbe84,
+  0xcb4c, 0xbe85,
+  0xcb4d, 0xbe86,
+  0xcb4e, 0xbe87,
+  0xcb4f, 0xbe88,
+  0xcb50, 0xbe89,
+  0xcb51, 0xbe8a,
+  0xcb52, 0xbe8b,
+  0xcb53, 0xbe8c,
+  0xcb54, 0xbe8d,
+  0xcb55, 0xbe8e,
+  0xcb56, 0xbe8f,
+  0xcb57, 0xbe90,
+  0xcb58, 0xbe91,
+  0xcb59, 0xbe93,
+  0xcb5a, 0xbe94,
+  0xcb5b, 0xbe95,
+  0xcb5c, 0xbe96,
+  0xcb5d, 0xbe97,
+  0xcb5e, 0xbe98,
+  0xcb5f, 0xbe99,
+  0xcb60, 0xbe9a,
+  0xcb61, 0xbe9b,
+  0xcb62, 0xbe9c,
+  0xcb63, 0xbe9d,
+  0xcb64, 0xbea1,
+  0xcb65, 0xbea2,
+  0xcb66, 0xbea3,
+  0xcb67, 0xbea4,
+  0xcb68, 0xbea5,
+  0xcb69, 0xbea6,
+  0xcb6a, 0xbea7,
+  0xcb6b, 0xbea8,
+  0xcb6c, 0xbea9,
+  0xcb6d, 0xbeaa,
+  0xcb6e, 0xbeab,
+  0xcb6f, 0xbeac,
+  0xcb70, 0xbead,
+  0xcb71, 0xbeae,
+  0xcb72, 0xbeaf,
+  0xcb73, 0xbeb0,
+  0xcb74, 0xbeb1,
+  0xcb75, 0xbeb3,
+  0xcb76, 0xbeb4,
+  0xcb77, 0xbeb5,
+  0xcb78, 0xbeb6,
+  0xcb79, 0xbeb7,
+  0xcb7a, 0xbeb8,
+  0xcb7b, 0xbeb9,
+  0xcb7c, 0xbeba,
+  0xcb7d, 0xbebb,
+  0xcb7e, 0xbebc,
+  0xcb7f, 0xbebd,
+  0xcb80, 0xbec1,
+  0xcb81, 0xbec2,
+  0xcb82, 0xbec3,
+  0xcb83, 0xbec4,
+  0xcb84, 0xbec5,
+  0xcb85, 0xbec6,
+  0xcb86, 0xbec7,
+  0xcb87, 0xbec8,
+  0xcb88, 0xbec9,
+  0xcb89, 0xbeca,
+  0xcb8a, 0xbecb,
+  0xcb8b, 0xbecc,
+  0xcb8c, 0xbecd,
+  0xcb8d, 0xbece,
+  0xcb8e, 0xbecf,
+  0xcb8f, 0xbed0,
+  0xcb90, 0xbed1,
+  0xcb91, 0xbed3,
+  0xcb92, 0xbed4,
+  0xcb93, 0xbed5,
+  0xcb94, 0xbed6,
+  0xcb95, 0xbed7,
+  0xcb96, 0xbed8,
+  0xcb97, 0xbed9,
+  0xcb98, 0xbeda,
+  0xcb99, 0xbedb,
+  0xcb9a, 0xbedc,
+  0xcb9b, 0xbedd,
+  0xcb9c, 0xbee1,
+  0xcb9d, 0xbee2,
+  0xcb9e, 0xbee3,
+  0xcb9f, 0xbee4,
+  0xcba0, 0xbee5,
+  0xcba1, 0xbee6,
+  0xcba2, 0xbee7,
+  0xcba3, 0xbee8,
+  0xcba4, 0xbee9,
+  0xcba5, 0xbeea,
+  0xcba6, 0xbeeb,
+  0xcba7, 0xbeec,
+  0xcba8, 0xbeed,
+  0xcba9, 0xbeee,
+  0xcbaa, 0xbeef,
+  0xcbab, 0xbef0,
+  0xcbac, 0xbef1,
+  0xcbad, 0xbef3,
+  0xcbae, 0xbef4,
+  0xcbaf, 0xbef5,
+  0xcbb0, 0xbef6,
+  0xcbb1, 0xbef7,
+  0xcbb2, 0xbef8,
+  0xcbb3, 0xbef9,
+  0xcbb4, 0xbefa,
+  0xcbb5, 0xbefb,
+  0xcbb6, 0xbefc,
+  0xcbb7, 0xbefd,
+  0xcbb8, 0xbf41,
+  0xcbb9, 0xbf42,
+  0xcbba, 0xbf43,
+  0xcbbb, 0xbf44,
+  0xcbbc, 0xbf45,
+  0xcbbd, 0xbf46,
+  0xcbbe, 0xbf47,
+  0xcbbf, 0xbf48,
+  0xcbc0, 0xbf49,
+  0xcbc1, 0xbf4a,
+  0xcbc2, 0xbf4b,
+  0xcbc3, 0xbf4c,
+  0xcbc4, 0xbf4d,
+  0xcbc5, 0xbf4e,
+  0xcbc6, 0xbf4f,
+  0xcbc7, 0xbf50,
+  0xcbc8, 0xbf51,
+  0xcbc9, 0xbf53,
+  0xcbca, 0xbf54,
+  0xcbcb, 0xbf55,
+  0xcbcc, 0xbf56,
+  0xcbcd, 0xbf57,
+  0xcbce, 0xbf58,
+  0xcbcf, 0xbf59,
+  0xcbd0, 0xbf5a,
+  0xcbd1, 0xbf5b,
+  0xcbd2, 0xbf5c,
+  0xcbd3, 0xbf5d,
+  0xcbd4, 0xbf61,
+  0xcbd5, 0xbf62,
+  0xcbd6, 0xbf63,
+  0xcbd7, 0xbf64,
+  0xcbd8, 0xbf65,
+  0xcbd9, 0xbf66,
+  0xcbda, 0xbf67,
+  0xcbdb, 0xbf68,
+  0xcbdc, 0xbf69,
+  0xcbdd, 0xbf6a,
+  0xcbde, 0xbf6b,
+  0xcbdf, 0xbf6c,
+  0xcbe0, 0xbf6d,
+  0xcbe1, 0xbf6e,
+  0xcbe2, 0xbf6f,
+  0xcbe3, 0xbf70,
+  0xcbe4, 0xbf71,
+  0xcbe5, 0xbf73,
+  0xcbe6, 0xbf74,
+  0xcbe7, 0xbf75,
+  0xcbe8, 0xbf76,
+  0xcbe9, 0xbf77,
+  0xcbea, 0xbf78,
+  0xcbeb, 0xbf79,
+  0xcbec, 0xbf7a,
+  0xcbed, 0xbf7b,
+  0xcbee, 0xbf7c,
+  0xcbef, 0xbf7d,
+  0xcbf0, 0xbf81,
+  0xcbf1, 0xbf82,
+  0xcbf2, 0xbf83,
+  0xcbf3, 0xbf84,
+  0xcbf4, 0xbf85,
+  0xcbf5, 0xbf86,
+  0xcbf6, 0xbf87,
+  0xcbf7, 0xbf88,
+  0xcbf8, 0xbf89,
+  0xcbf9, 0xbf8a,
+  0xcbfa, 0xbf8b,
+  0xcbfb, 0xbf8c,
+  0xcbfc, 0xbf8d,
+  0xcbfd, 0xbf8e,
+  0xcbfe, 0xbf8f,
+  0xcbff, 0xbf90,
+  0xcc00, 0xbf91,
+  0xcc01, 0xbf93,
+  0xcc02, 0xbf94,
+  0xcc03, 0xbf95,
+  0xcc04, 0xbf96,
+  0xcc05, 0xbf97,
+  0xcc06, 0xbf98,
+  0xcc07, 0xbf99,
+  0xcc08, 0xbf9a,
+  0xcc09, 0xbf9b,
+  0xcc0a, 0xbf9c,
+  0xcc0b, 0xbf9d,
+  0xcc0c, 0xbfa1,
+  0xcc0d, 0xbfa2,
+  0xcc0e, 0xbfa3,
+  0xcc0f, 0xbfa4,
+  0xcc10, 0xbfa5,
+  0xcc11, 0xbfa6,
+  0xcc12, 0xbfa7,
+  0xcc13, 0xbfa8,
+  0xcc14, 0xbfa9,
+  0xcc15, 0xbfaa,
+  0xcc16, 0xbfab,
+  0xcc17, 0xbfac,
+  0xcc18, 0xbfad,
+  0xcc19, 0xbfae,
+  0xcc1a, 0xbfaf,
+  0xcc1b, 0xbfb0,
+  0xcc1c, 0xbfb1,
+  0xcc1d, 0xbfb3,
+  0xcc1e, 0xbfb4,
+  0xcc1f, 0xbfb5,
+  0xcc20, 0xbfb6,
+  0xcc21, 0xbfb7,
+  0xcc22, 0xbfb8,
+  0xcc23, 0xbfb9,
+  0xcc24, 0xbfba,
+  0xcc25, 0xbfbb,
+  0xcc26, 0xbfbc,
+  0xcc27, 0xbfbd,
+  0xcc28, 0xc061,
+  0xcc29, 0xc062,
+  0xcc2a, 0xc063,
+  0xcc2b, 0xc064,
+  0xcc2c, 0xc065,
+  0xcc2d, 0xc066,
+  0xcc2e, 0xc067,
+  0xcc2f, 0xc068,
+  0xcc30, 0xc069,
+  0xcc31, 0xc06a,
+  0xcc32, 0xc06b,
+  0xcc33, 0xc06c,
+  0xcc34, 0xc06d,
+  0xcc35, 0xc06e,
+  0xcc36, 0xc06f,
+  0xcc37, 0xc070,
+  0xcc38, 0xc071,
+  0xcc39, 0xc073,
+  0xcc3a, 0xc074,
+  0xcc3b, 0xc075,
+  0xcc3c, 0xc076,
+  0xcc3d, 0xc077,
+  0xcc3e, 0xc078,
+  0xcc3f, 0xc079,
+  0xcc40, 0xc07a,
+  0xcc41, 0xc07b,
+  0xcc42, 0xc07c,
+  0xcc43, 0xc07d,
+  0xcc44, 0xc081,
+  0xcc45, 0xc082,
+  0xcc46, 0xc083,
+  0xcc47, 0xc084,
+  0xcc48, 0xc085,
+  0xcc49, 0xc086,
+  0xcc4a, 0xc087,
+  0xcc4b, 0xc088,
+  0xcc4c, 0xc089,
+  0xcc4d, 0xc08a,
+  0xcc4e, 0xc08b,
+  0xcc4f, 0xc08c,
+  0xcc50, 0xc08d,
+  0xcc51, 0xc08e,
+  0xcc52, 0xc08f,
+  0xcc53, 0xc090,
+  0xcc54, 0xc091,
+  0xcc55, 0xc093,
+  0xcc56, 0xc094,
+  0xcc57, 0xc095,
+  0xcc58, 0xc096,
+  0xcc59, 0xc097,
+  0xcc5a, 0xc098,
+  0xcc5b, 0xc099,
+  0xcc5c, 0xc09a,
+  0xcc5d, 0xc09b,
+  0xcc5e, 0xc09c,
+  0xcc5f, 0xc09d,
+  0xcc60, 0xc0a1,
+  0xcc61, 0xc0a2,
+  0xcc62, 0xc0a3,
+  0xcc63, 0xc0a4,
+  0xcc64, 0xc0a5,
+  0xcc65, 0xc0a6,
+  0xcc66, 0xc0a7,
+  0xcc67, 0xc0a8,
+  0xcc68, 0xc0a9,
+  0xcc69, 0xc0aa,
+  0xcc6a, 0xc0ab,
+  0xcc6b, 0xc0ac,
+  0xcc6c, 0xc0ad,
+  0xcc6d, 0xc0ae,
+  0xcc6e, 0xc0af,
+  0xcc6f, 0xc0b0,
+  0xcc70, 0xc0b1,
+  0xcc71, 0xc0b3,
+  0xcc72, 0xc0b4,
+  0xcc73, 0xc0b5,
+  0xcc74, 0xc0b6,
+  0xcc75, 0xc0b7,
+  0xcc76, 0xc0b8,
+  0xcc77, 0xc0b9,
+  0xcc78, 0xc0ba,
+  0xcc79, 0xc0bb,
+  0xcc7a, 0xc0bc,
+  0xcc7b, 0xc0bd,
+  0xcc7c, 0xc0c1,
+  0xcc7d, 0xc0c2,
+  0xcc7e, 0xc0c3,
+  0xcc7f, 0xc0c4,
+  0xcc80, 0xc0c5,
+  0xcc81, 0xc0c6,
+  0xcc82, 0xc0c7,
+  0xcc83, 0xc0c8,
+  0xcc84, 0xc0c9,
+  0xcc85, 0xc0ca,
+  0xcc86, 0xc0cb,
+  0xcc87, 0xc0cc,
+  0xcc88, 0xc0cd,
+  0xcc89, 0xc0ce,
+  0xcc8a, 0xc0cf,
+  0xcc8b, 0xc0d0,
+  0xcc8c, 0xc0d1,
+  0xcc8d, 0xc0d3,
+  0xcc8e, 0xc0d4,
+  0xcc8f, 0xc0d5,
+  0xcc90, 0xc0d6,
+  0xcc91, 0xc0d7,
+  0xcc92, 0xc0d8,
+  0xcc93, 0xc0d9,
+  0xcc94, 0xc0da,
+  0xcc95, 0xc0db,
+  0xcc96, 0xc0dc,
+  0xcc97, 0xc0dd,
+  0xcc98, 0xc0e1,
+  0xcc99, 0xc0e2,
+  0xcc9a, 0xc0e3,
+  0xcc9b, 0xc0e4,
+  0xcc9c, 0xc0e5,
+  0xcc9d, 0xc0e6,
+  0xcc9e, 0xc0e7,
+  0xcc9f, 0xc0e8,
+  0xcca0, 0xc0e9,
+  0xcca1, 0xc0ea,
+  0xcca2, 0xc0eb,
+  0xcca3, 0xc0ec,
+  0xcca4, 0xc0ed,
+  0xcca5, 0xc0ee,
+  0xcca6, 0xc0ef,
+  0xcca7, 0xc0f0,
+  0xcca8, 0xc0f1,
+  0xcca9, 0xc0f3,
+  0xccaa, 0xc0f4,
+  0xccab, 0xc0f5,
+  0xccac, 0xc0f6,
+  0xccad, 0xc0f7,
+  0xccae, 0xc0f8,
+  0xccaf, 0xc0f9,
+  0xccb0, 0xc0fa,
+  0xccb1, 0xc0fb,
+  0xccb2, 0xc0fc,
+  0xccb3, 0xc0fd,
+  0xccb4, 0xc141,
+  0xccb5, 0xc142,
+  0xccb6, 0xc143,
+  0xccb7, 0xc144,
+  0xccb8, 0xc145,
+  0xccb9, 0xc146,
+  0xccba, 0xc147,
+  0xccbb, 0xc148,
+  0xccbc, 0xc149,
+  0xccbd, 0xc14a,
+  0xccbe, 0xc14b,
+  0xccbf, 0xc14c,
+  0xccc0, 0xc14d,
+  0xccc1, 0xc14e,
+  0xccc2, 0xc14f,
+  0xccc3, 0xc150,
+  0xccc4, 0xc151,
+  0xccc5, 0xc153,
+  0xccc6, 0xc154,
+  0xccc7, 0xc155,
+  0xccc8, 0xc156,
+  0xccc9, 0xc157,
+  0xccca, 0xc158,
+  0xcccb, 0xc159,
+  0xcccc, 0xc15a,
+  0xcccd, 0xc15b,
+  0xccce, 0xc15c,
+  0xcccf, 0xc15d,
+  0xccd0, 0xc161,
+  0xccd1, 0xc162,
+  0xccd2, 0xc163,
+  0xccd3, 0xc164,
+  0xccd4, 0xc165,
+  0xccd5, 0xc166,
+  0xccd6, 0xc167,
+  0xccd7, 0xc168,
+  0xccd8, 0xc169,
+  0xccd9, 0xc16a,
+  0xccda, 0xc16b,
+  0xccdb, 0xc16c,
+  0xccdc, 0xc16d,
+  0xccdd, 0xc16e,
+  0xccde, 0xc16f,
+  0xccdf, 0xc170,
+  0xcce0, 0xc171,
+  0xcce1, 0xc173,
+  0xcce2, 0xc174,
+  0xcce3, 0xc175,
+  0xcce4, 0xc176,
+  0xcce5, 0xc177,
+  0xcce6, 0xc178,
+  0xcce7, 0xc179,
+  0xcce8, 0xc17a,
+  0xcce9, 0xc17b,
+  0xccea, 0xc17c,
+  0xcceb, 0xc17d,
+  0xccec, 0xc181,
+  0xcced, 0xc182,
+  0xccee, 0xc183,
+  0xccef, 0xc184,
+  0xccf0, 0xc185,
+  0xccf1, 0xc186,
+  0xccf2, 0xc187,
+  0xccf3, 0xc188,
+  0xccf4, 0xc189,
+  0xccf5, 0xc18a,
+  0xccf6, 0xc18b,
+  0xccf7, 0xc18c,
+  0xccf8, 0xc18d,
+  0xccf9, 0xc18e,
+  0xccfa, 0xc18f,
+  0xccfb, 0xc190,
+  0xccfc, 0xc191,
+  0xccfd, 0xc193,
+  0xccfe, 0xc194,
+  0xccff, 0xc195,
+  0xcd00, 0xc196,
+  0xcd01, 0xc197,
+  0xcd02, 0xc198,
+  0xcd03, 0xc199,
+  0xcd04, 0xc19a,
+  0xcd05, 0xc19b,
+  0xcd06, 0xc19c,
+  0xcd07, 0xc19d,
+  0xcd08, 0xc1a1,
+  0xcd09, 0xc1a2,
+  0xcd0a, 0xc1a3,
+  0xcd0b, 0xc1a4,
+  0xcd0c, 0xc1a5,
+  0xcd0d, 0xc1a6,
+  0xcd0e, 0xc1a7,
+  0xcd0f, 0xc1a8,
+  0xcd10, 0xc1a9,
+  0xcd11, 0xc1aa,
+  0xcd12, 0xc1ab,
+  0xcd13, 0xc1ac,
+  0xcd14, 0xc1ad,
+  0xcd15, 0xc1ae,
+  0xcd16, 0xc1af,
+  0xcd17, 0xc1b0,
+  0xcd18, 0xc1b1,
+  0xcd19, 0xc1b3,
+  0xcd1a, 0xc1b4,
+  0xcd1b, 0xc1b5,
+  0xcd1c, 0xc1b6,
+  0xcd1d, 0xc1b7,
+  0xcd1e, 0xc1b8,
+  0xcd1f, 0xc1b9,
+  0xcd20, 0xc1ba,
+  0xcd21, 0xc1bb,
+  0xcd22, 0xc1bc,
+  0xcd23, 0xc1bd,
+  0xcd24, 0xc1c1,
+  0xcd25, 0xc1c2,
+  0xcd26, 0xc1c3,
+  0xcd27, 0xc1c4,
+  0xcd28, 0xc1c5,
+  0xcd29, 0xc1c6,
+  0xcd2a, 0xc1c7,
+  0xcd2b, 0xc1c8,
+  0xcd2c, 0xc1c9,
+  0xcd2d, 0xc1ca,
+  0xcd2e, 0xc1cb,
+  0xcd2f, 0xc1cc,
+  0xcd30, 0xc1cd,
+  0xcd31, 0xc1ce,
+  0xcd32, 0xc1cf,
+  0xcd33, 0xc1d0,
+  0xcd34, 0xc1d1,
+  0xcd35, 0xc1d3,
+  0xcd36, 0xc1d4,
+  0xcd37, 0xc1d5,
+  0xcd38, 0xc1d6,
+  0xcd39, 0xc1d7,
+  0xcd3a, 0xc1d8,
+  0xcd3b, 0xc1d9,
+  0xcd3c, 0xc1da,
+  0xcd3d, 0xc1db,
+  0xcd3e, 0xc1dc,
+  0xcd3f, 0xc1dd,
+  0xcd40, 0xc1e1,
+  0xcd41, 0xc1e2,
+  0xcd42, 0xc1e3,
+  0xcd43, 0xc1e4,
+  0xcd44, 0xc1e5,
+  0xcd45, 0xc1e6,
+  0xcd46, 0xc1e7,
+  0xcd47, 0xc1e8,
+  0xcd48, 0xc1e9,
+  0xcd49, 0xc1ea,
+  0xcd4a, 0xc1eb,
+  0xcd4b, 0xc1ec,
+  0xcd4c, 0xc1ed,
+  0xcd4d, 0xc1ee,
+  0xcd4e, 0xc1ef,
+  0xcd4f, 0xc1f0,
+  0xcd50, 0xc1f1,
+  0xcd51, 0xc1f3,
+  0xcd52, 0xc1f4,
+  0xcd53, 0xc1f5,
+  0xcd54, 0xc1f6,
+  0xcd55, 0xc1f7,
+  0xcd56, 0xc1f8,
+  0xcd57, 0xc1f9,
+  0xcd58, 0xc1fa,
+  0xcd59, 0xc1fb,
+  0xcd5a, 0xc1fc,
+  0xcd5b, 0xc1fd,
+  0xcd5c, 0xc241,
+  0xcd5d, 0xc242,
+  0xcd5e, 0xc243,
+  0xcd5f, 0xc244,
+  0xcd60, 0xc245,
+  0xcd61, 0xc246,
+  0xcd62, 0xc247,
+  0xcd63, 0xc248,
+  0xcd64, 0xc249,
+  0xcd65, 0xc24a,
+  0xcd66, 0xc24b,
+  0xcd67, 0xc24c,
+  0xcd68, 0xc24d,
+  0xcd69, 0xc24e,
+  0xcd6a, 0xc24f,
+  0xcd6b, 0xc250,
+  0xcd6c, 0xc251,
+  0xcd6d, 0xc253,
+  0xcd6e, 0xc254,
+  0xcd6f, 0xc255,
+  0xcd70, 0xc256,
+  0xcd71, 0xc257,
+  0xcd72, 0xc258,
+  0xcd73, 0xc259,
+  0xcd74, 0xc25a,
+  0xcd75, 0xc25b,
+  0xcd76, 0xc25c,
+  0xcd77, 0xc25d,
+  0xcd78, 0xc261,
+  0xcd79, 0xc262,
+  0xcd7a, 0xc263,
+  0xcd7b, 0xc264,
+  0xcd7c, 0xc265,
+  0xcd7d, 0xc266,
+  0xcd7e, 0xc267,
+  0xcd7f, 0xc268,
+  0xcd80, 0xc269,
+  0xcd81, 0xc26a,
+  0xcd82, 0xc26b,
+  0xcd83, 0xc26c,
+  0xcd84, 0xc26d,
+  0xcd85, 0xc26e,
+  0xcd86, 0xc26f,
+  0xcd87, 0xc270,
+  0xcd88, 0xc271,
+  0xcd89, 0xc273,
+  0xcd8a, 0xc274,
+  0xcd8b, 0xc275,
+  0xcd8c, 0xc276,
+  0xcd8d, 0xc277,
+  0xcd8e, 0xc278,
+  0xcd8f, 0xc279,
+  0xcd90, 0xc27a,
+  0xcd91, 0xc27b,
+  0xcd92, 0xc27c,
+  0xcd93, 0xc27d,
+  0xcd94, 0xc281,
+  0xcd95, 0xc282,
+  0xcd96, 0xc283,
+  0xcd97, 0xc284,
+  0xcd98, 0xc285,
+  0xcd99, 0xc286,
+  0xcd9a, 0xc287,
+  0xcd9b, 0xc288,
+  0xcd9c, 0xc289,
+  0xcd9d, 0xc28a,
+  0xcd9e, 0xc28b,
+  0xcd9f, 0xc28c,
+  0xcda0, 0xc28d,
+  0xcda1, 0xc28e,
+  0xcda2, 0xc28f,
+  0xcda3, 0xc290,
+  0xcda4, 0xc291,
+  0xcda5, 0xc293,
+  0xcda6, 0xc294,
+  0xcda7, 0xc295,
+  0xcda8, 0xc296,
+  0xcda9, 0xc297,
+  0xcdaa, 0xc298,
+  0xcdab, 0xc299,
+  0xcdac, 0xc29a,
+  0xcdad, 0xc29b,
+  0xcdae, 0xc29c,
+  0xcdaf, 0xc29d,
+  0xcdb0, 0xc2a1,
+  0xcdb1, 0xc2a2,
+  0xcdb2, 0xc2a3,
+  0xcdb3, 0xc2a4,
+  0xcdb4, 0xc2a5,
+  0xcdb5, 0xc2a6,
+  0xcdb6, 0xc2a7,
+  0xcdb7, 0xc2a8,
+  0xcdb8, 0xc2a9,
+  0xcdb9, 0xc2aa,
+  0xcdba, 0xc2ab,
+  0xcdbb, 0xc2ac,
+  0xcdbc, 0xc2ad,
+  0xcdbd, 0xc2ae,
+  0xcdbe, 0xc2af,
+  0xcdbf, 0xc2b0,
+  0xcdc0, 0xc2b1,
+  0xcdc1, 0xc2b3,
+  0xcdc2, 0xc2b4,
+  0xcdc3, 0xc2b5,
+  0xcdc4, 0xc2b6,
+  0xcdc5, 0xc2b7,
+  0xcdc6, 0xc2b8,
+  0xcdc7, 0xc2b9,
+  0xcdc8, 0xc2ba,
+  0xcdc9, 0xc2bb,
+  0xcdca, 0xc2bc,
+  0xcdcb, 0xc2bd,
+  0xcdcc, 0xc2c1,
+  0xcdcd, 0xc2c2,
+  0xcdce, 0xc2c3,
+  0xcdcf, 0xc2c4,
+  0xcdd0, 0xc2c5,
+  0xcdd1, 0xc2c6,
+  0xcdd2, 0xc2c7,
+  0xcdd3, 0xc2c8,
+  0xcdd4, 0xc2c9,
+  0xcdd5, 0xc2ca,
+  0xcdd6, 0xc2cb,
+  0xcdd7, 0xc2cc,
+  0xcdd8, 0xc2cd,
+  0xcdd9, 0xc2ce,
+  0xcdda, 0xc2cf,
+  0xcddb, 0xc2d0,
+  0xcddc, 0xc2d1,
+  0xcddd, 0xc2d3,
+  0xcdde, 0xc2d4,
+  0xcddf, 0xc2d5,
+  0xcde0, 0xc2d6,
+  0xcde1, 0xc2d7,
+  0xcde2, 0xc2d8,
+  0xcde3, 0xc2d9,
+  0xcde4, 0xc2da,
+  0xcde5, 0xc2db,
+  0xcde6, 0xc2dc,
+  0xcde7, 0xc2dd,
+  0xcde8, 0xc2e1,
+  0xcde9, 0xc2e2,
+  0xcdea, 0xc2e3,
+  0xcdeb, 0xc2e4,
+  0xcdec, 0xc2e5,
+  0xcded, 0xc2e6,
+  0xcdee, 0xc2e7,
+  0xcdef, 0xc2e8,
+  0xcdf0, 0xc2e9,
+  0xcdf1, 0xc2ea,
+  0xcdf2, 0xc2eb,
+  0xcdf3, 0xc2ec,
+  0xcdf4, 0xc2ed,
+  0xcdf5, 0xc2ee,
+  0xcdf6, 0xc2ef,
+  0xcdf7, 0xc2f0,
+  0xcdf8, 0xc2f1,
+  0xcdf9, 0xc2f3,
+  0xcdfa, 0xc2f4,
+  0xcdfb, 0xc2f5,
+  0xcdfc, 0xc2f6,
+  0xcdfd, 0xc2f7,
+  0xcdfe, 0xc2f8,
+  0xcdff, 0xc2f9,
+  0xce00, 0xc2fa,
+  0xce01, 0xc2fb,
+  0xce02, 0xc2fc,
+  0xce03, 0xc2fd,
+  0xce04, 0xc341,
+  0xce05, 0xc342,
+  0xce06, 0xc343,
+  0xce07, 0xc344,
+  0xce08, 0xc345,
+  0xce09, 0xc346,
+  0xce0a, 0xc347,
+  0xce0b, 0xc348,
+  0xce0c, 0xc349,
+  0xce0d, 0xc34a,
+  0xce0e, 0xc34b,
+  0xce0f, 0xc34c,
+  0xce10, 0xc34d,
+  0xce11, 0xc34e,
+  0xce12, 0xc34f,
+  0xce13, 0xc350,
+  0xce14, 0xc351,
+  0xce15, 0xc353,
+  0xce16, 0xc354,
+  0xce17, 0xc355,
+  0xce18, 0xc356,
+  0xce19, 0xc357,
+  0xce1a, 0xc358,
+  0xce1b, 0xc359,
+  0xce1c, 0xc35a,
+  0xce1d, 0xc35b,
+  0xce1e, 0xc35c,
+  0xce1f, 0xc35d,
+  0xce20, 0xc361,
+  0xce21, 0xc362,
+  0xce22, 0xc363,
+  0xce23, 0xc364,
+  0xce24, 0xc365,
+  0xce25, 0xc366,
+  0xce26, 0xc367,
+  0xce27, 0xc368,
+  0xce28, 0xc369,
+  0xce29, 0xc36a,
+  0xce2a, 0xc36b,
+  0xce2b, 0xc36c,
+  0xce2c, 0xc36d,
+  0xce2d, 0xc36e,
+  0xce2e, 0xc36f,
+  0xce2f, 0xc370,
+  0xce30, 0xc371,
+  0xce31, 0xc373,
+  0xce32, 0xc374,
+  0xce33, 0xc375,
+  0xce34, 0xc376,
+  0xce35, 0xc377,
+  0xce36, 0xc378,
+  0xce37, 0xc379,
+  0xce38, 0xc37a,
+  0xce39, 0xc37b,
+  0xce3a, 0xc37c,
+  0xce3b, 0xc37d,
+  0xce3c, 0xc381,
+  0xce3d, 0xc382,
+  0xce3e, 0xc383,
+  0xce3f, 0xc384,
+  0xce40, 0xc385,
+  0xce41, 0xc386,
+  0xce42, 0xc387,
+  0xce43, 0xc388,
+  0xce44, 0xc389,
+  0xce45, 0xc38a,
+  0xce46, 0xc38b,
+  0xce47, 0xc38c,
+  0xce48, 0xc38d,
+  0xce49, 0xc38e,
+  0xce4a, 0xc38f,
+  0xce4b, 0xc390,
+  0xce4c, 0xc391,
+  0xce4d, 0xc393,
+  0xce4e, 0xc394,
+  0xce4f, 0xc395,
+  0xce50, 0xc396,
+  0xce51, 0xc397,
+  0xce52, 0xc398,
+  0xce53, 0xc399,
+  0xce54, 0xc39a,
+  0xce55, 0xc39b,
+  0xce56, 0xc39c,
+  0xce57, 0xc39d,
+  0xce58, 0xc3a1,
+  0xce59, 0xc3a2,
+  0xce5a, 0xc3a3,
+  0xce5b, 0xc3a4,
+  0xce5c, 0xc3a5,
+  0xce5d, 0xc3a6,
+  0xce5e, 0xc3a7,
+  0xce5f, 0xc3a8,
+  0xce60, 0xc3a9,
+  0xce61, 0xc3aa,
+  0xce62, 0xc3ab,
+  0xce63, 0xc3ac,
+  0xce64, 0xc3ad,
+  0xce65, 0xc3ae,
+  0xce66, 0xc3af,
+  0xce67, 0xc3b0,
+  0xce68, 0xc3b1,
+  0xce69, 0xc3b3,
+  0xce6a, 0xc3b4,
+  0xce6b, 0xc3b5,
+  0xce6c, 0xc3b6,
+  0xce6d, 0xc3b7,
+  0xce6e, 0xc3b8,
+  0xce6f, 0xc3b9,
+  0xce70, 0xc3ba,
+  0xce71, 0xc3bb,
+  0xce72, 0xc3bc,
+  0xce73, 0xc3bd,
+  0xce74, 0xc461,
+  0xce75, 0xc462,
+  0xce76, 0xc463,
+  0xce77, 0xc464,
+  0xce78, 0xc465,
+  0xce79, 0xc466,
+  0xce7a, 0xc467,
+  0xce7b, 0xc468,
+  0xce7c, 0xc469,
+  0xce7d, 0xc46a,
+  0xce7e, 0xc46b,
+  0xce7f, 0xc46c,
+  0xce80, 0xc46d,
+  0xce81, 0xc46e,
+  0xce82, 0xc46f,
+  0xce83, 0xc470,
+  0xce84, 0xc471,
+  0xce85, 0xc473,
+  0xce86, 0xc474,
+  0xce87, 0xc475,
+  0xce88, 0xc476,
+  0xce89, 0xc477,
+  0xce8a, 0xc478,
+  0xce8b, 0xc479,
+  0xce8c, 0xc47a,
+  0xce8d, 0xc47b,
+  0xce8e, 0xc47c,
+  0xce8f, 0xc47d,
+  0xce90, 0xc481,
+  0xce91, 0xc482,
+  0xce92, 0xc483,
+  0xce93, 0xc484,
+  0xce94, 0xc485,
+  0xce95, 0xc486,
+  0xce96, 0xc487,
+  0xce97, 0xc488,
+  0xce98, 0xc489,
+  0xce99, 0xc48a,
+  0xce9a, 0xc48b,
+  0xce9b, 0xc48c,
+  0xce9c, 0xc48d,
+  0xce9d, 0xc48e,
+  0xce9e, 0xc48f,
+  0xce9f, 0xc490,
+  0xcea0, 0xc491,
+  0xcea1, 0xc493,
+  0xcea2, 0xc494,
+  0xcea3, 0xc495,
+  0xcea4, 0xc496,
+  0xcea5, 0xc497,
+  0xcea6, 0xc498,
+  0xcea7, 0xc499,
+  0xcea8, 0xc49a,
+  0xcea9, 0xc49b,
+  0xceaa, 0xc49c,
+  0xceab, 0xc49d,
+  0xceac, 0xc4a1,
+  0xcead, 0xc4a2,
+  0xceae, 0xc4a3,
+  0xceaf, 0xc4a4,
+  0xceb0, 0xc4a5,
+  0xceb1, 0xc4a6,
+  0xceb2, 0xc4a7,
+  0xceb3, 0xc4a8,
+  0xceb4, 0xc4a9,
+  0xceb5, 0xc4aa,
+  0xceb6, 0xc4ab,
+  0xceb7, 0xc4ac,
+  0xceb8, 0xc4ad,
+  0xceb9, 0xc4ae,
+  0xceba, 0xc4af,
+  0xcebb, 0xc4b0,
+  0xcebc, 0xc4b1,
+  0xcebd, 0xc4b3,
+  0xcebe, 0xc4b4,
+  0xcebf, 0xc4b5,
+  0xcec0, 0xc4b6,
+  0xcec1, 0xc4b7,
+  0xcec2, 0xc4b8,
+  0xcec3, 0xc4b9,
+  0xcec4, 0xc4ba,
+  0xcec5, 0xc4bb,
+  0xcec6, 0xc4bc,
+  0xcec7, 0xc4bd,
+  0xcec8, 0xc4c1,
+  0xcec9, 0xc4c2,
+  0xceca, 0xc4c3,
+  0xcecb, 0xc4c4,
+  0xcecc, 0xc4c5,
+  0xcecd, 0xc4c6,
+  0xcece, 0xc4c7,
+  0xcecf, 0xc4c8,
+  0xced0, 0xc4c9,
+  0xced1, 0xc4ca,
+  0xced2, 0xc4cb,
+  0xced3, 0xc4cc,
+  0xced4, 0xc4cd,
+  0xced5, 0xc4ce,
+  0xced6, 0xc4cf,
+  0xced7, 0xc4d0,
+  0xced8, 0xc4d1,
+  0xced9, 0xc4d3,
+  0xceda, 0xc4d4,
+  0xcedb, 0xc4d5,
+  0xcedc, 0xc4d6,
+  0xcedd, 0xc4d7,
+  0xcede, 0xc4d8,
+  0xcedf, 0xc4d9,
+  0xcee0, 0xc4da,
+  0xcee1, 0xc4db,
+  0xcee2, 0xc4dc,
+  0xcee3, 0xc4dd,
+  0xcee4, 0xc4e1,
+  0xcee5, 0xc4e2,
+  0xcee6, 0xc4e3,
+  0xcee7, 0xc4e4,
+  0xcee8, 0xc4e5,
+  0xcee9, 0xc4e6,
+  0xceea, 0xc4e7,
+  0xceeb, 0xc4e8,
+  0xceec, 0xc4e9,
+  0xceed, 0xc4ea,
+  0xceee, 0xc4eb,
+  0xceef, 0xc4ec,
+  0xcef0, 0xc4ed,
+  0xcef1, 0xc4ee,
+  0xcef2, 0xc4ef,
+  0xcef3, 0xc4f0,
+  0xcef4, 0xc4f1,
+  0xcef5, 0xc4f3,
+  0xcef6, 0xc4f4,
+  0xcef7, 0xc4f5,
+  0xcef8, 0xc4f6,
+  0xcef9, 0xc4f7,
+  0xcefa, 0xc4f8,
+  0xcefb, 0xc4f9,
+  0xcefc, 0xc4fa,
+  0xcefd, 0xc4fb,
+  0xcefe, 0xc4fc,
+  0xceff, 0xc4fd,
+  0xcf00, 0xc541,
+  0xcf01, 0xc542,
+  0xcf02, 0xc543,
+  0xcf03, 0xc544,
+  0xcf04, 0xc545,
+  0xcf05, 0xc546,
+  0xcf06, 0xc547,
+  0xcf07, 0xc548,
+  0xcf08, 0xc549,
+  0xcf09, 0xc54a,
+  0xcf0a, 0xc54b,
+  0xcf0b, 0xc54c,
+  0xcf0c, 0xc54d,
+  0xcf0d, 0xc54e,
+  0xcf0e, 0xc54f,
+  0xcf0f, 0xc550,
+  0xcf10, 0xc551,
+  0xcf11, 0xc553,
+  0xcf12, 0xc554,
+  0xcf13, 0xc555,
+  0xcf14, 0xc556,
+  0xcf15, 0xc557,
+  0xcf16, 0xc558,
+  0xcf17, 0xc559,
+  0xcf18, 0xc55a,
+  0xcf19, 0xc55b,
+  0xcf1a, 0xc55c,
+  0xcf1b, 0xc55d,
+  0xcf1c, 0xc561,
+  0xcf1d, 0xc562,
+  0xcf1e, 0xc563,
+  0xcf1f, 0xc564,
+  0xcf20, 0xc565,
+  0xcf21, 0xc566,
+  0xcf22, 0xc567,
+  0xcf23, 0xc568,
+  0xcf24, 0xc569,
+  0xcf25, 0xc56a,
+  0xcf26, 0xc56b,
+  0xcf27, 0xc56c,
+  0xcf28, 0xc56d,
+  0xcf29, 0xc56e,
+  0xcf2a, 0xc56f,
+  0xcf2b, 0xc570,
+  0xcf2c, 0xc571,
+  0xcf2d, 0xc573,
+  0xcf2e, 0xc574,
+  0xcf2f, 0xc575,
+  0xcf30, 0xc576,
+  0xcf31, 0xc577,
+  0xcf32, 0xc578,
+  0xcf33, 0xc579,
+  0xcf34, 0xc57a,
+  0xcf35, 0xc57b,
+  0xcf36, 0xc57c,
+  0xcf37, 0xc57d,
+  0xcf38, 0xc581,
+  0xcf39, 0xc582,
+  0xcf3a, 0xc583,
+  0xcf3b, 0xc584,
+  0xcf3c, 0xc585,
+  0xcf3d, 0xc586,
+  0xcf3e, 0xc587,
+  0xcf3f, 0xc588,
+  0xcf40, 0xc589,
+  0xcf41, 0xc58a,
+  0xcf42, 0xc58b,
+  0xcf43, 0xc58c,
+  0xcf44, 0xc58d,
+  0xcf45, 0xc58e,
+  0xcf46, 0xc58f,
+  0xcf47, 0xc590,
+  0xcf48, 0xc591,
+  0xcf49, 0xc593,
+  0xcf4a, 0xc594,
+  0xcf4b, 0xc595,
+  0xcf4c, 0xc596,
+  0xcf4d, 0xc597,
+  0xcf4e, 0xc598,
+  0xcf4f, 0xc599,
+  0xcf50, 0xc59a,
+  0xcf51, 0xc59b,
+  0xcf52, 0xc59c,
+  0xcf53, 0xc59d,
+  0xcf54, 0xc5a1,
+  0xcf55, 0xc5a2,
+  0xcf56, 0xc5a3,
+  0xcf57, 0xc5a4,
+  0xcf58, 0xc5a5,
+  0xcf59, 0xc5a6,
+  0xcf5a, 0xc5a7,
+  0xcf5b, 0xc5a8,
+  0xcf5c, 0xc5a9,
+  0xcf5d, 0xc5aa,
+  0xcf5e, 0xc5ab,
+  0xcf5f, 0xc5ac,
+  0xcf60, 0xc5ad,
+  0xcf61, 0xc5ae,
+  0xcf62, 0xc5af,
+  0xcf63, 0xc5b0,
+  0xcf64, 0xc5b1,
+  0xcf65, 0xc5b3,
+  0xcf66, 0xc5b4,
+  0xcf67, 0xc5b5,
+  0xcf68, 0xc5b6,
+  0xcf69, 0xc5b7,
+  0xcf6a, 0xc5b8,
+  0xcf6b, 0xc5b9,
+  0xcf6c, 0xc5ba,
+  0xcf6d, 0xc5bb,
+  0xcf6e, 0xc5bc,
+  0xcf6f, 0xc5bd,
+  0xcf70, 0xc5c1,
+  0xcf71, 0xc5c2,
+  0xcf72, 0xc5c3,
+  0xcf73, 0xc5c4,
+  0xcf74, 0xc5c5,
+  0xcf75, 0xc5c6,
+  0xcf76, 0xc5c7,
+  0xcf77, 0xc5c8,
+  0xcf78, 0xc5c9,
+  0xcf79, 0xc5ca,
+  0xcf7a, 0xc5cb,
+  0xcf7b, 0xc5cc,
+  0xcf7c, 0xc5cd,
+  0xcf7d, 0xc5ce,
+  0xcf7e, 0xc5cf,
+  0xcf7f, 0xc5d0,
+  0xcf80, 0xc5d1,
+  0xcf81, 0xc5d3,
+  0xcf82, 0xc5d4,
+  0xcf83, 0xc5d5,
+  0xcf84, 0xc5d6,
+  0xcf85, 0xc5d7,
+  0xcf86, 0xc5d8,
+  0xcf87, 0xc5d9,
+  0xcf88, 0xc5da,
+  0xcf89, 0xc5db,
+  0xcf8a, 0xc5dc,
+  0xcf8b, 0xc5dd,
+  0xcf8c, 0xc5e1,
+  0xcf8d, 0xc5e2,
+  0xcf8e, 0xc5e3,
+  0xcf8f, 0xc5e4,
+  0xcf90, 0xc5e5,
+  0xcf91, 0xc5e6,
+  0xcf92, 0xc5e7,
+  0xcf93, 0xc5e8,
+  0xcf94, 0xc5e9,
+  0xcf95, 0xc5ea,
+  0xcf96, 0xc5eb,
+  0xcf97, 0xc5ec,
+  0xcf98, 0xc5ed,
+  0xcf99, 0xc5ee,
+  0xcf9a, 0xc5ef,
+  0xcf9b, 0xc5f0,
+  0xcf9c, 0xc5f1,
+  0xcf9d, 0xc5f3,
+  0xcf9e, 0xc5f4,
+  0xcf9f, 0xc5f5,
+  0xcfa0, 0xc5f6,
+  0xcfa1, 0xc5f7,
+  0xcfa2, 0xc5f8,
+  0xcfa3, 0xc5f9,
+  0xcfa4, 0xc5fa,
+  0xcfa5, 0xc5fb,
+  0xcfa6, 0xc5fc,
+  0xcfa7, 0xc5fd,
+  0xcfa8, 0xc641,
+  0xcfa9, 0xc642,
+  0xcfaa, 0xc643,
+  0xcfab, 0xc644,
+  0xcfac, 0xc645,
+  0xcfad, 0xc646,
+  0xcfae, 0xc647,
+  0xcfaf, 0xc648,
+  0xcfb0, 0xc649,
+  0xcfb1, 0xc64a,
+  0xcfb2, 0xc64b,
+  0xcfb3, 0xc64c,
+  0xcfb4, 0xc64d,
+  0xcfb5, 0xc64e,
+  0xcfb6, 0xc64f,
+  0xcfb7, 0xc650,
+  0xcfb8, 0xc651,
+  0xcfb9, 0xc653,
+  0xcfba, 0xc654,
+  0xcfbb, 0xc655,
+  0xcfbc, 0xc656,
+  0xcfbd, 0xc657,
+  0xcfbe, 0xc658,
+  0xcfbf, 0xc659,
+  0xcfc0, 0xc65a,
+  0xcfc1, 0xc65b,
+  0xcfc2, 0xc65c,
+  0xcfc3, 0xc65d,
+  0xcfc4, 0xc661,
+  0xcfc5, 0xc662,
+  0xcfc6, 0xc663,
+  0xcfc7, 0xc664,
+  0xcfc8, 0xc665,
+  0xcfc9, 0xc666,
+  0xcfca, 0xc667,
+  0xcfcb, 0xc668,
+  0xcfcc, 0xc669,
+  0xcfcd, 0xc66a,
+  0xcfce, 0xc66b,
+  0xcfcf, 0xc66c,
+  0xcfd0, 0xc66d,
+  0xcfd1, 0xc66e,
+  0xcfd2, 0xc66f,
+  0xcfd3, 0xc670,
+  0xcfd4, 0xc671,
+  0xcfd5, 0xc673,
+  0xcfd6, 0xc674,
+  0xcfd7, 0xc675,
+  0xcfd8, 0xc676,
+  0xcfd9, 0xc677,
+  0xcfda, 0xc678,
+  0xcfdb, 0xc679,
+  0xcfdc, 0xc67a,
+  0xcfdd, 0xc67b,
+  0xcfde, 0xc67c,
+  0xcfdf, 0xc67d,
+  0xcfe0, 0xc681,
+  0xcfe1, 0xc682,
+  0xcfe2, 0xc683,
+  0xcfe3, 0xc684,
+  0xcfe4, 0xc685,
+  0xcfe5, 0xc686,
+  0xcfe6, 0xc687,
+  0xcfe7, 0xc688,
+  0xcfe8, 0xc689,
+  0xcfe9, 0xc68a,
+  0xcfea, 0xc68b,
+  0xcfeb, 0xc68c,
+  0xcfec, 0xc68d,
+  0xcfed, 0xc68e,
+  0xcfee, 0xc68f,
+  0xcfef, 0xc690,
+  0xcff0, 0xc691,
+  0xcff1, 0xc693,
+  0xcff2, 0xc694,
+  0xcff3, 0xc695,
+  0xcff4, 0xc696,
+  0xcff5, 0xc697,
+  0xcff6, 0xc698,
+  0xcff7, 0xc699,
+  0xcff8, 0xc69a,
+  0xcff9, 0xc69b,
+  0xcffa, 0xc69c,
+  0xcffb, 0xc69d,
+  0xcffc, 0xc6a1,
+  0xcffd, 0xc6a2,
+  0xcffe, 0xc6a3,
+  0xcfff, 0xc6a4,
+  0xd000, 0xc6a5,
+  0xd001, 0xc6a6,
+  0xd002, 0xc6a7,
+  0xd003, 0xc6a8,
+  0xd004, 0xc6a9,
+  0xd005, 0xc6aa,
+  0xd006, 0xc6ab,
+  0xd007, 0xc6ac,
+  0xd008, 0xc6ad,
+  0xd009, 0xc6ae,
+  0xd00a, 0xc6af,
+  0xd00b, 0xc6b0,
+  0xd00c, 0xc6b1,
+  0xd00d, 0xc6b3,
+  0xd00e, 0xc6b4,
+  0xd00f, 0xc6b5,
+  0xd010, 0xc6b6,
+  0xd011, 0xc6b7,
+  0xd012, 0xc6b8,
+  0xd013, 0xc6b9,
+  0xd014, 0xc6ba,
+  0xd015, 0xc6bb,
+  0xd016, 0xc6bc,
+  0xd017, 0xc6bd,
+  0xd018, 0xc6c1,
+  0xd019, 0xc6c2,
+  0xd01a, 0xc6c3,
+  0xd01b, 0xc6c4,
+  0xd01c, 0xc6c5,
+  0xd01d, 0xc6c6,
+  0xd01e, 0xc6c7,
+  0xd01f, 0xc6c8,
+  0xd020, 0xc6c9,
+  0xd021, 0xc6ca,
+  0xd022, 0xc6cb,
+  0xd023, 0xc6cc,
+  0xd024, 0xc6cd,
+  0xd025, 0xc6ce,
+  0xd026, 0xc6cf,
+  0xd027, 0xc6d0,
+  0xd028, 0xc6d1,
+  0xd029, 0xc6d3,
+  0xd02a, 0xc6d4,
+  0xd02b, 0xc6d5,
+  0xd02c, 0xc6d6,
+  0xd02d, 0xc6d7,
+  0xd02e, 0xc6d8,
+  0xd02f, 0xc6d9,
+  0xd030, 0xc6da,
+  0xd031, 0xc6db,
+  0xd032, 0xc6dc,
+  0xd033, 0xc6dd,
+  0xd034, 0xc6e1,
+  0xd035, 0xc6e2,
+  0xd036, 0xc6e3,
+  0xd037, 0xc6e4,
+  0xd038, 0xc6e5,
+  0xd039, 0xc6e6,
+  0xd03a, 0xc6e7,
+  0xd03b, 0xc6e8,
+  0xd03c, 0xc6e9,
+  0xd03d, 0xc6ea,
+  0xd03e, 0xc6eb,
+  0xd03f, 0xc6ec,
+  0xd040, 0xc6ed,
+  0xd041, 0xc6ee,
+  0xd042, 0xc6ef,
+  0xd043, 0xc6f0,
+  0xd044, 0xc6f1,
+  0xd045, 0xc6f3,
+  0xd046, 0xc6f4,
+  0xd047, 0xc6f5,
+  0xd048, 0xc6f6,
+  0xd049, 0xc6f7,
+  0xd04a, 0xc6f8,
+  0xd04b, 0xc6f9,
+  0xd04c, 0xc6fa,
+  0xd04d, 0xc6fb,
+  0xd04e, 0xc6fc,
+  0xd04f, 0xc6fd,
+  0xd050, 0xc741,
+  0xd051, 0xc742,
+  0xd052, 0xc743,
+  0xd053, 0xc744,
+  0xd054, 0xc745,
+  0xd055, 0xc746,
+  0xd056, 0xc747,
+  0xd057, 0xc748,
+  0xd058, 0xc749,
+  0xd059, 0xc74a,
+  0xd05a, 0xc74b,
+  0xd05b, 0xc74c,
+  0xd05c, 0xc74d,
+  0xd05d, 0xc74e,
+  0xd05e, 0xc74f,
+  0xd05f, 0xc750,
+  0xd060, 0xc751,
+  0xd061, 0xc753,
+  0xd062, 0xc754,
+  0xd063, 0xc755,
+  0xd064, 0xc756,
+  0xd065, 0xc757,
+  0xd066, 0xc758,
+  0xd067, 0xc759,
+  0xd068, 0xc75a,
+  0xd069, 0xc75b,
+  0xd06a, 0xc75c,
+  0xd06b, 0xc75d,
+  0xd06c, 0xc761,
+  0xd06d, 0xc762,
+  0xd06e, 0xc763,
+  0xd06f, 0xc764,
+  0xd070, 0xc765,
+  0xd071, 0xc766,
+  0xd072, 0xc767,
+  0xd073, 0xc768,
+  0xd074, 0xc769,
+  0xd075, 0xc76a,
+  0xd076, 0xc76b,
+  0xd077, 0xc76c,
+  0xd078, 0xc76d,
+  0xd079, 0xc76e,
+  0xd07a, 0xc76f,
+  0xd07b, 0xc770,
+  0xd07c, 0xc771,
+  0xd07d, 0xc773,
+  0xd07e, 0xc774,
+  0xd07f, 0xc775,
+  0xd080, 0xc776,
+  0xd081, 0xc777,
+  0xd082, 0xc778,
+  0xd083, 0xc779,
+  0xd084, 0xc77a,
+  0xd085, 0xc77b,
+  0xd086, 0xc77c,
+  0xd087, 0xc77d,
+  0xd088, 0xc781,
+  0xd089, 0xc782,
+  0xd08a, 0xc783,
+  0xd08b, 0xc784,
+  0xd08c, 0xc785,
+  0xd08d, 0xc786,
+  0xd08e, 0xc787,
+  0xd08f, 0xc788,
+  0xd090, 0xc789,
+  0xd091, 0xc78a,
+  0xd092, 0xc78b,
+  0xd093, 0xc78c,
+  0xd094, 0xc78d,
+  0xd095, 0xc78e,
+  0xd096, 0xc78f,
+  0xd097, 0xc790,
+  0xd098, 0xc791,
+  0xd099, 0xc793,
+  0xd09a, 0xc794,
+  0xd09b, 0xc795,
+  0xd09c, 0xc796,
+  0xd09d, 0xc797,
+  0xd09e, 0xc798,
+  0xd09f, 0xc799,
+  0xd0a0, 0xc79a,
+  0xd0a1, 0xc79b,
+  0xd0a2, 0xc79c,
+  0xd0a3, 0xc79d,
+  0xd0a4, 0xc7a1,
+  0xd0a5, 0xc7a2,
+  0xd0a6, 0xc7a3,
+  0xd0a7, 0xc7a4,
+  0xd0a8, 0xc7a5,
+  0xd0a9, 0xc7a6,
+  0xd0aa, 0xc7a7,
+  0xd0ab, 0xc7a8,
+  0xd0ac, 0xc7a9,
+  0xd0ad, 0xc7aa,
+  0xd0ae, 0xc7ab,
+  0xd0af, 0xc7ac,
+  0xd0b0, 0xc7ad,
+  0xd0b1, 0xc7ae,
+  0xd0b2, 0xc7af,
+  0xd0b3, 0xc7b0,
+  0xd0b4, 0xc7b1,
+  0xd0b5, 0xc7b3,
+  0xd0b6, 0xc7b4,
+  0xd0b7, 0xc7b5,
+  0xd0b8, 0xc7b6,
+  0xd0b9, 0xc7b7,
+  0xd0ba, 0xc7b8,
+  0xd0bb, 0xc7b9,
+  0xd0bc, 0xc7ba,
+  0xd0bd, 0xc7bb,
+  0xd0be, 0xc7bc,
+  0xd0bf, 0xc7bd,
+  0xd0c0, 0xc861,
+  0xd0c1, 0xc862,
+  0xd0c2, 0xc863,
+  0xd0c3, 0xc864,
+  0xd0c4, 0xc865,
+  0xd0c5, 0xc866,
+  0xd0c6, 0xc867,
+  0xd0c7, 0xc868,
+  0xd0c8, 0xc869,
+  0xd0c9, 0xc86a,
+  0xd0ca, 0xc86b,
+  0xd0cb, 0xc86c,
+  0xd0cc, 0xc86d,
+  0xd0cd, 0xc86e,
+  0xd0ce, 0xc86f,
+  0xd0cf, 0xc870,
+  0xd0d0, 0xc871,
+  0xd0d1, 0xc873,
+  0xd0d2, 0xc874,
+  0xd0d3, 0xc875,
+  0xd0d4, 0xc876,
+  0xd0d5, 0xc877,
+  0xd0d6, 0xc878,
+  0xd0d7, 0xc879,
+  0xd0d8, 0xc87a,
+  0xd0d9, 0xc87b,
+  0xd0da, 0xc87c,
+  0xd0db, 0xc87d,
+  0xd0dc, 0xc881,
+  0xd0dd, 0xc882,
+  0xd0de, 0xc883,
+  0xd0df, 0xc884,
+  0xd0e0, 0xc885,
+  0xd0e1, 0xc886,
+  0xd0e2, 0xc887,
+  0xd0e3, 0xc888,
+  0xd0e4, 0xc889,
+  0xd0e5, 0xc88a,
+  0xd0e6, 0xc88b,
+  0xd0e7, 0xc88c,
+  0xd0e8, 0xc88d,
+  0xd0e9, 0xc88e,
+  0xd0ea, 0xc88f,
+  0xd0eb, 0xc890,
+  0xd0ec, 0xc891,
+  0xd0ed, 0xc893,
+  0xd0ee, 0xc894,
+  0xd0ef, 0xc895,
+  0xd0f0, 0xc896,
+  0xd0f1, 0xc897,
+  0xd0f2, 0xc898,
+  0xd0f3, 0xc899,
+  0xd0f4, 0xc89a,
+  0xd0f5, 0xc89b,
+  0xd0f6, 0xc89c,
+  0xd0f7, 0xc89d,
+  0xd0f8, 0xc8a1,
+  0xd0f9, 0xc8a2,
+  0xd0fa, 0xc8a3,
+  0xd0fb, 0xc8a4,
+  0xd0fc, 0xc8a5,
+  0xd0fd, 0xc8a6,
+  0xd0fe, 0xc8a7,
+  0xd0ff, 0xc8a8,
+  0xd100, 0xc8a9,
+  0xd101, 0xc8aa,
+  0xd102, 0xc8ab,
+  0xd103, 0xc8ac,
+  0xd104, 0xc8ad,
+  0xd105, 0xc8ae,
+  0xd106, 0xc8af,
+  0xd107, 0xc8b0,
+  0xd108, 0xc8b1,
+  0xd109, 0xc8b3,
+  0xd10a, 0xc8b4,
+  0xd10b, 0xc8b5,
+  0xd10c, 0xc8b6,
+  0xd10d, 0xc8b7,
+  0xd10e, 0xc8b8,
+  0xd10f, 0xc8b9,
+  0xd110, 0xc8ba,
+  0xd111, 0xc8bb,
+  0xd112, 0xc8bc,
+  0xd113, 0xc8bd,
+  0xd114, 0xc8c1,
+  0xd115, 0xc8c2,
+  0xd116, 0xc8c3,
+  0xd117, 0xc8c4,
+  0xd118, 0xc8c5,
+  0xd119, 0xc8c6,
+  0xd11a, 0xc8c7,
+  0xd11b, 0xc8c8,
+  0xd11c, 0xc8c9,
+  0xd11d, 0xc8ca,
+  0xd11e, 0xc8cb,
+  0xd11f, 0xc8cc,
+  0xd120, 0xc8cd,
+  0xd121, 0xc8ce,
+  0xd122, 0xc8cf,
+  0xd123, 0xc8d0,
+  0xd124, 0xc8d1,
+  0xd125, 0xc8d3,
+  0xd126, 0xc8d4,
+  0xd127, 0xc8d5,
+  0xd128, 0xc8d6,
+  0xd129, 0xc8d7,
+  0xd12a, 0xc8d8,
+  0xd12b, 0xc8d9,
+  0xd12c, 0xc8da,
+  0xd12d, 0xc8db,
+  0xd12e, 0xc8dc,
+  0xd12f, 0xc8dd,
+  0xd130, 0xc8e1,
+  0xd131, 0xc8e2,
+  0xd132, 0xc8e3,
+  0xd133, 0xc8e4,
+  0xd134, 0xc8e5,
+  0xd135, 0xc8e6,
+  0xd136, 0xc8e7,
+  0xd137, 0xc8e8,
+  0xd138, 0xc8e9,
+  0xd139, 0xc8ea,
+  0xd13a, 0xc8eb,
+  0xd13b, 0xc8ec,
+  0xd13c, 0xc8ed,
+  0xd13d, 0xc8ee,
+  0xd13e, 0xc8ef,
+  0xd13f, 0xc8f0,
+  0xd140, 0xc8f1,
+  0xd141, 0xc8f3,
+  0xd142, 0xc8f4,
+  0xd143, 0xc8f5,
+  0xd144, 0xc8f6,
+  0xd145, 0xc8f7,
+  0xd146, 0xc8f8,
+  0xd147, 0xc8f9,
+  0xd148, 0xc8fa,
+  0xd149, 0xc8fb,
+  0xd14a, 0xc8fc,
+  0xd14b, 0xc8fd,
+  0xd14c, 0xc941,
+  0xd14d, 0xc942,
+  0xd14e, 0xc943,
+  0xd14f, 0xc944,
+  0xd150, 0xc945,
+  0xd151, 0xc946,
+  0xd152, 0xc947,
+  0xd153, 0xc948,
+  0xd154, 0xc949,
+  0xd155, 0xc94a,
+  0xd156, 0xc94b,
+  0xd157, 0xc94c,
+  0xd158, 0xc94d,
+  0xd159, 0xc94e,
+  0xd15a, 0xc94f,
+  0xd15b, 0xc950,
+  0xd15c, 0xc951,
+  0xd15d, 0xc953,
+  0xd15e, 0xc954,
+  0xd15f, 0xc955,
+  0xd160, 0xc956,
+  0xd161, 0xc957,
+  0xd162, 0xc958,
+  0xd163, 0xc959,
+  0xd164, 0xc95a,
+  0xd165, 0xc95b,
+  0xd166, 0xc95c,
+  0xd167, 0xc95d,
+  0xd168, 0xc961,
+  0xd169, 0xc962,
+  0xd16a, 0xc963,
+  0xd16b, 0xc964,
+  0xd16c, 0xc965,
+  0xd16d, 0xc966,
+  0xd16e, 0xc967,
+  0xd16f, 0xc968,
+  0xd170, 0xc969,
+  0xd171, 0xc96a,
+  0xd172, 0xc96b,
+  0xd173, 0xc96c,
+  0xd174, 0xc96d,
+  0xd175, 0xc96e,
+  0xd176, 0xc96f,
+  0xd177, 0xc970,
+  0xd178, 0xc971,
+  0xd179, 0xc973,
+  0xd17a, 0xc974,
+  0xd17b, 0xc975,
+  0xd17c, 0xc976,
+  0xd17d, 0xc977,
+  0xd17e, 0xc978,
+  0xd17f, 0xc979,
+  0xd180, 0xc97a,
+  0xd181, 0xc97b,
+  0xd182, 0xc97c,
+  0xd183, 0xc97d,
+  0xd184, 0xc981,
+  0xd185, 0xc982,
+  0xd186, 0xc983,
+  0xd187, 0xc984,
+  0xd188, 0xc985,
+  0xd189, 0xc986,
+  0xd18a, 0xc987,
+  0xd18b, 0xc988,
+  0xd18c, 0xc989,
+  0xd18d, 0xc98a,
+  0xd18e, 0xc98b,
+  0xd18f, 0xc98c,
+  0xd190, 0xc98d,
+  0xd191, 0xc98e,
+  0xd192, 0xc98f,
+  0xd193, 0xc990,
+  0xd194, 0xc991,
+  0xd195, 0xc993,
+  0xd196, 0xc994,
+  0xd197, 0xc995,
+  0xd198, 0xc996,
+  0xd199, 0xc997,
+  0xd19a, 0xc998,
+  0xd19b, 0xc999,
+  0xd19c, 0xc99a,
+  0xd19d, 0xc99b,
+  0xd19e, 0xc99c,
+  0xd19f, 0xc99d,
+  0xd1a0, 0xc9a1,
+  0xd1a1, 0xc9a2,
+  0xd1a2, 0xc9a3,
+  0xd1a3, 0xc9a4,
+  0xd1a4, 0xc9a5,
+  0xd1a5, 0xc9a6,
+  0xd1a6, 0xc9a7,
+  0xd1a7, 0xc9a8,
+  0xd1a8, 0xc9a9,
+  0xd1a9, 0xc9aa,
+  0xd1aa, 0xc9ab,
+  0xd1ab, 0xc9ac,
+  0xd1ac, 0xc9ad,
+  0xd1ad, 0xc9ae,
+  0xd1ae, 0xc9af,
+  0xd1af, 0xc9b0,
+  0xd1b0, 0xc9b1,
+  0xd1b1, 0xc9b3,
+  0xd1b2, 0xc9b4,
+  0xd1b3, 0xc9b5,
+  0xd1b4, 0xc9b6,
+  0xd1b5, 0xc9b7,
+  0xd1b6, 0xc9b8,
+  0xd1b7, 0xc9b9,
+  0xd1b8, 0xc9ba,
+  0xd1b9, 0xc9bb,
+  0xd1ba, 0xc9bc,
+  0xd1bb, 0xc9bd,
+  0xd1bc, 0xc9c1,
+  0xd1bd, 0xc9c2,
+  0xd1be, 0xc9c3,
+  0xd1bf, 0xc9c4,
+  0xd1c0, 0xc9c5,
+  0xd1c1, 0xc9c6,
+  0xd1c2, 0xc9c7,
+  0xd1c3, 0xc9c8,
+  0xd1c4, 0xc9c9,
+  0xd1c5, 0xc9ca,
+  0xd1c6, 0xc9cb,
+  0xd1c7, 0xc9cc,
+  0xd1c8, 0xc9cd,
+  0xd1c9, 0xc9ce,
+  0xd1ca, 0xc9cf,
+  0xd1cb, 0xc9d0,
+  0xd1cc, 0xc9d1,
+  0xd1cd, 0xc9d3,
+  0xd1ce, 0xc9d4,
+  0xd1cf, 0xc9d5,
+  0xd1d0, 0xc9d6,
+  0xd1d1, 0xc9d7,
+  0xd1d2, 0xc9d8,
+  0xd1d3, 0xc9d9,
+  0xd1d4, 0xc9da,
+  0xd1d5, 0xc9db,
+  0xd1d6, 0xc9dc,
+  0xd1d7, 0xc9dd,
+  0xd1d8, 0xc9e1,
+  0xd1d9, 0xc9e2,
+  0xd1da, 0xc9e3,
+  0xd1db, 0xc9e4,
+  0xd1dc, 0xc9e5,
+  0xd1dd, 0xc9e6,
+  0xd1de, 0xc9e7,
+  0xd1df, 0xc9e8,
+  0xd1e0, 0xc9e9,
+  0xd1e1, 0xc9ea,
+  0xd1e2, 0xc9eb,
+  0xd1e3, 0xc9ec,
+  0xd1e4, 0xc9ed,
+  0xd1e5, 0xc9ee,
+  0xd1e6, 0xc9ef,
+  0xd1e7, 0xc9f0,
+  0xd1e8, 0xc9f1,
+  0xd1e9, 0xc9f3,
+  0xd1ea, 0xc9f4,
+  0xd1eb, 0xc9f5,
+  0xd1ec, 0xc9f6,
+  0xd1ed, 0xc9f7,
+  0xd1ee, 0xc9f8,
+  0xd1ef, 0xc9f9,
+  0xd1f0, 0xc9fa,
+  0xd1f1, 0xc9fb,
+  0xd1f2, 0xc9fc,
+  0xd1f3, 0xc9fd,
+  0xd1f4, 0xca41,
+  0xd1f5, 0xca42,
+  0xd1f6, 0xca43,
+  0xd1f7, 0xca44,
+  0xd1f8, 0xca45,
+  0xd1f9, 0xca46,
+  0xd1fa, 0xca47,
+  0xd1fb, 0xca48,
+  0xd1fc, 0xca49,
+  0xd1fd, 0xca4a,
+  0xd1fe, 0xca4b,
+  0xd1ff, 0xca4c,
+  0xd200, 0xca4d,
+  0xd201, 0xca4e,
+  0xd202, 0xca4f,
+  0xd203, 0xca50,
+  0xd204, 0xca51,
+  0xd205, 0xca53,
+  0xd206, 0xca54,
+  0xd207, 0xca55,
+  0xd208, 0xca56,
+  0xd209, 0xca57,
+  0xd20a, 0xca58,
+  0xd20b, 0xca59,
+  0xd20c, 0xca5a,
+  0xd20d, 0xca5b,
+  0xd20e, 0xca5c,
+  0xd20f, 0xca5d,
+  0xd210, 0xca61,
+  0xd211, 0xca62,
+  0xd212, 0xca63,
+  0xd213, 0xca64,
+  0xd214, 0xca65,
+  0xd215, 0xca66,
+  0xd216, 0xca67,
+  0xd217, 0xca68,
+  0xd218, 0xca69,
+  0xd219, 0xca6a,
+  0xd21a, 0xca6b,
+  0xd21b, 0xca6c,
+  0xd21c, 0xca6d,
+  0xd21d, 0xca6e,
+  0xd21e, 0xca6f,
+  0xd21f, 0xca70,
+  0xd220, 0xca71,
+  0xd221, 0xca73,
+  0xd222, 0xca74,
+  0xd223, 0xca75,
+  0xd224, 0xca76,
+  0xd225, 0xca77,
+  0xd226, 0xca78,
+  0xd227, 0xca79,
+  0xd228, 0xca7a,
+  0xd229, 0xca7b,
+  0xd22a, 0xca7c,
+  0xd22b, 0xca7d,
+  0xd22c, 0xca81,
+  0xd22d, 0xca82,
+  0xd22e, 0xca83,
+  0xd22f, 0xca84,
+  0xd230, 0xca85,
+  0xd231, 0xca86,
+  0xd232, 0xca87,
+  0xd233, 0xca88,
+  0xd234, 0xca89,
+  0xd235, 0xca8a,
+  0xd236, 0xca8b,
+  0xd237, 0xca8c,
+  0xd238, 0xca8d,
+  0xd239, 0xca8e,
+  0xd23a, 0xca8f,
+  0xd23b, 0xca90,
+  0xd23c, 0xca91,
+  0xd23d, 0xca93,
+  0xd23e, 0xca94,
+  0xd23f, 0xca95,
+  0xd240, 0xca96,
+  0xd241, 0xca97,
+  0xd242, 0xca98,
+  0xd243, 0xca99,
+  0xd244, 0xca9a,
+  0xd245, 0xca9b,
+  0xd246, 0xca9c,
+  0xd247, 0xca9d,
+  0xd248, 0xcaa1,
+  0xd249, 0xcaa2,
+  0xd24a, 0xcaa3,
+  0xd24b, 0xcaa4,
+  0xd24c, 0xcaa5,
+  0xd24d, 0xcaa6,
+  0xd24e, 0xcaa7,
+  0xd24f, 0xcaa8,
+  0xd250, 0xcaa9,
+  0xd251, 0xcaaa,
+  0xd252, 0xcaab,
+  0xd253, 0xcaac,
+  0xd254, 0xcaad,
+  0xd255, 0xcaae,
+  0xd256, 0xcaaf,
+  0xd257, 0xcab0,
+  0xd258, 0xcab1,
+  0xd259, 0xcab3,
+  0xd25a, 0xcab4,
+  0xd25b, 0xcab5,
+  0xd25c, 0xcab6,
+  0xd25d, 0xcab7,
+  0xd25e, 0xcab8,
+  0xd25f, 0xcab9,
+  0xd260, 0xcaba,
+  0xd261, 0xcabb,
+  0xd262, 0xcabc,
+  0xd263, 0xcabd,
+  0xd264, 0xcac1,
+  0xd265, 0xcac2,
+  0xd266, 0xcac3,
+  0xd267, 0xcac4,
+  0xd268, 0xcac5,
+  0xd269, 0xcac6,
+  0xd26a, 0xcac7,
+  0xd26b, 0xcac8,
+  0xd26c, 0xcac9,
+  0xd26d, 0xcaca,
+  0xd26e, 0xcacb,
+  0xd26f, 0xcacc,
+  0xd270, 0xcacd,
+  0xd271, 0xcace,
+  0xd272, 0xcacf,
+  0xd273, 0xcad0,
+  0xd274, 0xcad1,
+  0xd275, 0xcad3,
+  0xd276, 0xcad4,
+  0xd277, 0xcad5,
+  0xd278, 0xcad6,
+  0xd279, 0xcad7,
+  0xd27a, 0xcad8,
+  0xd27b, 0xcad9,
+  0xd27c, 0xcada,
+  0xd27d, 0xcadb,
+  0xd27e, 0xcadc,
+  0xd27f, 0xcadd,
+  0xd280, 0xcae1,
+  0xd281, 0xcae2,
+  0xd282, 0xcae3,
+  0xd283, 0xcae4,
+  0xd284, 0xcae5,
+  0xd285, 0xcae6,
+  0xd286, 0xcae7,
+  0xd287, 0xcae8,
+  0xd288, 0xcae9,
+  0xd289, 0xcaea,
+  0xd28a, 0xcaeb,
+  0xd28b, 0xcaec,
+  0xd28c, 0xcaed,
+  0xd28d, 0xcaee,
+  0xd28e, 0xcaef,
+  0xd28f, 0xcaf0,
+  0xd290, 0xcaf1,
+  0xd291, 0xcaf3,
+  0xd292, 0xcaf4,
+  0xd293, 0xcaf5,
+  0xd294, 0xcaf6,
+  0xd295, 0xcaf7,
+  0xd296, 0xcaf8,
+  0xd297, 0xcaf9,
+  0xd298, 0xcafa,
+  0xd299, 0xcafb,
+  0xd29a, 0xcafc,
+  0xd29b, 0xcafd,
+  0xd29c, 0xcb41,
+  0xd29d, 0xcb42,
+  0xd29e, 0xcb43,
+  0xd29f, 0xcb44,
+  0xd2a0, 0xcb45,
+  0xd2a1, 0xcb46,
+  0xd2a2, 0xcb47,
+  0xd2a3, 0xcb48,
+  0xd2a4, 0xcb49,
+  0xd2a5, 0xcb4a,
+  0xd2a6, 0xcb4b,
+  0xd2a7, 0xcb4c,
+  0xd2a8, 0xcb4d,
+  0xd2a9, 0xcb4e,
+  0xd2aa, 0xcb4f,
+  0xd2ab, 0xcb50,
+  0xd2ac, 0xcb51,
+  0xd2ad, 0xcb53,
+  0xd2ae, 0xcb54,
+  0xd2af, 0xcb55,
+  0xd2b0, 0xcb56,
+  0xd2b1, 0xcb57,
+  0xd2b2, 0xcb58,
+  0xd2b3, 0xcb59,
+  0xd2b4, 0xcb5a,
+  0xd2b5, 0xcb5b,
+  0xd2b6, 0xcb5c,
+  0xd2b7, 0xcb5d,
+  0xd2b8, 0xcb61,
+  0xd2b9, 0xcb62,
+  0xd2ba, 0xcb63,
+  0xd2bb, 0xcb64,
+  0xd2bc, 0xcb65,
+  0xd2bd, 0xcb66,
+  0xd2be, 0xcb67,
+  0xd2bf, 0xcb68,
+  0xd2c0, 0xcb69,
+  0xd2c1, 0xcb6a,
+  0xd2c2, 0xcb6b,
+  0xd2c3, 0xcb6c,
+  0xd2c4, 0xcb6d,
+  0xd2c5, 0xcb6e,
+  0xd2c6, 0xcb6f,
+  0xd2c7, 0xcb70,
+  0xd2c8, 0xcb71,
+  0xd2c9, 0xcb73,
+  0xd2ca, 0xcb74,
+  0xd2cb, 0xcb75,
+  0xd2cc, 0xcb76,
+  0xd2cd, 0xcb77,
+  0xd2ce, 0xcb78,
+  0xd2cf, 0xcb79,
+  0xd2d0, 0xcb7a,
+  0xd2d1, 0xcb7b,
+  0xd2d2, 0xcb7c,
+  0xd2d3, 0xcb7d,
+  0xd2d4, 0xcb81,
+  0xd2d5, 0xcb82,
+  0xd2d6, 0xcb83,
+  0xd2d7, 0xcb84,
+  0xd2d8, 0xcb85,
+  0xd2d9, 0xcb86,
+  0xd2da, 0xcb87,
+  0xd2db, 0xcb88,
+  0xd2dc, 0xcb89,
+  0xd2dd, 0xcb8a,
+  0xd2de, 0xcb8b,
+  0xd2df, 0xcb8c,
+  0xd2e0, 0xcb8d,
+  0xd2e1, 0xcb8e,
+  0xd2e2, 0xcb8f,
+  0xd2e3, 0xcb90,
+  0xd2e4, 0xcb91,
+  0xd2e5, 0xcb93,
+  0xd2e6, 0xcb94,
+  0xd2e7, 0xcb95,
+  0xd2e8, 0xcb96,
+  0xd2e9, 0xcb97,
+  0xd2ea, 0xcb98,
+  0xd2eb, 0xcb99,
+  0xd2ec, 0xcb9a,
+  0xd2ed, 0xcb9b,
+  0xd2ee, 0xcb9c,
+  0xd2ef, 0xcb9d,
+  0xd2f0, 0xcba1,
+  0xd2f1, 0xcba2,
+  0xd2f2, 0xcba3,
+  0xd2f3, 0xcba4,
+  0xd2f4, 0xcba5,
+  0xd2f5, 0xcba6,
+  0xd2f6, 0xcba7,
+  0xd2f7, 0xcba8,
+  0xd2f8, 0xcba9,
+  0xd2f9, 0xcbaa,
+  0xd2fa, 0xcbab,
+  0xd2fb, 0xcbac,
+  0xd2fc, 0xcbad,
+  0xd2fd, 0xcbae,
+  0xd2fe, 0xcbaf,
+  0xd2ff, 0xcbb0,
+  0xd300, 0xcbb1,
+  0xd301, 0xcbb3,
+  0xd302, 0xcbb4,
+  0xd303, 0xcbb5,
+  0xd304, 0xcbb6,
+  0xd305, 0xcbb7,
+  0xd306, 0xcbb8,
+  0xd307, 0xcbb9,
+  0xd308, 0xcbba,
+  0xd309, 0xcbbb,
+  0xd30a, 0xcbbc,
+  0xd30b, 0xcbbd,
+  0xd30c, 0xcc61,
+  0xd30d, 0xcc62,
+  0xd30e, 0xcc63,
+  0xd30f, 0xcc64,
+  0xd310, 0xcc65,
+  0xd311, 0xcc66,
+  0xd312, 0xcc67,
+  0xd313, 0xcc68,
+  0xd314, 0xcc69,
+  0xd315, 0xcc6a,
+  0xd316, 0xcc6b,
+  0xd317, 0xcc6c,
+  0xd318, 0xcc6d,
+  0xd319, 0xcc6e,
+  0xd31a, 0xcc6f,
+  0xd31b, 0xcc70,
+  0xd31c, 0xcc71,
+  0xd31d, 0xcc73,
+  0xd31e, 0xcc74,
+  0xd31f, 0xcc75,
+  0xd320, 0xcc76,
+  0xd321, 0xcc77,
+  0xd322, 0xcc78,
+  0xd323, 0xcc79,
+  0xd324, 0xcc7a,
+  0xd325, 0xcc7b,
+  0xd326, 0xcc7c,
+  0xd327, 0xcc7d,
+  0xd328, 0xcc81,
+  0xd329, 0xcc82,
+  0xd32a, 0xcc83,
+  0xd32b, 0xcc84,
+  0xd32c, 0xcc85,
+  0xd32d, 0xcc86,
+  0xd32e, 0xcc87,
+  0xd32f, 0xcc88,
+  0xd330, 0xcc89,
+  0xd331, 0xcc8a,
+  0xd332, 0xcc8b,
+  0xd333, 0xcc8c,
+  0xd334, 0xcc8d,
+  0xd335, 0xcc8e,
+  0xd336, 0xcc8f,
+  0xd337, 0xcc90,
+  0xd338, 0xcc91,
+  0xd339, 0xcc93,
+  0xd33a, 0xcc94,
+  0xd33b, 0xcc95,
+  0xd33c, 0xcc96,
+  0xd33d, 0xcc97,
+  0xd33e, 0xcc98,
+  0xd33f, 0xcc99,
+  0xd340, 0xcc9a,
+  0xd341, 0xcc9b,
+  0xd342, 0xcc9c,
+  0xd343, 0xcc9d,
+  0xd344, 0xcca1,
+  0xd345, 0xcca2,
+  0xd346, 0xcca3,
+  0xd347, 0xcca4,
+  0xd348, 0xcca5,
+  0xd349, 0xcca6,
+  0xd34a, 0xcca7,
+  0xd34b, 0xcca8,
+  0xd34c, 0xcca9,
+  0xd34d, 0xccaa,
+  0xd34e, 0xccab,
+  0xd34f, 0xccac,
+  0xd350, 0xccad,
+  0xd351, 0xccae,
+  0xd352, 0xccaf,
+  0xd353, 0xccb0,
+  0xd354, 0xccb1,
+  0xd355, 0xccb3,
+  0xd356, 0xccb4,
+  0xd357, 0xccb5,
+  0xd358, 0xccb6,
+  0xd359, 0xccb7,
+  0xd35a, 0xccb8,
+  0xd35b, 0xccb9,
+  0xd35c, 0xccba,
+  0xd35d, 0xccbb,
+  0xd35e, 0xccbc,
+  0xd35f, 0xccbd,
+  0xd360, 0xccc1,
+  0xd361, 0xccc2,
+  0xd362, 0xccc3,
+  0xd363, 0xccc4,
+  0xd364, 0xccc5,
+  0xd365, 0xccc6,
+  0xd366, 0xccc7,
+  0xd367, 0xccc8,
+  0xd368, 0xccc9,
+  0xd369, 0xccca,
+  0xd36a, 0xcccb,
+  0xd36b, 0xcccc,
+  0xd36c, 0xcccd,
+  0xd36d, 0xccce,
+  0xd36e, 0xcccf,
+  0xd36f, 0xccd0,
+  0xd370, 0xccd1,
+  0xd371, 0xccd3,
+  0xd372, 0xccd4,
+  0xd373, 0xccd5,
+  0xd374, 0xccd6,
+  0xd375, 0xccd7,
+  0xd376, 0xccd8,
+  0xd377, 0xccd9,
+  0xd378, 0xccda,
+  0xd379, 0xccdb,
+  0xd37a, 0xccdc,
+  0xd37b, 0xccdd,
+  0xd37c, 0xcce1,
+  0xd37d, 0xcce2,
+  0xd37e, 0xcce3,
+  0xd37f, 0xcce4,
+  0xd380, 0xcce5,
+  0xd381, 0xcce6,
+  0xd382, 0xcce7,
+  0xd383, 0xcce8,
+  0xd384, 0xcce9,
+  0xd385, 0xccea,
+  0xd386, 0xcceb,
+  0xd387, 0xccec,
+  0xd388, 0xcced,
+  0xd389, 0xccee,
+  0xd38a, 0xccef,
+  0xd38b, 0xccf0,
+  0xd38c, 0xccf1,
+  0xd38d, 0xccf3,
+  0xd38e, 0xccf4,
+  0xd38f, 0xccf5,
+  0xd390, 0xccf6,
+  0xd391, 0xccf7,
+  0xd392, 0xccf8,
+  0xd393, 0xccf9,
+  0xd394, 0xccfa,
+  0xd395, 0xccfb,
+  0xd396, 0xccfc,
+  0xd397, 0xccfd,
+  0xd398, 0xcd41,
+  0xd399, 0xcd42,
+  0xd39a, 0xcd43,
+  0xd39b, 0xcd44,
+  0xd39c, 0xcd45,
+  0xd39d, 0xcd46,
+  0xd39e, 0xcd47,
+  0xd39f, 0xcd48,
+  0xd3a0, 0xcd49,
+  0xd3a1, 0xcd4a,
+  0xd3a2, 0xcd4b,
+  0xd3a3, 0xcd4c,
+  0xd3a4, 0xcd4d,
+  0xd3a5, 0xcd4e,
+  0xd3a6, 0xcd4f,
+  0xd3a7, 0xcd50,
+  0xd3a8, 0xcd51,
+  0xd3a9, 0xcd53,
+  0xd3aa, 0xcd54,
+  0xd3ab, 0xcd55,
+  0xd3ac, 0xcd56,
+  0xd3ad, 0xcd57,
+  0xd3ae, 0xcd58,
+  0xd3af, 0xcd59,
+  0xd3b0, 0xcd5a,
+  0xd3b1, 0xcd5b,
+  0xd3b2, 0xcd5c,
+  0xd3b3, 0xcd5d,
+  0xd3b4, 0xcd61,
+  0xd3b5, 0xcd62,
+  0xd3b6, 0xcd63,
+  0xd3b7, 0xcd64,
+  0xd3b8, 0xcd65,
+  0xd3b9, 0xcd66,
+  0xd3ba, 0xcd67,
+  0xd3bb, 0xcd68,
+  0xd3bc, 0xcd69,
+  0xd3bd, 0xcd6a,
+  0xd3be, 0xcd6b,
+  0xd3bf, 0xcd6c,
+  0xd3c0, 0xcd6d,
+  0xd3c1, 0xcd6e,
+  0xd3c2, 0xcd6f,
+  0xd3c3, 0xcd70,
+  0xd3c4, 0xcd71,
+  0xd3c5, 0xcd73,
+  0xd3c6, 0xcd74,
+  0xd3c7, 0xcd75,
+  0xd3c8, 0xcd76,
+  0xd3c9, 0xcd77,
+  0xd3ca, 0xcd78,
+  0xd3cb, 0xcd79,
+  0xd3cc, 0xcd7a,
+  0xd3cd, 0xcd7b,
+  0xd3ce, 0xcd7c,
+  0xd3cf, 0xcd7d,
+  0xd3d0, 0xcd81,
+  0xd3d1, 0xcd82,
+  0xd3d2, 0xcd83,
+  0xd3d3, 0xcd84,
+  0xd3d4, 0xcd85,
+  0xd3d5, 0xcd86,
+  0xd3d6, 0xcd87,
+  0xd3d7, 0xcd88,
+  0xd3d8, 0xcd89,
+  0xd3d9, 0xcd8a,
+  0xd3da, 0xcd8b,
+  0xd3db, 0xcd8c,
+  0xd3dc, 0xcd8d,
+  0xd3dd, 0xcd8e,
+  0xd3de, 0xcd8f,
+  0xd3df, 0xcd90,
+  0xd3e0, 0xcd91,
+  0xd3e1, 0xcd93,
+  0xd3e2, 0xcd94,
+  0xd3e3, 0xcd95,
+  0xd3e4, 0xcd96,
+  0xd3e5, 0xcd97,
+  0xd3e6, 0xcd98,
+  0xd3e7, 0xcd99,
+  0xd3e8, 0xcd9a,
+  0xd3e9, 0xcd9b,
+  0xd3ea, 0xcd9c,
+  0xd3eb, 0xcd9d,
+  0xd3ec, 0xcda1,
+  0xd3ed, 0xcda2,
+  0xd3ee, 0xcda3,
+  0xd3ef, 0xcda4,
+  0xd3f0, 0xcda5,
+  0xd3f1, 0xcda6,
+  0xd3f2, 0xcda7,
+  0xd3f3, 0xcda8,
+  0xd3f4, 0xcda9,
+  0xd3f5, 0xcdaa,
+  0xd3f6, 0xcdab,
+  0xd3f7, 0xcdac,
+  0xd3f8, 0xcdad,
+  0xd3f9, 0xcdae,
+  0xd3fa, 0xcdaf,
+  0xd3fb, 0xcdb0,
+  0xd3fc, 0xcdb1,
+  0xd3fd, 0xcdb3,
+  0xd3fe, 0xcdb4,
+  0xd3ff, 0xcdb5,
+  0xd400, 0xcdb6,
+  0xd401, 0xcdb7,
+  0xd402, 0xcdb8,
+  0xd403, 0xcdb9,
+  0xd404, 0xcdba,
+  0xd405, 0xcdbb,
+  0xd406, 0xcdbc,
+  0xd407, 0xcdbd,
+  0xd408, 0xcdc1,
+  0xd409, 0xcdc2,
+  0xd40a, 0xcdc3,
+  0xd40b, 0xcdc4,
+  0xd40c, 0xcdc5,
+  0xd40d, 0xcdc6,
+  0xd40e, 0xcdc7,
+  0xd40f, 0xcdc8,
+  0xd410, 0xcdc9,
+  0xd411, 0xcdca,
+  0xd412, 0xcdcb,
+  0xd413, 0xcdcc,
+  0xd414, 0xcdcd,
+  0xd415, 0xcdce,
+  0xd416, 0xcdcf,
+  0xd417, 0xcdd0,
+  0xd418, 0xcdd1,
+  0xd419, 0xcdd3,
+  0xd41a, 0xcdd4,
+  0xd41b, 0xcdd5,
+  0xd41c, 0xcdd6,
+  0xd41d, 0xcdd7,
+  0xd41e, 0xcdd8,
+  0xd41f, 0xcdd9,
+  0xd420, 0xcdda,
+  0xd421, 0xcddb,
+  0xd422, 0xcddc,
+  0xd423, 0xcddd,
+  0xd424, 0xcde1,
+  0xd425, 0xcde2,
+  0xd426, 0xcde3,
+  0xd427, 0xcde4,
+  0xd428, 0xcde5,
+  0xd429, 0xcde6,
+  0xd42a, 0xcde7,
+  0xd42b, 0xcde8,
+  0xd42c, 0xcde9,
+  0xd42d, 0xcdea,
+  0xd42e, 0xcdeb,
+  0xd42f, 0xcdec,
+  0xd430, 0xcded,
+  0xd431, 0xcdee,
+  0xd432, 0xcdef,
+  0xd433, 0xcdf0,
+  0xd434, 0xcdf1,
+  0xd435, 0xcdf3,
+  0xd436, 0xcdf4,
+  0xd437, 0xcdf5,
+  0xd438, 0xcdf6,
+  0xd439, 0xcdf7,
+  0xd43a, 0xcdf8,
+  0xd43b, 0xcdf9,
+  0xd43c, 0xcdfa,
+  0xd43d, 0xcdfb,
+  0xd43e, 0xcdfc,
+  0xd43f, 0xcdfd,
+  0xd440, 0xce41,
+  0xd441, 0xce42,
+  0xd442, 0xce43,
+  0xd443, 0xce44,
+  0xd444, 0xce45,
+  0xd445, 0xce46,
+  0xd446, 0xce47,
+  0xd447, 0xce48,
+  0xd448, 0xce49,
+  0xd449, 0xce4a,
+  0xd44a, 0xce4b,
+  0xd44b, 0xce4c,
+  0xd44c, 0xce4d,
+  0xd44d, 0xce4e,
+  0xd44e, 0xce4f,
+  0xd44f, 0xce50,
+  0xd450, 0xce51,
+  0xd451, 0xce53,
+  0xd452, 0xce54,
+  0xd453, 0xce55,
+  0xd454, 0xce56,
+  0xd455, 0xce57,
+  0xd456, 0xce58,
+  0xd457, 0xce59,
+  0xd458, 0xce5a,
+  0xd459, 0xce5b,
+  0xd45a, 0xce5c,
+  0xd45b, 0xce5d,
+  0xd45c, 0xce61,
+  0xd45d, 0xce62,
+  0xd45e, 0xce63,
+  0xd45f, 0xce64,
+  0xd460, 0xce65,
+  0xd461, 0xce66,
+  0xd462, 0xce67,
+  0xd463, 0xce68,
+  0xd464, 0xce69,
+  0xd465, 0xce6a,
+  0xd466, 0xce6b,
+  0xd467, 0xce6c,
+  0xd468, 0xce6d,
+  0xd469, 0xce6e,
+  0xd46a, 0xce6f,
+  0xd46b, 0xce70,
+  0xd46c, 0xce71,
+  0xd46d, 0xce73,
+  0xd46e, 0xce74,
+  0xd46f, 0xce75,
+  0xd470, 0xce76,
+  0xd471, 0xce77,
+  0xd472, 0xce78,
+  0xd473, 0xce79,
+  0xd474, 0xce7a,
+  0xd475, 0xce7b,
+  0xd476, 0xce7c,
+  0xd477, 0xce7d,
+  0xd478, 0xce81,
+  0xd479, 0xce82,
+  0xd47a, 0xce83,
+  0xd47b, 0xce84,
+  0xd47c, 0xce85,
+  0xd47d, 0xce86,
+  0xd47e, 0xce87,
+  0xd47f, 0xce88,
+  0xd480, 0xce89,
+  0xd481, 0xce8a,
+  0xd482, 0xce8b,
+  0xd483, 0xce8c,
+  0xd484, 0xce8d,
+  0xd485, 0xce8e,
+  0xd486, 0xce8f,
+  0xd487, 0xce90,
+  0xd488, 0xce91,
+  0xd489, 0xce93,
+  0xd48a, 0xce94,
+  0xd48b, 0xce95,
+  0xd48c, 0xce96,
+  0xd48d, 0xce97,
+  0xd48e, 0xce98,
+  0xd48f, 0xce99,
+  0xd490, 0xce9a,
+  0xd491, 0xce9b,
+  0xd492, 0xce9c,
+  0xd493, 0xce9d,
+  0xd494, 0xcea1,
+  0xd495, 0xcea2,
+  0xd496, 0xcea3,
+  0xd497, 0xcea4,
+  0xd498, 0xcea5,
+  0xd499, 0xcea6,
+  0xd49a, 0xcea7,
+  0xd49b, 0xcea8,
+  0xd49c, 0xcea9,
+  0xd49d, 0xceaa,
+  0xd49e, 0xceab,
+  0xd49f, 0xceac,
+  0xd4a0, 0xcead,
+  0xd4a1, 0xceae,
+  0xd4a2, 0xceaf,
+  0xd4a3, 0xceb0,
+  0xd4a4, 0xceb1,
+  0xd4a5, 0xceb3,
+  0xd4a6, 0xceb4,
+  0xd4a7, 0xceb5,
+  0xd4a8, 0xceb6,
+  0xd4a9, 0xceb7,
+  0xd4aa, 0xceb8,
+  0xd4ab, 0xceb9,
+  0xd4ac, 0xceba,
+  0xd4ad, 0xcebb,
+  0xd4ae, 0xcebc,
+  0xd4af, 0xcebd,
+  0xd4b0, 0xcec1,
+  0xd4b1, 0xcec2,
+  0xd4b2, 0xcec3,
+  0xd4b3, 0xcec4,
+  0xd4b4, 0xcec5,
+  0xd4b5, 0xcec6,
+  0xd4b6, 0xcec7,
+  0xd4b7, 0xcec8,
+  0xd4b8, 0xcec9,
+  0xd4b9, 0xceca,
+  0xd4ba, 0xcecb,
+  0xd4bb, 0xcecc,
+  0xd4bc, 0xcecd,
+  0xd4bd, 0xcece,
+  0xd4be, 0xcecf,
+  0xd4bf, 0xced0,
+  0xd4c0, 0xced1,
+  0xd4c1, 0xced3,
+  0xd4c2, 0xced4,
+  0xd4c3, 0xced5,
+  0xd4c4, 0xced6,
+  0xd4c5, 0xced7,
+  0xd4c6, 0xced8,
+  0xd4c7, 0xced9,
+  0xd4c8, 0xceda,
+  0xd4c9, 0xcedb,
+  0xd4ca, 0xcedc,
+  0xd4cb, 0xcedd,
+  0xd4cc, 0xcee1,
+  0xd4cd, 0xcee2,
+  0xd4ce, 0xcee3,
+  0xd4cf, 0xcee4,
+  0xd4d0, 0xcee5,
+  0xd4d1, 0xcee6,
+  0xd4d2, 0xcee7,
+  0xd4d3, 0xcee8,
+  0xd4d4, 0xcee9,
+  0xd4d5, 0xceea,
+  0xd4d6, 0xceeb,
+  0xd4d7, 0xceec,
+  0xd4d8, 0xceed,
+  0xd4d9, 0xceee,
+  0xd4da, 0xceef,
+  0xd4db, 0xcef0,
+  0xd4dc, 0xcef1,
+  0xd4dd, 0xcef3,
+  0xd4de, 0xcef4,
+  0xd4df, 0xcef5,
+  0xd4e0, 0xcef6,
+  0xd4e1, 0xcef7,
+  0xd4e2, 0xcef8,
+  0xd4e3, 0xcef9,
+  0xd4e4, 0xcefa,
+  0xd4e5, 0xcefb,
+  0xd4e6, 0xcefc,
+  0xd4e7, 0xcefd,
+  0xd4e8, 0xcf41,
+  0xd4e9, 0xcf42,
+  0xd4ea, 0xcf43,
+  0xd4eb, 0xcf44,
+  0xd4ec, 0xcf45,
+  0xd4ed, 0xcf46,
+  0xd4ee, 0xcf47,
+  0xd4ef, 0xcf48,
+  0xd4f0, 0xcf49,
+  0xd4f1, 0xcf4a,
+  0xd4f2, 0xcf4b,
+  0xd4f3, 0xcf4c,
+  0xd4f4, 0xcf4d,
+  0xd4f5, 0xcf4e,
+  0xd4f6, 0xcf4f,
+  0xd4f7, 0xcf50,
+  0xd4f8, 0xcf51,
+  0xd4f9, 0xcf53,
+  0xd4fa, 0xcf54,
+  0xd4fb, 0xcf55,
+  0xd4fc, 0xcf56,
+  0xd4fd, 0xcf57,
+  0xd4fe, 0xcf58,
+  0xd4ff, 0xcf59,
+  0xd500, 0xcf5a,
+  0xd501, 0xcf5b,
+  0xd502, 0xcf5c,
+  0xd503, 0xcf5d,
+  0xd504, 0xcf61,
+  0xd505, 0xcf62,
+  0xd506, 0xcf63,
+  0xd507, 0xcf64,
+  0xd508, 0xcf65,
+  0xd509, 0xcf66,
+  0xd50a, 0xcf67,
+  0xd50b, 0xcf68,
+  0xd50c, 0xcf69,
+  0xd50d, 0xcf6a,
+  0xd50e, 0xcf6b,
+  0xd50f, 0xcf6c,
+  0xd510, 0xcf6d,
+  0xd511, 0xcf6e,
+  0xd512, 0xcf6f,
+  0xd513, 0xcf70,
+  0xd514, 0xcf71,
+  0xd515, 0xcf73,
+  0xd516, 0xcf74,
+  0xd517, 0xcf75,
+  0xd518, 0xcf76,
+  0xd519, 0xcf77,
+  0xd51a, 0xcf78,
+  0xd51b, 0xcf79,
+  0xd51c, 0xcf7a,
+  0xd51d, 0xcf7b,
+  0xd51e, 0xcf7c,
+  0xd51f, 0xcf7d,
+  0xd520, 0xcf81,
+  0xd521, 0xcf82,
+  0xd522, 0xcf83,
+  0xd523, 0xcf84,
+  0xd524, 0xcf85,
+  0xd525, 0xcf86,
+  0xd526, 0xcf87,
+  0xd527, 0xcf88,
+  0xd528, 0xcf89,
+  0xd529, 0xcf8a,
+  0xd52a, 0xcf8b,
+  0xd52b, 0xcf8c,
+  0xd52c, 0xcf8d,
+  0xd52d, 0xcf8e,
+  0xd52e, 0xcf8f,
+  0xd52f, 0xcf90,
+  0xd530, 0xcf91,
+  0xd531, 0xcf93,
+  0xd532, 0xcf94,
+  0xd533, 0xcf95,
+  0xd534, 0xcf96,
+  0xd535, 0xcf97,
+  0xd536, 0xcf98,
+  0xd537, 0xcf99,
+  0xd538, 0xcf9a,
+  0xd539, 0xcf9b,
+  0xd53a, 0xcf9c,
+  0xd53b, 0xcf9d,
+  0xd53c, 0xcfa1,
+  0xd53d, 0xcfa2,
+  0xd53e, 0xcfa3,
+  0xd53f, 0xcfa4,
+  0xd540, 0xcfa5,
+  0xd541, 0xcfa6,
+  0xd542, 0xcfa7,
+  0xd543, 0xcfa8,
+  0xd544, 0xcfa9,
+  0xd545, 0xcfaa,
+  0xd546, 0xcfab,
+  0xd547, 0xcfac,
+  0xd548, 0xcfad,
+  0xd549, 0xcfae,
+  0xd54a, 0xcfaf,
+  0xd54b, 0xcfb0,
+  0xd54c, 0xcfb1,
+  0xd54d, 0xcfb3,
+  0xd54e, 0xcfb4,
+  0xd54f, 0xcfb5,
+  0xd550, 0xcfb6,
+  0xd551, 0xcfb7,
+  0xd552, 0xcfb8,
+  0xd553, 0xcfb9,
+  0xd554, 0xcfba,
+  0xd555, 0xcfbb,
+  0xd556, 0xcfbc,
+  0xd557, 0xcfbd,
+  0xd558, 0xd061,
+  0xd559, 0xd062,
+  0xd55a, 0xd063,
+  0xd55b, 0xd064,
+  0xd55c, 0xd065,
+  0xd55d, 0xd066,
+  0xd55e, 0xd067,
+  0xd55f, 0xd068,
+  0xd560, 0xd069,
+  0xd561, 0xd06a,
+  0xd562, 0xd06b,
+  0xd563, 0xd06c,
+  0xd564, 0xd06d,
+  0xd565, 0xd06e,
+  0xd566, 0xd06f,
+  0xd567, 0xd070,
+  0xd568, 0xd071,
+  0xd569, 0xd073,
+  0xd56a, 0xd074,
+  0xd56b, 0xd075,
+  0xd56c, 0xd076,
+  0xd56d, 0xd077,
+  0xd56e, 0xd078,
+  0xd56f, 0xd079,
+  0xd570, 0xd07a,
+  0xd571, 0xd07b,
+  0xd572, 0xd07c,
+  0xd573, 0xd07d,
+  0xd574, 0xd081,
+  0xd575, 0xd082,
+  0xd576, 0xd083,
+  0xd577, 0xd084,
+  0xd578, 0xd085,
+  0xd579, 0xd086,
+  0xd57a, 0xd087,
+  0xd57b, 0xd088,
+  0xd57c, 0xd089,
+  0xd57d, 0xd08a,
+  0xd57e, 0xd08b,
+  0xd57f, 0xd08c,
+  0xd580, 0xd08d,
+  0xd581, 0xd08e,
+  0xd582, 0xd08f,
+  0xd583, 0xd090,
+  0xd584, 0xd091,
+  0xd585, 0xd093,
+  0xd586, 0xd094,
+  0xd587, 0xd095,
+  0xd588, 0xd096,
+  0xd589, 0xd097,
+  0xd58a, 0xd098,
+  0xd58b, 0xd099,
+  0xd58c, 0xd09a,
+  0xd58d, 0xd09b,
+  0xd58e, 0xd09c,
+  0xd58f, 0xd09d,
+  0xd590, 0xd0a1,
+  0xd591, 0xd0a2,
+  0xd592, 0xd0a3,
+  0xd593, 0xd0a4,
+  0xd594, 0xd0a5,
+  0xd595, 0xd0a6,
+  0xd596, 0xd0a7,
+  0xd597, 0xd0a8,
+  0xd598, 0xd0a9,
+  0xd599, 0xd0aa,
+  0xd59a, 0xd0ab,
+  0xd59b, 0xd0ac,
+  0xd59c, 0xd0ad,
+  0xd59d, 0xd0ae,
+  0xd59e, 0xd0af,
+  0xd59f, 0xd0b0,
+  0xd5a0, 0xd0b1,
+  0xd5a1, 0xd0b3,
+  0xd5a2, 0xd0b4,
+  0xd5a3, 0xd0b5,
+  0xd5a4, 0xd0b6,
+  0xd5a5, 0xd0b7,
+  0xd5a6, 0xd0b8,
+  0xd5a7, 0xd0b9,
+  0xd5a8, 0xd0ba,
+  0xd5a9, 0xd0bb,
+  0xd5aa, 0xd0bc,
+  0xd5ab, 0xd0bd,
+  0xd5ac, 0xd0c1,
+  0xd5ad, 0xd0c2,
+  0xd5ae, 0xd0c3,
+  0xd5af, 0xd0c4,
+  0xd5b0, 0xd0c5,
+  0xd5b1, 0xd0c6,
+  0xd5b2, 0xd0c7,
+  0xd5b3, 0xd0c8,
+  0xd5b4, 0xd0c9,
+  0xd5b5, 0xd0ca,
+  0xd5b6, 0xd0cb,
+  0xd5b7, 0xd0cc,
+  0xd5b8, 0xd0cd,
+  0xd5b9, 0xd0ce,
+  0xd5ba, 0xd0cf,
+  0xd5bb, 0xd0d0,
+  0xd5bc, 0xd0d1,
+  0xd5bd, 0xd0d3,
+  0xd5be, 0xd0d4,
+  0xd5bf, 0xd0d5,
+  0xd5c0, 0xd0d6,
+  0xd5c1, 0xd0d7,
+  0xd5c2, 0xd0d8,
+  0xd5c3, 0xd0d9,
+  0xd5c4, 0xd0da,
+  0xd5c5, 0xd0db,
+  0xd5c6, 0xd0dc,
+  0xd5c7, 0xd0dd,
+  0xd5c8, 0xd0e1,
+  0xd5c9, 0xd0e2,
+  0xd5ca, 0xd0e3,
+  0xd5cb, 0xd0e4,
+  0xd5cc, 0xd0e5,
+  0xd5cd, 0xd0e6,
+  0xd5ce, 0xd0e7,
+  0xd5cf, 0xd0e8,
+  0xd5d0, 0xd0e9,
+  0xd5d1, 0xd0ea,
+  0xd5d2, 0xd0eb,
+  0xd5d3, 0xd0ec,
+  0xd5d4, 0xd0ed,
+  0xd5d5, 0xd0ee,
+  0xd5d6, 0xd0ef,
+  0xd5d7, 0xd0f0,
+  0xd5d8, 0xd0f1,
+  0xd5d9, 0xd0f3,
+  0xd5da, 0xd0f4,
+  0xd5db, 0xd0f5,
+  0xd5dc, 0xd0f6,
+  0xd5dd, 0xd0f7,
+  0xd5de, 0xd0f8,
+  0xd5df, 0xd0f9,
+  0xd5e0, 0xd0fa,
+  0xd5e1, 0xd0fb,
+  0xd5e2, 0xd0fc,
+  0xd5e3, 0xd0fd,
+  0xd5e4, 0xd141,
+  0xd5e5, 0xd142,
+  0xd5e6, 0xd143,
+  0xd5e7, 0xd144,
+  0xd5e8, 0xd145,
+  0xd5e9, 0xd146,
+  0xd5ea, 0xd147,
+  0xd5eb, 0xd148,
+  0xd5ec, 0xd149,
+  0xd5ed, 0xd14a,
+  0xd5ee, 0xd14b,
+  0xd5ef, 0xd14c,
+  0xd5f0, 0xd14d,
+  0xd5f1, 0xd14e,
+  0xd5f2, 0xd14f,
+  0xd5f3, 0xd150,
+  0xd5f4, 0xd151,
+  0xd5f5, 0xd153,
+  0xd5f6, 0xd154,
+  0xd5f7, 0xd155,
+  0xd5f8, 0xd156,
+  0xd5f9, 0xd157,
+  0xd5fa, 0xd158,
+  0xd5fb, 0xd159,
+  0xd5fc, 0xd15a,
+  0xd5fd, 0xd15b,
+  0xd5fe, 0xd15c,
+  0xd5ff, 0xd15d,
+  0xd600, 0xd161,
+  0xd601, 0xd162,
+  0xd602, 0xd163,
+  0xd603, 0xd164,
+  0xd604, 0xd165,
+  0xd605, 0xd166,
+  0xd606, 0xd167,
+  0xd607, 0xd168,
+  0xd608, 0xd169,
+  0xd609, 0xd16a,
+  0xd60a, 0xd16b,
+  0xd60b, 0xd16c,
+  0xd60c, 0xd16d,
+  0xd60d, 0xd16e,
+  0xd60e, 0xd16f,
+  0xd60f, 0xd170,
+  0xd610, 0xd171,
+  0xd611, 0xd173,
+  0xd612, 0xd174,
+  0xd613, 0xd175,
+  0xd614, 0xd176,
+  0xd615, 0xd177,
+  0xd616, 0xd178,
+  0xd617, 0xd179,
+  0xd618, 0xd17a,
+  0xd619, 0xd17b,
+  0xd61a, 0xd17c,
+  0xd61b, 0xd17d,
+  0xd61c, 0xd181,
+  0xd61d, 0xd182,
+  0xd61e, 0xd183,
+  0xd61f, 0xd184,
+  0xd620, 0xd185,
+  0xd621, 0xd186,
+  0xd622, 0xd187,
+  0xd623, 0xd188,
+  0xd624, 0xd189,
+  0xd625, 0xd18a,
+  0xd626, 0xd18b,
+  0xd627, 0xd18c,
+  0xd628, 0xd18d,
+  0xd629, 0xd18e,
+  0xd62a, 0xd18f,
+  0xd62b, 0xd190,
+  0xd62c, 0xd191,
+  0xd62d, 0xd193,
+  0xd62e, 0xd194,
+  0xd62f, 0xd195,
+  0xd630, 0xd196,
+  0xd631, 0xd197,
+  0xd632, 0xd198,
+  0xd633, 0xd199,
+  0xd634, 0xd19a,
+  0xd635, 0xd19b,
+  0xd636, 0xd19c,
+  0xd637, 0xd19d,
+  0xd638, 0xd1a1,
+  0xd639, 0xd1a2,
+  0xd63a, 0xd1a3,
+  0xd63b, 0xd1a4,
+  0xd63c, 0xd1a5,
+  0xd63d, 0xd1a6,
+  0xd63e, 0xd1a7,
+  0xd63f, 0xd1a8,
+  0xd640, 0xd1a9,
+  0xd641, 0xd1aa,
+  0xd642, 0xd1ab,
+  0xd643, 0xd1ac,
+  0xd644, 0xd1ad,
+  0xd645, 0xd1ae,
+  0xd646, 0xd1af,
+  0xd647, 0xd1b0,
+  0xd648, 0xd1b1,
+  0xd649, 0xd1b3,
+  0xd64a, 0xd1b4,
+  0xd64b, 0xd1b5,
+  0xd64c, 0xd1b6,
+  0xd64d, 0xd1b7,
+  0xd64e, 0xd1b8,
+  0xd64f, 0xd1b9,
+  0xd650, 0xd1ba,
+  0xd651, 0xd1bb,
+  0xd652, 0xd1bc,
+  0xd653, 0xd1bd,
+  0xd654, 0xd1c1,
+  0xd655, 0xd1c2,
+  0xd656, 0xd1c3,
+  0xd657, 0xd1c4,
+  0xd658, 0xd1c5,
+  0xd659, 0xd1c6,
+  0xd65a, 0xd1c7,
+  0xd65b, 0xd1c8,
+  0xd65c, 0xd1c9,
+  0xd65d, 0xd1ca,
+  0xd65e, 0xd1cb,
+  0xd65f, 0xd1cc,
+  0xd660, 0xd1cd,
+  0xd661, 0xd1ce,
+  0xd662, 0xd1cf,
+  0xd663, 0xd1d0,
+  0xd664, 0xd1d1,
+  0xd665, 0xd1d3,
+  0xd666, 0xd1d4,
+  0xd667, 0xd1d5,
+  0xd668, 0xd1d6,
+  0xd669, 0xd1d7,
+  0xd66a, 0xd1d8,
+  0xd66b, 0xd1d9,
+  0xd66c, 0xd1da,
+  0xd66d, 0xd1db,
+  0xd66e, 0xd1dc,
+  0xd66f, 0xd1dd,
+  0xd670, 0xd1e1,
+  0xd671, 0xd1e2,
+  0xd672, 0xd1e3,
+  0xd673, 0xd1e4,
+  0xd674, 0xd1e5,
+  0xd675, 0xd1e6,
+  0xd676, 0xd1e7,
+  0xd677, 0xd1e8,
+  0xd678, 0xd1e9,
+  0xd679, 0xd1ea,
+  0xd67a, 0xd1eb,
+  0xd67b, 0xd1ec,
+  0xd67c, 0xd1ed,
+  0xd67d, 0xd1ee,
+  0xd67e, 0xd1ef,
+  0xd67f, 0xd1f0,
+  0xd680, 0xd1f1,
+  0xd681, 0xd1f3,
+  0xd682, 0xd1f4,
+  0xd683, 0xd1f5,
+  0xd684, 0xd1f6,
+  0xd685, 0xd1f7,
+  0xd686, 0xd1f8,
+  0xd687, 0xd1f9,
+  0xd688, 0xd1fa,
+  0xd689, 0xd1fb,
+  0xd68a, 0xd1fc,
+  0xd68b, 0xd1fd,
+  0xd68c, 0xd241,
+  0xd68d, 0xd242,
+  0xd68e, 0xd243,
+  0xd68f, 0xd244,
+  0xd690, 0xd245,
+  0xd691, 0xd246,
+  0xd692, 0xd247,
+  0xd693, 0xd248,
+  0xd694, 0xd249,
+  0xd695, 0xd24a,
+  0xd696, 0xd24b,
+  0xd697, 0xd24c,
+  0xd698, 0xd24d,
+  0xd699, 0xd24e,
+  0xd69a, 0xd24f,
+  0xd69b, 0xd250,
+  0xd69c, 0xd251,
+  0xd69d, 0xd253,
+  0xd69e, 0xd254,
+  0xd69f, 0xd255,
+  0xd6a0, 0xd256,
+  0xd6a1, 0xd257,
+  0xd6a2, 0xd258,
+  0xd6a3, 0xd259,
+  0xd6a4, 0xd25a,
+  0xd6a5, 0xd25b,
+  0xd6a6, 0xd25c,
+  0xd6a7, 0xd25d,
+  0xd6a8, 0xd261,
+  0xd6a9, 0xd262,
+  0xd6aa, 0xd263,
+  0xd6ab, 0xd264,
+  0xd6ac, 0xd265,
+  0xd6ad, 0xd266,
+  0xd6ae, 0xd267,
+  0xd6af, 0xd268,
+  0xd6b0, 0xd269,
+  0xd6b1, 0xd26a,
+  0xd6b2, 0xd26b,
+  0xd6b3, 0xd26c,
+  0xd6b4, 0xd26d,
+  0xd6b5, 0xd26e,
+  0xd6b6, 0xd26f,
+  0xd6b7, 0xd270,
+  0xd6b8, 0xd271,
+  0xd6b9, 0xd273,
+  0xd6ba, 0xd274,
+  0xd6bb, 0xd275,
+  0xd6bc, 0xd276,
+  0xd6bd, 0xd277,
+  0xd6be, 0xd278,
+  0xd6bf, 0xd279,
+  0xd6c0, 0xd27a,
+  0xd6c1, 0xd27b,
+  0xd6c2, 0xd27c,
+  0xd6c3, 0xd27d,
+  0xd6c4, 0xd281,
+  0xd6c5, 0xd282,
+  0xd6c6, 0xd283,
+  0xd6c7, 0xd284,
+  0xd6c8, 0xd285,
+  0xd6c9, 0xd286,
+  0xd6ca, 0xd287,
+  0xd6cb, 0xd288,
+  0xd6cc, 0xd289,
+  0xd6cd, 0xd28a,
+  0xd6ce, 0xd28b,
+  0xd6cf, 0xd28c,
+  0xd6d0, 0xd28d,
+  0xd6d1, 0xd28e,
+  0xd6d2, 0xd28f,
+  0xd6d3, 0xd290,
+  0xd6d4, 0xd291,
+  0xd6d5, 0xd293,
+  0xd6d6, 0xd294,
+  0xd6d7, 0xd295,
+  0xd6d8, 0xd296,
+  0xd6d9, 0xd297,
+  0xd6da, 0xd298,
+  0xd6db, 0xd299,
+  0xd6dc, 0xd29a,
+  0xd6dd, 0xd29b,
+  0xd6de, 0xd29c,
+  0xd6df, 0xd29d,
+  0xd6e0, 0xd2a1,
+  0xd6e1, 0xd2a2,
+  0xd6e2, 0xd2a3,
+  0xd6e3, 0xd2a4,
+  0xd6e4, 0xd2a5,
+  0xd6e5, 0xd2a6,
+  0xd6e6, 0xd2a7,
+  0xd6e7, 0xd2a8,
+  0xd6e8, 0xd2a9,
+  0xd6e9, 0xd2aa,
+  0xd6ea, 0xd2ab,
+  0xd6eb, 0xd2ac,
+  0xd6ec, 0xd2ad,
+  0xd6ed, 0xd2ae,
+  0xd6ee, 0xd2af,
+  0xd6ef, 0xd2b0,
+  0xd6f0, 0xd2b1,
+  0xd6f1, 0xd2b3,
+  0xd6f2, 0xd2b4,
+  0xd6f3, 0xd2b5,
+  0xd6f4, 0xd2b6,
+  0xd6f5, 0xd2b7,
+  0xd6f6, 0xd2b8,
+  0xd6f7, 0xd2b9,
+  0xd6f8, 0xd2ba,
+  0xd6f9, 0xd2bb,
+  0xd6fa, 0xd2bc,
+  0xd6fb, 0xd2bd,
+  0xd6fc, 0xd2c1,
+  0xd6fd, 0xd2c2,
+  0xd6fe, 0xd2c3,
+  0xd6ff, 0xd2c4,
+  0xd700, 0xd2c5,
+  0xd701, 0xd2c6,
+  0xd702, 0xd2c7,
+  0xd703, 0xd2c8,
+  0xd704, 0xd2c9,
+  0xd705, 0xd2ca,
+  0xd706, 0xd2cb,
+  0xd707, 0xd2cc,
+  0xd708, 0xd2cd,
+  0xd709, 0xd2ce,
+  0xd70a, 0xd2cf,
+  0xd70b, 0xd2d0,
+  0xd70c, 0xd2d1,
+  0xd70d, 0xd2d3,
+  0xd70e, 0xd2d4,
+  0xd70f, 0xd2d5,
+  0xd710, 0xd2d6,
+  0xd711, 0xd2d7,
+  0xd712, 0xd2d8,
+  0xd713, 0xd2d9,
+  0xd714, 0xd2da,
+  0xd715, 0xd2db,
+  0xd716, 0xd2dc,
+  0xd717, 0xd2dd,
+  0xd718, 0xd2e1,
+  0xd719, 0xd2e2,
+  0xd71a, 0xd2e3,
+  0xd71b, 0xd2e4,
+  0xd71c, 0xd2e5,
+  0xd71d, 0xd2e6,
+  0xd71e, 0xd2e7,
+  0xd71f, 0xd2e8,
+  0xd720, 0xd2e9,
+  0xd721, 0xd2ea,
+  0xd722, 0xd2eb,
+  0xd723, 0xd2ec,
+  0xd724, 0xd2ed,
+  0xd725, 0xd2ee,
+  0xd726, 0xd2ef,
+  0xd727, 0xd2f0,
+  0xd728, 0xd2f1,
+  0xd729, 0xd2f3,
+  0xd72a, 0xd2f4,
+  0xd72b, 0xd2f5,
+  0xd72c, 0xd2f6,
+  0xd72d, 0xd2f7,
+  0xd72e, 0xd2f8,
+  0xd72f, 0xd2f9,
+  0xd730, 0xd2fa,
+  0xd731, 0xd2fb,
+  0xd732, 0xd2fc,
+  0xd733, 0xd2fd,
+  0xd734, 0xd341,
+  0xd735, 0xd342,
+  0xd736, 0xd343,
+  0xd737, 0xd344,
+  0xd738, 0xd345,
+  0xd739, 0xd346,
+  0xd73a, 0xd347,
+  0xd73b, 0xd348,
+  0xd73c, 0xd349,
+  0xd73d, 0xd34a,
+  0xd73e, 0xd34b,
+  0xd73f, 0xd34c,
+  0xd740, 0xd34d,
+  0xd741, 0xd34e,
+  0xd742, 0xd34f,
+  0xd743, 0xd350,
+  0xd744, 0xd351,
+  0xd745, 0xd353,
+  0xd746, 0xd354,
+  0xd747, 0xd355,
+  0xd748, 0xd356,
+  0xd749, 0xd357,
+  0xd74a, 0xd358,
+  0xd74b, 0xd359,
+  0xd74c, 0xd35a,
+  0xd74d, 0xd35b,
+  0xd74e, 0xd35c,
+  0xd74f, 0xd35d,
+  0xd750, 0xd361,
+  0xd751, 0xd362,
+  0xd752, 0xd363,
+  0xd753, 0xd364,
+  0xd754, 0xd365,
+  0xd755, 0xd366,
+  0xd756, 0xd367,
+  0xd757, 0xd368,
+  0xd758, 0xd369,
+  0xd759, 0xd36a,
+  0xd75a, 0xd36b,
+  0xd75b, 0xd36c,
+  0xd75c, 0xd36d,
+  0xd75d, 0xd36e,
+  0xd75e, 0xd36f,
+  0xd75f, 0xd370,
+  0xd760, 0xd371,
+  0xd761, 0xd373,
+  0xd762, 0xd374,
+  0xd763, 0xd375,
+  0xd764, 0xd376,
+  0xd765, 0xd377,
+  0xd766, 0xd378,
+  0xd767, 0xd379,
+  0xd768, 0xd37a,
+  0xd769, 0xd37b,
+  0xd76a, 0xd37c,
+  0xd76b, 0xd37d,
+  0xd76c, 0xd381,
+  0xd76d, 0xd382,
+  0xd76e, 0xd383,
+  0xd76f, 0xd384,
+  0xd770, 0xd385,
+  0xd771, 0xd386,
+  0xd772, 0xd387,
+  0xd773, 0xd388,
+  0xd774, 0xd389,
+  0xd775, 0xd38a,
+  0xd776, 0xd38b,
+  0xd777, 0xd38c,
+  0xd778, 0xd38d,
+  0xd779, 0xd38e,
+  0xd77a, 0xd38f,
+  0xd77b, 0xd390,
+  0xd77c, 0xd391,
+  0xd77d, 0xd393,
+  0xd77e, 0xd394,
+  0xd77f, 0xd395,
+  0xd780, 0xd396,
+  0xd781, 0xd397,
+  0xd782, 0xd398,
+  0xd783, 0xd399,
+  0xd784, 0xd39a,
+  0xd785, 0xd39b,
+  0xd786, 0xd39c,
+  0xd787, 0xd39d,
+  0xd788, 0xd3a1,
+  0xd789, 0xd3a2,
+  0xd78a, 0xd3a3,
+  0xd78b, 0xd3a4,
+  0xd78c, 0xd3a5,
+  0xd78d, 0xd3a6,
+  0xd78e, 0xd3a7,
+  0xd78f, 0xd3a8,
+  0xd790, 0xd3a9,
+  0xd791, 0xd3aa,
+  0xd792, 0xd3ab,
+  0xd793, 0xd3ac,
+  0xd794, 0xd3ad,
+  0xd795, 0xd3ae,
+  0xd796, 0xd3af,
+  0xd797, 0xd3b0,
+  0xd798, 0xd3b1,
+  0xd799, 0xd3b3,
+  0xd79a, 0xd3b4,
+  0xd79b, 0xd3b5,
+  0xd79c, 0xd3b6,
+  0xd79d, 0xd3b7,
+  0xd79e, 0xd3b8,
+  0xd79f, 0xd3b9,
+  0xd7a0, 0xd3ba,
+  0xd7a1, 0xd3bb,
+  0xd7a2, 0xd3bc,
+  0xd7a3, 0xd3bd,
+  0xf900, 0xe0d0,
+  0xf901, 0xe0d6,
+  0xf902, 0xe0e7,
+  0xf903, 0xe1cf,
+  0xf904, 0xe1e8,
+  0xf905, 0xe23d,
+  0xf906, 0xe2fb,
+  0xf907, 0xe332,
+  0xf908, 0xe348,
+  0xf909, 0xe360,
+  0xf90a, 0xe36d,
+  0xf90b, 0xe3d4,
+  0xf90c, 0xe3d5,
+  0xf90d, 0xe3d8,
+  0xf90e, 0xe3db,
+  0xf90f, 0xe3dc,
+  0xf910, 0xe3dd,
+  0xf911, 0xe3de,
+  0xf912, 0xe3df,
+  0xf913, 0xe3e0,
+  0xf914, 0xe3e2,
+  0xf915, 0xe3e3,
+  0xf916, 0xe3e4,
+  0xf917, 0xe3e5,
+  0xf918, 0xe3e6,
+  0xf919, 0xe3e8,
+  0xf91a, 0xe3e9,
+  0xf91b, 0xe3ea,
+  0xf91c, 0xe3eb,
+  0xf91d, 0xe3ed,
+  0xf91e, 0xe3ef,
+  0xf91f, 0xe3f0,
+  0xf920, 0xe3f2,
+  0xf921, 0xe3f6,
+  0xf922, 0xe3fa,
+  0xf923, 0xe3fc,
+  0xf924, 0xe3fd,
+  0xf925, 0xe3fe,
+  0xf926, 0xe432,
+  0xf927, 0xe433,
+  0xf928, 0xe437,
+  0xf929, 0xe438,
+  0xf92a, 0xe439,
+  0xf92b, 0xe43a,
+  0xf92c, 0xe43b,
+  0xf92d, 0xe43d,
+  0xf92e, 0xe442,
+  0xf92f, 0xe44e,
+  0xf930, 0xe452,
+  0xf931, 0xe453,
+  0xf932, 0xe454,
+  0xf933, 0xe456,
+  0xf934, 0xe457,
+  0xf935, 0xe458,
+  0xf936, 0xe459,
+  0xf937, 0xe45a,
+  0xf938, 0xe45b,
+  0xf939, 0xe45d,
+  0xf93a, 0xe45e,
+  0xf93b, 0xe45f,
+  0xf93c, 0xe460,
+  0xf93d, 0xe461,
+  0xf93e, 0xe462,
+  0xf93f, 0xe463,
+  0xf940, 0xe464,
+  0xf941, 0xe465,
+  0xf942, 0xe466,
+  0xf943, 0xe467,
+  0xf944, 0xe469,
+  0xf945, 0xe46a,
+  0xf946, 0xe46e,
+  0xf947, 0xe46f,
+  0xf948, 0xe471,
+  0xf949, 0xe472,
+  0xf94a, 0xe474,
+  0xf94b, 0xe475,
+  0xf94c, 0xe476,
+  0xf94d, 0xe477,
+  0xf94e, 0xe478,
+  0xf94f, 0xe479,
+  0xf950, 0xe47a,
+  0xf951, 0xe47b,
+  0xf952, 0xe492,
+  0xf953, 0xe493,
+  0xf954, 0xe494,
+  0xf955, 0xe495,
+  0xf956, 0xe496,
+  0xf957, 0xe497,
+  0xf958, 0xe499,
+  0xf959, 0xe49a,
+  0xf95a, 0xe576,
+  0xf95b, 0xe59e,
+  0xf95c, 0xe5a5,
+  0xf95d, 0xe5ab,
+  0xf95e, 0xe5ae,
+  0xf95f, 0xe648,
+  0xf960, 0xe65d,
+  0xf961, 0xe6cb,
+  0xf962, 0xe6e4,
+  0xf963, 0xe8c5,
+  0xf964, 0xe8e4,
+  0xf965, 0xe935,
+  0xf966, 0xe9a5,
+  0xf967, 0xe9d5,
+  0xf968, 0xe9f4,
+  0xf969, 0xea9e,
+  0xf96a, 0xeaa0,
+  0xf96b, 0xeab3,
+  0xf96c, 0xeae1,
+  0xf96d, 0xeae8,
+  0xf96e, 0xeb93,
+  0xf96f, 0xebad,
+  0xf970, 0xebed,
+  0xf971, 0xecf5,
+  0xf972, 0xed31,
+  0xf973, 0xed39,
+  0xf974, 0xedae,
+  0xf975, 0xedb1,
+  0xf976, 0xedb2,
+  0xf977, 0xedb9,
+  0xf978, 0xedbb,
+  0xf979, 0xedbc,
+  0xf97a, 0xedc4,
+  0xf97b, 0xedce,
+  0xf97c, 0xedd0,
+  0xf97d, 0xedd2,
+  0xf97e, 0xedd6,
+  0xf97f, 0xedfa,
+  0xf980, 0xedfb,
+  0xf981, 0xedfc,
+  0xf982, 0xedfe,
+  0xf983, 0xee31,
+  0xf984, 0xee34,
+  0xf985, 0xee37,
+  0xf986, 0xee3d,
+  0xf987, 0xee3f,
+  0xf988, 0xee40,
+  0xf989, 0xee41,
+  0xf98a, 0xee43,
+  0xf98b, 0xee47,
+  0xf98c, 0xee48,
+  0xf98d, 0xee4c,
+  0xf98e, 0xee54,
+  0xf98f, 0xee56,
+  0xf990, 0xee57,
+  0xf991, 0xee5a,
+  0xf992, 0xee62,
+  0xf993, 0xee66,
+  0xf994, 0xee69,
+  0xf995, 0xee6c,
+  0xf996, 0xee6f,
+  0xf997, 0xee71,
+  0xf998, 0xee74,
+  0xf999, 0xee75,
+  0xf99a, 0xee76,
+  0xf99b, 0xee78,
+  0xf99c, 0xee7a,
+  0xf99d, 0xee7b,
+  0xf99e, 0xee7c,
+  0xf99f, 0xee91,
+  0xf9a0, 0xee93,
+  0xf9a1, 0xee94,
+  0xf9a2, 0xee97,
+  0xf9a3, 0xee98,
+  0xf9a4, 0xee99,
+  0xf9a5, 0xee9b,
+  0xf9a6, 0xeea1,
+  0xf9a7, 0xeea6,
+  0xf9a8, 0xeea9,
+  0xf9a9, 0xeeaa,
+  0xf9aa, 0xeeac,
+  0xf9ab, 0xeead,
+  0xf9ac, 0xeeb0,
+  0xf9ad, 0xeebf,
+  0xf9ae, 0xeec1,
+  0xf9af, 0xeec6,
+  0xf9b0, 0xeec7,
+  0xf9b1, 0xeecb,
+  0xf9b2, 0xeecd,
+  0xf9b3, 0xeecf,
+  0xf9b4, 0xeed0,
+  0xf9b5, 0xeed3,
+  0xf9b6, 0xeedf,
+  0xf9b7, 0xeee4,
+  0xf9b8, 0xeee6,
+  0xf9b9, 0xeef7,
+  0xf9ba, 0xef77,
+  0xf9bb, 0xef78,
+  0xf9bc, 0xef92,
+  0xf9bd, 0xef93,
+  0xf9be, 0xef99,
+  0xf9bf, 0xef9b,
+  0xf9c0, 0xef9d,
+  0xf9c1, 0xefa0,
+  0xf9c2, 0xefa7,
+  0xf9c3, 0xefac,
+  0xf9c4, 0xefcc,
+  0xf9c5, 0xeff7,
+  0xf9c6, 0xf051,
+  0xf9c7, 0xf075,
+  0xf9c8, 0xf096,
+  0xf9c9, 0xf099,
+  0xf9ca, 0xf09e,
+  0xf9cb, 0xf0a0,
+  0xf9cc, 0xf0a4,
+  0xf9cd, 0xf0a7,
+  0xf9ce, 0xf0a9,
+  0xf9cf, 0xf0aa,
+  0xf9d0, 0xf0ba,
+  0xf9d1, 0xf0bb,
+  0xf9d2, 0xf0bd,
+  0xf9d3, 0xf0c1,
+  0xf9d4, 0xf0c2,
+  0xf9d5, 0xf0c6,
+  0xf9d6, 0xf0c7,
+  0xf9d7, 0xf0cc,
+  0xf9d8, 0xf0cf,
+  0xf9d9, 0xf0d0,
+  0xf9da, 0xf0d1,
+  0xf9db, 0xf0d2,
+  0xf9dc, 0xf0d8,
+  0xf9dd, 0xf136,
+  0xf9de, 0xf137,
+  0xf9df, 0xf13a,
+  0xf9e0, 0xf13f,
+  0xf9e1, 0xf140,
+  0xf9e2, 0xf141,
+  0xf9e3, 0xf142,
+  0xf9e4, 0xf145,
+  0xf9e5, 0xf148,
+  0xf9e6, 0xf14a,
+  0xf9e7, 0xf150,
+  0xf9e8, 0xf151,
+  0xf9e9, 0xf155,
+  0xf9ea, 0xf156,
+  0xf9eb, 0xf159,
+  0xf9ec, 0xf15a,
+  0xf9ed, 0xf165,
+  0xf9ee, 0xf16d,
+  0xf9ef, 0xf16e,
+  0xf9f0, 0xf171,
+  0xf9f1, 0xf174,
+  0xf9f2, 0xf177,
+  0xf9f3, 0xf178,
+  0xf9f4, 0xf199,
+  0xf9f5, 0xf19a,
+  0xf9f6, 0xf19c,
+  0xf9f7, 0xf1a1,
+  0xf9f8, 0xf1a2,
+  0xf9f9, 0xf1a3,
+  0xf9fa, 0xf1ee,
+  0xf9fb, 0xf26b,
+  0xf9fc, 0xf44d,
+  0xf9fd, 0xf49c,
+  0xf9fe, 0xf4b1,
+  0xf9ff, 0xf537,
+  0xfa00, 0xf57e,
+  0xfa01, 0xf696,
+  0xfa02, 0xf698,
+  0xfa03, 0xf6b8,
+  0xfa04, 0xf6c8,
+  0xfa05, 0xf6d3,
+  0xfa06, 0xf76b,
+  0xfa07, 0xf792,
+  0xfa08, 0xf831,
+  0xfa09, 0xf832,
+  0xfa0a, 0xf876,
+  0xfa0b, 0xf939,
+  0xff01, 0xda31,
+  0xff02, 0xda32,
+  0xff03, 0xda33,
+  0xff04, 0xda34,
+  0xff05, 0xda35,
+  0xff06, 0xda36,
+  0xff07, 0xda37,
+  0xff08, 0xda38,
+  0xff09, 0xda39,
+  0xff0a, 0xda3a,
+  0xff0b, 0xda3b,
+  0xff0c, 0xda3c,
+  0xff0d, 0xda3d,
+  0xff0e, 0xda3e,
+  0xff0f, 0xda3f,
+  0xff10, 0xda40,
+  0xff11, 0xda41,
+  0xff12, 0xda42,
+  0xff13, 0xda43,
+  0xff14, 0xda44,
+  0xff15, 0xda45,
+  0xff16, 0xda46,
+  0xff17, 0xda47,
+  0xff18, 0xda48,
+  0xff19, 0xda49,
+  0xff1a, 0xda4a,
+  0xff1b, 0xda4b,
+  0xff1c, 0xda4c,
+  0xff1d, 0xda4d,
+  0xff1e, 0xda4e,
+  0xff1f, 0xda4f,
+  0xff20, 0xda50,
+  0xff21, 0xda51,
+  0xff22, 0xda52,
+  0xff23, 0xda53,
+  0xff24, 0xda54,
+  0xff25, 0xda55,
+  0xff26, 0xda56,
+  0xff27, 0xda57,
+  0xff28, 0xda58,
+  0xff29, 0xda59,
+  0xff2a, 0xda5a,
+  0xff2b, 0xda5b,
+  0xff2c, 0xda5c,
+  0xff2d, 0xda5d,
+  0xff2e, 0xda5e,
+  0xff2f, 0xda5f,
+  0xff30, 0xda60,
+  0xff31, 0xda61,
+  0xff32, 0xda62,
+  0xff33, 0xda63,
+  0xff34, 0xda64,
+  0xff35, 0xda65,
+  0xff36, 0xda66,
+  0xff37, 0xda67,
+  0xff38, 0xda68,
+  0xff39, 0xda69,
+  0xff3a, 0xda6a,
+  0xff3b, 0xda6b,
+  0xff3c, 0xd93c,
+  0xff3d, 0xda6d,
+  0xff3e, 0xda6e,
+  0xff3f, 0xda6f,
+  0xff40, 0xda70,
+  0xff41, 0xda71,
+  0xff42, 0xda72,
+  0xff43, 0xda73,
+  0xff44, 0xda74,
+  0xff45, 0xda75,
+  0xff46, 0xda76,
+  0xff47, 0xda77,
+  0xff48, 0xda78,
+  0xff49, 0xda79,
+  0xff4a, 0xda7a,
+  0xff4b, 0xda7b,
+  0xff4c, 0xda7c,
+  0xff4d, 0xda7d,
+  0xff4e, 0xda7e,
+  0xff4f, 0xda91,
+  0xff50, 0xda92,
+  0xff51, 0xda93,
+  0xff52, 0xda94,
+  0xff53, 0xda95,
+  0xff54, 0xda96,
+  0xff55, 0xda97,
+  0xff56, 0xda98,
+  0xff57, 0xda99,
+  0xff58, 0xda9a,
+  0xff59, 0xda9b,
+  0xff5a, 0xda9c,
+  0xff5b, 0xda9d,
+  0xff5c, 0xda9e,
+  0xff5d, 0xda9f,
+  0xff5e, 0xd9a6,
+  0xffe0, 0xd95b,
+  0xffe1, 0xd95c,
+  0xffe2, 0xd9a0,
+  0xffe3, 0xdaa0,
+  0xffe5, 0xd95d,
+  0xffe6, 0xda6c,
+};
 #define MIN_JOHAB	32
 #define MAX_JOHAB	63998
 #define MIN_JOHAB_UC	32
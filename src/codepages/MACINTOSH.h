@@ -328,6 +328,138 @@ static const uint8_t cptbl_alnum_macintosh[] = {
   0xF5,	// LATIN SMALL LETTER DOTLESS I
   0xF6,	// MODIFIER LETTER CIRCUMFLEX ACCENT
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_macintosh[] = {
+  127,		// number of pairs
+  0x00a0, 0xca,
+  0x00a1, 0xc1,
+  0x00a2, 0xa2,
+  0x00a3, 0xa3,
+  0x00a4, 0xdb,
+  0x00a5, 0xb4,
+  0x00a7, 0xa4,
+  0x00a8, 0xac,
+  0x00a9, 0xa9,
+  0x00aa, 0xbb,
+  0x00ab, 0xc7,
+  0x00ac, 0xc2,
+  0x00ae, 0xa8,
+  0x00af, 0xf8,
+  0x00b0, 0xa1,
+  0x00b1, 0xb1,
+  0x00b4, 0xab,
+  0x00b5, 0xb5,
+  0x00b6, 0xa6,
+  0x00b7, 0xe1,
+  0x00b8, 0xfc,
+  0x00ba, 0xbc,
+  0x00bb, 0xc8,
+  0x00bf, 0xc0,
+  0x00c0, 0xcb,
+  0x00c1, 0xe7,
+  0x00c2, 0xe5,
+  0x00c3, 0xcc,
+  0x00c4, 0x80,
+  0x00c5, 0x81,
+  0x00c6, 0xae,
+  0x00c7, 0x82,
+  0x00c8, 0xe9,
+  0x00c9, 0x83,
+  0x00ca, 0xe6,
+  0x00cb, 0xe8,
+  0x00cc, 0xed,
+  0x00cd, 0xea,
+  0x00ce, 0xeb,
+  0x00cf, 0xec,
+  0x00d1, 0x84,
+  0x00d2, 0xf1,
+  0x00d3, 0xee,
+  0x00d4, 0xef,
+  0x00d5, 0xcd,
+  0x00d6, 0x85,
+  0x00d8, 0xaf,
+  0x00d9, 0xf4,
+  0x00da, 0xf2,
+  0x00db, 0xf3,
+  0x00dc, 0x86,
+  0x00df, 0xa7,
+  0x00e0, 0x88,
+  0x00e1, 0x87,
+  0x00e2, 0x89,
+  0x00e3, 0x8b,
+  0x00e4, 0x8a,
+  0x00e5, 0x8c,
+  0x00e6, 0xbe,
+  0x00e7, 0x8d,
+  0x00e8, 0x8f,
+  0x00e9, 0x8e,
+  0x00ea, 0x90,
+  0x00eb, 0x91,
+  0x00ec, 0x93,
+  0x00ed, 0x92,
+  0x00ee, 0x94,
+  0x00ef, 0x95,
+  0x00f1, 0x96,
+  0x00f2, 0x98,
+  0x00f3, 0x97,
+  0x00f4, 0x99,
+  0x00f5, 0x9b,
+  0x00f6, 0x9a,
+  0x00f7, 0xd6,
+  0x00f8, 0xbf,
+  0x00f9, 0x9d,
+  0x00fa, 0x9c,
+  0x00fb, 0x9e,
+  0x00fc, 0x9f,
+  0x00ff, 0xd8,
+  0x0131, 0xf5,
+  0x0152, 0xce,
+  0x0153, 0xcf,
+  0x0178, 0xd9,
+  0x0192, 0xc4,
+  0x02c6, 0xf6,
+  0x02c7, 0xff,
+  0x02d8, 0xf9,
+  0x02d9, 0xfa,
+  0x02da, 0xfb,
+  0x02db, 0xfe,
+  0x02dc, 0xf7,
+  0x02dd, 0xfd,
+  0x03c0, 0xb9,
+  0x2013, 0xd0,
+  0x2014, 0xd1,
+  0x2018, 0xd4,
+  0x2019, 0xd5,
+  0x201a, 0xe2,
+  0x201c, 0xd2,
+  0x201d, 0xd3,
+  0x201e, 0xe3,
+  0x2020, 0xa0,
+  0x2021, 0xe0,
+  0x2022, 0xa5,
+  0x2026, 0xc9,
+  0x2030, 0xe4,
+  0x2039, 0xdc,
+  0x203a, 0xdd,
+  0x2044, 0xda,
+  0x2122, 0xaa,
+  0x2126, 0xbd,
+  0x2202, 0xb6,
+  0x2206, 0xc6,
+  0x220f, 0xb8,
+  0x2211, 0xb7,
+  0x221a, 0xc3,
+  0x221e, 0xb0,
+  0x222b, 0xba,
+  0x2248, 0xc5,
+  0x2260, 0xad,
+  0x2264, 0xb2,
+  0x2265, 0xb3,
+  0x25ca, 0xd7,
+  0xfb01, 0xde,
+  0xfb02, 0xdf,
+};
 #define MIN_MACINTOSH	0
 #define MAX_MACINTOSH	255
 #define MIN_MACINTOSH_UC	0
@@ -363,6 +363,138 @@ static const uint8_t cptbl_alnum_windows_1251[] = {
   0xFE,	// CYRILLIC SMALL LETTER YU
   0xFF,	// CYRILLIC SMALL LETTER YA
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_windows_1251[] = {
+  127,		// number of pairs
+  0x00a0, 0xa0,
+  0x00a4, 0xa4,
+  0x00a6, 0xa6,
+  0x00a7, 0xa7,
+  0x00a9, 0xa9,
+  0x00ab, 0xab,
+  0x00ac, 0xac,
+  0x00ad, 0xad,
+  0x00ae, 0xae,
+  0x00b0, 0xb0,
+  0x00b1, 0xb1,
+  0x00b5, 0xb5,
+  0x00b6, 0xb6,
+  0x00b7, 0xb7,
+  0x00bb, 0xbb,
+  0x0401, 0xa8,
+  0x0402, 0x80,
+  0x0403, 0x81,
+  0x0404, 0xaa,
+  0x0405, 0xbd,
+  0x0406, 0xb2,
+  0x0407, 0xaf,
+  0x0408, 0xa3,
+  0x0409, 0x8a,
+  0x040a, 0x8c,
+  0x040b, 0x8e,
+  0x040c, 0x8d,
+  0x040e, 0xa1,
+  0x040f, 0x8f,
+  0x0410, 0xc0,
+  0x0411, 0xc1,
+  0x0412, 0xc2,
+  0x0413, 0xc3,
+  0x0414, 0xc4,
+  0x0415, 0xc5,
+  0x0416, 0xc6,
+  0x0417, 0xc7,
+  0x0418, 0xc8,
+  0x0419, 0xc9,
+  0x041a, 0xca,
+  0x041b, 0xcb,
+  0x041c, 0xcc,
+  0x041d, 0xcd,
+  0x041e, 0xce,
+  0x041f, 0xcf,
+  0x0420, 0xd0,
+  0x0421, 0xd1,
+  0x0422, 0xd2,
+  0x0423, 0xd3,
+  0x0424, 0xd4,
+  0x0425, 0xd5,
+  0x0426, 0xd6,
+  0x0427, 0xd7,
+  0x0428, 0xd8,
+  0x0429, 0xd9,
+  0x042a, 0xda,
+  0x042b, 0xdb,
+  0x042c, 0xdc,
+  0x042d, 0xdd,
+  0x042e, 0xde,
+  0x042f, 0xdf,
+  0x0430, 0xe0,
+  0x0431, 0xe1,
+  0x0432, 0xe2,
+  0x0433, 0xe3,
+  0x0434, 0xe4,
+  0x0435, 0xe5,
+  0x0436, 0xe6,
+  0x0437, 0xe7,
+  0x0438, 0xe8,
+  0x0439, 0xe9,
+  0x043a, 0xea,
+  0x043b, 0xeb,
+  0x043c, 0xec,
+  0x043d, 0xed,
+  0x043e, 0xee,
+  0x043f, 0xef,
+  0x0440, 0xf0,
+  0x0441, 0xf1,
+  0x0442, 0xf2,
+  0x0443, 0xf3,
+  0x0444, 0xf4,
+  0x0445, 0xf5,
+  0x0446, 0xf6,
+  0x0447, 0xf7,
+  0x0448, 0xf8,
+  0x0449, 0xf9,
+  0x044a, 0xfa,
+  0x044b, 0xfb,
+  0x044c, 0xfc,
+  0x044d, 0xfd,
+  0x044e, 0xfe,
+  0x044f, 0xff,
+  0x0451, 0xb8,
+  0x0452, 0x90,
+  0x0453, 0x83,
+  0x0454, 0xba,
+  0x0455, 0xbe,
+  0x0456, 0xb3,
+  0x0457, 0xbf,
+  0x0458, 0xbc,
+  0x0459, 0x9a,
+  0x045a, 0x9c,
+  0x045b, 0x9e,
+  0x045c, 0x9d,
+  0x045e, 0xa2,
+  0x045f, 0x9f,
+  0x0490, 0xa5,
+  0x0491, 0xb4,
+  0x2013, 0x96,
+  0x2014, 0x97,
+  0x2018, 0x91,
+  0x2019, 0x92,
+  0x201a, 0x82,
+  0x201c, 0x93,
+  0x201d, 0x94,
+  0x201e, 0x84,
+  0x2020, 0x86,
+  0x2021, 0x87,
+  0x2022, 0x95,
+  0x2026, 0x85,
+  0x2030, 0x89,
+  0x2039, 0x8b,
+  0x203a, 0x9b,
+  0x20ac, 0x88,
+  0x2116, 0xb9,
+  0x2122, 0x99,
+};
 #define MIN_WINDOWS_1251	0
 #define MAX_WINDOWS_1251	255
 #define MIN_WINDOWS_1251_UC	0
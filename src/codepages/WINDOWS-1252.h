@@ -338,6 +338,134 @@ static const uint8_t cptbl_alnum_windows_1252[] = {
   0xFE,	// LATIN SMALL LETTER THORN
   0xFF,	// LATIN SMALL LETTER Y WITH DIAERESIS
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_windows_1252[] = {
+  123,		// number of pairs
+  0x00a0, 0xa0,
+  0x00a1, 0xa1,
+  0x00a2, 0xa2,
+  0x00a3, 0xa3,
+  0x00a4, 0xa4,
+  0x00a5, 0xa5,
+  0x00a6, 0xa6,
+  0x00a7, 0xa7,
+  0x00a8, 0xa8,
+  0x00a9, 0xa9,
+  0x00aa, 0xaa,
+  0x00ab, 0xab,
+  0x00ac, 0xac,
+  0x00ad, 0xad,
+  0x00ae, 0xae,
+  0x00af, 0xaf,
+  0x00b0, 0xb0,
+  0x00b1, 0xb1,
+  0x00b2, 0xb2,
+  0x00b3, 0xb3,
+  0x00b4, 0xb4,
+  0x00b5, 0xb5,
+  0x00b6, 0xb6,
+  0x00b7, 0xb7,
+  0x00b8, 0xb8,
+  0x00b9, 0xb9,
+  0x00ba, 0xba,
+  0x00bb, 0xbb,
+  0x00bc, 0xbc,
+  0x00bd, 0xbd,
+  0x00be, 0xbe,
+  0x00bf, 0xbf,
+  0x00c0, 0xc0,
+  0x00c1, 0xc1,
+  0x00c2, 0xc2,
+  0x00c3, 0xc3,
+  0x00c4, 0xc4,
+  0x00c5, 0xc5,
+  0x00c6, 0xc6,
+  0x00c7, 0xc7,
+  0x00c8, 0xc8,
+  0x00c9, 0xc9,
+  0x00ca, 0xca,
+  0x00cb, 0xcb,
+  0x00cc, 0xcc,
+  0x00cd, 0xcd,
+  0x00ce, 0xce,
+  0x00cf, 0xcf,
+  0x00d0, 0xd0,
+  0x00d1, 0xd1,
+  0x00d2, 0xd2,
+  0x00d3, 0xd3,
+  0x00d4, 0xd4,
+  0x00d5, 0xd5,
+  0x00d6, 0xd6,
+  0x00d7, 0xd7,
+  0x00d8, 0xd8,
+  0x00d9, 0xd9,
+  0x00da, 0xda,
+  0x00db, 0xdb,
+  0x00dc, 0xdc,
+  0x00dd, 0xdd,
+  0x00de, 0xde,
+  0x00df, 0xdf,
+  0x00e0, 0xe0,
+  0x00e1, 0xe1,
+  0x00e2, 0xe2,
+  0x00e3, 0xe3,
+  0x00e4, 0xe4,
+  0x00e5, 0xe5,
+  0x00e6, 0xe6,
+  0x00e7, 0xe7,
+  0x00e8, 0xe8,
+  0x00e9, 0xe9,
+  0x00ea, 0xea,
+  0x00eb, 0xeb,
+  0x00ec, 0xec,
+  0x00ed, 0xed,
+  0x00ee, 0xee,
+  0x00ef, 0xef,
+  0x00f0, 0xf0,
+  0x00f1, 0xf1,
+  0x00f2, 0xf2,
+  0x00f3, 0xf3,
+  0x00f4, 0xf4,
+  0x00f5, 0xf5,
+  0x00f6, 0xf6,
+  0x00f7, 0xf7,
+  0x00f8, 0xf8,
+  0x00f9, 0xf9,
+  0x00fa, 0xfa,
+  0x00fb, 0xfb,
+  0x00fc, 0xfc,
+  0x00fd, 0xfd,
+  0x00fe, 0xfe,
+  0x00ff, 0xff,
+  0x0152, 0x8c,
+  0x0153, 0x9c,
+  0x0160, 0x8a,
+  0x0161, 0x9a,
+  0x0178, 0x9f,
+  0x017d, 0x8e,
+  0x017e, 0x9e,
+  0x0192, 0x83,
+  0x02c6, 0x88,
+  0x02dc, 0x98,
+  0x2013, 0x96,
+  0x2014, 0x97,
+  0x2018, 0x91,
+  0x2019, 0x92,
+  0x201a, 0x82,
+  0x201c, 0x93,
+  0x201d, 0x94,
+  0x201e, 0x84,
+  0x2020, 0x86,
+  0x2021, 0x87,
+  0x2022, 0x95,
+  0x2026, 0x85,
+  0x2030, 0x89,
+  0x2039, 0x8b,
+  0x203a, 0x9b,
+  0x20ac, 0x80,
+  0x2122, 0x99,
+};
 #define MIN_WINDOWS_1252	0
 #define MAX_WINDOWS_1252	255
 #define MIN_WINDOWS_1252_UC	0
@@ -338,6 +338,122 @@ static const uint8_t cptbl_alnum_windows_1253[] = {
   0xFD,	// GREEK SMALL LETTER UPSILON WITH TONOS
   0xFE,	// GREEK SMALL LETTER OMEGA WITH TONOS
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_windows_1253[] = {
+  111,		// number of pairs
+  0x00a0, 0xa0,
+  0x00a3, 0xa3,
+  0x00a4, 0xa4,
+  0x00a5, 0xa5,
+  0x00a6, 0xa6,
+  0x00a7, 0xa7,
+  0x00a8, 0xa8,
+  0x00a9, 0xa9,
+  0x00ab, 0xab,
+  0x00ac, 0xac,
+  0x00ad, 0xad,
+  0x00ae, 0xae,
+  0x00b0, 0xb0,
+  0x00b1, 0xb1,
+  0x00b2, 0xb2,
+  0x00b3, 0xb3,
+  0x00b5, 0xb5,
+  0x00b6, 0xb6,
+  0x00b7, 0xb7,
+  0x00bb, 0xbb,
+  0x00bd, 0xbd,
+  0x0192, 0x83,
+  0x0384, 0xb4,
+  0x0385, 0xa1,
+  0x0386, 0xa2,
+  0x0388, 0xb8,
+  0x0389, 0xb9,
+  0x038a, 0xba,
+  0x038c, 0xbc,
+  0x038e, 0xbe,
+  0x038f, 0xbf,
+  0x0390, 0xc0,
+  0x0391, 0xc1,
+  0x0392, 0xc2,
+  0x0393, 0xc3,
+  0x0394, 0xc4,
+  0x0395, 0xc5,
+  0x0396, 0xc6,
+  0x0397, 0xc7,
+  0x0398, 0xc8,
+  0x0399, 0xc9,
+  0x039a, 0xca,
+  0x039b, 0xcb,
+  0x039c, 0xcc,
+  0x039d, 0xcd,
+  0x039e, 0xce,
+  0x039f, 0xcf,
+  0x03a0, 0xd0,
+  0x03a1, 0xd1,
+  0x03a3, 0xd3,
+  0x03a4, 0xd4,
+  0x03a5, 0xd5,
+  0x03a6, 0xd6,
+  0x03a7, 0xd7,
+  0x03a8, 0xd8,
+  0x03a9, 0xd9,
+  0x03aa, 0xda,
+  0x03ab, 0xdb,
+  0x03ac, 0xdc,
+  0x03ad, 0xdd,
+  0x03ae, 0xde,
+  0x03af, 0xdf,
+  0x03b0, 0xe0,
+  0x03b1, 0xe1,
+  0x03b2, 0xe2,
+  0x03b3, 0xe3,
+  0x03b4, 0xe4,
+  0x03b5, 0xe5,
+  0x03b6, 0xe6,
+  0x03b7, 0xe7,
+  0x03b8, 0xe8,
+  0x03b9, 0xe9,
+  0x03ba, 0xea,
+  0x03bb, 0xeb,
+  0x03bc, 0xec,
+  0x03bd, 0xed,
+  0x03be, 0xee,
+  0x03bf, 0xef,
+  0x03c0, 0xf0,
+  0x03c1, 0xf1,
+  0x03c2, 0xf2,
+  0x03c3, 0xf3,
+  0x03c4, 0xf4,
+  0x03c5, 0xf5,
+  0x03c6, 0xf6,
+  0x03c7, 0xf7,
+  0x03c8, 0xf8,
+  0x03c9, 0xf9,
+  0x03ca, 0xfa,
+  0x03cb, 0xfb,
+  0x03cc, 0xfc,
+  0x03cd, 0xfd,
+  0x03ce, 0xfe,
+  0x2013, 0x96,
+  0x2014, 0x97,
+  0x2015, 0xaf,
+  0x2018, 0x91,
+  0x2019, 0x92,
+  0x201a, 0x82,
+  0x201c, 0x93,
+  0x201d, 0x94,
+  0x201e, 0x84,
+  0x2020, 0x86,
+  0x2021, 0x87,
+  0x2022, 0x95,
+  0x2026, 0x85,
+  0x2030, 0x89,
+  0x2039, 0x8b,
+  0x203a, 0x9b,
+  0x20ac, 0x80,
+  0x2122, 0x99,
+};
 #define MIN_WINDOWS_1253	0
 #define MAX_WINDOWS_1253	254
 #define MIN_WINDOWS_1253_UC	0
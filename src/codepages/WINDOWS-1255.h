@@ -297,6 +297,116 @@ static const uint8_t cptbl_alnum_windows_1255[] = {
   0xF9,	// HEBREW LETTER SHIN
   0xFA,	// HEBREW LETTER TAV
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_windows_1255[] = {
+  105,		// number of pairs
+  0x00a0, 0xa0,
+  0x00a1, 0xa1,
+  0x00a2, 0xa2,
+  0x00a3, 0xa3,
+  0x00a5, 0xa5,
+  0x00a6, 0xa6,
+  0x00a7, 0xa7,
+  0x00a8, 0xa8,
+  0x00a9, 0xa9,
+  0x00ab, 0xab,
+  0x00ac, 0xac,
+  0x00ad, 0xad,
+  0x00ae, 0xae,
+  0x00af, 0xaf,
+  0x00b0, 0xb0,
+  0x00b1, 0xb1,
+  0x00b2, 0xb2,
+  0x00b3, 0xb3,
+  0x00b4, 0xb4,
+  0x00b5, 0xb5,
+  0x00b6, 0xb6,
+  0x00b7, 0xb7,
+  0x00b8, 0xb8,
+  0x00b9, 0xb9,
+  0x00bb, 0xbb,
+  0x00bc, 0xbc,
+  0x00bd, 0xbd,
+  0x00be, 0xbe,
+  0x00bf, 0xbf,
+  0x00d7, 0xaa,
+  0x00f7, 0xba,
+  0x0192, 0x83,
+  0x02c6, 0x88,
+  0x02dc, 0x98,
+  0x05b0, 0xc0,
+  0x05b1, 0xc1,
+  0x05b2, 0xc2,
+  0x05b3, 0xc3,
+  0x05b4, 0xc4,
+  0x05b5, 0xc5,
+  0x05b6, 0xc6,
+  0x05b7, 0xc7,
+  0x05b8, 0xc8,
+  0x05b9, 0xc9,
+  0x05bb, 0xcb,
+  0x05bc, 0xcc,
+  0x05bd, 0xcd,
+  0x05be, 0xce,
+  0x05bf, 0xcf,
+  0x05c0, 0xd0,
+  0x05c1, 0xd1,
+  0x05c2, 0xd2,
+  0x05c3, 0xd3,
+  0x05d0, 0xe0,
+  0x05d1, 0xe1,
+  0x05d2, 0xe2,
+  0x05d3, 0xe3,
+  0x05d4, 0xe4,
+  0x05d5, 0xe5,
+  0x05d6, 0xe6,
+  0x05d7, 0xe7,
+  0x05d8, 0xe8,
+  0x05d9, 0xe9,
+  0x05da, 0xea,
+  0x05db, 0xeb,
+  0x05dc, 0xec,
+  0x05dd, 0xed,
+  0x05de, 0xee,
+  0x05df, 0xef,
+  0x05e0, 0xf0,
+  0x05e1, 0xf1,
+  0x05e2, 0xf2,
+  0x05e3, 0xf3,
+  0x05e4, 0xf4,
+  0x05e5, 0xf5,
+  0x05e6, 0xf6,
+  0x05e7, 0xf7,
+  0x05e8, 0xf8,
+  0x05e9, 0xf9,
+  0x05ea, 0xfa,
+  0x05f0, 0xd4,
+  0x05f1, 0xd5,
+  0x05f2, 0xd6,
+  0x05f3, 0xd7,
+  0x05f4, 0xd8,
+  0x200e, 0xfd,
+  0x200f, 0xfe,
+  0x2013, 0x96,
+  0x2014, 0x97,
+  0x2018, 0x91,
+  0x2019, 0x92,
+  0x201a, 0x82,
+  0x201c, 0x93,
+  0x201d, 0x94,
+  0x201e, 0x84,
+  0x2020, 0x86,
+  0x2021, 0x87,
+  0x2022, 0x95,
+  0x2026, 0x85,
+  0x2030, 0x89,
+  0x2039, 0x8b,
+  0x203a, 0x9b,
+  0x20aa, 0xa4,
+  0x20ac, 0x80,
+  0x2122, 0x99,
+};
 #define MIN_WINDOWS_1255	0
 #define MAX_WINDOWS_1255	254
 #define MIN_WINDOWS_1255_UC	0
@@ -332,6 +332,139 @@ static const uint8_t cptbl_alnum_windows_1256[] = {
   0xFC,	// LATIN SMALL LETTER U WITH DIAERESIS
   0xFF,	// ARABIC LETTER YEH BARREE
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_windows_1256[] = {
+  128,		// number of pairs
+  0x00a0, 0xa0,
+  0x00a2, 0xa2,
+  0x00a3, 0xa3,
+  0x00a4, 0xa4,
+  0x00a5, 0xa5,
+  0x00a6, 0xa6,
+  0x00a7, 0xa7,
+  0x00a8, 0xa8,
+  0x00a9, 0xa9,
+  0x00ab, 0xab,
+  0x00ac, 0xac,
+  0x00ad, 0xad,
+  0x00ae, 0xae,
+  0x00af, 0xaf,
+  0x00b0, 0xb0,
+  0x00b1, 0xb1,
+  0x00b2, 0xb2,
+  0x00b3, 0xb3,
+  0x00b4, 0xb4,
+  0x00b5, 0xb5,
+  0x00b6, 0xb6,
+  0x00b7, 0xb7,
+  0x00b8, 0xb8,
+  0x00b9, 0xb9,
+  0x00bb, 0xbb,
+  0x00bc, 0xbc,
+  0x00bd, 0xbd,
+  0x00be, 0xbe,
+  0x00d7, 0xd7,
+  0x00e0, 0xe0,
+  0x00e2, 0xe2,
+  0x00e7, 0xe7,
+  0x00e8, 0xe8,
+  0x00e9, 0xe9,
+  0x00ea, 0xea,
+  0x00eb, 0xeb,
+  0x00ee, 0xee,
+  0x00ef, 0xef,
+  0x00f4, 0xf4,
+  0x00f7, 0xf7,
+  0x00f9, 0xf9,
+  0x00fb, 0xfb,
+  0x00fc, 0xfc,
+  0x0152, 0x8c,
+  0x0153, 0x9c,
+  0x0192, 0x83,
+  0x02c6, 0x88,
+  0x060c, 0xa1,
+  0x061b, 0xba,
+  0x061f, 0xbf,
+  0x0621, 0xc1,
+  0x0622, 0xc2,
+  0x0623, 0xc3,
+  0x0624, 0xc4,
+  0x0625, 0xc5,
+  0x0626, 0xc6,
+  0x0627, 0xc7,
+  0x0628, 0xc8,
+  0x0629, 0xc9,
+  0x062a, 0xca,
+  0x062b, 0xcb,
+  0x062c, 0xcc,
+  0x062d, 0xcd,
+  0x062e, 0xce,
+  0x062f, 0xcf,
+  0x0630, 0xd0,
+  0x0631, 0xd1,
+  0x0632, 0xd2,
+  0x0633, 0xd3,
+  0x0634, 0xd4,
+  0x0635, 0xd5,
+  0x0636, 0xd6,
+  0x0637, 0xd8,
+  0x0638, 0xd9,
+  0x0639, 0xda,
+  0x063a, 0xdb,
+  0x0640, 0xdc,
+  0x0641, 0xdd,
+  0x0642, 0xde,
+  0x0643, 0xdf,
+  0x0644, 0xe1,
+  0x0645, 0xe3,
+  0x0646, 0xe4,
+  0x0647, 0xe5,
+  0x0648, 0xe6,
+  0x0649, 0xec,
+  0x064a, 0xed,
+  0x064b, 0xf0,
+  0x064c, 0xf1,
+  0x064d, 0xf2,
+  0x064e, 0xf3,
+  0x064f, 0xf5,
+  0x0650, 0xf6,
+  0x0651, 0xf8,
+  0x0652, 0xfa,
+  0x0679, 0x8a,
+  0x067e, 0x81,
+  0x0686, 0x8d,
+  0x0688, 0x8f,
+  0x0691, 0x9a,
+  0x0698, 0x8e,
+  0x06a9, 0x98,
+  0x06af, 0x90,
+  0x06ba, 0x9f,
+  0x06be, 0xaa,
+  0x06c1, 0xc0,
+  0x06d2, 0xff,
+  0x200c, 0x9d,
+  0x200d, 0x9e,
+  0x200e, 0xfd,
+  0x200f, 0xfe,
+  0x2013, 0x96,
+  0x2014, 0x97,
+  0x2018, 0x91,
+  0x2019, 0x92,
+  0x201a, 0x82,
+  0x201c, 0x93,
+  0x201d, 0x94,
+  0x201e, 0x84,
+  0x2020, 0x86,
+  0x2021, 0x87,
+  0x2022, 0x95,
+  0x2026, 0x85,
+  0x2030, 0x89,
+  0x2039, 0x8b,
+  0x203a, 0x9b,
+  0x20ac, 0x80,
+  0x2122, 0x99,
+};
 #define MIN_WINDOWS_1256	0
 #define MAX_WINDOWS_1256	255
 #define MIN_WINDOWS_1256_UC	0
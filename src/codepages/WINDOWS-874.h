@@ -275,6 +275,108 @@ static const uint8_t cptbl_alnum_windows_874[] = {
   0xF8,	// THAI DIGIT EIGHT
   0xF9,	// THAI DIGIT NINE
 };
+/* sorted by unicode, pairs of unicode and charset code > 0x7f,
+   for the reverse lookup */
+static const uint16_t cptbl_rev_windows_874[] = {
+  97,		// number of pairs
+  0x00a0, 0xa0,
+  0x0e01, 0xa1,
+  0x0e02, 0xa2,
+  0x0e03, 0xa3,
+  0x0e04, 0xa4,
+  0x0e05, 0xa5,
+  0x0e06, 0xa6,
+  0x0e07, 0xa7,
+  0x0e08, 0xa8,
+  0x0e09, 0xa9,
+  0x0e0a, 0xaa,
+  0x0e0b, 0xab,
+  0x0e0c, 0xac,
+  0x0e0d, 0xad,
+  0x0e0e, 0xae,
+  0x0e0f, 0xaf,
+  0x0e10, 0xb0,
+  0x0e11, 0xb1,
+  0x0e12, 0xb2,
+  0x0e13, 0xb3,
+  0x0e14, 0xb4,
+  0x0e15, 0xb5,
+  0x0e16, 0xb6,
+  0x0e17, 0xb7,
+  0x0e18, 0xb8,
+  0x0e19, 0xb9,
+  0x0e1a, 0xba,
+  0x0e1b, 0xbb,
+  0x0e1c, 0xbc,
+  0x0e1d, 0xbd,
+  0x0e1e, 0xbe,
+  0x0e1f, 0xbf,
+  0x0e20, 0xc0,
+  0x0e21, 0xc1,
+  0x0e22, 0xc2,
+  0x0e23, 0xc3,
+  0x0e24, 0xc4,
+  0x0e25, 0xc5,
+  0x0e26, 0xc6,
+  0x0e27, 0xc7,
+  0x0e28, 0xc8,
+  0x0e29, 0xc9,
+  0x0e2a, 0xca,
+  0x0e2b, 0xcb,
+  0x0e2c, 0xcc,
+  0x0e2d, 0xcd,
+  0x0e2e, 0xce,
+  0x0e2f, 0xcf,
+  0x0e30, 0xd0,
+  0x0e31, 0xd1,
+  0x0e32, 0xd2,
+  0x0e33, 0xd3,
+  0x0e34, 0xd4,
+  0x0e35, 0xd5,
+  0x0e36, 0xd6,
+  0x0e37, 0xd7,
+  0x0e38, 0xd8,
+  0x0e39, 0xd9,
+  0x0e3a, 0xda,
+  0x0e3f, 0xdf,
+  0x0e40, 0xe0,
+  0x0e41, 0xe1,
+  0x0e42, 0xe2,
+  0x0e43, 0xe3,
+  0x0e44, 0xe4,
+  0x0e45, 0xe5,
+  0x0e46, 0xe6,
+  0x0e47, 0xe7,
+  0x0e48, 0xe8,
+  0x0e49, 0xe9,
+  0x0e4a, 0xea,
+  0x0e4b, 0xeb,
+  0x0e4c, 0xec,
+  0x0e4d, 0xed,
+  0x0e4e, 0xee,
+  0x0e4f, 0xef,
+  0x0e50, 0xf0,
+  0x0e51, 0xf1,
+  0x0e52, 0xf2,
+  0x0e53, 0xf3,
+  0x0e54, 0xf4,
+  0x0e55, 0xf5,
+  0x0e56, 0xf6,
+  0x0e57, 0xf7,
+  0x0e58, 0xf8,
+  0x0e59, 0xf9,
+  0x0e5a, 0xfa,
+  0x0e5b, 0xfb,
+  0x2013, 0x96,
+  0x2014, 0x97,
+  0x2018, 0x91,
+  0x2019, 0x92,
+  0x201c, 0x93,
+  0x201d, 0x94,
+  0x2022, 0x95,
+  0x2026, 0x85,
+  0x20ac, 0x80,
+};
 #define MIN_WINDOWS_874	0
 #define MAX_WINDOWS_874	251
 #define MIN_WINDOWS_874_UC	0
@@ -25,7 +25,7 @@ print "/* unsorted rhs values */\n";
 print "static const uint16_t cptbl_$in\[\] = {\n";
 
 my ( $los, $his, $lod, $hid, @out, @exclow ) = ( 0xffff, 0, 0xffff, 0 );
-my @alnum;
+my ( @alnum, %rev );
 my $lastsrc = 0;
 
 sub add_line {
@@ -81,6 +81,8 @@ while (<$F>) {
     $hid = $dn if $dn > $hid;
     if ( $sn > 0x7f ) {
         add_line( \@out, $src, $d, $cmt );
+        # the first, lowest charset code wins
+        $rev{$dn} = $sn if $dn and !exists $rev{$dn};
     }
 }
 
@@ -98,6 +100,13 @@ printf( "  %u,\t\t// size of vector\n", scalar @alnum );
 print $_ for @alnum;
 print "};\n";
 
+print "/* sorted by unicode, pairs of unicode and charset code > 0x7f,\n";
+print "   for the reverse lookup */\n";
+print "static const uint16_t cptbl_rev_$in\[\] = {\n";
+printf( "  %u,\t\t// number of pairs\n", scalar keys %rev );
+printf( "  0x%04x, 0x%x,\n", $_, $rev{$_} ) for sort { $a <=> $b } keys %rev;
+print "};\n";
+
 print "#define MIN_", uc $in, "\t$los\n";
 print "#define MAX_", uc $in, "\t$his\n";
 print "#define MIN_", uc $in, "_UC\t$lod\n";
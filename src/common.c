@@ -27,8 +27,15 @@
 #include <time.h>
 #include <math.h>
 #include <ctype.h>
+#include <float.h>
+#include <limits.h>
 #include "common.h"
 #include "logging.h"
+#ifdef HAVE_PTHREAD_H
+#  include <pthread.h>
+/* Not declared by logging.h here */
+extern LOGLEVEL_THREAD_LOCAL unsigned int loglevel;
+#endif
 
 // See also
 // http://devel.gvsig.org/sites/org.gvsig.dwg/2.0-SNAPSHOT/gvsig-base-library-pom/org.gvsig.dwg/xref/org/gvsig/dwg/lib/DwgFile.html
@@ -605,6 +612,265 @@ tm_offset (void)
   return (long)difftime (rawtime, gmt);
 }
 
+#ifdef HAVE_PTHREAD_H
+typedef struct _parallel_for
+{
+  pthread_mutex_t mutex;
+  uint32_t next; // the next chunk to claim
+  uint32_t n;
+  uint32_t chunk;
+  void (*func) (void *arg, const uint32_t i);
+  void *arg;
+  unsigned int loglevel; // of the calling thread
+} Parallel_For;
+
+static void *
+parallel_for_worker (void *arg)
+{
+  Parallel_For *p = (Parallel_For *)arg;
+  loglevel = p->loglevel;
+  for (;;)
+    {
+      uint32_t i, end;
+      pthread_mutex_lock (&p->mutex);
+      i = p->next;
+      end = p->n - i > p->chunk ? i + p->chunk : p->n;
+      p->next = end;
+      pthread_mutex_unlock (&p->mutex);
+      if (i >= end)
+        break;
+      for (; i < end; i++)
+        p->func (p->arg, i);
+    }
+  return NULL;
+}
+#endif
+
+/* Calls func (arg, i) for all i < n, with up to num_threads threads
+   claiming chunks of items. The current thread works also.
+   Without pthreads, or if the threads cannot be created, serially. */
+void
+dwg_parallel_for (const unsigned num_threads, const uint32_t n,
+                  const uint32_t chunk,
+                  void (*func) (void *arg, const uint32_t i), void *arg)
+{
+#ifdef HAVE_PTHREAD_H
+  const uint32_t step = chunk ? chunk : 1;
+  if (num_threads > 1 && n > step)
+    {
+      Parallel_For p;
+      pthread_t *threads;
+      unsigned started = 0;
+      unsigned wanted = (n + step - 1) / step;
+      if (wanted > num_threads)
+        wanted = num_threads;
+      threads = (pthread_t *)calloc (wanted, sizeof (pthread_t));
+      if (threads)
+        {
+          pthread_mutex_init (&p.mutex, NULL);
+          p.next = 0;
+          p.n = n;
+          p.chunk = step;
+          p.func = func;
+          p.arg = arg;
+          p.loglevel = loglevel;
+          for (unsigned t = 0; t < wanted - 1; t++)
+            {
+              if (!pthread_create (&threads[started], NULL,
+                                   parallel_for_worker, &p))
+                started++;
+            }
+          (void)parallel_for_worker (&p);
+          for (unsigned t = 0; t < started; t++)
+            pthread_join (threads[t], NULL);
+          pthread_mutex_destroy (&p.mutex);
+          free (threads);
+          return;
+        }
+    }
+#else
+  (void)num_threads;
+  (void)chunk;
+#endif
+  for (uint32_t i = 0; i < n; i++)
+    func (arg, i);
+}
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+/* Exact powers of ten */
+static const double pow10_dbl[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#endif
+#ifdef __SIZEOF_INT128__
+static const uint64_t pow10_u64[] = { 1ULL,
+                                      10ULL,
+                                      100ULL,
+                                      1000ULL,
+                                      10000ULL,
+                                      100000ULL,
+                                      1000000ULL,
+                                      10000000ULL,
+                                      100000000ULL,
+                                      1000000000ULL,
+                                      10000000000ULL,
+                                      100000000000ULL,
+                                      1000000000000ULL,
+                                      10000000000000ULL,
+                                      100000000000000ULL,
+                                      1000000000000000ULL,
+                                      10000000000000000ULL,
+                                      100000000000000000ULL,
+                                      1000000000000000000ULL,
+                                      10000000000000000000ULL };
+
+/* Rounds q * 2^e2 to the nearest double, ties to even. sticky if there are
+   more nonzero bits below q. */
+static double
+round_u128 (unsigned __int128 q, const int sticky, const int e2)
+{
+  const uint64_t hi = (uint64_t)(q >> 64);
+  const int len = hi ? 128 - __builtin_clzll (hi)
+                     : 64 - __builtin_clzll ((uint64_t)q);
+  int shift = len - 53;
+  unsigned __int128 rem, half;
+  uint64_t mant;
+  if (shift <= 0) // exact
+    return ldexp ((double)(uint64_t)q, e2);
+  mant = (uint64_t)(q >> shift);
+  rem = q & ((((unsigned __int128)1) << shift) - 1);
+  half = ((unsigned __int128)1) << (shift - 1);
+  if (rem > half || (rem == half && (sticky || (mant & 1))))
+    {
+      mant++;
+      if (mant >> 53)
+        {
+          mant >>= 1;
+          shift++;
+        }
+    }
+  return ldexp ((double)mant, shift + e2);
+}
+#endif
+
+/* strtod for plain decimal numbers as in DXF and JSON, independent of the
+   locale: [ws][+-]digits[.digits][(e|E)[+-]digits]. Correctly rounded for
+   up to 19 significant digits and decimal exponents up to 19, or with
+   exact powers of ten. Others are left to strtod. Does not set errno. */
+double
+dwg_strtod (const char *restrict s, char **restrict endptr)
+{
+  const char *p = s;
+  uint64_t m = 0;
+  int digits = 0, any = 0, exp10 = 0, neg = 0;
+  double v;
+
+  while (*p == ' ' || (*p >= '\t' && *p <= '\r'))
+    p++;
+  if (*p == '-' || *p == '+')
+    neg = *p++ == '-';
+  while (*p == '0')
+    {
+      any = 1;
+      p++;
+    }
+  if (*p == 'x' || *p == 'X')
+    return strtod (s, endptr);
+  for (; *p >= '0' && *p <= '9'; p++, digits++)
+    {
+      if (digits >= 19)
+        return strtod (s, endptr);
+      m = m * 10 + (uint64_t)(*p - '0');
+    }
+  if (*p == '.')
+    {
+      p++;
+      if (!m)
+        for (; *p == '0'; p++, exp10--)
+          any = 1;
+      for (; *p >= '0' && *p <= '9'; p++, digits++, exp10--)
+        {
+          if (digits >= 19)
+            return strtod (s, endptr);
+          m = m * 10 + (uint64_t)(*p - '0');
+        }
+    }
+  if (!any && !digits)
+    return strtod (s, endptr);
+  if (*p == 'e' || *p == 'E')
+    {
+      const char *e = p + 1;
+      int eneg = 0, ev = 0;
+      if (*e == '-' || *e == '+')
+        eneg = *e++ == '-';
+      if (*e >= '0' && *e <= '9')
+        {
+          for (; *e >= '0' && *e <= '9'; e++)
+            if (ev < 10000)
+              ev = ev * 10 + (*e - '0');
+          exp10 += eneg ? -ev : ev;
+          p = e;
+        }
+    }
+  if (!m)
+    v = 0.0;
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+  // one correctly rounded operation of two exact values
+  else if (m <= (1ULL << 53) && exp10 >= -22 && exp10 <= 22)
+    v = exp10 < 0 ? (double)m / pow10_dbl[-exp10]
+                  : (double)m * pow10_dbl[exp10];
+#endif
+#ifdef __SIZEOF_INT128__
+  else if (exp10 >= 0 && exp10 <= 19)
+    v = round_u128 ((unsigned __int128)m * pow10_u64[exp10], 0, 0);
+  else if (exp10 < 0 && exp10 >= -19)
+    {
+      // normalize m to 64 bits, so that the quotient has 64 bits or more
+      const int z = __builtin_clzll (m);
+      const unsigned __int128 n = (unsigned __int128)(m << z) << 64;
+      const uint64_t d = pow10_u64[-exp10];
+      v = round_u128 (n / d, n % d != 0, -64 - z);
+    }
+#endif
+  else
+    return strtod (s, endptr);
+  if (endptr)
+    *endptr = (char *)p;
+  return neg ? -v : v;
+}
+
+/* strtol with base 10, for up to 18 digits, else by strtol */
+long
+dwg_strtol (const char *restrict s, char **restrict endptr)
+{
+  const char *p = s;
+  uint64_t n = 0;
+  int digits = 0, neg = 0;
+
+  while (*p == ' ' || (*p >= '\t' && *p <= '\r'))
+    p++;
+  if (*p == '-' || *p == '+')
+    neg = *p++ == '-';
+  for (; *p >= '0' && *p <= '9'; p++)
+    {
+      if (++digits > 18)
+        return strtol (s, endptr, 10);
+      n = n * 10 + (uint64_t)(*p - '0');
+    }
+  if (!digits)
+    {
+      if (endptr)
+        *endptr = (char *)s;
+      return 0;
+    }
+  if (n > (uint64_t)LONG_MAX)
+    return strtol (s, endptr, 10);
+  if (endptr)
+    *endptr = (char *)p;
+  return neg ? -(long)n : (long)n;
+}
+
 // portability compat funcs
 
 EXPORT int
@@ -36,6 +36,17 @@
 #include <time.h>
 #include "dwg.h"
 
+/* The library state, like the spec globals cur_ver and rcount1 in each
+   module, is per thread. So independent drawings can be processed in
+   separate threads. */
+#ifndef THREAD_LOCAL
+#  ifdef HAVE_PTHREAD_H
+#    define THREAD_LOCAL __thread
+#  else
+#    define THREAD_LOCAL
+#  endif
+#endif
+
 // #pragma pack()
 //  use as printf("%" PRIuSIZE ", size)
 #ifndef PRI_SIZE_T_MODIFIER
@@ -288,6 +299,18 @@ EXPORT int my_strcasecmp (const char *a, const char *b);
 #  define GCC14_DIAG_RESTORE
 #endif
 
+/* for GCC12_DIAG_IGNORE (-Wuse-after-free), with the old address of a
+   realloc'ed array only compared and subtracted, never dereferenced.
+ */
+#if _GNUC_VERSION >= 1200
+#  define GCC12_DIAG_IGNORE(x)                                                \
+    _Pragma ("GCC diagnostic push") CC_DIAG_PRAGMA (GCC diagnostic ignored #x)
+#  define GCC12_DIAG_RESTORE _Pragma ("GCC diagnostic pop")
+#else
+#  define GCC12_DIAG_IGNORE(w)
+#  define GCC12_DIAG_RESTORE
+#endif
+
 /* for GCC80_DIAG_IGNORE (-Wstringop-truncation)
    https://gcc.gnu.org/bugzilla/show_bug.cgi?id=88780
  */
@@ -728,4 +751,14 @@ EXPORT bool dwg_is_valid_tag (const char *tag) __nonnull_all;
 bool dwg_has_eed_appid (Dwg_Object_Object *restrict obj,
                         const BITCODE_RLL absref) __nonnull_all;
 
+/* Calls func (arg, i) for all i < n in num_threads threads */
+void dwg_parallel_for (const unsigned num_threads, const uint32_t n,
+                       const uint32_t chunk,
+                       void (*func) (void *arg, const uint32_t i), void *arg);
+
+/* Locale independent strtod and strtol for the decimal numbers of the DXF
+   and JSON importers */
+double dwg_strtod (const char *restrict s, char **restrict endptr);
+long dwg_strtol (const char *restrict s, char **restrict endptr);
+
 #endif // ifndef COMMON_H
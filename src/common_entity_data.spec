@@ -322,8 +322,14 @@
             FIELD_BLL (preview_size, 160);
           }
 #endif
+#ifdef IS_ENCODER
+        // imported without a size: the output grows, not bounded by it
+        if ((int64_t)_ent->preview_size >= 0 &&
+            _ent->preview_size < (obj->size ? obj->size : DWG_MAX_OBJSIZE))
+#else
         if ((int64_t)_ent->preview_size >= 0 &&
             _ent->preview_size < (obj->size ? obj->size : dat->size))
+#endif
           {
             FIELD_BINARY (preview, _ent->preview_size, 310);
           }
@@ -25,8 +25,12 @@
 /* DWG2_SPEC: decode2.c defines this to make dwg_decode_##token non-static */
 #ifdef DWG2_SPEC
 #  define DWG_DECODE_FUNC /* non-static */
+#  define FILTER_SKIP_ENTITY(obj) false
 #else
 #  define DWG_DECODE_FUNC static
+/* decode.c skips the fields of entities not passing the dwg->filter */
+#  define FILTER_SKIP_ENTITY(obj)                                             \
+    (filtering && !decode_filter_entity_p (dwg, obj))
 #endif
 
 #include "config.h"
@@ -44,6 +48,17 @@
 
 // redeclare versions to be from, not target
 #include "importer.h"
+#include "bits.h"
+
+// the inlined fast paths of the hot readers
+#define bit_read_B(dat) bit_read_B_fast (dat)
+#define bit_read_BB(dat) bit_read_BB_fast (dat)
+#define bit_read_RC(dat) bit_read_RC_fast (dat)
+#define bit_read_BS(dat) bit_read_BS_fast (dat)
+#define bit_read_BL(dat) bit_read_BL_fast (dat)
+#define bit_read_BD(dat) bit_read_BD_fast (dat)
+#define bit_read_MC(dat) bit_read_MC_fast (dat)
+#define bit_read_H(dat, handle) bit_read_H_fast (dat, handle)
 
 #ifndef FREE_IF
 #  define FREE_IF(ptr)                                                        \
@@ -1726,7 +1741,8 @@
       LOG_INFO ("Add entity DIMENSION [%d] ", obj->index);                    \
     else                                                                      \
       LOG_INFO ("Add entity " #token " [%d] ", obj->index);                   \
-    obj->parent->num_entities++;                                              \
+    if (!IN_WORKER) /* recounted after the threads */                         \
+      obj->parent->num_entities++;                                            \
     obj->supertype = DWG_SUPERTYPE_ENTITY;                                    \
     if (!(int)obj->fixedtype)                                                 \
       {                                                                       \
@@ -1833,6 +1849,8 @@
       error = decode_entity_preR13 (dat, obj, _ent);                          \
     }                                                                         \
     if (error >= DWG_ERR_CRITICAL || dat->byte > dat->size)                   \
+      return error;                                                           \
+    if (FILTER_SKIP_ENTITY (obj)) /* reset to a placeholder */               \
       return error;
 
 // Does size include the CRC?
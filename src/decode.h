@@ -31,6 +31,15 @@
 
 #define REFS_PER_REALLOC 16384
 
+#ifdef HAVE_PTHREAD_H
+/* Set in the object decoder threads, see dwg_decode_objects_parallel.
+   They must not touch other objects */
+extern THREAD_LOCAL bool dwg_decode_in_worker;
+#  define IN_WORKER dwg_decode_in_worker
+#else
+#  define IN_WORKER false
+#endif
+
 typedef enum ENTITY_SECTION_INDEX_R11
 {
   ENTITIES_SECTION_INDEX = 0,
@@ -81,6 +90,10 @@ int dwg_decode_header_variables (Bit_Chain *dat, Bit_Chain *hdl_dat,
                                  Bit_Chain *str_dat, Dwg_Data *restrict dwg);
 int dwg_decode_add_object (Dwg_Data *restrict dwg, Bit_Chain *dat,
                            Bit_Chain *hdl_dat, size_t address);
+bool dwg_decode_parallel_p (const Dwg_Data *restrict dwg);
+bool dwg_decode_objects_p (const Dwg_Data *restrict dwg);
+int dwg_decode_objects_parallel (Dwg_Data *restrict dwg);
+void dwg_free_lazy_dat (Dwg_Data *restrict dwg);
 int obj_handle_stream (Bit_Chain *restrict dat, Dwg_Object *restrict obj,
                        Bit_Chain *restrict hdl_dat);
 void bfr_read (void *restrict dst, BITCODE_RC *restrict *restrict src,
@@ -110,6 +123,8 @@ int decompress_R2004_section (Bit_Chain *restrict src,
 void decrypt_R2004_header (BITCODE_RC *restrict dest,
                            const BITCODE_RC *restrict src, size_t size);
 void dwg_resolve_objectrefs_silent (Dwg_Data *restrict dwg);
+void dwg_rebase_objectrefs (Dwg_Data *restrict dwg, const uintptr_t old,
+                            const BITCODE_BL num_old);
 uint32_t dwg_section_page_checksum (const uint32_t seed,
                                     Bit_Chain *restrict dat, int32_t size,
                                     bool skip_checksum);
@@ -206,5 +221,11 @@ EXPORT int dat_read_size (Bit_Chain *restrict dat);
 EXPORT int dat_read_file (Bit_Chain *restrict dat, FILE *restrict fp,
                           const char *restrict filename);
 EXPORT int dat_read_stream (Bit_Chain *restrict dat, FILE *restrict fp);
+EXPORT int dat_read_reader (Bit_Chain *restrict dat,
+                            Dwg_Reader_Callback reader, void *restrict ctx);
+// mmap'ed instead of read, see DWG_OPTS_MMAP. Needs dat_unmap_file.
+EXPORT int dat_map_file (Bit_Chain *restrict dat, FILE *restrict fp,
+                         const char *restrict filename);
+EXPORT void dat_unmap_file (Bit_Chain *restrict dat, const size_t size);
 
 #endif
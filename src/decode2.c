@@ -47,11 +47,11 @@
 #include "dynapi.h"
 
 /* the current version per spec block */
-static int cur_ver = 0;
-static BITCODE_BL rcount1 = 0, rcount2 = 0;
+static THREAD_LOCAL int cur_ver = 0;
+static THREAD_LOCAL BITCODE_BL rcount1 = 0, rcount2 = 0;
 
 #ifdef DWG_ABORT
-static unsigned int errors = 0;
+static THREAD_LOCAL unsigned int errors = 0;
 #  ifndef DWG_ABORT_LIMIT
 #    define DWG_ABORT_LIMIT 20
 #  endif
@@ -49,11 +49,11 @@
  */
 
 /* the current version per spec block */
-static int cur_ver = 0;
-static BITCODE_BL rcount1 = 0, rcount2 = 0;
+static THREAD_LOCAL int cur_ver = 0;
+static THREAD_LOCAL BITCODE_BL rcount1 = 0, rcount2 = 0;
 
 #ifdef DWG_ABORT
-static unsigned int errors = 0;
+static THREAD_LOCAL unsigned int errors = 0;
 #  ifndef DWG_ABORT_LIMIT
 #    define DWG_ABORT_LIMIT 200
 #  endif
@@ -317,6 +317,7 @@ decode_preR13_section (Dwg_Section_Type_r11 id, Bit_Chain *restrict dat,
   tbl->objid_r11 = num;
   if (dwg->num_alloced_objects < dwg->num_objects + tbl->number)
     {
+      const uintptr_t old = (uintptr_t)dwg->object;
       dwg->num_alloced_objects = dwg->num_objects + tbl->number;
       if (dwg->num_alloced_objects > dwg->num_objects + MAX_NUM)
         {
@@ -326,7 +327,8 @@ decode_preR13_section (Dwg_Section_Type_r11 id, Bit_Chain *restrict dat,
         }
       dwg->object = (Dwg_Object *)realloc (
           dwg->object, dwg->num_alloced_objects * sizeof (Dwg_Object));
-      dwg->dirty_refs = 1;
+      if (dwg->object)
+        dwg_rebase_objectrefs (dwg, old, dwg->num_objects);
     }
 
 #define SET_CONTROL(token)                                                    \
@@ -829,8 +831,7 @@ decode_preR13 (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
       free (unknown);
     }
 
-  if (dwg->dirty_refs)
-    dwg_resolve_objectrefs_silent (dwg);
+  dwg_resolve_objectrefs_silent (dwg);
   return 0;
 }
 AFL_GCC_POP
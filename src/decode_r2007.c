@@ -37,7 +37,7 @@
 /* The logging level for the read (decode) path.  */
 
 /* the current version per spec block */
-static unsigned int cur_ver = 0;
+static THREAD_LOCAL unsigned int cur_ver = 0;
 
 #define DWG_LOGLEVEL loglevel
 #include "logging.h"
@@ -750,10 +750,117 @@ read_data_page (Bit_Chain *restrict dat, BITCODE_RC *restrict decomp,
   return error;
 }
 
-int
-read_data_section (Bit_Chain *sec_dat, Bit_Chain *dat,
-                   r2007_section *restrict sections_map,
-                   r2007_page *restrict pages_map, Dwg_Section_Type sec_type)
+typedef struct _data_page_job
+{
+  Bit_Chain src; // at the page
+  r2007_section_page *section_page;
+  int64_t page_size;
+  int error;
+} Data_Page_Job;
+
+typedef struct _data_pages
+{
+  Data_Page_Job *jobs;
+  BITCODE_RC *decomp;
+} Data_Pages;
+
+static void
+read_data_page_job (void *arg, const uint32_t i)
+{
+  Data_Pages *p = (Data_Pages *)arg;
+  Data_Page_Job *job = &p->jobs[i];
+  r2007_section_page *section_page = job->section_page;
+  BITCODE_RC *decomp = &p->decomp[section_page->offset];
+  // bound by its own slot, not the section end
+  job->error = read_data_page (&job->src, decomp, job->page_size,
+                               section_page->comp_size,
+                               section_page->uncomp_size,
+                               decomp + section_page->uncomp_size);
+}
+
+/* Reads all pages of the section with num_threads threads, each into its
+   slot of decomp. Returns non-0 if the pages overlap, or any check of the
+   serial loop in read_data_section_threads fails, which then does it all
+   again, with its errors. */
+static int
+read_data_pages_parallel (Bit_Chain *restrict dat,
+                          const r2007_section *restrict section,
+                          r2007_page *restrict pages_map,
+                          BITCODE_RC *restrict decomp,
+                          const uint64_t max_decomp_size,
+                          const unsigned num_threads)
+{
+  Data_Pages p;
+  uint32_t num_jobs = 0;
+  uint64_t next_offset = 0;
+  size_t last_byte = dat->byte;
+  int error = 0;
+
+  p.jobs = (Data_Page_Job *)calloc ((size_t)section->num_pages,
+                                    sizeof (Data_Page_Job));
+  if (!p.jobs)
+    return DWG_ERR_OUTOFMEM;
+  p.decomp = decomp;
+  for (int64_t i = 0; i < section->num_pages; i++)
+    {
+      r2007_section_page *section_page = section->pages[i];
+      r2007_page *page;
+      if (!section_page
+          || !(page = get_page (pages_map, section_page->id))
+          || section_page->offset < next_offset
+          || section_page->offset > max_decomp_size
+          || section_page->uncomp_size > max_decomp_size - section_page->offset
+          || page->offset >= dat->size)
+        {
+          error = DWG_ERR_VALUEOUTOFBOUNDS;
+          break;
+        }
+      next_offset = section_page->offset + section_page->uncomp_size;
+      last_byte = page->offset;
+      if (section_page->comp_size != section_page->uncomp_size
+          || (int64_t)page->size
+                 == page_size_if_rs_coded (section_page->comp_size))
+        {
+          Data_Page_Job *job = &p.jobs[num_jobs++];
+          job->src = *dat;
+          job->src.byte = page->offset;
+          job->src.bit = 0;
+          job->section_page = section_page;
+          job->page_size = page->size;
+          last_byte = page->offset + page->size;
+        }
+      else
+        {
+          if (section_page->uncomp_size > dat->size - page->offset)
+            {
+              error = DWG_ERR_VALUEOUTOFBOUNDS;
+              break;
+            }
+          memcpy (&decomp[section_page->offset], &dat->chain[page->offset],
+                  section_page->uncomp_size);
+        }
+    }
+  if (!error)
+    {
+      dwg_parallel_for (num_threads, num_jobs, 1, read_data_page_job, &p);
+      for (uint32_t i = 0; i < num_jobs; i++)
+        error |= p.jobs[i].error;
+      if (!error) // as after the serial loop
+        dat->byte = last_byte;
+    }
+  if (error)
+    memset (decomp, 0, max_decomp_size);
+  free (p.jobs);
+  return error;
+}
+
+/* With num_threads > 1 the pages are read in parallel */
+static int
+read_data_section_threads (Bit_Chain *sec_dat, Bit_Chain *dat,
+                           r2007_section *restrict sections_map,
+                           r2007_page *restrict pages_map,
+                           Dwg_Section_Type sec_type,
+                           const unsigned num_threads)
 {
   r2007_section *section;
   r2007_page *page;
@@ -800,6 +907,14 @@ read_data_section (Bit_Chain *sec_dat, Bit_Chain *dat,
   sec_dat->version = dat->version;
   sec_dat->from_version = dat->from_version;
 
+  if (num_threads > 1 && section->num_pages > 1
+      && DWG_LOGLEVEL < DWG_LOGLEVEL_INFO
+      && !read_data_pages_parallel (dat, section, pages_map, decomp,
+                                    max_decomp_size, num_threads))
+    {
+      sec_dat->chain = decomp;
+      return 0;
+    }
   for (i = 0; i < (int)section->num_pages; i++)
     {
       r2007_section_page *section_page = section->pages[i];
@@ -884,6 +999,15 @@ read_data_section (Bit_Chain *sec_dat, Bit_Chain *dat,
   return 0;
 }
 
+int
+read_data_section (Bit_Chain *sec_dat, Bit_Chain *dat,
+                   r2007_section *restrict sections_map,
+                   r2007_page *restrict pages_map, Dwg_Section_Type sec_type)
+{
+  return read_data_section_threads (sec_dat, dat, sections_map, pages_map,
+                                    sec_type, 1);
+}
+
 #define LOG_POS_DAT(dat)                                                      \
   LOG_INSANE (" @%" PRIuSIZE ".%u", (dat)->byte, (dat)->bit);                 \
   LOG_TRACE ("\n");
@@ -1683,13 +1807,14 @@ read_2007_section_handles (Bit_Chain *dat, Bit_Chain *hdl,
                            r2007_section *restrict sections_map,
                            r2007_page *restrict pages_map)
 {
-  static Bit_Chain obj_dat = { 0 }, hdl_dat = { 0 };
+  static THREAD_LOCAL Bit_Chain obj_dat = { 0 }, hdl_dat = { 0 };
   BITCODE_RS section_size = 0;
   size_t endpos;
   int error;
+  const bool parallel = dwg_decode_parallel_p (dwg);
 
-  error = read_data_section (&obj_dat, dat, sections_map, pages_map,
-                             SECTION_OBJECTS);
+  error = read_data_section_threads (&obj_dat, dat, sections_map, pages_map,
+                                     SECTION_OBJECTS, dwg->num_threads);
   if (error >= DWG_ERR_CRITICAL || !obj_dat.chain)
     {
       LOG_ERROR ("Failed to read objects section");
@@ -1699,8 +1824,8 @@ read_2007_section_handles (Bit_Chain *dat, Bit_Chain *hdl,
     }
 
   LOG_TRACE ("\nHandles\n-------------------\n");
-  error = read_data_section (&hdl_dat, dat, sections_map, pages_map,
-                             SECTION_HANDLES);
+  error = read_data_section_threads (&hdl_dat, dat, sections_map, pages_map,
+                                     SECTION_HANDLES, dwg->num_threads);
   if (error >= DWG_ERR_CRITICAL || !hdl_dat.chain)
     {
       LOG_ERROR ("Failed to read handles section");
@@ -1714,6 +1839,9 @@ read_2007_section_handles (Bit_Chain *dat, Bit_Chain *hdl,
   /* From here on the same code as in decode:read_2004_section_handles */
   endpos = hdl_dat.byte + hdl_dat.size;
   dwg->num_objects = 0;
+  // prefill the objects lazily, and decode them afterwards in threads
+  if (parallel)
+    dwg->opts |= DWG_OPTS_LAZY;
 
   do
     {
@@ -1728,7 +1856,8 @@ read_2007_section_handles (Bit_Chain *dat, Bit_Chain *hdl,
       if (section_size > 2050)
         {
           LOG_ERROR ("Object-map/handles section size greater than 2050!");
-          return DWG_ERR_VALUEOUTOFBOUNDS;
+          error |= DWG_ERR_VALUEOUTOFBOUNDS;
+          break;
         }
 
       last_offset = 0;
@@ -1785,7 +1914,16 @@ read_2007_section_handles (Bit_Chain *dat, Bit_Chain *hdl,
 
   if (hdl_dat.chain)
     free (hdl_dat.chain);
-  if (obj_dat.chain)
+  if (obj_dat.chain && dwg->opts & DWG_OPTS_LAZY)
+    {
+      // keep the objects for dwg_decode_lazy_object
+      dwg->lazy_dat.chain = obj_dat.chain;
+      dwg->lazy_dat.size = obj_dat.size;
+      obj_dat.chain = NULL;
+      if (parallel)
+        error |= dwg_decode_objects_parallel (dwg);
+    }
+  else if (obj_dat.chain)
     free (obj_dat.chain);
   return error;
 }
@@ -1838,7 +1976,7 @@ read_2007_section_summary (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
                            r2007_section *restrict sections_map,
                            r2007_page *restrict pages_map)
 {
-  static Bit_Chain old_dat, sec_dat = { 0 };
+  static THREAD_LOCAL Bit_Chain old_dat, sec_dat = { 0 };
   // Bit_Chain *str_dat;
   Dwg_SummaryInfo *_obj = &dwg->summaryinfo;
   Dwg_Object *obj = NULL;
@@ -2320,7 +2458,7 @@ read_2007_section_preview (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
                            r2007_section *restrict sections_map,
                            r2007_page *restrict pages_map)
 {
-  static Bit_Chain sec_dat = { 0 };
+  static THREAD_LOCAL Bit_Chain sec_dat = { 0 };
   int error;
   BITCODE_RL size;
   BITCODE_RC type;
@@ -2387,6 +2525,7 @@ read_r2007_meta_data (Bit_Chain *dat, Bit_Chain *hdl_dat,
   Dwg_R2007_Header *file_header;
   r2007_page *restrict pages_map = NULL, *restrict page;
   r2007_section *restrict sections_map = NULL;
+  const bool objects = dwg_decode_objects_p (dwg);
   int error;
 #ifdef USE_TRACING
   char *probe;
@@ -2452,23 +2591,36 @@ read_r2007_meta_data (Bit_Chain *dat, Bit_Chain *hdl_dat,
   if (dwg->header.summaryinfo_address)
     error |= read_2007_section_summary (dat, dwg, sections_map, pages_map);
   error |= read_2007_section_classes (dat, dwg, sections_map, pages_map);
-  error |= read_2007_section_handles (dat, hdl_dat, dwg, sections_map,
-                                      pages_map);
+  // not with DWG_OPTS_HEADER
+  if (objects)
+    error |= read_2007_section_handles (dat, hdl_dat, dwg, sections_map,
+                                        pages_map);
   error |= read_2007_section_auxheader (dat, dwg, sections_map, pages_map);
   if (dwg->header.thumbnail_address)
     error |= read_2007_section_preview (dat, dwg, sections_map, pages_map);
   error |= read_2007_section_appinfo (dat, dwg, sections_map, pages_map);
-  error
-      |= read_2007_section_appinfohistory (dat, dwg, sections_map, pages_map);
+  if (objects)
+    error |= read_2007_section_appinfohistory (dat, dwg, sections_map,
+                                               pages_map);
   error |= read_2007_section_filedeplist (dat, dwg, sections_map, pages_map);
   error |= read_2007_section_security (dat, dwg, sections_map, pages_map);
-  error |= read_2007_section_revhistory (dat, dwg, sections_map, pages_map);
-  error |= read_2007_section_objfreespace (dat, dwg, sections_map, pages_map);
+  if (objects)
+    {
+      error |= read_2007_section_revhistory (dat, dwg, sections_map,
+                                             pages_map);
+      error |= read_2007_section_objfreespace (dat, dwg, sections_map,
+                                               pages_map);
+    }
   error |= read_2007_section_template (dat, dwg, sections_map, pages_map);
-  if (dwg->header.vbaproj_address)
-    error |= read_2007_section_vbaproject (dat, dwg, sections_map, pages_map);
-  // error |= read_2007_section_signature (dat, dwg, sections_map, pages_map);
-  error |= read_2007_section_acds (dat, dwg, sections_map, pages_map);
+  if (objects)
+    {
+      if (dwg->header.vbaproj_address)
+        error |= read_2007_section_vbaproject (dat, dwg, sections_map,
+                                               pages_map);
+      // error |= read_2007_section_signature (dat, dwg, sections_map,
+      // pages_map);
+      error |= read_2007_section_acds (dat, dwg, sections_map, pages_map);
+    }
   // read_2007_blocks (dat, hdl_dat, dwg, sections_map, pages_map);
 
 error:
@@ -19,6 +19,9 @@
  * modified by Reini Urban
  */
 
+#ifndef _DEFAULT_SOURCE
+#  define _DEFAULT_SOURCE 1 /* for MAP_ANONYMOUS */
+#endif
 #include "config.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -36,6 +39,14 @@
 #else
 char *basename (char *);
 #endif
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  ifndef MAP_ANONYMOUS
+#    define MAP_ANONYMOUS MAP_ANON
+#  endif
+#  define USE_MMAP
+#endif
 
 #include "bits.h"
 #include "common.h"
@@ -52,7 +63,7 @@ char *basename (char *);
 #ifdef USE_TRACING
 /* This flag means we have checked the environment variable
    LIBREDWG_TRACE and set `loglevel' appropriately.  */
-static bool env_var_checked_p;
+static THREAD_LOCAL bool env_var_checked_p;
 #endif /* USE_TRACING */
 #define DWG_LOGLEVEL loglevel
 #include "logging.h"
@@ -65,6 +76,9 @@ static bool env_var_checked_p;
 EXPORT int dwg_read_dxf (Bit_Chain *restrict dat, Dwg_Data *restrict dwg);
 EXPORT int dwg_read_dxfb (Bit_Chain *restrict dat, Dwg_Data *restrict dwg);
 #endif
+#if !defined(DISABLE_JSON) && defined(USE_WRITE)
+EXPORT int dwg_read_json (Bit_Chain *restrict dat, Dwg_Data *restrict dwg);
+#endif
 
 /*------------------------------------------------------------------------------
  * Internal functions
@@ -80,6 +94,10 @@ void dwg_downgrade_MLINESTYLE (Dwg_Object_MLINESTYLE *o);
 void dwg_upgrade_MLINESTYLE (Dwg_Data *restrict dwg,
                              Dwg_Object_MLINESTYLE *restrict o);
 
+// used in dynapi.c, free.c
+void dwg_table_index_rename (Dwg_Data *restrict dwg,
+                             const Dwg_Object *restrict obj);
+void dwg_free_table_index (Dwg_Data *restrict dwg);
 void ordered_ref_add (Dwg_Data *dwg, Dwg_Object_Ref *ref);
 const Dwg_Object_Ref *ordered_ref_find (Dwg_Data *dwg, const BITCODE_RC code,
                                         const unsigned long absref);
@@ -156,53 +174,169 @@ dat_read_size (Bit_Chain *restrict dat)
   return 0;
 }
 
+/* Reader callback for dat_read_stream */
+static size_t
+dat_fread (void *restrict ctx, unsigned char *restrict buf, const size_t size)
+{
+  return fread (buf, sizeof (char), size, (FILE *)ctx);
+}
+
+/* Reads until the reader returns 0, appending to dat->chain.
+   The buffer grows geometrically, and is zero-terminated with 2 spare bytes,
+   as dat_read_file. */
 EXPORT int
-dat_read_stream (Bit_Chain *restrict dat, FILE *restrict fp)
+dat_read_reader (Bit_Chain *restrict dat, Dwg_Reader_Callback reader,
+                 void *restrict ctx)
 {
-  size_t size = 0;
+  size_t size, alloced;
+  unsigned char *tmp;
   loglevel = dat->opts & DWG_OPTS_LOGLEVEL;
 
+  if (!dat->chain)
+    dat->size = 0;
+  alloced = dat->size + 4096;
+  tmp = (unsigned char *)realloc (dat->chain, alloced);
+  if (!tmp)
+    goto oom;
+  dat->chain = tmp;
   do
     {
-      if (dat->chain)
-        dat->chain = (unsigned char *)realloc (dat->chain, dat->size + 4096);
-      else
+      if (dat->size + 2 >= alloced)
         {
-          dat->chain = (unsigned char *)calloc (1, 4096);
-          dat->size = 0;
-        }
-      if (!dat->chain)
-        {
-          LOG_ERROR ("Not enough memory.\n");
-          fclose (fp);
-          dat->fh = NULL;
-          return DWG_ERR_OUTOFMEM;
+          alloced *= 2;
+          tmp = (unsigned char *)realloc (dat->chain, alloced);
+          if (!tmp)
+            goto oom;
+          dat->chain = tmp;
         }
-      size = fread (&dat->chain[dat->size], sizeof (char), 4096, fp);
+      size = reader (ctx, &dat->chain[dat->size], alloced - dat->size - 2);
       dat->size += size;
     }
-  while (size == 4096);
+  while (size);
 
   if (dat->size == 0)
     {
-      LOG_ERROR ("Could not read from stream (%" PRIuSIZE " out of %" PRIuSIZE
-                 ")\n",
-                 size, dat->size);
-      fclose (fp);
+      LOG_ERROR ("Could not read from stream\n");
       free (dat->chain);
-      dat->fh = NULL;
       dat->chain = NULL;
       return DWG_ERR_IOERROR;
     }
-
-  // clear the slack and realloc
-  size = dat->size & 0xfff;
-  if (size)
-    memset (&dat->chain[dat->size], 0, 0xfff - size);
-  dat->chain = (unsigned char *)realloc (dat->chain, dat->size + 1);
   // ensure NULL termination, for sscanf, strtol and friends.
-  dat->chain[dat->size] = '\0';
+  memset (&dat->chain[dat->size], 0, alloced - dat->size);
+  return 0;
+
+oom:
+  LOG_ERROR ("Not enough memory.\n");
+  free (dat->chain);
+  dat->chain = NULL;
+  dat->size = 0;
+  return DWG_ERR_OUTOFMEM;
+}
+
+EXPORT int
+dat_read_stream (Bit_Chain *restrict dat, FILE *restrict fp)
+{
+  int error = dat_read_reader (dat, dat_fread, fp);
+  if (error)
+    {
+      fclose (fp);
+      dat->fh = NULL;
+    }
+  return error;
+}
+
+#ifdef USE_MMAP
+/* The mapping is rounded up to whole pages, with at least 2 zero bytes
+   after the file: for the zero-termination, and the DXF trailing newline. */
+static size_t
+dat_map_size (const size_t size)
+{
+  const size_t pagesize = (size_t)sysconf (_SC_PAGESIZE);
+  return (size + 2 + pagesize - 1) & ~(pagesize - 1);
+}
+#endif
+
+/* Maps the file into memory instead of reading it. The mapping is private
+   and writable, so the readers may still patch the chain in place.
+   Returns DWG_ERR_IOERROR if the file cannot be mapped, e.g. with pipes or
+   without mmap support, and the caller shall fall back to dat_read_file.
+   The fp stays open. */
+EXPORT int
+dat_map_file (Bit_Chain *restrict dat, FILE *restrict fp,
+              const char *restrict filename)
+{
+#ifdef USE_MMAP
+  struct_stat_t attrib;
+  void *base, *map;
+  size_t mapsize;
+  int fd = fp ? fileno (fp) : -1;
+
+  if (fd < 0 || fstat (fd, &attrib) || !S_ISREG (attrib.st_mode)
+      || attrib.st_size <= 0)
+    return DWG_ERR_IOERROR;
+  dat->size = (size_t)attrib.st_size;
+  mapsize = dat_map_size (dat->size);
+  /* Reserve the zeroed tail first, and place the file over it. */
+  base = mmap (NULL, mapsize, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED)
+    return DWG_ERR_IOERROR;
+  map = mmap (base, dat->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+              fd, 0);
+  if (map == MAP_FAILED)
+    {
+      loglevel = dat->opts & DWG_OPTS_LOGLEVEL;
+      LOG_TRACE ("Could not mmap %s, fallback to read\n", filename);
+      munmap (base, mapsize);
+      return DWG_ERR_IOERROR;
+    }
+#  ifdef MADV_SEQUENTIAL
+  (void)madvise (map, dat->size, MADV_SEQUENTIAL);
+#  endif
+  dat->chain = (unsigned char *)map;
   return 0;
+#else
+  (void)dat;
+  (void)fp;
+  (void)filename;
+  return DWG_ERR_IOERROR;
+#endif
+}
+
+/* size must be the size of the mapped file, dat->size might have been
+   changed by the readers. */
+EXPORT void
+dat_unmap_file (Bit_Chain *restrict dat, const size_t size)
+{
+#ifdef USE_MMAP
+  if (dat->chain)
+    munmap (dat->chain, dat_map_size (size));
+#else
+  (void)size;
+  free (dat->chain);
+#endif
+  dat->chain = NULL;
+  dat->size = 0;
+}
+
+/* With DWG_OPTS_LAZY the r13-r2000 objects are decoded from the input
+   chain. Hands it over to the dwg, which frees or unmaps it later, mapped
+   being its mapped size or 0. On errors the dwg forgets it. */
+static void
+dat_keep_lazy (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
+               const size_t mapped, const int error)
+{
+  if (!dwg->lazy_borrowed || dwg->lazy_dat.chain != dat->chain)
+    return;
+  if (error >= DWG_ERR_CRITICAL)
+    {
+      dwg_free_lazy_dat (dwg);
+      return;
+    }
+  dwg->lazy_borrowed = 0;
+  dwg->lazy_mapped = mapped;
+  dat->chain = NULL;
+  dat->size = 0;
 }
 
 static void
@@ -246,10 +380,21 @@ dwg_read_file (const char *restrict filename, Dwg_Data *restrict dwg)
   struct_stat_t attrib;
   Bit_Chain bit_chain = { 0 };
   int error;
+  const unsigned int opts
+      = dwg->opts
+        & (DWG_OPTS_LOGLEVEL | DWG_OPTS_MMAP | DWG_OPTS_LAZY | DWG_OPTS_HEADER
+           | DWG_OPTS_TABLES | DWG_OPTS_REF_POOL);
+  const unsigned int num_threads = dwg->num_threads;
+  const unsigned int compress_level = dwg->compress_level;
+  const Dwg_Filter *filter = dwg->filter;
+  size_t mapped = 0;
 
   loglevel = dwg->opts & DWG_OPTS_LOGLEVEL;
   memset (dwg, 0, sizeof (Dwg_Data));
-  dwg->opts = loglevel;
+  dwg->opts = opts;
+  dwg->num_threads = num_threads;
+  dwg->compress_level = compress_level;
+  dwg->filter = filter;
 
   if (strEQc (filename, "-"))
     {
@@ -282,12 +427,17 @@ dwg_read_file (const char *restrict filename, Dwg_Data *restrict dwg)
   /* Load whole file into memory, even if streamed (for now)
    */
   memset (&bit_chain, 0, sizeof (Bit_Chain));
+  bit_chain.opts = opts & DWG_OPTS_LOGLEVEL;
   if (fp == stdin)
     {
       error = dat_read_stream (&bit_chain, fp);
       if (error >= DWG_ERR_CRITICAL)
         return error;
     }
+  else if (opts & DWG_OPTS_MMAP && !dat_map_file (&bit_chain, fp, filename))
+    {
+      mapped = bit_chain.size;
+    }
   else
     {
 #ifdef HAVE_SYS_STAT_H
@@ -302,17 +452,24 @@ dwg_read_file (const char *restrict filename, Dwg_Data *restrict dwg)
   if (bit_chain.size < 6)
     {
       LOG_ERROR ("File %s too small, %zu byte", filename, bit_chain.size);
-      free (bit_chain.chain);
+      if (mapped)
+        dat_unmap_file (&bit_chain, mapped);
+      else
+        free (bit_chain.chain);
       bit_chain.chain = NULL;
       return DWG_ERR_INVALIDDWG;
     }
 
   /* Decode the dwg structure */
   error = dwg_decode (&bit_chain, dwg);
+  dat_keep_lazy (&bit_chain, dwg, mapped, error);
   if (error >= DWG_ERR_CRITICAL)
     {
       LOG_ERROR ("Failed to decode file: %s 0x%x", filename, error);
-      free (bit_chain.chain);
+      if (mapped)
+        dat_unmap_file (&bit_chain, mapped);
+      else
+        free (bit_chain.chain);
       bit_chain.chain = NULL;
       bit_chain.size = 0;
       return error;
@@ -320,7 +477,10 @@ dwg_read_file (const char *restrict filename, Dwg_Data *restrict dwg)
 
   // TODO: does dwg hold any char* pointers to the bit_chain or are they all
   // copied?
-  free (bit_chain.chain);
+  if (mapped)
+    dat_unmap_file (&bit_chain, mapped);
+  else
+    free (bit_chain.chain);
   bit_chain.chain = NULL;
   bit_chain.size = 0;
 
@@ -328,7 +488,137 @@ dwg_read_file (const char *restrict filename, Dwg_Data *restrict dwg)
   return error;
 }
 
+/** dwg_read_data
+ * Decodes a DWG from a caller-owned buffer, which is not copied nor changed.
+ * With DWG_OPTS_LAZY the r13-r2000 objects are decoded from it on demand,
+ * so it must be kept until dwg_decode_lazy_objects or dwg_free.
+ * returns 0 on success.
+ */
+EXPORT int
+dwg_read_data (const unsigned char *restrict data, const size_t size,
+               Dwg_Data *restrict dwg)
+{
+  Bit_Chain dat = { 0 };
+  const unsigned int opts
+      = dwg->opts
+        & (DWG_OPTS_LOGLEVEL | DWG_OPTS_LAZY | DWG_OPTS_HEADER
+           | DWG_OPTS_TABLES | DWG_OPTS_REF_POOL);
+  const unsigned int num_threads = dwg->num_threads;
+  const unsigned int compress_level = dwg->compress_level;
+  const Dwg_Filter *filter = dwg->filter;
+  int error;
+
+  loglevel = dwg->opts & DWG_OPTS_LOGLEVEL;
+  memset (dwg, 0, sizeof (Dwg_Data));
+  dwg->opts = opts;
+  dwg->num_threads = num_threads;
+  dwg->compress_level = compress_level;
+  dwg->filter = filter;
+  if (!data || size < 6)
+    {
+      LOG_ERROR ("DWG data too small, %" PRIuSIZE " byte", size);
+      return DWG_ERR_INVALIDDWG;
+    }
+  dat.chain = (unsigned char *)data;
+  dat.size = size;
+  dat.opts = loglevel;
+
+  error = dwg_decode (&dat, dwg);
+  if (error >= DWG_ERR_CRITICAL)
+    {
+      LOG_ERROR ("Failed to decode DWG data 0x%x", error);
+      if (dwg->lazy_borrowed)
+        dwg_free_lazy_dat (dwg);
+      return error;
+    }
+  dwg_fixup_viewport_ids (dwg);
+  return error;
+}
+
+/** dwg_decode_lazy_objects
+ * Decodes all objects not yet decoded by a DWG_OPTS_LAZY read,
+ * and frees the kept objects stream.
+ * returns 0 on success.
+ */
+EXPORT int
+dwg_decode_lazy_objects (Dwg_Data *restrict dwg)
+{
+  int error = 0;
+  if (!(dwg->opts & DWG_OPTS_LAZY))
+    return 0;
+  for (BITCODE_BL i = 0; i < dwg->num_objects; i++)
+    {
+      if (!dwg->object[i].tio.object)
+        error |= dwg_decode_lazy_object (&dwg->object[i]);
+    }
+  dwg->opts &= ~DWG_OPTS_LAZY;
+  dwg_free_lazy_dat (dwg);
+  dwg_fixup_viewport_ids (dwg);
+  return error;
+}
+
 #if !defined(DISABLE_DXF) && defined(USE_WRITE)
+/* Reads ascii or binary DXF from the whole dat.
+ * The chain needs 2 spare bytes after dat->size, see dat_read_file.
+ */
+static int
+dxf_read_chain (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
+                const char *restrict name)
+{
+  int error;
+  size_t size = dat->size;
+  /*
+0
+SECTION
+2
+ENTITIES
+0
+ENDSEC
+   */
+  if (size < 31)
+    {
+      LOG_ERROR ("File %s too small, %" PRIuSIZE " byte.", name, size);
+      return DWG_ERR_IOERROR;
+    }
+  /* properly end the buffer for strtol()/... readers. The NUL has to go after
+     the newline we just appended, not on top of it: the chain is calloc'd with
+     two spare bytes for exactly this. Overwriting it left the buffer ending in
+     "...\n0\0" for a DXF without a trailing newline, and dxf_read_string
+     bails out when it finds no '\n' in what is left -- so the file's last
+     group pair was lost and the whole import failed. */
+  if (dat->chain[size - 1] != '\n')
+    {
+      dat->chain[size++] = '\n';
+      dat->size++;
+    }
+  dat->chain[size] = '\0';
+
+  /* Fail on DWG */
+  if (!memcmp (dat->chain, "AC10", 4) || !memcmp (dat->chain, "AC1.", 4)
+      || !memcmp (dat->chain, "AC2.10", 4) || !memcmp (dat->chain, "MC0.0", 4))
+    {
+      LOG_ERROR ("This is a DWG, not a DXF file: %s", name);
+      return DWG_ERR_INVALIDDWG;
+    }
+  /* See if binary or ascii */
+  if (!memcmp (dat->chain, "AutoCAD Binary DXF",
+               sizeof ("AutoCAD Binary DXF") - 1))
+    {
+      dat->byte = 22;
+      error = dwg_read_dxfb (dat, dwg);
+    }
+  else
+    error = dwg_read_dxf (dat, dwg);
+
+  dwg->opts |= (DWG_OPTS_INDXF | loglevel);
+  if (error >= DWG_ERR_CRITICAL)
+    {
+      LOG_ERROR ("Failed to decode DXF file: %s", name);
+      return error;
+    }
+  return 0;
+}
+
 /** dxf_read_file
  * returns 0 on success.
  *
@@ -345,6 +635,8 @@ dxf_read_file (const char *restrict filename, Dwg_Data *restrict dwg)
   size_t size;
   Bit_Chain dat = { 0 };
   Dwg_Version_Type version;
+  const unsigned int mmap_opt = dwg->opts & DWG_OPTS_MMAP;
+  size_t mapped = 0;
 
   loglevel = dwg->opts & DWG_OPTS_LOGLEVEL;
 
@@ -373,105 +665,203 @@ dxf_read_file (const char *restrict filename, Dwg_Data *restrict dwg)
    */
   version = dwg->header.version;
   memset (dwg, 0, sizeof (Dwg_Data));
-  dwg->opts = loglevel | DWG_OPTS_INDXF;
+  dwg->opts = loglevel | mmap_opt | DWG_OPTS_INDXF;
   dwg->header.version = version;
 
   memset (&dat, 0, sizeof (Bit_Chain));
+  dat.byte = 0;
+  dat.bit = 0;
+  dat.from_version = dwg->header.from_version;
+  dat.version = dwg->header.version;
+  dat.opts = dwg->opts;
+
+  /* The mapping has 2 spare zero bytes, as the calloc'd chain below. */
+  if (mmap_opt && !dat_map_file (&dat, fp, filename))
+    {
+      mapped = dat.size;
+      fclose (fp);
+    }
+  else
+    {
 #  ifdef HAVE_SYS_STAT_H
-  dat.size = attrib.st_size;
+      dat.size = attrib.st_size;
 #  endif
-  dat.chain = (unsigned char *)calloc (1, dat.size + 2);
+      dat.chain = (unsigned char *)calloc (1, dat.size + 2);
+      if (!dat.chain)
+        {
+          LOG_ERROR ("Not enough memory");
+          fclose (fp);
+          return DWG_ERR_OUTOFMEM;
+        }
+      size = fread (dat.chain, sizeof (char), dat.size, fp);
+      fclose (fp);
+      if (size != dat.size)
+        {
+          LOG_ERROR ("Could not read the entire file (%" PRIuSIZE
+                     " out of %" PRIuSIZE "): %s",
+                     size, dat.size, filename);
+          free (dat.chain);
+          dat.chain = NULL;
+          dat.size = 0;
+          return DWG_ERR_IOERROR;
+        }
+    }
+
+  error = dxf_read_chain (&dat, dwg, filename);
+
+  // TODO: does dwg hold any char* pointers to the dat or are they all copied?
+  if (mapped)
+    dat_unmap_file (&dat, mapped);
+  else
+    free (dat.chain);
+  dat.chain = NULL;
+  dat.size = 0;
+  return error;
+}
+
+/** dxf_read_data
+ * Reads an ascii or binary DXF from a caller-owned buffer.
+ * The parser patches its input, so it works on a private copy.
+ * returns 0 on success.
+ */
+EXPORT int
+dxf_read_data (const unsigned char *restrict data, const size_t size,
+               Dwg_Data *restrict dwg)
+{
+  int error;
+  Bit_Chain dat = { 0 };
+  Dwg_Version_Type version;
+
+  loglevel = dwg->opts & DWG_OPTS_LOGLEVEL;
+  version = dwg->header.version;
+  memset (dwg, 0, sizeof (Dwg_Data));
+  dwg->opts = loglevel | DWG_OPTS_INDXF;
+  dwg->header.version = version;
+  if (!data)
+    return DWG_ERR_IOERROR;
+
+  dat.chain = (unsigned char *)malloc (size + 2);
   if (!dat.chain)
     {
       LOG_ERROR ("Not enough memory");
-      fclose (fp);
       return DWG_ERR_OUTOFMEM;
     }
-  dat.byte = 0;
-  dat.bit = 0;
+  memcpy (dat.chain, data, size);
+  dat.chain[size] = dat.chain[size + 1] = '\0';
+  dat.size = size;
   dat.from_version = dwg->header.from_version;
   dat.version = dwg->header.version;
   dat.opts = dwg->opts;
 
-  size = fread (dat.chain, sizeof (char), dat.size, fp);
-  fclose (fp);
-  if (size != dat.size)
-    {
-      LOG_ERROR ("Could not read the entire file (%" PRIuSIZE
-                 " out of %" PRIuSIZE "): %s",
-                 size, dat.size, filename);
-      free (dat.chain);
-      dat.chain = NULL;
-      dat.size = 0;
-      return DWG_ERR_IOERROR;
-    }
-  /*
-0
-SECTION
-2
-ENTITIES
-0
-ENDSEC
-   */
-  if (size < 31)
-    {
-      LOG_ERROR ("File %s too small, %" PRIuSIZE " byte.", filename, size);
-      free (dat.chain);
-      dat.chain = NULL;
-      dat.size = 0;
-      return DWG_ERR_IOERROR;
-    }
-  /* properly end the buffer for strtol()/... readers. The NUL has to go after
-     the newline we just appended, not on top of it: the chain is calloc'd with
-     two spare bytes for exactly this. Overwriting it left the buffer ending in
-     "...\n0\0" for a DXF without a trailing newline, and dxf_read_string
-     bails out when it finds no '\n' in what is left -- so the file's last
-     group pair was lost and the whole import failed. */
-  if (dat.chain[size - 1] != '\n')
+  error = dxf_read_chain (&dat, dwg, "(data)");
+  free (dat.chain);
+  return error;
+}
+#endif /* DISABLE_DXF */
+
+#if !defined(DISABLE_JSON) && defined(USE_WRITE)
+/** json_read_data
+ * Reads a JSON dump from a caller-owned buffer.
+ * The parser patches its input, so it works on a private copy.
+ * returns 0 on success.
+ */
+EXPORT int
+json_read_data (const unsigned char *restrict data, const size_t size,
+                Dwg_Data *restrict dwg)
+{
+  int error;
+  Bit_Chain dat = { 0 };
+
+  loglevel = dwg->opts & DWG_OPTS_LOGLEVEL;
+  memset (dwg, 0, sizeof (Dwg_Data));
+  dwg->opts = loglevel;
+  if (!data || !size)
+    return DWG_ERR_IOERROR;
+
+  dat.chain = (unsigned char *)malloc (size + 1);
+  if (!dat.chain)
     {
-      dat.chain[size++] = '\n';
-      dat.size++;
+      LOG_ERROR ("Not enough memory");
+      return DWG_ERR_OUTOFMEM;
     }
+  memcpy (dat.chain, data, size);
   dat.chain[size] = '\0';
+  dat.size = size;
+  dat.version = R_2000; // initial target for the importer
+  dat.opts = dwg->opts;
 
-  /* Fail on DWG */
-  if (!memcmp (dat.chain, "AC10", 4) || !memcmp (dat.chain, "AC1.", 4)
-      || !memcmp (dat.chain, "AC2.10", 4) || !memcmp (dat.chain, "MC0.0", 4))
+  error = dwg_read_json (&dat, dwg);
+  free (dat.chain);
+  return error;
+}
+#endif /* DISABLE_JSON */
+
+/** dwg_read_from_reader
+ * Reads the whole input from the reader callback, detects DWG, DXF,
+ * binary DXF or JSON, and decodes it.
+ * returns 0 on success.
+ */
+EXPORT int
+dwg_read_from_reader (Dwg_Reader_Callback reader, void *restrict ctx,
+                      Dwg_Data *restrict dwg)
+{
+  Bit_Chain dat = { 0 };
+  Dwg_Version_Type version;
+  int error;
+  size_t i;
+
+  loglevel = dwg->opts & DWG_OPTS_LOGLEVEL;
+  version = dwg->header.version;
+  memset (dwg, 0, sizeof (Dwg_Data));
+  dwg->opts = loglevel;
+  dat.opts = loglevel;
+  error = dat_read_reader (&dat, reader, ctx);
+  if (error >= DWG_ERR_CRITICAL)
+    return error;
+
+  if (dat.size >= 6
+      && (!memcmp (dat.chain, "AC", 2) || !memcmp (dat.chain, "MC0.0", 5)))
     {
-      LOG_ERROR ("This is a DWG, not a DXF file: %s", filename);
+      error = dwg_decode (&dat, dwg);
+      dat_keep_lazy (&dat, dwg, 0, error);
+      if (error >= DWG_ERR_CRITICAL)
+        {
+          LOG_ERROR ("Failed to decode DWG data 0x%x", error);
+        }
+      else
+        dwg_fixup_viewport_ids (dwg);
       free (dat.chain);
-      dat.chain = NULL;
-      dat.size = 0;
-      return DWG_ERR_INVALIDDWG;
+      return error;
     }
-  /* See if binary or ascii */
-  if (!memcmp (dat.chain, "AutoCAD Binary DXF",
-               sizeof ("AutoCAD Binary DXF") - 1))
+  for (i = 0; i < dat.size && strchr (" \t\r\n", dat.chain[i]); i++)
+    ;
+  if (i < dat.size && dat.chain[i] == '{')
     {
-      dat.byte = 22;
-      error = dwg_read_dxfb (&dat, dwg);
+#if !defined(DISABLE_JSON) && defined(USE_WRITE)
+      dat.version = R_2000; // initial target for the importer
+      error = dwg_read_json (&dat, dwg);
+#else
+      LOG_ERROR ("JSON import not supported");
+      error = DWG_ERR_INVALIDDWG;
+#endif
     }
   else
-    error = dwg_read_dxf (&dat, dwg);
-
-  dwg->opts |= (DWG_OPTS_INDXF | loglevel);
-  if (error >= DWG_ERR_CRITICAL)
     {
-      LOG_ERROR ("Failed to decode DXF file: %s", filename);
-      free (dat.chain);
-      dat.chain = NULL;
-      dat.size = 0;
-      return error;
+#if !defined(DISABLE_DXF) && defined(USE_WRITE)
+      dwg->opts |= DWG_OPTS_INDXF;
+      dwg->header.version = version;
+      dat.opts = dwg->opts;
+      dat.version = version;
+      error = dxf_read_chain (&dat, dwg, "(reader)");
+#else
+      (void)version;
+      LOG_ERROR ("DXF import not supported");
+      error = DWG_ERR_INVALIDDWG;
+#endif
     }
-
-  // TODO: does dwg hold any char* pointers to the dat or are they all copied?
   free (dat.chain);
-  dat.chain = NULL;
-  dat.size = 0;
-
-  return 0;
+  return error;
 }
-#endif /* DISABLE_DXF */
 
 #ifdef USE_WRITE
 /** Encode the DWG struct into dat (in memory).
@@ -839,7 +1229,6 @@ EXPORT Dwg_Object_LAYER *
 dwg_get_entity_layer (const Dwg_Object_Entity *ent)
 {
   Dwg_Object *obj;
-  // we'd really need the dwg_api or dwg to check dirty_refs
   if (ent && ent->layer && (obj = ent->layer->obj)
       && obj->fixedtype == DWG_TYPE_LAYER)
     return obj->tio.object->tio.LAYER;
@@ -868,13 +1257,15 @@ dwg_ref_object (Dwg_Data *restrict dwg, Dwg_Object_Ref *restrict ref)
 {
   if (!ref)
     return NULL;
-  if (dwg->dirty_refs)
-    dwg_resolve_objectrefs_silent (dwg);
-  if (ref->obj && !dwg->dirty_refs)
+  if (ref->obj)
     {
       if (ref->obj->handle.value
           == ref->absolute_ref) // not a wrong sort_ents import
-        return ref->obj;
+        {
+          if (dwg->opts & DWG_OPTS_LAZY && !ref->obj->tio.object)
+            (void)dwg_decode_lazy_object (ref->obj);
+          return ref->obj;
+        }
       else
         {
           LOG_WARN ("Wrong ref_object: " FORMAT_HV " != " FORMAT_RLLx,
@@ -893,7 +1284,7 @@ dwg_ref_object (Dwg_Data *restrict dwg, Dwg_Object_Ref *restrict ref)
       || ref->absolute_ref)
     {
       Dwg_Object *obj = dwg_resolve_handle (dwg, ref->absolute_ref);
-      if (!dwg->dirty_refs && obj)
+      if (obj)
         ref->obj = obj;
       return obj;
     }
@@ -909,12 +1300,12 @@ EXPORT Dwg_Object *
 dwg_ref_object_relative (Dwg_Data *restrict dwg, Dwg_Object_Ref *restrict ref,
                          const Dwg_Object *restrict obj)
 {
-  if (ref->obj && !dwg->dirty_refs)
+  if (ref->obj)
     return ref->obj;
   if (dwg_resolve_handleref (ref, obj))
     {
       Dwg_Object *o = dwg_resolve_handle (dwg, ref->absolute_ref);
-      if (!dwg->dirty_refs && o)
+      if (o)
         ref->obj = o;
       return o;
     }
@@ -924,6 +1315,7 @@ dwg_ref_object_relative (Dwg_Data *restrict dwg, Dwg_Object_Ref *restrict ref,
 
 /**
  * Find a pointer to an object given its absolute id (handle).
+ * With DWG_OPTS_LAZY it decodes the object, which changes the dwg.
  * TODO: Check and update each handleref obj cache.
  * Note that absref 0 is illegal here, I think.
  */
@@ -958,6 +1350,12 @@ dwg_resolve_handle (const Dwg_Data *dwg, const BITCODE_RLL absref)
       return NULL;
     }
   LOG_INSANE ("[resolve " FORMAT_HV " => " FORMAT_BLL "] ", absref, i);
+  if (dwg->opts & DWG_OPTS_LAZY && !dwg->object[i].tio.object)
+    {
+      // the only change of the const dwg: decode the object on demand
+      Dwg_Data *lazy_dwg = (Dwg_Data *)dwg;
+      (void)dwg_decode_lazy_object (&lazy_dwg->object[i]);
+    }
   return &dwg->object[i]; // allow value 0
 }
 
@@ -983,17 +1381,23 @@ dwg_ref_object_silent (Dwg_Data *restrict dwg, Dwg_Object_Ref *restrict ref)
 {
   if (!ref)
     return NULL;
-  if (dwg->dirty_refs)
-    dwg_resolve_objectrefs_silent (dwg);
-  if (dwg->dirty_refs == 0 && ref->obj != NULL)
-    return ref->obj;
+  if (ref->obj != NULL)
+    {
+      if (dwg->opts & DWG_OPTS_LAZY && !ref->obj->tio.object)
+        (void)dwg_decode_lazy_object (ref->obj);
+      return ref->obj;
+    }
   if ((ref->handleref.code < 6
        && dwg_resolve_handleref ((Dwg_Object_Ref *)ref, NULL))
       || ref->absolute_ref)
     {
       Dwg_Object *obj = dwg_resolve_handle_silent (dwg, ref->absolute_ref);
       if (obj)
-        ref->obj = obj;
+        {
+          ref->obj = obj;
+          if (dwg->opts & DWG_OPTS_LAZY && !obj->tio.object)
+            (void)dwg_decode_lazy_object (obj);
+        }
       return obj;
     }
   else
@@ -1085,19 +1489,17 @@ dwg_model_space_ref (Dwg_Data *dwg)
 {
   Dwg_Object *obj;
   Dwg_Object_BLOCK_CONTROL *block_control;
-  if (dwg->dirty_refs)
-    dwg_resolve_objectrefs_silent (dwg);
-  if (dwg->header_vars.BLOCK_RECORD_MSPACE && !dwg->dirty_refs
+  if (dwg->header_vars.BLOCK_RECORD_MSPACE
       && dwg->header_vars.BLOCK_RECORD_MSPACE->obj)
     return dwg->header_vars.BLOCK_RECORD_MSPACE;
-  if (dwg->block_control.model_space && !dwg->dirty_refs
+  if (dwg->block_control.model_space
       && dwg->block_control.model_space->obj)
     {
       dwg->header_vars.BLOCK_RECORD_MSPACE = dwg->block_control.model_space;
       return dwg->block_control.model_space;
     }
   block_control = dwg_block_control (dwg);
-  if (block_control && block_control->model_space && !dwg->dirty_refs
+  if (block_control && block_control->model_space
       && block_control->model_space->obj)
     {
       dwg->block_control.model_space = block_control->model_space;
@@ -1108,7 +1510,7 @@ dwg_model_space_ref (Dwg_Data *dwg)
   if (!obj)
     return NULL;
   block_control = obj->tio.object->tio.BLOCK_CONTROL;
-  if (block_control && block_control->model_space && !dwg->dirty_refs
+  if (block_control && block_control->model_space
       && block_control->model_space->obj)
     {
       dwg->block_control.model_space = block_control->model_space;
@@ -1123,12 +1525,10 @@ dwg_model_space_ref (Dwg_Data *dwg)
 EXPORT Dwg_Object_Ref *
 dwg_paper_space_ref (Dwg_Data *dwg)
 {
-  if (dwg->dirty_refs)
-    dwg_resolve_objectrefs_silent (dwg);
-  if (dwg->header_vars.BLOCK_RECORD_PSPACE && !dwg->dirty_refs
+  if (dwg->header_vars.BLOCK_RECORD_PSPACE
       && dwg->header_vars.BLOCK_RECORD_PSPACE->obj)
     return dwg->header_vars.BLOCK_RECORD_PSPACE;
-  return dwg->block_control.paper_space && !dwg->dirty_refs
+  return dwg->block_control.paper_space
                  && dwg->block_control.paper_space->obj
              ? dwg->block_control.paper_space
              : NULL;
@@ -1215,21 +1615,26 @@ EXPORT Dwg_Object *
 get_first_owned_entity (const Dwg_Object *hdr)
 {
   const Dwg_Version_Type version = hdr->parent->header.version;
-  Dwg_Object_BLOCK_HEADER *_hdr = hdr->tio.object->tio.BLOCK_HEADER;
+  Dwg_Object_BLOCK_HEADER *_hdr;
+  if (hdr->parent->opts & DWG_OPTS_LAZY && !hdr->tio.object)
+    (void)dwg_decode_lazy_object ((Dwg_Object *)hdr);
   if (hdr->fixedtype != DWG_TYPE_BLOCK_HEADER)
     {
       LOG_ERROR ("Invalid BLOCK_HEADER type %d", hdr->fixedtype);
       return NULL;
     }
+  _hdr = hdr->tio.object->tio.BLOCK_HEADER;
 
   if (R_13b1 <= version && version <= R_2000)
     {
       Dwg_Data *dwg = hdr->parent;
-      if (dwg->dirty_refs)
-        dwg_resolve_objectrefs_silent (dwg);
       _hdr->__iterator = 0; /* reset step counter for cycle detection */
       /* With r2000 we rather follow the next_entity chain */
-      return _hdr->first_entity ? _hdr->first_entity->obj : NULL;
+      if (!_hdr->first_entity)
+        return NULL;
+      if (dwg->opts & DWG_OPTS_LAZY && _hdr->first_entity->obj)
+        (void)dwg_decode_lazy_object (_hdr->first_entity->obj);
+      return _hdr->first_entity->obj;
     }
   else if (version >= R_2004 || version < R_13b1)
     {
@@ -1300,12 +1705,15 @@ get_next_owned_entity (const Dwg_Object *restrict hdr,
 {
   Dwg_Data *dwg = hdr->parent;
   const Dwg_Version_Type version = dwg->header.version;
-  Dwg_Object_BLOCK_HEADER *_hdr = hdr->tio.object->tio.BLOCK_HEADER;
+  Dwg_Object_BLOCK_HEADER *_hdr;
+  if (dwg->opts & DWG_OPTS_LAZY && !hdr->tio.object)
+    (void)dwg_decode_lazy_object ((Dwg_Object *)hdr);
   if (hdr->fixedtype != DWG_TYPE_BLOCK_HEADER)
     {
       LOG_ERROR ("Invalid BLOCK_HEADER type %d", hdr->fixedtype);
       return NULL;
     }
+  _hdr = hdr->tio.object->tio.BLOCK_HEADER;
 
   if (R_13b1 <= version && version <= R_2000)
     {
@@ -2424,12 +2832,203 @@ dwg_find_dicthandle (Dwg_Data *restrict dwg, BITCODE_H dict,
   return NULL;
 }
 
+/* A lazy, case-insensitive name index of a table or a dictionary, for
+   dwg_find_tablehandle and dwg_find_dicthandle_objname. It maps the hash of
+   each entry name to the index of its first entry. New entries are added to
+   it on the next lookup, up to the first one without a name yet, e.g. not
+   yet decoded. A rename via the dynapi or fewer entries reset it.
+   Every hit is still compared by name, and a miss is searched linearly,
+   which also finds the entries renamed directly in their struct.
+   Not used in the decoder threads. */
+typedef struct _dwg_table_index
+{
+  BITCODE_RLL ctrl;       // handle of the CONTROL object or DICTIONARY
+  BITCODE_BL num_indexed; // of its entries
+  dwg_inthash *map;       // name hash => entries index
+} Dwg_Table_Index;
+
+// FNV-1a of the ASCII lowercase name, as strcasecmp. Never 0.
+static uint64_t
+table_index_hash (const char *restrict name)
+{
+  uint64_t h = UINT64_C (14695981039346656037);
+  for (const unsigned char *p = (const unsigned char *)name; *p; p++)
+    {
+      const unsigned char c = (*p >= 'A' && *p <= 'Z') ? *p + 32 : *p;
+      h = (h ^ c) * UINT64_C (1099511628211);
+    }
+  return h ? h : 1;
+}
+
+// The UTF-8 name of the entry, maybe malloced as *isnewp
+static char *
+table_entry_name (Dwg_Data *restrict dwg, const BITCODE_H ref,
+                  int *restrict isnewp)
+{
+  char *name = NULL;
+  Dwg_Object *hobj;
+  *isnewp = 0;
+  if (!ref)
+    return NULL;
+  hobj = dwg_resolve_handle (dwg, ref->absolute_ref);
+  if (!hobj || !hobj->tio.object || !hobj->tio.object->tio.APPID
+      || !hobj->name)
+    return NULL;
+  if (!dwg_dynapi_entity_utf8text (hobj->tio.object->tio.APPID, hobj->name,
+                                   "name", &name, isnewp, NULL))
+    return NULL;
+  return name;
+}
+
+static bool
+table_entry_name_eq (Dwg_Data *restrict dwg, const BITCODE_H ref,
+                     const char *restrict name)
+{
+  int isnew;
+  char *hdlname = table_entry_name (dwg, ref, &isnew);
+  const bool eq
+      = hdlname && (strEQ (name, hdlname) || !strcasecmp (name, hdlname));
+  if (isnew)
+    free (hdlname);
+  return eq;
+}
+
+// the linear search for the first entry with name
+static BITCODE_H
+table_find_linear (Dwg_Data *restrict dwg, BITCODE_H *restrict hdlv,
+                   const BITCODE_BL num, const char *restrict name)
+{
+  for (BITCODE_BL i = 0; i < num; i++)
+    {
+      if (table_entry_name_eq (dwg, hdlv[i], name))
+        return hdlv[i];
+    }
+  return NULL;
+}
+
+static Dwg_Table_Index *
+table_index_get (Dwg_Data *restrict dwg, const BITCODE_RLL ctrl)
+{
+  Dwg_Table_Index *idx;
+  for (BITCODE_BL i = 0; i < dwg->num_table_index; i++)
+    {
+      if (dwg->table_index[i].ctrl == ctrl)
+        return &dwg->table_index[i];
+    }
+  idx = (Dwg_Table_Index *)realloc (dwg->table_index,
+                                    (dwg->num_table_index + 1)
+                                        * sizeof (Dwg_Table_Index));
+  if (!idx)
+    return NULL;
+  dwg->table_index = idx;
+  idx = &dwg->table_index[dwg->num_table_index];
+  idx->ctrl = ctrl;
+  idx->num_indexed = 0;
+  idx->map = NULL;
+  dwg->num_table_index++;
+  return idx;
+}
+
+static void
+table_index_reset (Dwg_Table_Index *restrict idx)
+{
+  if (idx->map)
+    hash_free (idx->map);
+  idx->map = NULL;
+  idx->num_indexed = 0;
+}
+
+/* Find the first of the num entries in hdlv with name, via the index
+   of ctrl. */
+static BITCODE_H
+table_index_find (Dwg_Data *restrict dwg, const BITCODE_RLL ctrl,
+                  BITCODE_H *restrict hdlv, const BITCODE_BL num,
+                  const char *restrict name)
+{
+  uint64_t i;
+  Dwg_Table_Index *idx;
+  if (IN_WORKER) // must not touch dwg->table_index
+    return table_find_linear (dwg, hdlv, num, name);
+  idx = table_index_get (dwg, ctrl);
+  if (!idx)
+    return table_find_linear (dwg, hdlv, num, name);
+  if (num < idx->num_indexed) // some entry was deleted
+    table_index_reset (idx);
+  if (!idx->map)
+    {
+      idx->map = hash_new (num);
+      if (!idx->map)
+        return table_find_linear (dwg, hdlv, num, name);
+    }
+  // add the new entries, until the first without a name yet
+  for (; idx->num_indexed < num; idx->num_indexed++)
+    {
+      int isnew;
+      char *hdlname = table_entry_name (dwg, hdlv[idx->num_indexed], &isnew);
+      if (!hdlname)
+        break;
+      if (*hdlname)
+        {
+          const uint64_t key = table_index_hash (hdlname);
+          if (hash_get (idx->map, key) == HASH_NOT_FOUND) // keep the first
+            hash_set (idx->map, key, idx->num_indexed);
+        }
+      if (isnew)
+        free (hdlname);
+    }
+  i = hash_get (idx->map, table_index_hash (name));
+  if (i != HASH_NOT_FOUND && i < num
+      && table_entry_name_eq (dwg, hdlv[i], name))
+    return hdlv[i];
+  for (BITCODE_BL j = 0; j < num; j++)
+    {
+      if (table_entry_name_eq (dwg, hdlv[j], name))
+        {
+          if (j < idx->num_indexed) // a hash collision or a direct rename
+            {
+              LOG_TRACE ("table_index_find: stale index for %s\n", name);
+              table_index_reset (idx);
+            }
+          return hdlv[j];
+        }
+    }
+  return NULL;
+}
+
+/* The name of obj changed, via the dynapi. Reset the index of its owner, or
+   all without owner. */
+void
+dwg_table_index_rename (Dwg_Data *restrict dwg,
+                        const Dwg_Object *restrict obj)
+{
+  BITCODE_RLL owner = 0;
+  if (!dwg || !dwg->num_table_index)
+    return;
+  if (obj && obj->supertype == DWG_SUPERTYPE_OBJECT && obj->tio.object
+      && obj->tio.object->ownerhandle)
+    owner = obj->tio.object->ownerhandle->absolute_ref;
+  for (BITCODE_BL i = 0; i < dwg->num_table_index; i++)
+    {
+      if (!owner || dwg->table_index[i].ctrl == owner)
+        table_index_reset (&dwg->table_index[i]);
+    }
+}
+
+void
+dwg_free_table_index (Dwg_Data *restrict dwg)
+{
+  for (BITCODE_BL i = 0; i < dwg->num_table_index; i++)
+    table_index_reset (&dwg->table_index[i]);
+  free (dwg->table_index);
+  dwg->table_index = NULL;
+  dwg->num_table_index = 0;
+}
+
 // find dict entry and match its name
 EXPORT BITCODE_H
 dwg_find_dicthandle_objname (Dwg_Data *restrict dwg, BITCODE_H dict,
                              const char *restrict name)
 {
-  BITCODE_BL i;
   Dwg_Object_DICTIONARY *_obj;
   Dwg_Object *obj = dwg_resolve_handle (dwg, dict->absolute_ref);
 
@@ -2448,39 +3047,10 @@ dwg_find_dicthandle_objname (Dwg_Data *restrict dwg, BITCODE_H dict,
     }
 
   _obj = obj->tio.object->tio.DICTIONARY;
-  if (!_obj->numitems)
-    return 0;
-  for (i = 0; i < _obj->numitems; i++)
-    {
-      char *hdlname;
-      BITCODE_H *hdlv = _obj->itemhandles;
-      Dwg_Object *hobj;
-      Dwg_Object_APPID *_o; // just some random type
-      int isnew = 0;
-      bool ok;
-
-      if (!hdlv || !hdlv[i])
-        continue;
-      hobj = dwg_resolve_handle (dwg, hdlv[i]->absolute_ref);
-      if (!hobj || !hobj->tio.object || !hobj->tio.object->tio.APPID
-          || !hobj->name)
-        continue;
-      _o = hobj->tio.object->tio.APPID;
-      ok = dwg_dynapi_entity_utf8text (_o, hobj->name, "name", &hdlname,
-                                       &isnew, NULL);
-      LOG_HANDLE (" %s.%s[%d] => %s.name: %s\n", obj->name, "entries", i,
-                  hobj->name, hdlname ? hdlname : "NULL");
-      if (ok && hdlname
-          && (strEQ (name, hdlname) || !strcasecmp (name, hdlname)))
-        {
-          if (isnew)
-            free (hdlname);
-          return hdlv[i];
-        }
-      if (ok && isnew && hdlname)
-        free (hdlname);
-    }
-  return NULL;
+  if (!_obj->numitems || !_obj->itemhandles)
+    return NULL;
+  return table_index_find (dwg, obj->handle.value, _obj->itemhandles,
+                           _obj->numitems, name);
 }
 
 /* Return the first object of the given type. */
@@ -2697,8 +3267,8 @@ EXPORT BITCODE_H
 dwg_find_tablehandle (Dwg_Data *restrict dwg, const char *restrict name,
                       const char *restrict table)
 {
-  BITCODE_BL i, num_entries = 0;
-  BITCODE_H ctrl = NULL, *hdlv = NULL;
+  BITCODE_BL num_entries = 0;
+  BITCODE_H ctrl = NULL, ref, *hdlv = NULL;
   Dwg_Object *obj;
   Dwg_Object_APPID_CONTROL *_obj; // just some random generic type
   Dwg_Header_Variables *vars = &dwg->header_vars;
@@ -2766,60 +3336,32 @@ dwg_find_tablehandle (Dwg_Data *restrict dwg, const char *restrict name,
                  (unsigned)num_entries);
       return NULL;
     }
-  for (i = 0; i < num_entries; i++)
+  ref = table_index_find (dwg, obj->handle.value, hdlv, num_entries, name);
+  if (!ref)
     {
-      char *hdlname;
-      Dwg_Object *hobj;
-      Dwg_Object_APPID *_o;
-      int isnew = 0;
-      bool ok;
-
-      if (!hdlv[i])
-        continue;
-      LOG_INSANE ("%s.entries[%u/%u]: resolve_handle " FORMAT_HV "\n",
-                  obj->name, i, num_entries, hdlv[i]->absolute_ref);
-      hobj = dwg_resolve_handle (dwg, hdlv[i]->absolute_ref);
-      if (!hobj || !hobj->tio.object || !hobj->tio.object->tio.APPID)
-        continue;
-      _o = hobj->tio.object->tio.APPID;
-      ok = dwg_dynapi_entity_utf8text (_o, hobj->name, "name", &hdlname,
-                                       &isnew, NULL);
-      LOG_HANDLE (" %s.%s[%d] => %s.name: %s\n", obj->name, "entries", i,
-                  hobj->name, hdlname ? hdlname : "NULL");
-      if (ok && hdlname
-          && (strEQ (name, hdlname) || !strcasecmp (name, hdlname)))
+      LOG_INSANE ("Not found in %u %s entries\n", num_entries, table);
+      return NULL;
+    }
+  LOG_INSANE ("Found %s\n", name);
+  if (strEQc (table, "LTYPE"))
+    {
+      if (strEQc (name, "BYLAYER") || strEQc (name, "ByLayer"))
         {
-          LOG_INSANE ("Found %s\n", name);
-          if (isnew)
-            free (hdlname);
-
-          if (strEQc (table, "LTYPE"))
-            {
-              if (strEQc (name, "BYLAYER") || strEQc (name, "ByLayer"))
-                {
-                  if (!vars->LTYPE_BYLAYER)
-                    vars->LTYPE_BYLAYER = hdlv[i];
-                }
-              else if (strEQc (name, "BYBLOCK") || strEQc (name, "ByBlock"))
-                {
-                  if (!vars->LTYPE_BYBLOCK)
-                    vars->LTYPE_BYBLOCK = hdlv[i];
-                }
-              else if (strEQc (name, "CONTINUOUS")
-                       || strEQc (name, "Continuous"))
-                {
-                  if (!vars->LTYPE_CONTINUOUS)
-                    vars->LTYPE_CONTINUOUS = hdlv[i];
-                }
-            }
-          return hdlv[i];
+          if (!vars->LTYPE_BYLAYER)
+            vars->LTYPE_BYLAYER = ref;
+        }
+      else if (strEQc (name, "BYBLOCK") || strEQc (name, "ByBlock"))
+        {
+          if (!vars->LTYPE_BYBLOCK)
+            vars->LTYPE_BYBLOCK = ref;
+        }
+      else if (strEQc (name, "CONTINUOUS") || strEQc (name, "Continuous"))
+        {
+          if (!vars->LTYPE_CONTINUOUS)
+            vars->LTYPE_CONTINUOUS = ref;
         }
-      if (ok && isnew && hdlname)
-        free (hdlname);
     }
-
-  LOG_INSANE ("Not found in %u APPID entries\n", num_entries);
-  return NULL;
+  return ref;
 }
 
 // Search for the table entry and return its handle.
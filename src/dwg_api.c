@@ -53,17 +53,18 @@
 /** We don't pass in Dwg_Object*'s, so we don't know if the object
  *  is >= r2007 or <r13 or what. Default is r2000.
  *  So we need some dwg_api_init_version(&dwg) to store the version.
- *  This is not thread-safe, don't use different DWG versions in parallel
- * threads!
+ *  It is per thread, so call it in each thread using the API.
  */
-static Dwg_Version_Type dwg_version = R_INVALID;
-static unsigned nodeid = 0;
+static THREAD_LOCAL Dwg_Version_Type dwg_version = R_INVALID;
+static THREAD_LOCAL unsigned nodeid = 0;
 
 /* Non-public imports */
 /* I don't want to export these. */
 BITCODE_H dwg_find_tablehandle_silent (Dwg_Data *restrict dwg,
                                        const char *restrict name,
                                        const char *restrict table);
+void dwg_table_index_rename (Dwg_Data *restrict dwg,
+                             const Dwg_Object *restrict obj);
 /* Initialization hack only */
 void dwg_set_next_hdl (Dwg_Data *dwg, BITCODE_RLL value);
 void dwg_set_next_objhandle (Dwg_Object *obj);
@@ -9479,6 +9480,7 @@ dwg_obj_mlinestyle_set_name (dwg_obj_mlinestyle *restrict mlinestyle,
   if (mlinestyle && !error)
     {
       mlinestyle->name = dwg_add_u8_input (dwg, name);
+      dwg_table_index_rename (dwg, NULL);
     }
   else
     {
@@ -23200,6 +23202,7 @@ dwg_obj_layer_set_name (dwg_obj_layer *restrict layer,
     layer->name = bit_convert_TU ((BITCODE_TU)layer->name);
   else
     layer->name = strdup (name);
+  dwg_table_index_rename (obj->parent, obj);
   return;
 }
 
@@ -23919,6 +23922,8 @@ dwg_ent_generic_parent (const void *restrict ent, int *restrict error)
 dwg_obj_ent *
 dwg_object_to_entity (dwg_object *restrict obj, int *restrict error)
 {
+  if (obj->parent && obj->parent->opts & DWG_OPTS_LAZY && !obj->tio.object)
+    (void)dwg_decode_lazy_object (obj);
   if (obj->supertype == DWG_SUPERTYPE_ENTITY)
     {
       *error = 0;
@@ -23982,7 +23987,11 @@ dwg_get_object (dwg_data *dwg, const BITCODE_BL idx)
     return NULL;
   if (dwg_version == R_INVALID)
     dwg_version = (Dwg_Version_Type)dwg->header.version;
-  return (idx < dwg->num_objects) ? &dwg->object[idx] : NULL;
+  if (idx >= dwg->num_objects)
+    return NULL;
+  if (dwg->opts & DWG_OPTS_LAZY && !dwg->object[idx].tio.object)
+    (void)dwg_decode_lazy_object (&dwg->object[idx]);
+  return &dwg->object[idx];
 }
 
 /** Returns object from absolute reference or NULL
@@ -24235,6 +24244,8 @@ dwg_obj_get_handleref (const dwg_obj_obj *restrict obj, int *restrict error)
 EXPORT dwg_obj_obj *
 dwg_object_to_object (dwg_object *restrict obj, int *restrict error)
 {
+  if (obj->parent && obj->parent->opts & DWG_OPTS_LAZY && !obj->tio.object)
+    (void)dwg_decode_lazy_object (obj);
   if (obj->supertype == DWG_SUPERTYPE_OBJECT)
     {
       *error = 0;
@@ -24627,8 +24638,7 @@ dwg_is_valid_tag (const char *tag)
 #define NEW_OBJECT(dwg, obj)                                                  \
   {                                                                           \
     BITCODE_BL idx = dwg->num_objects;                                        \
-    if (dwg_add_object (dwg) < 0)                                             \
-      dwg_resolve_objectrefs_silent (dwg);                                    \
+    (void)dwg_add_object (dwg);                                               \
     obj = &dwg->object[idx];                                                  \
     dwg->cur_index++;                                                         \
     obj->supertype = DWG_SUPERTYPE_OBJECT;                                    \
@@ -24896,7 +24906,6 @@ dwg_add_Document (Dwg_Data *restrict dwg, const int imperial)
   /* Set the import flag, so we don't encode to TU, just TV */
   if (version >= R_13b1)
     dwg->opts |= DWG_OPTS_IN;
-  dwg->dirty_refs = 0;
 
   if (!dwg->object_map)
     dwg->object_map = hash_new (200);
@@ -25420,7 +25429,6 @@ dwg_add_Document (Dwg_Data *restrict dwg, const int imperial)
       if ((obj = dwg_resolve_handle (dwg, ref->absolute_ref)))
         ref->obj = obj;
     }
-  // dwg->dirty_refs = 0;
   return 0;
 }
 
@@ -25475,10 +25483,7 @@ dwg_add_class (Dwg_Data *restrict dwg, const char *const restrict dxfname,
   {                                                                           \
     BITCODE_BL idx = dwg->num_objects;                                        \
     if (dwg_add_object (dwg) < 0)                                             \
-      {                                                                       \
-        dwg_resolve_objectrefs_silent (dwg);                                  \
-        blkobj = dwg_obj_generic_to_object (blkhdr, &error);                  \
-      }                                                                       \
+      blkobj = dwg_obj_generic_to_object (blkhdr, &error);                    \
     obj = &dwg->object[idx];                                                  \
     dwg->cur_index++;                                                         \
     obj->supertype = DWG_SUPERTYPE_ENTITY;                                    \
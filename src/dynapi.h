@@ -40,6 +40,56 @@
 
 #ifndef _DWG_API_H_
 /* Public API, duplicate of dwg_api.h */
+/* The Dwg_DYNAPI_field.type as integer, without a vector *, for
+   switch dispatch. Structs and subclasses are DWG_DT_OTHER. */
+typedef enum DWG_DYNAPI_TYPE
+{
+  DWG_DT_OTHER = 0,
+  DWG_DT_B,
+  DWG_DT_BB,
+  DWG_DT_BT,
+  DWG_DT_4BITS,
+  DWG_DT_RC,
+  DWG_DT_RCd,
+  DWG_DT_RS,
+  DWG_DT_RSd,
+  DWG_DT_BS,
+  DWG_DT_BSd,
+  DWG_DT_RL,
+  DWG_DT_RLd,
+  DWG_DT_RLx,
+  DWG_DT_BL,
+  DWG_DT_BLd,
+  DWG_DT_BLx,
+  DWG_DT_RLL,
+  DWG_DT_RLLd,
+  DWG_DT_BLL,
+  DWG_DT_RD,
+  DWG_DT_BD,
+  DWG_DT_2RD,
+  DWG_DT_2BD,
+  DWG_DT_2BD_1,
+  DWG_DT_2DPOINT,
+  DWG_DT_3RD,
+  DWG_DT_3BD,
+  DWG_DT_3BD_1,
+  DWG_DT_3DPOINT,
+  DWG_DT_BE,
+  DWG_DT_CMC,
+  DWG_DT_H,
+  DWG_DT_T,
+  DWG_DT_TV,
+  DWG_DT_TU,
+  DWG_DT_TF,
+  DWG_DT_TFv,
+  DWG_DT_TFF,
+  DWG_DT_T16,
+  DWG_DT_T32,
+  DWG_DT_D2T,
+  DWG_DT_TIMEBLL,
+  DWG_DT_TIMERLL
+} Dwg_DYNAPI_type;
+
 typedef struct dwg_field_name_type_offset
 {
   const char *const name;    /* field name */
@@ -53,6 +103,11 @@ typedef struct dwg_field_name_type_offset
   const unsigned short is_string : 1; // for null-terminated strings, use
                                       // strcpy/wcscpy. not memcpy
   const short dxf;
+  const unsigned short dtype : 8;     // Dwg_DYNAPI_type of type
+  const unsigned short is_vector : 1; // dynamic array, like BD* or H*
+  const unsigned short is_handle : 1; // H or H*
+  const unsigned short is_float : 1;  // a single BD or RD
+  const unsigned short is_angle : 1;  // DXF 50-59
 } Dwg_DYNAPI_field;
 
 EXPORT bool is_dwg_entity (const char *name) __nonnull ((1));
@@ -186,6 +241,59 @@ EXPORT int dwg_dynapi_fields_size (const char *restrict name) __nonnull ((1));
 // subclass name, like "MLINESTYLE_line".
 ATTRIBUTE_MALLOC char *dwg_dynapi_subclass_name (const char *restrict type);
 
+/* A field resolved once by its object and field name, to get and set its
+   value repeatedly without any name lookup. The members are private. */
+typedef enum DWG_DYNAPI_SCOPE
+{
+  DWG_DYNAPI_ENTITY = 1, /* the fields of the object specific struct */
+  DWG_DYNAPI_COMMON,     /* the common entity or object fields */
+  DWG_DYNAPI_HEADER,
+  DWG_DYNAPI_SUBCLASS
+} Dwg_DYNAPI_scope;
+
+typedef struct dwg_dynapi_fieldhandle
+{
+  const Dwg_DYNAPI_field *field;
+  int type; /* the fixedtype of the entity or object, or the supertype */
+  Dwg_DYNAPI_scope scope;
+} Dwg_DYNAPI_fieldhandle;
+
+/* Resolve the field into handle. Returns false if there's no such field. */
+EXPORT bool
+dwg_dynapi_entity_fieldhandle (const char *restrict name,
+                               const char *restrict fieldname,
+                               Dwg_DYNAPI_fieldhandle *restrict handle)
+    __nonnull ((1, 2, 3));
+EXPORT bool
+dwg_dynapi_common_fieldhandle (const Dwg_Object_Supertype supertype,
+                               const char *restrict fieldname,
+                               Dwg_DYNAPI_fieldhandle *restrict handle)
+    __nonnull ((2, 3));
+EXPORT bool
+dwg_dynapi_header_fieldhandle (const char *restrict fieldname,
+                               Dwg_DYNAPI_fieldhandle *restrict handle)
+    __nonnull ((1, 2));
+EXPORT bool
+dwg_dynapi_subclass_fieldhandle (const char *restrict subclass,
+                                 const char *restrict fieldname,
+                                 Dwg_DYNAPI_fieldhandle *restrict handle)
+    __nonnull ((1, 2, 3));
+
+/* Get and set the value of the resolved field, as with the
+   dwg_dynapi_*_value and dwg_dynapi_*_set_value functions of its scope.
+   ptr is the object specific struct, also for the common fields, the
+   Dwg_Data for the header fields, and the subclass struct for subclass
+   fields. dwg is only needed to set subclass fields, and may be NULL
+   otherwise. */
+EXPORT bool
+dwg_dynapi_fieldhandle_value (const void *restrict ptr,
+                              const Dwg_DYNAPI_fieldhandle *restrict handle,
+                              void *restrict out) __nonnull ((1, 2, 3));
+EXPORT bool dwg_dynapi_fieldhandle_set_value (
+    const Dwg_Data *dwg, void *restrict ptr,
+    const Dwg_DYNAPI_fieldhandle *restrict handle, const void *restrict value,
+    const bool is_utf8) __nonnull ((2, 3, 4));
+
 #endif
 
 /* Searches in dwg_name_subclasses[].
@@ -201,4 +309,35 @@ EXPORT bool dwg_dynapi_is_angle (const char *restrict name,
 
 EXPORT bool dwg_dynapi_is_float (const Dwg_DYNAPI_field *f) __nonnull ((1));
 
+/* The generated DXF index of a fields array: the DXF group codes of its
+   fields, sorted by code and field index, with a { 0, 0 } sentinel.
+   Point fields are also listed under the codes of their y and z values,
+   CMC colors also under the true color, color name and alpha codes.
+   Not yet public. */
+typedef struct dwg_dynapi_dxf
+{
+  const short dxf;             /* DXF group code */
+  const unsigned short index;  /* into the fields array */
+} Dwg_DYNAPI_dxf;
+
+/* The DXF index for the fields of the object or entity, and its size. */
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_entity_dxf (const char *restrict name, unsigned *restrict num)
+    __nonnull ((1, 2));
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_subclass_dxf (const char *restrict name, unsigned *restrict num)
+    __nonnull ((1, 2));
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_common_entity_dxf (unsigned *restrict num) __nonnull ((1));
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_common_object_dxf (unsigned *restrict num) __nonnull ((1));
+
+/* Binary search in the DXF index. Returns the first entry for the code,
+   and sets count to the number of its entries, in fields order.
+   NULL if not found. */
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_dxf_find (const Dwg_DYNAPI_dxf *restrict index,
+                     const unsigned num, const int dxf,
+                     unsigned *restrict count) __nonnull ((4));
+
 #endif
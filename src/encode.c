@@ -49,6 +49,10 @@
 #endif
 
 #define DWG_MAX_OBJSIZE 0xf00000
+// estimated size of an imported object, without obj->size
+#define ENCODE_MIN_OBJSIZE 64
+// the objects per thread chunk
+#define ENCODE_CHUNK 256
 
 #include "common.h"
 #include "bits.h"
@@ -73,6 +77,7 @@ Dwg_Object *dwg_obj_generic_to_object (const void *restrict obj,
 static int encode_preR13_section (const Dwg_Section_Type_r11 id,
                                   Bit_Chain *restrict dat,
                                   Dwg_Data *restrict dwg);
+static const char *dxf_encode_alias (char *restrict name);
 // static void downconvert_relative_handle (BITCODE_H handle,
 //                                          Dwg_Object *restrict obj);
 void dwg_downgrade_MLINESTYLE (Dwg_Object_MLINESTYLE *o);
@@ -80,8 +85,8 @@ void dwg_upgrade_MLINESTYLE (Dwg_Data *restrict dwg,
                              Dwg_Object_MLINESTYLE *restrict o);
 
 /* the current version per spec block */
-static Dwg_Version_Type cur_ver = R_INVALID;
-static BITCODE_BL rcount1 = 0, rcount2 = 0;
+static THREAD_LOCAL Dwg_Version_Type cur_ver = R_INVALID;
+static THREAD_LOCAL BITCODE_BL rcount1 = 0, rcount2 = 0;
 
 static size_t
 bit_umc_size (BITCODE_UMC value)
@@ -107,7 +112,7 @@ static Dwg_Section_Type_r13 section_order[SECTION_R13_SIZE]
 #ifdef USE_TRACING
 /* This flag means we have checked the environment variable
    LIBREDWG_TRACE and set `loglevel' appropriately.  */
-static bool env_var_checked_p;
+static THREAD_LOCAL bool env_var_checked_p;
 #endif /* USE_TRACING */
 #define DWG_LOGLEVEL loglevel
 
@@ -908,8 +913,7 @@ static int
 copy_R2004_section (Bit_Chain *restrict dat, BITCODE_RC *restrict decomp,
                     uint32_t decomp_data_size, uint32_t *comp_data_size)
 {
-  if (dat->size < dat->byte + decomp_data_size)
-    bit_chain_alloc_size (dat, decomp_data_size);
+  bit_chain_reserve (dat, decomp_data_size);
   assert (!dat->bit);
   memcpy (&dat->chain[dat->byte], decomp, decomp_data_size);
   dat->byte += decomp_data_size;
@@ -949,11 +953,13 @@ section_encrypted (const Dwg_Data *dwg, const Dwg_Section_Type id)
     }
 }
 
-#if 0  /* unused, LZ compressor not yet ODA-compatible */
-/* 1 for yes, 0 for no */
+/* 1 for yes, 0 for no. Only with a dwg->compress_level, as the LZ
+   compressor output is not yet ODA-compatible. */
 static int
 section_compressed (const Dwg_Data *dwg, const Dwg_Section_Type id)
 {
+  if (dwg->compress_level == DWG_COMPRESS_NONE)
+    return 0;
   switch (id)
     {
     case SECTION_UNKNOWN:
@@ -981,7 +987,6 @@ section_compressed (const Dwg_Data *dwg, const Dwg_Section_Type id)
       return 0;
     }
 }
-#endif /* unused */
 
 static int
 filedeplist_is_empty (const Dwg_FileDepList *obj)
@@ -1060,8 +1065,7 @@ store_R2004_section (Bit_Chain *restrict dat, BITCODE_RC *restrict decomp,
   size_t start = dat->byte;
   assert (decomp_data_size > 3); // system sections always > 3 bytes
   // worst-case overhead: length header + data + terminator
-  if (dat->size < dat->byte + decomp_data_size + 20)
-    bit_chain_alloc_size (dat, decomp_data_size + 20);
+  bit_chain_reserve (dat, decomp_data_size + 20);
   assert (!dat->bit);
   write_literal_length (dat, decomp, decomp_data_size);
   bit_write_RC (dat, 0x11); // end of stream
@@ -1254,32 +1258,125 @@ compress_write_match (Bit_Chain *restrict dat, uint32_t match_dist,
   bit_write_RC (dat, b2 & 0xFF);
 }
 
+#ifdef HAVE_COMPRESS_R2004_SECTION
+/* The hash chains of DWG_COMPRESS_HIGH: head of the 3-byte hash, and the
+   previous position with the same hash, over a 64K window. */
+#  define COMPRESS_CHAIN_HASH 0x8000
+#  define COMPRESS_CHAIN_WINDOW 0x10000
+/* Candidates searched per position, and the length to stop searching at */
+#  define COMPRESS_CHAIN_DEPTH 128
+#  define COMPRESS_CHAIN_NICE 0x100
+
+typedef struct _compress_chains
+{
+  int32_t head[COMPRESS_CHAIN_HASH];
+  int32_t prev[COMPRESS_CHAIN_WINDOW];
+} Compress_Chains;
+
+static inline uint32_t
+compress_chain_hash (const BITCODE_RC *restrict src, const uint32_t pos)
+{
+  const uint32_t v = ((uint32_t)src[pos] << 10)
+                     ^ ((uint32_t)src[pos + 1] << 5) ^ src[pos + 2];
+  return (v ^ (v >> 7)) & (COMPRESS_CHAIN_HASH - 1);
+}
+
+static inline void
+compress_chain_insert (Compress_Chains *restrict c,
+                       const BITCODE_RC *restrict src, const uint32_t src_size,
+                       const uint32_t pos)
+{
+  uint32_t h;
+  if (pos + 3 > src_size)
+    return;
+  h = compress_chain_hash (src, pos);
+  c->prev[pos & (COMPRESS_CHAIN_WINDOW - 1)] = c->head[h];
+  c->head[h] = (int32_t)pos;
+}
+
+/* Hash chain match finder: Returns the longest match at pos, or 0.
+   Of equal lengths the nearest, as the chain is newest first.
+   Matches beyond the 0x400 short distance need at least 4 bytes, as with
+   compress_find_match, 3 bytes are encoded only there. */
+static uint32_t
+compress_chain_match (const Compress_Chains *restrict c,
+                      const BITCODE_RC *restrict src, const uint32_t src_size,
+                      const uint32_t pos, uint32_t *dist_p)
+{
+  uint32_t best_len = 0;
+  int32_t cand;
+  unsigned depth = COMPRESS_CHAIN_DEPTH;
+
+  if (pos + 3 > src_size)
+    return 0;
+  cand = c->head[compress_chain_hash (src, pos)];
+  while (cand >= 0 && depth--)
+    {
+      const uint32_t dist = pos - (uint32_t)cand;
+      if (!dist || dist > 0xBFFF)
+        break;
+      // pos + best_len < src_size, else it stopped already
+      if (src[(uint32_t)cand + best_len] == src[pos + best_len])
+        {
+          uint32_t len = 0;
+          while (pos + len < src_size
+                 && src[(uint32_t)cand + len] == src[pos + len])
+            len++;
+          if (len > best_len && (len >= 4 || (len == 3 && dist <= 0x400)))
+            {
+              best_len = len;
+              *dist_p = dist;
+              if (len >= COMPRESS_CHAIN_NICE || pos + len >= src_size)
+                break;
+            }
+        }
+      {
+        const int32_t next
+            = c->prev[(uint32_t)cand & (COMPRESS_CHAIN_WINDOW - 1)];
+        if (next >= cand)
+          break;
+        cand = next;
+      }
+    }
+  return best_len;
+}
+#endif
+
 /* Compress the decomp buffer into dat of a DWG r2004+ file. Sets
    comp_data_size. LZ77 variant, ODA section 4.7.
    Based on ACadSharp DwgLZ77AC18Compressor.
    Format: [literal_length + data]* [match [literal_length + data]]* 0x11
+   The level is one of DWG_COMPRESS_*:
+   FAST skips ahead the longer no match was found, for incompressible data.
+   NORMAL (also for NONE) is greedy with a single-probe hash table.
+   HIGH searches hash chains for the longest match, and is lazy: it emits a
+   literal instead when the next position has a longer match.
+   All levels produce streams for decompress_R2004_section.
 */
 static int
 compress_R2004_section (Bit_Chain *restrict dat, BITCODE_RC *restrict decomp,
-                        uint32_t decomp_data_size, uint32_t *comp_data_size)
+                        uint32_t decomp_data_size, uint32_t *comp_data_size,
+                        const unsigned level)
 {
 #ifndef HAVE_COMPRESS_R2004_SECTION
+  (void)level;
   return store_R2004_section (dat, decomp, decomp_data_size, comp_data_size);
 #else
   size_t start = dat->byte;
-  int32_t *hash_table;
+  int32_t *hash_table = NULL;
+  Compress_Chains *chains = NULL;
   uint32_t curr_offset = 0;    /* start of pending literal run */
   uint32_t pos = 4;            /* current scan position (skip first 4 bytes) */
   uint32_t prev_match_len = 0; /* saved match length from previous iter */
   uint32_t prev_match_dist = 0;
-  uint32_t lits, match_len, match_dist;
+  uint32_t misses = 0;         /* FAST: positions without a match */
+  uint32_t lits, match_len, match_dist = 0;
 
   assert (!dat->bit);
   /* Small inputs: encode as a pure literal stream. */
   if (decomp_data_size <= 0x18)
     {
-      if (dat->size < dat->byte + decomp_data_size + 20)
-        bit_chain_alloc_size (dat, decomp_data_size + 20);
+      bit_chain_reserve (dat, decomp_data_size + 20);
       write_literal_length (dat, decomp, decomp_data_size);
       bit_write_RC (dat, 0x11); /* end of stream */
       *comp_data_size = (uint32_t)(dat->byte - start);
@@ -1287,11 +1384,13 @@ compress_R2004_section (Bit_Chain *restrict dat, BITCODE_RC *restrict decomp,
     }
 
   /* Ensure enough output space */
-  if (dat->size < dat->byte + decomp_data_size + 20)
-    bit_chain_alloc_size (dat, decomp_data_size + 20);
+  bit_chain_reserve (dat, decomp_data_size + 20);
 
-  hash_table = (int32_t *)calloc (0x8000, sizeof (int32_t));
-  if (!hash_table)
+  if (level == DWG_COMPRESS_HIGH)
+    chains = (Compress_Chains *)malloc (sizeof (Compress_Chains));
+  else
+    hash_table = (int32_t *)malloc (0x8000 * sizeof (int32_t));
+  if (!hash_table && !chains)
     {
       /* Valid LZ stream fallback if memory is tight. */
       write_literal_length (dat, decomp, decomp_data_size);
@@ -1299,16 +1398,54 @@ compress_R2004_section (Bit_Chain *restrict dat, BITCODE_RC *restrict decomp,
       *comp_data_size = (uint32_t)(dat->byte - start);
       return 0;
     }
-  memset (hash_table, -1, 0x8000 * sizeof (int32_t));
+  if (chains)
+    {
+      memset (chains->head, -1, sizeof (chains->head));
+      for (uint32_t i = 0; i < pos; i++)
+        compress_chain_insert (chains, decomp, decomp_data_size, i);
+    }
+  else
+    memset (hash_table, -1, 0x8000 * sizeof (int32_t));
 
   while (pos < decomp_data_size - 0x13)
     {
-      match_len = (uint32_t)compress_find_match (decomp, decomp_data_size, pos,
-                                                 hash_table, &match_dist);
-      if (match_len < 3)
+      if (chains)
         {
-          pos++;
-          continue;
+          match_len = compress_chain_match (chains, decomp, decomp_data_size,
+                                            pos, &match_dist);
+          compress_chain_insert (chains, decomp, decomp_data_size, pos);
+          if (!match_len)
+            {
+              pos++;
+              continue;
+            }
+          /* lazy evaluation */
+          while (pos + 1 < decomp_data_size - 0x13)
+            {
+              uint32_t next_dist = 0;
+              const uint32_t next_len = compress_chain_match (
+                  chains, decomp, decomp_data_size, pos + 1, &next_dist);
+              if (next_len <= match_len)
+                break;
+              pos++;
+              compress_chain_insert (chains, decomp, decomp_data_size, pos);
+              match_len = next_len;
+              match_dist = next_dist;
+            }
+        }
+      else
+        {
+          match_len = (uint32_t)compress_find_match (
+              decomp, decomp_data_size, pos, hash_table, &match_dist);
+          if (match_len < 3)
+            {
+              if (level == DWG_COMPRESS_FAST)
+                pos += 1 + (misses++ >> 4);
+              else
+                pos++;
+              continue;
+            }
+          misses = 0;
         }
 
       /* Number of literal bytes between last match end and this match */
@@ -1321,6 +1458,9 @@ compress_R2004_section (Bit_Chain *restrict dat, BITCODE_RC *restrict decomp,
       /* Write literal bytes */
       write_literal_length (dat, &decomp[curr_offset], lits);
 
+      if (chains)
+        for (uint32_t i = 1; i < match_len; i++)
+          compress_chain_insert (chains, decomp, decomp_data_size, pos + i);
       pos += match_len;
       curr_offset = pos;
       prev_match_len = match_len;
@@ -1337,10 +1477,72 @@ compress_R2004_section (Bit_Chain *restrict dat, BITCODE_RC *restrict decomp,
   *comp_data_size = (uint32_t)(dat->byte - start);
 
   free (hash_table);
+  free (chains);
   return 0;
 #endif
 }
 
+typedef struct _compress_job
+{
+  Bit_Chain out;           // the compressed page
+  uint32_t comp_data_size;
+  uint32_t data_crc;       // the checksum of the compressed page
+} Compress_Job;
+
+typedef struct _compress_pages
+{
+  Compress_Job *jobs;
+  BITCODE_RC *chain; // the padded section
+  uint32_t page_size;
+  unsigned level;
+} Compress_Pages;
+
+/* Each data page is compressed independently, so compress it into its own
+   buffer, and checksum it there. */
+static void
+compress_page (void *arg, const uint32_t k)
+{
+  Compress_Pages *p = (Compress_Pages *)arg;
+  Compress_Job *job = &p->jobs[k];
+
+  bit_chain_alloc_size (&job->out, p->page_size + 0x400);
+  if (!job->out.chain)
+    return;
+  compress_R2004_section (&job->out, &p->chain[(size_t)k * p->page_size],
+                          p->page_size, &job->comp_data_size, p->level);
+  job->out.byte = 0;
+  job->data_crc = dwg_section_page_checksum (
+      0, &job->out, (int32_t)job->comp_data_size, false);
+}
+
+/* Compresses and checksums all data pages of a section with num_threads
+   threads, to be written serially then, in order. Returns NULL if one
+   failed, then the pages are compressed serially. */
+static Compress_Job *
+compress_pages_parallel (const Dwg_Data *restrict dwg,
+                         const Dwg_Section_Info *restrict info,
+                         BITCODE_RC *restrict chain, const uint32_t page_size)
+{
+  Compress_Pages p;
+  p.jobs = (Compress_Job *)calloc (info->num_sections, sizeof (Compress_Job));
+  if (!p.jobs)
+    return NULL;
+  p.chain = chain;
+  p.page_size = page_size;
+  p.level = dwg->compress_level;
+  dwg_parallel_for (dwg->num_threads, info->num_sections, 1, compress_page,
+                    &p);
+  for (BITCODE_BL k = 0; k < info->num_sections; k++)
+    if (!p.jobs[k].out.chain || !p.jobs[k].comp_data_size)
+      {
+        for (BITCODE_BL j = 0; j < info->num_sections; j++)
+          free (p.jobs[j].out.chain);
+        free (p.jobs);
+        return NULL;
+      }
+  return p.jobs;
+}
+
 static Dwg_Section_Info *
 find_section_info_type (const Dwg_Data *restrict dwg, Dwg_Section_Type type)
 {
@@ -1654,7 +1856,7 @@ encode_preR13_section_hdr (const char *restrict name,
                            const Dwg_Section_Type_r11 id,
                            Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
 {
-  static BITCODE_BL addr = 0;
+  static THREAD_LOCAL BITCODE_BL addr = 0;
   Dwg_Section *tbl;
   int i;
   unsigned long end_address;
@@ -2387,8 +2589,342 @@ encode_classes (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
   return error;
 }
 
+/* Sort the object map by ascending handles, stable, so that the objects
+   are written in the same order for any order of dwg->object[].
+   A LSD radix sort by bytes, skipping the bytes which are the same in all
+   handles, and nothing if already sorted. O(n), not the quadratic
+   insertion sort for imported DXF or JSON with unsorted handles. */
+static int
+object_map_sort (Object_Map *restrict omap, const BITCODE_BL num)
+{
+  Object_Map *restrict tmp, *restrict src, *restrict dst;
+  BITCODE_RLL all_or = 0, all_and = UINT64_MAX, diff;
+  bool sorted = true;
+  BITCODE_BL i;
+
+  for (i = 0; i < num; i++)
+    {
+      all_or |= omap[i].handle;
+      all_and &= omap[i].handle;
+      if (i && omap[i - 1].handle > omap[i].handle)
+        sorted = false;
+    }
+  if (sorted)
+    return 0;
+  tmp = (Object_Map *)malloc (num * sizeof (Object_Map));
+  if (!tmp)
+    {
+      LOG_ERROR ("Out of memory");
+      return DWG_ERR_OUTOFMEM;
+    }
+  diff = all_or ^ all_and;
+  src = omap;
+  dst = tmp;
+  for (unsigned shift = 0; shift < 64; shift += 8)
+    {
+      size_t pos[256] = { 0 };
+      size_t sum = 0;
+      if (!((diff >> shift) & 0xFF))
+        continue;
+      for (i = 0; i < num; i++)
+        pos[(src[i].handle >> shift) & 0xFF]++;
+      for (unsigned b = 0; b < 256; b++)
+        {
+          const size_t count = pos[b];
+          pos[b] = sum;
+          sum += count;
+        }
+      for (i = 0; i < num; i++)
+        dst[pos[(src[i].handle >> shift) & 0xFF]++] = src[i];
+      tmp = src;
+      src = dst;
+      dst = tmp;
+    }
+  // the other one is the malloc'ed buffer
+  if (src != omap)
+    memcpy (omap, src, num * sizeof (Object_Map));
+  free (src != omap ? src : dst);
+  return 0;
+}
+
+/* The sizing pass: estimates the size of all objects, to presize the
+   output chains and avoid growing them object by object.
+   obj->size is known from a DWG, imported objects get a minimal guess.
+   Plus the MS size, CRC and the object map entry. */
+static size_t
+encode_object_estimate (const Dwg_Object *restrict obj)
+{
+  if (obj->type == DWG_TYPE_UNUSED || obj->type == DWG_TYPE_FREED)
+    return 0;
+  if (obj->size > DWG_MAX_OBJSIZE)
+    return DWG_MAX_OBJSIZE + 8;
+  return (obj->size > ENCODE_MIN_OBJSIZE ? obj->size : ENCODE_MIN_OBJSIZE)
+         + 8;
+}
+
+static size_t
+encode_objects_estimate (const Dwg_Data *restrict dwg)
+{
+  size_t size = 0;
+  for (BITCODE_BL i = 0; i < dwg->num_objects; i++)
+    size += encode_object_estimate (&dwg->object[i]);
+  // don't trust it too much
+  if (size > MAX_MEM_ALLOC / 16)
+    size = MAX_MEM_ALLOC / 16;
+  return size;
+}
+
+/* If the class of the variable type obj, as found by dwg_encode_get_class,
+   agrees with its supertype. Else dwg_encode_variable_type fixes up the
+   shared class, which changes the encoding of the later objects of this
+   class. */
+static bool
+encode_class_agrees_p (const Dwg_Data *restrict dwg,
+                       const Dwg_Object *restrict obj)
+{
+  const Dwg_Class *klass = NULL;
+  int is_entity;
+  if (!dwg->dwg_class)
+    return true;
+  if (obj->dxfname)
+    {
+      const char *alias = dxf_encode_alias (obj->dxfname);
+      for (BITCODE_BS i = 0; i < dwg->num_classes && !klass; i++)
+        {
+          const char *dxfname = dwg->dwg_class[i].dxfname;
+          if (!dxfname) // may fall back to the search by index
+            return false;
+          if (strEQ (obj->dxfname, dxfname)
+              || (alias && strEQ (alias, dxfname)))
+            klass = &dwg->dwg_class[i];
+        }
+    }
+  else if (obj->type >= 500 && obj->type - 500 < (int)dwg->num_classes)
+    klass = &dwg->dwg_class[obj->type - 500];
+  if (!klass || !klass->dxfname)
+    return true; // no class, nothing to fix up
+  is_entity = dwg_class_is_entity (klass);
+  return !((is_entity && obj->supertype == DWG_SUPERTYPE_OBJECT)
+           || (!is_entity && obj->supertype == DWG_SUPERTYPE_ENTITY));
+}
+
+/* If the r13+ objects are encoded by dwg->num_threads threads.
+   Not with info logging, as the log of the objects would be interleaved,
+   and not when an object would fix up its class. */
+static bool
+encode_parallel_p (const Dwg_Data *restrict dwg)
+{
+#ifdef HAVE_PTHREAD_H
+  if (dwg->num_threads <= 1 || loglevel >= DWG_LOGLEVEL_INFO
+      || dwg->num_objects <= ENCODE_CHUNK)
+    return false;
+  for (BITCODE_BL i = 0; i < dwg->num_objects; i++)
+    {
+      const Dwg_Object *obj = &dwg->object[i];
+      if (obj->type == DWG_TYPE_UNUSED || obj->type == DWG_TYPE_FREED)
+        continue;
+      if ((obj->type >= 500
+           || (obj->fixedtype >= 500 && obj->fixedtype < DWG_TYPE_FREED))
+          && !encode_class_agrees_p (dwg, obj))
+        {
+          LOG_WARN ("Class mismatch of %s, encode serially", obj->name);
+          return false;
+        }
+      // renames its class when imported
+      if (obj->fixedtype == DWG_TYPE_TABLEGEOMETRY
+          && dwg->opts & DWG_OPTS_IN)
+        return false;
+    }
+  return true;
+#else
+  (void)dwg;
+  return false;
+#endif
+}
+
+#ifdef HAVE_PTHREAD_H
+/* The r2002- PLOTSETTINGS and LAYOUT look up the name of their VIEW while
+   being encoded. Do that before the threads. */
+static void
+encode_plotview_names (Dwg_Data *restrict dwg,
+                       const Bit_Chain *restrict dat)
+{
+  if (dat->version > R_2002)
+    return;
+  for (BITCODE_BL i = 0; i < dwg->num_objects; i++)
+    {
+      Dwg_Object *obj = &dwg->object[i];
+      if (obj->fixedtype == DWG_TYPE_PLOTSETTINGS && obj->tio.object
+          && obj->tio.object->tio.PLOTSETTINGS)
+        {
+          Dwg_Object_PLOTSETTINGS *_obj = obj->tio.object->tio.PLOTSETTINGS;
+          if (_obj->plotview && !_obj->plotview_name)
+            _obj->plotview_name
+                = dwg_handle_name (dwg, "VIEW", _obj->plotview);
+        }
+      else if (obj->fixedtype == DWG_TYPE_LAYOUT && obj->tio.object
+               && obj->tio.object->tio.LAYOUT)
+        {
+          Dwg_Object_LAYOUT *_obj = obj->tio.object->tio.LAYOUT;
+          if (_obj->plotsettings.plotview
+              && !_obj->plotsettings.plotview_name)
+            _obj->plotsettings.plotview_name
+                = dwg_handle_name (dwg, "VIEW", _obj->plotsettings.plotview);
+        }
+    }
+}
+
+/* The positions of an object before it was encoded. The changed ones are
+   moved from its chunk to the output. */
+typedef struct _encode_old_pos
+{
+  size_t address;
+  size_t hdlpos;
+} Encode_Old_Pos;
+
+typedef struct _encode_workers
+{
+  Dwg_Data *dwg;
+  const Bit_Chain *dat;
+  Object_Map *omap;
+  Encode_Old_Pos *old;
+  Bit_Chain *chunks; // the objects of each chunk of the omap, from byte 1
+  int *errors;       // per chunk
+} Encode_Workers;
+
+/* Encodes the objects of chunk c of the sorted omap into its own chain.
+   Their omap addresses are relative to the chain. As in the serial loop
+   of encode_objects_handles. */
+static void
+encode_worker (void *arg, const uint32_t c)
+{
+  Encode_Workers *w = (Encode_Workers *)arg;
+  Dwg_Data *dwg = w->dwg;
+  Bit_Chain *dat = &w->chunks[c];
+  const BITCODE_BL start = c * ENCODE_CHUNK;
+  const BITCODE_BL end = start + ENCODE_CHUNK < dwg->num_objects
+                             ? start + ENCODE_CHUNK
+                             : dwg->num_objects;
+  size_t size = 1;
+  int error = 0;
+
+  for (BITCODE_BL i = start; i < end; i++)
+    if (w->omap[i].index < dwg->num_objects)
+      size += encode_object_estimate (&dwg->object[w->omap[i].index]);
+  bit_chain_init_dat (dat, size, w->dat);
+  if (!dat->chain)
+    {
+      w->errors[c] = DWG_ERR_OUTOFMEM;
+      return;
+    }
+  dat->byte = 1; // address 0 is invalid
+  for (BITCODE_BL i = start; i < end; i++)
+    {
+      Dwg_Object *obj;
+      BITCODE_BL index = w->omap[i].index;
+      size_t end_address;
+      if (!index && !w->omap[i].handle)
+        continue; // skipped objects
+      w->omap[i].address = dat->byte;
+      if (index > dwg->num_objects)
+        {
+          LOG_ERROR ("Invalid object map index " FORMAT_BL ", max " FORMAT_BL
+                     ". Skipping",
+                     index, dwg->num_objects);
+          error |= DWG_ERR_VALUEOUTOFBOUNDS;
+          continue;
+        }
+      obj = &dwg->object[index];
+      if (obj->type == DWG_TYPE_UNUSED || obj->type == DWG_TYPE_FREED)
+        continue;
+      if (!obj->parent)
+        obj->parent = dwg;
+      w->old[i].address = obj->address;
+      w->old[i].hdlpos = obj->hdlpos;
+      error |= dwg_encode_add_object (obj, dat, dat->byte);
+      end_address = w->omap[i].address + (size_t)obj->size;
+      if (end_address > dat->size)
+        bit_chain_alloc_size (dat, end_address - dat->size);
+    }
+  w->errors[c] = error;
+}
+
+/* Encodes the sorted objects with dwg->num_threads threads into one chain
+   per chunk of the omap, and appends these to dat in the omap order.
+   Then the addresses of the objects and the omap are moved there, so that
+   the result is the same as with the serial loop. */
+static int
+encode_objects_parallel (Dwg_Data *restrict dwg, Bit_Chain *restrict dat,
+                         Object_Map *restrict omap)
+{
+  Encode_Workers w;
+  const uint32_t num_chunks
+      = (dwg->num_objects + ENCODE_CHUNK - 1) / ENCODE_CHUNK;
+  int error = 0;
+
+  w.dwg = dwg;
+  w.dat = dat;
+  w.omap = omap;
+  w.old = (Encode_Old_Pos *)calloc (dwg->num_objects, sizeof (Encode_Old_Pos));
+  w.chunks = (Bit_Chain *)calloc (num_chunks, sizeof (Bit_Chain));
+  w.errors = (int *)calloc (num_chunks, sizeof (int));
+  if (!w.old || !w.chunks || !w.errors)
+    {
+      free (w.old);
+      free (w.chunks);
+      free (w.errors);
+      LOG_ERROR ("Out of memory");
+      return DWG_ERR_OUTOFMEM;
+    }
+  encode_plotview_names (dwg, dat);
+  dwg_parallel_for (dwg->num_threads, num_chunks, 1, encode_worker, &w);
+
+  for (uint32_t c = 0; c < num_chunks; c++)
+    {
+      Bit_Chain *chunk = &w.chunks[c];
+      const BITCODE_BL start = c * ENCODE_CHUNK;
+      const BITCODE_BL end = start + ENCODE_CHUNK < dwg->num_objects
+                                 ? start + ENCODE_CHUNK
+                                 : dwg->num_objects;
+      // chunk byte 1 is at dat->byte
+      const size_t delta = dat->byte - 1;
+      error |= w.errors[c];
+      if (!chunk->chain)
+        continue;
+      bit_chain_reserve (dat, chunk->byte - 1);
+      memcpy (&dat->chain[dat->byte], &chunk->chain[1], chunk->byte - 1);
+      for (BITCODE_BL i = start; i < end; i++)
+        {
+          Dwg_Object *obj;
+          BITCODE_BL index = omap[i].index;
+          if (!index && !omap[i].handle)
+            continue;
+          omap[i].address += delta;
+          if (index > dwg->num_objects)
+            continue;
+          obj = &dwg->object[index];
+          if (obj->type == DWG_TYPE_UNUSED || obj->type == DWG_TYPE_FREED)
+            continue;
+          if (obj->address != w.old[i].address)
+            obj->address += delta;
+          if (obj->bitsize_pos)
+            obj->bitsize_pos += delta * 8;
+          if (obj->hdlpos != w.old[i].hdlpos)
+            obj->hdlpos += delta * 8;
+        }
+      dat->byte += chunk->byte - 1;
+      dat->bit = 0;
+      bit_chain_free (chunk);
+    }
+  free (w.old);
+  free (w.chunks);
+  free (w.errors);
+  return error;
+}
+#endif
+
 /*------------------------------------------------------------
- * Classes
+ * Objects and the object map
  */
 static int
 encode_objects_handles (Dwg_Data *restrict dwg, Bit_Chain *restrict dat,
@@ -2396,7 +2932,7 @@ encode_objects_handles (Dwg_Data *restrict dwg, Bit_Chain *restrict dat,
 {
   int error = 0;
   int ckr_missing = 1;
-  BITCODE_BL i, j;
+  BITCODE_BL i;
   Dwg_Section_Type sec_id;
   size_t size_adr;
   size_t last_offset;
@@ -2411,7 +2947,7 @@ encode_objects_handles (Dwg_Data *restrict dwg, Bit_Chain *restrict dat,
   SINCE (R_2004a)
   {
     sec_id = SECTION_OBJECTS;
-    bit_chain_alloc (&sec_dat[sec_id]);
+    bit_chain_alloc_size (&sec_dat[sec_id], encode_objects_estimate (dwg));
     str_dat = hdl_dat = dat = &sec_dat[sec_id];
     bit_chain_set_version (dat, old_dat);
     dat->byte += 4; // r2004 object map offsets start after a 4-byte prefix
@@ -2455,18 +2991,11 @@ encode_objects_handles (Dwg_Data *restrict dwg, Bit_Chain *restrict dat,
       omap[i].index = i; // i.e. dwg->object[j].index
       omap[i].handle = dwg->object[i].handle.value;
     }
-  // insertion sort
-  for (i = 0; i < dwg->num_objects; i++)
+  error |= object_map_sort (omap, dwg->num_objects);
+  if (error >= DWG_ERR_CRITICAL)
     {
-      Object_Map tmap;
-      j = i;
-      tmap = omap[i];
-      while (j > 0 && omap[j - 1].handle > tmap.handle)
-        {
-          omap[j] = omap[j - 1];
-          j--;
-        }
-      omap[j] = tmap;
+      free (omap);
+      return error;
     }
   if (DWG_LOGLEVEL >= DWG_LOGLEVEL_HANDLE)
     {
@@ -2482,6 +3011,11 @@ encode_objects_handles (Dwg_Data *restrict dwg, Bit_Chain *restrict dat,
   }
   /* Write the sorted objects
    */
+#ifdef HAVE_PTHREAD_H
+  if (encode_parallel_p (dwg))
+    error |= encode_objects_parallel (dwg, dat, omap);
+  else
+#endif
   for (i = 0; i < dwg->num_objects; i++)
     {
       Dwg_Object *obj;
@@ -2799,6 +3333,18 @@ encode_objfreespace_2ndheader (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
   return error;
 }
 
+/* How often the output chains had to grow during this encode, and how
+   many bytes were copied by realloc (at most). */
+static void
+encode_log_chain_stats (void)
+{
+  size_t num_reallocs, copied;
+  bit_chain_stats (&num_reallocs, &copied);
+  LOG_INFO ("Output chains: %" PRIuSIZE " reallocs, %" PRIuSIZE
+            " bytes copied\n",
+            num_reallocs, copied);
+}
+
 /**
  * dwg_encode(): the current generic encoder entry point.
  *
@@ -2941,7 +3487,6 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
         }
     }
 
-  bit_chain_alloc (dat);
   hdl_dat = dat; // split later in objects/entities
   if (!dat->version)
     {
@@ -2949,6 +3494,15 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
       dat->from_version = dwg->header.from_version;
       dat->opts = dwg->opts;
     }
+  bit_chain_stats_reset ();
+  if (dat->version < R_2004a)
+    // presized for the header, classes, thumbnail and objects
+    bit_chain_alloc_size (dat, 0x1000 + ((size_t)dwg->num_classes * 64)
+                                   + dwg->thumbnail.size
+                                   + encode_objects_estimate (dwg));
+  else
+    // the sections are presized, and reserved when written into it
+    bit_chain_alloc (dat);
   dat->codepage = dwg->header.codepage;
 
   if (dwg->header.from_version > R_2000 && dwg->header.version <= R_2000)
@@ -3341,6 +3895,7 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
     dat->byte = addr;
     LOG_TRACE ("Wrote %" PRIuSIZE " bytes\n", dat->byte);
     dat->size = addr;
+    encode_log_chain_stats ();
     return error;
   }
 
@@ -3882,9 +4437,8 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
               info->max_decomp_size = max_decomp_size;
               info->encrypted
                   = section_encrypted (dwg, (Dwg_Section_Type)type);
-              // always uncompressed for now, LZ compressor not yet
-              // ODA-compatible. TODO: re-enable when fixed.
-              info->compressed = 1;
+              info->compressed
+                  = section_compressed (dwg, (Dwg_Section_Type)type) ? 2 : 1;
               // pre-calc numsections for both
               if ((unsigned)ssize <= max_decomp_size)
                 info->num_sections = 1;
@@ -4134,13 +4688,13 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
             + (8 * ((dwg->fhdr.r2004_header.numsections + 2) * 24)); // no gaps
       assert (section_address);
       dat->byte = section_address;
-      if (dat->byte + size > dat->size)
-        bit_chain_alloc_size (dat, size);
+      bit_chain_reserve (dat, size);
       LOG_HANDLE ("@%" PRIuSIZE ".0\n", dat->byte);
       for (i = 0; i < ARRAY_SIZE (stream_order); i++)
         {
           Dwg_Section_Info *info;
           unsigned max_decomp_size;
+          Compress_Job *jobs = NULL;
           type = stream_order[i];
           info = find_section_info_type (dwg, (Dwg_Section_Type)type);
           if (!info)
@@ -4205,9 +4759,8 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
               size_t padded = ((sec_dat[type].byte + max_decomp_size - 1)
                                / max_decomp_size)
                               * max_decomp_size;
-              if (padded > sec_dat[type].size)
-                bit_chain_alloc_size (&sec_dat[type],
-                                      padded - sec_dat[type].size);
+              bit_chain_reserve (&sec_dat[type],
+                                 padded - sec_dat[type].byte);
               if (padded > sec_dat[type].byte)
                 memset (&sec_dat[type].chain[sec_dat[type].byte], 0,
                         padded - sec_dat[type].byte);
@@ -4216,6 +4769,14 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
           LOG_TRACE ("Write %s pages @%" PRIuSIZE " (%u/%" PRIuSIZE ")\n",
                      dwg_section_name (dwg, type), dat->byte,
                      info->num_sections, sec_dat[type].size);
+          // Compress the data pages in threads first, and write them in
+          // order below. Not with insane logging of the matches.
+          if (type < SECTION_INFO && info->compressed == 2
+              && dwg->num_threads > 1 && info->num_sections > 1
+              && sec_dat[type].chain
+              && DWG_LOGLEVEL < DWG_LOGLEVEL_INSANE)
+            jobs = compress_pages_parallel (dwg, info, sec_dat[type].chain,
+                                            max_decomp_size);
           for (unsigned k = 0; k < info->num_sections; k++)
             {
               Dwg_Section *sec = info->sections[k];
@@ -4255,8 +4816,7 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
                   content_size = (uint32_t)sec_dat[type].byte;
                   sec->decomp_data_size = content_size;
 
-                  if (dat->byte + 20 + content_size + 20 > dat->size)
-                    bit_chain_alloc_size (dat, 20 + content_size + 20);
+                  bit_chain_reserve (dat, 20 + content_size + 20);
 
                   bit_write_RL (dat, section_magic);
                   bit_write_RL (dat, content_size); // decomp_data_size
@@ -4275,7 +4835,8 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
                   else
                     compress_R2004_section (dat, sec_dat[type].chain,
                                             content_size,
-                                            &sec->comp_data_size);
+                                            &sec->comp_data_size,
+                                            dwg->compress_level);
                   sec->size = 20 + sec->comp_data_size;
 
                   // patch comp_data_size in the header
@@ -4327,18 +4888,29 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
                   content_size = sec->decomp_data_size; // = max_decomp_size
                   chain_page
                       = sec_dat[type].chain + (size_t)k * max_decomp_size;
-                  if (dat->byte + 32 + content_size + 32 > dat->size)
-                    bit_chain_alloc_size (dat, 32 + content_size + 32);
+                  bit_chain_reserve (dat, 32 + content_size + 32);
 
                   // reserve encrypted page header, write payload, then patch
                   // header with actual compressed data size.
                   page_hdr_pos = dat->byte;
                   dat->byte += 32;
 
-                  // always use raw copy for data section pages,
-                  // as the LZ compressor output is not yet ODA-compatible
-                  copy_R2004_section (dat, chain_page, content_size,
-                                      &sec->comp_data_size);
+                  // raw copy for the uncompressed data section pages
+                  if (jobs)
+                    {
+                      sec->comp_data_size = jobs[k].comp_data_size;
+                      bit_chain_reserve (dat, sec->comp_data_size);
+                      memcpy (&dat->chain[dat->byte], jobs[k].out.chain,
+                              sec->comp_data_size);
+                      dat->byte += sec->comp_data_size;
+                    }
+                  else if (info->compressed == 2)
+                    compress_R2004_section (dat, chain_page, content_size,
+                                            &sec->comp_data_size,
+                                            dwg->compress_level);
+                  else
+                    copy_R2004_section (dat, chain_page, content_size,
+                                        &sec->comp_data_size);
 
                   sec->size = 32 + sec->comp_data_size;
 
@@ -4358,8 +4930,11 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
                     uint32_t data_crc, page_hdr_crc;
 
                     page_dat.byte = page_hdr_pos + 32;
-                    data_crc = dwg_section_page_checksum (
-                        0, &page_dat, (int32_t)sec->comp_data_size, false);
+                    data_crc
+                        = jobs ? jobs[k].data_crc
+                               : dwg_section_page_checksum (
+                                   0, &page_dat, (int32_t)sec->comp_data_size,
+                                   false);
 
                     // Build clear-text header checksums before applying mask.
                     page_hdr[6] = 0;        // page_header_crc placeholder
@@ -4385,6 +4960,12 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
                               content_size, sec_mask);
                 }
             }
+          if (jobs)
+            {
+              for (unsigned k = 0; k < info->num_sections; k++)
+                free (jobs[k].out.chain);
+              free (jobs);
+            }
           bit_chain_free (&sec_dat[type]);
         }
     }
@@ -4411,8 +4992,7 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
       size_t secondheader_pos = dat->byte;
       dwg->fhdr.r2004_header.secondheader_address
           = (BITCODE_RLL)secondheader_pos + 20;
-      if (dat->byte + 128 > dat->size)
-        bit_chain_alloc_size (dat, 128);
+      bit_chain_reserve (dat, 128);
       dat->byte += 128;
       LOG_TRACE ("secondheader reserved @0x%" PRIX64 "\n",
                  (uint64_t)secondheader_pos);
@@ -4577,6 +5157,7 @@ dwg_encode (Dwg_Data *restrict dwg, Bit_Chain *restrict dat)
     dat->byte = dat->size;
   }
 
+  encode_log_chain_stats ();
   return 0;
 }
 // clang-format off
@@ -5338,8 +5919,7 @@ encode_preR13_entities (EntitySectionIndexR11 section, Bit_Chain *restrict dat,
                       // ENTITIES)
         }
 
-      if (dat->byte + obj->size < dat->size)
-        bit_chain_alloc_size (dat, obj->size);
+      bit_chain_reserve (dat, obj->size);
       numentities++;
       obj->address = dat->byte;
       // Pre-r13 SEQEND needs begin_addr_r11 set to the owner's address
@@ -6188,6 +6768,8 @@ dwg_encode_add_object (Dwg_Object *restrict obj, Bit_Chain *restrict dat,
   }
   dat->byte = address;
   dat->bit = 0;
+  // set when the bitsize is written, a stale one would be patched
+  obj->bitsize_pos = 0;
 
   LOG_INFO ("Object number: %lu", (unsigned long)obj->index);
   if (obj->size > DWG_MAX_OBJSIZE)
@@ -6778,8 +7360,7 @@ dwg_encode_eed_data (Bit_Chain *restrict dat, Dwg_Eed_Data *restrict data,
 {
   size_t pos = bit_position (dat);
   size_t size;
-  if (dat->byte + 24 < dat->size)
-    bit_chain_alloc_size (dat, 24);
+  bit_chain_reserve (dat, 24);
   bit_write_RC (dat, data->code);
   LOG_TRACE ("EED[%d] code: %d [RC] ", i, data->code);
   switch (data->code)
@@ -6792,8 +7373,7 @@ dwg_encode_eed_data (Bit_Chain *restrict dat, Dwg_Eed_Data *restrict data,
           BITCODE_RS length = data->u.eed_0.is_tu ? data->u.eed_0.length
                                                   : data->u.eed_0_r2007.length;
           char *s;
-          if (length + 1 + dat->byte < dat->size)
-            bit_chain_alloc_size (dat, (length + 1 + dat->byte) - dat->size);
+          bit_chain_reserve (dat, length + 1);
           if (length > 255)
             {
               LOG_ERROR ("eed: overlong string %d stripped", (int)length);
@@ -6824,9 +7404,7 @@ dwg_encode_eed_data (Bit_Chain *restrict dat, Dwg_Eed_Data *restrict data,
               BITCODE_RS length = data->u.eed_0_r2007.length;
               BITCODE_RS *s = (BITCODE_RS *)&data->u.eed_0_r2007.string;
               char *dest;
-              if (length + 5 + dat->byte < dat->size)
-                bit_chain_alloc_size (dat,
-                                      (length + 5 + dat->byte) - dat->size);
+              bit_chain_reserve (dat, length + 5);
               if (length > 255)
                 {
                   LOG_ERROR ("eed: overlong string %d stripped", (int)length);
@@ -6845,8 +7423,7 @@ dwg_encode_eed_data (Bit_Chain *restrict dat, Dwg_Eed_Data *restrict data,
             {
               if (!*data->u.eed_0.string)
                 data->u.eed_0.length = 0;
-              if (data->u.eed_0.length + 5 + dat->byte < dat->size)
-                bit_chain_alloc_size (dat, data->u.eed_0.length + 5);
+              bit_chain_reserve (dat, data->u.eed_0.length + 5);
               bit_write_RC (dat, data->u.eed_0.length);
               bit_write_RS_BE (dat, data->u.eed_0.codepage);
               bit_write_TF (dat, (BITCODE_TF)data->u.eed_0.string,
@@ -6874,8 +7451,7 @@ dwg_encode_eed_data (Bit_Chain *restrict dat, Dwg_Eed_Data *restrict data,
                 if (length > tu_len)
                   length = (BITCODE_RS)tu_len;
               }
-              if ((length * 2) + 5 + dat->byte < dat->size)
-                bit_chain_alloc_size (dat, (length * 2) + 5 + dat->byte);
+              bit_chain_reserve (dat, (length * 2) + 5);
               bit_write_RS (dat, length);
               for (int j = 0; j < length; j++)
                 bit_write_RS (dat, dest[j]);
@@ -6886,8 +7462,7 @@ dwg_encode_eed_data (Bit_Chain *restrict dat, Dwg_Eed_Data *restrict data,
             {
               BITCODE_RS length = data->u.eed_0_r2007.length;
               BITCODE_RS *s = (BITCODE_RS *)&data->u.eed_0_r2007.string;
-              if ((length * 2) + 5 + dat->byte < dat->size)
-                bit_chain_alloc_size (dat, (length * 2) + 5);
+              bit_chain_reserve (dat, (length * 2) + 5);
               bit_write_RS (dat, length);
               for (int j = 0; j < length; j++)
                 bit_write_RS (dat, *s++);
@@ -6938,8 +7513,7 @@ dwg_encode_eed_data (Bit_Chain *restrict dat, Dwg_Eed_Data *restrict data,
       }
       break;
     case 4:
-      if (data->u.eed_4.length + 1 + dat->byte < dat->size)
-        bit_chain_alloc_size (dat, data->u.eed_4.length + 1);
+      bit_chain_reserve (dat, data->u.eed_4.length + 1);
       bit_write_RC (dat, data->u.eed_4.length);
       bit_write_TF (dat, (BITCODE_TF)data->u.eed_4.data, data->u.eed_4.length);
       LOG_TRACE ("binary: ");
@@ -8499,7 +9073,7 @@ downconvert_MLEADERSTYLE (Dwg_Object *restrict obj)
       eedhdl = dwg_obj_generic_handlevalue (appid);
       LOG_TRACE ("Added APPID.ACAD_MLEADERVER (" FORMAT_HV ")\n", eedhdl);
     }
-  // obj may have moved, but dirty_refs is 0 (a dirty_objs is useless)
+  // obj may have moved, the refs were rebased
   obj = &dwg->object[oindex];
   if (obj->fixedtype != DWG_TYPE_MLEADERSTYLE || !obj->tio.object)
     {
@@ -8590,7 +9164,7 @@ downconvert_DIMSTYLE (Bit_Chain *restrict dat, Dwg_Object *restrict obj)
       eedhdl3 = dwg_obj_generic_handlevalue (appid);
       LOG_TRACE ("Added APPID.ACAD_DSTYLE_DIMTALN (" FORMAT_HV ")\n", eedhdl3);
     }
-  // obj may have moved, but dirty_refs is 0 (a dirty_objs is useless)
+  // obj may have moved, the refs were rebased
   obj = &dwg->object[oindex];
   if (obj->fixedtype != DWG_TYPE_DIMSTYLE || !obj->tio.object)
     {
@@ -34,18 +34,22 @@
 #include "free.h"
 #include "classes.h"
 #include "hash.h"
+#include "arena.h"
 #include "free.h"
 
 #ifdef USE_TRACING
-static int env_var_checked_p;
+static THREAD_LOCAL int env_var_checked_p;
 #endif
 #define DWG_LOGLEVEL loglevel
 #include "logging.h"
 
 /* the current version per spec block */
-static unsigned int cur_ver = 0;
-static Bit_Chain pdat = { 0 };
-static BITCODE_BL rcount1, rcount2;
+static THREAD_LOCAL unsigned int cur_ver = 0;
+static THREAD_LOCAL Bit_Chain pdat = { 0 };
+static THREAD_LOCAL BITCODE_BL rcount1, rcount2;
+
+// from dwg.c
+void dwg_free_table_index (Dwg_Data *restrict dwg);
 
 /*--------------------------------------------------------------------------------
  * MACROS
@@ -1716,6 +1720,7 @@ dwg_free (Dwg_Data *dwg)
       dwg_free_acds (dwg);
 
       FREE_IF (dwg->thumbnail.chain);
+      dwg_free_lazy_dat (dwg);
       FREE_IF (dwg->vbaproject.unknown_bits);
       FREE_IF (dwg->revhistory.histories);
       FREE_IF (dwg->appinfohistory.unknown_bits);
@@ -1741,7 +1746,14 @@ dwg_free (Dwg_Data *dwg)
             }
         }
       FREE_IF (dwg->dwg_class);
-      if (dwg->object_ref)
+      if (dwg->ref_pool)
+        {
+          LOG_HANDLE ("free %d global refs in %" PRIuSIZE " pool chunks\n",
+                      dwg->num_object_refs, dwg->ref_pool->num_chunks);
+          arena_free (dwg->ref_pool);
+          dwg->ref_pool = NULL;
+        }
+      else if (dwg->object_ref)
         {
           LOG_HANDLE ("free %d global refs\n", dwg->num_object_refs);
           for (i = 0; i < dwg->num_object_refs; ++i)
@@ -1765,6 +1777,7 @@ dwg_free (Dwg_Data *dwg)
       dwg->num_objects = dwg->num_classes = dwg->num_object_refs = 0;
       FREE_IF (dwg->object_ordered_ref);
       dwg->num_object_ordered_refs = 0;
+      dwg_free_table_index (dwg);
 #undef FREE_IF
     }
 }
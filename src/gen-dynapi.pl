@@ -926,6 +926,113 @@ sub is_table_control {
                      VPORT|APPID|DIMSTYLE|VX)_CONTROL$/x;
 }
 
+# the DXF index of the current fields array: [ dxf, field index ]
+my ( $field_index, @dxf_index, %num_dxf );
+
+# the types with a Dwg_DYNAPI_type code, all others are DWG_DT_OTHER
+my %DT = map { $_ => 1 } qw(B BB BT 4BITS RC RCd RS RSd BS BSd RL RLd RLx
+    BL BLd BLx RLL RLLd BLL RD BD 2RD 2BD 2BD_1 2DPOINT 3RD 3BD 3BD_1
+    3DPOINT BE CMC H T TV TU TF TFv TFF T16 T32 D2T TIMEBLL TIMERLL);
+
+# the field names of each fields array, and the [ name, fields array ] of
+# the dwg_name_types and dwg_list_subclasses rows, for the perfect hash
+my ( @field_names, %field_names, @name_types, @subclass_types );
+
+# the owners of the names, see DYNAPI_OWNER_* in the template. All others
+# are the dwg_name_types and dwg_list_subclasses indices of the fields.
+my %OWNER = (
+    NAMES      => 0xffff,
+    SUBCLASSES => 0xfffe,
+    HEADER     => 0xfffd,
+    ENTITY     => 0xfffc,
+    OBJECT     => 0xfffb,
+);
+
+# FNV-1a of the owner and the name, as _dynapi_hash () in the template
+sub dynapi_hash {
+    my ( $h, $owner, $key ) = @_;
+    $h = 2166136261 unless $h;
+    for my $c ( $owner & 0xff, $owner >> 8, unpack( "C*", $key ) ) {
+        $h = ( ( $h ^ $c ) * 16777619 ) & 0xffffffff;
+    }
+    return $h;
+}
+
+# hash and displace: a key in bucket b is in slot
+# dynapi_hash (disp[b], key) % n, or with a negative disp[b] in -disp[b]-1.
+# Returns the disp and the slots array refs.
+sub perfect_hash {
+    my @keys = @_;
+    my $n    = scalar @keys;
+    my ( @buckets, @disp, @slots );
+    for my $k (@keys) {
+        push @{ $buckets[ dynapi_hash( 0, $k->[0], $k->[1] ) % $n ] }, $k;
+    }
+
+    # the largest buckets first. the single ones just fill the free slots
+    my @order = sort {
+        scalar @{ $buckets[$b] || [] } <=> scalar @{ $buckets[$a] || [] }
+            or $a <=> $b
+    } 0 .. $n - 1;
+    my $free = 0;
+    for my $i (@order) {
+        my $bucket = $buckets[$i];
+        last unless $bucket;
+        if ( @$bucket == 1 ) {
+            $free++ while defined $slots[$free];
+            $slots[$free] = $bucket->[0];
+            $disp[$i] = -$free - 1;
+            next;
+        }
+        for ( my $d = 1 ; ; $d++ ) {
+            my %used;
+            my @s = map { dynapi_hash( $d, $_->[0], $_->[1] ) % $n } @$bucket;
+            next if grep { defined $slots[$_] or $used{$_}++ } @s;
+            $slots[ $s[$_] ] = $bucket->[$_] for 0 .. $#s;
+            $disp[$i] = $d;
+            last;
+        }
+    }
+    return ( [ map { $disp[$_] || 0 } 0 .. $n - 1 ], \@slots );
+}
+
+sub out_perfect_hash {
+    my $fh = shift;
+    my ( @keys, %seen );
+    my $add = sub {
+        my ( $owner, $names ) = @_;
+        my $i = 0;
+        for ( @{ $names || [] } ) {
+            push @keys, [ $owner, $_, $i ] unless $seen{"$owner,$_"}++;
+            $i++;
+        }
+    };
+    $add->( $OWNER{NAMES},      [ map { $_->[0] } @name_types ] );
+    $add->( $OWNER{SUBCLASSES}, [ map { $_->[0] } @subclass_types ] );
+    my $owner = 0;
+    for ( @name_types, @subclass_types ) {
+        $add->( $owner++, $field_names{ $_->[1] } );
+    }
+    $add->( $OWNER{HEADER}, $field_names{_dwg_header_variables} );
+    $add->( $OWNER{ENTITY}, $field_names{_dwg_object_entity} );
+    $add->( $OWNER{OBJECT}, $field_names{_dwg_object_object} );
+
+    my ( $disp, $slots ) = perfect_hash(@keys);
+    print $fh "static const int dwg_dynapi_hash_disp[] = {\n";
+    my @disp = @$disp;
+    while ( my @line = splice( @disp, 0, 10 ) ) {
+        print $fh "  ", join( ", ", @line ), ",\n";
+    }
+    print $fh "};\n";
+    print $fh "static const struct _dynapi_hash dwg_dynapi_hash[] = {\n";
+    my @slots = @$slots;
+    while ( my @line = splice( @slots, 0, 6 ) ) {
+        print $fh "  ", join( ", ", map {"{ $_->[0], $_->[2] }"} @line ),
+            ",\n";
+    }
+    print $fh "};";
+}
+
 sub out_declarator {
     my ( $d, $tmpl, $key, $prefix ) = @_;
     my $n  = "_dwg_$key" unless $key =~ /^_dwg_/;
@@ -1060,8 +1167,10 @@ sub out_declarator {
         = ( $is_malloc and $type =~ /^(T[UV]?|D2T)$/ )
         ? 1
         : 0;    # not TF or TFF
-    my $sname = $name;
+    my $sname    = $name;
+    my $is_float = ( $type eq 'BD' or $type eq 'RD' ) ? 1 : 0;
     if ( $name =~ /\[(\d+)\]$/ ) {
+        $is_float  = 0 if $1 != 1;
         $is_malloc = 0;
         $size      = "$1 * $size";
         $sname =~ s/\[(\d+)\]$//;
@@ -1083,10 +1192,32 @@ sub out_declarator {
         or ( $name eq 'parent' )
         or ( $key eq 'header_variables' and $name eq lc($name) );
 
+    # the type code without the vector *, and the flags
+    my $is_vector = ( $type =~ /^[^ *]+\*$/ and $type !~ /^struct/ ) ? 1 : 0;
+    my $base = $type;
+    $base =~ s/\*$// if $is_vector;
+    my $dtype     = exists $DT{$base} ? "DWG_DT_$base" : "DWG_DT_OTHER";
+    my $is_handle = $base eq 'H' ? 1 : 0;
+    my $is_angle  = ( $dxf >= 50 and $dxf < 60 ) ? 1 : 0;
+
     printf $fh
-        "  { \"%s\",\t\"%s\", %s,  OFF (%s, %s),\n    %d,%d,%d, %d },\n",
+        "  { \"%s\",\t\"%s\", %s,  OFF (%s, %s),\n    %d,%d,%d, %d, %s, %d,%d,%d,%d },\n",
         $name, $type, $size, $tmpl, $sname, $is_indirect, $is_malloc,
-        $is_string, $dxf;
+        $is_string, $dxf, $dtype, $is_vector, $is_handle, $is_float,
+        $is_angle;
+    push @field_names, $name;
+
+    # also the codes of the point .y and .z values, and the CMC true color,
+    # color name and alpha codes, as matched by the DXF importer
+    push @dxf_index, [ $dxf, $field_index ] if $dxf;
+    if ( $type eq 'CMC' ) {
+        push @dxf_index, map { [ $dxf + $_, $field_index ] } ( 358, 368, 378 );
+    }
+    elsif ( $dxf and ( $type =~ /^[23]/ or $type eq 'BE' ) ) {
+        push @dxf_index, map { [ $dxf + $_, $field_index ] }
+            ( $type =~ /_1/ ? ( 1, 2 ) : ( 10, 20 ) );
+    }
+    $field_index++;
 
     print $doc "\@item $name\n$type", $dxf ? ",\tDXF $dxf" : "", "\n";
 }
@@ -1162,11 +1293,28 @@ sub out_struct {
     print $doc "\@vtable \@code\n\n";
     print $fh "/* from typedef $tmpl: (sorted by $sortedby) */\n",
         "static const Dwg_DYNAPI_field $n", "_fields[] = {\n";
+    $field_index = 0;
+    @dxf_index   = ();
+    @field_names = ();
     for my $d (@declarations) {
         out_declarator( $d, $tmpl, $key );
     }
-    print $fh "  {NULL,\tNULL,\t0,\t0,\t0,0,0, 0},\n";
+    $field_names{$n} = [@field_names];
+    print $fh "  {NULL,\tNULL,\t0,\t0,\t0,0,0, 0, 0, 0,0,0,0},\n";
     print $fh "};\n";
+    if ( $n ne '_dwg_header_variables' ) {
+        my %seen;
+        my @index = grep { !$seen{"$_->[0],$_->[1]"}++ }
+            sort { $a->[0] <=> $b->[0] or $a->[1] <=> $b->[1] } @dxf_index;
+        $num_dxf{$n} = scalar @index;
+        print $fh "static const Dwg_DYNAPI_dxf $n", "_dxf[] = {\n";
+        while ( my @line = splice( @index, 0, 8 ) ) {
+            print $fh "  ", join( ", ", map {"{ $_->[0], $_->[1] }"} @line ),
+                ",\n";
+        }
+        print $fh "  { 0, 0 }\n";
+        print $fh "};\n";
+    }
     print $doc "\n\@end vtable\n";
     print $doc "\@end indentedblock\n\n";
 }
@@ -1332,9 +1480,17 @@ for (<DATA>) {
                             = "sizeof (struct _dwg_entity_PROXY_LWPOLYLINE)";
                     }
                     $DWG_TYPE{$k} = $vs;
+                    my ( $dxf, $num_dxf ) = ( "NULL", 0 );
+                    if ( $fields ne "NULL" ) {
+                        ( $dxf = $fields ) =~ s/_fields$/_dxf/;
+                        ( my $n = $fields ) =~ s/_fields$//;
+                        $num_dxf = $num_dxf{$n} || 0;
+                    }
+                    ( my $fn = $fields ) =~ s/_fields$//;
+                    push @name_types, [ $k, $fn ];
                     printf $fh
-                        "  { \"%s\", %s /*(%d)*/, %s, %s },\t/* %d */\n",
-                        $k, $vs, $v, $fields, $size, $i++;
+                        "  { \"%s\", %s /*(%d)*/, %s, %s, %s, %d },\t/* %d */\n",
+                        $k, $vs, $v, $fields, $size, $dxf, $num_dxf, $i++;
                 }
                 else {
                     printf $fh "  { \"%s\", %d },\t/* %d */\n", $k, $v, $i++;
@@ -1379,11 +1535,16 @@ for (<DATA>) {
                             $subclass = "NULL";
                         }
                         printf $fh
-                            "  { \"%s\", %s, %s, %s, %s },\t/* %d */\n",
-                            $n, $type, $subclass, $_ . "_fields", $size, $i++;
+                            "  { \"%s\", %s, %s, %s, %s, %s, %d },\t/* %d */\n",
+                            $n, $type, $subclass, $_ . "_fields", $size,
+                            $_ . "_dxf", $num_dxf{$_}, $i++;
+                        push @subclass_types, [ $n, $_ ];
                     }
                 }
             }
+            elsif ( $n eq 'perfect_hash' ) {
+                out_perfect_hash($fh);
+            }
             elsif ( $n eq 'name_subclasses' ) {
 
                 #print Dumper \%SUBCLASSES;
@@ -2964,6 +3125,9 @@ __DATA__
 Dwg_Object *dwg_obj_generic_to_object (const void *restrict obj,
                                        int *restrict error);
 #endif
+// from dwg.c
+void dwg_table_index_rename (Dwg_Data *restrict dwg,
+                             const Dwg_Object *restrict obj);
 
 @@struct _dwg_header_variables@@
 @@for dwg_entity_ENTITY@@
@@ -2980,6 +3144,8 @@ struct _name_type_fields {
   const enum DWG_OBJECT_TYPE type;
   const Dwg_DYNAPI_field *const fields;
   const int size;
+  const Dwg_DYNAPI_dxf *const dxf;
+  const unsigned num_dxf;
 };
 
 struct _name_subclass_fields {
@@ -2988,6 +3154,8 @@ struct _name_subclass_fields {
   const char *const subclass;
   const Dwg_DYNAPI_field *const fields;
   const int size;
+  const Dwg_DYNAPI_dxf *const dxf;
+  const unsigned num_dxf;
 };
 
 /* Generated fields for all the objects, sorted for bsearch. from enum DWG_OBJECT_TYPE.
@@ -3013,6 +3181,15 @@ static const struct _name_subclasses dwg_name_subclasses[] = {
 @@list name_subclasses@@
 };
 
+/* Generated perfect hash of all the entity, subclass and field names.
+   The names of each owner, see DYNAPI_OWNER_*, are in its dwg_dynapi_hash
+   slot with their index. */
+struct _dynapi_hash {
+  const unsigned short owner;
+  const unsigned short index;
+};
+@@list perfect_hash@@
+
 #line 2978 "gen-dynapi.pl"
 struct _name
 {
@@ -3029,6 +3206,43 @@ _name_struct_cmp (const void *restrict key, const void *restrict elem)
 
 #define NUM_NAME_TYPES  ARRAY_SIZE(dwg_name_types)
 #define NUM_SUBCLASSES  ARRAY_SIZE(dwg_list_subclasses)
+#define NUM_DYNAPI_HASH ARRAY_SIZE(dwg_dynapi_hash)
+
+/* The owners of the names in the perfect hash. The fields of
+   dwg_name_types[i] are owned by i, of dwg_list_subclasses[i] by
+   NUM_NAME_TYPES + i. */
+#define DYNAPI_OWNER_NAMES      0xffff
+#define DYNAPI_OWNER_SUBCLASSES 0xfffe
+#define DYNAPI_OWNER_HEADER     0xfffd
+#define DYNAPI_OWNER_ENTITY     0xfffc
+#define DYNAPI_OWNER_OBJECT     0xfffb
+
+// FNV-1a of the owner and the name, as dynapi_hash() in gen-dynapi.pl
+static uint32_t
+_dynapi_hash (uint32_t h, const unsigned owner, const char *restrict key)
+{
+  if (!h)
+    h = 2166136261U;
+  h = (h ^ (owner & 0xff)) * 16777619U;
+  h = (h ^ (owner >> 8)) * 16777619U;
+  for (; *key; key++)
+    h = (h ^ (unsigned char)*key) * 16777619U;
+  return h;
+}
+
+/* The index of the only name of this owner which may be key, or -1.
+   The caller must still compare the name. */
+static int
+_dynapi_hash_find (const unsigned owner, const char *restrict key)
+{
+  const int d = dwg_dynapi_hash_disp[_dynapi_hash (0, owner, key)
+                                     % NUM_DYNAPI_HASH];
+  const struct _dynapi_hash *h
+      = &dwg_dynapi_hash[d < 0 ? (uint32_t)(-d - 1)
+                               : _dynapi_hash ((uint32_t)d, owner, key)
+                                     % NUM_DYNAPI_HASH];
+  return h->owner == owner ? h->index : -1;
+}
 
 static
 const struct _name_type_fields*
@@ -3036,14 +3250,9 @@ const struct _name_type_fields*
 // FIXME: use type arg only
 _find_entity (const char *name)
 {
-  const char *p = (const char *)bsearch (name, dwg_name_types, NUM_NAME_TYPES,
-                           sizeof (dwg_name_types[0]),
-                           _name_struct_cmp);
-  if (p)
-    {
-      const ptrdiff_t i = (p - (char *)dwg_name_types) / sizeof (dwg_name_types[0]);
-      return &dwg_name_types[i];
-    }
+  const int i = _dynapi_hash_find (DYNAPI_OWNER_NAMES, name);
+  if (i >= 0 && strEQ (dwg_name_types[i].name, name))
+    return &dwg_name_types[i];
   else
     return NULL;
 }
@@ -3053,14 +3262,20 @@ const struct _name_subclass_fields*
  __nonnull ((1))
 _find_subclass (const char *name)
 {
-  const char *p = (const char *)bsearch (name, dwg_list_subclasses, NUM_SUBCLASSES,
-                           sizeof (dwg_list_subclasses[0]),
-                           _name_struct_cmp);
-  if (p)
-    {
-      const ptrdiff_t i = (p - (char *)dwg_list_subclasses) / sizeof (dwg_list_subclasses[0]);
-      return &dwg_list_subclasses[i];
-    }
+  const int i = _dynapi_hash_find (DYNAPI_OWNER_SUBCLASSES, name);
+  if (i >= 0 && strEQ (dwg_list_subclasses[i].name, name))
+    return &dwg_list_subclasses[i];
+  else
+    return NULL;
+}
+
+static const Dwg_DYNAPI_field *
+_find_field (const Dwg_DYNAPI_field *restrict fields, const unsigned owner,
+             const char *restrict fieldname)
+{
+  const int i = fields ? _dynapi_hash_find (owner, fieldname) : -1;
+  if (i >= 0 && strEQ (fields[i].name, fieldname))
+    return &fields[i];
   else
     return NULL;
 }
@@ -3107,63 +3322,96 @@ dwg_dynapi_common_object_fields (void)
   return _dwg_object_object_fields;
 }
 
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_entity_dxf (const char *restrict name, unsigned *restrict num)
+{
+  const struct _name_type_fields *f = _find_entity (name);
+  *num = f ? f->num_dxf : 0;
+  return f ? f->dxf : NULL;
+}
+
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_subclass_dxf (const char *restrict name, unsigned *restrict num)
+{
+  const struct _name_subclass_fields *f = _find_subclass (name);
+  *num = f ? f->num_dxf : 0;
+  return f ? f->dxf : NULL;
+}
+
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_common_entity_dxf (unsigned *restrict num)
+{
+  *num = ARRAY_SIZE (_dwg_object_entity_dxf) - 1;
+  return _dwg_object_entity_dxf;
+}
+
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_common_object_dxf (unsigned *restrict num)
+{
+  *num = ARRAY_SIZE (_dwg_object_object_dxf) - 1;
+  return _dwg_object_object_dxf;
+}
+
+EXPORT const Dwg_DYNAPI_dxf *
+dwg_dynapi_dxf_find (const Dwg_DYNAPI_dxf *restrict index, const unsigned num,
+                     const int dxf, unsigned *restrict count)
+{
+  unsigned lo = 0, hi = num, i;
+  *count = 0;
+  if (!index)
+    return NULL;
+  /* the first entry >= dxf */
+  while (lo < hi)
+    {
+      const unsigned mid = lo + (hi - lo) / 2;
+      if (index[mid].dxf < dxf)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+  for (i = lo; i < num && index[i].dxf == dxf; i++)
+    ;
+  *count = i - lo;
+  return *count ? &index[lo] : NULL;
+}
+
 EXPORT const Dwg_DYNAPI_field *
 dwg_dynapi_entity_field (const char *restrict name, const char *restrict field)
 {
-  const Dwg_DYNAPI_field *fields = dwg_dynapi_entity_fields (name);
-  if (fields)
-    { /* linear search (unsorted) */
-      Dwg_DYNAPI_field *f = (Dwg_DYNAPI_field *)fields;
-      for (; f->name; f++)
-        {
-          if (strEQ (f->name, field))
-            return f;
-        }
-    }
-  return NULL;
+  const struct _name_type_fields *f = _find_entity (name);
+  return f ? _find_field (f->fields, (unsigned)(f - dwg_name_types), field)
+           : NULL;
 }
 
 EXPORT const Dwg_DYNAPI_field *
 dwg_dynapi_subclass_field (const char *restrict name, const char *restrict field)
 {
-  const Dwg_DYNAPI_field *fields = dwg_dynapi_subclass_fields (name);
-  if (fields)
-    { /* linear search (unsorted) */
-      Dwg_DYNAPI_field *f = (Dwg_DYNAPI_field *)fields;
-      for (; f->name; f++)
-        {
-          if (strEQ (f->name, field))
-            return f;
-        }
-    }
-  return NULL;
+  const struct _name_subclass_fields *f = _find_subclass (name);
+  return f ? _find_field (f->fields,
+                          NUM_NAME_TYPES + (unsigned)(f - dwg_list_subclasses),
+                          field)
+           : NULL;
 }
 
 EXPORT const Dwg_DYNAPI_field *
 dwg_dynapi_header_field (const char *restrict fieldname)
 {
-  return (Dwg_DYNAPI_field *)bsearch (
-              fieldname, _dwg_header_variables_fields,
-              ARRAY_SIZE (_dwg_header_variables_fields) - 1, /* NULL terminated */
-              sizeof (_dwg_header_variables_fields[0]), _name_struct_cmp);
+  return _find_field (_dwg_header_variables_fields, DYNAPI_OWNER_HEADER,
+                      fieldname);
 }
 
 EXPORT const Dwg_DYNAPI_field *
 dwg_dynapi_common_entity_field (const char *restrict fieldname)
 {
-  return (Dwg_DYNAPI_field *)bsearch (
-              fieldname, _dwg_object_entity_fields,
-              ARRAY_SIZE (_dwg_object_entity_fields) - 1, /* NULL terminated */
-              sizeof (_dwg_object_entity_fields[0]), _name_struct_cmp);
+  return _find_field (_dwg_object_entity_fields, DYNAPI_OWNER_ENTITY,
+                      fieldname);
 }
 
 EXPORT const Dwg_DYNAPI_field *
 dwg_dynapi_common_object_field (const char *restrict fieldname)
 {
-  return (Dwg_DYNAPI_field *)bsearch (
-              fieldname, _dwg_object_object_fields,
-              ARRAY_SIZE (_dwg_object_object_fields) - 1, /* NULL terminated */
-              sizeof (_dwg_object_object_fields[0]), _name_struct_cmp);
+  return _find_field (_dwg_object_object_fields, DYNAPI_OWNER_OBJECT,
+                      fieldname);
 }
 
 // search field by dxf
@@ -3280,7 +3528,7 @@ dwg_dynapi_entity_utf8text (void *restrict _obj, const char *restrict name,
       if (fp)
         memcpy (fp, f, sizeof (Dwg_DYNAPI_field));
 
-      if (is_tu && strNE (f->type, "TF")) /* not TF */
+      if (is_tu && f->dtype != DWG_DT_TF) /* not TF */
         {
           BITCODE_TU wstr = *(BITCODE_TU*)((char*)_obj + f->offset);
           char *utf8 = bit_convert_TU (wstr);
@@ -3347,7 +3595,7 @@ dwg_dynapi_header_utf8text (const Dwg_Data *restrict dwg,
       {
         const Dwg_Header_Variables *const _obj = &dwg->header_vars;
         const bool is_tu = IS_FROM_TU_DWG (dwg);
-        const bool is_fixed = strEQc (f->type, "TF");
+        const bool is_fixed = f->dtype == DWG_DT_TF;
 
         if (fp)
           memcpy (fp, f, sizeof (Dwg_DYNAPI_field));
@@ -3461,19 +3709,13 @@ dwg_dynapi_common_utf8text(void *restrict _obj, const char *restrict fieldname,
       {
         dwg = obj ? obj->parent : ((Dwg_Entity_UNKNOWN_ENT *)_obj)->parent->dwg;
         _obj = obj->tio.entity;
-        f = (Dwg_DYNAPI_field *)bsearch (
-            fieldname, _dwg_object_entity_fields,
-            ARRAY_SIZE (_dwg_object_entity_fields) - 1, /* NULL terminated */
-            sizeof (_dwg_object_entity_fields[0]), _name_struct_cmp);
+        f = (Dwg_DYNAPI_field *)dwg_dynapi_common_entity_field (fieldname);
       }
     else if (obj->supertype == DWG_SUPERTYPE_OBJECT)
       {
         dwg = obj ? obj->parent : ((Dwg_Object_UNKNOWN_OBJ *)_obj)->parent->dwg;
         _obj = obj->tio.object;
-        f = (Dwg_DYNAPI_field *)bsearch (
-            fieldname, _dwg_object_object_fields,
-            ARRAY_SIZE (_dwg_object_object_fields) - 1, /* NULL terminated */
-            sizeof (_dwg_object_object_fields[0]), _name_struct_cmp);
+        f = (Dwg_DYNAPI_field *)dwg_dynapi_common_object_field (fieldname);
       }
     else
       {
@@ -3489,7 +3731,7 @@ dwg_dynapi_common_utf8text(void *restrict _obj, const char *restrict fieldname,
         if (fp)
           memcpy (fp, f, sizeof(Dwg_DYNAPI_field));
 
-        if (is_tu && strNE (f->type, "TF")) /* not TF */
+        if (is_tu && f->dtype != DWG_DT_TF) /* not TF */
           {
             BITCODE_TU wstr = *(BITCODE_TU*)((char*)_obj + f->offset);
             char *utf8 = bit_convert_TU (wstr);
@@ -3532,7 +3774,7 @@ dynapi_set_helper (void *restrict old, const Dwg_DYNAPI_field *restrict f,
       if (!*(char**)value)
         memcpy (old, value, sizeof (char*));
       // fixed length (but not yet TF)
-      else if (strEQc (f->type, "TFv"))
+      else if (f->dtype == DWG_DT_TFv)
         {
           char *str = (char *)calloc (f->size + 1, 1);
           strncpy (str, *(char**)value, f->size);
@@ -3552,7 +3794,7 @@ dynapi_set_helper (void *restrict old, const Dwg_DYNAPI_field *restrict f,
           memcpy (old, &str, sizeof (char*)); // size of ptr
         }
       // or wide
-      else if (strNE (f->type, "TF") && (f->is_string && dwg_version >= R_2007))
+      else if (f->dtype != DWG_DT_TF && (f->is_string && dwg_version >= R_2007))
         {
           BITCODE_TU wstr;
           if (is_utf8)
@@ -3581,6 +3823,45 @@ dynapi_set_helper (void *restrict old, const Dwg_DYNAPI_field *restrict f,
     memcpy (old, value, f->size);
 }
 
+static void
+entity_set_field (const Dwg_Object *restrict obj, void *restrict _obj,
+                  const Dwg_DYNAPI_field *restrict f,
+                  const void *restrict value, const bool is_utf8)
+{
+  void *old;
+  const Dwg_Data *dwg
+    = obj ? obj->parent
+          : ((Dwg_Object_UNKNOWN_OBJ *)_obj)->parent->dwg;
+  const Dwg_Version_Type dwg_version = dwg ? dwg->header.version : R_INVALID;
+  // but there are some fixed-length malloced strings preR13
+  static const Dwg_DYNAPI_field r11_fixed_strings[] = {
+      { "font_file", "TFv", 64, OFF (struct _dwg_object_STYLE, font_file), 1,1,1, 3, DWG_DT_TFv, 0,0,0,0 },
+      { "bigfont_file", "TFv", 64, OFF (struct _dwg_object_STYLE, bigfont_file), 1,1,1, 4, DWG_DT_TFv, 0,0,0,0 },
+      { "description", "TFv", 48, OFF (struct _dwg_object_LTYPE, description), 1,1,1, 3, DWG_DT_TFv, 0,0,0,0 },
+      // STYLE has no description, and LTYPE no font_file's
+      { 0 }
+    };
+
+  if (obj && f->is_string && dwg->header.from_version < R_13b1 &&
+      (obj->fixedtype == DWG_TYPE_STYLE || obj->fixedtype == DWG_TYPE_LTYPE))
+    {
+      //find_name (fieldname, r11_fixed_strings))
+      for (Dwg_DYNAPI_field* f11 = (Dwg_DYNAPI_field*)&r11_fixed_strings[0]; f11->name; f11++)
+        {
+          if (strEQ (f->name, f11->name))
+            {
+              f = f11;
+              break;
+            }
+        }
+    }
+  old = &((char*)_obj)[f->offset];
+  dynapi_set_helper (old, f, dwg_version, value, is_utf8);
+  // the name index of its table is stale now
+  if (obj && dwg && strEQc (f->name, "name"))
+    dwg_table_index_rename ((Dwg_Data *)dwg, obj);
+}
+
 /* generic field setters */
 EXPORT bool
 dwg_dynapi_entity_set_value (void *restrict _obj, const char *restrict name,
@@ -3608,45 +3889,81 @@ dwg_dynapi_entity_set_value (void *restrict _obj, const char *restrict name,
         return false;
       }
     {
-      void *old;
       const Dwg_DYNAPI_field *f = dwg_dynapi_entity_field (name, fieldname);
-      const Dwg_Data *dwg
-        = obj ? obj->parent
-              : ((Dwg_Object_UNKNOWN_OBJ *)_obj)->parent->dwg;
-      const Dwg_Version_Type dwg_version = dwg ? dwg->header.version : R_INVALID;
-      // but there are some fixed-length malloced strings preR13
-      static const Dwg_DYNAPI_field r11_fixed_strings[] = {
-          { "font_file", "TFv", 64, OFF (struct _dwg_object_STYLE, font_file), 1,1,1, 3 },
-          { "bigfont_file", "TFv", 64, OFF (struct _dwg_object_STYLE, bigfont_file), 1,1,1, 4 },
-          { "description", "TFv", 48, OFF (struct _dwg_object_LTYPE, description), 1,1,1, 3 },
-          // STYLE has no description, and LTYPE no font_file's
-          { 0 }
-        };
-
       if (!f)
         {
           //const int loglevel = dwg ? dwg->opts & DWG_OPTS_LOGLEVEL : 0;
           LOG_ERROR ("%s: Invalid %s field %s", __FUNCTION__, name, fieldname);
           return false;
         }
-      if (obj && f->is_string && dwg->header.from_version < R_13b1 &&
-          (obj->fixedtype == DWG_TYPE_STYLE || obj->fixedtype == DWG_TYPE_LTYPE))
+      entity_set_field (obj, _obj, f, value, is_utf8);
+      return true;
+    }
+  }
+}
+
+static void
+header_set_field (Dwg_Data *restrict dwg, const Dwg_DYNAPI_field *restrict f,
+                  const void *restrict value, const bool is_utf8)
+{
+  void *old;
+  // there are no malloc'd fields in the HEADER, so no need to free().
+  const Dwg_Header_Variables *const _obj = &dwg->header_vars;
+  // but there are several fixed-length malloced strings preR13
+  static const Dwg_DYNAPI_field r11_fixed_strings[] = {
+    { "MENU", "TFv", 16, OFF (struct _dwg_header_variables, MENU), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "DIMBLK_T", "TFv", 33, OFF (struct _dwg_header_variables, DIMBLK_T), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "DIMBLK1_T", "TFv", 33, OFF (struct _dwg_header_variables, DIMBLK1_T), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "DIMBLK2_T", "TFv", 33, OFF (struct _dwg_header_variables, DIMBLK2_T), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "DIMPOST", "TFv", 16, OFF (struct _dwg_header_variables, DIMPOST), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "DIMAPOST", "TFv", 16, OFF (struct _dwg_header_variables, DIMAPOST), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "unknown_string", "TFv", 33, OFF (struct _dwg_header_variables, unknown_string), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "unit1_name", "TFv", 32, OFF (struct _dwg_header_variables, unit1_name), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "unit2_name", "TFv", 32, OFF (struct _dwg_header_variables, unit2_name), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "unit3_name", "TFv", 32, OFF (struct _dwg_header_variables, unit3_name), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { "unit4_name", "TFv", 32, OFF (struct _dwg_header_variables, unit4_name), 1,1,1, 1, DWG_DT_TFv, 0,0,0,0 },
+    { 0 }
+  };
+  if (f->is_string && dwg->header.from_version < R_13b1)
+    {
+      //find_name (fieldname, r11_fixed_strings))
+      for (Dwg_DYNAPI_field* f11 = (Dwg_DYNAPI_field*)&r11_fixed_strings[0]; f11->name; f11++)
         {
-          //find_name (fieldname, r11_fixed_strings))
-          for (Dwg_DYNAPI_field* f11 = (Dwg_DYNAPI_field*)&r11_fixed_strings[0]; f11->name; f11++)
+          if (strEQ (f->name, f11->name))
             {
-              if (strEQ (fieldname, f11->name))
-                {
-                  f = f11;
-                  break;
-                }
+              f = f11;
+              break;
             }
         }
-      old = &((char*)_obj)[f->offset];
-      dynapi_set_helper (old, f, dwg_version, value, is_utf8);
-      return true;
     }
-  }
+  old = &((char*)_obj)[f->offset];
+  dynapi_set_helper (old, f, dwg->header.version, value, is_utf8);
+
+  // Set also FLAGS
+  if (strEQc (f->name, "CELWEIGHT"))
+    {
+      dwg->header_vars.FLAGS &= ~0x1f; // delete old, and set new
+      dwg->header_vars.FLAGS |= dxf_revcvt_lweight (dwg->header_vars.CELWEIGHT);
+    }
+  else if (strEQc (f->name, "codepage"))
+    {
+      dwg->header.codepage = *(BITCODE_RS*)value;
+    }
+#define SET_HDR_FLAGS(var, bit, inverse)   \
+  else if (strEQc (f->name, #var))           \
+    {                                        \
+      if (dwg->header_vars.var && !inverse)  \
+        dwg->header_vars.FLAGS |= bit;       \
+      else                                   \
+        dwg->header_vars.FLAGS &= ~bit;      \
+    }
+  SET_HDR_FLAGS (ENDCAPS, 0x60, 0)
+  SET_HDR_FLAGS (JOINSTYLE, 0x180, 0)
+  SET_HDR_FLAGS (LWDISPLAY, 0x200, 1)
+  SET_HDR_FLAGS (XEDIT, 0x400, 1)
+  SET_HDR_FLAGS (EXTNAMES, 0x800, 0)
+  SET_HDR_FLAGS (PSTYLEMODE, 0x2000, 0)
+  SET_HDR_FLAGS (OLESTARTUP, 0x4000, 0)
 }
 
 EXPORT bool
@@ -3659,71 +3976,10 @@ dwg_dynapi_header_set_value (Dwg_Data *restrict dwg,
     return false;
 #endif
   {
-    Dwg_DYNAPI_field *f = (Dwg_DYNAPI_field *)bsearch (
-        fieldname, _dwg_header_variables_fields,
-        ARRAY_SIZE (_dwg_header_variables_fields) - 1, /* NULL terminated */
-        sizeof (_dwg_header_variables_fields[0]), _name_struct_cmp);
+    Dwg_DYNAPI_field *f = (Dwg_DYNAPI_field *)dwg_dynapi_header_field (fieldname);
     if (f)
       {
-        void *old;
-        // there are no malloc'd fields in the HEADER, so no need to free().
-        const Dwg_Header_Variables *const _obj = &dwg->header_vars;
-        // but there are several fixed-length malloced strings preR13
-        static const Dwg_DYNAPI_field r11_fixed_strings[] = {
-          { "MENU", "TFv", 16, OFF (struct _dwg_header_variables, MENU), 1,1,1, 1 },
-          { "DIMBLK_T", "TFv", 33, OFF (struct _dwg_header_variables, DIMBLK_T), 1,1,1, 1 },
-          { "DIMBLK1_T", "TFv", 33, OFF (struct _dwg_header_variables, DIMBLK1_T), 1,1,1, 1 },
-          { "DIMBLK2_T", "TFv", 33, OFF (struct _dwg_header_variables, DIMBLK2_T), 1,1,1, 1 },
-          { "DIMPOST", "TFv", 16, OFF (struct _dwg_header_variables, DIMPOST), 1,1,1, 1 },
-          { "DIMAPOST", "TFv", 16, OFF (struct _dwg_header_variables, DIMAPOST), 1,1,1, 1 },
-          { "unknown_string", "TFv", 33, OFF (struct _dwg_header_variables, unknown_string), 1,1,1, 1 },
-          { "unit1_name", "TFv", 32, OFF (struct _dwg_header_variables, unit1_name), 1,1,1, 1 },
-          { "unit2_name", "TFv", 32, OFF (struct _dwg_header_variables, unit2_name), 1,1,1, 1 },
-          { "unit3_name", "TFv", 32, OFF (struct _dwg_header_variables, unit3_name), 1,1,1, 1 },
-          { "unit4_name", "TFv", 32, OFF (struct _dwg_header_variables, unit4_name), 1,1,1, 1 },
-          { 0 }
-        };
-        if (f->is_string && dwg->header.from_version < R_13b1)
-          {
-            //find_name (fieldname, r11_fixed_strings))
-            for (Dwg_DYNAPI_field* f11 = (Dwg_DYNAPI_field*)&r11_fixed_strings[0]; f11->name; f11++)
-              {
-                if (strEQ (fieldname, f11->name))
-                  {
-                    f = f11;
-                    break;
-                  }
-              }
-          }
-        old = &((char*)_obj)[f->offset];
-        dynapi_set_helper (old, f, dwg->header.version, value, is_utf8);
-
-        // Set also FLAGS
-        if (strEQc (fieldname, "CELWEIGHT"))
-          {
-            dwg->header_vars.FLAGS &= ~0x1f; // delete old, and set new
-            dwg->header_vars.FLAGS |= dxf_revcvt_lweight (dwg->header_vars.CELWEIGHT);
-          }
-        else if (strEQc (fieldname, "codepage"))
-          {
-            dwg->header.codepage = *(BITCODE_RS*)value;
-          }
-#define SET_HDR_FLAGS(name, bit, inverse)          \
-        else if (strEQc (fieldname, #name))        \
-          {                                        \
-            if (dwg->header_vars.name && !inverse) \
-              dwg->header_vars.FLAGS |= bit;       \
-            else                                   \
-              dwg->header_vars.FLAGS &= ~bit;      \
-          }
-        SET_HDR_FLAGS (ENDCAPS, 0x60, 0)
-        SET_HDR_FLAGS (JOINSTYLE, 0x180, 0)
-        SET_HDR_FLAGS (LWDISPLAY, 0x200, 1)
-        SET_HDR_FLAGS (XEDIT, 0x400, 1)
-        SET_HDR_FLAGS (EXTNAMES, 0x800, 0)
-        SET_HDR_FLAGS (PSTYLEMODE, 0x2000, 0)
-        SET_HDR_FLAGS (OLESTARTUP, 0x4000, 0)
-
+        header_set_field (dwg, f, value, is_utf8);
         return true;
       }
     else
@@ -3735,6 +3991,52 @@ dwg_dynapi_header_set_value (Dwg_Data *restrict dwg,
   }
 }
 
+static void
+common_set_field (Dwg_Data *restrict dwg, const Dwg_Object *restrict obj,
+                  void *restrict _obj, const Dwg_DYNAPI_field *restrict f,
+                  const void *restrict value, const bool is_utf8)
+{
+  void *old = &((char*)_obj)[f->offset];
+  if (f->dxf == 160 && strEQc (f->name, "preview_size"))
+    {
+      int size = f->size;
+      if (dwg && dwg->header.version < R_2010)
+        size = 4;
+      memcpy (old, value, size);
+    }
+  else
+    dynapi_set_helper (old, f, dwg ? dwg->header.version : R_INVALID, value, is_utf8);
+
+  if (dwg && obj->supertype == DWG_SUPERTYPE_ENTITY && strEQc (f->name, "ltype"))
+    { // set also isbylayerlt and ltype_flags
+      Dwg_Object_Entity *ent = obj->tio.entity;
+      if (!dwg->header_vars.LTYPE_BYLAYER || !ent->ltype)
+        ;
+      else if (ent->ltype->absolute_ref == dwg->header_vars.LTYPE_BYLAYER->absolute_ref)
+        {
+          ent->isbylayerlt = 1; // r13-r14 only
+          ent->ltype_flags = 0;
+        }
+      else if (dwg->header_vars.LTYPE_BYBLOCK
+               && ent->ltype->absolute_ref == dwg->header_vars.LTYPE_BYBLOCK->absolute_ref)
+        {
+          ent->isbylayerlt = 0;
+          ent->ltype_flags = 1;
+        }
+      else if (dwg->header_vars.LTYPE_CONTINUOUS
+               && ent->ltype->absolute_ref == dwg->header_vars.LTYPE_CONTINUOUS->absolute_ref)
+        {
+          ent->isbylayerlt = 0;
+          ent->ltype_flags = 2;
+        }
+      else
+        {
+          ent->isbylayerlt = 0;
+          ent->ltype_flags = 3;
+        }
+    }
+}
+
 EXPORT bool
 dwg_dynapi_common_set_value (void *restrict _obj,
                              const char *restrict fieldname,
@@ -3747,7 +4049,6 @@ dwg_dynapi_common_set_value (void *restrict _obj,
   {
     Dwg_DYNAPI_field *f;
     int error;
-    void *old;
     const Dwg_Object *obj = dwg_obj_generic_to_object (_obj, &error);
     Dwg_Data *dwg;
     if (!obj || error)
@@ -3760,18 +4061,12 @@ dwg_dynapi_common_set_value (void *restrict _obj,
     if (obj->supertype == DWG_SUPERTYPE_ENTITY)
       {
         _obj = obj->tio.entity;
-        f = (Dwg_DYNAPI_field *)bsearch (
-            fieldname, _dwg_object_entity_fields,
-            ARRAY_SIZE (_dwg_object_entity_fields) - 1, /* NULL terminated */
-            sizeof (_dwg_object_entity_fields[0]), _name_struct_cmp);
+        f = (Dwg_DYNAPI_field *)dwg_dynapi_common_entity_field (fieldname);
       }
     else if (obj->supertype == DWG_SUPERTYPE_OBJECT)
       {
         _obj = obj->tio.object;
-        f = (Dwg_DYNAPI_field *)bsearch (
-            fieldname, _dwg_object_object_fields,
-            ARRAY_SIZE (_dwg_object_object_fields) - 1, /* NULL terminated */
-            sizeof (_dwg_object_object_fields[0]), _name_struct_cmp);
+        f = (Dwg_DYNAPI_field *)dwg_dynapi_common_object_field (fieldname);
       }
     else
       {
@@ -3787,45 +4082,7 @@ dwg_dynapi_common_set_value (void *restrict _obj,
         return false;
       }
 
-    old = &((char*)_obj)[f->offset];
-    if (f->dxf == 160 && strEQc (fieldname, "preview_size"))
-      {
-        int size = f->size;
-        if (dwg && dwg->header.version < R_2010)
-          size = 4;
-        memcpy (old, value, size);
-      }
-    else
-      dynapi_set_helper (old, f, dwg ? dwg->header.version : R_INVALID, value, is_utf8);
-
-    if (dwg && obj->supertype == DWG_SUPERTYPE_ENTITY && strEQc (fieldname, "ltype"))
-      { // set also isbylayerlt and ltype_flags
-        Dwg_Object_Entity *ent = obj->tio.entity;
-        if (!dwg->header_vars.LTYPE_BYLAYER || !ent->ltype)
-          ;
-        else if (ent->ltype->absolute_ref == dwg->header_vars.LTYPE_BYLAYER->absolute_ref)
-          {
-            ent->isbylayerlt = 1; // r13-r14 only
-            ent->ltype_flags = 0;
-          }
-        else if (dwg->header_vars.LTYPE_BYBLOCK
-                 && ent->ltype->absolute_ref == dwg->header_vars.LTYPE_BYBLOCK->absolute_ref)
-          {
-            ent->isbylayerlt = 0;
-            ent->ltype_flags = 1;
-          }
-        else if (dwg->header_vars.LTYPE_CONTINUOUS
-                 && ent->ltype->absolute_ref == dwg->header_vars.LTYPE_CONTINUOUS->absolute_ref)
-          {
-            ent->isbylayerlt = 0;
-            ent->ltype_flags = 2;
-          }
-        else
-          {
-            ent->isbylayerlt = 0;
-            ent->ltype_flags = 3;
-          }
-      }
+    common_set_field (dwg, obj, _obj, f, value, is_utf8);
     return true;
   }
 }
@@ -3888,6 +4145,196 @@ dwg_dynapi_subclass_set_value (Dwg_Data *restrict dwg,
   return true;
 }
 
+/* field handles: resolve once, get and set without any name lookup */
+EXPORT bool
+dwg_dynapi_entity_fieldhandle (const char *restrict name,
+                               const char *restrict fieldname,
+                               Dwg_DYNAPI_fieldhandle *restrict handle)
+{
+  const struct _name_type_fields *f;
+#ifndef HAVE_NONNULL
+  if (!name || !fieldname || !handle)
+    return false;
+#endif
+  f = _find_entity (name);
+  handle->field = f ? _find_field (f->fields, (unsigned)(f - dwg_name_types),
+                                   fieldname)
+                    : NULL;
+  handle->type = f ? (int)f->type : 0;
+  handle->scope = DWG_DYNAPI_ENTITY;
+  return handle->field != NULL;
+}
+
+EXPORT bool
+dwg_dynapi_common_fieldhandle (const Dwg_Object_Supertype supertype,
+                               const char *restrict fieldname,
+                               Dwg_DYNAPI_fieldhandle *restrict handle)
+{
+#ifndef HAVE_NONNULL
+  if (!fieldname || !handle)
+    return false;
+#endif
+  if (supertype == DWG_SUPERTYPE_ENTITY)
+    handle->field = dwg_dynapi_common_entity_field (fieldname);
+  else if (supertype == DWG_SUPERTYPE_OBJECT)
+    handle->field = dwg_dynapi_common_object_field (fieldname);
+  else
+    handle->field = NULL;
+  handle->type = (int)supertype;
+  handle->scope = DWG_DYNAPI_COMMON;
+  return handle->field != NULL;
+}
+
+EXPORT bool
+dwg_dynapi_header_fieldhandle (const char *restrict fieldname,
+                               Dwg_DYNAPI_fieldhandle *restrict handle)
+{
+#ifndef HAVE_NONNULL
+  if (!fieldname || !handle)
+    return false;
+#endif
+  handle->field = dwg_dynapi_header_field (fieldname);
+  handle->type = 0;
+  handle->scope = DWG_DYNAPI_HEADER;
+  return handle->field != NULL;
+}
+
+EXPORT bool
+dwg_dynapi_subclass_fieldhandle (const char *restrict subclass,
+                                 const char *restrict fieldname,
+                                 Dwg_DYNAPI_fieldhandle *restrict handle)
+{
+  const Dwg_DYNAPI_field *f;
+#ifndef HAVE_NONNULL
+  if (!subclass || !fieldname || !handle)
+    return false;
+#endif
+  f = dwg_dynapi_subclass_field (subclass, fieldname);
+  // Dwg_Object_ASSOCDEPENDENCY is also a valid subclass, embedded into other objects
+  if (!f && memBEGINc (subclass, "Dwg_Object_"))
+    f = dwg_dynapi_entity_field (&subclass[strlen ("Dwg_Object_")], fieldname);
+  handle->field = f;
+  handle->type = 0;
+  handle->scope = DWG_DYNAPI_SUBCLASS;
+  return f != NULL;
+}
+
+EXPORT bool
+dwg_dynapi_fieldhandle_value (const void *restrict ptr,
+                              const Dwg_DYNAPI_fieldhandle *restrict handle,
+                              void *restrict out)
+{
+  const Dwg_DYNAPI_field *f;
+#ifndef HAVE_NONNULL
+  if (!ptr || !handle || !out)
+    return false;
+#endif
+  f = handle->field;
+  if (!f)
+    return false;
+  switch (handle->scope)
+    {
+    case DWG_DYNAPI_ENTITY:
+      memcpy (out, &((const char *)ptr)[f->offset],
+              f->is_malloc ? sizeof (char *) : f->size);
+      return true;
+    case DWG_DYNAPI_COMMON:
+      {
+        // the parent of the object specific struct is the common struct
+        const char *common = *(const char *const *)ptr;
+        int size = f->size;
+        if (!common)
+          return false;
+        if (f->dxf == 160 && strEQc (f->name, "preview_size"))
+          {
+            int error;
+            const Dwg_Object *obj = dwg_obj_generic_to_object (ptr, &error);
+            if (obj && obj->parent->header.version < R_2010)
+              size = 4;
+          }
+        memcpy (out, &common[f->offset], size);
+        return true;
+      }
+    case DWG_DYNAPI_HEADER:
+      {
+        const Dwg_Header_Variables *const _obj
+            = &((const Dwg_Data *)ptr)->header_vars;
+        memcpy (out, &((const char *)_obj)[f->offset], f->size);
+        return true;
+      }
+    case DWG_DYNAPI_SUBCLASS:
+      memcpy (out, &((const char *)ptr)[f->offset], f->size);
+      return true;
+    default:
+      return false;
+    }
+}
+
+EXPORT bool
+dwg_dynapi_fieldhandle_set_value (const Dwg_Data *dwg, void *restrict ptr,
+                                  const Dwg_DYNAPI_fieldhandle *restrict handle,
+                                  const void *restrict value,
+                                  const bool is_utf8)
+{
+  const Dwg_DYNAPI_field *f;
+#ifndef HAVE_NONNULL
+  if (!ptr || !handle || !value)
+    return false;
+#endif
+  f = handle->field;
+  if (!f)
+    return false;
+  switch (handle->scope)
+    {
+    case DWG_DYNAPI_ENTITY:
+      {
+        int error;
+        const Dwg_Object *obj = dwg_obj_generic_to_object (ptr, &error);
+        if (obj && (int)obj->fixedtype != handle->type)
+          {
+            LOG_ERROR ("%s: Invalid entity type %s for field %s",
+                       __FUNCTION__, obj->name, f->name);
+            return false;
+          }
+        entity_set_field (obj, ptr, f, value, is_utf8);
+        return true;
+      }
+    case DWG_DYNAPI_COMMON:
+      {
+        int error;
+        const Dwg_Object *obj = dwg_obj_generic_to_object (ptr, &error);
+        if (!obj || error || (int)obj->supertype != handle->type)
+          {
+            LOG_ERROR ("%s: Invalid object for common field %s",
+                       __FUNCTION__, f->name);
+            return false;
+          }
+        common_set_field (obj->parent, obj,
+                          obj->supertype == DWG_SUPERTYPE_ENTITY
+                              ? (void *)obj->tio.entity
+                              : (void *)obj->tio.object,
+                          f, value, is_utf8);
+        return true;
+      }
+    case DWG_DYNAPI_HEADER:
+      header_set_field ((Dwg_Data *)ptr, f, value, is_utf8);
+      return true;
+    case DWG_DYNAPI_SUBCLASS:
+      {
+        void *old = &((char *)ptr)[f->offset];
+        if (!dwg)
+          return false;
+        if (f->is_string)
+          dynapi_set_helper (old, f, dwg->header.version, value, is_utf8);
+        else
+          memcpy (old, value, f->size);
+        return true;
+      }
+    default:
+      return false;
+    }
+}
+
 // arbitrary structs, no text
 EXPORT bool
 dwg_dynapi_field_get_value (const void *restrict ptr,
@@ -3945,7 +4392,7 @@ dwg_dynapi_handle_name (const Dwg_Data *restrict dwg,
 
     if (!f || !f->is_string)
       return NULL;
-    if (is_tu && strNE (f->type, "TF")) /* not TF */
+    if (is_tu && f->dtype != DWG_DT_TF) /* not TF */
       {
         BITCODE_TU wstr = *(BITCODE_TU *)((char *)_obj + f->offset);
         *alloced = 1;
@@ -4089,12 +4536,7 @@ dwg_dynapi_is_angle (const char *restrict name, const char *restrict fieldname)
   if (!f1 && strEQc (name, "HEADER"))
     f1 = dwg_dynapi_header_field (fieldname);
   // there are no common angle fields
-  if (f1)
-    {
-      short dxf = f1->dxf;
-      return (dxf >= 50 && dxf < 60);
-    }
-  return false;
+  return f1 ? f1->is_angle : false;
 }
 
 EXPORT bool
@@ -4104,12 +4546,7 @@ dwg_dynapi_is_float (const Dwg_DYNAPI_field *f)
   if (!f)
     return false;
 #endif
-  if (f->size == 8 &&
-      (strEQc (f->type, "BD") ||
-       strEQc (f->type, "RD")))
-        return true;
-  else
-      return false;
+  return f->is_float;
 }
 
 /* Local Variables: */
@@ -1,7 +1,7 @@
 /*****************************************************************************/
 /*  LibreDWG - free implementation of the DWG file format                    */
 /*                                                                           */
-/*  Copyright (C) 2018-2019,2023 Free Software Foundation, Inc.              */
+/*  Copyright (C) 2018-2019,2023,2025 Free Software Foundation, Inc.         */
 /*                                                                           */
 /*  This library is free software, licensed under the terms of the GNU       */
 /*  General Public License as published by the Free Software Foundation,     */
@@ -12,7 +12,8 @@
 
 /*
  * hash.c: int hashmap for the object_ref map.
- *         uses linear probing for best cache usage.
+ *         a dense array for the small keys, and for the others
+ *         linear probing for best cache usage.
  *         values are inlined into the array. The 0 key is disallowed.
  * written by Reini Urban
  */
@@ -23,177 +24,190 @@
 #include <string.h>
 #include "logging.h"
 
+#define HASH_MIN_SIZE 16
+#define HASH_MIN_DENSE 1024
+
+// the next power of 2 >= n
+static uint64_t
+hash_pow2 (uint64_t n)
+{
+  uint64_t size = HASH_MIN_SIZE;
+  while (size < n)
+    size <<= 1U;
+  return size;
+}
+
 dwg_inthash *
 hash_new (uint64_t size)
 {
-  dwg_inthash *hash = (dwg_inthash *)malloc (sizeof (dwg_inthash));
-  uint64_t cap;
+  dwg_inthash *hash = (dwg_inthash *)calloc (1, sizeof (dwg_inthash));
   if (!hash)
     return NULL;
-  // multiply with load factor,
-  // and round size to next power of 2 (fast) or prime (secure),
-  if (size < 15)
-    size = 15;
-  cap = (uint64_t)(size * 100.0 / HASH_LOAD);
-  // this is slow, but only done once. clz would be much faster
-  while (size <= cap)
-    size <<= 1U;
-  hash->array = (struct _hashbucket *)calloc (
-      size, sizeof (struct _hashbucket)); // key+value pairs
-  hash->elems = 0;
-  hash->size = size;
+  // the expected number of handles, mostly dense
+  hash->dense_size = hash_pow2 (size < HASH_MIN_DENSE ? HASH_MIN_DENSE : size);
+  hash->dense = (uint64_t *)malloc (hash->dense_size * sizeof (uint64_t));
+  if (!hash->dense)
+    {
+      free (hash);
+      return NULL;
+    }
+  memset (hash->dense, 0xff, hash->dense_size * sizeof (uint64_t));
+  // the few sparse outliers
+  hash->size = HASH_MIN_SIZE;
+  hash->array = (struct _hashbucket *)calloc (hash->size,
+                                              sizeof (struct _hashbucket));
+  if (!hash->array)
+    {
+      free (hash->dense);
+      free (hash);
+      return NULL;
+    }
   return hash;
 }
 
-// if exceeds load factor
-static inline int
-hash_need_resize (dwg_inthash *hash)
+// found this gem by Thomas Mueller at stackoverflow. triviality threshold.
+// it's like a normal murmur or jenkins finalizer,
+// just statistically tested to be optimal.
+// 2023: changed to 64bit, checked at https://nullprogram.com/blog/2018/07/31/
+// Note that this is entirely "insecure", the inverse func is trivial.
+// We don't care as we deal with DWG and had linear search before.
+static inline uint64_t
+hash_func (uint64_t key)
 {
-  return (uint64_t)(hash->elems * 100.0 / HASH_LOAD) > hash->size;
+  key = ((key >> 32) ^ key) * UINT64_C (0xd6e8feb86659fd93);
+  key = ((key >> 32) ^ key) * UINT64_C (0xd6e8feb86659fd93);
+  key = (key >> 32) ^ key;
+  return key;
 }
 
+// into the hash table, which must have an empty slot
 static void
-hash_resize (dwg_inthash *hash)
+hash_put (dwg_inthash *hash, uint64_t key, uint64_t value)
 {
-  dwg_inthash oldhash = *hash;
-  uint64_t size = hash->size * 2;
-  uint64_t i;
+  const uint64_t mask = hash->size - 1;
+  uint64_t i = hash_func (key) & mask;
+  while (hash->array[i].key)
+    {
+      if (hash->array[i].key == key)
+        { // found
+          hash->array[i].value = value;
+          return;
+        }
+      i = (i + 1) & mask; // linear probing with wrap around
+    }
+  hash->array[i].key = key;
+  hash->array[i].value = value;
+  hash->elems++;
+}
 
-  // allocate key+value pairs afresh
+/* Rehash into size buckets, and move the keys now covered by the dense
+   array there. */
+static int
+hash_rehash (dwg_inthash *hash, uint64_t size)
+{
+  dwg_inthash oldhash = *hash;
   hash->array
       = (struct _hashbucket *)calloc (size, sizeof (struct _hashbucket));
   if (!hash->array)
     {
       *hash = oldhash;
-      return;
+      return 1;
     }
-  hash->elems = 0;
   hash->size = size;
-  memset (hash->array, 0, size * sizeof (struct _hashbucket));
-  // spread out the old elements in double space, less collisions
-  for (i = 0; i < oldhash.size; i++)
+  hash->elems = 0;
+  for (uint64_t i = 0; i < oldhash.size; i++)
     {
-      if (oldhash.array[i].key)
-        hash_set (hash, oldhash.array[i].key, oldhash.array[i].value);
+      const uint64_t key = oldhash.array[i].key;
+      if (!key)
+        continue;
+      if (key < hash->dense_size)
+        {
+          hash->dense[key] = oldhash.array[i].value;
+          hash->dense_elems++;
+        }
+      else
+        hash_put (hash, key, oldhash.array[i].value);
     }
   free (oldhash.array);
-  return;
+  return 0;
 }
 
-// found this gem by Thomas Mueller at stackoverflow. triviality threshold.
-// it's like a normal murmur or jenkins finalizer,
-// just statistically tested to be optimal.
-// 2023: changed to 64bit, checked at https://nullprogram.com/blog/2018/07/31/
-// Note that this is entirely "insecure", the inverse func is trivial.
-// We don't care as we deal with DWG and had linear search before.
-static inline uint64_t
-hash_func (uint64_t key)
+/* Grow the dense array to cover key, if it stays dense enough.
+   Handles are mostly ascending, so this happens only log n times. */
+static int
+hash_grow_dense (dwg_inthash *hash, uint64_t key)
 {
-  key = ((key >> 32) ^ key) * UINT64_C (0xd6e8feb86659fd93);
-  key = ((key >> 32) ^ key) * UINT64_C (0xd6e8feb86659fd93);
-  key = (key >> 32) ^ key;
-  return key;
+  const uint64_t elems = hash->elems + hash->dense_elems + 1;
+  uint64_t size = hash->dense_size, *dense;
+  if (key / HASH_DENSE_FACTOR > elems && key >= HASH_MIN_DENSE)
+    return 1;
+  while (size <= key)
+    size <<= 1U;
+  dense = (uint64_t *)realloc (hash->dense, size * sizeof (uint64_t));
+  if (!dense)
+    return 1;
+  memset (&dense[hash->dense_size], 0xff,
+          (size - hash->dense_size) * sizeof (uint64_t));
+  hash->dense = dense;
+  hash->dense_size = size;
+  // move the sparse keys which are now dense
+  if (hash->elems)
+    hash_rehash (hash, hash->size);
+  return 0;
 }
 
 // 0 is disallowed as key, even if there's no deletion.
 uint64_t
-hash_get (dwg_inthash *hash, uint64_t key)
+hash_get_sparse (dwg_inthash *hash, uint64_t key)
 {
-  uint64_t i = hash_func (key) % hash->size;
-  uint64_t j = i;
-  while (hash->array[i].key && hash->array[i].key != key)
+  const uint64_t mask = hash->size - 1;
+  uint64_t i;
+  if (!hash->elems)
+    return HASH_NOT_FOUND;
+  // the load factor guarantees an empty slot
+  for (i = hash_func (key) & mask; hash->array[i].key; i = (i + 1) & mask)
     {
-      // HANDLER (OUTPUT, "get collision at %d\n", i);
-      i++; // linear probing with wrap around
-      if (i == hash->size)
-        i = 0;
-      if (i == j) // not found
-        return HASH_NOT_FOUND;
+      if (hash->array[i].key == key)
+        return hash->array[i].value;
     }
-  if (hash->array[i].key)
-    return hash->array[i].value;
-  else
-    return HASH_NOT_FOUND;
+  return HASH_NOT_FOUND;
 }
 
 // search or insert. key 0 is forbidden.
 void
 hash_set (dwg_inthash *hash, uint64_t key, uint64_t value)
 {
-  uint64_t i = hash_func (key) % hash->size;
-  uint64_t j = i;
   if (key == 0)
     {
       HANDLER (OUTPUT, "forbidden 0 key\n");
       return;
     }
-  // empty slot
-  if (!hash->array[i].key)
+  if (key >= hash->dense_size && hash_get_sparse (hash, key) == HASH_NOT_FOUND)
+    hash_grow_dense (hash, key);
+  if (key < hash->dense_size)
     {
-      hash->array[i].key = key;
-      hash->array[i].value = value;
-      hash->elems++;
+      if (hash->dense[key] == HASH_NOT_FOUND)
+        hash->dense_elems++;
+      hash->dense[key] = value;
       return;
     }
-  while (hash->array[i].key)
-    {
-      if (hash->array[i].key == key)
-        { // found
-          hash->array[i].value = value;
-          return;
-        }
-      // HANDLER (OUTPUT, "set collision at %d\n", i);
-      i++; // linear probing with wrap around
-      if (i == hash->size)
-        i = 0;
-      if (i == j) // not found
-        {
-          // HANDLER (OUTPUT, "set not found at %d\n", i);
-          // if does not exist, add at i+1
-          if (hash_need_resize (hash))
-            {
-              // HANDLER (OUTPUT, "resize at %d\n", hash->size);
-              hash_resize (hash);
-              hash_set (hash, key, value);
-              return;
-            }
-          while (hash->array[i].key) // find next empty slot
-            {
-              // up to here we have no coverage!
-              // HANDLER (OUTPUT, "set 2nd collision at %d\n", i);
-              i++; // again linear probing with wrap around
-              if (i == hash->size)
-                i = 0;
-              if (i == j) // not found
-                {
-                  // HANDLER (OUTPUT, "not found resize at %d\n", hash->size);
-                  hash_resize (hash); // guarantees new empty slots
-                  hash_set (hash, key, value);
-                  return;
-                }
-              else
-                { // insert at empty slot
-                  hash->array[i].key = key;
-                  hash->array[i].value = value;
-                  hash->elems++;
-                  return;
-                }
-            }
-        }
-    }
-  // empty slot
-  hash->array[i].key = key;
-  hash->array[i].value = value;
-  hash->elems++;
-  return;
+  // if exceeds load factor, spread out in double space, less collisions
+  if ((hash->elems + 1) * 100 > hash->size * HASH_LOAD
+      && hash_rehash (hash, hash->size * 2))
+    return; // out of memory
+  hash_put (hash, key, value);
 }
 
 void
 hash_free (dwg_inthash *hash)
 {
   free (hash->array);
+  free (hash->dense);
   hash->array = NULL;
+  hash->dense = NULL;
   hash->size = 0;
   hash->elems = 0;
+  hash->dense_size = 0;
+  hash->dense_elems = 0;
   free (hash);
 }
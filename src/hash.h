@@ -16,7 +16,11 @@
 /*
  * hash.h: simple fast int hashmap for the object_ref map,
  *         mapping uint64_t to uint64_t.
- *         0 keys and values are disallowed even if there's no deletion.
+ *         0 keys are disallowed even if there's no deletion.
+ *         DWG handles are mostly dense and ascending, so the small keys
+ *         are kept in a directly indexed array, which grows with them as
+ *         long as it's dense enough. Only the outliers go into the hash
+ *         table, with a power of 2 size.
  * written by Reini Urban
  */
 
@@ -26,6 +30,8 @@
 
 #define HASH_LOAD 75 // in percent. recommended is 50
 #define HASH_NOT_FOUND (uint64_t) - 1
+// max. slots of the dense array per key, else the key goes to the hash
+#define HASH_DENSE_FACTOR 4
 
 struct _hashbucket
 {
@@ -35,13 +41,24 @@ struct _hashbucket
 typedef struct _inthash
 {
   struct _hashbucket *array; /* of key, value pairs */
-  uint64_t size;
-  uint64_t elems; // to get the fill rate
+  uint64_t size;             // a power of 2
+  uint64_t elems;            // to get the fill rate
+  uint64_t *dense;           // the values of the keys < dense_size
+  uint64_t dense_size;
+  uint64_t dense_elems;
 } dwg_inthash;
 
 dwg_inthash *hash_new (uint64_t size);
-uint64_t hash_get (dwg_inthash *hash, uint64_t key);
+uint64_t hash_get_sparse (dwg_inthash *hash, uint64_t key);
 void hash_set (dwg_inthash *hash, uint64_t key, uint64_t value);
 void hash_free (dwg_inthash *hash);
 
+static inline uint64_t
+hash_get (dwg_inthash *hash, uint64_t key)
+{
+  if (key < hash->dense_size)
+    return hash->dense[key];
+  return hash_get_sparse (hash, key);
+}
+
 #endif
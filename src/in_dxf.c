@@ -78,12 +78,12 @@ dwg_find_tablehandle_silent (Dwg_Data *restrict dwg, const char *restrict name,
                              const char *restrict table);
 
 /* the current version per spec block */
-static unsigned int cur_ver = 0;
-static char buf[4096];
-static long start, end; // stream offsets
-static array_hdls *header_hdls = NULL;
-static array_hdls *eed_hdls = NULL;
-static array_hdls *obj_hdls = NULL;
+static THREAD_LOCAL unsigned int cur_ver = 0;
+static THREAD_LOCAL char buf[4096];
+static THREAD_LOCAL long start, end; // stream offsets
+static THREAD_LOCAL array_hdls *header_hdls = NULL;
+static THREAD_LOCAL array_hdls *eed_hdls = NULL;
+static THREAD_LOCAL array_hdls *obj_hdls = NULL;
 
 // static long num_dxf_objs;  // how many elements are added
 // static long size_dxf_objs; // how many elements are allocated
@@ -434,7 +434,7 @@ dxf_skip_ws (Bit_Chain *dat)
         return (rettype)ret;                                                  \
       }                                                                       \
     errno = 0;                                                                \
-    num = strtol ((char *)&dat->chain[dat->byte], &endptr, 10);               \
+    num = dwg_strtol ((char *)&dat->chain[dat->byte], &endptr);               \
     if (endptr)                                                               \
       {                                                                       \
         if (endptr == (char *)&dat->chain[dat->byte])                         \
@@ -601,8 +601,8 @@ dxf_read_rd (Bit_Chain *dat)
           dat->byte = dat->size;
           return (double)NAN;
         }
-      else
-        num = strtod (str, &endptr);
+      errno = 0;
+      num = dwg_strtod (str, &endptr);
       if (endptr)
         dat->byte += endptr - str;
       if (errno == ERANGE)
@@ -611,15 +611,35 @@ dxf_read_rd (Bit_Chain *dat)
     }
 }
 
+// Grows the reused string buffer to at least size bytes.
+static int
+dxf_string_reserve (char **string, size_t *capacity, const size_t size)
+{
+  char *s;
+  if (*string && *capacity >= size)
+    return 1;
+  s = (char *)realloc (*string, size < 64 ? 64 : size);
+  if (!s)
+    {
+      LOG_ERROR ("Out of memory");
+      return 0;
+    }
+  *string = s;
+  *capacity = size < 64 ? 64 : size;
+  return 1;
+}
+
 // Target (dynapi) expects UTF8 strings.
 // Unicode strings are UTF-8 with quoted \\U+
 // Convert old asian MIF \\M+nxxxx to this \\U+XXXX repr. also.
-static void
-dxf_read_string (Bit_Chain *dat, char **string)
+// Reads into the *string buffer of *capacity bytes, which is kept and grown.
+// Returns 0 if no string was stored.
+static int
+dxf_read_string (Bit_Chain *dat, char **string, size_t *capacity)
 {
   const int is_binary = dat->opts & DWG_OPTS_DXFB;
   if (dat->byte >= dat->size)
-    return;
+    return 0;
   if (is_binary)
     {
 #  if 1
@@ -632,14 +652,9 @@ dxf_read_string (Bit_Chain *dat, char **string)
         }
       else
         {
-          *string = !*string ? (char *)malloc (size)
-                             : (char *)realloc (*string, size);
-          if (!*string)
-            {
-              LOG_ERROR ("Out of memory");
-              return;
-            }
-          strcpy (*string, (char *)&dat->chain[dat->byte]);
+          if (!dxf_string_reserve (string, capacity, size))
+            return 0;
+          memcpy (*string, &dat->chain[dat->byte], size);
         }
       dat->byte += size;
 #  else
@@ -652,15 +667,15 @@ dxf_read_string (Bit_Chain *dat, char **string)
       if (!string)
         {
           if (size > 4096)
-            return;
-          return; // ignore, just advanced dat
+            return 0;
+          return 0; // ignore, just advanced dat
         }
       *string
           = !*string ? (char *)malloc (size) : (char *)realloc (*string, size);
       if (!*string)
         {
           LOG_ERROR ("Out of memory");
-          return;
+          return 0;
         }
       strcpy (*string, buf);
 #  endif
@@ -668,6 +683,7 @@ dxf_read_string (Bit_Chain *dat, char **string)
   else
     {
       int i;
+      size_t len;
       // Do not skip leading whitespace here: dxf_read_rs already consumed the
       // group-code line incl. its newline, so we are positioned at the start
       // of the value line, and leading spaces in a string value are
@@ -675,7 +691,7 @@ dxf_read_string (Bit_Chain *dat, char **string)
       // space).
       if (dat->byte >= dat->size
           || !memchr (&dat->chain[dat->byte], '\n', dat->size - dat->byte))
-        return;
+        return 0;
       for (i = 0;
            dat->byte < dat->size && dat->chain[dat->byte] != '\n' && i < 4096;
            dat->byte++)
@@ -720,7 +736,7 @@ dxf_read_string (Bit_Chain *dat, char **string)
             buf[i++] = *s;
         }
       if (dat->byte >= dat->size || i >= 4096)
-        return;
+        return 0;
       if (i && buf[i - 1] == '\r')
         buf[i - 1] = '\0';
       else
@@ -729,18 +745,13 @@ dxf_read_string (Bit_Chain *dat, char **string)
 
       // dxf_skip_ws (dat);
       if (!string)
-        return; // ignore, just advanced dat
-      if (!*string)
-        *string = (char *)malloc (strlen (buf) + 1);
-      else
-        *string = (char *)realloc (*string, strlen (buf) + 1);
-      if (!*string)
-        {
-          LOG_ERROR ("Out of memory");
-          return;
-        }
-      strcpy (*string, buf);
+        return 0; // ignore, just advanced dat
+      len = strlen (buf);
+      if (!dxf_string_reserve (string, capacity, len + 1))
+        return 0;
+      memcpy (*string, buf, len + 1);
     }
+  return 1;
 }
 
 // read dat into string.
@@ -826,37 +837,63 @@ dxf_read_binary (Bit_Chain *dat, char **string, BITCODE_BL *len)
     }
 }
 
+/* The freed pairs are kept for the next dxf_read_pair, with their string
+   buffers, so that the tokenizer does not allocate per pair. */
+#  define DXF_PAIR_POOL 8
+static THREAD_LOCAL Dxf_Pair *pair_pool[DXF_PAIR_POOL];
+static THREAD_LOCAL unsigned num_pooled = 0;
+
 static void
 dxf_free_pair (Dxf_Pair *pair)
 {
   if (!pair)
     return;
-  if (pair->type == DWG_VT_STRING || pair->type == DWG_VT_BINARY)
-    {
-      free (pair->value.s.ptr);
-      pair->value.s.ptr = NULL;
+  if ((pair->type == DWG_VT_STRING || pair->type == DWG_VT_BINARY
+       || pair->code == 0 || pair->code == 2)
+      && pair->value.s.ptr != pair->strbuf)
+    free (pair->value.s.ptr);
+  pair->value.s.ptr = NULL;
+  if (num_pooled < DXF_PAIR_POOL)
+    {
+      pair_pool[num_pooled++] = pair;
+      return;
     }
-  else if (pair->code == 0 || pair->code == 2)
+  free (pair->strbuf);
+  free (pair);
+}
+
+static void
+dxf_free_pair_pool (void)
+{
+  while (num_pooled)
     {
-      free (pair->value.s.ptr);
-      pair->value.s.ptr = NULL;
+      Dxf_Pair *pair = pair_pool[--num_pooled];
+      free (pair->strbuf);
+      free (pair);
     }
-  free (pair);
-  pair = NULL;
 }
 
-static Dxf_Pair *ATTRIBUTE_MALLOC
+static Dxf_Pair *
 dxf_read_pair (Bit_Chain *dat)
 {
-  Dxf_Pair *pair = (Dxf_Pair *)xcalloc (1, sizeof (Dxf_Pair));
+  Dxf_Pair *pair;
   const int is_binary = dat->opts & DWG_OPTS_DXFB;
+  if (num_pooled)
+    {
+      pair = pair_pool[--num_pooled];
+      pair->code = 0;
+      pair->type = DWG_VT_INVALID;
+      memset (&pair->value, 0, sizeof (pair->value));
+    }
+  else
+    pair = (Dxf_Pair *)xcalloc (1, sizeof (Dxf_Pair));
   if (!pair)
     return NULL;
   if (dat->size - dat->byte < 6) // at least 0\nEOF\n
     {
     err:
       LOG_ERROR ("Unexpected DXF end-of-file");
-      free (pair);
+      dxf_free_pair (pair);
       return NULL;
     }
   if (is_binary)
@@ -878,9 +915,14 @@ dxf_read_pair (Bit_Chain *dat)
   switch (pair->type)
     {
     case DWG_VT_STRING:
-      dxf_read_string (dat, &pair->value.s.ptr);
-      if (!pair->value.s.ptr && pair->code != 0)
-        pair->value.s.ptr = (char *)calloc (1, 1);
+      if (dxf_read_string (dat, &pair->strbuf, &pair->strbuf_size))
+        pair->value.s.ptr = pair->strbuf;
+      else if (pair->code != 0
+               && dxf_string_reserve (&pair->strbuf, &pair->strbuf_size, 1))
+        {
+          *pair->strbuf = '\0';
+          pair->value.s.ptr = pair->strbuf;
+        }
       if (!pair->value.s.ptr)
         {
           LOG_ERROR ("Out of memory");
@@ -899,13 +941,11 @@ dxf_read_pair (Bit_Chain *dat)
           // space and every entity unreachable.
           if (!strcasecmp (pair->value.s.ptr + 1, "MODEL_SPACE"))
             {
-              free (pair->value.s.ptr);
-              pair->value.s.ptr = strdup ("*Model_Space");
+              memcpy (pair->value.s.ptr, "*Model_Space", 12); // same size
             }
           else if (!strcasecmp (pair->value.s.ptr + 1, "PAPER_SPACE"))
             {
-              free (pair->value.s.ptr);
-              pair->value.s.ptr = strdup ("*Paper_Space");
+              memcpy (pair->value.s.ptr, "*Paper_Space", 12); // same size
             }
         }
       break;
@@ -959,7 +999,7 @@ dxf_read_pair (Bit_Chain *dat)
     case DWG_VT_HANDLE:
     case DWG_VT_OBJECTID:
       // BINARY: hex string without len
-      dxf_read_string (dat, NULL);
+      dxf_read_string (dat, NULL, NULL);
       sscanf (buf, "%X", &pair->value.u);
       LOG_TRACE ("  dxf (%d, %X)\n", (int)pair->code, pair->value.u);
       break;
@@ -1110,62 +1150,73 @@ matches_type (Dxf_Pair *restrict pair, const Dwg_DYNAPI_field *restrict f)
   switch (pair->type)
     {
     case DWG_VT_STRING:
-      if (f->is_string)
-        return 1;
-      if (f->type[0] == 'H')
-        return 1; // handles can be just names
-      break;
+      // handles can be just names
+      return f->is_string || f->is_handle;
     case DWG_VT_INT64:
-      // BLL or RLL
-      if (f->size == 8 && f->type[1] == 'L' && f->type[2] == 'L')
-        return 1;
-      // fall through
     case DWG_VT_INT32:
-      // BL or RL
-      if (f->size == 4 && f->type[1] == 'L')
-        return 1;
-      // fall through
     case DWG_VT_INT16:
-      // BS or RS or CMC
-      if (f->size == 2 && f->type[1] == 'S')
-        return 1;
-      if (strEQc (f->type, "CMC"))
-        return 1;
-      if (strEQc (f->type, "BSd"))
-        return 1;
-      // fall through
     case DWG_VT_INT8:
-      if (strEQc (f->type, "RC"))
-        return 1;
-      // fall through
     case DWG_VT_BOOL:
-      if (strEQc (f->type, "B"))
-        return 1;
-      break;
+      // the smaller types also match
+      switch (f->dtype)
+        {
+        case DWG_DT_BLL:
+        case DWG_DT_RLL:
+        case DWG_DT_RLLd:
+          return f->size == 8 && pair->type == DWG_VT_INT64;
+        case DWG_DT_BL:
+        case DWG_DT_BLd:
+        case DWG_DT_BLx:
+        case DWG_DT_RL:
+        case DWG_DT_RLd:
+        case DWG_DT_RLx:
+          return f->size == 4
+                 && (pair->type == DWG_VT_INT64
+                     || pair->type == DWG_VT_INT32);
+        case DWG_DT_BS:
+        case DWG_DT_RS:
+        case DWG_DT_RSd:
+          return f->size == 2 && pair->type != DWG_VT_INT8
+                 && pair->type != DWG_VT_BOOL;
+        case DWG_DT_BSd:
+        case DWG_DT_CMC:
+          return !f->is_vector && pair->type != DWG_VT_INT8
+                 && pair->type != DWG_VT_BOOL;
+        case DWG_DT_RC:
+          return !f->is_vector && pair->type != DWG_VT_BOOL;
+        case DWG_DT_B:
+          return !f->is_vector;
+        default:
+          return 0;
+        }
     case DWG_VT_REAL:
       // BD or RD
-      if (f->size == 8 && f->type[1] == 'D')
+      if (f->size == 8 && (f->dtype == DWG_DT_BD || f->dtype == DWG_DT_RD))
         return 1;
-      if (strEQc (f->type, "TIMEBLL"))
-        return 1;
-      break;
+      return f->dtype == DWG_DT_TIMEBLL;
     case DWG_VT_POINT3D:
-      // 3BD or 3RD or 3DPOINT or BE
-      if (f->size == 24 && (f->type[0] == '3' || strEQc (f->type, "BE")))
-        return 1;
-      // accept 2BD or 2RD or 2DPOINT also
-      if (f->size == 16 && f->type[0] == '2')
-        return 1;
-      break;
+      switch (f->dtype)
+        {
+        case DWG_DT_3BD:
+        case DWG_DT_3BD_1:
+        case DWG_DT_3RD:
+        case DWG_DT_3DPOINT:
+        case DWG_DT_BE:
+          return f->size == 24;
+        // accept 2BD or 2RD or 2DPOINT also
+        case DWG_DT_2BD:
+        case DWG_DT_2BD_1:
+        case DWG_DT_2RD:
+        case DWG_DT_2DPOINT:
+          return f->size == 16;
+        default:
+          return 0;
+        }
     case DWG_VT_BINARY:
-      if (f->is_string)
-        return 1;
-      break;
+      return f->is_string;
     case DWG_VT_HANDLE:
     case DWG_VT_OBJECTID:
-      if (f->type[0] == 'H')
-        return 1;
-      break;
+      return f->is_handle;
     case DWG_VT_INVALID:
     default:
       LOG_ERROR ("Invalid DXF group code: %d", pair->code);
@@ -1571,7 +1622,8 @@ dxf_header_read (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
                   i++;
                 }
             }
-          else if (pair->type == DWG_VT_STRING && strEQc (f->type, "H"))
+          else if (pair->type == DWG_VT_STRING && f->dtype == DWG_DT_H
+                   && !f->is_vector)
             {
               char *key, *str;
               if (pair->value.s.ptr && strlen (pair->value.s.ptr))
@@ -1592,7 +1644,7 @@ dxf_header_read (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
                   dwg_dynapi_header_set_value (dwg, &field[1], &hdl, 1);
                 }
             }
-          else if (strEQc (f->type, "H"))
+          else if (f->dtype == DWG_DT_H && !f->is_vector)
             {
               BITCODE_H hdl;
               hdl = dwg_add_handleref (dwg, 4, pair->value.u, NULL);
@@ -1600,7 +1652,7 @@ dxf_header_read (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
                          pair->code);
               dwg_dynapi_header_set_value (dwg, &field[1], &hdl, 1);
             }
-          else if (strEQc (f->type, "CMC"))
+          else if (f->dtype == DWG_DT_CMC)
             {
               BITCODE_CMC color = { 0 };
               if (pair->code <= 70 || pair->code > 99)
@@ -1611,9 +1663,9 @@ dxf_header_read (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
                   dwg_dynapi_header_set_value (dwg, &field[1], &color, 0);
                 }
             }
-          else if (pair->type == DWG_VT_REAL && strEQc (f->type, "TIMEBLL"))
+          else if (pair->type == DWG_VT_REAL && f->dtype == DWG_DT_TIMEBLL)
             {
-              static BITCODE_TIMEBLL date = { 0, 0, 0 };
+              static THREAD_LOCAL BITCODE_TIMEBLL date = { 0, 0, 0 };
               date.value = pair->value.d;
               date.days = (BITCODE_BL)trunc (pair->value.d);
               date.ms = (BITCODE_BL)(86400000.0 * (date.value - date.days));
@@ -10030,6 +10082,86 @@ add_MATERIAL (Dwg_Object *restrict obj, Bit_Chain *restrict dat,
 #  undef MAT_BL
 }
 
+/* The fields to check for a DXF pair, in fields order: the fields of
+   the pair code in the generated DXF index, plus all vectors, which are
+   matched by the codes of their items. All fields if there is no index,
+   or too many candidates. */
+#define DXF_MAX_CANDIDATES 64
+typedef struct _dxf_candidates
+{
+  const Dwg_DYNAPI_field *fields;
+  const Dwg_DYNAPI_dxf *dxf;
+  unsigned num_dxf;
+  unsigned num_vectors; // > DXF_MAX_CANDIDATES: too many
+  unsigned short vectors[DXF_MAX_CANDIDATES];
+  int all;
+  unsigned num, next;
+  unsigned short index[DXF_MAX_CANDIDATES];
+} Dxf_Candidates;
+
+/* Sets the fields with its DXF index, once per fields array. */
+static void
+dxf_candidates_init (Dxf_Candidates *restrict c,
+                     const Dwg_DYNAPI_field *restrict fields,
+                     const Dwg_DYNAPI_dxf *restrict dxf,
+                     const unsigned num_dxf, const int with_vectors)
+{
+  c->fields = fields;
+  c->dxf = dxf;
+  c->num_dxf = num_dxf;
+  c->num_vectors = 0;
+  if (!with_vectors)
+    return;
+  for (unsigned i = 0; fields[i].name; i++)
+    if (fields[i].is_malloc && !fields[i].is_string)
+      {
+        if (c->num_vectors < DXF_MAX_CANDIDATES)
+          c->vectors[c->num_vectors] = (unsigned short)i;
+        c->num_vectors++;
+      }
+}
+
+static const Dwg_DYNAPI_field *
+dxf_candidates_next (Dxf_Candidates *restrict c,
+                     const Dwg_DYNAPI_field *restrict f)
+{
+  if (c->all)
+    return f + 1;
+  return c->next < c->num ? &c->fields[c->index[c->next++]] : NULL;
+}
+
+/* Merges the index entries for the code with the vectors. Returns the
+   first field to check, or NULL. */
+static const Dwg_DYNAPI_field *
+dxf_candidates_first (Dxf_Candidates *restrict c, const int code,
+                      const int all)
+{
+  unsigned count, i = 0, v = 0;
+  const Dwg_DYNAPI_dxf *d
+      = dwg_dynapi_dxf_find (c->dxf, c->num_dxf, code, &count);
+  c->all = all || !c->dxf || c->num_vectors > DXF_MAX_CANDIDATES
+           || count + c->num_vectors > DXF_MAX_CANDIDATES;
+  if (c->all)
+    return &c->fields[0];
+  c->num = c->next = 0;
+  while (i < count || v < c->num_vectors)
+    {
+      unsigned short next;
+      if (v >= c->num_vectors
+          || (i < count && d[i].index <= c->vectors[v]))
+        {
+          next = d[i].index;
+          if (v < c->num_vectors && c->vectors[v] == next)
+            v++;
+          i++;
+        }
+      else
+        next = c->vectors[v++];
+      c->index[c->num++] = next;
+    }
+  return dxf_candidates_next (c, NULL);
+}
+
 /* For tables, entities and objects.
  */
 static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
@@ -10061,7 +10193,9 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
   BITCODE_3BD pt;
   Dwg_Object *ctrl;
   const Dwg_DYNAPI_field *prev_vstyle = NULL;
+  Dxf_Candidates cand, common_cand;
   subclass[0] = '\0';
+  cand.fields = common_cand.fields = NULL;
 
   if (ctrl_id || i)
     {
@@ -12409,7 +12543,20 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                              obj->name);
                   break;
                 }
-              for (f = &fields[0]; f->name; f++)
+              if (cand.fields != fields)
+                {
+                  unsigned num_dxf;
+                  const Dwg_DYNAPI_dxf *dxf
+                      = dwg_dynapi_entity_dxf (obj->name, &num_dxf);
+                  dxf_candidates_init (&cand, fields, dxf, num_dxf, 1);
+                }
+              // the VISUALSTYLE 176 is searched after the previous field
+              for (f = dxf_candidates_first (
+                       &cand, pair->code,
+                       obj->fixedtype == DWG_TYPE_VISUALSTYLE
+                           && dwg->header.from_version >= R_2010
+                           && pair->code == 176 && prev_vstyle);
+                   f && f->name; f = dxf_candidates_next (&cand, f))
                 {
                   LOG_INSANE ("-%s.%s [%d %s] vs %d\n", obj->name, f->name,
                               f->dxf, f->type, pair->code);
@@ -12656,7 +12803,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                                   fieldname);
                     }
                   else if (f->dxf == pair->code // matching DXF code
-                           || (strEQc (f->type, "CMC") && f->size > 8
+                           || (f->dtype == DWG_DT_CMC && f->size > 8
                                && (pair->code == f->dxf + (420 - 62)
                                    || pair->code == f->dxf + (430 - 62)
                                    || pair->code == f->dxf + (440 - 62))))
@@ -12700,7 +12847,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                           goto next_pair; // found
                         }
                       // convert double to text (e.g. ATEXT)
-                      else if (strEQc (f->type, "D2T")
+                      else if (f->dtype == DWG_DT_D2T
                                && pair->type == DWG_VT_REAL)
                         {
                           // TODO: for now we need to do double-conversion
@@ -12717,7 +12864,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                           goto next_pair; // found
                         }
                       // resolve handle, by name or ref
-                      else if (strEQc (f->type, "H"))
+                      else if (f->dtype == DWG_DT_H && !f->is_vector)
                         {
                           BITCODE_H ref = find_tablehandle (dwg, pair);
                           if (!ref)
@@ -12799,7 +12946,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                       else if (f->size > 8
                                && (strchr (f->type, '2')
                                    || strchr (f->type, '3')
-                                   || strEQc (f->type, "BE")))
+                                   || f->dtype == DWG_DT_BE))
                         {
                           // pt.x = 0.0;
                           // if (pair->value.d == 0.0) // ignore defaults
@@ -12814,9 +12961,9 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                           goto next_pair; // found
                         }
                       else if (pair->type == DWG_VT_REAL
-                               && strEQc (f->type, "TIMEBLL"))
+                               && f->dtype == DWG_DT_TIMEBLL)
                         {
-                          static BITCODE_TIMEBLL date = { 0, 0, 0 };
+                          static THREAD_LOCAL BITCODE_TIMEBLL date = { 0, 0, 0 };
                           date.value = pair->value.d;
                           date.days = (BITCODE_BL)trunc (pair->value.d);
                           date.ms = (BITCODE_BL)(86400000.0
@@ -12829,7 +12976,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                                                        f->name, &date, 1);
                           goto next_pair;
                         }
-                      else if (f->size > 8 && strEQc (f->type, "CMC"))
+                      else if (f->size > 8 && f->dtype == DWG_DT_CMC)
                         {
                           BITCODE_CMC color;
                           dwg_dynapi_entity_value (_obj, obj->name, f->name,
@@ -12906,11 +13053,12 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                         }
                       // num_ field with associated vector
                       else if (memBEGINc (f->name, "num_")
-                               && (strEQc (f->type, "BL")
-                                   || strEQc (f->type, "BS")
-                                   || strEQc (f->type, "RL")
-                                   || strEQc (f->type, "RS")
-                                   || strEQc (f->type, "RC")))
+                               && !f->is_vector
+                               && (f->dtype == DWG_DT_BL
+                                   || f->dtype == DWG_DT_BS
+                                   || f->dtype == DWG_DT_RL
+                                   || f->dtype == DWG_DT_RS
+                                   || f->dtype == DWG_DT_RC))
                         {
                           long old = get_numfield_value (_obj, f);
                           if (old)
@@ -12952,7 +13100,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                     }
                   // wrong code, maybe a point .y or .z
                   else if ((*f->type == '3' || *f->type == '2'
-                            || strEQc (f->type, "BE"))
+                            || f->dtype == DWG_DT_BE)
                            && f->dxf
                            && (strstr (f->type, "_1")
                                    ? f->dxf + 1 == pair->code // 2BD_1
@@ -12971,7 +13119,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                       goto next_pair; // found, early exit
                     }
                   else if ((*f->type == '3' || *f->type == '2'
-                            || strEQc (f->type, "BE"))
+                            || f->dtype == DWG_DT_BE)
                            && f->dxf
                            && (strstr (f->type, "_1")
                                    ? f->dxf + 2 == pair->code // 2BD_1
@@ -13024,7 +13172,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                       goto next_pair; // found, early exit
                     }
                   // FIELD_VECTOR_N BITCODE_BD transmatrix[16]:
-                  else if (strEQc (f->type, "BD*")
+                  else if ((f->dtype == DWG_DT_BD && f->is_vector)
                            && (strEQc (name, "EXTRUDEDSURFACE")
                                || strEQc (name, "LOFTEDSURFACE")
                                || strEQc (name, "SWEPTSURFACE")
@@ -13068,8 +13216,8 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                     {
                       Dwg_Object_LAYOUT *o = obj->tio.object->tio.LAYOUT;
                       int unique;
-                      static double pt_x;
-                      static const Dwg_DYNAPI_field *pt_f = NULL;
+                      static THREAD_LOCAL double pt_x;
+                      static THREAD_LOCAL const Dwg_DYNAPI_field *pt_f = NULL;
                       if (pair->code == 6 && *pair->value.s.ptr)
                         {
                           if (dwg->header.version < R_2004)
@@ -13099,7 +13247,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                               pt_x = pair->value.d;
                               goto next_pair;
                             }
-                          else if (strEQc (f->type, "H"))
+                          else if (f->dtype == DWG_DT_H && !f->is_vector)
                             {
                               BITCODE_H ref = find_tablehandle (dwg, pair);
                               if (!ref)
@@ -13160,7 +13308,17 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                 }
               fields = is_entity ? dwg_dynapi_common_entity_fields ()
                                  : dwg_dynapi_common_object_fields ();
-              for (f = &fields[0]; f->name; f++)
+              if (common_cand.fields != fields)
+                {
+                  unsigned num_dxf;
+                  const Dwg_DYNAPI_dxf *dxf
+                      = is_entity ? dwg_dynapi_common_entity_dxf (&num_dxf)
+                                  : dwg_dynapi_common_object_dxf (&num_dxf);
+                  dxf_candidates_init (&common_cand, fields, dxf, num_dxf, 0);
+                }
+              // the alternate color codes are indexed with the CMC color
+              for (f = dxf_candidates_first (&common_cand, pair->code, 0);
+                   f && f->name; f = dxf_candidates_next (&common_cand, f))
                 {
                   LOG_INSANE ("-%s.%s [%d %s] vs %d\n",
                               is_entity ? "ENTITY" : "OBJECT", f->name, f->dxf,
@@ -13168,7 +13326,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                   if ((pair->code == 62 || pair->code == 420
                        || pair->code == 430 || pair->code == 440)
                       && (f->size > 8
-                          && strEQc (f->type, "CMC"))) // alt. color fields
+                          && f->dtype == DWG_DT_CMC)) // alt. color fields
                     {
                       BITCODE_CMC color;
                       dwg_dynapi_common_value (_obj, f->name, &color, NULL);
@@ -13232,7 +13390,7 @@ static __nonnull ((1, 2, 3, 4)) Dxf_Pair *new_object (
                   else if (f->dxf == pair->code)
                     {
                       /// resolve handle (table entry) given by name or ref
-                      if (strEQc (f->type, "H"))
+                      if (f->dtype == DWG_DT_H && !f->is_vector)
                         {
                           BITCODE_H handle = find_tablehandle (dwg, pair);
                           if (!handle)
@@ -14750,7 +14908,7 @@ resolve_postponed_header_refs (Dwg_Data *restrict dwg)
   for (i = 0; i < header_hdls->nitems; i++)
     {
       char *field = header_hdls->items[i].field;
-      Dxf_Pair p = { 0, DWG_VT_STRING, { 0 } };
+      Dxf_Pair p = { 0, DWG_VT_STRING, { 0 }, NULL, 0 };
       BITCODE_H hdl = NULL;
       p.value.s.ptr = header_hdls->items[i].name;
       if (!p.value.s.ptr || !*p.value.s.ptr)
@@ -14803,7 +14961,7 @@ resolve_postponed_object_refs (Dwg_Data *restrict dwg)
   for (i = 0; i < obj_hdls->nitems; i++)
     {
       char *field = obj_hdls->items[i].field;
-      Dxf_Pair p = { 0, DWG_VT_STRING, { 0 } };
+      Dxf_Pair p = { 0, DWG_VT_STRING, { 0 }, NULL, 0 };
       BITCODE_H hdl = NULL;
       int objid = obj_hdls->items[i].code;
       Dwg_Object *obj = &dwg->object[objid];
@@ -15071,8 +15229,6 @@ dwg_read_dxf (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
   // dxf_objs = (Dxf_Objs *)malloc (1000 * sizeof (Dxf_Objs));
   if (!dwg->object_map)
     dwg->object_map = hash_new (dat->size / 1000);
-  // cannot rely on ref->obj during realloc's
-  dwg->dirty_refs = 1;
 
   header_hdls = new_array_hdls (16);
   eed_hdls = new_array_hdls (16);
@@ -15297,6 +15453,7 @@ dwg_read_dxf (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
   free_array_hdls (header_hdls);
   free_array_hdls (eed_hdls);
   free_array_hdls (obj_hdls);
+  dxf_free_pair_pool ();
   if (dwg->header.version <= R_2000
       && (dwg->header.from_version > R_2000 || (dwg->opts & DWG_OPTS_INDXF)))
     dwg_fixup_BLOCKS_entities (dwg);
@@ -15307,10 +15464,10 @@ dwg_read_dxf (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
     return dwg->num_objects ? 1 : 0;
 
 error:
-  dwg->dirty_refs = 0;
   free_array_hdls (header_hdls);
   free_array_hdls (eed_hdls);
   free_array_hdls (obj_hdls);
+  dxf_free_pair_pool ();
   return error;
 }
 
@@ -70,6 +70,8 @@ typedef struct _dxf_pair
     uint64_t rll;
     double d;
   } value;
+  char *strbuf; // reused for the string values
+  size_t strbuf_size;
 } Dxf_Pair;
 
 /* We need to postpone the HEADER handles from names,
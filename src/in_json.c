@@ -11,7 +11,7 @@
 /*****************************************************************************/
 
 /*
- * in_json.c: parse JSON via jsmn/jsmn.h
+ * in_json.c: parse JSON, streamed into jsmn tokens
  * written by Reini Urban
  */
 
@@ -23,6 +23,7 @@
 #include <math.h>
 #include <errno.h>
 #include <limits.h>
+#include "../programs/my_stat.h"
 
 #define IS_ENCODER
 #define IS_JSON
@@ -41,23 +42,34 @@
 
 #include "in_dxf.h"
 
-// not exported
-#define JSMN_STATIC
-// probably not needed in the final version (counting keys)
-#undef JSMN_PARENT_LINKS
-// our files are bigger than 8000
-// In strict mode primitive must be followed by "," or "}" or "]";
-// comma/object/array
-// In strict mode an object or array can't become a key
-// In strict mode primitives are: numbers and booleans
-#undef JSMN_STRICT
+// Only the jsmn token types are used. The JSON is tokenized incrementally
+// below, in a single pass over a sliding window of the input.
+#define JSMN_HEADER
 #include "../jsmn/jsmn.h"
 
+// the max. nesting of JSON objects and arrays
+#define JSON_MAX_DEPTH 64
+// the tokens kept before the current one when sliding the window
+#define JSON_LOOKBACK 8
+// the initial size of the text window when reading from a file
+#define JSON_CHUNK (256 * 1024)
+
 typedef struct jsmntokens
 {
   unsigned int index;
   jsmntok_t *tokens;
   long num_tokens;
+  unsigned int alloced;    // the tokens window, zeroed after num_tokens
+  FILE *fh;                // NULL if all the input is in dat->chain
+  size_t alloced_chain;    // the text window dat->chain, when from fh
+  size_t pos;              // the tokenizer position in dat->chain
+  size_t offset;           // the input offset of dat->chain[0]
+  size_t num_read;         // the number of tokens read
+  int depth;               // of the open objects and arrays
+  int stack[JSON_MAX_DEPTH]; // their tokens, or -1 if slid out
+  int key[JSON_MAX_DEPTH]; // the key still without value, or -1
+  bool is_object[JSON_MAX_DEPTH];
+  bool eof;
 } jsmntokens_t;
 
 // synced with enum jsmntype_t
@@ -65,9 +77,7 @@ static const char *const t_typename[]
     = { "UNDEFINED", "OBJECT", "ARRAY", "STRING", "PRIMITIVE" };
 
 /* the current version per spec block */
-static unsigned int cur_ver = 0;
-static char *created_by;
-static Bit_Chain *g_dat;
+static THREAD_LOCAL unsigned int cur_ver = 0;
 
 #define json_expect(tokens, typ)                                              \
   if (tokens->tokens[tokens->index].type != JSMN_##typ)                       \
@@ -296,6 +306,270 @@ static Bit_Chain *g_dat;
   JSON_TOKENS_CHECK_OVERFLOW (return NULL)
 #define JSON_TOKENS_CHECK_OVERFLOW_VOID JSON_TOKENS_CHECK_OVERFLOW (return)
 
+/* The incremental tokenizer. Emits jsmn compatible tokens into the
+   tokens window, with the same sizes as jsmn_parse: the number of keys
+   of an object, of the elements of an array, and 1 for a key with its
+   value. The callers only work on complete values. At the safe points
+   between two first-level values or two OBJECTS the windows are slid
+   by json_tokens_slide, so the memory is bounded by the biggest object,
+   not by the input size. */
+
+#define JSON_TOKEN 1
+#define JSON_CLOSE 2
+
+// Read more input into the text window. Returns false at EOF.
+static bool
+json_tokens_read (Bit_Chain *restrict dat, jsmntokens_t *restrict tokens)
+{
+  size_t n;
+  if (!tokens->fh || tokens->eof)
+    return false;
+  if (dat->size + JSON_CHUNK >= tokens->alloced_chain)
+    {
+      size_t alloced = tokens->alloced_chain * 2;
+      unsigned char *chain = (unsigned char *)realloc (dat->chain, alloced);
+      if (!chain)
+        {
+          LOG_ERROR ("Out of memory");
+          tokens->eof = true;
+          return false;
+        }
+      dat->chain = chain;
+      tokens->alloced_chain = alloced;
+    }
+  n = fread (&dat->chain[dat->size], 1, JSON_CHUNK, tokens->fh);
+  if (!n)
+    {
+      tokens->eof = true;
+      return false;
+    }
+  dat->size += n;
+  dat->chain[dat->size] = '\0';
+  return true;
+}
+
+static jsmntok_t *
+json_tokens_new (jsmntokens_t *restrict tokens, const jsmntype_t type,
+                 const int start, const int end)
+{
+  jsmntok_t *t;
+  const int d = tokens->depth - 1;
+  if ((unsigned)tokens->num_tokens + 2 >= tokens->alloced)
+    {
+      const unsigned int alloced = tokens->alloced * 2;
+      t = (jsmntok_t *)realloc (tokens->tokens, alloced * sizeof (jsmntok_t));
+      if (!t)
+        {
+          LOG_ERROR ("Out of memory");
+          return NULL;
+        }
+      memset (&t[tokens->alloced], 0,
+              (alloced - tokens->alloced) * sizeof (jsmntok_t));
+      tokens->tokens = t;
+      tokens->alloced = alloced;
+    }
+  t = &tokens->tokens[tokens->num_tokens];
+  t->type = type;
+  t->start = start;
+  t->end = end;
+  t->size = 0;
+  if (d >= 0)
+    {
+      if (tokens->is_object[d] && tokens->key[d] >= 0)
+        {
+          tokens->tokens[tokens->key[d]].size = 1;
+          tokens->key[d] = -1;
+        }
+      else
+        {
+          if (tokens->is_object[d])
+            tokens->key[d] = (int)tokens->num_tokens;
+          if (tokens->stack[d] >= 0)
+            tokens->tokens[tokens->stack[d]].size++;
+        }
+    }
+  tokens->num_tokens++;
+  tokens->num_read++;
+  return t;
+}
+
+/* Tokenizes the next value or close. Returns JSON_TOKEN, JSON_CLOSE, 0 at
+   the end of the input, or a jsmn error, JSMN_ERROR_PART at the end of the
+   input within an object or array. */
+static int
+json_tokenize (Bit_Chain *restrict dat, jsmntokens_t *restrict tokens)
+{
+  for (;;)
+    {
+      size_t i;
+      unsigned char c;
+      if (tokens->pos >= dat->size && !json_tokens_read (dat, tokens))
+        return tokens->depth ? JSMN_ERROR_PART : 0;
+      c = dat->chain[tokens->pos];
+      switch (c)
+        {
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+        case ',':
+        case ':':
+          tokens->pos++;
+          continue;
+        case '{':
+        case '[':
+          {
+            const int d = tokens->depth;
+            if (d >= JSON_MAX_DEPTH)
+              {
+                LOG_ERROR ("JSON nesting limit %d", JSON_MAX_DEPTH);
+                return JSMN_ERROR_INVAL;
+              }
+            if (!json_tokens_new (tokens, c == '{' ? JSMN_OBJECT : JSMN_ARRAY,
+                                  (int)tokens->pos, -1))
+              return JSMN_ERROR_NOMEM;
+            tokens->stack[d] = (int)tokens->num_tokens - 1;
+            tokens->key[d] = -1;
+            tokens->is_object[d] = c == '{';
+            tokens->depth++;
+            tokens->pos++;
+            return JSON_TOKEN;
+          }
+        case '}':
+        case ']':
+          {
+            const int d = tokens->depth - 1;
+            const int k = d >= 0 ? tokens->stack[d] : -1;
+            if (d < 0 || tokens->is_object[d] != (c == '}')
+                || tokens->key[d] >= 0)
+              return JSMN_ERROR_INVAL;
+            if (k >= 0)
+              tokens->tokens[k].end = (int)tokens->pos + 1;
+            tokens->depth--;
+            tokens->pos++;
+            return JSON_CLOSE;
+          }
+        case '"':
+          for (i = tokens->pos + 1;; i++)
+            {
+              if (i >= dat->size && !json_tokens_read (dat, tokens))
+                return JSMN_ERROR_PART;
+              if (dat->chain[i] == '"')
+                break;
+              if (dat->chain[i] == '\\')
+                i++;
+            }
+          if (!json_tokens_new (tokens, JSMN_STRING, (int)tokens->pos + 1,
+                                (int)i))
+            return JSMN_ERROR_NOMEM;
+          tokens->pos = i + 1;
+          return JSON_TOKEN;
+        default: // primitive, up to its delimiter
+          for (i = tokens->pos;; i++)
+            {
+              if (i >= dat->size && !json_tokens_read (dat, tokens))
+                break;
+              c = dat->chain[i];
+              if (c == ',' || c == ']' || c == '}' || c == ':' || c == ' '
+                  || c == '\t' || c == '\r' || c == '\n')
+                break;
+              if (c < 32 || c >= 127)
+                return JSMN_ERROR_INVAL;
+            }
+          if (!json_tokens_new (tokens, JSMN_PRIMITIVE, (int)tokens->pos,
+                                (int)i))
+            return JSMN_ERROR_NOMEM;
+          tokens->pos = i;
+          return JSON_TOKEN;
+        }
+    }
+}
+
+/* Tokenizes the value at the current index, the whole object or array if
+   deep. Returns 1, 0 at the close of its container or at the end of the
+   input after the first-level value, or a jsmn error. */
+static int
+json_tokens_get (Bit_Chain *restrict dat, jsmntokens_t *restrict tokens,
+                 const bool deep)
+{
+  int error;
+  while (tokens->index >= (unsigned int)tokens->num_tokens)
+    {
+      error = json_tokenize (dat, tokens);
+      if (error != JSON_TOKEN)
+        return error == JSON_CLOSE ? 0 : error;
+    }
+  if (deep)
+    {
+      const unsigned int index = tokens->index;
+      while (tokens->tokens[index].end < 0)
+        {
+          error = json_tokenize (dat, tokens);
+          if (error <= 0)
+            return error ? error : JSMN_ERROR_PART;
+        }
+    }
+  return 1;
+}
+
+/* At a safe point, with no token or text pointers held: drops the tokens
+   before the current index, and their text. */
+static void
+json_tokens_slide (Bit_Chain *restrict dat, jsmntokens_t *restrict tokens)
+{
+  const unsigned int drop
+      = tokens->index > JSON_LOOKBACK ? tokens->index - JSON_LOOKBACK : 0;
+  const unsigned int num = (unsigned int)tokens->num_tokens - drop;
+  size_t cut = tokens->pos;
+
+  if (drop < JSON_LOOKBACK)
+    return;
+  memmove (tokens->tokens, &tokens->tokens[drop], num * sizeof (jsmntok_t));
+  memset (&tokens->tokens[num], 0, drop * sizeof (jsmntok_t));
+  tokens->num_tokens = num;
+  tokens->index -= drop;
+  for (int d = 0; d < tokens->depth; d++)
+    {
+      tokens->stack[d] = tokens->stack[d] >= (int)drop
+                             ? tokens->stack[d] - (int)drop
+                             : -1;
+      tokens->key[d]
+          = tokens->key[d] >= (int)drop ? tokens->key[d] - (int)drop : -1;
+    }
+  if (!tokens->fh)
+    return;
+  // and the text before the kept tokens, when it's at least half of it
+  for (unsigned int i = 0; i < num; i++)
+    if (tokens->tokens[i].start >= 0 && (size_t)tokens->tokens[i].start < cut)
+      cut = (size_t)tokens->tokens[i].start;
+  if (cut < JSON_CHUNK)
+    return;
+  memmove (dat->chain, &dat->chain[cut], dat->size - cut + 1);
+  dat->size -= cut;
+  tokens->pos -= cut;
+  tokens->offset += cut;
+  for (unsigned int i = 0; i < num; i++)
+    {
+      jsmntok_t *t = &tokens->tokens[i];
+      if (t->start >= 0)
+        t->start -= (int)cut;
+      if (t->end >= 0)
+        t->end -= (int)cut;
+    }
+}
+
+static void
+json_tokens_error (Bit_Chain *restrict dat, jsmntokens_t *restrict tokens,
+                   const int error)
+{
+  const size_t pos = tokens->pos < dat->size ? tokens->pos : dat->size;
+  const int remaining = (int)MIN (dat->size - pos, 20);
+  LOG_ERROR ("Invalid json. jsmn error %d at the %" PRIuSIZE
+             "-th token, pos: %" PRIuSIZE " (%.*s ...)",
+             error, tokens->num_read, tokens->offset + pos, remaining,
+             &dat->chain[pos]);
+}
+
 // advance until next known first-level type
 // on OBJECT to end of OBJECT
 // on ARRAY to end of ARRAY
@@ -1045,6 +1319,7 @@ json_created_by (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
                  jsmntokens_t *restrict tokens)
 {
   const jsmntok_t *t = &tokens->tokens[tokens->index];
+  char *created_by;
   (void)dwg;
   if (t->type != JSMN_STRING)
     {
@@ -1053,8 +1328,10 @@ json_created_by (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
       return DWG_ERR_INVALIDTYPE;
     }
   created_by = json_string (dat, tokens);
+  if (created_by)
+    LOG_TRACE ("created_by %s\n", created_by);
+  free (created_by);
   JSON_TOKENS_CHECK_OVERFLOW_ERR;
-  LOG_TRACE ("created_by %s\n", created_by);
   tokens->index--; // advanced by the loop
   return 0;
 }
@@ -1192,11 +1469,13 @@ json_HEADER (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
     {
       char key[80];
       Dwg_DYNAPI_field *f;
+      Dwg_DYNAPI_type dtype;
 
       json_fixed_key (key, dat, tokens);
       JSON_TOKENS_CHECK_OVERFLOW_ERR
       t = &tokens->tokens[tokens->index];
       f = (Dwg_DYNAPI_field *)dwg_dynapi_header_field (key);
+      dtype = f && !f->is_vector ? (Dwg_DYNAPI_type)f->dtype : DWG_DT_OTHER;
       if (!f)
         {
           if (t->type == JSMN_ARRAY && strEQc (key, "layer_colors"))
@@ -1219,32 +1498,32 @@ json_HEADER (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
             }
         }
       else if (t->type == JSMN_PRIMITIVE
-               && (strEQc (f->type, "BD") || strEQc (f->type, "RD")))
+               && (dtype == DWG_DT_BD || dtype == DWG_DT_RD))
         {
           double num = json_float (dat, tokens);
           LOG_TRACE ("%s: " FORMAT_RD " [%s]\n", key, num, f->type);
           dwg_dynapi_header_set_value (dwg, key, &num, 0);
         }
       else if (t->type == JSMN_PRIMITIVE && f->size <= 4 // not a RS[]
-               && (strEQc (f->type, "RC") || strEQc (f->type, "B")
-                   || strEQc (f->type, "BB") || strEQc (f->type, "RS")
-                   || strEQc (f->type, "BS") || strEQc (f->type, "RL")
-                   || strEQc (f->type, "BL") || strEQc (f->type, "RSd")
-                   || strEQc (f->type, "BLd") || strEQc (f->type, "BSd")))
+               && (dtype == DWG_DT_RC || dtype == DWG_DT_B
+                   || dtype == DWG_DT_BB || dtype == DWG_DT_RS
+                   || dtype == DWG_DT_BS || dtype == DWG_DT_RL
+                   || dtype == DWG_DT_BL || dtype == DWG_DT_RSd
+                   || dtype == DWG_DT_BLd || dtype == DWG_DT_BSd))
         {
           uint32_t num = json_long (dat, tokens);
           LOG_TRACE ("%s: " FORMAT_BL " [%s]\n", key, num, f->type);
           dwg_dynapi_header_set_value (dwg, key, &num, 0);
         }
       else if (t->type == JSMN_PRIMITIVE && f->size == 8 // not a RLL[]
-               && (strEQc (f->type, "RLL") || strEQc (f->type, "BLL")))
+               && (dtype == DWG_DT_RLL || dtype == DWG_DT_BLL))
         {
           uint64_t num = json_longlong (dat, tokens);
           LOG_TRACE ("%s: " FORMAT_RLL " [%s]\n", key, num, f->type);
           dwg_dynapi_header_set_value (dwg, key, &num, 0);
         }
       else if (t->type == JSMN_STRING
-               && (strEQc (f->type, "TV") || strEQc (f->type, "T")))
+               && (dtype == DWG_DT_TV || dtype == DWG_DT_T))
         {
           size_t len;
           char *str = json_string (dat, tokens);
@@ -1262,25 +1541,25 @@ json_HEADER (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
           free (str);
         }
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "3BD") || strEQc (f->type, "3RD")
-                   || strEQc (f->type, "3DPOINT") || strEQc (f->type, "BE")
-                   || strEQc (f->type, "3BD_1")))
+               && (dtype == DWG_DT_3BD || dtype == DWG_DT_3RD
+                   || dtype == DWG_DT_3DPOINT || dtype == DWG_DT_BE
+                   || dtype == DWG_DT_3BD_1))
         {
           BITCODE_3DPOINT pt;
           json_3DPOINT (dat, tokens, name, key, f->type, &pt);
           dwg_dynapi_header_set_value (dwg, key, &pt, 1);
         }
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "2BD") || strEQc (f->type, "2RD")
-                   || strEQc (f->type, "2DPOINT")
-                   || strEQc (f->type, "2BD_1")))
+               && (dtype == DWG_DT_2BD || dtype == DWG_DT_2RD
+                   || dtype == DWG_DT_2DPOINT
+                   || dtype == DWG_DT_2BD_1))
         {
           BITCODE_2DPOINT pt;
           json_2DPOINT (dat, tokens, name, key, f->type, &pt);
           dwg_dynapi_header_set_value (dwg, key, &pt, 1);
         }
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "BS") || strEQc (f->type, "RS")))
+               && (dtype == DWG_DT_BS || dtype == DWG_DT_RS))
         {
           int size1 = t->size;
           BITCODE_BS *nums = (BITCODE_BS *)calloc (f->size, 1);
@@ -1320,19 +1599,19 @@ json_HEADER (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
           else
             dwg_dynapi_header_set_value (dwg, key, &nums, 1);
         }
-      else if (strEQc (f->type, "TIMEBLL") || strEQc (f->type, "TIMERLL"))
+      else if (dtype == DWG_DT_TIMEBLL || dtype == DWG_DT_TIMERLL)
         {
           BITCODE_TIMEBLL date = { 0 };
           json_TIMEBLL (dat, tokens, key, &date);
           dwg_dynapi_header_set_value (dwg, key, &date, 0);
         }
-      else if (strEQc (f->type, "CMC"))
+      else if (dtype == DWG_DT_CMC)
         {
           BITCODE_CMC color = { 0 };
           json_CMC (dat, dwg, tokens, name, key, &color);
           dwg_dynapi_header_set_value (dwg, key, &color, 0);
         }
-      else if (t->type == JSMN_ARRAY && strEQc (f->type, "H"))
+      else if (t->type == JSMN_ARRAY && dtype == DWG_DT_H)
         {
           BITCODE_H hdl
               = json_HANDLE (dat, dwg, tokens, section, key, NULL, -1);
@@ -2196,11 +2475,16 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
   // Found common, subclass or entity key, check types
   if (f && f->name)
     {
+      // scalar type, or the element type of a vector like BD*
+      const Dwg_DYNAPI_type dtype
+          = f->is_vector ? DWG_DT_OTHER : (Dwg_DYNAPI_type)f->dtype;
+      const Dwg_DYNAPI_type vtype
+          = f->is_vector ? (Dwg_DYNAPI_type)f->dtype : DWG_DT_OTHER;
       LOG_INSANE ("-found %s [%s] %s\n", f->name, f->type,
                   t_typename[t->type]);
       if (t->type == JSMN_PRIMITIVE
-          && (strEQc (f->type, "BD") || strEQc (f->type, "RD")
-              || strEQc (f->type, "BT")))
+          && (dtype == DWG_DT_BD || dtype == DWG_DT_RD
+              || dtype == DWG_DT_BT))
         {
           if (f->size > sizeof (double))
             {
@@ -2227,12 +2511,12 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
                      &dat->chain[t->start]);
         }
       else if (t->type == JSMN_PRIMITIVE
-               && (strEQc (f->type, "RC") || strEQc (f->type, "B")
-                   || strEQc (f->type, "BB") || strEQc (f->type, "RS")
-                   || strEQc (f->type, "BS") || strEQc (f->type, "RL")
-                   || strEQc (f->type, "BL") || strEQc (f->type, "BLd")
-                   || strEQc (f->type, "BSd") || strEQc (f->type, "RCd")
-                   || strEQc (f->type, "RSd") || strEQc (f->type, "4BITS")))
+               && (dtype == DWG_DT_RC || dtype == DWG_DT_B
+                   || dtype == DWG_DT_BB || dtype == DWG_DT_RS
+                   || dtype == DWG_DT_BS || dtype == DWG_DT_RL
+                   || dtype == DWG_DT_BL || dtype == DWG_DT_BLd
+                   || dtype == DWG_DT_BSd || dtype == DWG_DT_RCd
+                   || dtype == DWG_DT_RSd || dtype == DWG_DT_4BITS))
         {
           if (f->size > sizeof (uint32_t))
             {
@@ -2256,7 +2540,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
             }
         }
       else if (t->type == JSMN_PRIMITIVE
-               && (strEQc (f->type, "RLL") || strEQc (f->type, "BLL")))
+               && (dtype == DWG_DT_RLL || dtype == DWG_DT_BLL))
         {
           if (f->size > sizeof (uint64_t))
             {
@@ -2276,8 +2560,8 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
         }
       // TFF not yet in dynapi.c
       else if (t->type == JSMN_STRING
-               && (strEQc (f->type, "TV") || strEQc (f->type, "T")
-                   || strEQc (f->type, "TF") || strEQc (f->type, "TU")))
+               && (dtype == DWG_DT_TV || dtype == DWG_DT_T
+                   || dtype == DWG_DT_TF || dtype == DWG_DT_TU))
         {
           char *str = json_string (dat, tokens);
           size_t len = strlen (str);
@@ -2334,7 +2618,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
               old = &((char *)_obj)[f->offset];
               memcpy (old, &str, sizeof (char *));
             }
-          else if (strEQc (f->type, "TF")) // oleclient, strings_area, ...
+          else if (dtype == DWG_DT_TF) // oleclient, strings_area, ...
                                            // fixup size field
             {
               char *old;
@@ -2388,9 +2672,9 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
         }
       // arrays
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "3BD") || strEQc (f->type, "3RD")
-                   || strEQc (f->type, "3DPOINT") || strEQc (f->type, "BE")
-                   || strEQc (f->type, "3BD_1")))
+               && (dtype == DWG_DT_3BD || dtype == DWG_DT_3RD
+                   || dtype == DWG_DT_3DPOINT || dtype == DWG_DT_BE
+                   || dtype == DWG_DT_3BD_1))
         {
           BITCODE_3DPOINT pt;
           json_3DPOINT (dat, tokens, name, key, f->type, &pt);
@@ -2398,30 +2682,30 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
           dwg_dynapi_field_set_value (dwg, _obj, f, &pt, 1);
         }
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "2BD") || strEQc (f->type, "2RD")
-                   || strEQc (f->type, "2DPOINT")
-                   || strEQc (f->type, "2BD_1")))
+               && (dtype == DWG_DT_2BD || dtype == DWG_DT_2RD
+                   || dtype == DWG_DT_2DPOINT
+                   || dtype == DWG_DT_2BD_1))
         {
           BITCODE_2DPOINT pt;
           json_2DPOINT (dat, tokens, name, key, f->type, &pt);
           JSON_TOKENS_CHECK_OVERFLOW_ERR
           dwg_dynapi_field_set_value (dwg, _obj, f, &pt, 1);
         }
-      else if (strEQc (f->type, "TIMEBLL") || strEQc (f->type, "TIMERLL"))
+      else if (dtype == DWG_DT_TIMEBLL || dtype == DWG_DT_TIMERLL)
         {
-          static BITCODE_TIMEBLL date = { 0, 0, 0 };
+          static THREAD_LOCAL BITCODE_TIMEBLL date = { 0, 0, 0 };
           json_TIMEBLL (dat, tokens, key, &date);
           JSON_TOKENS_CHECK_OVERFLOW_ERR
           dwg_dynapi_field_set_value (dwg, _obj, f, &date, 1);
         }
-      else if (strEQc (f->type, "CMC"))
+      else if (dtype == DWG_DT_CMC)
         {
           BITCODE_CMC color = { 0, 0, 0, 0, 0, NULL, NULL, NULL, 0, 0, 0 };
           json_CMC (dat, dwg, tokens, name, key, &color);
           JSON_TOKENS_CHECK_OVERFLOW_ERR
           dwg_dynapi_field_set_value (dwg, _obj, f, &color, 1);
         }
-      else if (t->type == JSMN_ARRAY && strEQc (f->type, "H"))
+      else if (t->type == JSMN_ARRAY && dtype == DWG_DT_H)
         {
           BITCODE_H hdl;
           hdl = json_HANDLE (dat, dwg, tokens, name, key, obj, -1);
@@ -2429,7 +2713,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
           if (hdl)
             dwg_dynapi_field_set_value (dwg, _obj, f, &hdl, 1);
         }
-      else if (t->type == JSMN_ARRAY && strEQc (f->type, "H*"))
+      else if (t->type == JSMN_ARRAY && vtype == DWG_DT_H)
         {
           BITCODE_BL size1 = t->size;
           BITCODE_H *hdls;
@@ -2463,7 +2747,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
           dwg_dynapi_field_set_value (dwg, _obj, f, &hdls, 1);
         }
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "T*") || strEQc (f->type, "TV*")))
+               && (vtype == DWG_DT_T || vtype == DWG_DT_TV))
         {
           int skip = 0;
           BITCODE_BL size1 = t->size;
@@ -2499,7 +2783,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
           dwg_dynapi_field_set_value (dwg, _obj, f, &elems, 1);
         }
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "3DPOINT*") || strEQc (f->type, "3BD*")))
+               && (vtype == DWG_DT_3DPOINT || vtype == DWG_DT_3BD))
         {
           int size1 = t->size;
           BITCODE_3DPOINT *pts
@@ -2516,7 +2800,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
             LOG_TRACE ("%s.%s: [%s] empty\n", name, key, f->type);
           dwg_dynapi_field_set_value (dwg, _obj, f, &pts, 1);
         }
-      else if (t->type == JSMN_ARRAY && strEQc (f->type, "2RD*"))
+      else if (t->type == JSMN_ARRAY && vtype == DWG_DT_2RD)
         {
           const int size1 = t->size;
           BITCODE_2DPOINT *pts = size1 ? (BITCODE_2DPOINT *)calloc (
@@ -2534,7 +2818,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
           dwg_dynapi_field_set_value (dwg, _obj, f, &pts, 1);
         }
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "BD*") || strEQc (f->type, "RD")))
+               && (vtype == DWG_DT_BD || dtype == DWG_DT_RD))
         {
           const int size1 = t->size;
           const int max_k
@@ -2590,7 +2874,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
             }
         }
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "BL*") || strEQc (f->type, "BLd")))
+               && (vtype == DWG_DT_BL || dtype == DWG_DT_BLd))
         {
           const int size1 = t->size;
           const int max_k
@@ -2619,7 +2903,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
               if (k < max_k)
                 {
                   nums[k] = json_long (dat, tokens);
-                  if (strEQc (f->type, "BL*"))
+                  if (vtype == DWG_DT_BL)
                     {
                       LOG_TRACE ("%s.%s[%d]: " FORMAT_BL " [%s]\n", name, key,
                                  k, nums[k], f->type);
@@ -2653,8 +2937,8 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
             }
         }
       else if (t->type == JSMN_ARRAY
-               && (strEQc (f->type, "BS") || strEQc (f->type, "BS*")
-                   || strEQc (f->type, "BSd") || strEQc (f->type, "RS")))
+               && (dtype == DWG_DT_BS || vtype == DWG_DT_BS
+                   || dtype == DWG_DT_BSd || dtype == DWG_DT_RS))
         {
           const int size1 = t->size;
           const int max_k
@@ -2715,7 +2999,7 @@ _set_struct_field (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
           JSON_TOKENS_CHECK_OVERFLOW_ERR
         }
       else if (t->type == JSMN_ARRAY && strEQc (key, "acis_data")
-               && strEQc (f->type, "RC*"))
+               && vtype == DWG_DT_RC)
         {
           error |= json_acis_data (dat, dwg, tokens, obj);
           JSON_TOKENS_CHECK_OVERFLOW_ERR;
@@ -3119,7 +3403,7 @@ json_OBJECTS (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
 {
   const char *section = "OBJECTS";
   const jsmntok_t *t = &tokens->tokens[tokens->index];
-  int i, size;
+  int i, error;
   if (t->type != JSMN_ARRAY || dwg->num_objects)
     {
       LOG_ERROR ("Unexpected %s at %u of %ld tokens, expected %s ARRAY",
@@ -3128,45 +3412,37 @@ json_OBJECTS (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
       json_advance_unknown (dat, tokens, t->type, 0);
       return DWG_ERR_INVALIDTYPE;
     }
-  size = t->size;
-  LOG_TRACE ("\n%s pos:%d [%d members]\n--------------------\n", section,
-             tokens->index, size);
+  // streamed: the array is still open, its size unknown
+  LOG_TRACE ("\n%s pos:%d\n--------------------\n", section, tokens->index);
   tokens->index++;
-  JSON_TOKENS_CHECK_OVERFLOW_ERR
-  if (dwg->num_objects == 0)
-    {
-      // faster version of dwg_add_object()
-      // round up to next REFS_PER_REALLOC
-      int rounded = size;
-      if (rounded % REFS_PER_REALLOC)
-        rounded += REFS_PER_REALLOC - (rounded % REFS_PER_REALLOC);
-      dwg->object = (Dwg_Object *)calloc (rounded, sizeof (Dwg_Object));
-    }
-  else
-    dwg_add_object (dwg);
-  if (!dwg->object)
-    {
-      LOG_ERROR ("Out of memory");
-      return DWG_ERR_OUTOFMEM;
-    }
   if (dwg->header.from_version < R_13b1)
     {
       dwg->header.section
           = (Dwg_Section *)calloc (SECTION_VX + 1, sizeof (Dwg_Section));
     }
-  dwg->num_objects += size;
-  for (i = 0; i < size; i++)
+  for (i = 0;; i++)
     {
       char name[80];
       int keys;
       int is_entity = 0;
-      Dwg_Object *obj = &dwg->object[i];
+      Dwg_Object *obj;
       Dwg_Object_APPID *_obj = NULL;
       const Dwg_DYNAPI_field *fields = NULL, *cfields;
       const Dwg_DYNAPI_field *f;
 
       memset (name, 0, sizeof (name));
-      JSON_TOKENS_CHECK_OVERFLOW (goto harderr)
+      // only the current object is kept in the tokens window
+      json_tokens_slide (dat, tokens);
+      error = json_tokens_get (dat, tokens, true);
+      if (error <= 0)
+        {
+          if (!error) // end of the OBJECTS array
+            break;
+          json_tokens_error (dat, tokens, error);
+          LOG_TRACE ("End of %s (hard error)\n", section);
+          dwg->num_objects = i;
+          return DWG_ERR_INVALIDDWG;
+        }
       if (i > 0)
         {
           Dwg_Object *oldobj = &dwg->object[i - 1];
@@ -3174,7 +3450,6 @@ json_OBJECTS (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
             {
               LOG_ERROR ("Required %s.handle missing, skipped", oldobj->name);
               dwg_free_object (oldobj);
-              obj = oldobj;
               i--;
             }
           else if (!oldobj->type)
@@ -3186,9 +3461,7 @@ json_OBJECTS (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
               if (!oldobj->parent)
                 oldobj->parent = dwg;
               dwg_free_object (oldobj);
-              obj = oldobj;
               i--;
-              size--;
             }
           else if (oldobj->fixedtype == DWG_TYPE_UNUSED)
             {
@@ -3197,7 +3470,6 @@ json_OBJECTS (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
               if (!oldobj->parent)
                 oldobj->parent = dwg;
               dwg_free_object (oldobj);
-              obj = oldobj;
               i--;
             }
           if (oldobj->fixedtype == DWG_TYPE_SEQEND)
@@ -3215,6 +3487,13 @@ json_OBJECTS (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
             }
           */
         }
+      // a skipped object slot is reused, else add one
+      if (i >= (int)dwg->num_objects && dwg_add_object (dwg) > 0)
+        {
+          LOG_ERROR ("Out of memory");
+          return DWG_ERR_OUTOFMEM;
+        }
+      obj = &dwg->object[i];
 
       memset (obj, 0, sizeof (Dwg_Object));
       t = &tokens->tokens[tokens->index];
@@ -3228,7 +3507,7 @@ json_OBJECTS (Bit_Chain *restrict dat, Dwg_Data *restrict dwg,
           JSON_TOKENS_CHECK_OVERFLOW (goto typeerr)
         }
       keys = t->size;
-      LOG_HANDLE ("\n-keys: %d, object %d of %d\n", keys, i, size);
+      LOG_HANDLE ("\n-keys: %d, object %d\n", keys, i);
 
       tokens->index++;
       for (int j = 0; j < keys; j++)
@@ -5321,61 +5600,47 @@ json_free_globals (jsmntokens_t *tokens)
 {
   if (tokens)
     free (tokens->tokens);
-  free (created_by);
 }
 
 EXPORT int
 dwg_read_json (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
 {
-  Dwg_Header *obj = &dwg->header;
-  jsmn_parser parser;
   jsmntokens_t tokens;
-  unsigned int i;
+  size_t input_size;
   int error = -1;
-  created_by = NULL;
 
   dwg->opts |= (loglevel | DWG_OPTS_INJSON);
   dat->opts |= (loglevel | DWG_OPTS_INJSON);
   loglevel = dwg->opts & 0xf;
+  memset (&tokens, 0, sizeof (tokens));
   if (dat->fh && (!dat->chain || !*dat->chain))
     {
-      error = dat_read_stream (dat, dat->fh);
-      if (error >= DWG_ERR_CRITICAL)
-        return error;
-      LOG_TRACE ("  json file size: %" PRIuSIZE "\n", dat->size);
-    }
-  g_dat = dat;
-
-  jsmn_init (&parser);
-  // How big will it be? This is the max. memory variant.
-  // we could also use less, see jsmn/examples/jsondump.c for small devices.
-  tokens.num_tokens
-      = jsmn_parse (&parser, (char *)dat->chain, dat->size, NULL, 0);
-  if (tokens.num_tokens <= 0)
-    {
-      const long remaining = (long)(dat->size - parser.pos);
-      if (parser.pos > 10 && remaining > 10)
+      // stream it, in one pass over a sliding window of the file
+      struct_stat_t attrib;
+      tokens.fh = dat->fh;
+      tokens.alloced_chain = 2 * JSON_CHUNK;
+      free (dat->chain);
+      dat->chain = (unsigned char *)calloc (tokens.alloced_chain, 1);
+      if (!dat->chain)
         {
-          char err[21];
-          memcpy (&err, &dat->chain[parser.pos - 10], 20);
-          err[20] = 0;
-          LOG_ERROR ("Invalid json. jsmn error at pos: %u (... %s ...)",
-                     parser.pos, err);
-        }
-      else
-        {
-          LOG_ERROR ("Invalid json. jsmn error at pos: %u (%.*s ...)",
-                     parser.pos, (int)remaining, &dat->chain[parser.pos]);
+          LOG_ERROR ("Out of memory");
+          return DWG_ERR_OUTOFMEM;
         }
-      return DWG_ERR_INVALIDDWG;
+      dat->size = 0;
+      dat->byte = 0;
+      input_size
+          = fstat (fileno (dat->fh), &attrib) ? 0 : (size_t)attrib.st_size;
+      LOG_TRACE ("  json file size: %" PRIuSIZE "\n", input_size);
     }
-  LOG_TRACE ("  num_tokens: %ld\n", tokens.num_tokens);
-  tokens.tokens
-      = (jsmntok_t *)calloc (tokens.num_tokens + 1024, sizeof (jsmntok_t));
+  else
+    input_size = dat->size;
+  tokens.alloced = 1024;
+  tokens.tokens = (jsmntok_t *)calloc (tokens.alloced, sizeof (jsmntok_t));
   if (!tokens.tokens)
     return DWG_ERR_OUTOFMEM;
 
-  dwg->object_map = hash_new (tokens.num_tokens / 50);
+  // about one object per 500 bytes of JSON
+  dwg->object_map = hash_new (input_size / 500);
   if (!dwg->object_map) // we are obviously on a tiny system
     {
       dwg->object_map = hash_new (1024);
@@ -5386,7 +5651,6 @@ dwg_read_json (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
           return DWG_ERR_OUTOFMEM;
         }
     }
-  dwg->dirty_refs = 1;
   // set the target version earlier (than e.g. in DXF)
   // we cannot write DWG >= R_2004 yet. avoid widestrings for now
   /* if (!dwg->header.version)
@@ -5394,35 +5658,13 @@ dwg_read_json (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
   */
   dat->version = R_2000;
 
-  jsmn_init (&parser); // reset pos to 0
-  error = jsmn_parse (&parser, (char *)dat->chain, dat->size, tokens.tokens,
-                      (unsigned int)tokens.num_tokens);
-  if (error < 0)
+  error = json_tokens_get (dat, &tokens, false);
+  if (error <= 0 || tokens.tokens[0].type != JSMN_OBJECT)
     {
-      const long remaining = (long)(dat->size - parser.pos);
-      if (parser.pos > 10 && remaining > 10)
-        {
-          char err[21];
-          memcpy (&err, &dat->chain[parser.pos - 10], 20);
-          err[20] = 0;
-          LOG_ERROR ("Invalid json. jsmn error %d at the %u-th token, pos: %u "
-                     "(... %s ...)",
-                     error, parser.toknext, parser.pos, err);
-        }
+      if (error < 0)
+        json_tokens_error (dat, &tokens, error);
       else
-        {
-          LOG_ERROR ("Invalid json. jsmn error %d at the %u-th token, pos: %u "
-                     "(%.*s ...)",
-                     error, parser.toknext, parser.pos, (int)remaining,
-                     &dat->chain[parser.pos]);
-        }
-      json_free_globals (&tokens);
-      return DWG_ERR_INVALIDDWG;
-    }
-
-  if (tokens.tokens[0].type != JSMN_OBJECT)
-    {
-      fprintf (stderr, "First JSON element is not an object/hash\n");
+        fprintf (stderr, "First JSON element is not an object/hash\n");
       json_free_globals (&tokens);
       return DWG_ERR_INVALIDDWG;
     }
@@ -5435,16 +5677,26 @@ dwg_read_json (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
   //                  ObjFreeSpace, Template,
   //                  AuxHeader, SecondHeader
   // section arrays: CLASSES, OBJECTS, HANDLES
+  // Each key is tokenized with its whole value, only OBJECTS is streamed
+  // object by object.
   error = 0;
-  for (tokens.index = 1; tokens.index < (unsigned int)tokens.num_tokens;
-       tokens.index++)
+  for (tokens.index = 1;; tokens.index++)
     {
       char key[80];
-      const jsmntok_t *t = &tokens.tokens[tokens.index];
-      const int len = t->end - t->start;
+      const jsmntok_t *t;
+      int len, ret;
 
-      if (t->type == JSMN_UNDEFINED)
+      json_tokens_slide (dat, &tokens);
+      ret = json_tokens_get (dat, &tokens, false);
+      if (ret == 0) // end of the first level object
         break;
+      if (ret < 0)
+        {
+          json_tokens_error (dat, &tokens, ret);
+          json_free_globals (&tokens);
+          return DWG_ERR_INVALIDDWG;
+        }
+      t = &tokens.tokens[tokens.index];
       if (t->type != JSMN_STRING)
         {
           LOG_ERROR ("Unexpected JSON key at %u of %ld tokens, got %s",
@@ -5456,6 +5708,7 @@ dwg_read_json (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
           dwg_free (dwg);
           return DWG_ERR_INVALIDDWG;
         }
+      len = t->end - t->start;
       if (len >= 80)
         {
           LOG_ERROR ("Unknown JSON key at %u of %ld tokens, len %d > 80",
@@ -5466,8 +5719,16 @@ dwg_read_json (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
       memcpy (key, &dat->chain[t->start], len);
       key[len] = '\0';
       tokens.index++;
-      if (tokens.index > (unsigned int)tokens.num_tokens)
+      ret = json_tokens_get (dat, &tokens, false);
+      if (ret > 0
+          && (strNE (key, "OBJECTS")
+              || tokens.tokens[tokens.index].type != JSMN_ARRAY
+              || dwg->num_objects))
+        ret = json_tokens_get (dat, &tokens, true);
+      if (ret <= 0)
         {
+          if (ret < 0)
+            json_tokens_error (dat, &tokens, ret);
           LOG_ERROR ("Unexpected end of JSON at %u of %ld tokens %s:%d",
                      tokens.index, tokens.num_tokens, __FILE__, __LINE__);
           json_free_globals (&tokens);
@@ -5533,11 +5794,12 @@ dwg_read_json (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
     }
 
   LOG_TRACE ("\n");
+  LOG_HANDLE ("Resolving pointers from ObjectRef vector:\n");
+  dwg_resolve_objectrefs_silent (dwg);
   if (dat->version <= R_2000 && dwg->header.from_version > R_2000)
     dwg_fixup_BLOCKS_entities (dwg);
 
   json_free_globals (&tokens);
-  created_by = NULL;
   return error;
 }
 
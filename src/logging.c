@@ -28,7 +28,7 @@
 /* The central logging level for all modules. */
 // #if !defined COMMON_TEST_C && !defined DECODE_TEST_C && !defined
 // ENCODE_TEST_C
-EXPORT unsigned int loglevel;
+EXPORT LOGLEVEL_THREAD_LOCAL unsigned int loglevel;
 // #endif
 
 void ATTRIBUTE_FORMAT (2, 3)
@@ -30,7 +30,7 @@
 #endif
 
 #include "codepages.h"
-#include "common.h"
+#include "common.h" // THREAD_LOCAL, EXPORT
 
 /*
  * If more logging levels are necessary, put them in the right place and
@@ -52,9 +52,20 @@
 #  define DWG_LOGLEVEL DWG_LOGLEVEL_ERROR
 #endif
 
-#if !defined COMMON_C && !defined COMMON_TEST_C && !defined DECODE_TEST_C     \
-    && !defined ENCODE_TEST_C
-EXPORT extern unsigned int loglevel;
+/* The loglevel of the drawing processed in the current thread, as set from
+   its opts by the API functions. Windows DLLs cannot export thread-local
+   variables, so with a shared libredwg on Windows it is one global for all
+   threads. */
+#ifndef THREAD_LOCAL
+#  error THREAD_LOCAL undefined, common.h not included
+#endif
+#if (defined _WIN32 || defined __CYGWIN__) && defined ENABLE_SHARED
+#  define LOGLEVEL_THREAD_LOCAL
+#else
+#  define LOGLEVEL_THREAD_LOCAL THREAD_LOCAL
+#endif
+#if !defined COMMON_C && !defined COMMON_TEST_C
+EXPORT extern LOGLEVEL_THREAD_LOCAL unsigned int loglevel;
 #endif
 
 /* Logging functions defined in logging.c (use runtime loglevel from common.c)
@@ -45,9 +45,9 @@
 #include "logging.h"
 
 /* the current version per spec block */
-static unsigned int cur_ver = 0;
-static char buf[255];
-static BITCODE_BL rcount1, rcount2;
+static THREAD_LOCAL unsigned int cur_ver = 0;
+static THREAD_LOCAL char buf[255];
+static THREAD_LOCAL BITCODE_BL rcount1, rcount2;
 
 // imported
 char *dwg_obj_table_get_name (const Dwg_Object *restrict obj,
@@ -1393,7 +1393,10 @@ cquote (char *restrict dest, const size_t len, const char *restrict src)
       else
         *dest++ = c;
     }
-  d[len - 1] = '\0'; // add final delim, skipped above
+  if (dest < dend)
+    *dest = '\0';
+  else
+    d[len - 1] = '\0'; // add final delim, skipped above
   return d;
 }
 
@@ -1432,7 +1435,7 @@ dxf_needs_cquote (const char *restrict str)
 static BITCODE_RLL
 dxf_fixup_zero_handle (const Dwg_Object *restrict obj)
 {
-  static BITCODE_RLL last = 0;
+  static THREAD_LOCAL BITCODE_RLL last = 0;
   Dwg_Object *o = (Dwg_Object *)obj;
   BITCODE_RLL next = dwg_next_handle (obj->parent);
   if (next <= last)
@@ -1862,7 +1865,7 @@ dxf_cvt_tablerecord (Bit_Chain *restrict dat, const Dwg_Object *restrict obj,
 static void
 dxf_cvt_blockname (Bit_Chain *restrict dat, char *restrict name, const int dxf)
 {
-  static int gensym = 0;
+  static THREAD_LOCAL int gensym = 0;
   if (!name)
     {
       fprintf (dat->fh, "%3i\r\n*U%i\r\n", dxf, gensym++);
@@ -2040,7 +2043,7 @@ new_encr_sat_data_line (Dwg_Entity_3DSOLID *restrict _obj, Bit_Chain *dest,
 static const char *
 SAT_boolean (const char *act_record, bool value)
 {
-  static int argc = 0;
+  static THREAD_LOCAL int argc = 0;
   if (!strEQc (act_record, "varblendsplsur") && !strEQc (act_record, "face")
       && !strEQc (act_record, "bdy_geom"))
     argc = 0;
@@ -4217,8 +4220,6 @@ dwg_write_dxf (Bit_Chain *restrict dat, Dwg_Data *restrict dwg)
   loglevel = dwg->opts & DWG_OPTS_LOGLEVEL;
   if (dat->from_version == R_INVALID)
     dat->from_version = dwg->header.from_version;
-  if (dwg->dirty_refs)
-    dwg_resolve_objectrefs_silent (dwg);
   if (dwg->header.version <= R_2000 && dwg->header.from_version > R_2000)
     dwg_fixup_BLOCKS_entities (dwg);
 
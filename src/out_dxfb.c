@@ -33,9 +33,9 @@
 #include "logging.h"
 
 /* the current version per spec block. */
-static unsigned int cur_ver = 0;
-static char buf[4096];
-static BITCODE_BL rcount1, rcount2;
+static THREAD_LOCAL unsigned int cur_ver = 0;
+static THREAD_LOCAL char buf[4096];
+static THREAD_LOCAL BITCODE_BL rcount1, rcount2;
 
 // imported
 char *dwg_obj_table_get_name (const Dwg_Object *restrict obj,
@@ -38,8 +38,8 @@
 #include "logging.h"
 
 /* the current version per spec block */
-static unsigned int cur_ver = 0;
-static BITCODE_BL rcount1, rcount2;
+static THREAD_LOCAL unsigned int cur_ver = 0;
+static THREAD_LOCAL BITCODE_BL rcount1, rcount2;
 
 /* see also examples/unknown.c */
 static void print_wcquote (Bit_Chain *restrict dat,
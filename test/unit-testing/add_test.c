@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
 #include <assert.h>
 #ifndef _WIN32
 #  include <setjmp.h>
@@ -1478,6 +1479,162 @@ test_mlinestyle_obj_realloc (void)
   return numfailed ();
 }
 
+// Adding many entities moves dwg->object[] several times. All the cached
+// ref->obj pointers must be rebased into the new pool, without any full
+// re-resolution of all refs.
+static int
+test_many_objects_refs (void)
+{
+  Dwg_Data *dwg;
+  Dwg_Object *mspace;
+  Dwg_Object_BLOCK_HEADER *hdr;
+  Dwg_Object_Ref *mspace_ref;
+  const int num = 100000;
+  dwg_point_3d start = { 0.0, 0.0, 0.0 };
+  dwg_point_3d end = { 1.0, 1.0, 0.0 };
+  BITCODE_BL bad = 0, resolved = 0, mspace_index;
+  clock_t t0;
+  double secs;
+  int i;
+
+  failed = 0;
+  dwg = dwg_new_Document (R_2000, 0, tracelevel);
+  mspace = dwg_model_space_object (dwg);
+  if (!mspace)
+    {
+      fail ("many_objects_refs: empty mspace");
+      dwg_free (dwg);
+      free (dwg);
+      return numfailed ();
+    }
+  hdr = mspace->tio.object->tio.BLOCK_HEADER;
+  mspace_index = mspace->index; // mspace itself will move
+  mspace_ref = dwg_model_space_ref (dwg);
+  t0 = clock ();
+  for (i = 0; i < num; i++)
+    {
+      start.x = (double)i;
+      if (!dwg_add_LINE (hdr, &start, &end))
+        {
+          fail ("many_objects_refs: dwg_add_LINE %d", i);
+          break;
+        }
+    }
+  secs = (double)(clock () - t0) / CLOCKS_PER_SEC;
+  loglevel = is_make_silent () ? 0 : 2; // reset by the add API
+  for (BITCODE_BL j = 0; j < dwg->num_object_refs; j++)
+    {
+      Dwg_Object_Ref *ref = dwg->object_ref[j];
+      if (!ref->obj)
+        continue;
+      resolved++;
+      if (ref->obj < dwg->object || ref->obj >= &dwg->object[dwg->num_objects]
+          || ref->obj->handle.value != ref->absolute_ref)
+        bad++;
+    }
+  if (bad)
+    fail ("many_objects_refs: %u of %u ref->obj stale after %u objects",
+          (unsigned)bad, (unsigned)resolved, (unsigned)dwg->num_objects);
+  else if (dwg_model_space_ref (dwg) != mspace_ref
+           || dwg_ref_object (dwg, mspace_ref)
+                  != &dwg->object[mspace_index])
+    fail ("many_objects_refs: *Model_Space ref moved");
+  else
+    ok ("many_objects_refs: %u ref->obj valid after %d LINEs in %.3fs",
+        (unsigned)resolved, num, secs);
+  dwg_free (dwg);
+  free (dwg);
+  return numfailed ();
+}
+
+// Many table records and dictionary entries, looked up case-insensitively
+// via the name index, which must follow added, renamed and not yet named
+// entries.
+static int
+test_tablehandle_index (void)
+{
+  Dwg_Data *dwg;
+  const int num = 4000;
+  char name[32];
+  BITCODE_H ref;
+  Dwg_Object *obj;
+  Dwg_Object_LAYER *layer = NULL;
+  BITCODE_T newname = (BITCODE_T) "Renamed";
+  int found = 0, bad = 0, i;
+  clock_t t0;
+  double secs;
+
+  failed = 0;
+  dwg = dwg_new_Document (R_2000, 0, tracelevel);
+  for (i = 0; i < num; i++)
+    {
+      snprintf (name, sizeof (name), "Layer_%d", i);
+      layer = dwg_add_LAYER (dwg, name);
+      // the index is there after the first lookup, and must add the others
+      if (i == num / 2 && !dwg_find_tablehandle (dwg, "layer_0", "LAYER"))
+        bad++;
+    }
+  for (i = 0; i < 20; i++)
+    {
+      snprintf (name, sizeof (name), "MLStyle_%d", i);
+      if (!dwg_add_MLINESTYLE (dwg, name))
+        bad++;
+    }
+  t0 = clock ();
+  for (i = 0; i < num; i++)
+    {
+      snprintf (name, sizeof (name), "LAYER_%d", i);
+      ref = dwg_find_tablehandle (dwg, name, "LAYER");
+      obj = ref ? dwg_ref_object (dwg, ref) : NULL;
+      if (obj && obj->fixedtype == DWG_TYPE_LAYER
+          && !strcasecmp (obj->tio.object->tio.LAYER->name, name))
+        found++;
+    }
+  secs = (double)(clock () - t0) / CLOCKS_PER_SEC;
+  if (dwg_find_tablehandle (dwg, "Layer_x", "LAYER"))
+    bad++;
+  if (!dwg_find_tablehandle (dwg, "mlstyle_19", "MLINESTYLE")
+      || dwg_find_tablehandle (dwg, "MLStyle_20", "MLINESTYLE"))
+    bad++;
+  // the last layer renamed via the dynapi
+  snprintf (name, sizeof (name), "Layer_%d", num - 1);
+  dwg_dynapi_entity_set_value (layer, "LAYER", "name", &newname, 1);
+  if (dwg_find_tablehandle (dwg, name, "LAYER")
+      || !dwg_find_tablehandle (dwg, "RENAMED", "LAYER"))
+    bad++;
+  // the first layer renamed directly in its struct
+  obj = dwg_ref_object (dwg, dwg_find_tablehandle (dwg, "Layer_0", "LAYER"));
+  if (obj)
+    {
+      free (obj->tio.object->tio.LAYER->name);
+      obj->tio.object->tio.LAYER->name = strdup ("Direct");
+    }
+  ref = dwg_find_tablehandle (dwg, "direct", "LAYER");
+  if (!obj || dwg_find_tablehandle (dwg, "Layer_0", "LAYER") || !ref
+      || ref->absolute_ref != obj->handle.value)
+    bad++;
+  // a new layer without a name yet, as not yet decoded, and one after it
+  layer = dwg_add_LAYER (dwg, "Unnamed");
+  dwg_add_LAYER (dwg, "After");
+  newname = layer->name;
+  layer->name = NULL;
+  if (!dwg_find_tablehandle (dwg, "after", "LAYER")
+      || dwg_find_tablehandle (dwg, "unnamed", "LAYER"))
+    bad++;
+  layer->name = newname;
+  if (!dwg_find_tablehandle (dwg, "unnamed", "LAYER"))
+    bad++;
+  loglevel = is_make_silent () ? 0 : 2; // reset by the add API
+  if (found != num || bad)
+    fail ("tablehandle_index: %d of %d layers found, %d bad", found, num,
+          bad);
+  else
+    ok ("tablehandle_index: %d layers found in %.3fs", num, secs);
+  dwg_free (dwg);
+  free (dwg);
+  return numfailed ();
+}
+
 #ifndef DISABLE_DXF
 // GHSA-qcxp-m6vj-h5h8: importing a pre-R2004 DXF VIEWPORT entity makes
 // new_object() call dwg_add_VX() to create its VX_TABLE_RECORD. That may
@@ -1558,6 +1715,8 @@ main (int argc, char *argv[])
 #else
   error = test_mlinestyle_obj_realloc ();
 #endif
+  error += test_many_objects_refs ();
+  error += test_tablehandle_index ();
   error += test_names ();
   error += test_api_version ();
 
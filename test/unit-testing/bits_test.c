@@ -1,4 +1,5 @@
 #define BITS_TEST_C
+#define _DEFAULT_SOURCE 1 // for DT_DIR
 #include "config.h"
 #include "bits.h"
 #include "common.h"
@@ -8,6 +9,7 @@
 #include <stdlib.h>
 #include "tests_common.h"
 #include <assert.h>
+#include <time.h>
 
 static void
 bit_advance_position_tests (void)
@@ -955,7 +957,7 @@ bit_utf8_to_TV_tests (void)
     fail ("bit_utf8_to_TV %s as CP949", p);
   p = bit_utf8_to_TV (dest, (const unsigned char *)"시험", sizeof (dest),
                       strlen ("시험"), 0, CP_CP949);
-  if (strEQc (p, "\xdc\xc3\x7e\xe8"))
+  if (strEQc (p, "\xbd\xc3\xc7\xe8"))
     pass ();
   else
     fail ("bit_utf8_to_TV %s as CP949", p);
@@ -1211,6 +1213,79 @@ bit_TV_to_utf8_tests (void)
   }
 }
 
+/* Strings in several codepages, converted to UTF-8 and back, and then many
+   times as a benchmark. */
+static void
+bit_TV_to_utf8_codepages_tests (void)
+{
+  static const struct
+  {
+    Dwg_Codepage cp;
+    const char *tv;
+    const char *utf8;
+  } corpus[] = {
+    { CP_ANSI_1252, "Wand\xe4nde \xff \x80 Stra\xdf" "e", "Wandände ÿ € Straße" },
+    { CP_ANSI_1252, "Layer 0", "Layer 0" },
+    { CP_ANSI_1252, "a\x81" "b", "ab" }, // not in the codepage
+    { CP_ANSI_1251, "\xcf\xf0\xe8\xe2\xe5\xf2 \xec\xe8\xf0", "Привет мир" },
+    { CP_ANSI_1250, "\xa3\xf3" "d\x9f \x8elu\x9d", "Łódź Žluť" },
+    { CP_ISO_8859_7, "\xe1\xe2\xe3 \xbf", "αβγ Ώ" },
+    { CP_CP437, "Gr\x94\xe1" "e \xab", "Größe ½" },
+    { CP_ANSI_932, "\x83\x82\x83m", "モノ" },
+    { CP_ANSI_936, "\xd6\xd0\xce\xc4", "中文" },
+    { CP_ANSI_949, "\xc7\xd1\xb1\xb9\xbe\xee", "한국어" },
+  };
+  const int num = (int)ARRAY_SIZE (corpus);
+  const int rounds = 20000;
+  int bad = 0;
+  clock_t t0;
+  double secs;
+
+  for (int i = 0; i < num; i++)
+    {
+      char dest[64];
+      char *p = bit_TV_to_utf8 (corpus[i].tv, corpus[i].cp);
+      if (!p || strNE (p, corpus[i].utf8))
+        {
+          fail ("bit_TV_to_utf8 %s as %s: %s", corpus[i].tv,
+                dwg_codepage_dxfstr (corpus[i].cp), p ? p : "NULL");
+          bad++;
+        }
+      if (p && p != corpus[i].tv)
+        free (p);
+      if (i == 2) // not reversible
+        continue;
+      // and back, the last entries of the tables also
+      p = bit_utf8_to_TV (dest, (const unsigned char *)corpus[i].utf8,
+                          sizeof (dest), strlen (corpus[i].utf8), 0,
+                          corpus[i].cp);
+      if (!p || strNE (p, corpus[i].tv))
+        {
+          fail ("bit_utf8_to_TV %s as %s: %s", corpus[i].utf8,
+                dwg_codepage_dxfstr (corpus[i].cp), p ? p : "NULL");
+          bad++;
+        }
+    }
+  // the ASCII fast path
+  if (bit_TV_to_utf8 (corpus[1].tv, CP_ANSI_1252) != corpus[1].tv)
+    {
+      fail ("bit_TV_to_utf8 ASCII as ANSI_1252: not src");
+      bad++;
+    }
+  if (bad)
+    return;
+  t0 = clock ();
+  for (int r = 0; r < rounds; r++)
+    for (int i = 0; i < num; i++)
+      {
+        char *p = bit_TV_to_utf8 (corpus[i].tv, corpus[i].cp);
+        if (p && p != corpus[i].tv)
+          free (p);
+      }
+  secs = (double)(clock () - t0) / CLOCKS_PER_SEC;
+  ok ("bit_TV_to_utf8 codepages: %d strings in %.3fs", rounds * num, secs);
+}
+
 static void
 bit_read_TV_tests (void)
 {
@@ -1588,6 +1663,52 @@ bit_read_MC_tests (void)
            268435455);
 }
 
+/* Writing a big chain byte by byte must grow it geometrically, not by a
+   realloc and copy for each page. */
+static void
+bit_chain_alloc_tests (void)
+{
+  Bit_Chain dat = { 0 };
+  const size_t size = 10 * 1024 * 1024;
+  size_t num_reallocs, copied, i;
+  int fails = 0;
+
+  dat.version = dat.from_version = R_2000;
+  bit_chain_stats_reset ();
+  for (i = 0; i < size; i++)
+    bit_write_RC (&dat, (unsigned char)(i & 0xff));
+  bit_chain_stats (&num_reallocs, &copied);
+  for (i = 0; i < size; i += 4099)
+    if (dat.chain[i] != (unsigned char)(i & 0xff))
+      fails++;
+  if (fails || dat.byte != size)
+    fail ("bit_chain_alloc: %d wrong bytes @%" PRIuSIZE, fails, dat.byte);
+  // 4096 doubled to 16MB, and the old data copied once or twice
+  else if (num_reallocs > 12 || copied > 2 * size)
+    fail ("bit_chain_alloc: %" PRIuSIZE " reallocs, %" PRIuSIZE
+          " bytes copied for %" PRIuSIZE,
+          num_reallocs, copied, size);
+  else
+    ok ("bit_chain_alloc: %" PRIuSIZE " reallocs, %" PRIuSIZE
+        " bytes copied for %" PRIuSIZE,
+        num_reallocs, copied, size);
+
+  // reserve grows only when needed
+  bit_chain_stats_reset ();
+  bit_chain_reserve (&dat, dat.size - dat.byte - 1);
+  bit_chain_stats (&num_reallocs, &copied);
+  if (num_reallocs)
+    fail ("bit_chain_reserve: %" PRIuSIZE " reallocs", num_reallocs);
+  bit_chain_reserve (&dat, dat.size);
+  bit_chain_stats (&num_reallocs, &copied);
+  if (num_reallocs == 1 && dat.byte + (dat.size / 2) < dat.size)
+    pass ();
+  else
+    fail ("bit_chain_reserve: %" PRIuSIZE " reallocs, size %" PRIuSIZE,
+          num_reallocs, dat.size);
+  bit_chain_free (&dat);
+}
+
 static void
 in_hexbin_tests (void)
 {
@@ -1658,6 +1779,187 @@ in_hexbin_tests (void)
   free (dat.chain);
 }
 
+/* The inlined fast readers of bits.h: compare them with the bits.c readers
+   over all test-data DWGs, read as bit streams, and time both. */
+typedef struct _bits_corpus
+{
+  unsigned char **bufs;
+  size_t *sizes;
+  unsigned num;
+  size_t total;
+} Bits_Corpus;
+
+enum bits_fast_type
+{
+  FAST_B,
+  FAST_BB,
+  FAST_RC,
+  FAST_BS,
+  FAST_BL,
+  FAST_BD,
+  FAST_MC,
+  FAST_H,
+  NUM_FAST
+};
+static const char *const fast_names[]
+    = { "B", "BB", "RC", "BS", "BL", "BD", "MC", "H" };
+
+static void
+bits_add_corpus (const char *path, void *arg)
+{
+  Bits_Corpus *c = (Bits_Corpus *)arg;
+  size_t size;
+  unsigned char *buf = test_read_file (path, &size);
+  if (!buf)
+    return;
+  c->bufs = (unsigned char **)realloc (c->bufs, (c->num + 1)
+                                                    * sizeof (unsigned char *));
+  c->sizes = (size_t *)realloc (c->sizes, (c->num + 1) * sizeof (size_t));
+  c->bufs[c->num] = buf;
+  c->sizes[c->num++] = size;
+  c->total += size;
+}
+
+/* Reads one type with the inlined or the bits.c reader, as raw bits */
+static uint64_t
+bits_read_type (Bit_Chain *dat, const enum bits_fast_type type,
+                const int fast)
+{
+  union
+  {
+    uint64_t u;
+    double d;
+  } u;
+  Dwg_Handle h;
+  int error;
+  switch (type)
+    {
+    case FAST_B:
+      return fast ? bit_read_B_fast (dat) : bit_read_B (dat);
+    case FAST_BB:
+      return fast ? bit_read_BB_fast (dat) : bit_read_BB (dat);
+    case FAST_RC:
+      return fast ? bit_read_RC_fast (dat) : bit_read_RC (dat);
+    case FAST_BS:
+      return fast ? bit_read_BS_fast (dat) : bit_read_BS (dat);
+    case FAST_BL:
+      return fast ? bit_read_BL_fast (dat) : bit_read_BL (dat);
+    case FAST_BD:
+      u.d = fast ? bit_read_BD_fast (dat) : bit_read_BD (dat);
+      return u.u;
+    case FAST_MC:
+      return (uint32_t)(fast ? bit_read_MC_fast (dat) : bit_read_MC (dat));
+    case FAST_H:
+      memset (&h, 0, sizeof (h));
+      error = fast ? bit_read_H_fast (dat, &h) : bit_read_H (dat, &h);
+      // the value may use all 64 bits
+      return (h.value * 31) ^ ((uint64_t)h.code << 8) ^ ((uint64_t)h.size << 4)
+             ^ (uint64_t)h.is_global ^ (uint64_t)error;
+    case NUM_FAST:
+    default:
+      return 0;
+    }
+}
+
+static void
+bits_fast_init (Bit_Chain *dat, const Bits_Corpus *c, const unsigned i,
+                const unsigned bit)
+{
+  memset (dat, 0, sizeof (Bit_Chain));
+  dat->chain = c->bufs[i];
+  dat->size = c->sizes[i];
+  dat->bit = bit;
+  dat->version = dat->from_version = R_2000;
+}
+
+static double
+bits_fast_time (const Bits_Corpus *c, const enum bits_fast_type type,
+                const int fast, size_t *reads)
+{
+  volatile uint64_t sink = 0;
+  uint64_t sum = 0;
+  clock_t start = clock ();
+  *reads = 0;
+  // enough for a stable time
+  for (unsigned i = 0; i < c->num && *reads < 0x400000; i++)
+    {
+      Bit_Chain dat;
+      bits_fast_init (&dat, c, i, 0);
+      while (bit_fast_p (&dat) && *reads < 0x400000)
+        {
+          sum += bits_read_type (&dat, type, fast);
+          (*reads)++;
+        }
+    }
+  sink = sum;
+  (void)sink;
+  return (double)(clock () - start) / CLOCKS_PER_SEC;
+}
+
+static void
+bit_read_fast_tests (void)
+{
+  Bits_Corpus c;
+  const char *dir = test_data_dir ();
+
+  memset (&c, 0, sizeof (c));
+  if (dir)
+    test_data_dwgs (dir, 1, bits_add_corpus, &c);
+  if (!c.num)
+    {
+      ok ("bit_read_*_fast: skipped, no test-data");
+      return;
+    }
+  loglevel = 0; // invalid codes in the corpus are logged as errors
+  for (int type = 0; type < NUM_FAST; type++)
+    {
+      size_t reads = 0, fast_reads;
+      unsigned failures = 0;
+      double t1, t2;
+      // the same values and positions, from all start bits
+      for (unsigned i = 0; i < c.num && !failures; i++)
+        {
+          Bit_Chain a, b;
+          bits_fast_init (&a, &c, i, i & 7);
+          bits_fast_init (&b, &c, i, i & 7);
+          while (bit_fast_p (&a))
+            {
+              const size_t pos = bit_position (&a);
+              const uint64_t v1 = bits_read_type (&a, type, 1);
+              const uint64_t v2 = bits_read_type (&b, type, 0);
+              if (v1 != v2 || a.byte != b.byte || a.bit != b.bit)
+                {
+                  reset_loglevel ();
+                  fail ("bit_read_%s_fast file %u @%" PRIuSIZE ".%u: %" PRIx64
+                        " != %" PRIx64 ", @%" PRIuSIZE ".%u",
+                        fast_names[type], i, pos / 8, (unsigned)(pos % 8), v1,
+                        v2, b.byte, (unsigned)b.bit);
+                  loglevel = 0;
+                  failures++;
+                  break;
+                }
+              reads++;
+            }
+        }
+      if (failures)
+        continue;
+      t1 = bits_fast_time (&c, type, 0, &fast_reads);
+      t2 = bits_fast_time (&c, type, 1, &fast_reads);
+      reset_loglevel ();
+      ok ("bit_read_%s_fast: %" PRIuSIZE " reads of %u DWGs identical, "
+          "%.0f M/s (bits.c %.0f M/s)",
+          fast_names[type], reads, c.num,
+          t2 > 0.0 ? (double)fast_reads / t2 / 1e6 : 0.0,
+          t1 > 0.0 ? (double)fast_reads / t1 / 1e6 : 0.0);
+      loglevel = 0;
+    }
+  reset_loglevel ();
+  for (unsigned i = 0; i < c.num; i++)
+    free (c.bufs[i]);
+  free (c.bufs);
+  free (c.sizes);
+}
+
 int
 main (int argc, char const *argv[])
 {
@@ -1702,6 +2004,7 @@ main (int argc, char const *argv[])
   bit_utf8_to_TV_tests ();
   bit_utf8_to_TU_tests ();
   bit_TV_to_utf8_tests ();
+  bit_TV_to_utf8_codepages_tests ();
   bit_read_H_tests ();
   bit_write_H_tests ();
   bit_UMC_bug_tests ();
@@ -1716,6 +2019,9 @@ main (int argc, char const *argv[])
   bit_read_UMC_tests ();
   bit_read_MC_tests ();
   in_hexbin_tests ();
+  loglevel = is_make_silent () ? 0 : 3; // reset by the overflow errors
+  bit_chain_alloc_tests ();
+  bit_read_fast_tests ();
 
   // Prepare the testcase
   bitchain.size = 100;
@@ -2071,8 +2377,8 @@ main (int argc, char const *argv[])
       fail ("bit_calc_CRC %04X", check);
   }
 
-  bit_chain_alloc (&bitchain);
-  if (bitchain.size == 8292)
+  bit_chain_alloc (&bitchain); // by its current size, 4196
+  if (bitchain.size == 8392)
     pass ();
   else
     fail ("bit_chain_alloc %" PRIuSIZE, bitchain.size);
@@ -7,7 +7,7 @@
 #include "../../src/common.c"
 #include "../../programs/escape.c"
 
-extern unsigned int loglevel;
+extern LOGLEVEL_THREAD_LOCAL unsigned int loglevel;
 
 #include "tests_common.h"
 
@@ -245,6 +245,138 @@ common_strcasecmp_tests (void)
     ok ("my_strcasecmp");
 }
 
+/* Compares dwg_strtod with strtod bitwise, and their endptr */
+static int
+strtod_case (const char *s)
+{
+  char *end1, *end2;
+  const double d1 = strtod (s, &end1);
+  const double d2 = dwg_strtod (s, &end2);
+  if (memcmp (&d1, &d2, sizeof (double)) || end1 != end2)
+    {
+      fail ("dwg_strtod %s => %.17g +%d, not %.17g +%d", s, d2,
+            (int)(end2 - s), d1, (int)(end1 - s));
+      return 1;
+    }
+  return 0;
+}
+
+static void
+common_strtod_tests (void)
+{
+  static const char *const cases[]
+      = { "0",
+          "-0",
+          "-0.0",
+          "+1",
+          "1.",
+          ".5",
+          "-.5e1",
+          ".",
+          "-",
+          "e5",
+          "1e",
+          "1e+",
+          "1.5e-",
+          "  \t12.5",
+          "12.5x",
+          "12.5\r\n",
+          "0.1",
+          "0.2",
+          "0.3",
+          "1e22",
+          "1e23",
+          "9007199254740993",
+          "9007199254740992.5",
+          "18446744073709551615",
+          "1234567890123456789",
+          "12345678901234567890",
+          "0.00000000000000000001234",
+          "1e-19",
+          "1e-20",
+          "4.9e-324",
+          "2.2250738585072014e-308",
+          "1.7976931348623157e308",
+          "1e400",
+          "-1e-400",
+          "1e99999",
+          "2.47032822920623272e-324",
+          "0.500000000000000166533453693773481063544750213623046875",
+          "3.14159265358979323846",
+          "100000000000000000000000",
+          "000000000000000000000001.5",
+          "1.0000000000000000000000",
+          "inf",
+          "-Infinity",
+          "nan",
+          "0x1p3",
+          "0X10",
+          "1,5" };
+  unsigned failures = 0;
+  uint64_t x = 0x9E3779B97F4A7C15ULL;
+  for (int i = 0; i < ARRAY_SIZE (cases); i++)
+    failures += strtod_case (cases[i]);
+  for (unsigned i = 0; i < 50000; i++)
+    {
+      char s[400];
+      double d;
+      uint64_t bits;
+      // xorshift64
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      bits = x;
+      memcpy (&d, &bits, sizeof (d));
+      if (d != d || d - d != 0.0) // nan, inf
+        continue;
+      snprintf (s, sizeof (s), "%.17g", d);
+      failures += strtod_case (s);
+      snprintf (s, sizeof (s), "%.15g", d);
+      failures += strtod_case (s);
+      // typical DXF coordinates and random digits with exponents
+      snprintf (s, sizeof (s), "%.16g", (double)(int64_t)(x >> 20) / 1e6);
+      failures += strtod_case (s);
+      snprintf (s, sizeof (s), "%.6f", (double)(int32_t)x / 1e3);
+      failures += strtod_case (s);
+      snprintf (s, sizeof (s), "%" PRIu64 "e%d", x >> (x & 31),
+                (int)(x % 61) - 30);
+      failures += strtod_case (s);
+      snprintf (s, sizeof (s), "0.%" PRIu64, (uint64_t)(x % 100000000000000000ULL));
+      failures += strtod_case (s);
+      if (failures > 10)
+        break;
+    }
+  if (!failures)
+    ok ("dwg_strtod");
+}
+
+static void
+common_strtol_tests (void)
+{
+  static const char *const cases[]
+      = { "0",     "-0",   "+7",  "  42", "\t-42\n", "330x", "-",
+          "",      "x",    "1e3", "999999999999999999",
+          "9223372036854775807", "9223372036854775808",
+          "-9223372036854775808", "-9223372036854775809",
+          "123456789012345678901234567890" };
+  unsigned failures = 0;
+  for (int i = 0; i < ARRAY_SIZE (cases); i++)
+    {
+      char *end1, *end2;
+      long l1, l2;
+      l1 = strtol (cases[i], &end1, 10);
+      l2 = dwg_strtol (cases[i], &end2);
+      if (l1 != l2 || end1 != end2)
+        {
+          fail ("dwg_strtol %s => %ld +%d, not %ld +%d", cases[i], l2,
+                (int)(end2 - cases[i]), l1, (int)(end1 - cases[i]));
+          failures++;
+        }
+    }
+  if (!failures)
+    ok ("dwg_strtol");
+}
+
 static void
 escape_htmlescape_tests (void)
 {
@@ -294,6 +426,8 @@ main (int argc, char const *argv[])
   common_cvt_TIMEBLL_tests ();
   dwg_find_color_index_tests ();
   common_strcasecmp_tests ();
+  common_strtod_tests ();
+  common_strtol_tests ();
   escape_htmlescape_tests ();
   escape_htmlwescape_tests ();
   return failed;
@@ -10,8 +10,6 @@
 #  define _USE_BSD 1
 #endif
 
-extern unsigned int loglevel;
-
 #define IS_DECODER
 #include <stdlib.h>
 // #include "common.h"
@@ -20,6 +18,7 @@ extern unsigned int loglevel;
 #include "common.c"
 // CLANG_DIAG_RESTORE
 #include "tests_common.h"
+#include <time.h>
 
 static void
 read_literal_length_tests (void)
@@ -215,6 +214,198 @@ decompress_R2004_section_tests (void)
     fail ("decompress_R2004_section ofs %d", result);
 }
 
+/* Differential tests of the pointer-based decompress_R2004_section against
+ * the bytewise reference, over all pages of all r2004+ DWGs in test-data.
+ * Also measures the throughput of both in MB/s of decompressed data.
+ */
+typedef struct _r2004_page
+{
+  const BITCODE_RC *data; // compressed
+  BITCODE_RL comp_size;
+  BITCODE_RL decomp_size;
+} R2004_Page;
+
+typedef struct _r2004_pages
+{
+  R2004_Page *pages;
+  unsigned num_pages;
+  unsigned num_files;
+  BITCODE_RC **files;
+} R2004_Pages;
+
+static void
+add_r2004_page (R2004_Pages *p, const BITCODE_RC *buf, const size_t size,
+                const size_t offset, const BITCODE_RL comp_size,
+                const BITCODE_RL decomp_size)
+{
+  R2004_Page *page;
+  if (offset + comp_size > size || !decomp_size || decomp_size > 0x100000)
+    return;
+  p->pages = (R2004_Page *)realloc (p->pages, (p->num_pages + 1)
+                                                  * sizeof (R2004_Page));
+  page = &p->pages[p->num_pages++];
+  page->data = &buf[offset];
+  page->comp_size = comp_size;
+  page->decomp_size = decomp_size;
+}
+
+static void
+collect_r2004_pages (const char *path, void *arg)
+{
+  R2004_Pages *p = (R2004_Pages *)arg;
+  Dwg_Data dwg;
+  size_t size = 0;
+  BITCODE_RC *buf = test_read_file (path, &size);
+
+  if (!buf || size < 0x100
+      || (memcmp (buf, "AC1018", 6) && memcmp (buf, "AC1024", 6)
+          && memcmp (buf, "AC1027", 6) && memcmp (buf, "AC1032", 6)))
+    {
+      free (buf);
+      return;
+    }
+  memset (&dwg, 0, sizeof (dwg));
+  dwg.opts = DWG_OPTS_LAZY; // only the section map is needed
+  if (dwg_read_data (buf, size, &dwg) < DWG_ERR_CRITICAL)
+    {
+      // the system pages: Section Page Map and Section Info
+      for (BITCODE_BL i = 0; i < dwg.header.num_sections; i++)
+        {
+          const size_t address = (size_t)dwg.header.section[i].address;
+          BITCODE_RL type;
+          if (address < 0x100 || address + 20 > size)
+            continue;
+          type = le32toh (*(uint32_t *)&buf[address]);
+          if (type == 0x41630e3b || type == 0x4163003b)
+            add_r2004_page (p, buf, size, address + 20,
+                            le32toh (*(uint32_t *)&buf[address + 8]),
+                            le32toh (*(uint32_t *)&buf[address + 4]));
+        }
+      // the pages of all compressed sections
+      for (BITCODE_BL i = 0; i < dwg.header.section_infohdr.num_desc; i++)
+        {
+          const Dwg_Section_Info *info = &dwg.header.section_info[i];
+          if (info->compressed != 2)
+            continue;
+          for (BITCODE_BL j = 0; j < info->num_sections; j++)
+            {
+              encrypted_section_header es;
+              uint32_t sec_mask;
+              size_t address;
+              if (!info->sections || !info->sections[j])
+                continue;
+              address = (size_t)info->sections[j]->address;
+              if (address + 32 > size)
+                continue;
+              sec_mask = htole32 (0x4164536b ^ (uint32_t)address);
+              memcpy (es.long_data, &buf[address], 32);
+              for (int k = 0; k < 8; ++k)
+                es.long_data[k] = le32toh (es.long_data[k] ^ sec_mask);
+              if (es.fields.page_type == 0x4163043b)
+                add_r2004_page (p, buf, size, address + 32,
+                                es.fields.data_size, info->max_decomp_size);
+            }
+        }
+    }
+  dwg_free (&dwg);
+  p->files = (BITCODE_RC **)realloc (p->files, (p->num_files + 1)
+                                                   * sizeof (BITCODE_RC *));
+  p->files[p->num_files++] = buf;
+}
+
+static double
+decompress_r2004_pages_time (const R2004_Pages *p, Bit_Chain *dec,
+                             const int bytewise, const int reps)
+{
+  clock_t start = clock ();
+  for (int r = 0; r < reps; r++)
+    for (unsigned i = 0; i < p->num_pages; i++)
+      {
+        Bit_Chain src = { 0 };
+        src.chain = (BITCODE_RC *)p->pages[i].data;
+        src.size = p->pages[i].comp_size;
+        dec->size = p->pages[i].decomp_size;
+        dec->byte = 0;
+        if (bytewise)
+          decompress_R2004_section_bytewise (&src, dec);
+        else
+          decompress_R2004_section (&src, dec);
+      }
+  return (double)(clock () - start) / CLOCKS_PER_SEC;
+}
+
+static void
+decompress_R2004_section_diff_tests (void)
+{
+  R2004_Pages p = { 0 };
+  const char *dir = test_data_dir ();
+  unsigned i, failures = 0;
+  size_t total = 0;
+  Bit_Chain dec = { 0 };
+
+  if (!dir)
+    {
+      ok ("decompress_R2004_section diff: skipped, no test-data");
+      return;
+    }
+  test_data_dwgs (dir, 1, collect_r2004_pages, &p);
+  reset_loglevel ();
+  if (!p.num_pages)
+    {
+      ok ("decompress_R2004_section diff: skipped, no r2004+ pages");
+      free (p.files);
+      return;
+    }
+
+  for (i = 0; i < p.num_pages; i++)
+    {
+      const R2004_Page *page = &p.pages[i];
+      Bit_Chain src1 = { 0 }, src2 = { 0 }, dec1 = { 0 }, dec2 = { 0 };
+      int err1, err2;
+      src1.chain = src2.chain = (BITCODE_RC *)page->data;
+      src1.size = src2.size = page->comp_size;
+      dec1.chain = (BITCODE_RC *)calloc (page->decomp_size, 1);
+      dec2.chain = (BITCODE_RC *)calloc (page->decomp_size, 1);
+      dec1.size = dec2.size = page->decomp_size;
+      err1 = decompress_R2004_section_bytewise (&src1, &dec1);
+      err2 = decompress_R2004_section (&src2, &dec2);
+      if (err1 != err2 || src1.byte != src2.byte || dec1.byte != dec2.byte
+          || dec1.size != dec2.size
+          || memcmp (dec1.chain, dec2.chain, dec2.size))
+        {
+          if (!failures++)
+            fail ("decompress_R2004_section diff page %u: err %d/%d, src "
+                  "%" PRIuSIZE "/%" PRIuSIZE ", dec %" PRIuSIZE "/%" PRIuSIZE,
+                  i, err1, err2, src1.byte, src2.byte, dec1.byte, dec2.byte);
+        }
+      else
+        total += dec2.byte;
+      free (dec1.chain);
+      free (dec2.chain);
+    }
+  if (failures)
+    fail ("decompress_R2004_section diff: %u of %u pages differ", failures,
+          p.num_pages);
+  else
+    {
+      const int reps = 3;
+      double t1, t2;
+      dec.chain = (BITCODE_RC *)calloc (0x100000, 1);
+      t1 = decompress_r2004_pages_time (&p, &dec, 1, reps);
+      t2 = decompress_r2004_pages_time (&p, &dec, 0, reps);
+      free (dec.chain);
+      ok ("decompress_R2004_section diff: %u pages of %u DWGs identical, "
+          "%.1f MB/s (bytewise %.1f MB/s)",
+          p.num_pages, p.num_files,
+          t2 > 0.0 ? (double)total * reps / t2 / 1e6 : 0.0,
+          t1 > 0.0 ? (double)total * reps / t1 / 1e6 : 0.0);
+    }
+  for (i = 0; i < p.num_files; i++)
+    free (p.files[i]);
+  free (p.files);
+  free (p.pages);
+}
+
 /* Regression tests for CWE-125 OOB reads in decompress_r2007().
  *
  * Test B: read_literal_length() 0xFFFF tail-walk.
@@ -421,6 +612,714 @@ decode_3dsolid_tests (void)
   bitfree (&dat);
 }
 
+/* dwg->filter: compare the objects read with a types, layers or owners filter
+   with a full read of the same DWG. Only the passing objects must be decoded,
+   the others must be placeholders, which can be decoded on demand. */
+static int
+filter_compare (const char *path, Dwg_Data *full, const Dwg_Filter *filter,
+                const unsigned num_threads)
+{
+  Dwg_Data dwg;
+  Dwg_Object *placeholder = NULL;
+  unsigned int decoded = 0, expected = 0;
+  int error;
+
+  memset (&dwg, 0, sizeof (dwg));
+  dwg.filter = filter;
+  dwg.num_threads = num_threads;
+  error = dwg_read_file (path, &dwg);
+  if (error >= DWG_ERR_CRITICAL || dwg.num_objects != full->num_objects)
+    {
+      fail ("filter %s: error 0x%x, %u/%u objects", path, error,
+            dwg.num_objects, full->num_objects);
+      dwg_free (&dwg);
+      return 1;
+    }
+  for (BITCODE_BL i = 0; i < dwg.num_objects; i++)
+    {
+      Dwg_Object *obj = &dwg.object[i];
+      Dwg_Object *fobj = &full->object[i];
+      bool pass = fobj->tio.object && decode_filter_type_p (&dwg, fobj)
+                  && decode_filter_entity_p (&dwg, fobj);
+      if (pass)
+        expected++;
+      if (obj->tio.object)
+        decoded++;
+      else if (!placeholder)
+        placeholder = obj;
+      if (obj->handle.value != fobj->handle.value
+          || (pass && !obj->tio.object)
+          || (!pass && obj->tio.object && !lazy_needs_decode (&dwg, obj)))
+        {
+          fail ("filter %s: [%u] " FORMAT_HV " %s %s", path, i,
+                fobj->handle.value, fobj->name,
+                pass ? "not decoded" : "decoded");
+          dwg_free (&dwg);
+          return 1;
+        }
+    }
+  // decode a skipped object on demand
+  if (placeholder)
+    {
+      Dwg_Object *fobj = &full->object[placeholder->index];
+      (void)dwg_decode_lazy_object (placeholder);
+      if (placeholder->fixedtype != fobj->fixedtype
+          || !placeholder->tio.object != !fobj->tio.object)
+        {
+          fail ("filter %s: placeholder [%u] %s not decoded on demand", path,
+                placeholder->index, fobj->name);
+          dwg_free (&dwg);
+          return 1;
+        }
+    }
+  dwg_free (&dwg);
+  if (decoded < expected)
+    {
+      fail ("filter %s: %u of %u objects decoded", path, decoded, expected);
+      return 1;
+    }
+  return 0;
+}
+
+/* DWG_OPTS_HEADER: no objects, but the same header, classes and preview as
+   a full read. With DWG_OPTS_TABLES only the tables. */
+static int
+header_compare (const char *path, Dwg_Data *full)
+{
+  Dwg_Data dwg;
+  int error;
+
+  memset (&dwg, 0, sizeof (dwg));
+  dwg.opts = DWG_OPTS_HEADER;
+  error = dwg_read_file (path, &dwg);
+  if (error >= DWG_ERR_CRITICAL || dwg.num_objects
+      || dwg.num_classes != full->num_classes
+      || dwg.thumbnail.size != full->thumbnail.size
+      || dwg.header_vars.MEASUREMENT != full->header_vars.MEASUREMENT
+      || !dwg.header_vars.HANDSEED || !full->header_vars.HANDSEED
+      || dwg.header_vars.HANDSEED->absolute_ref
+             != full->header_vars.HANDSEED->absolute_ref)
+    {
+      fail ("header %s: error 0x%x, %u objects, %u/%u classes", path, error,
+            dwg.num_objects, dwg.num_classes, full->num_classes);
+      dwg_free (&dwg);
+      return 1;
+    }
+  dwg_free (&dwg);
+
+  memset (&dwg, 0, sizeof (dwg));
+  dwg.opts = DWG_OPTS_HEADER | DWG_OPTS_TABLES;
+  error = dwg_read_file (path, &dwg);
+  if (error >= DWG_ERR_CRITICAL || dwg.num_objects != full->num_objects
+      || dwg.filter)
+    {
+      fail ("tables %s: error 0x%x, %u/%u objects", path, error,
+            dwg.num_objects, full->num_objects);
+      dwg_free (&dwg);
+      return 1;
+    }
+  for (BITCODE_BL i = 0; i < dwg.num_objects; i++)
+    {
+      Dwg_Object *obj = &dwg.object[i];
+      Dwg_Object *fobj = &full->object[i];
+      bool table = fobj->tio.object
+                   && (dwg_obj_is_control (fobj) || dwg_obj_is_table (fobj));
+      if ((table && !obj->tio.object)
+          || (!table && obj->tio.object && !lazy_needs_decode (&dwg, obj)))
+        {
+          fail ("tables %s: [%u] " FORMAT_HV " %s %s", path, i,
+                fobj->handle.value, fobj->name,
+                table ? "not decoded" : "decoded");
+          dwg_free (&dwg);
+          return 1;
+        }
+    }
+  dwg_free (&dwg);
+  return 0;
+}
+
+static void
+filter_tests (void)
+{
+  static const char *const files[]
+      = { "example_r14.dwg",  "example_2000.dwg", "example_2004.dwg",
+          "example_2007.dwg", "example_2010.dwg", "example_2018.dwg" };
+  static const Dwg_Object_Type text_types[]
+      = { DWG_TYPE_TEXT, DWG_TYPE_MTEXT, DWG_TYPE_LWPOLYLINE };
+  const char *dir = test_data_dir ();
+  struct stat attrib;
+  unsigned failures = 0, tested = 0;
+
+  for (int f = 0; dir && f < ARRAY_SIZE (files); f++)
+    {
+      Dwg_Data full;
+      Dwg_Filter filter;
+      BITCODE_RLL layer = 0, owner = 0;
+      char path[600];
+      snprintf (path, sizeof (path), "%s/%s", dir, files[f]);
+      if (stat (path, &attrib))
+        continue;
+      memset (&full, 0, sizeof (full));
+      if (dwg_read_file (path, &full) >= DWG_ERR_CRITICAL)
+        {
+          dwg_free (&full);
+          continue;
+        }
+      // the layer and owner of the last entity
+      for (BITCODE_BL i = 0; i < full.num_objects; i++)
+        {
+          const Dwg_Object *obj = &full.object[i];
+          if (obj->supertype == DWG_SUPERTYPE_ENTITY && obj->tio.entity
+              && obj->tio.entity->layer && obj->tio.entity->ownerhandle)
+            {
+              layer = obj->tio.entity->layer->absolute_ref;
+              owner = obj->tio.entity->ownerhandle->absolute_ref;
+            }
+        }
+      failures += header_compare (path, &full);
+      for (unsigned threads = 0; threads <= 2; threads += 2)
+        {
+          memset (&filter, 0, sizeof (filter));
+          filter.types = text_types;
+          filter.num_types = ARRAY_SIZE (text_types);
+          failures += filter_compare (path, &full, &filter, threads);
+          if (layer)
+            {
+              memset (&filter, 0, sizeof (filter));
+              filter.layers = &layer;
+              filter.num_layers = 1;
+              failures += filter_compare (path, &full, &filter, threads);
+            }
+          if (owner)
+            {
+              memset (&filter, 0, sizeof (filter));
+              filter.types = text_types;
+              filter.num_types = ARRAY_SIZE (text_types);
+              filter.owners = &owner;
+              filter.num_owners = 1;
+              failures += filter_compare (path, &full, &filter, threads);
+            }
+        }
+      dwg_free (&full);
+      tested++;
+    }
+  reset_loglevel ();
+  if (!tested)
+    ok ("filter: skipped, no test-data");
+  else if (!failures)
+    ok ("filter: header only, tables, types, layers and owners of %u DWGs",
+        tested);
+}
+
+/* DWG_OPTS_LAZY: the table records resolved on demand must be the same as
+   with a full read, and the entities not decoded. Read from the file, from
+   the mapped file with DWG_OPTS_MMAP, or from data with dwg_read_data. */
+static int
+lazy_compare (const char *path, Dwg_Data *full, const unsigned opts,
+              const unsigned char *data, const size_t size)
+{
+  Dwg_Data dwg;
+  int error;
+  unsigned resolved = 0, undecoded = 0;
+
+  memset (&dwg, 0, sizeof (dwg));
+  dwg.opts = opts;
+  error = data ? dwg_read_data (data, size, &dwg)
+               : dwg_read_file (path, &dwg);
+  if (error >= DWG_ERR_CRITICAL || dwg.num_objects != full->num_objects)
+    {
+      fail ("lazy %s: error 0x%x, %u/%u objects", path, error,
+            dwg.num_objects, full->num_objects);
+      dwg_free (&dwg);
+      return 1;
+    }
+  for (BITCODE_BL i = 0; i < full->num_objects; i++)
+    {
+      Dwg_Object *fobj = &full->object[i];
+      Dwg_Object *obj;
+      char *name = NULL, *fname = NULL;
+      int isnew = 0, fisnew = 0;
+      bool same;
+      if (!fobj->tio.object || !dwg_obj_is_table (fobj))
+        continue;
+      obj = dwg_resolve_handle (&dwg, fobj->handle.value);
+      same = obj && obj->tio.object && obj->fixedtype == fobj->fixedtype
+             && obj->size == fobj->size
+             && dwg_dynapi_entity_utf8text (obj->tio.object->tio.APPID,
+                                            obj->name, "name", &name, &isnew,
+                                            NULL)
+             && dwg_dynapi_entity_utf8text (fobj->tio.object->tio.APPID,
+                                            fobj->name, "name", &fname,
+                                            &fisnew, NULL)
+             && !name == !fname && (!name || strEQ (name, fname));
+      if (isnew)
+        free (name);
+      if (fisnew)
+        free (fname);
+      if (!same)
+        {
+          fail ("lazy %s: " FORMAT_HV " %s differs", path, fobj->handle.value,
+                fobj->name);
+          dwg_free (&dwg);
+          return 1;
+        }
+      resolved++;
+    }
+  for (BITCODE_BL i = 0; i < dwg.num_objects; i++)
+    {
+      if (dwg.object[i].supertype == DWG_SUPERTYPE_ENTITY
+          && !dwg.object[i].tio.entity)
+        undecoded++;
+    }
+  error = dwg_decode_lazy_objects (&dwg);
+  if (!resolved || !undecoded || error >= DWG_ERR_CRITICAL
+      || dwg.num_entities != full->num_entities)
+    {
+      fail ("lazy %s: %u resolved, %u undecoded, error 0x%x, %u/%u entities",
+            path, resolved, undecoded, error, dwg.num_entities,
+            full->num_entities);
+      dwg_free (&dwg);
+      return 1;
+    }
+  dwg_free (&dwg);
+  return 0;
+}
+
+static void
+lazy_tests (void)
+{
+  static const char *const files[]
+      = { "example_r14.dwg", "example_2000.dwg", "example_2004.dwg",
+          "example_2018.dwg" };
+  const char *dir = test_data_dir ();
+  unsigned failures = 0, tested = 0;
+
+  for (int f = 0; dir && f < ARRAY_SIZE (files); f++)
+    {
+      Dwg_Data full;
+      unsigned char *data;
+      size_t size;
+      char path[600];
+      snprintf (path, sizeof (path), "%s/%s", dir, files[f]);
+      data = test_read_file (path, &size);
+      if (!data)
+        continue;
+      memset (&full, 0, sizeof (full));
+      if (dwg_read_file (path, &full) >= DWG_ERR_CRITICAL)
+        {
+          dwg_free (&full);
+          free (data);
+          continue;
+        }
+      failures += lazy_compare (path, &full, DWG_OPTS_LAZY, NULL, 0);
+      failures
+          += lazy_compare (path, &full, DWG_OPTS_LAZY | DWG_OPTS_MMAP, NULL, 0);
+      failures += lazy_compare (path, &full, DWG_OPTS_LAZY, data, size);
+      dwg_free (&full);
+      free (data);
+      tested++;
+    }
+  reset_loglevel ();
+  if (!tested)
+    ok ("lazy: skipped, no test-data");
+  else if (!failures)
+    ok ("lazy: tables of %u DWGs resolved on demand as with a full read",
+        tested);
+}
+
+/* The sections decompressed by several threads, in place into their page
+   slots, must be the same as the serial ones: all multi-page r2004 style
+   sections, and the r2004+ objects section, as kept by DWG_OPTS_LAZY. */
+static int
+parallel_section_compare (const char *path, Dwg_Data *full)
+{
+  Dwg_Data dwg[2];
+  Bit_Chain dat = { 0 };
+  unsigned compared = 0;
+  int bad = 0;
+
+  // the r2004 style sections, via the full read
+  dat.chain = full->header.from_version >= R_2004
+                      && full->header.from_version != R_2007
+                  ? test_read_file (path, &dat.size)
+                  : NULL;
+  dat.version = full->header.version;
+  dat.from_version = full->header.from_version;
+  for (BITCODE_BL i = 0;
+       dat.chain && i < full->header.section_infohdr.num_desc && !bad; i++)
+    {
+      const Dwg_Section_Info *info = &full->header.section_info[i];
+      Bit_Chain sec[2] = { { 0 }, { 0 } };
+      int error[2];
+      if (info->compressed != 2 || info->num_sections < 2)
+        continue;
+      for (int t = 0; t < 2; t++)
+        {
+          loglevel = 0; // in parallel only without logging
+          full->num_threads = t ? 4 : 1;
+          error[t] = read_2004_compressed_section (&dat, full, &sec[t],
+                                                   info->fixedtype);
+        }
+      full->num_threads = 0;
+      reset_loglevel ();
+      if (error[0] != error[1] || sec[0].size != sec[1].size
+          || (sec[0].chain && memcmp (sec[0].chain, sec[1].chain, sec[0].size)))
+        {
+          fail ("parallel sections %s: %s error 0x%x/0x%x, size %" PRIuSIZE
+                "/%" PRIuSIZE,
+                path, info->name, error[0], error[1], sec[0].size,
+                sec[1].size);
+          bad = 1;
+        }
+      compared++;
+      free (sec[0].chain);
+      free (sec[1].chain);
+    }
+  free (dat.chain);
+
+  // the objects section, also of r2007+
+  for (int t = 0; t < 2; t++)
+    {
+      memset (&dwg[t], 0, sizeof (Dwg_Data));
+      dwg[t].opts = DWG_OPTS_LAZY;
+      dwg[t].num_threads = t ? 4 : 1;
+      (void)dwg_read_file (path, &dwg[t]);
+    }
+  reset_loglevel ();
+  if (!bad
+      && (!dwg[0].lazy_dat.chain
+          || dwg[0].lazy_dat.size != dwg[1].lazy_dat.size
+          || memcmp (dwg[0].lazy_dat.chain, dwg[1].lazy_dat.chain,
+                     dwg[0].lazy_dat.size)))
+    {
+      fail ("parallel sections %s: objects size %" PRIuSIZE "/%" PRIuSIZE,
+            path, dwg[0].lazy_dat.size, dwg[1].lazy_dat.size);
+      bad = 1;
+    }
+  compared++;
+  dwg_free (&dwg[0]);
+  dwg_free (&dwg[1]);
+  return bad ? -1 : (int)compared;
+}
+
+static void
+parallel_sections_tests (void)
+{
+  static const char *const files[]
+      = { "example_2004.dwg",   "example_2007.dwg",      "example_2010.dwg",
+          "example_2018.dwg",   "2004/material.dwg",     "2007/ATMOS-DC22S.dwg",
+          "sample_2018.dwg" };
+  const char *dir = test_data_dir ();
+  struct stat attrib;
+  unsigned failures = 0, tested = 0, compared = 0;
+
+  for (int f = 0; dir && f < ARRAY_SIZE (files); f++)
+    {
+      Dwg_Data full;
+      int n;
+      char path[600];
+      snprintf (path, sizeof (path), "%s/%s", dir, files[f]);
+      if (stat (path, &attrib))
+        continue;
+      memset (&full, 0, sizeof (full));
+      if (dwg_read_file (path, &full) >= DWG_ERR_CRITICAL)
+        {
+          dwg_free (&full);
+          continue;
+        }
+      n = parallel_section_compare (path, &full);
+      if (n < 0)
+        failures++;
+      else
+        compared += n;
+      dwg_free (&full);
+      tested++;
+    }
+  reset_loglevel ();
+  if (!tested)
+    ok ("parallel sections: skipped, no test-data");
+  else if (!failures)
+    ok ("parallel sections: %u sections of %u DWGs the same with 1 and 4 "
+        "threads",
+        compared, tested);
+}
+
+/* dwg_read_data: the same as dwg_read_file, without changing the data.
+   No, too small or invalid data must fail. */
+static void
+read_data_tests (void)
+{
+  static const char *const files[]
+      = { "example_r14.dwg", "example_2000.dwg", "example_2007.dwg",
+          "example_2018.dwg" };
+  const char *dir = test_data_dir ();
+  unsigned char invalid[4096];
+  Dwg_Data dwg;
+  int error, tested = 0, bad = 0;
+
+  memset (&dwg, 0, sizeof (dwg));
+  error = dwg_read_data (NULL, 0, &dwg);
+  dwg_free (&dwg);
+  if (error != DWG_ERR_INVALIDDWG)
+    bad++;
+  memset (&dwg, 0, sizeof (dwg));
+  error = dwg_read_data ((const unsigned char *)"AC1015", 5, &dwg);
+  dwg_free (&dwg);
+  if (error != DWG_ERR_INVALIDDWG)
+    bad++;
+  // a r2000 and a r2004 version, but no DWG
+  for (int v = 0; v < 2; v++)
+    {
+      memset (invalid, 0xff, sizeof (invalid));
+      memcpy (invalid, v ? "AC1018" : "AC1015", 6);
+      memset (&dwg, 0, sizeof (dwg));
+      error = dwg_read_data (invalid, sizeof (invalid), &dwg);
+      dwg_free (&dwg);
+      if (error < DWG_ERR_CRITICAL)
+        bad++;
+    }
+  reset_loglevel ();
+  if (bad)
+    fail ("read_data: %d invalid data not rejected", bad);
+
+  for (int f = 0; dir && f < ARRAY_SIZE (files); f++)
+    {
+      Dwg_Data full;
+      unsigned char *data, *copy;
+      size_t size;
+      char path[600];
+      snprintf (path, sizeof (path), "%s/%s", dir, files[f]);
+      data = test_read_file (path, &size);
+      copy = data ? (unsigned char *)malloc (size) : NULL;
+      if (!copy)
+        {
+          free (data);
+          continue;
+        }
+      memcpy (copy, data, size);
+      memset (&full, 0, sizeof (full));
+      memset (&dwg, 0, sizeof (dwg));
+      error = dwg_read_file (path, &full);
+      if (dwg_read_data (data, size, &dwg) != error
+          || dwg.num_objects != full.num_objects
+          || dwg.num_entities != full.num_entities
+          || dwg.header.version != full.header.version
+          || memcmp (data, copy, size))
+        {
+          reset_loglevel ();
+          fail ("read_data %s: %u/%u objects", files[f], dwg.num_objects,
+                full.num_objects);
+          bad++;
+        }
+      dwg_free (&dwg);
+      dwg_free (&full);
+      free (data);
+      free (copy);
+      tested++;
+    }
+  reset_loglevel ();
+  if (!bad)
+    ok ("read_data: invalid data rejected, %d DWGs as from the file",
+        tested);
+}
+
+/* DWG_OPTS_MMAP: the objects and refs must be the same as when the file is
+   read. Prints the read times. */
+static void
+mmap_tests (void)
+{
+  static const char *const files[]
+      = { "2018/Dynblocks.dwg", "2004/material.dwg", "example_2007.dwg",
+          "example_2000.dwg", "example_r13.dwg" };
+  const char *dir = test_data_dir ();
+  struct stat attrib;
+  unsigned tested = 0;
+
+  for (int f = 0; dir && f < ARRAY_SIZE (files); f++)
+    {
+      Dwg_Data dwg, mdwg;
+      char path[600];
+      const int reps = 5;
+      BITCODE_BL diff = 0, num_objects = 0;
+      double t = 0.0, tm = 0.0;
+      snprintf (path, sizeof (path), "%s/%s", dir, files[f]);
+      if (stat (path, &attrib))
+        continue;
+      for (int r = 0; r < reps; r++)
+        {
+          clock_t start;
+          int error, merror;
+          memset (&dwg, 0, sizeof (dwg));
+          memset (&mdwg, 0, sizeof (mdwg));
+          mdwg.opts = DWG_OPTS_MMAP;
+          start = clock ();
+          error = dwg_read_file (path, &dwg);
+          t += (double)(clock () - start) / CLOCKS_PER_SEC;
+          start = clock ();
+          merror = dwg_read_file (path, &mdwg);
+          tm += (double)(clock () - start) / CLOCKS_PER_SEC;
+          if (!r)
+            {
+              num_objects = dwg.num_objects;
+              if (error != merror || dwg.num_objects != mdwg.num_objects
+                  || dwg.num_entities != mdwg.num_entities
+                  || dwg.num_object_refs != mdwg.num_object_refs)
+                diff++;
+              for (BITCODE_BL i = 0; !diff && i < dwg.num_objects; i++)
+                {
+                  const Dwg_Object *obj = &dwg.object[i];
+                  const Dwg_Object *mobj = &mdwg.object[i];
+                  if (obj->fixedtype != mobj->fixedtype
+                      || obj->handle.value != mobj->handle.value
+                      || obj->address != mobj->address
+                      || obj->size != mobj->size
+                      || obj->bitsize != mobj->bitsize
+                      || !obj->tio.object != !mobj->tio.object)
+                    diff++;
+                }
+              for (BITCODE_BL i = 0; !diff && i < dwg.num_object_refs; i++)
+                {
+                  const Dwg_Object_Ref *ref = dwg.object_ref[i];
+                  const Dwg_Object_Ref *mref = mdwg.object_ref[i];
+                  if (ref->absolute_ref != mref->absolute_ref
+                      || ref->handleref.code != mref->handleref.code
+                      || (ref->obj ? ref->obj->index : (BITCODE_BL)-1)
+                             != (mref->obj ? mref->obj->index
+                                           : (BITCODE_BL)-1))
+                    diff++;
+                }
+            }
+          dwg_free (&dwg);
+          dwg_free (&mdwg);
+          if (diff)
+            break;
+        }
+      reset_loglevel ();
+      if (diff)
+        fail ("mmap %s: differs from the read file", files[f]);
+      else
+        ok ("mmap %s: %u objects the same, dwg_read_file %.2fms vs %.2fms",
+            files[f], (unsigned)num_objects, tm * 1e3 / reps,
+            t * 1e3 / reps);
+      tested++;
+    }
+  if (!tested)
+    ok ("mmap: skipped, no test-data");
+}
+
+/* The object_map: all handles of the largest test-data DWGs must resolve
+   to their objects. Prints the lookup throughput. */
+static void
+resolve_tests (void)
+{
+  static const char *const files[]
+      = { "2018/Dynblocks.dwg", "2004/material.dwg", "example_2000.dwg",
+          "example_r13.dwg" };
+  const char *dir = test_data_dir ();
+  struct stat attrib;
+  unsigned tested = 0;
+
+  for (int f = 0; dir && f < ARRAY_SIZE (files); f++)
+    {
+      Dwg_Data dwg;
+      char path[600];
+      const int reps = 50;
+      BITCODE_BL found = 0;
+      clock_t start;
+      double t;
+      snprintf (path, sizeof (path), "%s/%s", dir, files[f]);
+      if (stat (path, &attrib))
+        continue;
+      memset (&dwg, 0, sizeof (dwg));
+      if (dwg_read_file (path, &dwg) >= DWG_ERR_CRITICAL || !dwg.num_objects)
+        {
+          dwg_free (&dwg);
+          continue;
+        }
+      reset_loglevel ();
+      start = clock ();
+      for (int r = 0; r < reps; r++)
+        for (BITCODE_BL i = 0; i < dwg.num_objects; i++)
+          {
+            const Dwg_Object *obj = &dwg.object[i];
+            if (obj->handle.value
+                && dwg_resolve_handle_silent (&dwg, obj->handle.value) == obj)
+              found++;
+          }
+      t = (double)(clock () - start) / CLOCKS_PER_SEC;
+      for (BITCODE_BL i = 0; i < dwg.num_objects; i++)
+        if (!dwg.object[i].handle.value)
+          found += reps;
+      if (found != dwg.num_objects * reps)
+        fail ("resolve %s: %u of %u handles", files[f], found / reps,
+              dwg.num_objects);
+      else
+        ok ("resolve %s: %u handles, %.0f M/s", files[f], dwg.num_objects,
+            t > 0.0 ? (double)dwg.num_objects * reps / t / 1e6 : 0.0);
+      dwg_free (&dwg);
+      tested++;
+    }
+  if (!tested)
+    ok ("resolve: skipped, no test-data");
+}
+
+// Read each DWG with and without DWG_OPTS_REF_POOL, and compare the refs.
+static void
+ref_pool_tests (void)
+{
+  static const char *const files[]
+      = { "2018/Dynblocks.dwg", "2004/material.dwg", "example_2000.dwg",
+          "example_r13.dwg" };
+  const char *dir = test_data_dir ();
+  struct stat attrib;
+  unsigned tested = 0;
+
+  for (int f = 0; dir && f < ARRAY_SIZE (files); f++)
+    {
+      Dwg_Data dwg, pdwg;
+      char path[600];
+      BITCODE_BL diff = 0;
+      size_t allocs = 0, chunks = 0;
+      snprintf (path, sizeof (path), "%s/%s", dir, files[f]);
+      if (stat (path, &attrib))
+        continue;
+      memset (&dwg, 0, sizeof (dwg));
+      memset (&pdwg, 0, sizeof (pdwg));
+      pdwg.opts = DWG_OPTS_REF_POOL;
+      if (dwg_read_file (path, &dwg) >= DWG_ERR_CRITICAL
+          || dwg_read_file (path, &pdwg) >= DWG_ERR_CRITICAL
+          || !pdwg.ref_pool || dwg.num_object_refs != pdwg.num_object_refs)
+        diff++;
+      for (BITCODE_BL i = 0; !diff && i < dwg.num_object_refs; i++)
+        {
+          const Dwg_Object_Ref *ref = dwg.object_ref[i];
+          const Dwg_Object_Ref *pref = pdwg.object_ref[i];
+          if (ref->absolute_ref != pref->absolute_ref
+              || ref->handleref.code != pref->handleref.code
+              || !pref->handleref.is_global
+              || (ref->obj ? ref->obj->index : (BITCODE_BL)-1)
+                     != (pref->obj ? pref->obj->index : (BITCODE_BL)-1))
+            diff++;
+        }
+      if (pdwg.ref_pool)
+        {
+          allocs = pdwg.ref_pool->num_allocs;
+          chunks = pdwg.ref_pool->num_chunks;
+        }
+      dwg_free (&dwg);
+      dwg_free (&pdwg);
+      reset_loglevel ();
+      if (diff)
+        fail ("ref_pool %s: %u different refs", files[f], (unsigned)diff);
+      else
+        ok ("ref_pool %s: %" PRIuSIZE " refs in %" PRIuSIZE " chunks",
+            files[f], allocs, chunks);
+      tested++;
+    }
+  if (!tested)
+    ok ("ref_pool: skipped, no test-data");
+}
+
 int
 main (int argc, char const *argv[])
 {
@@ -430,10 +1329,18 @@ main (int argc, char const *argv[])
   read_compressed_bytes_tests ();
   two_byte_offset_tests ();
   decompress_R2004_section_tests ();
+  decompress_R2004_section_diff_tests ();
   decompress_r2007_tests ();
   read_data_section_tests ();
   read_2004_compressed_section_tests ();
   decode_3dsolid_tests ();
+  filter_tests ();
+  lazy_tests ();
+  parallel_sections_tests ();
+  read_data_tests ();
+  mmap_tests ();
+  resolve_tests ();
+  ref_pool_tests ();
 
   return numfailed () ? 1 : 0;
 }
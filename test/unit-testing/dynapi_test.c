@@ -69096,6 +69096,87 @@ test_sizes (void)
   return error;
 }
 
+/* the field handles get and set the same values as the name lookups */
+static int
+test_fieldhandles (Dwg_Data *dwg)
+{
+  int error = 0;
+  BITCODE_BL i;
+  Dwg_DYNAPI_fieldhandle h_layer, h_start, h_ltscale, h_bad;
+
+  if (!dwg_dynapi_common_fieldhandle (DWG_SUPERTYPE_ENTITY, "layer", &h_layer)
+      || !dwg_dynapi_entity_fieldhandle ("LINE", "start", &h_start)
+      || !dwg_dynapi_header_fieldhandle ("LTSCALE", &h_ltscale))
+    {
+      fail ("dwg_dynapi_*_fieldhandle");
+      return 1;
+    }
+  if (dwg_dynapi_entity_fieldhandle ("LINE", "center", &h_bad)
+      || dwg_dynapi_entity_fieldhandle ("NOSUCHENTITY", "start", &h_bad))
+    {
+      fail ("dwg_dynapi_entity_fieldhandle invalid field");
+      error++;
+    }
+  {
+    BITCODE_BD ltscale, ltscale1;
+    if (!dwg_dynapi_fieldhandle_value (dwg, &h_ltscale, &ltscale)
+        || ltscale != dwg->header_vars.LTSCALE)
+      {
+        fail ("HEADER.LTSCALE fieldhandle value");
+        error++;
+      }
+    ltscale1 = ltscale + 1.0;
+    if (!dwg_dynapi_fieldhandle_set_value (NULL, dwg, &h_ltscale, &ltscale1, 0)
+        || dwg->header_vars.LTSCALE != ltscale1)
+      {
+        fail ("HEADER.LTSCALE fieldhandle set_value");
+        error++;
+      }
+    dwg->header_vars.LTSCALE = ltscale;
+  }
+  for (i = 0; i < dwg->num_objects; i++)
+    {
+      Dwg_Object *obj = &dwg->object[i];
+      if (obj->supertype != DWG_SUPERTYPE_ENTITY)
+        continue;
+      {
+        BITCODE_H layer, layer1;
+        void *_obj = obj->tio.entity->tio.UNUSED;
+        if (!dwg_dynapi_fieldhandle_value (_obj, &h_layer, &layer)
+            || !dwg_dynapi_common_value (_obj, "layer", &layer1, NULL)
+            || layer != layer1)
+          {
+            fail ("%s.layer fieldhandle value", obj->name);
+            error++;
+          }
+      }
+      if (obj->fixedtype == DWG_TYPE_LINE)
+        {
+          Dwg_Entity_LINE *line = obj->tio.entity->tio.LINE;
+          BITCODE_3BD start, start1;
+          if (!dwg_dynapi_fieldhandle_value (line, &h_start, &start)
+              || memcmp (&start, &line->start, sizeof (start)))
+            {
+              fail ("LINE.start fieldhandle value");
+              error++;
+            }
+          start1 = start;
+          start1.x += 1.0;
+          if (!dwg_dynapi_fieldhandle_set_value (NULL, line, &h_start,
+                                                 &start1, 0)
+              || line->start.x != start1.x)
+            {
+              fail ("LINE.start fieldhandle set_value");
+              error++;
+            }
+          line->start = start;
+        }
+    }
+  if (!error)
+    ok ("fieldhandles");
+  return error;
+}
+
 static int
 test_dynapi (const char *filename)
 {
@@ -69117,6 +69198,7 @@ test_dynapi (const char *filename)
 #if !defined(__CYGWIN__) || defined(__amd64__)
   error += test_header (&dwg);
 #endif
+  error += test_fieldhandles (&dwg);
   for (i = 0; i < dwg.num_objects; i++)
     {
       error += test_object (&dwg, &dwg.object[i]);
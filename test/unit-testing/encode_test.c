@@ -10,8 +10,6 @@
 #  define _USE_BSD 1
 #endif
 
-extern unsigned int loglevel;
-
 #define IS_ENCODER
 #include <stdlib.h>
 // #include "common.h"
@@ -21,6 +19,7 @@ extern unsigned int loglevel;
 // CLANG_DIAG_RESTORE
 #include "decode.h"
 #include "tests_common.h"
+#include <time.h>
 
 BITCODE_RL size = SECTION_R13_SIZE;
 // Dwg_Section_Type_r13 section_order[SECTION_R13_SIZE] = { 0 };
@@ -219,7 +218,8 @@ compress_R2004_section_tests (void)
   comp.byte = 0;
   comp.bit = 0;
   result = compress_R2004_section (&comp, decomp_auxh_bin,
-                                   sizeof decomp_auxh_bin, &comp_data_size);
+                                   sizeof decomp_auxh_bin, &comp_data_size,
+                                   DWG_COMPRESS_NONE);
   if (result)
     {
       fail ("compress_R2004_section auxh returned %d", result);
@@ -248,7 +248,8 @@ test2:
   if (comp.size < sizeof decomp_ofs_bin * 2)
     bit_chain_alloc_size (&comp, sizeof decomp_ofs_bin * 2);
   result = compress_R2004_section (&comp, decomp_ofs_bin,
-                                   sizeof decomp_ofs_bin, &comp_data_size);
+                                   sizeof decomp_ofs_bin, &comp_data_size,
+                                   DWG_COMPRESS_NONE);
   if (result)
     {
       fail ("compress_R2004_section ofs returned %d", result);
@@ -273,6 +274,141 @@ cleanup:
   free (dec.chain);
 }
 
+/* Round-trip and benchmark of all compression levels, over uncompressed
+   section payloads, raw split into 0x7400 pages as the r2004+ writer does.
+   By default the decompressed objects sections of a few r2004+ DWGs, as kept
+   with DWG_OPTS_LAZY. With the corpus argument all the test-data DWG files
+   as they are, which are mostly incompressible. Reports the ratio and the
+   MB/s of compression per level. */
+typedef struct _compress_corpus
+{
+  BITCODE_RC **files;
+  size_t *sizes;
+  unsigned num_files;
+} Compress_Corpus;
+
+static void
+compress_corpus_push (Compress_Corpus *c, BITCODE_RC *buf, size_t size)
+{
+  c->files = (BITCODE_RC **)realloc (c->files, (c->num_files + 1)
+                                                   * sizeof (BITCODE_RC *));
+  c->sizes = (size_t *)realloc (c->sizes, (c->num_files + 1) * sizeof (size_t));
+  c->files[c->num_files] = buf;
+  c->sizes[c->num_files++] = size;
+}
+
+static void
+compress_corpus_add (const char *path, void *arg)
+{
+  size_t size;
+  BITCODE_RC *buf = test_read_file (path, &size);
+  if (buf)
+    compress_corpus_push ((Compress_Corpus *)arg, buf, size);
+}
+
+// the decompressed AcDb:AcDbObjects section
+static void
+compress_section_add (const char *path, void *arg)
+{
+  Dwg_Data dwg;
+  memset (&dwg, 0, sizeof (Dwg_Data));
+  dwg.opts = DWG_OPTS_LAZY;
+  if (dwg_read_file (path, &dwg) < DWG_ERR_CRITICAL && dwg.lazy_dat.chain
+      && dwg.lazy_dat.size)
+    {
+      BITCODE_RC *buf = (BITCODE_RC *)malloc (dwg.lazy_dat.size);
+      if (buf)
+        {
+          memcpy (buf, dwg.lazy_dat.chain, dwg.lazy_dat.size);
+          compress_corpus_push ((Compress_Corpus *)arg, buf,
+                                dwg.lazy_dat.size);
+        }
+    }
+  dwg_free (&dwg);
+}
+
+static void
+compress_levels_tests (const int corpus)
+{
+  Compress_Corpus c = { 0 };
+  const char *names[] = { "none", "fast", "normal", "high" };
+  const char *sections[] = { "example_2004.dwg", "example_2013.dwg",
+                             "example_2018.dwg", "2004/Underlay.dwg" };
+  const char *dir = test_data_dir ();
+  Bit_Chain comp = { 0 }, dec = { 0 };
+
+  if (!dir)
+    {
+      ok ("compress_R2004_section levels: skipped, no test-data");
+      return;
+    }
+  if (corpus)
+    test_data_dwgs (dir, 1, compress_corpus_add, &c);
+  else
+    for (unsigned i = 0; i < ARRAY_SIZE (sections); i++)
+      {
+        char path[512];
+        snprintf (path, sizeof (path), "%s/%s", dir, sections[i]);
+        compress_section_add (path, &c);
+      }
+  reset_loglevel ();
+  if (!c.num_files)
+    {
+      ok ("compress_R2004_section levels: skipped, no DWGs");
+      return;
+    }
+  bit_chain_alloc_size (&comp, 0x7400 + 0x400);
+  bit_chain_alloc_size (&dec, 0x7400);
+  for (unsigned level = DWG_COMPRESS_FAST; level <= DWG_COMPRESS_HIGH; level++)
+    {
+      size_t total = 0, total_comp = 0;
+      unsigned pages = 0, failures = 0;
+      double secs = 0.0;
+      loglevel = 0;
+      for (unsigned i = 0; i < c.num_files; i++)
+        for (size_t off = 0; off < c.sizes[i]; off += 0x7400)
+          {
+            uint32_t size = (uint32_t)MIN (0x7400, c.sizes[i] - off);
+            uint32_t comp_data_size = 0;
+            clock_t start = clock ();
+            int error;
+            comp.byte = 0;
+            comp.size = 0x7400 + 0x400;
+            compress_R2004_section (&comp, &c.files[i][off], size,
+                                    &comp_data_size, level);
+            secs += (double)(clock () - start) / CLOCKS_PER_SEC;
+            comp.size = comp_data_size;
+            comp.byte = 0;
+            dec.byte = 0;
+            dec.size = size;
+            error = decompress_R2004_section (&comp, &dec);
+            if (error || memcmp (dec.chain, &c.files[i][off], size))
+              {
+                if (!failures++)
+                  fail ("compress_R2004_section %s roundtrip page %" PRIuSIZE
+                        " of file %u: %d",
+                        names[level], off / 0x7400, i, error);
+              }
+            pages++;
+            total += size;
+            total_comp += comp_data_size;
+          }
+      reset_loglevel ();
+      if (!failures)
+        ok ("compress_R2004_section %s: %u pages of %u %s, ratio %.3f, "
+            "%.1f MB/s",
+            names[level], pages, c.num_files, corpus ? "DWGs" : "sections",
+            total ? (double)total_comp / (double)total : 0.0,
+            secs > 0.0 ? (double)total / secs / 1e6 : 0.0);
+    }
+  free (comp.chain);
+  free (dec.chain);
+  for (unsigned i = 0; i < c.num_files; i++)
+    free (c.files[i]);
+  free (c.files);
+  free (c.sizes);
+}
+
 /* Regression test for double-free fix in COMMON_ENTITY_HANDLE_DATA
    (commit 6deac10e).  The macro copies *hdl_dat to dat1 then NULLs
    hdl_dat->chain so dat1 owns the buffer exclusively.  Without the
@@ -326,6 +462,67 @@ remove_NOD_item_null_itemhandles_test (void)
   ok ("remove_NOD_item: survives NULL itemhandles with numitems > 0");
 }
 
+static int
+omap_cmp (const void *a, const void *b)
+{
+  const Object_Map *x = (const Object_Map *)a;
+  const Object_Map *y = (const Object_Map *)b;
+  if (x->handle != y->handle)
+    return x->handle < y->handle ? -1 : 1;
+  return x->index < y->index ? -1 : x->index > y->index ? 1 : 0;
+}
+
+/* Random handles with duplicates, sorted stable as with qsort by handle and
+   index. Timed from 10k to 2M objects. */
+static void
+object_map_sort_tests (void)
+{
+  static const BITCODE_BL sizes[] = { 10000, 100000, 1000000, 2000000 };
+  uint64_t seed = 0x9E3779B97F4A7C15ULL;
+  for (unsigned k = 0; k < ARRAY_SIZE (sizes); k++)
+    {
+      const BITCODE_BL num = sizes[k];
+      Object_Map *omap = (Object_Map *)calloc (num, sizeof (Object_Map));
+      Object_Map *ref = (Object_Map *)calloc (num, sizeof (Object_Map));
+      clock_t t0;
+      double secs;
+      if (!omap || !ref)
+        {
+          fail ("object_map_sort: calloc failed");
+          free (omap);
+          free (ref);
+          return;
+        }
+      for (BITCODE_BL i = 0; i < num; i++)
+        {
+          seed ^= seed << 13;
+          seed ^= seed >> 7;
+          seed ^= seed << 17;
+          // some skipped objects with handle 0, some duplicates
+          omap[i].handle = (i % 97) ? 1 + seed % (num * 4ULL) : 0;
+          omap[i].index = i;
+        }
+      memcpy (ref, omap, num * sizeof (Object_Map));
+      t0 = clock ();
+      object_map_sort (omap, num);
+      secs = (double)(clock () - t0) / CLOCKS_PER_SEC;
+      qsort (ref, num, sizeof (Object_Map), omap_cmp);
+      if (memcmp (omap, ref, num * sizeof (Object_Map)))
+        fail ("object_map_sort %u: not sorted", (unsigned)num);
+      else
+        {
+          // and sorted again, a noop
+          object_map_sort (omap, num);
+          if (memcmp (omap, ref, num * sizeof (Object_Map)))
+            fail ("object_map_sort %u: sorted changed", (unsigned)num);
+          else
+            ok ("object_map_sort %u: %.3fs", (unsigned)num, secs);
+        }
+      free (omap);
+      free (ref);
+    }
+}
+
 int
 main (int argc, char const *argv[])
 {
@@ -340,7 +537,10 @@ main (int argc, char const *argv[])
   test_section_move_before (&dwg);
 
   compress_R2004_section_tests ();
+  // encode_test corpus: also over all the test-data DWG files
+  compress_levels_tests (argc > 1 && !strcmp (argv[1], "corpus"));
   common_entity_handle_data_double_free_test ();
   remove_NOD_item_null_itemhandles_test ();
+  object_map_sort_tests ();
   return failed;
 }
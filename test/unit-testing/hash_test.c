@@ -3,6 +3,7 @@
 #include "common.h"
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
 #include "tests_common.h"
 
 #define MAX_SIZE 2453916
@@ -16,6 +17,104 @@ maxrand (int max)
   return rnd % (uint32_t)max;
 }
 
+static inline uint64_t
+rand64 (void)
+{
+  return ((uint64_t)rand () << 42) ^ ((uint64_t)rand () << 21)
+         ^ (uint64_t)rand ();
+}
+
+/* DWG-like handles: dense ascending, with sparse outliers and updates */
+static void
+sparse_tests (void)
+{
+  const int num = 100000;
+  uint64_t *keys = (uint64_t *)malloc (num * sizeof (uint64_t));
+  dwg_inthash *hash = hash_new (100);
+  int failures = 0;
+
+  srand (1);
+  for (int i = 0; i < num; i++)
+    {
+      // every 10th an outlier, in a higher sparse range
+      keys[i] = i % 10 ? (uint64_t)i + 1 : (rand64 () | 1) + num;
+      hash_set (hash, keys[i], i);
+    }
+  for (int i = 0; i < num; i += 7) // update some
+    hash_set (hash, keys[i], i + 1);
+  for (int i = 0; i < num; i++)
+    {
+      const uint64_t expect = i % 7 ? (uint64_t)i : (uint64_t)i + 1;
+      if (hash_get (hash, keys[i]) != expect && !failures++)
+        fail ("hash_get(%" PRIx64 ") => %" PRIu64 " != %" PRIu64, keys[i],
+              hash_get (hash, keys[i]), expect);
+    }
+  // the outliers replaced by keys not set
+  for (int i = 0; i < num; i += 10)
+    if (hash_get (hash, (uint64_t)i + 1) != HASH_NOT_FOUND && !failures++)
+      fail ("hash_get(%d) found", i + 1);
+  if (hash_get (hash, UINT64_C (0xffffffffffff)) != HASH_NOT_FOUND)
+    failures++;
+  if (!failures)
+    ok ("hash sparse: %" PRIu64 " dense, %" PRIu64 " in %" PRIu64
+        " buckets",
+        hash->dense_elems, hash->elems, hash->size);
+  hash_free (hash);
+  free (keys);
+}
+
+/* lookups of all keys, in random order */
+static void
+hash_bench (const char *name, const uint64_t *keys, const int num)
+{
+  const int reps = 20;
+  dwg_inthash *hash = hash_new (num / 10);
+  uint64_t sum = 0;
+  clock_t start;
+  double t;
+  int *order = (int *)malloc (num * sizeof (int));
+
+  for (int i = 0; i < num; i++)
+    {
+      hash_set (hash, keys[i], i);
+      order[i] = i;
+    }
+  for (int i = num - 1; i > 0; i--)
+    {
+      int j = maxrand (i + 1), tmp = order[i];
+      order[i] = order[j];
+      order[j] = tmp;
+    }
+  start = clock ();
+  for (int r = 0; r < reps; r++)
+    for (int i = 0; i < num; i++)
+      sum += hash_get (hash, keys[order[i]]);
+  t = (double)(clock () - start) / CLOCKS_PER_SEC;
+  if (sum != (uint64_t)reps * ((uint64_t)num * (num - 1) / 2))
+    fail ("hash %s: wrong sum", name);
+  else
+    ok ("hash %s: %.0f M lookups/s", name,
+        t > 0.0 ? (double)num * reps / t / 1e6 : 0.0);
+  hash_free (hash);
+  free (order);
+}
+
+static void
+bench_tests (void)
+{
+  const int num = 200000;
+  uint64_t *keys = (uint64_t *)malloc (num * sizeof (uint64_t));
+  srand (2);
+  // handles with a few gaps, like from a DWG
+  for (int i = 0; i < num; i++)
+    keys[i] = (uint64_t)i + i / 16 + 1;
+  hash_bench ("dense", keys, num);
+  for (int i = 0; i < num; i++)
+    keys[i] = (rand64 () | 1) + i;
+  hash_bench ("sparse", keys, num);
+  free (keys);
+}
+
 int
 main (int argc, char const *argv[])
 {
@@ -23,6 +122,7 @@ main (int argc, char const *argv[])
   int i;
   dwg_inthash *hash;
 
+  loglevel = is_make_silent () ? 0 : 2;
   hash = hash_new (max);
   for (i = 1; i < max / PRESSURE_FACTOR; i++)
     {
@@ -41,5 +141,8 @@ main (int argc, char const *argv[])
     }
 
   hash_free (hash);
-  return 0;
+
+  sparse_tests ();
+  bench_tests ();
+  return numfailed () ? 1 : 0;
 }
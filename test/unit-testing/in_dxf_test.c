@@ -0,0 +1,259 @@
+/* Imports the test-data example_*.dxf several times, checks that every
+   import gives the same objects, and measures the DXF import throughput
+   in group pairs per second. Also checks the DXF index of the imported
+   objects' fields, and dxf_read_data.
+   Usage: in_dxf_test [reps [dxf...]], default: 10 times the examples. */
+#define IN_DXF_TEST_C
+#include "common.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include "dwg.h"
+#include "dynapi.h"
+#include "tests_common.h"
+
+#if !defined(DISABLE_DXF) && defined(USE_WRITE)
+static const char *const examples[]
+    = { "example_r12.dxf",  "example_r13.dxf",  "example_r14.dxf",
+        "example_2000.dxf", "example_2004.dxf", "example_2007.dxf",
+        "example_2010.dxf", "example_2013.dxf", "example_2018.dxf" };
+
+/* The DXF index must be sorted, and must find all fields by their code.
+   Returns the number of errors. */
+static int
+check_dxf_index (const char *name, const Dwg_DYNAPI_field *fields,
+                 const Dwg_DYNAPI_dxf *dxf, const unsigned num_dxf)
+{
+  unsigned num_fields = 0;
+  int errors = 0;
+  if (!fields)
+    return 0;
+  while (fields[num_fields].name)
+    num_fields++;
+  for (unsigned i = 0; i < num_dxf; i++)
+    if (dxf[i].index >= num_fields
+        || (i && (dxf[i].dxf < dxf[i - 1].dxf
+                  || (dxf[i].dxf == dxf[i - 1].dxf
+                      && dxf[i].index <= dxf[i - 1].index))))
+      {
+        fail ("in_dxf: %s DXF index [%u] %d %u", name, i, dxf[i].dxf,
+              dxf[i].index);
+        errors++;
+      }
+  for (unsigned i = 0; i < num_fields; i++)
+    {
+      unsigned count, k;
+      const Dwg_DYNAPI_dxf *d;
+      if (!fields[i].dxf)
+        continue;
+      d = dwg_dynapi_dxf_find (dxf, num_dxf, fields[i].dxf, &count);
+      for (k = 0; k < count && d[k].index != i; k++)
+        ;
+      if (k == count)
+        {
+          fail ("in_dxf: %s.%s DXF %d not in the DXF index", name,
+                fields[i].name, fields[i].dxf);
+          errors++;
+        }
+    }
+  return errors;
+}
+
+static void
+check_dxf_indices (const Dwg_Data *dwg)
+{
+  const char *prev = "";
+  unsigned num_dxf;
+  const Dwg_DYNAPI_dxf *dxf = dwg_dynapi_common_entity_dxf (&num_dxf);
+  int errors = check_dxf_index ("ENTITY", dwg_dynapi_common_entity_fields (),
+                                dxf, num_dxf);
+  dxf = dwg_dynapi_common_object_dxf (&num_dxf);
+  errors += check_dxf_index ("OBJECT", dwg_dynapi_common_object_fields (),
+                             dxf, num_dxf);
+  for (BITCODE_BL i = 0; i < dwg->num_objects && !errors; i++)
+    {
+      const char *name = dwg->object[i].name;
+      if (!name || !strcmp (name, prev))
+        continue;
+      dxf = dwg_dynapi_entity_dxf (name, &num_dxf);
+      errors += check_dxf_index (name, dwg_dynapi_entity_fields (name), dxf,
+                                 num_dxf);
+      prev = name;
+    }
+}
+
+/* dxf_read_data: the same as dxf_read_file, without changing the data.
+   No or invalid data must fail. */
+static void
+read_data_tests (const char *path)
+{
+  static const char invalid[] = "  0\nSECTION\n  2\nHEADER\n  9\n";
+  Dwg_Data dwg, fdwg;
+  unsigned char *data, *copy;
+  size_t size;
+  int error, ferror, bad = 0;
+
+  memset (&dwg, 0, sizeof (dwg));
+  if (dxf_read_data (NULL, 0, &dwg) < DWG_ERR_CRITICAL)
+    bad++;
+  dwg_free (&dwg);
+  memset (&dwg, 0, sizeof (dwg));
+  if (dxf_read_data ((const unsigned char *)invalid, 0, &dwg)
+      < DWG_ERR_CRITICAL)
+    bad++;
+  dwg_free (&dwg);
+  memset (&dwg, 0, sizeof (dwg));
+  if (dxf_read_data ((const unsigned char *)invalid, sizeof (invalid) - 1,
+                     &dwg)
+      < DWG_ERR_CRITICAL)
+    bad++;
+  dwg_free (&dwg);
+  reset_loglevel ();
+  if (bad)
+    fail ("in_dxf read_data: %d invalid data not rejected", bad);
+
+  data = test_read_file (path, &size);
+  copy = data ? (unsigned char *)malloc (size) : NULL;
+  if (!copy)
+    {
+      free (data);
+      if (!bad)
+        ok ("in_dxf read_data: invalid data rejected");
+      return;
+    }
+  memcpy (copy, data, size);
+  memset (&dwg, 0, sizeof (dwg));
+  memset (&fdwg, 0, sizeof (fdwg));
+  ferror = dxf_read_file (path, &fdwg);
+  error = dxf_read_data (data, size, &dwg);
+  reset_loglevel ();
+  if (error != ferror || dwg.num_objects != fdwg.num_objects
+      || memcmp (data, copy, size))
+    fail ("in_dxf read_data: %s error 0x%x/0x%x, %u/%u objects", path,
+          error, ferror, (unsigned)dwg.num_objects,
+          (unsigned)fdwg.num_objects);
+  else if (!bad)
+    ok ("in_dxf read_data: invalid data rejected, %u objects as from the "
+        "file",
+        (unsigned)dwg.num_objects);
+  dwg_free (&dwg);
+  dwg_free (&fdwg);
+  reset_loglevel ();
+  free (data);
+  free (copy);
+}
+
+/* Imports the DXF reps times. Returns the seconds of all imports, or a
+   negative value if not found or with different results. */
+static double
+import_dxf (const char *path, const int reps, size_t *pairs, size_t *size)
+{
+  double secs = 0.0;
+  BITCODE_BL num_objects = 0;
+  int first_error = 0;
+  struct stat attrib;
+  FILE *fp;
+  int c;
+
+  if (stat (path, &attrib) || !(fp = fopen (path, "rb")))
+    return -1.0;
+  // a group pair is two lines
+  *pairs = 0;
+  while ((c = fgetc (fp)) != EOF)
+    if (c == '\n')
+      (*pairs)++;
+  fclose (fp);
+  *pairs /= 2;
+  *size = (size_t)attrib.st_size;
+
+  for (int i = 0; i < reps; i++)
+    {
+      Dwg_Data dwg;
+      struct timespec t0, t1;
+      int error;
+      memset (&dwg, 0, sizeof (dwg));
+      clock_gettime (CLOCK_MONOTONIC, &t0);
+      error = dxf_read_file (path, &dwg);
+      clock_gettime (CLOCK_MONOTONIC, &t1);
+      secs += (double)(t1.tv_sec - t0.tv_sec)
+              + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+      // some examples have errors, but always the same
+      if (i && (error != first_error || dwg.num_objects != num_objects))
+        {
+          const BITCODE_BL num = dwg.num_objects;
+          dwg_free (&dwg);
+          reset_loglevel ();
+          fail ("in_dxf: %s import %d: error 0x%x/0x%x, %u/%u objects", path,
+                i, error, first_error, (unsigned)num, (unsigned)num_objects);
+          return -1.0;
+        }
+      if (!i)
+        check_dxf_indices (&dwg);
+      first_error = error;
+      num_objects = dwg.num_objects;
+      dwg_free (&dwg);
+      reset_loglevel ();
+    }
+  return secs;
+}
+#endif
+
+int
+main (int argc, char const *argv[])
+{
+#if !defined(DISABLE_DXF) && defined(USE_WRITE)
+  const char *dir = test_data_dir ();
+  struct stat attrib;
+  size_t total_pairs = 0, total_size = 0;
+  double total_secs = 0.0;
+  int reps = 10, num = 0;
+
+  loglevel = is_make_silent () ? 0 : 2;
+  if (argc > 1)
+    reps = (int)strtol (argv[1], NULL, 10);
+  if (reps < 1)
+    reps = 1;
+
+  for (int i = 0; i < (argc > 2 ? argc - 2 : ARRAY_SIZE (examples)); i++)
+    {
+      char path[1024];
+      size_t pairs, size;
+      double secs;
+      if (argc > 2)
+        snprintf (path, sizeof (path), "%s", argv[i + 2]);
+      else if (dir)
+        snprintf (path, sizeof (path), "%s/%s", dir, examples[i]);
+      else
+        break;
+      if (stat (path, &attrib))
+        continue;
+      secs = import_dxf (path, reps, &pairs, &size);
+      if (secs < 0.0)
+        continue;
+      num++;
+      total_pairs += pairs * reps;
+      total_size += size * reps;
+      total_secs += secs;
+    }
+  if (dir && argc <= 2)
+    {
+      char path[1024];
+      snprintf (path, sizeof (path), "%s/%s", dir, examples[3]);
+      if (!stat (path, &attrib))
+        read_data_tests (path);
+    }
+  if (!num)
+    ok ("in_dxf: skipped, no DXFs");
+  else if (!numfailed ())
+    ok ("in_dxf: %d DXFs imported %d times, %.0f pairs/s, %.1f MB/s", num,
+        reps, total_secs > 0.0 ? (double)total_pairs / total_secs : 0.0,
+        total_secs > 0.0 ? (double)total_size / total_secs / 1e6 : 0.0);
+  return numfailed () ? 1 : 0;
+#else
+  (void)argc;
+  (void)argv;
+  ok ("in_dxf: skipped, no DXF import");
+  return 0;
+#endif
+}
@@ -0,0 +1,356 @@
+/* Exports the test-data example_*.dwg to JSON, imports that JSON several
+   times, alternately from memory and streamed from a file, checks that
+   every import gives the same objects, and measures the JSON import
+   throughput in tokens per second. Truncated JSON must fail. Also checks
+   json_read_data.
+   Usage: in_json_test [reps [dwg...]], default: 10 times the examples. */
+#define IN_JSON_TEST_C
+#include "common.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include "dwg.h"
+#include "bits.h"
+#include "tests_common.h"
+
+#if !defined(DISABLE_DXF) && !defined(DISABLE_JSON) && defined(USE_WRITE)
+#  include "in_json.h"
+#  include "out_json.h"
+
+static const char *const examples[]
+    = { "example_r14.dwg",  "example_2000.dwg", "example_2004.dwg",
+        "example_2007.dwg", "example_2010.dwg", "example_2013.dwg",
+        "example_2018.dwg" };
+
+/* Returns the JSON of the DWG at path in a malloc'ed buffer, or NULL. */
+static char *
+export_json (const char *path, size_t *size)
+{
+  Dwg_Data dwg;
+  Bit_Chain dat = { 0 };
+  char *json = NULL;
+  int error;
+  memset (&dwg, 0, sizeof (dwg));
+  error = dwg_read_file (path, &dwg);
+  if (error < DWG_ERR_CRITICAL && (dat.fh = tmpfile ()))
+    {
+      long len;
+      dat.version = dat.from_version = dwg.header.version;
+      dat.codepage = dwg.header.codepage;
+      error = dwg_write_json (&dat, &dwg);
+      len = ftell (dat.fh);
+      if (error < DWG_ERR_CRITICAL && len > 0)
+        {
+          json = (char *)malloc ((size_t)len + 1);
+          rewind (dat.fh);
+          if (json && fread (json, 1, (size_t)len, dat.fh) == (size_t)len)
+            {
+              json[len] = '\0';
+              *size = (size_t)len;
+            }
+          else
+            {
+              free (json);
+              json = NULL;
+            }
+        }
+      fclose (dat.fh);
+    }
+  dwg_free (&dwg);
+  return json;
+}
+
+/* Imports the JSON of the DWG reps times. Returns the seconds of all
+   imports, or a negative value if not exported or with different
+   results. */
+static double
+import_json (const char *path, const int reps, size_t *tokens, size_t *size)
+{
+  double secs = 0.0;
+  BITCODE_BL num_objects = 0;
+  int first_error = 0;
+  char *json = export_json (path, size);
+  char *buf;
+  FILE *fh;
+
+  reset_loglevel ();
+  if (!json)
+    return -1.0;
+  buf = (char *)malloc (*size + 1);
+  fh = tmpfile ();
+  if (!buf || !fh || fwrite (json, 1, *size, fh) != *size)
+    {
+      if (fh)
+        fclose (fh);
+      free (buf);
+      free (json);
+      return -1.0;
+    }
+  // every key and value is a token, approximately
+  *tokens = 0;
+  for (size_t i = 0; i < *size; i++)
+    if (json[i] == ',' || json[i] == ':' || json[i] == '[' || json[i] == '{')
+      (*tokens)++;
+
+  for (int i = 0; i < reps; i++)
+    {
+      Dwg_Data dwg;
+      Bit_Chain dat = { 0 };
+      struct timespec t0, t1;
+      int error;
+      // the import terminates the strings in place
+      memcpy (buf, json, *size + 1);
+      memset (&dwg, 0, sizeof (dwg));
+      if (i & 1)
+        {
+          rewind (fh);
+          dat.fh = fh;
+        }
+      else
+        {
+          dat.chain = (unsigned char *)buf;
+          dat.size = *size;
+        }
+      clock_gettime (CLOCK_MONOTONIC, &t0);
+      error = dwg_read_json (&dat, &dwg);
+      clock_gettime (CLOCK_MONOTONIC, &t1);
+      secs += (double)(t1.tv_sec - t0.tv_sec)
+              + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+      if (dat.fh) // the streamed window
+        free (dat.chain);
+      if (i && (error != first_error || dwg.num_objects != num_objects))
+        {
+          const BITCODE_BL num = dwg.num_objects;
+          dwg_free (&dwg);
+          reset_loglevel ();
+          fclose (fh);
+          free (buf);
+          free (json);
+          fail ("in_json: %s import %d: error 0x%x/0x%x, %u/%u objects", path,
+                i, error, first_error, (unsigned)num, (unsigned)num_objects);
+          return -1.0;
+        }
+      first_error = error;
+      num_objects = dwg.num_objects;
+      dwg_free (&dwg);
+      reset_loglevel ();
+    }
+  fclose (fh);
+  free (buf);
+  free (json);
+  return secs;
+}
+
+/* json_read_data: the same as dwg_read_json, without changing the data.
+   No or invalid data must fail. */
+static void
+read_data_tests (const char *path)
+{
+  static const char invalid[] = "{ \"FILEHEADER\": { \"version\": ";
+  Dwg_Data dwg, fdwg;
+  Bit_Chain dat = { 0 };
+  size_t size;
+  char *json, *copy;
+  int error, ferror, bad = 0;
+
+  memset (&dwg, 0, sizeof (dwg));
+  if (json_read_data (NULL, 0, &dwg) < DWG_ERR_CRITICAL)
+    bad++;
+  dwg_free (&dwg);
+  memset (&dwg, 0, sizeof (dwg));
+  if (json_read_data ((const unsigned char *)invalid, 0, &dwg)
+      < DWG_ERR_CRITICAL)
+    bad++;
+  dwg_free (&dwg);
+  memset (&dwg, 0, sizeof (dwg));
+  if (json_read_data ((const unsigned char *)invalid, sizeof (invalid) - 1,
+                      &dwg)
+      < DWG_ERR_CRITICAL)
+    bad++;
+  dwg_free (&dwg);
+  reset_loglevel ();
+  if (bad)
+    fail ("in_json read_data: %d invalid data not rejected", bad);
+
+  json = export_json (path, &size);
+  copy = json ? (char *)malloc (size + 1) : NULL;
+  reset_loglevel ();
+  if (!copy)
+    {
+      free (json);
+      if (!bad)
+        ok ("in_json read_data: invalid data rejected");
+      return;
+    }
+  memcpy (copy, json, size + 1);
+  memset (&dwg, 0, sizeof (dwg));
+  memset (&fdwg, 0, sizeof (fdwg));
+  error = json_read_data ((const unsigned char *)json, size, &dwg);
+  if (memcmp (json, copy, size))
+    bad++;
+  // dwg_read_json patches its input
+  dat.chain = (unsigned char *)copy;
+  dat.size = size;
+  ferror = dwg_read_json (&dat, &fdwg);
+  reset_loglevel ();
+  if (error != ferror || dwg.num_objects != fdwg.num_objects || bad)
+    fail ("in_json read_data: %s error 0x%x/0x%x, %u/%u objects", path,
+          error, ferror, (unsigned)dwg.num_objects,
+          (unsigned)fdwg.num_objects);
+  else if (!bad)
+    ok ("in_json read_data: invalid data rejected, %u objects as from a "
+        "chain",
+        (unsigned)dwg.num_objects);
+  dwg_free (&dwg);
+  dwg_free (&fdwg);
+  reset_loglevel ();
+  free (json);
+  free (copy);
+}
+
+/* Imports the JSON truncated to size, from memory and streamed. Returns
+   the number of imports not failing. */
+static int
+import_truncated (const char *json, const size_t size)
+{
+  int failures = 0;
+  for (int streamed = 0; streamed <= 1; streamed++)
+    {
+      Dwg_Data dwg;
+      Bit_Chain dat = { 0 };
+      char *buf = NULL;
+      int error;
+      memset (&dwg, 0, sizeof (dwg));
+      if (streamed)
+        {
+          dat.fh = tmpfile ();
+          if (!dat.fh || fwrite (json, 1, size, dat.fh) != size)
+            {
+              if (dat.fh)
+                fclose (dat.fh);
+              continue;
+            }
+          rewind (dat.fh);
+        }
+      else
+        {
+          buf = (char *)malloc (size + 1);
+          if (!buf)
+            continue;
+          memcpy (buf, json, size);
+          buf[size] = '\0';
+          dat.chain = (unsigned char *)buf;
+          dat.size = size;
+        }
+      error = dwg_read_json (&dat, &dwg);
+      if (error < DWG_ERR_CRITICAL)
+        failures++;
+      if (streamed)
+        {
+          free (dat.chain);
+          fclose (dat.fh);
+        }
+      free (buf);
+      dwg_free (&dwg);
+      reset_loglevel ();
+    }
+  return failures;
+}
+
+/* Truncated JSON: within the OBJECTS after the 5th object, in the middle,
+   and without the final close. */
+static void
+truncated_tests (const char *path)
+{
+  size_t size, cuts[3];
+  const char *objects;
+  char *json = export_json (path, &size);
+  int failures = 0;
+
+  reset_loglevel ();
+  if (!json || !(objects = strstr (json, "\"OBJECTS\": [")))
+    {
+      free (json);
+      ok ("in_json truncated: skipped, no JSON");
+      return;
+    }
+  cuts[0] = size / 2;
+  cuts[1] = size - 2;
+  cuts[2] = 0;
+  for (int i = 0; i < 6 && objects; i++)
+    if ((objects = strstr (objects + 1, "\n    {")))
+      cuts[2] = (size_t)(objects - json) + 1;
+  for (int i = 0; i < ARRAY_SIZE (cuts); i++)
+    if (cuts[i])
+      failures += import_truncated (json, cuts[i]);
+  free (json);
+  if (failures)
+    fail ("in_json truncated: %d imports did not fail", failures);
+  else
+    ok ("in_json truncated: all imports failed");
+}
+#endif
+
+int
+main (int argc, char const *argv[])
+{
+#if !defined(DISABLE_DXF) && !defined(DISABLE_JSON) && defined(USE_WRITE)
+  const char *dir = test_data_dir ();
+  struct stat attrib;
+  size_t total_tokens = 0, total_size = 0;
+  double total_secs = 0.0;
+  int reps = 10, num = 0;
+
+  loglevel = is_make_silent () ? 0 : 2;
+  if (argc > 1)
+    reps = (int)strtol (argv[1], NULL, 10);
+  if (reps < 1)
+    reps = 1;
+
+  for (int i = 0; i < (argc > 2 ? argc - 2 : ARRAY_SIZE (examples)); i++)
+    {
+      char path[1024];
+      size_t tokens, size;
+      double secs;
+      if (argc > 2)
+        snprintf (path, sizeof (path), "%s", argv[i + 2]);
+      else if (dir)
+        snprintf (path, sizeof (path), "%s/%s", dir, examples[i]);
+      else
+        break;
+      if (stat (path, &attrib))
+        continue;
+      secs = import_json (path, reps, &tokens, &size);
+      if (secs < 0.0)
+        continue;
+      num++;
+      total_tokens += tokens * reps;
+      total_size += size * reps;
+      total_secs += secs;
+    }
+  if (dir && argc <= 2)
+    {
+      char path[1024];
+      snprintf (path, sizeof (path), "%s/%s", dir, examples[1]);
+      if (!stat (path, &attrib))
+        {
+          read_data_tests (path);
+          truncated_tests (path);
+        }
+    }
+  if (!num)
+    ok ("in_json: skipped, no DWGs");
+  else if (!numfailed ())
+    ok ("in_json: %d JSONs imported %d times, %.0f tokens/s, %.1f MB/s", num,
+        reps, total_secs > 0.0 ? (double)total_tokens / total_secs : 0.0,
+        total_secs > 0.0 ? (double)total_size / total_secs / 1e6 : 0.0);
+  return numfailed () ? 1 : 0;
+#else
+  (void)argc;
+  (void)argv;
+  (void)fail;
+  ok ("in_json: skipped, no JSON import");
+  return 0;
+#endif
+}
@@ -14,6 +14,10 @@
 #if defined(BITS_TEST_C) || defined(DECODE_TEST_C)
 #  include "bits.h"
 #endif
+#include <sys/stat.h>
+#ifdef HAVE_SCANDIR
+#  include <dirent.h>
+#endif
 
 static int num = 0;
 static int failed = 0;
@@ -173,3 +177,86 @@ is_make_silent (void)
   else
     return 0; // make check without -s
 }
+
+// The library sets the loglevel from dwg->opts on each read and free.
+// Sets it back to the one of the test.
+static inline void
+reset_loglevel (void)
+{
+  loglevel = is_make_silent () ? 0 : 2;
+}
+
+// The test/test-data dir, via $top_srcdir or relative to the build dir.
+// NULL if not found.
+static inline const char *
+test_data_dir (void)
+{
+  static char dir[512];
+  const char *top_srcdir = getenv ("top_srcdir");
+  struct stat attrib;
+  if (top_srcdir)
+    snprintf (dir, sizeof (dir), "%s/test/test-data", top_srcdir);
+  else
+    strcpy (dir, "../test-data");
+  if (stat (dir, &attrib))
+    strcpy (dir, "../../../test/test-data");
+  return stat (dir, &attrib) ? NULL : dir;
+}
+
+// Calls add for each *.dwg in dir, sorted, and in its subdirs down to
+// depth levels.
+static inline void
+test_data_dwgs (const char *dir, const int depth,
+                void (*add) (const char *path, void *arg), void *arg)
+{
+#ifdef HAVE_SCANDIR
+  struct dirent **namelist;
+  int n = scandir (dir, &namelist, NULL, alphasort);
+  if (n < 0)
+    return;
+  for (int i = 0; i < n; i++)
+    {
+      const char *elem = namelist[i]->d_name;
+      char path[512];
+      struct stat attrib;
+      size_t len = strlen (elem);
+      if (*elem == '.'
+          || snprintf (path, sizeof (path), "%s/%s", dir, elem)
+                 >= (int)sizeof (path)
+          || stat (path, &attrib))
+        ; // skip
+      else if (S_ISDIR (attrib.st_mode) && depth > 0)
+        test_data_dwgs (path, depth - 1, add, arg);
+      else if (S_ISREG (attrib.st_mode) && len > 4
+               && !strcmp (&elem[len - 4], ".dwg"))
+        add (path, arg);
+      free (namelist[i]);
+    }
+  free (namelist);
+#else
+  (void)dir;
+  (void)depth;
+  (void)add;
+  (void)arg;
+#endif
+}
+
+// The malloc'ed contents of the file, or NULL if missing or empty.
+static inline unsigned char *
+test_read_file (const char *path, size_t *size)
+{
+  struct stat attrib;
+  unsigned char *buf;
+  FILE *fp;
+  if (stat (path, &attrib) || !attrib.st_size || !(fp = fopen (path, "rb")))
+    return NULL;
+  *size = (size_t)attrib.st_size;
+  buf = (unsigned char *)malloc (*size);
+  if (buf && fread (buf, 1, *size, fp) != *size)
+    {
+      free (buf);
+      buf = NULL;
+    }
+  fclose (fp);
+  return buf;
+}
@@ -0,0 +1,321 @@
+/* Stress test: read, convert to DXF and free the test-data DWGs from
+   several threads simultaneously, and compare with a serial run.
+   Also decodes the r2004+ objects in several threads, which must give the
+   same DXF, and writes the r13+ DWGs with 1 and with several encoder
+   threads, which must give the same bytes, also as r2004 with compressed
+   pages.
+   Best run under ThreadSanitizer, configured with --enable-sanitize=thread
+   or cmake -DLIBREDWG_SANITIZE=thread.
+   Usage: threads_test [dir [num_threads]], dir to test all its DWGs, also
+   in its subdirs. Default: the toplevel test-data DWGs, with 4 threads. */
+#define THREADS_TEST_C
+#include "common.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_PTHREAD_H
+#  include <pthread.h>
+#endif
+#include "dwg.h"
+#include "encode.h"
+#include "out_dxf.h"
+#include "tests_common.h"
+
+#define ROUNDS 2
+
+typedef struct _threads_file
+{
+  char *path;
+  int error;
+  BITCODE_BL num_objects;
+  long dxf_size;
+  uint32_t dxf_hash;
+} Threads_File;
+
+typedef struct _threads_test
+{
+  Threads_File *files;
+  unsigned num_files;
+  unsigned num_threads;
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_t mutex;
+#endif
+  unsigned failures;
+  char first_failure[256];
+} Threads_Test;
+
+typedef struct _threads_arg
+{
+  Threads_Test *t;
+  unsigned id;
+} Threads_Arg;
+
+static void
+add_dwg (const char *path, void *arg)
+{
+  Threads_Test *t = (Threads_Test *)arg;
+  t->files = (Threads_File *)realloc (t->files, (t->num_files + 1)
+                                                    * sizeof (Threads_File));
+  memset (&t->files[t->num_files], 0, sizeof (Threads_File));
+  t->files[t->num_files++].path = strdup (path);
+}
+
+/* Reads, converts and frees one DWG. The r2004+ objects are decoded with
+   num_threads threads. */
+static void
+process_dwg (const char *path, const unsigned num_threads,
+             Threads_File *result)
+{
+  Dwg_Data dwg;
+  memset (&dwg, 0, sizeof (dwg));
+  memset (result, 0, sizeof (Threads_File));
+  dwg.num_threads = num_threads;
+  result->error = dwg_read_file (path, &dwg);
+  result->num_objects = dwg.num_objects;
+#ifndef DISABLE_DXF
+  if (result->error < DWG_ERR_CRITICAL)
+    {
+      Bit_Chain dat = { 0 };
+      dat.fh = tmpfile ();
+      if (dat.fh)
+        {
+          int c;
+          uint32_t hash = 2166136261U; // FNV-1a
+          dat.version = dat.from_version = dwg.header.version;
+          dat.codepage = dwg.header.codepage;
+          dwg_write_dxf (&dat, &dwg);
+          result->dxf_size = ftell (dat.fh);
+          rewind (dat.fh);
+          while ((c = fgetc (dat.fh)) != EOF)
+            hash = (hash ^ (uint32_t)c) * 16777619U;
+          result->dxf_hash = hash;
+          fclose (dat.fh);
+        }
+    }
+#endif
+  dwg_free (&dwg);
+}
+
+/* Writes the r13+ DWG as version with num_threads threads. Returns the
+   hash of the written bytes, 0 if not read or written. */
+static uint32_t
+encode_dwg (const char *path, const Dwg_Version_Type version,
+            const unsigned compress_level, const unsigned num_threads,
+            size_t *size)
+{
+  Dwg_Data dwg;
+  Bit_Chain dat = { 0 };
+  uint32_t hash = 2166136261U; // FNV-1a
+  int error;
+  memset (&dwg, 0, sizeof (dwg));
+  *size = 0;
+  error = dwg_read_file (path, &dwg);
+  if (error >= DWG_ERR_CRITICAL || dwg.header.from_version < R_13b1)
+    {
+      dwg_free (&dwg);
+      return 0;
+    }
+  dwg.header.version = version;
+  dwg.num_threads = num_threads;
+  dwg.compress_level = compress_level;
+  dat.opts = dwg.opts;
+  dat.version = version;
+  dat.from_version = dwg.header.from_version;
+  dat.codepage = dwg.header.codepage;
+  error = dwg_encode (&dwg, &dat);
+  if (error < DWG_ERR_CRITICAL)
+    {
+      for (size_t i = 0; i < dat.byte; i++)
+        hash = (hash ^ dat.chain[i]) * 16777619U;
+      *size = dat.byte;
+    }
+  else
+    hash = 0;
+  free (dat.chain);
+  dwg_free (&dwg);
+  return hash;
+}
+
+static void
+check_dwg (Threads_Test *t, const unsigned i)
+{
+  Threads_File r;
+  const Threads_File *f = &t->files[i];
+  process_dwg (f->path, 1, &r);
+  if (r.error != f->error || r.num_objects != f->num_objects
+      || r.dxf_size != f->dxf_size || r.dxf_hash != f->dxf_hash)
+    {
+#ifdef HAVE_PTHREAD_H
+      pthread_mutex_lock (&t->mutex);
+#endif
+      if (!t->failures++)
+        snprintf (t->first_failure, sizeof (t->first_failure),
+                  "%s: error 0x%x/0x%x, %u/%u objects, dxf size %ld/%ld",
+                  f->path, r.error, f->error, (unsigned)r.num_objects,
+                  (unsigned)f->num_objects, r.dxf_size, f->dxf_size);
+#ifdef HAVE_PTHREAD_H
+      pthread_mutex_unlock (&t->mutex);
+#endif
+    }
+}
+
+#ifdef HAVE_PTHREAD_H
+/* Each thread starts at another file, so that different drawings and the
+   same drawings are processed at the same time. */
+static void *
+threads_worker (void *arg)
+{
+  Threads_Arg *a = (Threads_Arg *)arg;
+  Threads_Test *t = a->t;
+  for (unsigned r = 0; r < ROUNDS; r++)
+    for (unsigned j = 0; j < t->num_files; j++)
+      check_dwg (t, (a->id + j) % t->num_files);
+  return NULL;
+}
+#endif
+
+#ifdef HAVE_PTHREAD_H
+/* Reads the DWGs with the objects decoded in num_threads threads, which
+   must give the same DXF as the serial decode. */
+static void
+decode_tests (const Threads_Test *t)
+{
+  unsigned num_read = 0;
+  const char *differ = NULL;
+  for (unsigned i = 0; i < t->num_files; i++)
+    {
+      Threads_File r;
+      const Threads_File *f = &t->files[i];
+      process_dwg (f->path, t->num_threads, &r);
+      reset_loglevel ();
+      if (f->error >= DWG_ERR_CRITICAL)
+        continue;
+      num_read++;
+      if ((r.error != f->error || r.num_objects != f->num_objects
+           || r.dxf_size != f->dxf_size || r.dxf_hash != f->dxf_hash)
+          && !differ)
+        differ = f->path;
+    }
+  if (differ)
+    fail ("threads: %s decoded differently with %u threads", differ,
+          t->num_threads);
+  else
+    ok ("threads: %u DWGs decoded the same with 1 and %u threads", num_read,
+        t->num_threads);
+}
+
+static void
+encode_tests (const Threads_Test *t, const Dwg_Version_Type version,
+              const unsigned compress_level)
+{
+  unsigned written = 0;
+  const char *differ = NULL;
+  for (unsigned i = 0; i < t->num_files; i++)
+    {
+      size_t size1, size;
+      const uint32_t hash1
+          = encode_dwg (t->files[i].path, version, compress_level, 1, &size1);
+      const uint32_t hash
+          = hash1 ? encode_dwg (t->files[i].path, version, compress_level,
+                                t->num_threads, &size)
+                  : 0;
+      reset_loglevel ();
+      if (!hash1)
+        continue;
+      written++;
+      if ((hash != hash1 || size != size1) && !differ)
+        differ = t->files[i].path;
+    }
+  if (differ)
+    fail ("threads: %s written as %s differently with %u threads", differ,
+          dwg_version_type (version), t->num_threads);
+  else
+    ok ("threads: %u DWGs written as %s the same with 1 and %u threads",
+        written, dwg_version_type (version), t->num_threads);
+}
+#endif
+
+int
+main (int argc, char const *argv[])
+{
+  Threads_Test t;
+  const char *dir;
+  int depth = 0;
+
+  loglevel = is_make_silent () ? 0 : 2;
+  memset (&t, 0, sizeof (t));
+  t.num_threads = 4;
+  if (argc > 1)
+    {
+      dir = argv[1];
+      depth = 1;
+      if (argc > 2)
+        t.num_threads = (unsigned)strtol (argv[2], NULL, 10);
+    }
+  else
+    dir = test_data_dir ();
+  if (!dir)
+    {
+      ok ("threads: skipped, no test-data");
+      return 0;
+    }
+  test_data_dwgs (dir, depth, add_dwg, &t);
+  if (!t.num_files)
+    {
+      ok ("threads: skipped, no DWGs in %s", dir);
+      return 0;
+    }
+  // the serial results to compare against
+  for (unsigned i = 0; i < t.num_files; i++)
+    {
+      char *path = t.files[i].path;
+      process_dwg (path, 1, &t.files[i]);
+      t.files[i].path = path;
+      reset_loglevel ();
+    }
+
+#ifdef HAVE_PTHREAD_H
+  {
+    pthread_t *threads
+        = (pthread_t *)calloc (t.num_threads, sizeof (pthread_t));
+    Threads_Arg *args
+        = (Threads_Arg *)calloc (t.num_threads, sizeof (Threads_Arg));
+    unsigned started = 0;
+    pthread_mutex_init (&t.mutex, NULL);
+    for (unsigned i = 0; i < t.num_threads; i++)
+      {
+        args[i].t = &t;
+        args[i].id = i * t.num_files / t.num_threads;
+        if (!pthread_create (&threads[started], NULL, threads_worker,
+                             &args[i]))
+          started++;
+      }
+    for (unsigned i = 0; i < started; i++)
+      pthread_join (threads[i], NULL);
+    pthread_mutex_destroy (&t.mutex);
+    free (threads);
+    free (args);
+    if (t.failures)
+      fail ("threads: %u differences, first %s", t.failures,
+            t.first_failure);
+    else if (started < t.num_threads)
+      fail ("threads: only %u of %u threads started", started,
+            t.num_threads);
+    else
+      ok ("threads: %u DWGs read, converted and freed %u times in %u "
+          "threads",
+          t.num_files, ROUNDS, t.num_threads);
+  }
+#else
+  ok ("threads: skipped, no pthreads");
+#endif
+
+#ifdef HAVE_PTHREAD_H
+  decode_tests (&t);
+  encode_tests (&t, R_2000, DWG_COMPRESS_NONE);
+  encode_tests (&t, R_2004, DWG_COMPRESS_NORMAL);
+#endif
+  for (unsigned i = 0; i < t.num_files; i++)
+    free (t.files[i].path);
+  free (t.files);
+  return numfailed () ? 1 : 0;
+}